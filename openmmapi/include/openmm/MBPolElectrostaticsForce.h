@@ -38,6 +38,7 @@
 #include "openmm/Vec3.h"
 
 #include <sstream>
+#include <string>
 #include <vector>
 
 using namespace OpenMM;
@@ -72,6 +73,59 @@ public:
         PME = 1
     };
 
+    enum PolarizationSolver {
+
+        /**
+         * The induced dipoles are converged by successive over-relaxation.  This is the default.
+         */
+        SOR = 0,
+
+        /**
+         * The induced dipoles are converged by conjugate gradient, preconditioned by the polarization
+         * blocks of the individual molecules.  This usually needs several times fewer iterations.
+         */
+        ConjugateGradient = 1,
+
+        /**
+         * The induced dipoles are extrapolated by direct inversion in the iterative subspace (DIIS),
+         * as on the CUDA platform, which always uses it.
+         */
+        DIIS = 2,
+
+        /**
+         * The induced dipoles are solved exactly by factorizing the full polarization matrix of the
+         * polarizable sites, in one step.  The cost grows with the cube of the number of sites, so this
+         * is meant for small clusters; NoCutoff only.
+         */
+        Dense = 3
+    };
+
+    enum PolarizationType {
+
+        /**
+         * The induced dipoles are converged self-consistently every step.  This is the default.
+         */
+        Mutual = 0,
+
+        /**
+         * The induced dipoles of each step are a fixed number of iterations from auxiliary dipoles that
+         * are propagated along with the particles (an extended Lagrangian scheme in the spirit of the iEL/SCF
+         * method of Albaugh et al., J. Chem. Theory Comput. 12, 3427 (2016)), so that no self-consistent
+         * iterations are needed.  The first step, and the first step after the positions jump or the box
+         * changes, is converged.  Only the Reference and CPU platforms support it; the CUDA platform throws
+         * an exception.
+         */
+        ExtendedLagrangian = 1,
+
+        /**
+         * The induced dipoles are extrapolated from a fixed number of iterations, the OPT method of Simmonett et al.,
+         * J. Chem. Phys. 143, 074115 (2015), with forces that are the exact derivatives of the resulting energy.
+         * Every step costs the same, one field calculation per extrapolation coefficient and a few more for the forces.
+         * Only the Reference and CPU platforms support it; the CUDA platform throws an exception.
+         */
+        Extrapolated = 2
+    };
+
     /**
      * Create an MBPolElectrostaticsForce.
      */
@@ -145,6 +199,15 @@ public:
      */
     int getPmeBSplineOrder() const;
 
+    /**
+     * Set the B-spline order to use for PME charge spreading, between 4 and 8 (default 5); only the
+     * Reference and CPU platforms support an order other than 5. When the grid dimensions are chosen
+     * automatically, a lower order gets a finer grid and a higher order a coarser one.
+     *
+     * @param order the B-spline order
+     */
+    void setPmeBSplineOrder(int order);
+
     /**
      * Get the PME grid dimensions.  If Ewald alpha is 0 (the default), this is ignored and grid dimensions
      * are chosen automatically based on the Ewald error tolerance.
@@ -161,6 +224,48 @@ public:
      */
     void setPmeGridDimensions(const std::vector<int>& gridDimension);
 
+    /**
+     * Set whether the Reference and CPU platforms tune the PME parameters that are chosen automatically,
+     * when Ewald alpha or the grid dimensions are left at 0.  At the first evaluation, a few evaluations
+     * are timed for each cutoff from 1 to 1.3 times the cutoff distance and each B-spline order from 4
+     * to 6, with the Ewald alpha and grid dimensions that meet the Ewald error tolerance for that cutoff
+     * and order, and the fastest is kept.  Cutoffs beyond the cutoff distance are only tried up to 0.45
+     * times the shortest box edge.  getPmeParametersInContext() reports the choice.  This is off by default.
+     */
+    void setUsePmeTuning(bool useTuning);
+
+    /**
+     * Get whether the automatically chosen PME parameters are tuned by timing.
+     */
+    bool getUsePmeTuning(void) const;
+
+    /**
+     * Set a file in which the tuned PME parameters are cached, keyed by the platform, the number of
+     * particles, the periodic box, the Ewald error tolerance and the cutoff distance.  A Context whose
+     * key is in the file uses the stored parameters instead of timing, otherwise it appends its choice.
+     * An empty name, the default, caches nothing.
+     */
+    void setPmeTuningCacheFile(const std::string& fileName);
+
+    /**
+     * Get the file in which the tuned PME parameters are cached.
+     */
+    const std::string& getPmeTuningCacheFile(void) const;
+
+    /**
+     * Get the PME parameters used by a Context: those set, those chosen from the Ewald error tolerance,
+     * or those picked by the tuner.  Only the Reference and CPU platforms support it.
+     *
+     * @param context      context
+     * @param alpha        the Ewald alpha parameter, in 1/nm
+     * @param cutoff       the real space cutoff distance, in nm
+     * @param nx           the number of grid points along the X axis
+     * @param ny           the number of grid points along the Y axis
+     * @param nz           the number of grid points along the Z axis
+     * @param order        the B-spline order
+     */
+    void getPmeParametersInContext(Context& context, double& alpha, double& cutoff, int& nx, int& ny, int& nz, int& order);
+
     /**
      * Add multipole-related info for a particle
      *
@@ -256,6 +361,97 @@ void getElectrostaticsParameters(int index, double& charge,
      */
     void setEwaldErrorTolerance(double tol);
 
+    /**
+     * Set whether the real space dipole-dipole interaction tensor is assembled once per evaluation
+     * and reused by every iteration of the induced dipoles, instead of recomputing the pair
+     * interactions at each iteration.  This trades memory (six values per interacting pair)
+     * for speed; it is used by the Reference and CPU platforms and is on by default.
+     */
+    void setUseDipoleFieldTensor(bool useTensor);
+
+    /**
+     * Get whether the real space dipole-dipole interaction tensor is reused by the iterations
+     * of the induced dipoles.
+     */
+    bool getUseDipoleFieldTensor(void) const;
+
+    /**
+     * Set whether the Reference and CPU platforms start the induced dipoles of each step from an
+     * extrapolation of the converged dipoles of the previous steps (the predictor of the always
+     * stable predictor-corrector method) instead of the dipoles induced by the fixed field.  The
+     * history is dropped whenever the positions jump or the periodic box changes.  This is on by default.
+     */
+    void setUseInducedDipolePredictor(bool usePredictor);
+
+    /**
+     * Get whether the induced dipoles of each step start from an extrapolation of the previous steps.
+     */
+    bool getUseInducedDipolePredictor(void) const;
+
+    /**
+     * Set the method used to converge the induced dipoles on the Reference and CPU platforms.
+     */
+    void setPolarizationSolver(PolarizationSolver solver);
+
+    /**
+     * Get the method used to converge the induced dipoles.
+     */
+    PolarizationSolver getPolarizationSolver(void) const;
+
+    /**
+     * Set the number of polarizable sites up to which the Reference and CPU platforms use the Dense
+     * solver whatever the polarization solver, with NoCutoff.  A negative number never switches.
+     * The default is 128.
+     */
+    void setDenseSolverThreshold(int sites);
+
+    /**
+     * Get the number of polarizable sites up to which the Dense solver is used.
+     */
+    int getDenseSolverThreshold(void) const;
+
+    /**
+     * Set how the induced dipoles are computed on the Reference and CPU platforms.
+     */
+    void setPolarizationType(PolarizationType type);
+
+    /**
+     * Get how the induced dipoles are computed.
+     */
+    PolarizationType getPolarizationType(void) const;
+
+    /**
+     * Set the parameters of the ExtendedLagrangian polarization type.
+     *
+     * @param coupling      coupling of the auxiliary dipoles to the induced dipoles, (omega*dt)^2; 1.82 by default
+     * @param dissipation   strength of the dissipation that keeps the auxiliary dipoles from drifting and stands in
+     *                      for their thermostat; 0.018 by default, 0 for the time-reversible propagation
+     * @param iterations    number of iterations from the auxiliary dipoles each step, at least 1; each costs one
+     *                      field evaluation and reduces the error of the induced dipoles; 1 by default
+     */
+    void setExtendedLagrangianParameters(double coupling, double dissipation, int iterations);
+
+    /**
+     * Get the parameters of the ExtendedLagrangian polarization type.
+     *
+     * @param coupling      coupling of the auxiliary dipoles to the induced dipoles
+     * @param dissipation   strength of the dissipation
+     * @param iterations    number of iterations from the auxiliary dipoles each step
+     */
+    void getExtendedLagrangianParameters(double& coupling, double& dissipation, int& iterations) const;
+
+    /**
+     * Set the coefficients of the Extrapolated polarization type: the induced dipoles are sum_k c_k mu_k, where
+     * mu_0 are the dipoles induced by the fixed field and mu_k the k-th plain iteration from them.  The default
+     * is OPT3, { -0.154, 0.017, 0.658, 0.474 }.
+     */
+    void setExtrapolationCoefficients(const std::vector<double>& coefficients);
+
+    /**
+     * Get the coefficients of the Extrapolated polarization type.
+     */
+    const std::vector<double>& getExtrapolationCoefficients(void) const;
+
     /**
      * Get the electrostatic potential.
      *
@@ -267,6 +463,17 @@ void getElectrostaticsParameters(int index, double& charge,
     void getElectrostaticPotential(const std::vector< Vec3 >& inputGrid,
                                     Context& context, std::vector< double >& outputElectrostaticPotential);
 
+    /**
+     * Get the system polarizability, the derivative of the total induced dipole with respect to a uniform
+     * external field.  The induced dipoles of the permanent field and of a field along each axis are converged
+     * together in one pass, whatever the polarization type.  Only the Reference and CPU platforms support it.
+     *
+     * @param context      context
+     * @param outputPolarizability output polarizability in nm^3 (xx, xy, xz, yx, yy, yz, zx, zy, zz),
+     *                             the first index that of the dipole
+     */
+    void getSystemPolarizability(Context& context, std::vector< double >& outputPolarizability);
+
     /**
      * Update the multipole parameters in a Context to match those stored in this Force object.  This method
      * provides an efficient method to update certain parameters in an existing Context without needing to reinitialize it.
@@ -288,12 +495,23 @@ private:
     double aewald;
     int pmeBSplineOrder;
     std::vector<int> pmeGridDimension;
+    bool usePmeTuning;
+    std::string pmeTuningCacheFile;
     int mutualInducedMaxIterations;
     double mutualInducedTargetEpsilon;
     double scalingDistanceCutoff;
     double electricConstant;
     double ewaldErrorTol;
     bool includeChargeRedistribution;
+    bool useDipoleFieldTensor;
+    PolarizationSolver polarizationSolver;
+    int denseSolverThreshold;
+    bool useInducedDipolePredictor;
+    PolarizationType polarizationType;
+    double extendedLagrangianCoupling;
+    double extendedLagrangianDissipation;
+    int extendedLagrangianIterations;
+    std::vector<double> extrapolationCoefficients;
     std::vector<double> tholeParameters;
     class ElectrostaticsInfo;
     std::vector<ElectrostaticsInfo> multipoles;
@@ -133,6 +133,18 @@ public:
      */
     double getCutoff(void) const;
 
+    /**
+     * Set the skin of the oxygen neighbor list.  The list is built for cutoff + skin and reused
+     * until some oxygen has moved more than half the skin; the skin is then adjusted from how
+     * often the list had to be rebuilt.  A skin of zero rebuilds the list on every evaluation.
+     */
+    void setNeighborListSkin(double skin);
+
+    /**
+     * Get the skin of the oxygen neighbor list.
+     */
+    double getNeighborListSkin(void) const;
+
     /**
      * Get the method used for handling long range nonbonded interactions.
      */
@@ -160,6 +172,7 @@ private:
     class ThreeBodyInfo;
     NonbondedMethod nonbondedMethod;
     double cutoff;
+    double neighborListSkin;
 
     std::vector<ThreeBodyInfo> parameters;
     std::vector< std::vector< std::vector<double> > > sigEpsTable;
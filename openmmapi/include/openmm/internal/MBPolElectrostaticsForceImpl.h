@@ -66,6 +66,8 @@ public:
                                     std::vector< double >& outputElectrostaticPotential );
 
     void getSystemElectrostaticsMoments( ContextImpl& context, std::vector< double >& outputElectrostaticsMonents );
+    void getSystemPolarizability( ContextImpl& context, std::vector< double >& outputPolarizability );
+    void getPmeParameters( ContextImpl& context, double& alpha, double& cutoff, int& nx, int& ny, int& nz, int& order );
     void updateParametersInContext(ContextImpl& context);
  
 
@@ -119,6 +119,22 @@ public:
                                             std::vector< double >& outputElectrostaticPotential ) = 0;
 
     virtual void getSystemElectrostaticsMoments( ContextImpl& context, std::vector< double >& outputElectrostaticsMonents ) = 0;
+
+    virtual void getSystemPolarizability( ContextImpl& context, std::vector< double >& outputPolarizability ) = 0;
+
+    /**
+     * Get the PME parameters in use, those picked by the tuner if it is on.
+     *
+     * @param context    the context in which to execute this kernel
+     * @param alpha      the Ewald alpha parameter
+     * @param cutoff     the real space cutoff distance
+     * @param nx         the number of grid points along the X axis
+     * @param ny         the number of grid points along the Y axis
+     * @param nz         the number of grid points along the Z axis
+     * @param order      the B-spline order
+     */
+    virtual void getPmeParameters( ContextImpl& context, double& alpha, double& cutoff, int& nx, int& ny, int& nz, int& order ) = 0;
+
     /**
      * Copy changed parameters over to a context.
      *
@@ -40,12 +40,17 @@ using namespace MBPolPlugin;
 using std::string;
 using std::vector;
 
-MBPolElectrostaticsForce::MBPolElectrostaticsForce() : nonbondedMethod(NoCutoff), pmeBSplineOrder(5), cutoffDistance(0.9), ewaldErrorTol(1e-4), mutualInducedMaxIterations(200),
-                                               mutualInducedTargetEpsilon(1.0e-07), scalingDistanceCutoff(100.0), electricConstant(138.9354558456), aewald(0.0), includeChargeRedistribution(true) {
+MBPolElectrostaticsForce::MBPolElectrostaticsForce() : nonbondedMethod(NoCutoff), pmeBSplineOrder(5), usePmeTuning(false), cutoffDistance(0.9), ewaldErrorTol(1e-4), mutualInducedMaxIterations(200),
+                                               mutualInducedTargetEpsilon(1.0e-07), scalingDistanceCutoff(100.0), electricConstant(138.9354558456), aewald(0.0), includeChargeRedistribution(true),
+                                               useDipoleFieldTensor(true), polarizationSolver(SOR), denseSolverThreshold(128),
+                                               useInducedDipolePredictor(true), polarizationType(Mutual),
+                                               extendedLagrangianCoupling(1.82), extendedLagrangianDissipation(0.018), extendedLagrangianIterations(1) {
     pmeGridDimension.resize(3);
     pmeGridDimension[0] = pmeGridDimension[1] = pmeGridDimension[2];
     const double defaultTholeParameters[5] = { 0.4, 0.4, 0.055, 0.626, 0.055 };
     tholeParameters.assign(&defaultTholeParameters[0], &defaultTholeParameters[0]+5);
+    const double defaultExtrapolationCoefficients[4] = { -0.154, 0.017, 0.658, 0.474 };
+    extrapolationCoefficients.assign(&defaultExtrapolationCoefficients[0], &defaultExtrapolationCoefficients[0]+4);
 }
 
 MBPolElectrostaticsForce::NonbondedMethod MBPolElectrostaticsForce::getNonbondedMethod( void ) const {
@@ -82,6 +87,10 @@ void MBPolElectrostaticsForce::setAEwald(double inputAewald ) {
 int MBPolElectrostaticsForce::getPmeBSplineOrder( void ) const { 
     return pmeBSplineOrder; 
 } 
+
+void MBPolElectrostaticsForce::setPmeBSplineOrder( int order ) {
+    pmeBSplineOrder = order;
+}
  
 void MBPolElectrostaticsForce::getPmeGridDimensions( std::vector<int>& gridDimension ) const { 
     if( gridDimension.size() < 3 ){
@@ -129,6 +138,82 @@ void MBPolElectrostaticsForce::setEwaldErrorTolerance(double tol) {
     ewaldErrorTol = tol;
 }
 
+void MBPolElectrostaticsForce::setUseDipoleFieldTensor( bool useTensor ) {
+    useDipoleFieldTensor = useTensor;
+}
+
+bool MBPolElectrostaticsForce::getUseDipoleFieldTensor( void ) const {
+    return useDipoleFieldTensor;
+}
+
+void MBPolElectrostaticsForce::setUseInducedDipolePredictor( bool usePredictor ) {
+    useInducedDipolePredictor = usePredictor;
+}
+
+bool MBPolElectrostaticsForce::getUseInducedDipolePredictor( void ) const {
+    return useInducedDipolePredictor;
+}
+
+void MBPolElectrostaticsForce::setPolarizationSolver( PolarizationSolver solver ) {
+    polarizationSolver = solver;
+}
+
+MBPolElectrostaticsForce::PolarizationSolver MBPolElectrostaticsForce::getPolarizationSolver( void ) const {
+    return polarizationSolver;
+}
+
+void MBPolElectrostaticsForce::setDenseSolverThreshold( int sites ) {
+    denseSolverThreshold = sites;
+}
+
+int MBPolElectrostaticsForce::getDenseSolverThreshold( void ) const {
+    return denseSolverThreshold;
+}
+
+void MBPolElectrostaticsForce::setPolarizationType( PolarizationType type ) {
+    polarizationType = type;
+}
+
+MBPolElectrostaticsForce::PolarizationType MBPolElectrostaticsForce::getPolarizationType( void ) const {
+    return polarizationType;
+}
+
+void MBPolElectrostaticsForce::setExtendedLagrangianParameters( double coupling, double dissipation, int iterations ) {
+    extendedLagrangianCoupling    = coupling;
+    extendedLagrangianDissipation = dissipation;
+    extendedLagrangianIterations  = iterations;
+}
+
+void MBPolElectrostaticsForce::getExtendedLagrangianParameters( double& coupling, double& dissipation, int& iterations ) const {
+    coupling    = extendedLagrangianCoupling;
+    dissipation = extendedLagrangianDissipation;
+    iterations  = extendedLagrangianIterations;
+}
+
+void MBPolElectrostaticsForce::setExtrapolationCoefficients( const std::vector<double>& coefficients ) {
+    extrapolationCoefficients = coefficients;
+}
+
+const std::vector<double>& MBPolElectrostaticsForce::getExtrapolationCoefficients( void ) const {
+    return extrapolationCoefficients;
+}
+
+void MBPolElectrostaticsForce::setUsePmeTuning( bool useTuning ) {
+    usePmeTuning = useTuning;
+}
+
+bool MBPolElectrostaticsForce::getUsePmeTuning( void ) const {
+    return usePmeTuning;
+}
+
+void MBPolElectrostaticsForce::setPmeTuningCacheFile( const std::string& fileName ) {
+    pmeTuningCacheFile = fileName;
+}
+
+const std::string& MBPolElectrostaticsForce::getPmeTuningCacheFile( void ) const {
+    return pmeTuningCacheFile;
+}
+
 int MBPolElectrostaticsForce::addElectrostatics( double charge,
                                        int moleculeIndex, int atomType, double dampingFactor, double polarity) {
     multipoles.push_back(ElectrostaticsInfo( charge, moleculeIndex, atomType, dampingFactor, polarity));
@@ -161,6 +246,14 @@ void MBPolElectrostaticsForce::getElectrostaticPotential( const std::vector< Vec
     dynamic_cast<MBPolElectrostaticsForceImpl&>(getImplInContext(context)).getElectrostaticPotential(getContextImpl(context), inputGrid, outputElectrostaticPotential);
 }
 
+void MBPolElectrostaticsForce::getSystemPolarizability( Context& context, std::vector< double >& outputPolarizability ){
+    dynamic_cast<MBPolElectrostaticsForceImpl&>(getImplInContext(context)).getSystemPolarizability(getContextImpl(context), outputPolarizability);
+}
+
+void MBPolElectrostaticsForce::getPmeParametersInContext( Context& context, double& alpha, double& cutoff, int& nx, int& ny, int& nz, int& order ){
+    dynamic_cast<MBPolElectrostaticsForceImpl&>(getImplInContext(context)).getPmeParameters(getContextImpl(context), alpha, cutoff, nx, ny, nz, order);
+}
+
 ForceImpl* MBPolElectrostaticsForce::createImpl()  const {
     return new MBPolElectrostaticsForceImpl(*this);
 }
@@ -84,6 +84,14 @@ void MBPolElectrostaticsForceImpl::getElectrostaticPotential( ContextImpl& conte
     kernel.getAs<CalcMBPolElectrostaticsForceKernel>().getElectrostaticPotential(context, inputGrid, outputElectrostaticPotential);
 }
 
+void MBPolElectrostaticsForceImpl::getSystemPolarizability( ContextImpl& context, std::vector< double >& outputPolarizability ){
+    kernel.getAs<CalcMBPolElectrostaticsForceKernel>().getSystemPolarizability(context, outputPolarizability);
+}
+
+void MBPolElectrostaticsForceImpl::getPmeParameters( ContextImpl& context, double& alpha, double& cutoff, int& nx, int& ny, int& nz, int& order ){
+    kernel.getAs<CalcMBPolElectrostaticsForceKernel>().getPmeParameters(context, alpha, cutoff, nx, ny, nz, order);
+}
+
 void MBPolElectrostaticsForceImpl::updateParametersInContext(ContextImpl& context) {
     kernel.getAs<CalcMBPolElectrostaticsForceKernel>().copyParametersToContext(context, owner);
 }
@@ -39,7 +39,7 @@ using namespace MBPolPlugin;
 using std::string;
 using std::vector;
 
-MBPolThreeBodyForce::MBPolThreeBodyForce() : nonbondedMethod(CutoffNonPeriodic), cutoff(1.0e+10) {
+MBPolThreeBodyForce::MBPolThreeBodyForce() : nonbondedMethod(CutoffNonPeriodic), cutoff(1.0e+10), neighborListSkin(0.05) {
 }
 
 int MBPolThreeBodyForce::addParticle(const std::vector<int> & particleIndices ) {
@@ -67,6 +67,14 @@ double MBPolThreeBodyForce::getCutoff( void ) const {
     return cutoff;
 }
 
+void MBPolThreeBodyForce::setNeighborListSkin( double skin ){
+    neighborListSkin = skin;
+}
+
+double MBPolThreeBodyForce::getNeighborListSkin( void ) const {
+    return neighborListSkin;
+}
+
 MBPolThreeBodyForce::NonbondedMethod MBPolThreeBodyForce::getNonbondedMethod() const {
     return nonbondedMethod;
 }
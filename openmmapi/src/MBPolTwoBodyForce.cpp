@@ -40,7 +40,7 @@ using namespace MBPolPlugin;
 using std::string;
 using std::vector;
 
-MBPolTwoBodyForce::MBPolTwoBodyForce() : nonbondedMethod(CutoffNonPeriodic), cutoff(1.0e+10) {
+MBPolTwoBodyForce::MBPolTwoBodyForce() : nonbondedMethod(CutoffNonPeriodic), cutoff(1.0e+10), neighborListSkin(0.05) {
 }
 
 int MBPolTwoBodyForce::addParticle(const std::vector<int> & particleIndices ) {
@@ -68,6 +68,14 @@ double MBPolTwoBodyForce::getCutoff( void ) const {
     return cutoff;
 }
 
+void MBPolTwoBodyForce::setNeighborListSkin( double skin ){
+    neighborListSkin = skin;
+}
+
+double MBPolTwoBodyForce::getNeighborListSkin( void ) const {
+    return neighborListSkin;
+}
+
 MBPolTwoBodyForce::NonbondedMethod MBPolTwoBodyForce::getNonbondedMethod() const {
     return nonbondedMethod;
 }
@@ -0,0 +1,85 @@
+/* -------------------------------------------------------------------------- *
+ *                              OpenMMMBPol                                  *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2008 Stanford University and the Authors.           *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * This program is free software: you can redistribute it and/or modify       *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * This program is distributed in the hope that it will be useful,            *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ *                                                                            *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.      *
+ * -------------------------------------------------------------------------- */
+
+#include <exception>
+
+#include "CpuMBPolKernelFactory.h"
+#include "CpuMBPolKernels.h"
+#include "openmm/cpu/CpuPlatform.h"
+#include "openmm/internal/windowsExport.h"
+#include "openmm/internal/ContextImpl.h"
+#include "openmm/OpenMMException.h"
+
+using namespace OpenMM;
+using namespace MBPolPlugin;
+
+extern "C" OPENMM_EXPORT void registerPlatforms() {
+}
+
+extern "C" OPENMM_EXPORT void registerKernelFactories() {
+    try {
+        Platform& platform = Platform::getPlatformByName("CPU");
+        CpuMBPolKernelFactory* factory = new CpuMBPolKernelFactory();
+        platform.registerKernelFactory(CalcMBPolOneBodyForceKernel::Name(), factory);
+        platform.registerKernelFactory(CalcMBPolTwoBodyForceKernel::Name(), factory);
+        platform.registerKernelFactory(CalcMBPolThreeBodyForceKernel::Name(), factory);
+        platform.registerKernelFactory(CalcMBPolElectrostaticsForceKernel::Name(), factory);
+    }
+    catch (std::exception & ex) {
+        // Ignore
+    }
+}
+
+extern "C" OPENMM_EXPORT void registerMBPolCpuKernelFactories() {
+    try {
+        Platform::getPlatformByName("CPU");
+    }
+    catch (...) {
+        Platform::registerPlatform(new CpuPlatform());
+    }
+    registerKernelFactories();
+}
+
+KernelImpl* CpuMBPolKernelFactory::createKernelImpl(std::string name, const Platform& platform, ContextImpl& context) const {
+
+    // all kernels share the thread pool of the CPU platform, which is sized by its Threads property
+
+    ThreadPool& threads = CpuPlatform::getPlatformData(context).threads;
+
+    if (name == CalcMBPolOneBodyForceKernel::Name())
+        return new CpuCalcMBPolOneBodyForceKernel(name, platform, context.getSystem(), threads);
+
+    if (name == CalcMBPolTwoBodyForceKernel::Name())
+        return new CpuCalcMBPolTwoBodyForceKernel(name, platform, context.getSystem(), threads);
+
+    if (name == CalcMBPolThreeBodyForceKernel::Name())
+        return new CpuCalcMBPolThreeBodyForceKernel(name, platform, context.getSystem(), threads);
+
+    if (name == CalcMBPolElectrostaticsForceKernel::Name())
+        return new CpuCalcMBPolElectrostaticsForceKernel(name, platform, context.getSystem(), threads);
+
+    throw OpenMMException((std::string("Tried to create kernel with illegal kernel name '")+name+"'").c_str());
+}
@@ -0,0 +1,155 @@
+/* -------------------------------------------------------------------------- *
+ *                               OpenMMMBPol                                 *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2008-2009 Stanford University and the Authors.      *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * This program is free software: you can redistribute it and/or modify       *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * This program is distributed in the hope that it will be useful,            *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ *                                                                            *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.      *
+ * -------------------------------------------------------------------------- */
+
+#include "CpuMBPolKernels.h"
+#include "MBPolReferenceOneBodyForce.h"
+#include "MBPolReferenceTwoBodyForce.h"
+#include "MBPolReferenceThreeBodyForce.h"
+#include <algorithm>
+
+using namespace  OpenMM;
+using namespace MBPolPlugin;
+using namespace std;
+
+class CpuMBPolThreadForces::ThreadTask : public ThreadPool::Task {
+public:
+    ThreadTask(CpuMBPolThreadForces& owner) : owner(owner) {
+    }
+    void execute(ThreadPool& threads, int threadIndex) {
+        owner.threadExecute(threads, threadIndex);
+    }
+    CpuMBPolThreadForces& owner;
+};
+
+RealOpenMM CpuMBPolThreadForces::execute(ThreadPool& threads, unsigned int numItems, unsigned int blockSize, vector<RealVec>& forceData) {
+    this->numItems  = numItems;
+    this->blockSize = blockSize;
+    int numThreads  = threads.getNumThreads();
+    threadForces.resize(numThreads);
+    threadEnergy.resize(numThreads);
+    for (int ii = 0; ii < numThreads; ii++)
+        threadForces[ii].resize(forceData.size());
+
+    ThreadTask task(*this);
+    threads.execute(task);
+    threads.waitForThreads();
+
+    RealOpenMM energy = 0.0;
+    for (int ii = 0; ii < numThreads; ii++) {
+        energy += threadEnergy[ii];
+        const vector<RealVec>& forces = threadForces[ii];
+        for (unsigned int jj = 0; jj < forceData.size(); jj++)
+            forceData[jj] += forces[jj];
+    }
+    return energy;
+}
+
+void CpuMBPolThreadForces::threadExecute(ThreadPool& threads, int threadIndex) {
+
+    // blocks are dealt out round robin so that consecutive entries of a neighbor list,
+    // which tend to have similar cost, end up on different threads
+
+    vector<RealVec>& forces = threadForces[threadIndex];
+    std::fill(forces.begin(), forces.end(), RealVec(0.0, 0.0, 0.0));
+    unsigned int stride = blockSize*threads.getNumThreads();
+    RealOpenMM energy   = 0.0;
+    for (unsigned int first = threadIndex*blockSize; first < numItems; first += stride)
+        energy += computeBlock(threadIndex, first, std::min(first+blockSize, numItems), forces);
+    threadEnergy[threadIndex] = energy;
+}
+
+/* -------------------------------------------------------------------------- *
+ *                             MBPolOneBody                                   *
+ * -------------------------------------------------------------------------- */
+
+CpuCalcMBPolOneBodyForceKernel::CpuCalcMBPolOneBodyForceKernel(std::string name, const Platform& platform, const OpenMM::System& system, ThreadPool& threads) :
+                   ReferenceCalcMBPolOneBodyForceKernel(name, platform, system), threads(threads) {
+}
+
+RealOpenMM CpuCalcMBPolOneBodyForceKernel::computeForceAndEnergy(const MBPolReferenceOneBodyForce& force, const vector<RealVec>& posData, vector<RealVec>& forceData) {
+    currentForce     = &force;
+    currentPositions = &posData;
+    return CpuMBPolThreadForces::execute(threads, numOneBodys, 64, forceData);
+}
+
+RealOpenMM CpuCalcMBPolOneBodyForceKernel::computeBlock(int threadIndex, unsigned int firstItem, unsigned int lastItem, vector<RealVec>& forces) {
+    return currentForce->calculateForceAndEnergy(firstItem, lastItem, *currentPositions, allParticleIndices, forces);
+}
+
+/* -------------------------------------------------------------------------- *
+ *                             MBPolElectrostatics                            *
+ * -------------------------------------------------------------------------- */
+
+CpuCalcMBPolElectrostaticsForceKernel::CpuCalcMBPolElectrostaticsForceKernel(std::string name, const Platform& platform, const OpenMM::System& system, ThreadPool& threads) :
+                   ReferenceCalcMBPolElectrostaticsForceKernel(name, platform, system), threads(threads) {
+}
+
+MBPolReferenceElectrostaticsForce* CpuCalcMBPolElectrostaticsForceKernel::setupMBPolReferenceElectrostaticsForce(ContextImpl& context) {
+    MBPolReferenceElectrostaticsForce* mbpolReferenceElectrostaticsForce = ReferenceCalcMBPolElectrostaticsForceKernel::setupMBPolReferenceElectrostaticsForce(context);
+    mbpolReferenceElectrostaticsForce->setThreadPool(&threads);
+    return mbpolReferenceElectrostaticsForce;
+}
+
+/* -------------------------------------------------------------------------- *
+ *                             MBPolTwoBody                                   *
+ * -------------------------------------------------------------------------- */
+
+CpuCalcMBPolTwoBodyForceKernel::CpuCalcMBPolTwoBodyForceKernel(std::string name, const Platform& platform, const OpenMM::System& system, ThreadPool& threads) :
+                   ReferenceCalcMBPolTwoBodyForceKernel(name, platform, system), threads(threads) {
+}
+
+RealOpenMM CpuCalcMBPolTwoBodyForceKernel::computeForceAndEnergy(const MBPolReferenceTwoBodyForce& force, const vector<RealVec>& allPosData, vector<RealVec>& forceData) {
+    currentForce     = &force;
+    currentPositions = &allPosData;
+    threadPolynomialScratch.resize(threads.getNumThreads());
+    // blocks are a multiple of the batch size of the 2-body polynomial (poly_2b_v6x_batch)
+    return CpuMBPolThreadForces::execute(threads, neighborList->size(), 32, forceData);
+}
+
+RealOpenMM CpuCalcMBPolTwoBodyForceKernel::computeBlock(int threadIndex, unsigned int firstItem, unsigned int lastItem, vector<RealVec>& forces) {
+    return currentForce->calculateForceAndEnergy(numParticles, *currentPositions, allParticleIndices, *neighborList, firstItem, lastItem, threadPolynomialScratch[threadIndex], forces);
+}
+
+/* -------------------------------------------------------------------------- *
+ *                             MBPolThreeBody                                 *
+ * -------------------------------------------------------------------------- */
+
+CpuCalcMBPolThreeBodyForceKernel::CpuCalcMBPolThreeBodyForceKernel(std::string name, const Platform& platform, const OpenMM::System& system, ThreadPool& threads) :
+                   ReferenceCalcMBPolThreeBodyForceKernel(name, platform, system), threads(threads) {
+    neighborListThreads = &threads;
+}
+
+RealOpenMM CpuCalcMBPolThreeBodyForceKernel::computeForceAndEnergy(const MBPolReferenceThreeBodyForce& force, const vector<RealVec>& allPosData, vector<RealVec>& forceData) {
+    currentForce     = &force;
+    currentPositions = &allPosData;
+    threadTriplets.resize(threads.getNumThreads());
+    // the work items are the molecules the triplets are centered on
+    return CpuMBPolThreadForces::execute(threads, numParticles, 4, forceData);
+}
+
+RealOpenMM CpuCalcMBPolThreeBodyForceKernel::computeBlock(int threadIndex, unsigned int firstItem, unsigned int lastItem, vector<RealVec>& forces) {
+    return computeTriplets(*currentForce, *currentPositions, firstItem, lastItem, threadTriplets[threadIndex], forces);
+}
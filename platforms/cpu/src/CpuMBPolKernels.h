@@ -0,0 +1,148 @@
+#ifndef MBPOL_OPENMM_CPU_KERNELS_H_
+#define MBPOL_OPENMM_CPU_KERNELS_H_
+
+/* -------------------------------------------------------------------------- *
+ *                              OpenMMMBPol                                  *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2008 Stanford University and the Authors.           *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * This program is free software: you can redistribute it and/or modify       *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * This program is distributed in the hope that it will be useful,            *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ *                                                                            *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.      *
+ * -------------------------------------------------------------------------- */
+
+#include "MBPolReferenceKernels.h"
+#include "openmm/internal/ThreadPool.h"
+#include <vector>
+
+namespace MBPolPlugin {
+
+/**
+ * Per-thread force and energy accumulators used by the CPU kernels.  The work items of a
+ * kernel (monomers, pairs or triplets) are dealt out to the threads in blocks; each thread
+ * adds into its own force buffer and the buffers are summed once all threads are done.
+ */
+class CpuMBPolThreadForces {
+public:
+    /**
+     * Distribute numItems work items over the threads of the pool, call computeBlock()
+     * for each block and add the summed forces to forceData.
+     *
+     * @param threads        thread pool
+     * @param numItems       number of work items
+     * @param blockSize      number of work items handed to a thread at a time
+     * @param forceData      add forces to this vector
+     * @return the summed energy of all blocks
+     */
+    RealOpenMM execute(ThreadPool& threads, unsigned int numItems, unsigned int blockSize, std::vector<RealVec>& forceData);
+    /**
+     * Compute the work items [firstItem, lastItem).
+     *
+     * @param threadIndex    index of the thread computing the block, for per-thread buffers
+     * @param firstItem      index of the first work item
+     * @param lastItem       one past the index of the last work item
+     * @param forces         per-thread force buffer to add forces to
+     * @return the energy of the block
+     */
+    virtual RealOpenMM computeBlock(int threadIndex, unsigned int firstItem, unsigned int lastItem, std::vector<RealVec>& forces) = 0;
+    virtual ~CpuMBPolThreadForces() {}
+    void threadExecute(ThreadPool& threads, int threadIndex);
+private:
+    class ThreadTask;
+    unsigned int numItems;
+    unsigned int blockSize;
+    std::vector<std::vector<RealVec> > threadForces;
+    std::vector<RealOpenMM> threadEnergy;
+};
+
+/**
+ * This kernel is invoked by MBPolOneBodyForce to calculate the forces acting on the system and the energy of the system
+ * using the threads of the CPU platform.
+ */
+class CpuCalcMBPolOneBodyForceKernel : public ReferenceCalcMBPolOneBodyForceKernel, private CpuMBPolThreadForces {
+public:
+    CpuCalcMBPolOneBodyForceKernel(std::string name, const Platform& platform, const System& system, ThreadPool& threads);
+protected:
+    RealOpenMM computeForceAndEnergy(const MBPolReferenceOneBodyForce& force, const std::vector<RealVec>& posData, std::vector<RealVec>& forceData);
+private:
+    RealOpenMM computeBlock(int threadIndex, unsigned int firstItem, unsigned int lastItem, std::vector<RealVec>& forces);
+    ThreadPool& threads;
+    const MBPolReferenceOneBodyForce* currentForce;
+    const std::vector<RealVec>* currentPositions;
+};
+
+/**
+ * This kernel is invoked by MBPolElectrostaticsForce to calculate the forces acting on the system and the energy of the system
+ * using the threads of the CPU platform.
+ */
+class CpuCalcMBPolElectrostaticsForceKernel : public ReferenceCalcMBPolElectrostaticsForceKernel {
+public:
+    CpuCalcMBPolElectrostaticsForceKernel(std::string name, const Platform& platform, const System& system, ThreadPool& threads);
+    /**
+     * Setup for MBPolReferenceElectrostaticsForce instance; the direct space pair loops
+     * of the returned instance are split between the threads of the CPU platform.
+     *
+     * @param context        the current context
+     *
+     * @return pointer to initialized instance of MBPolReferenceElectrostaticsForce
+     */
+    MBPolReferenceElectrostaticsForce* setupMBPolReferenceElectrostaticsForce(ContextImpl& context);
+private:
+    ThreadPool& threads;
+};
+
+/**
+ * This kernel is invoked to calculate the TwoBody forces acting on the system and the energy of the system
+ * using the threads of the CPU platform.
+ */
+class CpuCalcMBPolTwoBodyForceKernel : public ReferenceCalcMBPolTwoBodyForceKernel, private CpuMBPolThreadForces {
+public:
+    CpuCalcMBPolTwoBodyForceKernel(std::string name, const Platform& platform, const System& system, ThreadPool& threads);
+protected:
+    RealOpenMM computeForceAndEnergy(const MBPolReferenceTwoBodyForce& force, const std::vector<RealVec>& allPosData, std::vector<RealVec>& forceData);
+private:
+    RealOpenMM computeBlock(int threadIndex, unsigned int firstItem, unsigned int lastItem, std::vector<RealVec>& forces);
+    ThreadPool& threads;
+    const MBPolReferenceTwoBodyForce* currentForce;
+    const std::vector<RealVec>* currentPositions;
+    // work space of the batched 2-body polynomial of each thread
+    std::vector<std::vector<double> > threadPolynomialScratch;
+};
+
+/**
+ * This kernel is invoked to calculate the ThreeBody forces acting on the system and the energy of the system
+ * using the threads of the CPU platform.
+ */
+class CpuCalcMBPolThreeBodyForceKernel : public ReferenceCalcMBPolThreeBodyForceKernel, private CpuMBPolThreadForces {
+public:
+    CpuCalcMBPolThreeBodyForceKernel(std::string name, const Platform& platform, const System& system, ThreadPool& threads);
+protected:
+    RealOpenMM computeForceAndEnergy(const MBPolReferenceThreeBodyForce& force, const std::vector<RealVec>& allPosData, std::vector<RealVec>& forceData);
+private:
+    RealOpenMM computeBlock(int threadIndex, unsigned int firstItem, unsigned int lastItem, std::vector<RealVec>& forces);
+    ThreadPool& threads;
+    const MBPolReferenceThreeBodyForce* currentForce;
+    const std::vector<RealVec>* currentPositions;
+    // buffer for the blocks of triplets of each thread
+    std::vector<ThreeNeighborList> threadTriplets;
+};
+
+} // namespace MBPolPlugin
+
+#endif /*MBPOL_OPENMM_CPU_KERNELS_H_*/
@@ -0,0 +1,276 @@
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2014 Stanford University and the Authors.           *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+/**
+ * This tests the CPU implementation of the MBPol forces against the Reference implementation.
+ */
+
+#include "OpenMMMBPol.h"
+#include "openmm/internal/AssertionUtilities.h"
+#include "openmm/Context.h"
+#include "openmm/Platform.h"
+#include "openmm/System.h"
+#include "openmm/LangevinIntegrator.h"
+#include "openmm/VirtualSite.h"
+#include "openmm/cpu/CpuPlatform.h"
+#include <cmath>
+#include <iostream>
+#include <map>
+#include <vector>
+
+using namespace MBPolPlugin;
+using namespace OpenMM;
+using namespace std;
+
+extern "C" OPENMM_EXPORT void registerMBPolCpuKernelFactories();
+
+/**
+ * Build a cluster of waterPerSide^3 water molecules (O, H, H, M-site) on a
+ * slightly distorted cubic lattice with 3 Angstrom spacing; each force is placed
+ * in its own force group.
+ */
+
+static void buildWaterCluster(System& system, std::vector<Vec3>& positions, int waterPerSide, double boxDimension) {
+
+    MBPolOneBodyForce* mbpolOneBodyForce = new MBPolOneBodyForce();
+    MBPolTwoBodyForce* mbpolTwoBodyForce = new MBPolTwoBodyForce();
+    MBPolThreeBodyForce* mbpolThreeBodyForce = new MBPolThreeBodyForce();
+    MBPolElectrostaticsForce* mbpolElectrostaticsForce = new MBPolElectrostaticsForce();
+
+    mbpolTwoBodyForce->setCutoff( 0.65 );
+    mbpolThreeBodyForce->setCutoff( 0.45 );
+    mbpolElectrostaticsForce->setMutualInducedTargetEpsilon( 1.0e-12 );
+
+    if( boxDimension > 0.0 ){
+        Vec3 a( boxDimension, 0.0, 0.0 );
+        Vec3 b( 0.0, boxDimension, 0.0 );
+        Vec3 c( 0.0, 0.0, boxDimension );
+        system.setDefaultPeriodicBoxVectors( a, b, c );
+        mbpolTwoBodyForce->setNonbondedMethod(MBPolTwoBodyForce::CutoffPeriodic);
+        mbpolThreeBodyForce->setNonbondedMethod(MBPolThreeBodyForce::CutoffPeriodic);
+        mbpolElectrostaticsForce->setNonbondedMethod(MBPolElectrostaticsForce::PME);
+        mbpolElectrostaticsForce->setCutoffDistance( 0.9 );
+        mbpolElectrostaticsForce->setAEwald( 0. );
+        mbpolElectrostaticsForce->setEwaldErrorTolerance( 1.0e-03 );
+    } else {
+        mbpolTwoBodyForce->setNonbondedMethod(MBPolTwoBodyForce::CutoffNonPeriodic);
+        mbpolThreeBodyForce->setNonbondedMethod(MBPolThreeBodyForce::CutoffNonPeriodic);
+        mbpolElectrostaticsForce->setNonbondedMethod(MBPolElectrostaticsForce::NoCutoff);
+    }
+
+    std::vector<double> thole(5);
+    thole[0] = 0.4;
+    thole[1] = 0.4;
+    thole[2] = 0.055;
+    thole[3] = 0.626;
+    thole[4] = 0.055;
+    mbpolElectrostaticsForce->setTholeParameters(thole);
+
+    // monomer geometry in Angstrom, centered on the oxygen
+
+    std::vector<Vec3> monomer(3);
+    monomer[0] = Vec3(  0.000000000e+00,  0.000000000e+00,  0.000000000e+00 );
+    monomer[1] = Vec3(  8.941753587e-01, -3.986263085e-01,  1.177647080e-01 );
+    monomer[2] = Vec3( -5.015394760e-01, -2.167182699e-01,  7.849699320e-01 );
+
+    double virtualSiteWeightO = 0.573293118;
+    double virtualSiteWeightH = 0.213353441;
+    double spacing            = 3.0;
+
+    positions.resize(0);
+    std::vector<int> particleIndices(3);
+    int waterMoleculeIndex = 0;
+    for( int ix = 0; ix < waterPerSide; ix++ ){
+        for( int iy = 0; iy < waterPerSide; iy++ ){
+            for( int iz = 0; iz < waterPerSide; iz++ ){
+
+                int jj = system.getNumParticles();
+                system.addParticle( 1.5999000e+01 );
+                system.addParticle( 1.0080000e+00 );
+                system.addParticle( 1.0080000e+00 );
+                system.addParticle( 0. ); // Virtual Site
+                system.setVirtualSite(jj+3, new ThreeParticleAverageSite(jj, jj+1, jj+2,
+                                                                   virtualSiteWeightO, virtualSiteWeightH, virtualSiteWeightH));
+
+                particleIndices[0] = jj;
+                particleIndices[1] = jj+1;
+                particleIndices[2] = jj+2;
+                mbpolOneBodyForce->addOneBody(particleIndices);
+                mbpolTwoBodyForce->addParticle(particleIndices);
+                mbpolThreeBodyForce->addParticle(particleIndices);
+
+                mbpolElectrostaticsForce->addElectrostatics( -5.1966000e-01, waterMoleculeIndex, 0, 0.001310, 0.001310 );
+                mbpolElectrostaticsForce->addElectrostatics(  2.5983000e-01, waterMoleculeIndex, 1, 0.000294, 0.000294 );
+                mbpolElectrostaticsForce->addElectrostatics(  2.5983000e-01, waterMoleculeIndex, 1, 0.000294, 0.000294 );
+                mbpolElectrostaticsForce->addElectrostatics(  0.,            waterMoleculeIndex, 2, 0.001310, 0.      );
+                waterMoleculeIndex++;
+
+                // deterministic distortion so that no two pairs are equivalent
+
+                Vec3 origin( spacing*ix + 0.1*((iy+2*iz) % 3), spacing*iy + 0.1*((iz+2*ix) % 3), spacing*iz + 0.1*((ix+2*iy) % 3) );
+                for( unsigned int kk = 0; kk < 3; kk++ ){
+                    positions.push_back( (origin + monomer[kk])*0.1 );
+                }
+                positions.push_back( origin*0.1 );
+            }
+        }
+    }
+
+    mbpolOneBodyForce->setForceGroup(0);
+    mbpolTwoBodyForce->setForceGroup(1);
+    mbpolThreeBodyForce->setForceGroup(2);
+    mbpolElectrostaticsForce->setForceGroup(3);
+
+    system.addForce(mbpolOneBodyForce);
+    system.addForce(mbpolTwoBodyForce);
+    system.addForce(mbpolThreeBodyForce);
+    system.addForce(mbpolElectrostaticsForce);
+}
+
+static void compareWithReference(double boxDimension, const std::string& threads) {
+
+    std::string testName = boxDimension > 0.0 ? "testWaterClusterPeriodic" : "testWaterCluster";
+    std::cout << "Test START: " << testName << " threads " << threads << std::endl;
+
+    System system;
+    std::vector<Vec3> positions;
+    buildWaterCluster(system, positions, 3, boxDimension);
+
+    LangevinIntegrator referenceIntegrator(0.0, 0.1, 0.01);
+    LangevinIntegrator cpuIntegrator(0.0, 0.1, 0.01);
+
+    std::map<std::string, std::string> properties;
+    properties[CpuPlatform::CpuThreads()] = threads;
+
+    Context referenceContext(system, referenceIntegrator, Platform::getPlatformByName("Reference"));
+    Context cpuContext(system, cpuIntegrator, Platform::getPlatformByName("CPU"), properties);
+
+    referenceContext.setPositions(positions);
+    referenceContext.applyConstraints(1e-7); // update position of virtual site
+    cpuContext.setPositions(positions);
+    cpuContext.applyConstraints(1e-7);
+
+    double tolerance = 1.0e-06;
+
+    for( int group = 0; group < 4; group++ ){
+        State referenceState = referenceContext.getState(State::Forces | State::Energy, false, 1<<group);
+        State cpuState       = cpuContext.getState(State::Forces | State::Energy, false, 1<<group);
+
+        ASSERT_EQUAL_TOL( referenceState.getPotentialEnergy(), cpuState.getPotentialEnergy(), tolerance );
+
+        const std::vector<Vec3>& referenceForces = referenceState.getForces();
+        const std::vector<Vec3>& cpuForces       = cpuState.getForces();
+        for( unsigned int ii = 0; ii < referenceForces.size(); ii++ ){
+            ASSERT_EQUAL_VEC( referenceForces[ii], cpuForces[ii], tolerance );
+        }
+    }
+
+    std::cout << "Test END: " << testName << " PASSED" << std::endl;
+}
+
+/**
+ * Move the molecules by small steps and check that the 2-body and 3-body forces computed with
+ * the persistent neighbor lists match the ones computed with lists rebuilt on every evaluation.
+ */
+
+static void testNeighborListSkin(double boxDimension) {
+
+    std::string testName = boxDimension > 0.0 ? "testNeighborListSkinPeriodic" : "testNeighborListSkin";
+    std::cout << "Test START: " << testName << std::endl;
+
+    System skinSystem;
+    System noSkinSystem;
+    std::vector<Vec3> positions;
+    buildWaterCluster(skinSystem, positions, 3, boxDimension);
+    buildWaterCluster(noSkinSystem, positions, 3, boxDimension);
+
+    dynamic_cast<MBPolTwoBodyForce&>(noSkinSystem.getForce(1)).setNeighborListSkin(0.0);
+    dynamic_cast<MBPolThreeBodyForce&>(noSkinSystem.getForce(2)).setNeighborListSkin(0.0);
+
+    LangevinIntegrator skinIntegrator(0.0, 0.1, 0.01);
+    LangevinIntegrator noSkinIntegrator(0.0, 0.1, 0.01);
+
+    Context skinContext(skinSystem, skinIntegrator, Platform::getPlatformByName("CPU"));
+    Context noSkinContext(noSkinSystem, noSkinIntegrator, Platform::getPlatformByName("Reference"));
+
+    double tolerance = 1.0e-06;
+
+    // each step moves every molecule by up to 0.015 nm, so the list is reused for a few
+    // steps and then rebuilt
+
+    for( int step = 0; step < 12; step++ ){
+        for( unsigned int ii = 0; ii < positions.size(); ii += 4 ){
+            Vec3 delta( 0.004*((ii+step) % 3), -0.003*((ii+2*step) % 4), 0.002*((2*ii+step) % 5) );
+            for( unsigned int kk = 0; kk < 4; kk++ ){
+                positions[ii+kk] += delta;
+            }
+        }
+
+        skinContext.setPositions(positions);
+        noSkinContext.setPositions(positions);
+
+        for( int group = 1; group < 3; group++ ){
+            State skinState   = skinContext.getState(State::Forces | State::Energy, false, 1<<group);
+            State noSkinState = noSkinContext.getState(State::Forces | State::Energy, false, 1<<group);
+
+            ASSERT_EQUAL_TOL( noSkinState.getPotentialEnergy(), skinState.getPotentialEnergy(), tolerance );
+
+            const std::vector<Vec3>& skinForces   = skinState.getForces();
+            const std::vector<Vec3>& noSkinForces = noSkinState.getForces();
+            for( unsigned int ii = 0; ii < noSkinForces.size(); ii++ ){
+                ASSERT_EQUAL_VEC( noSkinForces[ii], skinForces[ii], tolerance );
+            }
+        }
+    }
+
+    std::cout << "Test END: " << testName << " PASSED" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    try {
+        registerMBPolCpuKernelFactories();
+
+        compareWithReference( 0.0, "1" );
+        compareWithReference( 0.0, "4" );
+
+        compareWithReference( 2.0, "4" );
+
+        testNeighborListSkin( 0.0 );
+        testNeighborListSkin( 2.0 );
+    }
+    catch(const std::exception& e) {
+        std::cout << "exception: " << e.what() << std::endl;
+        std::cout << "FAIL - ERROR.  Test failed." << std::endl;
+        return 1;
+    }
+    std::cout << "Done" << std::endl;
+    return 0;
+}
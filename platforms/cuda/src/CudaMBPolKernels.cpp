@@ -464,6 +464,15 @@ static int findFFTDimension(int minimum) {
 void CudaCalcMBPolElectrostaticsForceKernel::initialize(const System& system,
 		const MBPolElectrostaticsForce& force) {
 	cu.setAsCurrent();
+	if (force.getNonbondedMethod() == MBPolElectrostaticsForce::PME && force.getPmeBSplineOrder() != PmeOrder)
+		throw OpenMMException(
+				"MBPolElectrostaticsForce: the CUDA platform only supports a PME B-spline order of 5");
+	if (force.getNonbondedMethod() == MBPolElectrostaticsForce::PME && force.getUsePmeTuning())
+		throw OpenMMException(
+				"MBPolElectrostaticsForce: the PME tuner is only supported on the Reference and CPU platforms");
+	if (force.getPolarizationType() != MBPolElectrostaticsForce::Mutual)
+		throw OpenMMException(
+				"MBPolElectrostaticsForce: the CUDA platform only supports the Mutual polarization type");
 
 	// Initialize multipole parameters.
 
@@ -1688,6 +1697,20 @@ void CudaCalcMBPolElectrostaticsForceKernel::getSystemElectrostaticsMoments(
 	return;
 }
 
+void CudaCalcMBPolElectrostaticsForceKernel::getSystemPolarizability(
+		ContextImpl& context,
+		std::vector<double>& outputPolarizability) {
+	throw OpenMMException(
+			"MBPolElectrostaticsForce: the system polarizability is only supported on the Reference and CPU platforms");
+}
+
+void CudaCalcMBPolElectrostaticsForceKernel::getPmeParameters(
+		ContextImpl& context, double& alpha, double& cutoff, int& nx, int& ny,
+		int& nz, int& order) {
+	throw OpenMMException(
+			"MBPolElectrostaticsForce: the PME parameters in use are only reported on the Reference and CPU platforms");
+}
+
 ///////////////////////////////////////////// MBPolThreeBodyForce ////////////////////////////////////
 
 class CudaMBPolThreeBodyForceInfo : public CudaForceInfo {
@@ -213,6 +213,10 @@ public:
 
     void getSystemElectrostaticsMoments( ContextImpl& context, std::vector< double >& outputElectrostaticsMonents );
 
+    void getSystemPolarizability( ContextImpl& context, std::vector< double >& outputPolarizability );
+
+    void getPmeParameters( ContextImpl& context, double& alpha, double& cutoff, int& nx, int& ny, int& nz, int& order );
+
 private:
     class ForceInfo;
     class SortTrait : public CudaSort::SortTrait {
@@ -9,6 +9,10 @@
 
 using namespace OpenMM;
 
+namespace OpenMM {
+class ThreadPool;
+}
+
 namespace MBPolPlugin {
 
 struct AtomTriplet
@@ -18,17 +22,85 @@ struct AtomTriplet
 
 typedef std::vector<AtomTriplet>  ThreeNeighborList;
 
-// O(n) neighbor list method using voxel hash data structure
-// parameter neighborList is automatically clear()ed before 
-// neighbors are added
+// neighbors of every atom within a distance, found with a cell list;
+// each pair is stored for both of its atoms
+class OPENMM_EXPORT ThreeNeighborPairList
+{
+public:
+    // parameter maxDistance is the distance the list is built for,
+    // pairs closer than minDistance are left out; if threads is
+    // given, the list is built by the threads of the pool
+    void build(int nAtoms,
+               const AtomLocationList& atomLocations,
+               const RealVec& periodicBoxSize,
+               bool usePeriodic,
+               double maxDistance,
+               double minDistance = 0.0,
+               OpenMM::ThreadPool* threads = NULL);
+
+    int getNumAtoms() const {
+        return (int) neighborStart.size() - 1;
+    }
+
+    // the neighbors of atom are neighbors[neighborStart[atom]] .. neighbors[neighborStart[atom+1]-1],
+    // in increasing order
+    std::vector<int> neighborStart;
+    std::vector<AtomIndex> neighbors;
+};
+
+// enumerates, in blocks, the triplets with at least two of their three pairs
+// within range (minDistance <= distance <= maxDistance) for the current
+// atomLocations; each triplet is given once, its first atom being within range
+// of the other two. pairList must hold every pair within range, it may have
+// been built for a larger distance at earlier positions
+class OPENMM_EXPORT ThreeNeighborTripletGenerator
+{
+public:
+    // the triplets whose first atom is in [firstAtom, lastAtom) are enumerated
+    ThreeNeighborTripletGenerator(const ThreeNeighborPairList& pairList,
+                                  const AtomLocationList& atomLocations,
+                                  const RealVec& periodicBoxSize,
+                                  bool usePeriodic,
+                                  double maxDistance,
+                                  double minDistance,
+                                  int firstAtom,
+                                  int lastAtom);
+
+    // replace the contents of block with the next (at most blockSize) triplets;
+    // returns false once all triplets have been given
+    bool next(ThreeNeighborList& block, unsigned int blockSize);
+
+private:
+    bool inRange(AtomIndex atomI, AtomIndex atomJ) const;
+
+    const ThreeNeighborPairList& pairList;
+    const AtomLocationList& atomLocations;
+    const RealVec& periodicBoxSize;
+    const bool usePeriodic;
+    const double maxDistanceSquared;
+    const double minDistanceSquared;
+    const int lastAtom;
+
+    // current first atom, its neighbors within range and the position within them
+    int atom;
+    std::vector<AtomIndex> atomNeighbors;
+    unsigned int ii, kk;
+};
+
+// O(n) neighbor list method using a cell list data structure:
+// all triplets with at least two of their pairs within range
+// parameter neighborList is automatically clear()ed before
+// neighbors are added; if threads is given, the pairs are
+// found by the threads of the pool
 void OPENMM_EXPORT computeThreeNeighborListVoxelHash(
                               ThreeNeighborList& neighborList,
                               int nAtoms,
-                              const AtomLocationList& atomLocations, 
+                              const AtomLocationList& atomLocations,
                               const RealVec& periodicBoxSize,
                               bool usePeriodic,
                               double maxDistance,
-                              double minDistance = 0.0
+                              double minDistance = 0.0,
+                              OpenMM::ThreadPool* threads = NULL
                              );
 
 } // namespace MBPolPlugin
@@ -23,6 +23,7 @@
  */
 
 #include "MBPolReferenceElectrostaticsForce.h"
+#include "openmm/internal/ThreadPool.h"
 #include <algorithm>
 #include <iostream>
 #include <cstdio>
@@ -34,6 +35,8 @@
 
 // from mbpol
 #include "gammq.h"
+#include "jama_lu.h"
+#include "jama_cholesky.h"
 
 using std::vector;
 using OpenMM::RealVec;
@@ -42,38 +45,57 @@ using OpenMM::RealVec;
 
 const RealOpenMM EXPGAMM = EXP(ttm::gammln(3.0/4.0));
 
+// Strength of the probe fields of calculateSystemPolarizability(), of the order of the fixed
+// fields in water so that the convergence target applies to dipoles of the usual size
+
+const RealOpenMM POLARIZABILITY_PROBE_FIELD = 10.0;
+
 #undef MBPOL_DEBUG
 
 MBPolReferenceElectrostaticsForce::MBPolReferenceElectrostaticsForce( ) :
                                                    _nonbondedMethod(NoCutoff),
+                                                   _polarizationSolver(SOR),
+                                                   _denseSolverThreshold(-1),
                                                    _numParticles(0),
                                                    _electric(138.9354558456),
                                                    _dielectric(1.0),
                                                    _mutualInducedDipoleConverged(0),
                                                    _mutualInducedDipoleIterations(0),
                                                    _maximumMutualInducedDipoleIterations(100),
+                                                   _fixedInducedDipoleIterations(-1),
+                                                   _singleDipoleSet(false),
                                                    _mutualInducedDipoleEpsilon(1.0e+50),
                                                    _mutualInducedDipoleTargetEpsilon(1.0e-04),
                                                    _polarSOR(0.55),
                                                    _debye(48.033324),
-                                                   _includeChargeRedistribution(true)
+                                                   _includeChargeRedistribution(true),
+                                                   _includeForces(true),
+                                                   _useDipoleFieldTensor(true),
+                                                   _threadPool(NULL)
 {
     initialize();
 }
 
 MBPolReferenceElectrostaticsForce::MBPolReferenceElectrostaticsForce( NonbondedMethod nonbondedMethod ) :
                                                    _nonbondedMethod(NoCutoff),
+                                                   _polarizationSolver(SOR),
+                                                   _denseSolverThreshold(-1),
                                                    _numParticles(0),
                                                    _electric(138.9354558456),
                                                    _dielectric(1.0),
                                                    _mutualInducedDipoleConverged(0),
                                                    _mutualInducedDipoleIterations(0),
                                                    _maximumMutualInducedDipoleIterations(100),
+                                                   _fixedInducedDipoleIterations(-1),
+                                                   _singleDipoleSet(false),
                                                    _mutualInducedDipoleEpsilon(1.0e+50),
                                                    _mutualInducedDipoleTargetEpsilon(1.0e-04),
                                                    _polarSOR(0.55),
                                                    _debye(48.033324),
-                                                   _includeChargeRedistribution(true)
+                                                   _includeChargeRedistribution(true),
+                                                   _includeForces(true),
+                                                   _useDipoleFieldTensor(true),
+                                                   _threadPool(NULL)
 {
     initialize();
 }
@@ -83,6 +105,65 @@ void MBPolReferenceElectrostaticsForce::initialize( void )
     return;
 }
 
+class MBPolReferenceElectrostaticsForce::ThreadTask : public OpenMM::ThreadPool::Task {
+public:
+    ThreadTask( MBPolReferenceElectrostaticsForce& owner ) : owner(owner) {
+    }
+    void execute( OpenMM::ThreadPool& threads, int threadIndex ) {
+        owner.threadComputeDirect( threads, threadIndex );
+    }
+    MBPolReferenceElectrostaticsForce& owner;
+};
+
+void MBPolReferenceElectrostaticsForce::setThreadPool( OpenMM::ThreadPool* threadPool )
+{
+    _threadPool = threadPool;
+}
+
+void MBPolReferenceElectrostaticsForce::threadComputeDirect( OpenMM::ThreadPool& threads, int threadIndex )
+{
+    // rows ii of the pair list are dealt out round robin, which balances the
+    // triangular loop well enough; every thread accumulates into its own buffers
+
+    const std::vector<ElectrostaticsParticleData>& particleData = *_threadParticleData;
+    unsigned int numParticles = particleData.size();
+    unsigned int numThreads   = threads.getNumThreads();
+
+    if( _threadStage == ScaleStage ){
+        for( unsigned int ii = threadIndex; ii < numParticles; ii += numThreads ){
+            precomputeScale35Row( particleData, ii );
+        }
+    } else if( _threadStage == InducedDipoleFieldStage ){
+        std::vector<UpdateInducedDipoleFieldStruct>& updateInducedDipoleFields = _threadInducedDipoleFields[threadIndex];
+        RealVec zeroVec( 0.0, 0.0, 0.0 );
+        for( unsigned int kk = 0; kk < updateInducedDipoleFields.size(); kk++ ){
+            std::fill( updateInducedDipoleFields[kk].inducedDipoleField.begin(), updateInducedDipoleFields[kk].inducedDipoleField.end(), zeroVec );
+        }
+        for( unsigned int ii = threadIndex; ii < numParticles; ii += numThreads ){
+            if( _useDipoleFieldTensor ){
+                multiplyDipoleFieldTensorRow( ii, updateInducedDipoleFields );
+                continue;
+            }
+            for( unsigned int xx = _pairStart[ii]; xx < _pairStart[ii+1]; xx++ ){
+                calculateInducedDipolePairIxns( particleData[ii], particleData[_pairNeighbors[xx]], updateInducedDipoleFields,
+                                                _pairScale3[xx], _pairScale5[xx] );
+            }
+        }
+    } else if( _threadStage == ElectrostaticStage ){
+        std::vector<RealVec>& forces                    = _threadForces[threadIndex];
+        std::vector<RealOpenMM>& electrostaticPotential = _threadElectrostaticPotential[threadIndex];
+        std::fill( forces.begin(), forces.end(), RealVec( 0.0, 0.0, 0.0 ) );
+        std::fill( electrostaticPotential.begin(), electrostaticPotential.end(), 0.0 );
+        RealOpenMM energy = 0.0;
+        for( unsigned int ii = threadIndex; ii < numParticles; ii += numThreads ){
+            for( unsigned int xx = _pairStart[ii]; xx < _pairStart[ii+1]; xx++ ){
+                energy += calculateDirectElectrostaticPairIxn( particleData, ii, _pairNeighbors[xx], forces, electrostaticPotential );
+            }
+        }
+        _threadEnergy[threadIndex] = energy;
+    }
+}
+
 MBPolReferenceElectrostaticsForce::NonbondedMethod MBPolReferenceElectrostaticsForce::getNonbondedMethod( void ) const
 {
     return _nonbondedMethod;
@@ -102,6 +183,78 @@ bool MBPolReferenceElectrostaticsForce::getIncludeChargeRedistribution( void ) c
     return _includeChargeRedistribution;
 }
 
+void MBPolReferenceElectrostaticsForce::setIncludeForces( bool includeForces ) {
+    _includeForces = includeForces;
+}
+
+bool MBPolReferenceElectrostaticsForce::getIncludeForces( void ) const
+{
+    return _includeForces;
+}
+
+void MBPolReferenceElectrostaticsForce::setUseDipoleFieldTensor( bool useDipoleFieldTensor ) {
+    _useDipoleFieldTensor = useDipoleFieldTensor;
+}
+
+bool MBPolReferenceElectrostaticsForce::getUseDipoleFieldTensor( void ) const
+{
+    return _useDipoleFieldTensor;
+}
+
+void MBPolReferenceElectrostaticsForce::setInitialInducedDipoles( const std::vector<RealVec>& inducedDipole, const std::vector<RealVec>& inducedDipolePolar ) {
+    _initialInducedDipole      = inducedDipole;
+    _initialInducedDipolePolar = inducedDipolePolar;
+}
+
+void MBPolReferenceElectrostaticsForce::getInducedDipoles( std::vector<RealVec>& inducedDipole, std::vector<RealVec>& inducedDipolePolar ) const {
+    inducedDipole      = _inducedDipole;
+    inducedDipolePolar = _inducedDipolePolar;
+}
+
+void MBPolReferenceElectrostaticsForce::setExternalFields( const std::vector<RealVec>& externalFields ) {
+    _externalFields = externalFields;
+}
+
+void MBPolReferenceElectrostaticsForce::getExternalFieldInducedDipoles( std::vector<std::vector<RealVec> >& inducedDipoles ) const {
+    inducedDipoles = _externalFieldDipole;
+}
+
+void MBPolReferenceElectrostaticsForce::setFixedInducedDipoleIterations( int iterations ) {
+    _fixedInducedDipoleIterations = iterations;
+}
+
+int MBPolReferenceElectrostaticsForce::getFixedInducedDipoleIterations( void ) const
+{
+    return _fixedInducedDipoleIterations;
+}
+
+void MBPolReferenceElectrostaticsForce::setExtrapolationCoefficients( const std::vector<RealOpenMM>& coefficients ) {
+    _extrapolationCoefficients = coefficients;
+}
+
+std::vector<RealOpenMM> MBPolReferenceElectrostaticsForce::getExtrapolationCoefficients( void ) const
+{
+    return _extrapolationCoefficients;
+}
+
+void MBPolReferenceElectrostaticsForce::setPolarizationSolver( MBPolReferenceElectrostaticsForce::PolarizationSolver polarizationSolver ) {
+    _polarizationSolver = polarizationSolver;
+}
+
+MBPolReferenceElectrostaticsForce::PolarizationSolver MBPolReferenceElectrostaticsForce::getPolarizationSolver( void ) const
+{
+    return _polarizationSolver;
+}
+
+void MBPolReferenceElectrostaticsForce::setDenseSolverThreshold( int threshold ) {
+    _denseSolverThreshold = threshold;
+}
+
+int MBPolReferenceElectrostaticsForce::getDenseSolverThreshold( void ) const
+{
+    return _denseSolverThreshold;
+}
+
 int MBPolReferenceElectrostaticsForce::getMutualInducedDipoleConverged( void ) const
 {
     return _mutualInducedDipoleConverged;
@@ -402,18 +555,11 @@ void MBPolReferenceElectrostaticsForce::calculateFixedElectrostaticsFieldPairIxn
 void MBPolReferenceElectrostaticsForce::calculateFixedElectrostaticsField( const vector<ElectrostaticsParticleData>& particleData )
 {
 
-    // calculate fixed multipole fields
-
-    // loop includes diagonal term ii == jj for GK ixn; other calculateFixedElectrostaticsFieldPairIxn() methods
-    // skip calculations for this case
+    // calculate fixed multipole fields over the pairs of the pair list
 
     for( unsigned int ii = 0; ii < _numParticles; ii++ ){
-        for( unsigned int jj = ii; jj < _numParticles; jj++ ){
-
-            // if site jj is less than max covalent scaling index then get/apply scaling constants
-            // otherwise add unmodified field and fieldPolar to particle fields
-
-            calculateFixedElectrostaticsFieldPairIxn( particleData[ii], particleData[jj]);
+        for( unsigned int xx = _pairStart[ii]; xx < _pairStart[ii+1]; xx++ ){
+            calculateFixedElectrostaticsFieldPairIxn( particleData[ii], particleData[_pairNeighbors[xx]]);
         }
     }
     return;
@@ -427,6 +573,12 @@ void MBPolReferenceElectrostaticsForce::initializeInducedDipoles( std::vector<Up
     _inducedDipole.resize( _numParticles );
     _inducedDipolePolar.resize( _numParticles );
 
+    if( _initialInducedDipole.size() == _numParticles && _initialInducedDipolePolar.size() == _numParticles ){
+        _inducedDipole      = _initialInducedDipole;
+        _inducedDipolePolar = _initialInducedDipolePolar;
+        return;
+    }
+
     for( unsigned int ii = 0; ii < _numParticles; ii++ ){
         _inducedDipole[ii]       = _fixedElectrostaticsField[ii];
         _inducedDipolePolar[ii]  = _fixedElectrostaticsFieldPolar[ii];
@@ -470,23 +622,108 @@ void MBPolReferenceElectrostaticsForce::calculateInducedDipolePairIxns( const El
 
 }
 
-void MBPolReferenceElectrostaticsForce::calculateInducedDipoleFields( const std::vector<ElectrostaticsParticleData>& particleData,
-                                                                  std::vector<UpdateInducedDipoleFieldStruct>& updateInducedDipoleFields, const RealOpenMM scale3[], const RealOpenMM scale5[])
+bool MBPolReferenceElectrostaticsForce::getInducedDipoleFieldFactors( const ElectrostaticsParticleData& particleI,
+                                                                      const ElectrostaticsParticleData& particleJ,
+                                                                      RealOpenMM scale3, RealOpenMM scale5, RealVec& deltaR,
+                                                                      RealOpenMM& preFactor1, RealOpenMM& preFactor2 ) const
 {
+    deltaR     = particleJ.position - particleI.position;
+    preFactor1 = scale3;
+    preFactor2 = scale5;
+    return true;
+}
 
-    unsigned int xx = 0;
-    for( unsigned int ii = 0; ii < particleData.size(); ii++ ){
-        for( unsigned int jj = ii+1; jj < particleData.size(); jj++ ){
-            calculateInducedDipolePairIxns( particleData[ii], particleData[jj], updateInducedDipoleFields,
-                    scale3[xx], scale5[xx] );
-            xx++;
+void MBPolReferenceElectrostaticsForce::multiplyDipoleFieldTensorRow( unsigned int ii,
+                                                                   std::vector<UpdateInducedDipoleFieldStruct>& updateInducedDipoleFields ) const
+{
+
+    // the tensor T of a pair is symmetric: field[ii] += T*dipole[jj], field[jj] += T*dipole[ii];
+    // each tensor is loaded once for all the dipole sets
+
+    unsigned int numSets = updateInducedDipoleFields.size();
+    for( unsigned int xx = _pairStart[ii]; xx < _pairStart[ii+1]; xx++ ){
+        unsigned int jj        = _pairNeighbors[xx];
+        const RealOpenMM* t    = &_pairTensor[6*xx];
+        for( unsigned int kk = 0; kk < numSets; kk++ ){
+            const std::vector<RealVec>& dipole = *(updateInducedDipoleFields[kk].inducedDipoles);
+            std::vector<RealVec>& field         = updateInducedDipoleFields[kk].inducedDipoleField;
+            const RealVec& dipoleI             = dipole[ii];
+            const RealVec& dipoleJ             = dipole[jj];
+            field[ii] += RealVec( t[0]*dipoleJ[0] + t[1]*dipoleJ[1] + t[2]*dipoleJ[2],
+                                  t[1]*dipoleJ[0] + t[3]*dipoleJ[1] + t[4]*dipoleJ[2],
+                                  t[2]*dipoleJ[0] + t[4]*dipoleJ[1] + t[5]*dipoleJ[2] );
+            field[jj] += RealVec( t[0]*dipoleI[0] + t[1]*dipoleI[1] + t[2]*dipoleI[2],
+                                  t[1]*dipoleI[0] + t[3]*dipoleI[1] + t[4]*dipoleI[2],
+                                  t[2]*dipoleI[0] + t[4]*dipoleI[1] + t[5]*dipoleI[2] );
+        }
+    }
+}
+
+void MBPolReferenceElectrostaticsForce::calculateDirectInducedDipoleFields( const std::vector<ElectrostaticsParticleData>& particleData,
+                                                                        std::vector<UpdateInducedDipoleFieldStruct>& updateInducedDipoleFields )
+{
+
+    if( _threadPool == NULL || _threadPool->getNumThreads() < 2 ){
+        for( unsigned int ii = 0; ii < particleData.size(); ii++ ){
+            if( _useDipoleFieldTensor ){
+                multiplyDipoleFieldTensorRow( ii, updateInducedDipoleFields );
+                continue;
+            }
+            for( unsigned int xx = _pairStart[ii]; xx < _pairStart[ii+1]; xx++ ){
+                calculateInducedDipolePairIxns( particleData[ii], particleData[_pairNeighbors[xx]], updateInducedDipoleFields,
+                        _pairScale3[xx], _pairScale5[xx] );
+            }
+        }
+        return;
+    }
+
+    // per-thread fields share the input induced dipoles and are summed into the output fields
+
+    unsigned int numThreads = _threadPool->getNumThreads();
+    _threadInducedDipoleFields.resize( numThreads );
+    for( unsigned int tt = 0; tt < numThreads; tt++ ){
+        std::vector<UpdateInducedDipoleFieldStruct>& threadFields = _threadInducedDipoleFields[tt];
+        if( threadFields.size() != updateInducedDipoleFields.size() ){
+            threadFields.clear();
+            for( unsigned int kk = 0; kk < updateInducedDipoleFields.size(); kk++ ){
+                threadFields.push_back( UpdateInducedDipoleFieldStruct( updateInducedDipoleFields[kk].fixedElectrostaticsField,
+                                                                        updateInducedDipoleFields[kk].inducedDipoles ) );
+            }
+        }
+        for( unsigned int kk = 0; kk < updateInducedDipoleFields.size(); kk++ ){
+            threadFields[kk].fixedElectrostaticsField = updateInducedDipoleFields[kk].fixedElectrostaticsField;
+            threadFields[kk].inducedDipoles           = updateInducedDipoleFields[kk].inducedDipoles;
+            threadFields[kk].inducedDipoleField.resize( particleData.size() );
+        }
+    }
+
+    _threadStage        = InducedDipoleFieldStage;
+    _threadParticleData = &particleData;
+    ThreadTask task( *this );
+    _threadPool->execute( task );
+    _threadPool->waitForThreads();
+
+    for( unsigned int kk = 0; kk < updateInducedDipoleFields.size(); kk++ ){
+        std::vector<RealVec>& field = updateInducedDipoleFields[kk].inducedDipoleField;
+        for( unsigned int tt = 0; tt < numThreads; tt++ ){
+            const std::vector<RealVec>& threadField = _threadInducedDipoleFields[tt][kk].inducedDipoleField;
+            for( unsigned int ii = 0; ii < particleData.size(); ii++ ){
+                field[ii] += threadField[ii];
+            }
         }
     }
     return;
 }
 
+void MBPolReferenceElectrostaticsForce::calculateInducedDipoleFields( const std::vector<ElectrostaticsParticleData>& particleData,
+                                                                  std::vector<UpdateInducedDipoleFieldStruct>& updateInducedDipoleFields )
+{
+    calculateDirectInducedDipoleFields( particleData, updateInducedDipoleFields );
+    return;
+}
+
 RealOpenMM MBPolReferenceElectrostaticsForce::runUpdateInducedDipoleFields( const std::vector<ElectrostaticsParticleData>& particleData,
-                                                                     std::vector<UpdateInducedDipoleFieldStruct>& updateInducedDipoleFields, const RealOpenMM scale3[], const RealOpenMM scale5[])
+                                                                     std::vector<UpdateInducedDipoleFieldStruct>& updateInducedDipoleFields )
 {
 
     // (1) zero fields
@@ -498,7 +735,7 @@ RealOpenMM MBPolReferenceElectrostaticsForce::runUpdateInducedDipoleFields( cons
         std::fill( updateInducedDipoleFields[ii].inducedDipoleField.begin(), updateInducedDipoleFields[ii].inducedDipoleField.end(), zeroVec );
     }
 
-    calculateInducedDipoleFields( particleData, updateInducedDipoleFields, scale3, scale5);
+    calculateInducedDipoleFields( particleData, updateInducedDipoleFields );
 
     RealOpenMM maxEpsilon = 0.0;
     for( unsigned int kk = 0; kk < updateInducedDipoleFields.size(); kk++ ){
@@ -531,27 +768,93 @@ RealOpenMM MBPolReferenceElectrostaticsForce::updateInducedDipole( const std::ve
 }
 
 
-void MBPolReferenceElectrostaticsForce::precomputeScale35( const std::vector<ElectrostaticsParticleData>& particleData, RealOpenMM scale3[], RealOpenMM scale5[] )
+void MBPolReferenceElectrostaticsForce::getScale35( const ElectrostaticsParticleData& particleI, const ElectrostaticsParticleData& particleJ,
+                                                    RealOpenMM& scale3, RealOpenMM& scale5 ) const
 {
-    // Precompute scale3 and scale5, the arrays will be passed into the iterative dipole estimation
-    // this has a great impact on performance
-    // The arrays are indexed by `xx`, we always scan through the arrays with the same 2 nested loops
-    // so we are always able to recover the correct element.
-    int xx = 0;
-    for( unsigned int ii = 0; ii < particleData.size(); ii++ ){
-        for( unsigned int jj = ii+1; jj < particleData.size(); jj++ ){
-	    RealVec deltaR    = particleData[jj].position - particleData[ii].position;
+    RealVec deltaR    = particleJ.position - particleI.position;
+
+    getPeriodicDelta( deltaR );
+    RealOpenMM r2     = deltaR.dot( deltaR );
 
-	    getPeriodicDelta( deltaR );
-	    RealOpenMM r2     = deltaR.dot( deltaR );
+    RealOpenMM r           = SQRT(r2);
 
-	    RealOpenMM r           = SQRT(r2);
+    scale3 = -1 * getAndScaleInverseRs(particleI, particleJ, r, false, 3, TDD);
+    scale5 = getAndScaleInverseRs(particleI, particleJ, r, false, 5, TDD);
+}
 
-	    scale3[xx] = -1 * getAndScaleInverseRs(particleData[ii], particleData[jj], r, false, 3, TDD);
-	    scale5[xx] = getAndScaleInverseRs(particleData[ii], particleData[jj], r, false, 5, TDD);
-        xx++;
+void MBPolReferenceElectrostaticsForce::buildPairList( const std::vector<ElectrostaticsParticleData>& particleData )
+{
+    unsigned int numParticles = particleData.size();
+    _pairStart.resize( numParticles + 1 );
+    _pairNeighbors.resize( numParticles > 0 ? numParticles*(numParticles-1)/2 : 0 );
+
+    unsigned int xx = 0;
+    for( unsigned int ii = 0; ii < numParticles; ii++ ){
+        _pairStart[ii] = xx;
+        for( unsigned int jj = ii+1; jj < numParticles; jj++ ){
+            _pairNeighbors[xx++] = jj;
         }
     }
+    _pairStart[numParticles] = xx;
+}
+
+void MBPolReferenceElectrostaticsForce::precomputeScale35( const std::vector<ElectrostaticsParticleData>& particleData )
+{
+    // Precompute scale3 and scale5, or the dipole field tensor, for the pairs of the pair list,
+    // they are used at every iteration of the induced dipoles; this has a great impact on performance
+
+    if( _useDipoleFieldTensor ){
+        _pairTensor.resize( 6*_pairNeighbors.size() );
+    } else {
+        _pairScale3.resize( _pairNeighbors.size() );
+        _pairScale5.resize( _pairNeighbors.size() );
+    }
+
+    if( _threadPool != NULL && _threadPool->getNumThreads() > 1 ){
+        _threadStage        = ScaleStage;
+        _threadParticleData = &particleData;
+        ThreadTask task( *this );
+        _threadPool->execute( task );
+        _threadPool->waitForThreads();
+        return;
+    }
+
+    for( unsigned int ii = 0; ii < particleData.size(); ii++ ){
+        precomputeScale35Row( particleData, ii );
+    }
+}
+
+void MBPolReferenceElectrostaticsForce::precomputeScale35Row( const std::vector<ElectrostaticsParticleData>& particleData, unsigned int ii )
+{
+    const ElectrostaticsParticleData& particleI = particleData[ii];
+    for( unsigned int xx = _pairStart[ii]; xx < _pairStart[ii+1]; xx++ ){
+        const ElectrostaticsParticleData& particleJ = particleData[_pairNeighbors[xx]];
+        if( !_useDipoleFieldTensor ){
+            getScale35( particleI, particleJ, _pairScale3[xx], _pairScale5[xx] );
+            continue;
+        }
+
+        getDipoleFieldTensor( particleI, particleJ, &_pairTensor[6*xx] );
+    }
+}
+
+void MBPolReferenceElectrostaticsForce::getDipoleFieldTensor( const ElectrostaticsParticleData& particleI,
+                                                              const ElectrostaticsParticleData& particleJ,
+                                                              RealOpenMM* t ) const
+{
+    RealOpenMM scale3, scale5, preFactor1, preFactor2;
+    RealVec deltaR;
+    getScale35( particleI, particleJ, scale3, scale5 );
+    if( !getInducedDipoleFieldFactors( particleI, particleJ, scale3, scale5, deltaR, preFactor1, preFactor2 ) ){
+        std::fill( t, t + 6, 0.0 );
+        return;
+    }
+    t[0] = preFactor1 + preFactor2*deltaR[0]*deltaR[0];
+    t[1] =              preFactor2*deltaR[0]*deltaR[1];
+    t[2] =              preFactor2*deltaR[0]*deltaR[2];
+    t[3] = preFactor1 + preFactor2*deltaR[1]*deltaR[1];
+    t[4] =              preFactor2*deltaR[1]*deltaR[2];
+    t[5] = preFactor1 + preFactor2*deltaR[2]*deltaR[2];
 }
 
 void MBPolReferenceElectrostaticsForce::convergeInduceDipoles( const std::vector<ElectrostaticsParticleData>& particleData,
@@ -572,11 +875,42 @@ void MBPolReferenceElectrostaticsForce::convergeInduceDipoles( const std::vector
 
     start = std::clock();
 
-    unsigned int scale_length = particleData.size() * (particleData.size())/2;
-    RealOpenMM * scale3 = new RealOpenMM[scale_length]; 
-    RealOpenMM * scale5 = new RealOpenMM[scale_length]; 
+    precomputeScale35( particleData );
 
-    precomputeScale35( particleData, scale3, scale5);
+    if( !_extrapolationCoefficients.empty() ){
+        extrapolateInducedDipoles( particleData, updateInducedDipoleField );
+        return;
+    }
+
+    if( _fixedInducedDipoleIterations >= 0 ){
+        iterateInducedDipoles( particleData, updateInducedDipoleField );
+        return;
+    }
+
+    if( _polarizationSolver == Dense && _nonbondedMethod != NoCutoff ){
+        throw OpenMMException("MBPolElectrostaticsForce: the Dense polarization solver needs NoCutoff");
+    }
+
+    if( _nonbondedMethod == NoCutoff ){
+        int numPolarizable = 0;
+        for( unsigned int ii = 0; ii < particleData.size(); ii++ ){
+            if( particleData[ii].polarity > 0.0 ){
+                numPolarizable++;
+            }
+        }
+        if( _polarizationSolver == Dense || numPolarizable <= _denseSolverThreshold ){
+            convergeInduceDipolesByDenseSolve( particleData, updateInducedDipoleField );
+            return;
+        }
+    }
+
+    if( _polarizationSolver == ConjugateGradient ){
+        convergeInduceDipolesByConjugateGradient( particleData, updateInducedDipoleField );
+        return;
+    } else if( _polarizationSolver == DIIS ){
+        convergeInduceDipolesByDIIS( particleData, updateInducedDipoleField );
+        return;
+    }
 
     duration = ( std::clock() - start ) / (double) CLOCKS_PER_SEC;
 
@@ -584,7 +918,7 @@ void MBPolReferenceElectrostaticsForce::convergeInduceDipoles( const std::vector
 
     while( !done ){
 
-        RealOpenMM epsilon = runUpdateInducedDipoleFields( particleData, updateInducedDipoleField, scale3, scale5);
+        RealOpenMM epsilon = runUpdateInducedDipoleFields( particleData, updateInducedDipoleField );
                    epsilon = _polarSOR*_debye*SQRT( epsilon/( static_cast<RealOpenMM>(_numParticles) ) );
 
         if( epsilon < getMutualInducedDipoleTargetEpsilon() ){
@@ -609,8 +943,676 @@ void MBPolReferenceElectrostaticsForce::convergeInduceDipoles( const std::vector
     setMutualInducedDipoleEpsilon( currentEpsilon );
     setMutualInducedDipoleIterations( iteration );
 
-    delete[] scale3;
-    delete[] scale5;
+    return;
+}
+
+void MBPolReferenceElectrostaticsForce::buildMoleculePreconditioner( const std::vector<ElectrostaticsParticleData>& particleData )
+{
+
+    // group the sites by molecule
+
+    unsigned int numParticles = particleData.size();
+    unsigned int numMolecules = 0;
+    for( unsigned int ii = 0; ii < numParticles; ii++ ){
+        numMolecules = std::max( numMolecules, particleData[ii].moleculeIndex + 1 );
+    }
+
+    _moleculeStart.assign( numMolecules + 1, 0 );
+    for( unsigned int ii = 0; ii < numParticles; ii++ ){
+        _moleculeStart[particleData[ii].moleculeIndex + 1]++;
+    }
+    for( unsigned int mm = 0; mm < numMolecules; mm++ ){
+        _moleculeStart[mm+1] += _moleculeStart[mm];
+    }
+    _moleculeSites.resize( numParticles );
+    std::vector<unsigned int> position( _moleculeStart.begin(), _moleculeStart.end() - 1 );
+    for( unsigned int ii = 0; ii < numParticles; ii++ ){
+        _moleculeSites[position[particleData[ii].moleculeIndex]++] = ii;
+    }
+
+    // invert 1 - alpha^(1/2)*T*alpha^(1/2) of every molecule
+
+    _preconditionerStart.resize( numMolecules + 1 );
+    _preconditionerStart[0] = 0;
+    for( unsigned int mm = 0; mm < numMolecules; mm++ ){
+        unsigned int numSites      = _moleculeStart[mm+1] - _moleculeStart[mm];
+        _preconditionerStart[mm+1] = _preconditionerStart[mm] + 9*numSites*numSites;
+    }
+    _preconditioner.resize( _preconditionerStart[numMolecules] );
+
+    for( unsigned int mm = 0; mm < numMolecules; mm++ ){
+        const unsigned int* sites = &_moleculeSites[_moleculeStart[mm]];
+        int size                  = 3*(_moleculeStart[mm+1] - _moleculeStart[mm]);
+        if( size == 0 ){
+            continue;
+        }
+
+        TNT::Array2D<double> block( size, size, 0.0 );
+        TNT::Array2D<double> identity( size, size, 0.0 );
+        for( int kk = 0; kk < size; kk++ ){
+            block[kk][kk]    = 1.0;
+            identity[kk][kk] = 1.0;
+        }
+        for( int ii = 0; ii < size/3; ii++ ){
+            const ElectrostaticsParticleData& particleI = particleData[sites[ii]];
+            for( int jj = ii+1; jj < size/3; jj++ ){
+                const ElectrostaticsParticleData& particleJ = particleData[sites[jj]];
+                RealOpenMM t[6];
+                getDipoleFieldTensor( particleI, particleJ, t );
+                RealOpenMM factor = SQRT( particleI.polarity*particleJ.polarity );
+                const int index[3][3] = { { 0, 1, 2 }, { 1, 3, 4 }, { 2, 4, 5 } };
+                for( int aa = 0; aa < 3; aa++ ){
+                    for( int bb = 0; bb < 3; bb++ ){
+                        block[3*ii+aa][3*jj+bb] = -factor*t[index[aa][bb]];
+                        block[3*jj+bb][3*ii+aa] = -factor*t[index[aa][bb]];
+                    }
+                }
+            }
+        }
+
+        JAMA::LU<double> lu( block );
+        RealOpenMM* inverse = &_preconditioner[_preconditionerStart[mm]];
+        if( !lu.isNonsingular() ){
+            std::fill( inverse, inverse + size*size, 0.0 );
+            for( int kk = 0; kk < size; kk++ ){
+                inverse[kk*size+kk] = 1.0;
+            }
+            continue;
+        }
+        TNT::Array2D<double> blockInverse = lu.solve( identity );
+        for( int ii = 0; ii < size; ii++ ){
+            for( int jj = 0; jj < size; jj++ ){
+                inverse[ii*size+jj] = static_cast<RealOpenMM>(blockInverse[ii][jj]);
+            }
+        }
+    }
+}
+
+void MBPolReferenceElectrostaticsForce::applyMoleculePreconditioner( const std::vector<RealVec>& residual,
+                                                                     std::vector<RealVec>& preconditioned ) const
+{
+    for( unsigned int mm = 0; mm + 1 < _moleculeStart.size(); mm++ ){
+        const unsigned int* sites   = &_moleculeSites[_moleculeStart[mm]];
+        unsigned int numSites       = _moleculeStart[mm+1] - _moleculeStart[mm];
+        unsigned int size           = 3*numSites;
+        const RealOpenMM* inverse   = &_preconditioner[_preconditionerStart[mm]];
+        for( unsigned int ii = 0; ii < numSites; ii++ ){
+            RealVec value( 0.0, 0.0, 0.0 );
+            for( unsigned int jj = 0; jj < numSites; jj++ ){
+                const RealVec& r = residual[sites[jj]];
+                for( unsigned int aa = 0; aa < 3; aa++ ){
+                    const RealOpenMM* row = inverse + (3*ii+aa)*size + 3*jj;
+                    value[aa]            += row[0]*r[0] + row[1]*r[1] + row[2]*r[2];
+                }
+            }
+            preconditioned[sites[ii]] = value;
+        }
+    }
+}
+
+void MBPolReferenceElectrostaticsForce::convergeInduceDipolesByConjugateGradient( const std::vector<ElectrostaticsParticleData>& particleData,
+                                                                                  std::vector<UpdateInducedDipoleFieldStruct>& updateInducedDipoleFields )
+{
+
+    // Solve (1 - D*T*D) y = D^-1*fixedField for y = D^-1*mu, D = alpha^(1/2); the residual r of y
+    // is D^-1 times the change SOR would make to mu, the epsilon is computed from D*r
+
+    unsigned int numParticles = particleData.size();
+    unsigned int numSets      = updateInducedDipoleFields.size();
+    RealVec zeroVec( 0.0, 0.0, 0.0 );
+
+    buildMoleculePreconditioner( particleData );
+
+    std::vector<RealOpenMM> sqrtPolarity( numParticles );
+    for( unsigned int ii = 0; ii < numParticles; ii++ ){
+        sqrtPolarity[ii] = SQRT( particleData[ii].polarity );
+    }
+
+    // initial residuals, r = D^-1*(fixedField - mu) + D*T*mu
+
+    for( unsigned int kk = 0; kk < numSets; kk++ ){
+        std::fill( updateInducedDipoleFields[kk].inducedDipoleField.begin(), updateInducedDipoleFields[kk].inducedDipoleField.end(), zeroVec );
+    }
+    calculateInducedDipoleFields( particleData, updateInducedDipoleFields );
+
+    std::vector< std::vector<RealVec> > residual( numSets, std::vector<RealVec>( numParticles ) );
+    std::vector< std::vector<RealVec> > preconditioned( numSets, std::vector<RealVec>( numParticles ) );
+    std::vector< std::vector<RealVec> > direction( numSets, std::vector<RealVec>( numParticles ) );
+    std::vector< std::vector<RealVec> > scaledDirection( numSets, std::vector<RealVec>( numParticles ) );
+    std::vector<RealOpenMM> residualDotPreconditioned( numSets );
+
+    std::vector<UpdateInducedDipoleFieldStruct> directionFields;
+    for( unsigned int kk = 0; kk < numSets; kk++ ){
+        const std::vector<RealVec>& fixedField = *(updateInducedDipoleFields[kk].fixedElectrostaticsField);
+        const std::vector<RealVec>& dipole     = *(updateInducedDipoleFields[kk].inducedDipoles);
+        const std::vector<RealVec>& field      = updateInducedDipoleFields[kk].inducedDipoleField;
+        for( unsigned int ii = 0; ii < numParticles; ii++ ){
+            residual[kk][ii] = field[ii]*sqrtPolarity[ii];
+            if( sqrtPolarity[ii] > 0.0 ){
+                residual[kk][ii] += (fixedField[ii] - dipole[ii])/sqrtPolarity[ii];
+            }
+        }
+        applyMoleculePreconditioner( residual[kk], preconditioned[kk] );
+        direction[kk]                 = preconditioned[kk];
+        residualDotPreconditioned[kk] = 0.0;
+        for( unsigned int ii = 0; ii < numParticles; ii++ ){
+            residualDotPreconditioned[kk] += residual[kk][ii].dot( preconditioned[kk][ii] );
+        }
+        directionFields.push_back( UpdateInducedDipoleFieldStruct( updateInducedDipoleFields[kk].fixedElectrostaticsField, &scaledDirection[kk] ) );
+    }
+
+    setMutualInducedDipoleConverged( false );
+    int iteration      = 0;
+    RealOpenMM epsilon = 0.0;
+    while( true ){
+
+        epsilon = 0.0;
+        for( unsigned int kk = 0; kk < numSets; kk++ ){
+            RealOpenMM sum = 0.0;
+            for( unsigned int ii = 0; ii < numParticles; ii++ ){
+                RealVec delta = residual[kk][ii]*sqrtPolarity[ii];
+                sum          += delta.dot( delta );
+            }
+            epsilon = std::max( epsilon, _debye*SQRT( sum/static_cast<RealOpenMM>(numParticles) ) );
+        }
+        if( epsilon < getMutualInducedDipoleTargetEpsilon() ){
+            setMutualInducedDipoleConverged( true );
+            break;
+        }
+        if( iteration >= getMaximumMutualInducedDipoleIterations() ){
+            break;
+        }
+        iteration++;
+
+        // field due the dipoles D*p of the search directions p of all sets
+
+        for( unsigned int kk = 0; kk < numSets; kk++ ){
+            for( unsigned int ii = 0; ii < numParticles; ii++ ){
+                scaledDirection[kk][ii] = direction[kk][ii]*sqrtPolarity[ii];
+            }
+            std::fill( directionFields[kk].inducedDipoleField.begin(), directionFields[kk].inducedDipoleField.end(), zeroVec );
+        }
+        calculateInducedDipoleFields( particleData, directionFields );
+
+        for( unsigned int kk = 0; kk < numSets; kk++ ){
+            std::vector<RealVec>& dipole     = *(updateInducedDipoleFields[kk].inducedDipoles);
+            const std::vector<RealVec>& field = directionFields[kk].inducedDipoleField;
+
+            // q = (1 - D*T*D) p, held in the storage of the preconditioned residual until that is updated
+
+            RealOpenMM directionDotProduct = 0.0;
+            std::vector<RealVec>& product  = preconditioned[kk];
+            for( unsigned int ii = 0; ii < numParticles; ii++ ){
+                product[ii]          = direction[kk][ii] - field[ii]*sqrtPolarity[ii];
+                directionDotProduct += direction[kk][ii].dot( product[ii] );
+            }
+            if( directionDotProduct == 0.0 ){
+                continue;
+            }
+            RealOpenMM step = residualDotPreconditioned[kk]/directionDotProduct;
+            for( unsigned int ii = 0; ii < numParticles; ii++ ){
+                dipole[ii]       += scaledDirection[kk][ii]*step;
+                residual[kk][ii] -= product[ii]*step;
+            }
+
+            applyMoleculePreconditioner( residual[kk], preconditioned[kk] );
+            RealOpenMM previous           = residualDotPreconditioned[kk];
+            residualDotPreconditioned[kk] = 0.0;
+            for( unsigned int ii = 0; ii < numParticles; ii++ ){
+                residualDotPreconditioned[kk] += residual[kk][ii].dot( preconditioned[kk][ii] );
+            }
+            RealOpenMM beta = residualDotPreconditioned[kk]/previous;
+            for( unsigned int ii = 0; ii < numParticles; ii++ ){
+                direction[kk][ii] = preconditioned[kk][ii] + direction[kk][ii]*beta;
+            }
+        }
+    }
+
+    // the last fields were computed for the search directions; recompute them for the dipoles,
+    // as the PME reciprocal space forces use the potential of the last induced dipoles on the grid
+
+    for( unsigned int kk = 0; kk < numSets; kk++ ){
+        std::fill( updateInducedDipoleFields[kk].inducedDipoleField.begin(), updateInducedDipoleFields[kk].inducedDipoleField.end(), zeroVec );
+    }
+    calculateInducedDipoleFields( particleData, updateInducedDipoleFields );
+
+    setMutualInducedDipoleEpsilon( epsilon );
+    setMutualInducedDipoleIterations( iteration );
+
+    return;
+}
+
+void MBPolReferenceElectrostaticsForce::convergeInduceDipolesByDenseSolve( const std::vector<ElectrostaticsParticleData>& particleData,
+                                                                          std::vector<UpdateInducedDipoleFieldStruct>& updateInducedDipoleFields )
+{
+
+    // Solve (1 - D*T*D) y = D^-1*fixedField for y = D^-1*mu, D = alpha^(1/2), restricted to the
+    // polarizable sites; the other sites keep zero dipoles
+
+    unsigned int numParticles = particleData.size();
+    unsigned int numSets      = updateInducedDipoleFields.size();
+    RealVec zeroVec( 0.0, 0.0, 0.0 );
+
+    std::vector<int> siteIndex( numParticles, -1 );
+    std::vector<RealOpenMM> sqrtPolarity( numParticles );
+    int numSites = 0;
+    for( unsigned int ii = 0; ii < numParticles; ii++ ){
+        sqrtPolarity[ii] = SQRT( particleData[ii].polarity );
+        if( particleData[ii].polarity > 0.0 ){
+            siteIndex[ii] = numSites++;
+        }
+    }
+    for( unsigned int kk = 0; kk < numSets; kk++ ){
+        std::fill( updateInducedDipoleFields[kk].inducedDipoles->begin(), updateInducedDipoleFields[kk].inducedDipoles->end(), zeroVec );
+    }
+
+    setMutualInducedDipoleConverged( false );
+    setMutualInducedDipoleIterations( 1 );
+
+    if( numSites > 0 ){
+
+        int size = 3*numSites;
+        TNT::Array2D<double> matrix( size, size, 0.0 );
+        for( int kk = 0; kk < size; kk++ ){
+            matrix[kk][kk] = 1.0;
+        }
+        const int index[3][3] = { { 0, 1, 2 }, { 1, 3, 4 }, { 2, 4, 5 } };
+        for( unsigned int ii = 0; ii < numParticles; ii++ ){
+            if( siteIndex[ii] < 0 ){
+                continue;
+            }
+            for( unsigned int xx = _pairStart[ii]; xx < _pairStart[ii+1]; xx++ ){
+                unsigned int jj = _pairNeighbors[xx];
+                if( siteIndex[jj] < 0 ){
+                    continue;
+                }
+                RealOpenMM tensor[6];
+                const RealOpenMM* t = tensor;
+                if( _useDipoleFieldTensor ){
+                    t = &_pairTensor[6*xx];
+                } else {
+                    getDipoleFieldTensor( particleData[ii], particleData[jj], tensor );
+                }
+                RealOpenMM factor = sqrtPolarity[ii]*sqrtPolarity[jj];
+                int rowI          = 3*siteIndex[ii];
+                int rowJ          = 3*siteIndex[jj];
+                for( int aa = 0; aa < 3; aa++ ){
+                    for( int bb = 0; bb < 3; bb++ ){
+                        matrix[rowI+aa][rowJ+bb] = -factor*t[index[aa][bb]];
+                        matrix[rowJ+bb][rowI+aa] = -factor*t[index[aa][bb]];
+                    }
+                }
+            }
+        }
+
+        TNT::Array2D<double> rightHandSide( size, numSets, 0.0 );
+        for( unsigned int kk = 0; kk < numSets; kk++ ){
+            const std::vector<RealVec>& fixedField = *(updateInducedDipoleFields[kk].fixedElectrostaticsField);
+            for( unsigned int ii = 0; ii < numParticles; ii++ ){
+                if( siteIndex[ii] >= 0 ){
+                    for( int aa = 0; aa < 3; aa++ ){
+                        rightHandSide[3*siteIndex[ii]+aa][kk] = fixedField[ii][aa]/sqrtPolarity[ii];
+                    }
+                }
+            }
+        }
+
+        // the matrix is positive definite unless the polarization catastrophe is reached
+
+        TNT::Array2D<double> solution;
+        JAMA::Cholesky<double> cholesky( matrix );
+        if( cholesky.is_spd() ){
+            solution = cholesky.solve( rightHandSide );
+        } else {
+            JAMA::LU<double> lu( matrix );
+            if( !lu.isNonsingular() ){
+                return;
+            }
+            solution = lu.solve( rightHandSide );
+        }
+
+        for( unsigned int kk = 0; kk < numSets; kk++ ){
+            std::vector<RealVec>& dipole = *(updateInducedDipoleFields[kk].inducedDipoles);
+            for( unsigned int ii = 0; ii < numParticles; ii++ ){
+                if( siteIndex[ii] >= 0 ){
+                    int row    = 3*siteIndex[ii];
+                    dipole[ii] = RealVec( solution[row][kk], solution[row+1][kk], solution[row+2][kk] )*sqrtPolarity[ii];
+                }
+            }
+        }
+    }
+
+    // the fields of the solved dipoles, and as epsilon the change SOR would still make to them
+
+    for( unsigned int kk = 0; kk < numSets; kk++ ){
+        std::fill( updateInducedDipoleFields[kk].inducedDipoleField.begin(), updateInducedDipoleFields[kk].inducedDipoleField.end(), zeroVec );
+    }
+    calculateInducedDipoleFields( particleData, updateInducedDipoleFields );
+
+    RealOpenMM epsilon = 0.0;
+    for( unsigned int kk = 0; kk < numSets; kk++ ){
+        const std::vector<RealVec>& fixedField = *(updateInducedDipoleFields[kk].fixedElectrostaticsField);
+        const std::vector<RealVec>& dipole     = *(updateInducedDipoleFields[kk].inducedDipoles);
+        const std::vector<RealVec>& field      = updateInducedDipoleFields[kk].inducedDipoleField;
+        RealOpenMM sum = 0.0;
+        for( unsigned int ii = 0; ii < numParticles; ii++ ){
+            RealVec delta = fixedField[ii] + field[ii]*particleData[ii].polarity - dipole[ii];
+            sum          += delta.dot( delta );
+        }
+        epsilon = std::max( epsilon, _debye*SQRT( sum/static_cast<RealOpenMM>(numParticles) ) );
+    }
+
+    setMutualInducedDipoleConverged( true );
+    setMutualInducedDipoleEpsilon( epsilon );
+
+    return;
+}
+
+void MBPolReferenceElectrostaticsForce::iterateInducedDipoles( const std::vector<ElectrostaticsParticleData>& particleData,
+                                                               std::vector<UpdateInducedDipoleFieldStruct>& updateInducedDipoleFields )
+{
+
+    RealOpenMM epsilon = 0.0;
+    for( int iteration = 0; iteration < _fixedInducedDipoleIterations; iteration++ ){
+        epsilon = runUpdateInducedDipoleFields( particleData, updateInducedDipoleFields );
+        epsilon = _polarSOR*_debye*SQRT( epsilon/( static_cast<RealOpenMM>(_numParticles) ) );
+    }
+
+    setMutualInducedDipoleConverged( epsilon < getMutualInducedDipoleTargetEpsilon() );
+    setMutualInducedDipoleEpsilon( epsilon );
+    setMutualInducedDipoleIterations( _fixedInducedDipoleIterations );
+
+    return;
+}
+
+void MBPolReferenceElectrostaticsForce::extrapolateInducedDipoles( const std::vector<ElectrostaticsParticleData>& particleData,
+                                                                   std::vector<UpdateInducedDipoleFieldStruct>& updateInducedDipoleFields )
+{
+
+    unsigned int numParticles = particleData.size();
+    unsigned int numOrders    = _extrapolationCoefficients.size();
+    RealVec zeroVec( 0.0, 0.0, 0.0 );
+
+    // C_k, the coefficient of the perturbation order k
+
+    std::vector<RealOpenMM> orderCoefficients( numOrders, 0.0 );
+    for( int kk = numOrders - 1; kk >= 0; kk-- ){
+        orderCoefficients[kk] = _extrapolationCoefficients[kk] + (kk + 1 < static_cast<int>(numOrders) ? orderCoefficients[kk+1] : 0.0);
+    }
+
+    // p_0 = alpha*E is the fixed field already scaled by the polarity, p_k = alpha*T*p_(k-1)
+
+    _ptDipole.resize( numOrders );
+    _ptDipolePolar.resize( numOrders );
+    for( unsigned int kk = 0; kk < updateInducedDipoleFields.size(); kk++ ){
+        std::vector<std::vector<RealVec> >& ptDipole = (kk == 0) ? _ptDipole : _ptDipolePolar;
+        ptDipole[0] = *(updateInducedDipoleFields[kk].fixedElectrostaticsField);
+    }
+
+    for( unsigned int order = 1; order < numOrders; order++ ){
+        for( unsigned int kk = 0; kk < updateInducedDipoleFields.size(); kk++ ){
+            std::vector<std::vector<RealVec> >& ptDipole = (kk == 0) ? _ptDipole : _ptDipolePolar;
+            *(updateInducedDipoleFields[kk].inducedDipoles) = ptDipole[order-1];
+            std::fill( updateInducedDipoleFields[kk].inducedDipoleField.begin(), updateInducedDipoleFields[kk].inducedDipoleField.end(), zeroVec );
+        }
+        calculateInducedDipoleFields( particleData, updateInducedDipoleFields );
+        for( unsigned int kk = 0; kk < updateInducedDipoleFields.size(); kk++ ){
+            std::vector<std::vector<RealVec> >& ptDipole = (kk == 0) ? _ptDipole : _ptDipolePolar;
+            const std::vector<RealVec>& field            = updateInducedDipoleFields[kk].inducedDipoleField;
+            ptDipole[order].resize( numParticles );
+            for( unsigned int ii = 0; ii < numParticles; ii++ ){
+                ptDipole[order][ii] = field[ii]*particleData[ii].polarity;
+            }
+        }
+    }
+
+    // the extrapolated dipoles and, for the PME reciprocal space forces, their fields
+
+    RealOpenMM epsilon = 0.0;
+    for( unsigned int kk = 0; kk < updateInducedDipoleFields.size(); kk++ ){
+        std::vector<std::vector<RealVec> >& ptDipole = (kk == 0) ? _ptDipole : _ptDipolePolar;
+        std::vector<RealVec>& dipole                 = *(updateInducedDipoleFields[kk].inducedDipoles);
+        RealOpenMM sum = 0.0;
+        for( unsigned int ii = 0; ii < numParticles; ii++ ){
+            dipole[ii] = zeroVec;
+            for( unsigned int order = 0; order < numOrders; order++ ){
+                dipole[ii] += ptDipole[order][ii]*orderCoefficients[order];
+            }
+            sum += ptDipole[numOrders-1][ii].dot( ptDipole[numOrders-1][ii] );
+        }
+        epsilon = std::max( epsilon, _debye*SQRT( sum/static_cast<RealOpenMM>(numParticles) ) );
+        std::fill( updateInducedDipoleFields[kk].inducedDipoleField.begin(), updateInducedDipoleFields[kk].inducedDipoleField.end(), zeroVec );
+    }
+    calculateInducedDipoleFields( particleData, updateInducedDipoleFields );
+
+    // epsilon is the size of the last perturbation order; the dipoles are what the coefficients make them
+
+    setMutualInducedDipoleConverged( true );
+    setMutualInducedDipoleEpsilon( epsilon );
+    setMutualInducedDipoleIterations( numOrders - 1 );
+
+    return;
+}
+
+void MBPolReferenceElectrostaticsForce::calculateExtrapolatedDipoleForces( const std::vector<ElectrostaticsParticleData>& particleData,
+                                                                           std::vector<RealVec>& forces )
+{
+
+    unsigned int numParticles = particleData.size();
+    unsigned int numOrders    = _extrapolationCoefficients.size();
+
+    std::vector<RealOpenMM> orderCoefficients( 2*numOrders, 0.0 );
+    for( int kk = numOrders - 1; kk >= 0; kk-- ){
+        orderCoefficients[kk] = _extrapolationCoefficients[kk] + orderCoefficients[kk+1];
+    }
+
+    // sum_(m,n) (C_(m+n+1) - C_m C_n) B(p_m, p_n), B being the bilinear induced dipole - induced dipole
+    // forces, as sum_m B(p_m, r_m) with r_m = sum_n (C_(m+n+1) - C_m C_n) p_n
+
+    std::vector<RealVec> weightedDipolePolar( numParticles );
+    for( unsigned int mm = 0; mm < numOrders; mm++ ){
+        bool allZero = true;
+        std::fill( weightedDipolePolar.begin(), weightedDipolePolar.end(), RealVec( 0.0, 0.0, 0.0 ) );
+        for( unsigned int nn = 0; nn < numOrders; nn++ ){
+            RealOpenMM weight = orderCoefficients[mm+nn+1] - orderCoefficients[mm]*orderCoefficients[nn];
+            if( weight == 0.0 ){
+                continue;
+            }
+            allZero = false;
+            for( unsigned int ii = 0; ii < numParticles; ii++ ){
+                weightedDipolePolar[ii] += _ptDipolePolar[nn][ii]*weight;
+            }
+        }
+        if( !allZero ){
+            calculateInducedDipoleForces( particleData, _ptDipole[mm], weightedDipolePolar, forces );
+        }
+    }
+
+    return;
+}
+
+void MBPolReferenceElectrostaticsForce::calculateInducedDipoleForces( const std::vector<ElectrostaticsParticleData>& particleData,
+                                                                      const std::vector<RealVec>& inducedDipole,
+                                                                      const std::vector<RealVec>& inducedDipolePolar,
+                                                                      std::vector<RealVec>& forces )
+{
+    for( unsigned int ii = 0; ii < particleData.size(); ii++ ){
+        for( unsigned int xx = _pairStart[ii]; xx < _pairStart[ii+1]; xx++ ){
+            calculateInducedDipolePairForce( particleData, ii, _pairNeighbors[xx], inducedDipole, inducedDipolePolar, forces );
+        }
+    }
+    return;
+}
+
+void MBPolReferenceElectrostaticsForce::calculateInducedDipolePairForce( const std::vector<ElectrostaticsParticleData>& particleData,
+                                                                         unsigned int iIndex, unsigned int kIndex,
+                                                                         const std::vector<RealVec>& inducedDipole,
+                                                                         const std::vector<RealVec>& inducedDipolePolar,
+                                                                         std::vector<RealVec>& forces ) const
+{
+
+    // the induced dipole - induced dipole terms of calculateElectrostaticPairIxn()
+
+    const ElectrostaticsParticleData& particleI = particleData[iIndex];
+    const ElectrostaticsParticleData& particleK = particleData[kIndex];
+
+    RealVec delta       = particleK.position - particleI.position;
+    RealOpenMM r2       = delta.dot( delta );
+    RealOpenMM r        = SQRT(r2);
+    RealOpenMM rr3      = 1.0/(r*r2);
+    RealOpenMM rr5      = 3.0*rr3/r2;
+    RealOpenMM rr7      = 5.0*rr5/r2;
+
+    RealOpenMM sci2     = inducedDipole[iIndex].dot( delta );
+    RealOpenMM sci3     = inducedDipole[kIndex].dot( delta );
+    RealOpenMM scip1    = inducedDipole[iIndex].dot( inducedDipolePolar[kIndex] ) + inducedDipolePolar[iIndex].dot( inducedDipole[kIndex] );
+    RealOpenMM scip2    = inducedDipolePolar[iIndex].dot( delta );
+    RealOpenMM scip3    = inducedDipolePolar[kIndex].dot( delta );
+
+    RealOpenMM scale5DD = getAndScaleInverseRs( particleI, particleK, r, true, 5, TDD );
+    RealOpenMM scale7DD = getAndScaleInverseRs( particleI, particleK, r, true, 7, TDD );
+
+    RealOpenMM gfi      = 0.5*rr5*scip1*scale5DD - 0.5*rr7*(sci2*scip3 + scip2*sci3)*scale7DD;
+
+    RealVec ftm2i       = delta*gfi;
+    ftm2i              += ( inducedDipolePolar[iIndex]*sci3 + inducedDipole[iIndex]*scip3 +
+                            inducedDipolePolar[kIndex]*sci2 + inducedDipole[kIndex]*scip2 )*0.5*rr5*scale5DD;
+
+    ftm2i              *= _electric/_dielectric;
+
+    forces[iIndex]     -= ftm2i;
+    forces[kIndex]     += ftm2i;
+}
+
+void MBPolReferenceElectrostaticsForce::convergeInduceDipolesByDIIS( const std::vector<ElectrostaticsParticleData>& particleData,
+                                                                     std::vector<UpdateInducedDipoleFieldStruct>& updateInducedDipoleFields )
+{
+
+    unsigned int numParticles = particleData.size();
+    unsigned int numSets      = updateInducedDipoleFields.size();
+    RealVec zeroVec( 0.0, 0.0, 0.0 );
+
+    // the last MaxPrevDIISDipoles dipoles and changes of every set and the matrices of the dot
+    // products of the changes, oldest first; every set is its own linear system, so each one is
+    // extrapolated with the coefficients that minimize its own change
+
+    std::vector< std::vector< std::vector<RealVec> > > prevDipoles( numSets );
+    std::vector< std::vector< std::vector<RealVec> > > prevErrors( numSets );
+    std::vector< std::vector< std::vector<double> > > matrix( numSets );
+
+    setMutualInducedDipoleConverged( false );
+    int iteration      = 0;
+    RealOpenMM epsilon = 0.0;
+    while( true ){
+
+        for( unsigned int kk = 0; kk < numSets; kk++ ){
+            std::fill( updateInducedDipoleFields[kk].inducedDipoleField.begin(), updateInducedDipoleFields[kk].inducedDipoleField.end(), zeroVec );
+        }
+        calculateInducedDipoleFields( particleData, updateInducedDipoleFields );
+
+        // record the new dipoles and the changes, dropping the oldest once the history is full
+
+        epsilon = 0.0;
+        for( unsigned int kk = 0; kk < numSets; kk++ ){
+            if( prevErrors[kk].size() == static_cast<unsigned int>(MaxPrevDIISDipoles) ){
+                prevDipoles[kk].erase( prevDipoles[kk].begin() );
+                prevErrors[kk].erase( prevErrors[kk].begin() );
+                matrix[kk].erase( matrix[kk].begin() );
+                for( unsigned int ii = 0; ii < matrix[kk].size(); ii++ ){
+                    matrix[kk][ii].erase( matrix[kk][ii].begin() );
+                }
+            }
+
+            const std::vector<RealVec>& fixedField = *(updateInducedDipoleFields[kk].fixedElectrostaticsField);
+            const std::vector<RealVec>& field      = updateInducedDipoleFields[kk].inducedDipoleField;
+            const std::vector<RealVec>& dipole     = *(updateInducedDipoleFields[kk].inducedDipoles);
+            prevDipoles[kk].push_back( std::vector<RealVec>( numParticles ) );
+            prevErrors[kk].push_back( std::vector<RealVec>( numParticles ) );
+            std::vector<RealVec>& newDipole = prevDipoles[kk].back();
+            std::vector<RealVec>& newError  = prevErrors[kk].back();
+            RealOpenMM sum = 0.0;
+            for( unsigned int ii = 0; ii < numParticles; ii++ ){
+                newDipole[ii] = fixedField[ii] + field[ii]*particleData[ii].polarity;
+                newError[ii]  = newDipole[ii] - dipole[ii];
+                sum += newError[ii].dot( newError[ii] );
+            }
+            epsilon = std::max( epsilon, _debye*SQRT( sum/static_cast<RealOpenMM>(numParticles) ) );
+        }
+        iteration++;
+
+        if( epsilon < getMutualInducedDipoleTargetEpsilon() ){
+            setMutualInducedDipoleConverged( true );
+            break;
+        }
+
+        for( unsigned int kk = 0; kk < numSets; kk++ ){
+
+            // add the dot products of the newest change to the matrix
+
+            unsigned int numPrev = prevErrors[kk].size();
+            matrix[kk].push_back( std::vector<double>( numPrev ) );
+            for( unsigned int ii = 0; ii < numPrev; ii++ ){
+                double dot = 0.0;
+                for( unsigned int jj = 0; jj < numParticles; jj++ ){
+                    dot += prevErrors[kk][ii][jj].dot( prevErrors[kk][numPrev-1][jj] );
+                }
+                matrix[kk][numPrev-1][ii] = dot;
+                if( ii < numPrev-1 ){
+                    matrix[kk][ii].push_back( dot );
+                }
+            }
+
+            // minimize the combined change subject to the coefficients summing to one:
+            // | 0  -1 | | lambda |   | -1 |
+            // | -1  B | |   c    | = |  0 |
+
+            std::vector<double> coefficients( numPrev, 0.0 );
+            coefficients[numPrev-1] = 1.0;
+            if( numPrev > 1 ){
+                int rank = numPrev + 1;
+                TNT::Array2D<double> b( rank, rank );
+                TNT::Array1D<double> rhs( rank, 0.0 );
+                b[0][0] = 0.0;
+                rhs[0]  = -1.0;
+                for( int ii = 1; ii < rank; ii++ ){
+                    b[ii][0] = b[0][ii] = -1.0;
+                    for( int jj = 1; jj < rank; jj++ ){
+                        b[ii][jj] = matrix[kk][ii-1][jj-1];
+                    }
+                }
+                JAMA::LU<double> lu( b );
+                if( lu.isNonsingular() ){
+                    TNT::Array1D<double> solution = lu.solve( rhs );
+                    for( unsigned int ii = 0; ii < numPrev; ii++ ){
+                        coefficients[ii] = solution[ii+1];
+                    }
+                }
+            }
+
+            std::vector<RealVec>& dipole = *(updateInducedDipoleFields[kk].inducedDipoles);
+            for( unsigned int ii = 0; ii < numParticles; ii++ ){
+                RealVec sum( 0.0, 0.0, 0.0 );
+                for( unsigned int jj = 0; jj < numPrev; jj++ ){
+                    sum += prevDipoles[kk][jj][ii]*coefficients[jj];
+                }
+                dipole[ii] = sum;
+            }
+        }
+
+        if( iteration >= getMaximumMutualInducedDipoleIterations() ){
+
+            // the fields are those of the dipoles before the extrapolation
+
+            for( unsigned int kk = 0; kk < numSets; kk++ ){
+                std::fill( updateInducedDipoleFields[kk].inducedDipoleField.begin(), updateInducedDipoleFields[kk].inducedDipoleField.end(), zeroVec );
+            }
+            calculateInducedDipoleFields( particleData, updateInducedDipoleFields );
+            break;
+        }
+    }
+
+    setMutualInducedDipoleEpsilon( epsilon );
+    setMutualInducedDipoleIterations( iteration );
 
     return;
 }
@@ -630,11 +1632,33 @@ void MBPolReferenceElectrostaticsForce::calculateInducedDipoles( const std::vect
         _fixedElectrostaticsFieldPolar[ii] *= particleData[ii].polarity;
     }
 
+    // when the polar set has the same fixed field and initial dipoles as the direct one, as the fixed
+    // field of MB-pol always does, its dipoles are the same at every iteration: only the direct set
+    // is iterated and the polar dipoles are copied from it
+
+    _singleDipoleSet = hasIdenticalPolarDipoleSet();
+
     _inducedDipole.resize( _numParticles );
     _inducedDipolePolar.resize( _numParticles );
     std::vector<UpdateInducedDipoleFieldStruct> updateInducedDipoleField;
     updateInducedDipoleField.push_back( UpdateInducedDipoleFieldStruct( &_fixedElectrostaticsField,       &_inducedDipole ) );
-    updateInducedDipoleField.push_back( UpdateInducedDipoleFieldStruct( &_fixedElectrostaticsFieldPolar,  &_inducedDipolePolar ) );
+    if( !_singleDipoleSet ){
+        updateInducedDipoleField.push_back( UpdateInducedDipoleFieldStruct( &_fixedElectrostaticsFieldPolar,  &_inducedDipolePolar ) );
+    }
+
+    // one more set per external field, starting from the dipoles it induces directly
+
+    unsigned int numExternalFields = _externalFields.size();
+    _externalFieldFixedField.resize( numExternalFields );
+    _externalFieldDipole.resize( numExternalFields );
+    for( unsigned int kk = 0; kk < numExternalFields; kk++ ){
+        _externalFieldFixedField[kk].resize( _numParticles );
+        for( unsigned int ii = 0; ii < _numParticles; ii++ ){
+            _externalFieldFixedField[kk][ii] = _externalFields[kk]*particleData[ii].polarity;
+        }
+        _externalFieldDipole[kk] = _externalFieldFixedField[kk];
+        updateInducedDipoleField.push_back( UpdateInducedDipoleFieldStruct( &_externalFieldFixedField[kk], &_externalFieldDipole[kk] ) );
+    }
 
     initializeInducedDipoles( updateInducedDipoleField );
 
@@ -643,9 +1667,40 @@ void MBPolReferenceElectrostaticsForce::calculateInducedDipoles( const std::vect
 
     convergeInduceDipoles( particleData, updateInducedDipoleField );
 
+    if( _singleDipoleSet ){
+        _inducedDipolePolar = _inducedDipole;
+        _ptDipolePolar      = _ptDipole;
+    }
+
     return;
 }
 
+bool MBPolReferenceElectrostaticsForce::hasIdenticalPolarDipoleSet( void ) const
+{
+    for( unsigned int ii = 0; ii < _numParticles; ii++ ){
+        for( unsigned int aa = 0; aa < 3; aa++ ){
+            if( _fixedElectrostaticsField[ii][aa] != _fixedElectrostaticsFieldPolar[ii][aa] ){
+                return false;
+            }
+        }
+    }
+    if( _initialInducedDipole.size() == _numParticles && _initialInducedDipolePolar.size() == _numParticles ){
+        for( unsigned int ii = 0; ii < _numParticles; ii++ ){
+            for( unsigned int aa = 0; aa < 3; aa++ ){
+                if( _initialInducedDipole[ii][aa] != _initialInducedDipolePolar[ii][aa] ){
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+bool MBPolReferenceElectrostaticsForce::getSingleDipoleSet( void ) const
+{
+    return _singleDipoleSet;
+}
+
 RealOpenMM MBPolReferenceElectrostaticsForce::calculateElectrostaticPairIxn( const std::vector<ElectrostaticsParticleData>& particleData,
                                                                          unsigned int iIndex,
                                                                          unsigned int kIndex,
@@ -731,6 +1786,10 @@ RealOpenMM MBPolReferenceElectrostaticsForce::calculateElectrostaticPairIxn( con
     energy           += 0.5*( rr3*gli[0]*scale3CD ); // charge - induced dipole
     energy           *= f;
 
+    if( !_includeForces ){
+        return energy;
+    }
+
     RealOpenMM scale3CC = getAndScaleInverseRs( particleI, particleK, r, true, 3, TCC);
     RealOpenMM scale5CD = getAndScaleInverseRs( particleI, particleK, r, true, 5, TCD);
     RealOpenMM scale5DD = getAndScaleInverseRs( particleI, particleK, r, true, 5, TDD);
@@ -835,25 +1894,72 @@ RealOpenMM MBPolReferenceElectrostaticsForce::calculateElectrostaticPairIxn( con
     return energy;
 }
 
-RealOpenMM MBPolReferenceElectrostaticsForce::calculateElectrostatic( const std::vector<ElectrostaticsParticleData>& particleData,
-                                                                  std::vector<RealVec>& forces )
+RealOpenMM MBPolReferenceElectrostaticsForce::calculateDirectElectrostaticPairIxn( const std::vector<ElectrostaticsParticleData>& particleData,
+                                                                               unsigned int iIndex, unsigned int jIndex,
+                                                                               std::vector<RealVec>& forces,
+                                                                               std::vector<RealOpenMM>& electrostaticPotential ) const
 {
+    return calculateElectrostaticPairIxn( particleData, iIndex, jIndex, forces );
+}
 
-    RealOpenMM energy = 0.0;
+RealOpenMM MBPolReferenceElectrostaticsForce::calculateDirectElectrostatic( const std::vector<ElectrostaticsParticleData>& particleData,
+                                                                        std::vector<RealVec>& forces,
+                                                                        std::vector<RealOpenMM>& electrostaticPotential )
+{
 
-    // main loop over particle pairs
+    RealOpenMM energy = 0.0;
 
-    for( unsigned int ii = 0; ii < particleData.size(); ii++ ){
-        for( unsigned int jj = ii+1; jj < particleData.size(); jj++ ){
+    if( _threadPool == NULL || _threadPool->getNumThreads() < 2 ){
+        for( unsigned int ii = 0; ii < particleData.size(); ii++ ){
+            for( unsigned int xx = _pairStart[ii]; xx < _pairStart[ii+1]; xx++ ){
 
-            energy += calculateElectrostaticPairIxn( particleData, ii, jj, forces);
+                energy += calculateDirectElectrostaticPairIxn( particleData, ii, _pairNeighbors[xx], forces, electrostaticPotential );
 
+            }
         }
+        return energy;
     }
 
+    unsigned int numThreads = _threadPool->getNumThreads();
+    _threadForces.resize( numThreads );
+    _threadElectrostaticPotential.resize( numThreads );
+    _threadEnergy.resize( numThreads );
+    for( unsigned int tt = 0; tt < numThreads; tt++ ){
+        _threadForces[tt].resize( forces.size() );
+        _threadElectrostaticPotential[tt].resize( electrostaticPotential.size() );
+    }
+
+    _threadStage        = ElectrostaticStage;
+    _threadParticleData = &particleData;
+    ThreadTask task( *this );
+    _threadPool->execute( task );
+    _threadPool->waitForThreads();
+
+    for( unsigned int tt = 0; tt < numThreads; tt++ ){
+        energy += _threadEnergy[tt];
+        if( !_includeForces ){
+            continue;
+        }
+        for( unsigned int ii = 0; ii < forces.size(); ii++ ){
+            forces[ii] += _threadForces[tt][ii];
+        }
+        for( unsigned int ii = 0; ii < electrostaticPotential.size(); ii++ ){
+            electrostaticPotential[ii] += _threadElectrostaticPotential[tt][ii];
+        }
+    }
     return energy;
 }
 
+RealOpenMM MBPolReferenceElectrostaticsForce::calculateElectrostatic( const std::vector<ElectrostaticsParticleData>& particleData,
+                                                                  std::vector<RealVec>& forces )
+{
+
+    // main loop over particle pairs
+
+    std::vector<RealOpenMM> electrostaticPotential( particleData.size(), 0.0 );
+    return calculateDirectElectrostatic( particleData, forces, electrostaticPotential );
+}
+
 void MBPolReferenceElectrostaticsForce::setup( const std::vector<RealVec>& particlePositions,
                                            const std::vector<RealOpenMM>& charges,
                                            const std::vector<int>& moleculeIndices,
@@ -883,9 +1989,10 @@ void MBPolReferenceElectrostaticsForce::setup( const std::vector<RealVec>& parti
         }
     }
 
+    buildPairList( particleData );
     calculateInducedDipoles( particleData );
 
-    if( !getMutualInducedDipoleConverged() ){
+    if( !getMutualInducedDipoleConverged() && _fixedInducedDipoleIterations < 0 ){
         std::stringstream message;
         message << "Induced dipoles did not converge: ";
         message << " iterations="      << getMutualInducedDipoleIterations();
@@ -917,6 +2024,10 @@ RealOpenMM MBPolReferenceElectrostaticsForce::calculateForceAndEnergy( const std
 
     RealOpenMM energy = calculateElectrostatic( particleData, forces );
 
+    if( _includeForces && !_extrapolationCoefficients.empty() ){
+        calculateExtrapolatedDipoleForces( particleData, forces );
+    }
+
     return energy;
 }
 
@@ -1077,9 +2188,59 @@ void MBPolReferenceElectrostaticsForce::calculateElectrostaticPotential( const s
         }
     }
 
-    RealOpenMM term = _electric/_dielectric;
-    for( unsigned int ii = 0; ii < grid.size(); ii++ ){
-        potential[ii] *= term;
+    RealOpenMM term = _electric/_dielectric;
+    for( unsigned int ii = 0; ii < grid.size(); ii++ ){
+        potential[ii] *= term;
+    }
+
+    return;
+}
+
+void MBPolReferenceElectrostaticsForce::calculateSystemPolarizability( const std::vector<RealVec>& particlePositions,
+                                                                       const std::vector<RealOpenMM>& charges,
+                                                                       const std::vector<int>& moleculeIndices,
+                                                                       const std::vector<int>& atomTypes,
+                                                                       const std::vector<RealOpenMM>& tholes,
+                                                                       const std::vector<RealOpenMM>& dampingFactors,
+                                                                       const std::vector<RealOpenMM>& polarity,
+                                                                       std::vector<RealOpenMM>& outputPolarizability )
+{
+
+    // converge the dipoles of the fixed field and of a probe field along each axis together;
+    // the fixed number of iterations and the extrapolation, if set, are not used for this
+
+    std::vector<RealVec> externalFields           = _externalFields;
+    std::vector<RealOpenMM> extrapolation         = _extrapolationCoefficients;
+    int fixedInducedDipoleIterations              = _fixedInducedDipoleIterations;
+    _extrapolationCoefficients.clear();
+    _fixedInducedDipoleIterations                 = -1;
+
+    std::vector<RealVec> probeFields;
+    probeFields.push_back( RealVec( POLARIZABILITY_PROBE_FIELD, 0.0, 0.0 ) );
+    probeFields.push_back( RealVec( 0.0, POLARIZABILITY_PROBE_FIELD, 0.0 ) );
+    probeFields.push_back( RealVec( 0.0, 0.0, POLARIZABILITY_PROBE_FIELD ) );
+    setExternalFields( probeFields );
+
+    std::vector<ElectrostaticsParticleData> particleData;
+    setup( particlePositions, charges, moleculeIndices, atomTypes, tholes,
+           dampingFactors, polarity,
+           particleData );
+
+    _externalFields               = externalFields;
+    _extrapolationCoefficients    = extrapolation;
+    _fixedInducedDipoleIterations = fixedInducedDipoleIterations;
+
+    // the response is linear in the field
+
+    outputPolarizability.assign( 9, 0.0 );
+    for( unsigned int bb = 0; bb < 3; bb++ ){
+        RealVec totalDipole( 0.0, 0.0, 0.0 );
+        for( unsigned int ii = 0; ii < _numParticles; ii++ ){
+            totalDipole += _externalFieldDipole[bb][ii];
+        }
+        for( unsigned int aa = 0; aa < 3; aa++ ){
+            outputPolarizability[3*aa+bb] = totalDipole[aa]/POLARIZABILITY_PROBE_FIELD;
+        }
     }
 
     return;
@@ -1092,26 +2253,25 @@ MBPolReferenceElectrostaticsForce::UpdateInducedDipoleFieldStruct::UpdateInduced
     inducedDipoleField.resize( fixedElectrostaticsField->size() );
 }
 
-const int MBPolReferencePmeElectrostaticsForce::MBPOL_PME_ORDER = 5;
+const int MBPolReferencePmeElectrostaticsForce::MBPOL_PME_MAX_ORDER = 8;
 
 const RealOpenMM MBPolReferencePmeElectrostaticsForce::SQRT_PI = 1.77245385091;
 
 MBPolReferencePmeElectrostaticsForce::MBPolReferencePmeElectrostaticsForce( void ) :
                MBPolReferenceElectrostaticsForce(PME),
                _cutoffDistance(0.9), _cutoffDistanceSquared(0.81),
-               _pmeGridSize(0), _totalGridSize(0), _alphaEwald(0.0)
+               _pmeGridSize(0), _totalGridSize(0), _alphaEwald(0.0), _pmeOrder(5),
+               _spreadParticleData(NULL), _spreadInducedDipole(NULL), _spreadInducedDipolePolar(NULL)
 {
 
-    _fftplan = NULL;
+    _fft     = NULL;
     _pmeGrid = NULL;
     _pmeGridDimensions = IntVec( -1, -1, -1 );
 }
 
 MBPolReferencePmeElectrostaticsForce::~MBPolReferencePmeElectrostaticsForce( )
 {
-    if( _fftplan ){
-        fftpack_destroy( _fftplan );
-    }
+    delete _fft;
     if( _pmeGrid ){
         delete _pmeGrid;
     }
@@ -1157,10 +2317,8 @@ void MBPolReferencePmeElectrostaticsForce::setPmeGridDimensions( std::vector<int
         (pmeGridDimensions[1] == _pmeGridDimensions[1]) &&
         (pmeGridDimensions[2] == _pmeGridDimensions[2]) )return;
 
-    if( _fftplan ){
-        fftpack_destroy(_fftplan);
-    }
-    fftpack_init_3d(&_fftplan,pmeGridDimensions[0], pmeGridDimensions[1], pmeGridDimensions[2]);
+    delete _fft;
+    _fft = new MBPolReferencePmeFFT( pmeGridDimensions[0], pmeGridDimensions[1], pmeGridDimensions[2] );
 
     _pmeGridDimensions[0] = pmeGridDimensions[0];
     _pmeGridDimensions[1] = pmeGridDimensions[1];
@@ -1169,6 +2327,27 @@ void MBPolReferencePmeElectrostaticsForce::setPmeGridDimensions( std::vector<int
     initializeBSplineModuli( );
 };
 
+int MBPolReferencePmeElectrostaticsForce::getPmeBSplineOrder( void ) const
+{
+    return _pmeOrder;
+};
+
+void MBPolReferencePmeElectrostaticsForce::setPmeBSplineOrder( int pmeBSplineOrder )
+{
+
+    if( pmeBSplineOrder < 4 || pmeBSplineOrder > MBPOL_PME_MAX_ORDER ){
+        std::stringstream message;
+        message << "PME B-spline order " << pmeBSplineOrder << " is invalid, it must be between 4 and " << MBPOL_PME_MAX_ORDER << ".";
+        throw OpenMMException(message.str());
+    }
+    if( pmeBSplineOrder == _pmeOrder )return;
+
+    _pmeOrder = pmeBSplineOrder;
+    if( _pmeGridDimensions[0] > 0 ){
+        initializeBSplineModuli( );
+    }
+};
+
 void MBPolReferencePmeElectrostaticsForce::setPeriodicBoxSize( RealVec& boxSize )
 {
 
@@ -1187,11 +2366,6 @@ void MBPolReferencePmeElectrostaticsForce::setPeriodicBoxSize( RealVec& boxSize
     return;
 };
 
-int compareInt2( const int2& v1, const int2& v2 )
-{
-    return v1[1] < v2[1];
-}
-
 void MBPolReferencePmeElectrostaticsForce::resizePmeArrays( void )
 {
 
@@ -1203,10 +2377,11 @@ void MBPolReferencePmeElectrostaticsForce::resizePmeArrays( void )
         _pmeGrid      = new t_complex[_totalGridSize];
         _pmeGridSize  = _totalGridSize;
     }
+    _pmeRealGrid.resize( _totalGridSize );
 
     for( unsigned int ii = 0; ii < 3; ii++ ){
        _pmeBsplineModuli[ii].resize( _pmeGridDimensions[ii] );
-       _thetai[ii].resize( MBPOL_PME_ORDER*_numParticles );
+       _thetai[ii].resize( _pmeOrder*_numParticles );
     }
 
     _iGrid.resize( _numParticles );
@@ -1214,20 +2389,7 @@ void MBPolReferencePmeElectrostaticsForce::resizePmeArrays( void )
     _phid.resize( 10*_numParticles );
     _phip.resize( 10*_numParticles );
     _phidp.resize( 20*_numParticles );
-    _pmeAtomRange.resize( _totalGridSize + 1);
-    _pmeAtomGridIndex.resize( _numParticles );
-
-    return;
-}
 
-void MBPolReferencePmeElectrostaticsForce::initializePmeGrid( void )
-{
-    if( _pmeGrid == NULL )return;
-    //memset( _pmeGrid, 0, sizeof( t_complex )*_totalGridSize );
-
-    for (int jj = 0; jj < _totalGridSize; jj++){
-        _pmeGrid[jj].re = _pmeGrid[jj].im = 0.0;
-    }
     return;
 }
 
@@ -1256,11 +2418,11 @@ void MBPolReferencePmeElectrostaticsForce::initializeBSplineModuli( void )
         maxSize = maxSize  > _pmeGridDimensions[ii] ? maxSize : _pmeGridDimensions[ii];
     }
 
-    RealOpenMM array[MBPOL_PME_ORDER];
+    RealOpenMM array[MBPOL_PME_MAX_ORDER];
     RealOpenMM x = 0.0;
     array[0]     = 1.0 - x;
     array[1]     = x;
-    for( int k = 2; k < MBPOL_PME_ORDER; k++) {
+    for( int k = 2; k < _pmeOrder; k++) {
         RealOpenMM denom = 1.0/k;
         array[k] = x*array[k-1]*denom;
         for (int i = 1; i < k; i++){
@@ -1270,7 +2432,7 @@ void MBPolReferencePmeElectrostaticsForce::initializeBSplineModuli( void )
     }
 
     vector<RealOpenMM> bsarray(maxSize+1, 0.0);
-    for( int i = 2; i <= MBPOL_PME_ORDER+1; i++){
+    for( int i = 2; i <= _pmeOrder+1; i++){
         bsarray[i] = array[i-2];
     }
     for( int dim = 0; dim < 3; dim++) {
@@ -1322,13 +2484,13 @@ void MBPolReferencePmeElectrostaticsForce::initializeBSplineModuli( void )
                 factor          = M_PI*k/size;
                 for (int j = 1; j <= jcut; j++) {
                     RealOpenMM arg = factor/(factor+M_PI*j);
-                    sum1           = sum1 + POW(arg,   MBPOL_PME_ORDER);
-                    sum2           = sum2 + POW(arg, 2*MBPOL_PME_ORDER);
+                    sum1           = sum1 + POW(arg,   _pmeOrder);
+                    sum2           = sum2 + POW(arg, 2*_pmeOrder);
                 }
                 for (int j = 1; j <= jcut; j++) {
                     RealOpenMM arg  = factor/(factor-M_PI*j);
-                    sum1           += POW(arg,   MBPOL_PME_ORDER);
-                    sum2           += POW(arg, 2*MBPOL_PME_ORDER);
+                    sum1           += POW(arg,   _pmeOrder);
+                    sum2           += POW(arg, 2*_pmeOrder);
                 }
                 zeta = sum2/sum1;
             }
@@ -1413,13 +2575,10 @@ void MBPolReferencePmeElectrostaticsForce::calculateFixedElectrostaticsField( co
 
     resizePmeArrays();
     computeMBPolBsplines( particleData );
-    sort( _pmeAtomGridIndex.begin(), _pmeAtomGridIndex.end(), compareInt2 );
-    findMBPolAtomRangeForGrid( particleData );
-    initializePmeGrid();
     spreadFixedElectrostaticssOntoGrid( particleData );
-    fftpack_exec_3d( _fftplan, FFTPACK_FORWARD, _pmeGrid, _pmeGrid);
-    performMBPolReciprocalConvolution();
-    fftpack_exec_3d( _fftplan, FFTPACK_BACKWARD, _pmeGrid, _pmeGrid);
+    _fft->transformRealToComplex( &_pmeRealGrid[0], _pmeGrid );
+    performMBPolReciprocalConvolution( _fft->getComplexSizeZ() );
+    _fft->transformComplexToReal( _pmeGrid, &_pmeRealGrid[0] );
     computeFixedPotentialFromGrid();
     recordFixedElectrostaticsField();
 
@@ -1438,7 +2597,7 @@ void MBPolReferencePmeElectrostaticsForce::calculateFixedElectrostaticsField( co
     return;
 }
 
-#define ARRAY(x,y) array[(x)-1+((y)-1)*MBPOL_PME_ORDER]
+#define ARRAY(x,y) array[(x)-1+((y)-1)*_pmeOrder]
 
 /**
  * This is called from computeBsplines().  It calculates the spline coefficients for a single atom along a single axis.
@@ -1446,10 +2605,12 @@ void MBPolReferencePmeElectrostaticsForce::calculateFixedElectrostaticsField( co
 void MBPolReferencePmeElectrostaticsForce::computeBSplinePoint( std::vector<RealOpenMM4>& thetai, RealOpenMM w  )
 {
 
-    RealOpenMM array[MBPOL_PME_ORDER*MBPOL_PME_ORDER];
+    RealOpenMM array[MBPOL_PME_MAX_ORDER*MBPOL_PME_MAX_ORDER];
 
-    // initialization to get to 2nd order recursion
+    // initialization to get to 2nd order recursion; the first order spline is
+    // only needed for the third derivative at order 4
 
+    ARRAY(1,1) = 1.0;
     ARRAY(2,2) = w;
     ARRAY(2,1) = 1.0 - w;
 
@@ -1461,7 +2622,7 @@ void MBPolReferencePmeElectrostaticsForce::computeBSplinePoint( std::vector<Real
 
     // compute standard B-spline recursion to desired order
 
-    for( int i = 4; i <= MBPOL_PME_ORDER; i++){
+    for( int i = 4; i <= _pmeOrder; i++){
         int k = i - 1;
         RealOpenMM denom = 1.0 / k;
         ARRAY(i,i) = denom * w * ARRAY(k,k);
@@ -1473,44 +2634,44 @@ void MBPolReferencePmeElectrostaticsForce::computeBSplinePoint( std::vector<Real
 
     // get coefficients for the B-spline first derivative
 
-    int k = MBPOL_PME_ORDER - 1;
-    ARRAY(k,MBPOL_PME_ORDER) = ARRAY(k,MBPOL_PME_ORDER-1);
-    for (int i = MBPOL_PME_ORDER-1; i >= 2; i--)
+    int k = _pmeOrder - 1;
+    ARRAY(k,_pmeOrder) = ARRAY(k,_pmeOrder-1);
+    for (int i = _pmeOrder-1; i >= 2; i--)
         ARRAY(k,i) = ARRAY(k,i-1) - ARRAY(k,i);
     ARRAY(k,1) = -ARRAY(k,1);
 
     // get coefficients for the B-spline second derivative
 
-    k = MBPOL_PME_ORDER - 2;
-    ARRAY(k,MBPOL_PME_ORDER-1) = ARRAY(k,MBPOL_PME_ORDER-2);
-    for (int i = MBPOL_PME_ORDER-2; i >= 2; i--)
+    k = _pmeOrder - 2;
+    ARRAY(k,_pmeOrder-1) = ARRAY(k,_pmeOrder-2);
+    for (int i = _pmeOrder-2; i >= 2; i--)
         ARRAY(k,i) = ARRAY(k,i-1) - ARRAY(k,i);
     ARRAY(k,1) = -ARRAY(k,1);
-    ARRAY(k,MBPOL_PME_ORDER) = ARRAY(k,MBPOL_PME_ORDER-1);
-    for (int i = MBPOL_PME_ORDER-1; i >= 2; i--)
+    ARRAY(k,_pmeOrder) = ARRAY(k,_pmeOrder-1);
+    for (int i = _pmeOrder-1; i >= 2; i--)
         ARRAY(k,i) = ARRAY(k,i-1) - ARRAY(k,i);
     ARRAY(k,1) = -ARRAY(k,1);
 
     // get coefficients for the B-spline third derivative
 
-    k = MBPOL_PME_ORDER - 3;
-    ARRAY(k,MBPOL_PME_ORDER-2) = ARRAY(k,MBPOL_PME_ORDER-3);
-    for (int i = MBPOL_PME_ORDER-3; i >= 2; i--)
+    k = _pmeOrder - 3;
+    ARRAY(k,_pmeOrder-2) = ARRAY(k,_pmeOrder-3);
+    for (int i = _pmeOrder-3; i >= 2; i--)
         ARRAY(k,i) = ARRAY(k,i-1) - ARRAY(k,i);
     ARRAY(k,1) = -ARRAY(k,1);
-    ARRAY(k,MBPOL_PME_ORDER-1) = ARRAY(k,MBPOL_PME_ORDER-2);
-    for (int i = MBPOL_PME_ORDER-2; i >= 2; i--)
+    ARRAY(k,_pmeOrder-1) = ARRAY(k,_pmeOrder-2);
+    for (int i = _pmeOrder-2; i >= 2; i--)
         ARRAY(k,i) = ARRAY(k,i-1) - ARRAY(k,i);
     ARRAY(k,1) = -ARRAY(k,1);
-    ARRAY(k,MBPOL_PME_ORDER) = ARRAY(k,MBPOL_PME_ORDER-1);
-    for (int i = MBPOL_PME_ORDER-1; i >= 2; i--)
+    ARRAY(k,_pmeOrder) = ARRAY(k,_pmeOrder-1);
+    for (int i = _pmeOrder-1; i >= 2; i--)
         ARRAY(k,i) = ARRAY(k,i-1) - ARRAY(k,i);
     ARRAY(k,1) = -ARRAY(k,1);
 
     // copy coefficients from temporary to permanent storage
 
-    for (int i = 1; i <= MBPOL_PME_ORDER; i++){
-        thetai[i-1] = RealOpenMM4(ARRAY(MBPOL_PME_ORDER,i), ARRAY(MBPOL_PME_ORDER-1,i), ARRAY(MBPOL_PME_ORDER-2,i), ARRAY(MBPOL_PME_ORDER-3,i));
+    for (int i = 1; i <= _pmeOrder; i++){
+        thetai[i-1] = RealOpenMM4(ARRAY(_pmeOrder,i), ARRAY(_pmeOrder-1,i), ARRAY(_pmeOrder-2,i), ARRAY(_pmeOrder-3,i));
     }
 
     return;
@@ -1534,157 +2695,152 @@ void MBPolReferencePmeElectrostaticsForce::computeMBPolBsplines( const std::vect
             RealOpenMM fr = _pmeGridDimensions[jj]*(w-(int)(w+0.5)+0.5);
             int ifr       = static_cast<int>(fr);
             w             = fr - ifr;
-            igrid[jj]     = ifr - MBPOL_PME_ORDER + 1;
+            igrid[jj]     = ifr - _pmeOrder + 1;
             igrid[jj]    += igrid[jj] < 0 ? _pmeGridDimensions[jj] : 0;
-            std::vector<RealOpenMM4> thetaiTemp(MBPOL_PME_ORDER);
+            std::vector<RealOpenMM4> thetaiTemp(_pmeOrder);
             computeBSplinePoint( thetaiTemp, w);
-            for( unsigned int kk = 0; kk < MBPOL_PME_ORDER; kk++ ){
-                _thetai[jj][ii*MBPOL_PME_ORDER+kk] = thetaiTemp[kk];
+            for( unsigned int kk = 0; kk < _pmeOrder; kk++ ){
+                _thetai[jj][ii*_pmeOrder+kk] = thetaiTemp[kk];
             }
         }
 
         // Record the grid point.
 
         _iGrid[ii]               = igrid;
-        _pmeAtomGridIndex[ii]    = int2( ii, igrid[0]*_pmeGridDimensions[1]*_pmeGridDimensions[2] + igrid[1]*_pmeGridDimensions[2] + igrid[2] );
 
     }
 
     return;
 }
 
-/**
- * For each grid point, find the range of sorted atoms associated with that point.
- */
-void MBPolReferencePmeElectrostaticsForce::findMBPolAtomRangeForGrid( const vector<ElectrostaticsParticleData>& particleData )
-{
-
-    int last;
-    int start = 0;
-    last = (start == 0 ? -1 : _pmeAtomGridIndex[start-1][1]);
-    for( unsigned int ii = start; ii < _numParticles; ++ii) {
-        int2 atomData = _pmeAtomGridIndex[ii];
-        int gridIndex = atomData[1];
-        if (gridIndex != last)
-        {
-            for (int jj = last+1; jj <= gridIndex; ++jj){
-                _pmeAtomRange[jj] = ii;
-            }
-            last = gridIndex;
-        }
+class MBPolReferencePmeElectrostaticsForce::SpreadTask : public OpenMM::ThreadPool::Task {
+public:
+    SpreadTask( MBPolReferencePmeElectrostaticsForce& owner ) : owner(owner) {
+    }
+    void execute( OpenMM::ThreadPool& threads, int threadIndex ) {
+        owner.threadSpreadOntoGrid( threads, threadIndex );
     }
+    MBPolReferencePmeElectrostaticsForce& owner;
+};
+
+void MBPolReferencePmeElectrostaticsForce::spreadOntoGridSlab( int xBegin, int xEnd )
+{
+
+    // each site adds its _pmeOrder^3 footprint starting at _iGrid[ii];
+    // only the x planes in [xBegin, xEnd) are written
 
-    // Fill in values beyond the last atom.
+    RealVec scale;
+    getPmeScale( scale );
 
-    for (int j = last+1; j <= _totalGridSize; ++j){
-        _pmeAtomRange[j] = _numParticles;
+    const int gridSizeYZ = _pmeGridDimensions[1]*_pmeGridDimensions[2];
+    const bool realGrid  = (_spreadInducedDipolePolar == NULL);
+    if( realGrid ){
+        std::fill( _pmeRealGrid.begin() + xBegin*gridSizeYZ, _pmeRealGrid.begin() + xEnd*gridSizeYZ, 0.0 );
+    } else {
+        for( int ii = xBegin*gridSizeYZ; ii < xEnd*gridSizeYZ; ii++ ){
+            _pmeGrid[ii].re = _pmeGrid[ii].im = 0.0;
+        }
     }
 
-    // The grid index won't be needed again.  Reuse that component to hold the z index, thus saving
-    // some work in the multipole spreading.
+    for( unsigned int ii = 0; ii < _numParticles; ii++ ){
+
+        const IntVec& igrid = _iGrid[ii];
+        const RealOpenMM4* t = &_thetai[0][ii*_pmeOrder];
+        const RealOpenMM4* u = &_thetai[1][ii*_pmeOrder];
+        const RealOpenMM4* v = &_thetai[2][ii*_pmeOrder];
 
-    for( unsigned int ii = 0; ii < _numParticles; ii++) {
+        RealOpenMM charge = 0.0;
+        RealVec inducedDipole, inducedDipolePolar;
+        if( _spreadInducedDipole == NULL ){
+            charge = (*_spreadParticleData)[ii].charge;
+        } else {
+            for( unsigned int jj = 0; jj < 3; jj++ ){
+                inducedDipole[jj]      = scale[jj]*(*_spreadInducedDipole)[ii][jj];
+                inducedDipolePolar[jj] = realGrid ? 0.0 : scale[jj]*(*_spreadInducedDipolePolar)[ii][jj];
+            }
+        }
 
-        RealOpenMM posz           = particleData[_pmeAtomGridIndex[ii][0]].position[2];
-        posz                     -= FLOOR(posz*_invPeriodicBoxSize[2])*_periodicBoxSize[2];
-        RealOpenMM w              = posz*_invPeriodicBoxSize[2];
-        RealOpenMM fr             = _pmeGridDimensions[2]*(w-(int)(w+0.5)+0.5);
-        int z                     = (static_cast<int>(fr)) - MBPOL_PME_ORDER + 1;
-        _pmeAtomGridIndex[ii][1]  = z;
+        for( int ix = 0; ix < _pmeOrder; ix++ ){
+            int x = igrid[0] + ix;
+            x    -= (x < _pmeGridDimensions[0] ? 0 : _pmeGridDimensions[0]);
+            if( x < xBegin || x >= xEnd ){
+                continue;
+            }
+            for( int iy = 0; iy < _pmeOrder; iy++ ){
+                int y  = igrid[1] + iy;
+                y     -= (y < _pmeGridDimensions[1] ? 0 : _pmeGridDimensions[1]);
+                int rowIndex = x*gridSizeYZ + y*_pmeGridDimensions[2];
+                for( int iz = 0; iz < _pmeOrder; iz++ ){
+                    int z  = igrid[2] + iz;
+                    z     -= (z < _pmeGridDimensions[2] ? 0 : _pmeGridDimensions[2]);
+                    if( _spreadInducedDipole == NULL ){
+                        _pmeRealGrid[rowIndex+z] += charge*u[iy][0]*v[iz][0]*t[ix][0];
+                        continue;
+                    }
+                    RealOpenMM term01 = inducedDipole[1]*u[iy][1]*v[iz][0] + inducedDipole[2]*u[iy][0]*v[iz][1];
+                    RealOpenMM term11 = inducedDipole[0]*u[iy][0]*v[iz][0];
+                    if( realGrid ){
+                        _pmeRealGrid[rowIndex+z] += term01*t[ix][0] + term11*t[ix][1];
+                        continue;
+                    }
+                    RealOpenMM term02 = inducedDipolePolar[1]*u[iy][1]*v[iz][0] + inducedDipolePolar[2]*u[iy][0]*v[iz][1];
+                    RealOpenMM term12 = inducedDipolePolar[0]*u[iy][0]*v[iz][0];
+                    _pmeGrid[rowIndex+z].re += term01*t[ix][0] + term11*t[ix][1];
+                    _pmeGrid[rowIndex+z].im += term02*t[ix][0] + term12*t[ix][1];
+                }
+            }
+        }
     }
 
     return;
 }
 
-void MBPolReferencePmeElectrostaticsForce::getGridPointGivenGridIndex( int gridIndex, IntVec& gridPoint ) const
+void MBPolReferencePmeElectrostaticsForce::threadSpreadOntoGrid( OpenMM::ThreadPool& threads, int threadIndex )
 {
-
-    gridPoint[0]  = gridIndex/(_pmeGridDimensions[1]*_pmeGridDimensions[2]);
-    int remainder = gridIndex-gridPoint[0]*_pmeGridDimensions[1]*_pmeGridDimensions[2];
-    gridPoint[1]  = remainder/_pmeGridDimensions[2];
-    gridPoint[2]  = remainder-gridPoint[1]*_pmeGridDimensions[2];
-
-    return;
+    int numThreads = threads.getNumThreads();
+    spreadOntoGridSlab( (threadIndex*_pmeGridDimensions[0])/numThreads, ((threadIndex+1)*_pmeGridDimensions[0])/numThreads );
 }
 
-RealOpenMM MBPolReferencePmeElectrostaticsForce::computeFixedElectrostaticssGridValue( const vector<ElectrostaticsParticleData>& particleData,
-                                                                              const int2& particleGridIndices, const RealVec& scale,
-                                                                              int ix, int iy, const IntVec& gridPoint ) const
+void MBPolReferencePmeElectrostaticsForce::spreadOntoGrid( void )
 {
 
-    RealOpenMM gridValue = 0.0;
-    for (int i = _pmeAtomRange[particleGridIndices[0]]; i < _pmeAtomRange[particleGridIndices[1]+1]; ++i) {
-        int2 atomData = _pmeAtomGridIndex[i];
-        int atomIndex = atomData[0];
-        int z = atomData[1];
-        int iz = gridPoint[2]-z+(gridPoint[2] >= z ? 0 : _pmeGridDimensions[2]);
-        if( iz >= _pmeGridDimensions[2] ){
-            iz -= _pmeGridDimensions[2];
-        }
-
-        RealOpenMM atomCharge       = particleData[atomIndex].charge;
+    // with a thread pool every thread owns a slab of x planes, so the threads
+    // never write the same grid point and the sum matches the serial one
 
-        RealOpenMM4 t = _thetai[0][atomIndex*MBPOL_PME_ORDER+ix];
-        RealOpenMM4 u = _thetai[1][atomIndex*MBPOL_PME_ORDER+iy];
-        RealOpenMM4 v = _thetai[2][atomIndex*MBPOL_PME_ORDER+iz];
-        RealOpenMM term0 = atomCharge*u[0]*v[0];
-        gridValue += term0*t[0];
+    if( _threadPool == NULL || _threadPool->getNumThreads() < 2 ){
+        spreadOntoGridSlab( 0, _pmeGridDimensions[0] );
+        return;
     }
-    return gridValue;
+
+    SpreadTask task( *this );
+    _threadPool->execute( task );
+    _threadPool->waitForThreads();
+
+    return;
 }
 
 void MBPolReferencePmeElectrostaticsForce::spreadFixedElectrostaticssOntoGrid( const vector<ElectrostaticsParticleData>& particleData )
 {
-
-    RealVec scale;
-    getPmeScale( scale );
-
-    for (int gridIndex = 0; gridIndex < _totalGridSize; gridIndex++ ){
-
-        IntVec gridPoint;
-        getGridPointGivenGridIndex( gridIndex, gridPoint );
-
-        RealOpenMM result = 0.0;
-        for (int ix = 0; ix < MBPOL_PME_ORDER; ++ix)
-        {
-            int x = gridPoint[0]-ix+(gridPoint[0] >= ix ? 0 : _pmeGridDimensions[0]);
-            for (int iy = 0; iy < MBPOL_PME_ORDER; ++iy)
-            {
-                int y  = gridPoint[1]-iy+(gridPoint[1] >= iy ? 0 : _pmeGridDimensions[1]);
-                int z1 = gridPoint[2]-MBPOL_PME_ORDER+1;
-                z1    += (z1 >= 0 ? 0 : _pmeGridDimensions[2]);
-                int z2 = (z1 < gridPoint[2] ? gridPoint[2] : _pmeGridDimensions[2]-1);
-
-                int2 particleGridIndices;
-                particleGridIndices[0]  = x*_pmeGridDimensions[1]*_pmeGridDimensions[2]+y*_pmeGridDimensions[2]+z1;
-                particleGridIndices[1]  = x*_pmeGridDimensions[1]*_pmeGridDimensions[2]+y*_pmeGridDimensions[2]+z2;
-                result                 += computeFixedElectrostaticssGridValue( particleData, particleGridIndices, scale, ix, iy, gridPoint );
-
-                if (z1 > gridPoint[2]){
-
-                    particleGridIndices[0]  = x*_pmeGridDimensions[1]*_pmeGridDimensions[2]+y*_pmeGridDimensions[2];
-                    particleGridIndices[1]  = x*_pmeGridDimensions[1]*_pmeGridDimensions[2]+y*_pmeGridDimensions[2]+gridPoint[2];
-                    result                 += computeFixedElectrostaticssGridValue( particleData, particleGridIndices, scale, ix, iy, gridPoint );
-                }
-            }
-        }
-        _pmeGrid[gridIndex].re = result;
-    }
+    _spreadParticleData       = &particleData;
+    _spreadInducedDipole      = NULL;
+    _spreadInducedDipolePolar = NULL;
+    spreadOntoGrid();
     return;
 }
 
-void MBPolReferencePmeElectrostaticsForce::performMBPolReciprocalConvolution( void )
+void MBPolReferencePmeElectrostaticsForce::performMBPolReciprocalConvolution( int gridSizeZ )
 {
 
     RealOpenMM expFactor   = (M_PI*M_PI)/(_alphaEwald*_alphaEwald);
     RealOpenMM scaleFactor = 1.0/(M_PI*_periodicBoxSize[0]*_periodicBoxSize[1]*_periodicBoxSize[2]);
 
-    for (int index = 0; index < _totalGridSize; index++)
+    int numPoints = _pmeGridDimensions[0]*_pmeGridDimensions[1]*gridSizeZ;
+    for (int index = 0; index < numPoints; index++)
     {
-        int kx = index/(_pmeGridDimensions[1]*_pmeGridDimensions[2]);
-        int remainder = index-kx*_pmeGridDimensions[1]*_pmeGridDimensions[2];
-        int ky = remainder/_pmeGridDimensions[2];
-        int kz = remainder-ky*_pmeGridDimensions[2];
+        int kx = index/(_pmeGridDimensions[1]*gridSizeZ);
+        int remainder = index-kx*_pmeGridDimensions[1]*gridSizeZ;
+        int ky = remainder/gridSizeZ;
+        int kz = remainder-ky*gridSizeZ;
 
         if (kx == 0 && ky == 0 && kz == 0){
             _pmeGrid[index].re = _pmeGrid[index].im = 0.0;
@@ -1738,9 +2894,9 @@ void MBPolReferencePmeElectrostaticsForce::computeFixedPotentialFromGrid( void )
         RealOpenMM tuv102 = 0.0;
         RealOpenMM tuv012 = 0.0;
         RealOpenMM tuv111 = 0.0;
-        for (int iz = 0; iz < MBPOL_PME_ORDER; iz++) {
+        for (int iz = 0; iz < _pmeOrder; iz++) {
             int k = gridPoint[2]+iz-(gridPoint[2]+iz >= _pmeGridDimensions[2] ? _pmeGridDimensions[2] : 0);
-            RealOpenMM4 v = _thetai[2][m*MBPOL_PME_ORDER+iz];
+            RealOpenMM4 v = _thetai[2][m*_pmeOrder+iz];
             RealOpenMM tu00 = 0.0;
             RealOpenMM tu10 = 0.0;
             RealOpenMM tu01 = 0.0;
@@ -1751,15 +2907,15 @@ void MBPolReferencePmeElectrostaticsForce::computeFixedPotentialFromGrid( void )
             RealOpenMM tu21 = 0.0;
             RealOpenMM tu12 = 0.0;
             RealOpenMM tu03 = 0.0;
-            for (int iy = 0; iy < MBPOL_PME_ORDER; iy++) {
+            for (int iy = 0; iy < _pmeOrder; iy++) {
                 int j = gridPoint[1]+iy-(gridPoint[1]+iy >= _pmeGridDimensions[1] ? _pmeGridDimensions[1] : 0);
-                RealOpenMM4 u = _thetai[1][m*MBPOL_PME_ORDER+iy];
+                RealOpenMM4 u = _thetai[1][m*_pmeOrder+iy];
                 RealOpenMM4 t = RealOpenMM4(0.0, 0.0, 0.0, 0.0);
-                for (int ix = 0; ix < MBPOL_PME_ORDER; ix++) {
+                for (int ix = 0; ix < _pmeOrder; ix++) {
                     int i = gridPoint[0]+ix-(gridPoint[0]+ix >= _pmeGridDimensions[0] ? _pmeGridDimensions[0] : 0);
                     int gridIndex = i*_pmeGridDimensions[1]*_pmeGridDimensions[2] + j*_pmeGridDimensions[2] + k;
-                    RealOpenMM tq = _pmeGrid[gridIndex].re;
-                    RealOpenMM4 tadd = _thetai[0][m*MBPOL_PME_ORDER+ix];
+                    RealOpenMM tq = _pmeRealGrid[gridIndex];
+                    RealOpenMM4 tadd = _thetai[0][m*_pmeOrder+ix];
                     t[0] += tq*tadd[0];
                     t[1] += tq*tadd[1];
                     t[2] += tq*tadd[2];
@@ -1820,90 +2976,36 @@ void MBPolReferencePmeElectrostaticsForce::computeFixedPotentialFromGrid( void )
     }
 }
 
-t_complex MBPolReferencePmeElectrostaticsForce::computeInducedDipoleGridValue( const int2& particleGridIndices, const RealVec& scale, int ix, int iy,
-                                                                           const IntVec& gridPoint,
-                                                                           const std::vector<RealVec>& inputInducedDipole,
-                                                                           const std::vector<RealVec>& inputInducedDipolePolar ) const
+void MBPolReferencePmeElectrostaticsForce::spreadInducedDipolesOnGrid( const std::vector<RealVec>& inputInducedDipole,
+                                                                   const std::vector<RealVec>& inputInducedDipolePolar )
 {
-
-
-    // loop over particles contributing to this grid point
-
-    t_complex gridValue;
-    gridValue.re = gridValue.im = 0.0;
-
-    for (int i = _pmeAtomRange[particleGridIndices[0]]; i < _pmeAtomRange[particleGridIndices[1]+1]; ++i){
-        int2 atomData = _pmeAtomGridIndex[i];
-        int atomIndex = atomData[0];
-        int z = atomData[1];
-        int iz = gridPoint[2]-z+(gridPoint[2] >= z ? 0 : _pmeGridDimensions[2]);
-        if( iz >= _pmeGridDimensions[2] ){
-            iz -= _pmeGridDimensions[2];
-        }
-        RealVec inducedDipole       = RealVec( scale[0]*inputInducedDipole[atomIndex][0],
-                                               scale[1]*inputInducedDipole[atomIndex][1],
-                                               scale[2]*inputInducedDipole[atomIndex][2] );
-
-        RealVec inducedDipolePolar  = RealVec( scale[0]*inputInducedDipolePolar[atomIndex][0],
-                                               scale[1]*inputInducedDipolePolar[atomIndex][1],
-                                               scale[2]*inputInducedDipolePolar[atomIndex][2] );
-
-        RealOpenMM4 t = _thetai[0][atomIndex*MBPOL_PME_ORDER+ix];
-        RealOpenMM4 u = _thetai[1][atomIndex*MBPOL_PME_ORDER+iy];
-        RealOpenMM4 v = _thetai[2][atomIndex*MBPOL_PME_ORDER+iz];
-
-        RealOpenMM term01 = inducedDipole[1]*u[1]*v[0] + inducedDipole[2]*u[0]*v[1];
-        RealOpenMM term11 = inducedDipole[0]*u[0]*v[0];
-        RealOpenMM term02 = inducedDipolePolar[1]*u[1]*v[0] + inducedDipolePolar[2]*u[0]*v[1];
-        RealOpenMM term12 = inducedDipolePolar[0]*u[0]*v[0];
-
-        gridValue.re += term01*t[0] + term11*t[1];
-        gridValue.im += term02*t[0] + term12*t[1];
-
-    }
-    return gridValue;
+    _spreadInducedDipole      = &inputInducedDipole;
+    _spreadInducedDipolePolar = (&inputInducedDipole == &inputInducedDipolePolar ? NULL : &inputInducedDipolePolar);
+    spreadOntoGrid();
+    return;
 }
 
-void MBPolReferencePmeElectrostaticsForce::spreadInducedDipolesOnGrid( const std::vector<RealVec>& inputInducedDipole,
-                                                                   const std::vector<RealVec>& inputInducedDipolePolar )
+void MBPolReferencePmeElectrostaticsForce::computeInducedDipolePotentials( const std::vector<RealVec>& inputInducedDipole,
+                                                                           const std::vector<RealVec>& inputInducedDipolePolar )
 {
-    RealVec scale;
-    getPmeScale( scale );
+    spreadInducedDipolesOnGrid( inputInducedDipole, inputInducedDipolePolar );
+    if( &inputInducedDipole == &inputInducedDipolePolar ){
 
-    for (int gridIndex = 0; gridIndex < _totalGridSize; gridIndex++ )
-    {
-        IntVec gridPoint;
-        getGridPointGivenGridIndex( gridIndex, gridPoint );
-
-        t_complex gridValue;
-        gridValue.re  = gridValue.im = 0.0;
-
-        for (int ix = 0; ix < MBPOL_PME_ORDER; ++ix)
-        {
-            int x = gridPoint[0]-ix+(gridPoint[0] >= ix ? 0 : _pmeGridDimensions[0]);
-            for (int iy = 0; iy < MBPOL_PME_ORDER; ++iy)
-            {
-                int y   = gridPoint[1]-iy+(gridPoint[1] >= iy ? 0 : _pmeGridDimensions[1]);
-                int z1  = gridPoint[2]-MBPOL_PME_ORDER+1;
-                z1     += (z1 >= 0 ? 0 : _pmeGridDimensions[2]);
-                int z2  = (z1 < gridPoint[2] ? gridPoint[2] : _pmeGridDimensions[2]-1);
-
-                int2 particleGridIndices;
-                particleGridIndices[0] = x*_pmeGridDimensions[1]*_pmeGridDimensions[2]+y*_pmeGridDimensions[2]+z1;
-                particleGridIndices[1] = x*_pmeGridDimensions[1]*_pmeGridDimensions[2]+y*_pmeGridDimensions[2]+z2;
-                gridValue             += computeInducedDipoleGridValue( particleGridIndices, scale, ix, iy, gridPoint, inputInducedDipole, inputInducedDipolePolar );
-
-                if (z1 > gridPoint[2])
-                {
-                    particleGridIndices[0]  =  x*_pmeGridDimensions[1]*_pmeGridDimensions[2]+y*_pmeGridDimensions[2];
-                    particleGridIndices[1]  =  x*_pmeGridDimensions[1]*_pmeGridDimensions[2]+y*_pmeGridDimensions[2]+gridPoint[2];
-                    gridValue              +=  computeInducedDipoleGridValue( particleGridIndices, scale, ix, iy, gridPoint, inputInducedDipole, inputInducedDipolePolar );
-                }
-            }
+        // a lone set takes the real transform; its potential then fills both
+        // parts of _pmeGrid for computeInducedPotentialFromGrid()
+
+        _fft->transformRealToComplex( &_pmeRealGrid[0], _pmeGrid );
+        performMBPolReciprocalConvolution( _fft->getComplexSizeZ() );
+        _fft->transformComplexToReal( _pmeGrid, &_pmeRealGrid[0] );
+        for( int ii = 0; ii < _totalGridSize; ii++ ){
+            _pmeGrid[ii].re = _pmeGrid[ii].im = _pmeRealGrid[ii];
         }
-        _pmeGrid[gridIndex] = gridValue;
+    } else {
+        _fft->transformComplex( _pmeGrid, true );
+        performMBPolReciprocalConvolution( _pmeGridDimensions[2] );
+        _fft->transformComplex( _pmeGrid, false );
     }
-
+    computeInducedPotentialFromGrid();
     return;
 }
 
@@ -1951,9 +3053,9 @@ void MBPolReferencePmeElectrostaticsForce::computeInducedPotentialFromGrid( void
         RealOpenMM tuv102 = 0.0;
         RealOpenMM tuv012 = 0.0;
         RealOpenMM tuv111 = 0.0;
-        for (int iz = 0; iz < MBPOL_PME_ORDER; iz++) {
+        for (int iz = 0; iz < _pmeOrder; iz++) {
             int k = gridPoint[2]+iz-(gridPoint[2]+iz >= _pmeGridDimensions[2] ? _pmeGridDimensions[2] : 0);
-            RealOpenMM4 v = _thetai[2][m*MBPOL_PME_ORDER+iz];
+            RealOpenMM4 v = _thetai[2][m*_pmeOrder+iz];
             RealOpenMM tu00_1 = 0.0;
             RealOpenMM tu01_1 = 0.0;
             RealOpenMM tu10_1 = 0.0;
@@ -1976,9 +3078,9 @@ void MBPolReferencePmeElectrostaticsForce::computeInducedPotentialFromGrid( void
             RealOpenMM tu21 = 0.0;
             RealOpenMM tu12 = 0.0;
             RealOpenMM tu03 = 0.0;
-            for (int iy = 0; iy < MBPOL_PME_ORDER; iy++) {
+            for (int iy = 0; iy < _pmeOrder; iy++) {
                 int j = gridPoint[1]+iy-(gridPoint[1]+iy >= _pmeGridDimensions[1] ? _pmeGridDimensions[1] : 0);
-                RealOpenMM4 u = _thetai[1][m*MBPOL_PME_ORDER+iy];
+                RealOpenMM4 u = _thetai[1][m*_pmeOrder+iy];
                 RealOpenMM t0_1 = 0.0;
                 RealOpenMM t1_1 = 0.0;
                 RealOpenMM t2_1 = 0.0;
@@ -1986,11 +3088,11 @@ void MBPolReferencePmeElectrostaticsForce::computeInducedPotentialFromGrid( void
                 RealOpenMM t1_2 = 0.0;
                 RealOpenMM t2_2 = 0.0;
                 RealOpenMM t3 = 0.0;
-                for (int ix = 0; ix < MBPOL_PME_ORDER; ix++) {
+                for (int ix = 0; ix < _pmeOrder; ix++) {
                     int i = gridPoint[0]+ix-(gridPoint[0]+ix >= _pmeGridDimensions[0] ? _pmeGridDimensions[0] : 0);
                     int gridIndex = i*_pmeGridDimensions[1]*_pmeGridDimensions[2] + j*_pmeGridDimensions[2] + k;
                     t_complex tq = _pmeGrid[gridIndex];
-                    RealOpenMM4 tadd = _thetai[0][m*MBPOL_PME_ORDER+ix];
+                    RealOpenMM4 tadd = _thetai[0][m*_pmeOrder+ix];
                     t0_1 += tq.re*tadd[0];
                     t1_1 += tq.re*tadd[1];
                     t2_1 += tq.re*tadd[2];
@@ -2113,7 +3215,7 @@ void MBPolReferencePmeElectrostaticsForce::computeInducedPotentialFromGrid( void
 RealOpenMM MBPolReferencePmeElectrostaticsForce::computeReciprocalSpaceFixedElectrostaticsForceAndEnergy( const std::vector<ElectrostaticsParticleData>& particleData,
                                                                                                  std::vector<RealVec>& forces, std::vector<RealOpenMM>& electrostaticPotential ) const
 {
-    RealOpenMM multipole[10];
+    RealOpenMM multipole[10] = { 0.0 };
     const int deriv1[] = {1, 4, 7, 8, 10, 15, 17, 13, 14, 19};
     const int deriv2[] = {2, 7, 5, 9, 13, 11, 18, 15, 19, 16};
     const int deriv3[] = {3, 8, 9, 6, 14, 16, 12, 19, 17, 18};
@@ -2128,6 +3230,11 @@ RealOpenMM MBPolReferencePmeElectrostaticsForce::computeReciprocalSpaceFixedElec
 
         const RealOpenMM* phi = &_phi[20*i];
 
+        if( !_includeForces ){
+            energy += multipole[0]*phi[0];
+            continue;
+        }
+
         electrostaticPotential[i] += phi[0] ; // /2.;
 
         RealVec f = RealVec( 0.0, 0.0, 0.0);
@@ -2187,7 +3294,7 @@ RealOpenMM MBPolReferencePmeElectrostaticsForce::computeReciprocalSpaceInducedDi
                                                                                                 std::vector<RealVec>& forces, std::vector<RealOpenMM>& electrostaticPotential) const
 {
 
-    RealOpenMM multipole[10];
+    RealOpenMM multipole[10] = { 0.0 };
     RealOpenMM inducedDipole[3];
     RealOpenMM inducedDipolePolar[3];
     RealOpenMM scales[3];
@@ -2217,6 +3324,10 @@ RealOpenMM MBPolReferencePmeElectrostaticsForce::computeReciprocalSpaceInducedDi
         energy += scale[1]*inducedDipole[1]*_phi[20*i+2];
         energy += scale[2]*inducedDipole[2]*_phi[20*i+3];
 
+        if( !_includeForces ){
+            continue;
+        }
+
         electrostaticPotential[i] += .5* _phidp[20*i];
 
         RealVec f        = RealVec(0.0, 0.0, 0.0 );
@@ -2264,6 +3375,111 @@ RealOpenMM MBPolReferencePmeElectrostaticsForce::computeReciprocalSpaceInducedDi
     return (0.5*_electric*energy);
 }
 
+void MBPolReferencePmeElectrostaticsForce::calculateInducedDipoleForces( const std::vector<ElectrostaticsParticleData>& particleData,
+                                                                         const std::vector<RealVec>& inducedDipole,
+                                                                         const std::vector<RealVec>& inducedDipolePolar,
+                                                                         std::vector<RealVec>& forces )
+{
+
+    // direct space
+
+    this->MBPolReferenceElectrostaticsForce::calculateInducedDipoleForces( particleData, inducedDipole, inducedDipolePolar, forces );
+
+    // reciprocal space: the induced dipole - induced dipole terms of computeReciprocalSpaceInducedDipoleForceAndEnergy()
+    // for the potentials due these dipoles
+
+    computeInducedDipolePotentials( inducedDipole, inducedDipolePolar );
+
+    const int deriv1[] = {1, 4, 7, 8, 10, 15, 17, 13, 14, 19};
+    const int deriv2[] = {2, 7, 5, 9, 13, 11, 18, 15, 19, 16};
+    const int deriv3[] = {3, 8, 9, 6, 14, 16, 12, 19, 17, 18};
+    RealVec scale;
+    getPmeScale( scale );
+    for( unsigned int i = 0; i < _numParticles; i++ ){
+        RealVec f = RealVec( 0.0, 0.0, 0.0 );
+        for( int k = 0; k < 3; k++ ){
+            int j1 = deriv1[k+1];
+            int j2 = deriv2[k+1];
+            int j3 = deriv3[k+1];
+            f[0] += (inducedDipole[i][k]*_phip[10*i+j1] + inducedDipolePolar[i][k]*_phid[10*i+j1])*(scale[k]*scale[0]);
+            f[1] += (inducedDipole[i][k]*_phip[10*i+j2] + inducedDipolePolar[i][k]*_phid[10*i+j2])*(scale[k]*scale[1]);
+            f[2] += (inducedDipole[i][k]*_phip[10*i+j3] + inducedDipolePolar[i][k]*_phid[10*i+j3])*(scale[k]*scale[2]);
+        }
+        forces[particleData[i].particleIndex] -= f*(0.5*_electric);
+    }
+    return;
+}
+
+void MBPolReferencePmeElectrostaticsForce::calculateInducedDipolePairForce( const std::vector<ElectrostaticsParticleData>& particleData,
+                                                                            unsigned int iIndex, unsigned int jIndex,
+                                                                            const std::vector<RealVec>& inducedDipole,
+                                                                            const std::vector<RealVec>& inducedDipolePolar,
+                                                                            std::vector<RealVec>& forces ) const
+{
+
+    // the induced dipole - induced dipole terms of calculatePmeDirectElectrostaticPairIxn()
+
+    const ElectrostaticsParticleData& particleI = particleData[iIndex];
+    const ElectrostaticsParticleData& particleJ = particleData[jIndex];
+
+    RealVec deltaR   = particleJ.position - particleI.position;
+    getPeriodicDelta( deltaR );
+    RealOpenMM r2    = deltaR.dot( deltaR );
+
+    if( r2 > _cutoffDistanceSquared )return;
+
+    RealOpenMM r      = SQRT(r2);
+
+    // real space error function terms
+
+    RealOpenMM ralpha = _alphaEwald*r;
+    RealOpenMM bn0    = erfc(ralpha)/r;
+
+    RealOpenMM alsq2  = 2.0*_alphaEwald*_alphaEwald;
+    RealOpenMM alsq2n = 0.0;
+    if( _alphaEwald > 0.0 ){
+        alsq2n = 1.0/(SQRT_PI*_alphaEwald);
+    }
+    RealOpenMM exp2a  = EXP(-(ralpha*ralpha));
+
+    alsq2n           *= alsq2;
+    RealOpenMM bn1    = (bn0+alsq2n*exp2a)/r2;
+
+    alsq2n           *= alsq2;
+    RealOpenMM bn2    = (3.0*bn1+alsq2n*exp2a)/r2;
+
+    alsq2n           *= alsq2;
+    RealOpenMM bn3    = (5.0*bn2+alsq2n*exp2a)/r2;
+
+    RealOpenMM rr3    = 1.0/(r*r2);
+    RealOpenMM rr5    = 3.0*rr3/r2;
+    RealOpenMM rr7    = 5.0*rr5/r2;
+
+    RealOpenMM sci3  = inducedDipole[iIndex].dot(deltaR);
+    RealOpenMM sci4  = inducedDipole[jIndex].dot(deltaR);
+    RealOpenMM scip2 = inducedDipole[iIndex].dot(inducedDipolePolar[jIndex])
+                     + inducedDipolePolar[iIndex].dot(inducedDipole[jIndex]);
+    RealOpenMM scip3 = inducedDipolePolar[iIndex].dot(deltaR);
+    RealOpenMM scip4 = inducedDipolePolar[jIndex].dot(deltaR);
+
+    RealOpenMM scale5DD = getAndScaleInverseRs(particleI,particleJ,r,true,5,TDD);
+    RealOpenMM scale7DD = getAndScaleInverseRs(particleI,particleJ,r,true,7,TDD);
+
+    RealVec dipoleTerms = inducedDipolePolar[iIndex]*sci4 + inducedDipole[iIndex]*scip4
+                        + inducedDipolePolar[jIndex]*sci3 + inducedDipole[jIndex]*scip3;
+
+    // with screening, less the part without screening
+
+    RealOpenMM gfi1  = 0.5*(bn2*scip2 - bn3*(sci3*scip4+scip3*sci4));
+    RealOpenMM gfri1 = 0.5*(rr5*scip2*(1 - scale5DD) - rr7*(sci3*scip4+scip3*sci4)*(1 - scale7DD));
+
+    RealVec ftm2i    = deltaR*(gfi1 - gfri1) + dipoleTerms*(0.5*(bn2 - rr5*(1 - scale5DD)));
+    ftm2i           *= (_electric/_dielectric);
+
+    forces[iIndex]  -= ftm2i;
+    forces[jIndex]  += ftm2i;
+}
+
 void MBPolReferencePmeElectrostaticsForce::recordFixedElectrostaticsField( void )
 {
     RealVec scale;
@@ -2277,24 +3493,42 @@ void MBPolReferencePmeElectrostaticsForce::recordFixedElectrostaticsField( void
     return;
 }
 
-void MBPolReferencePmeElectrostaticsForce::precomputeScale35( const std::vector<ElectrostaticsParticleData>& particleData, RealOpenMM * scale3, RealOpenMM * scale5 )
+void MBPolReferencePmeElectrostaticsForce::buildPairList( const std::vector<ElectrostaticsParticleData>& particleData )
 {
-    // Precompute scale3 and scale5
-    int xx = 0;
-    for( unsigned int ii = 0; ii < particleData.size(); ii++ ){
-        for( unsigned int jj = ii+1; jj < particleData.size(); jj++ ){
-	    RealVec deltaR    = particleData[jj].position - particleData[ii].position;
-
-	    getPeriodicDelta( deltaR );
-	    RealOpenMM r2     = deltaR.dot( deltaR );
+    // the pair interactions beyond the cutoff vanish, so only the pairs within it are listed
 
-	    RealOpenMM r           = SQRT(r2);
-
-	    scale3[xx] = getAndScaleInverseRs(particleData[ii], particleData[jj], r, true, 3, TDD);
-	    scale5[xx] = getAndScaleInverseRs(particleData[ii], particleData[jj], r, true, 5, TDD);
-        xx++;
+    unsigned int numParticles = particleData.size();
+    _cutoffNeighborPositions.resize( numParticles );
+    for( unsigned int ii = 0; ii < numParticles; ii++ ){
+        _cutoffNeighborPositions[ii] = particleData[ii].position;
+    }
+    _cutoffNeighbors.build( numParticles, _cutoffNeighborPositions, _periodicBoxSize, true, _cutoffDistance, 0.0, _threadPool );
+
+    _pairStart.resize( numParticles + 1 );
+    _pairNeighbors.clear();
+    for( unsigned int ii = 0; ii < numParticles; ii++ ){
+        _pairStart[ii] = _pairNeighbors.size();
+        for( int kk = _cutoffNeighbors.neighborStart[ii]; kk < _cutoffNeighbors.neighborStart[ii+1]; kk++ ){
+            if( _cutoffNeighbors.neighbors[kk] > ii ){
+                _pairNeighbors.push_back( _cutoffNeighbors.neighbors[kk] );
+            }
         }
     }
+    _pairStart[numParticles] = _pairNeighbors.size();
+}
+
+void MBPolReferencePmeElectrostaticsForce::getScale35( const ElectrostaticsParticleData& particleI, const ElectrostaticsParticleData& particleJ,
+                                                       RealOpenMM& scale3, RealOpenMM& scale5 ) const
+{
+    RealVec deltaR    = particleJ.position - particleI.position;
+
+    getPeriodicDelta( deltaR );
+    RealOpenMM r2     = deltaR.dot( deltaR );
+
+    RealOpenMM r           = SQRT(r2);
+
+    scale3 = getAndScaleInverseRs(particleI, particleJ, r, true, 3, TDD);
+    scale5 = getAndScaleInverseRs(particleI, particleJ, r, true, 5, TDD);
 }
 
 void MBPolReferencePmeElectrostaticsForce::initializeInducedDipoles( std::vector<UpdateInducedDipoleFieldStruct>& updateInducedDipoleFields )
@@ -2325,28 +3559,28 @@ void MBPolReferencePmeElectrostaticsForce::recordInducedDipoleField( vector<Real
 
 void MBPolReferencePmeElectrostaticsForce::calculateReciprocalSpaceInducedDipoleField( std::vector<UpdateInducedDipoleFieldStruct>& updateInducedDipoleFields )
 {
-    // Perform PME for the induced dipoles.
-
-    initializePmeGrid();
-    spreadInducedDipolesOnGrid( *(updateInducedDipoleFields[0].inducedDipoles), *(updateInducedDipoleFields[1].inducedDipoles) );
-    fftpack_exec_3d( _fftplan, FFTPACK_FORWARD, _pmeGrid, _pmeGrid);
-    performMBPolReciprocalConvolution();
-    fftpack_exec_3d( _fftplan, FFTPACK_BACKWARD, _pmeGrid, _pmeGrid);
-    computeInducedPotentialFromGrid();
-    recordInducedDipoleField( updateInducedDipoleFields[0].inducedDipoleField, updateInducedDipoleFields[1].inducedDipoleField );
+    // Perform PME for the induced dipoles, two sets at a time.
+
+    unsigned int numSets = updateInducedDipoleFields.size();
+    for( int kk = 2*((numSets - 1)/2); kk >= 0; kk -= 2 ){
+        UpdateInducedDipoleFieldStruct& first  = updateInducedDipoleFields[kk];
+        UpdateInducedDipoleFieldStruct& second = updateInducedDipoleFields[kk + 1 < static_cast<int>(numSets) ? kk + 1 : kk];
+        std::vector<RealVec> unusedField;
+        computeInducedDipolePotentials( *(first.inducedDipoles), *(second.inducedDipoles) );
+        if( &first == &second ){
+            unusedField.resize( _numParticles );
+            recordInducedDipoleField( first.inducedDipoleField, unusedField );
+        } else {
+            recordInducedDipoleField( first.inducedDipoleField, second.inducedDipoleField );
+        }
+    }
 }
 
 void MBPolReferencePmeElectrostaticsForce::calculateInducedDipoleFields( const std::vector<ElectrostaticsParticleData>& particleData,
-                                                                     std::vector<UpdateInducedDipoleFieldStruct>& updateInducedDipoleFields, const RealOpenMM scale3[], const RealOpenMM scale5[])
+                                                                     std::vector<UpdateInducedDipoleFieldStruct>& updateInducedDipoleFields )
 {
 
-    unsigned int xx = 0;
-    for( unsigned int ii = 0; ii < particleData.size(); ii++ ){
-        for( unsigned int jj = ii + 1; jj < particleData.size(); jj++ ){
-            calculateDirectInducedDipolePairIxns( particleData[ii], particleData[jj], updateInducedDipoleFields, scale3[xx], scale5[xx] );
-            xx++;
-        }
-    }
+    calculateDirectInducedDipoleFields( particleData, updateInducedDipoleFields );
 
 // FIXME segfault!   // reciprocal space ixns
 
@@ -2386,23 +3620,23 @@ void MBPolReferencePmeElectrostaticsForce::calculateDirectInducedDipolePairIxn(
     return;
 }
 
-void MBPolReferencePmeElectrostaticsForce::calculateDirectInducedDipolePairIxns( const ElectrostaticsParticleData& particleI,
-                                                                             const ElectrostaticsParticleData& particleJ,
-                                                                             std::vector<UpdateInducedDipoleFieldStruct>& updateInducedDipoleFields,
-RealOpenMM scale3, RealOpenMM scale5 )
+bool MBPolReferencePmeElectrostaticsForce::getInducedDipoleFieldFactors( const ElectrostaticsParticleData& particleI,
+                                                                         const ElectrostaticsParticleData& particleJ,
+                                                                         RealOpenMM scale3, RealOpenMM scale5, RealVec& deltaR,
+                                                                         RealOpenMM& preFactor1, RealOpenMM& preFactor2 ) const
 {
 
     // compute the real space portion of the Ewald summation
 
     RealOpenMM uscale = 1.0;
-    RealVec deltaR    = particleJ.position - particleI.position;
+    deltaR            = particleJ.position - particleI.position;
 
     // periodic boundary conditions
 
     getPeriodicDelta( deltaR );
     RealOpenMM r2     = deltaR.dot( deltaR );
 
-    if( r2 > _cutoffDistanceSquared )return;
+    if( r2 > _cutoffDistanceSquared )return false;
 
     RealOpenMM r           = SQRT(r2);
 
@@ -2449,16 +3683,21 @@ RealOpenMM scale3, RealOpenMM scale5 )
     RealOpenMM rr3         = (1.0-dsc3)/r3;
     RealOpenMM rr5         = 3.0*(1.0-dsc5)/r5;
 
-    RealOpenMM preFactor1  = rr3 - bn1;
-    RealOpenMM preFactor2  = bn2 - rr5;
+    preFactor1             = rr3 - bn1;
+    preFactor2             = bn2 - rr5;
 
+    return true;
+}
 
-	//if ((particleI.particleIndex==0) & ((particleJ.particleIndex==7) | (particleJ.particleIndex==8)))
-	//{
-    //    printf("preFactor1 %.8g\n", preFactor1);
-    //    printf("preFactor2 %.8g\n", preFactor2);
-    //    printf("r %.8g\n", r);
-	//}
+void MBPolReferencePmeElectrostaticsForce::calculateInducedDipolePairIxns( const ElectrostaticsParticleData& particleI,
+                                                                             const ElectrostaticsParticleData& particleJ,
+                                                                             std::vector<UpdateInducedDipoleFieldStruct>& updateInducedDipoleFields,
+RealOpenMM scale3, RealOpenMM scale5 )
+{
+
+    RealVec deltaR;
+    RealOpenMM preFactor1, preFactor2;
+    if( !getInducedDipoleFieldFactors( particleI, particleJ, scale3, scale5, deltaR, preFactor1, preFactor2 ) )return;
 
     for( unsigned int ii = 0; ii < updateInducedDipoleFields.size(); ii++ ){
         calculateDirectInducedDipolePairIxn( particleI.particleIndex, particleJ.particleIndex, preFactor1, preFactor2, deltaR,
@@ -2615,6 +3854,10 @@ RealOpenMM MBPolReferencePmeElectrostaticsForce::calculatePmeDirectElectrostatic
     energy              = (e + ei);
 
     RealOpenMM conversionFactor  = (_electric/_dielectric);
+
+    if( !_includeForces ){
+        return energy*conversionFactor;
+    }
 	//if ((particleI.particleIndex == 0) & (particleJ.particleIndex == 3))
 	//printf("Energy [%d, %d] %g Kcal\n", particleI.particleIndex, particleJ.particleIndex, (energy/2 ) / 4.184 * conversionFactor);
 	//printf("Energy [%d, %d] %.3f Kcal\n", particleI.particleIndex, particleJ.particleIndex, ralpha);
@@ -2715,6 +3958,14 @@ RealOpenMM MBPolReferencePmeElectrostaticsForce::calculatePmeDirectElectrostatic
 
 }
 
+RealOpenMM MBPolReferencePmeElectrostaticsForce::calculateDirectElectrostaticPairIxn( const std::vector<ElectrostaticsParticleData>& particleData,
+                                                                                  unsigned int iIndex, unsigned int jIndex,
+                                                                                  std::vector<RealVec>& forces,
+                                                                                  std::vector<RealOpenMM>& electrostaticPotential ) const
+{
+    return calculatePmeDirectElectrostaticPairIxn( particleData, iIndex, jIndex, forces, electrostaticPotential );
+}
+
 RealOpenMM MBPolReferencePmeElectrostaticsForce::calculateElectrostatic( const std::vector<ElectrostaticsParticleData>& particleData,
                                                                      std::vector<RealVec>& forces )
 {
@@ -2732,13 +3983,7 @@ RealOpenMM MBPolReferencePmeElectrostaticsForce::calculateElectrostatic( const s
     }
     // loop over particle pairs for direct space interactions
 
-    for( unsigned int ii = 0; ii < particleData.size(); ii++ ){
-        for( unsigned int jj = ii+1; jj < particleData.size(); jj++ ){
-
-            energy += calculatePmeDirectElectrostaticPairIxn( particleData, ii, jj, forces, electrostaticPotentialDirect );
-
-        }
-    }
+    energy += calculateDirectElectrostatic( particleData, forces, electrostaticPotentialDirect );
 
     printPotential (electrostaticPotentialDirect, energy ,"Direct Space", particleData);
 
@@ -2764,6 +4009,10 @@ RealOpenMM MBPolReferencePmeElectrostaticsForce::calculateElectrostatic( const s
 
     printPotential (electrostaticPotentialDirect, energy, "Total", particleData);
 
+    if( !_includeForces ){
+        return energy;
+    }
+
     for( unsigned int ii = 0; ii < particleData.size(); ii++ ){
         for( unsigned int s = 0; s < 3; s++ ){
             for( unsigned int xyz = 0; xyz < 3; xyz++ ){
@@ -2991,6 +4240,30 @@ void MBPolReferenceElectrostaticsForce::computeWaterCharge(
     particleH2.charge = chargeH2 + gamma2div1*(chargeH1 + chargeH2);
     particleM.charge = chargeO/gamma1;
 
+    // TODO implement as list
+
+    particleH1.otherSiteIndex[vsH1f] = particleH1.particleIndex;
+    particleH1.otherSiteIndex[vsH2f] = particleH2.particleIndex;
+    particleH1.otherSiteIndex[vsMf]  = particleM.particleIndex;
+
+    particleH2.otherSiteIndex[vsH1f] = particleH1.particleIndex;
+    particleH2.otherSiteIndex[vsH2f] = particleH2.particleIndex;
+    particleH2.otherSiteIndex[vsMf]  = particleM.particleIndex;
+
+    particleM.otherSiteIndex[vsH1f] = particleH1.particleIndex;
+    particleM.otherSiteIndex[vsH2f] = particleH2.particleIndex;
+    particleM.otherSiteIndex[vsMf]  = particleM.particleIndex;
+
+    particleO.otherSiteIndex[vsH1f] = particleH1.particleIndex;
+    particleO.otherSiteIndex[vsH2f] = particleH2.particleIndex;
+    particleO.otherSiteIndex[vsMf]  = particleM.particleIndex;
+
+    // the charge derivatives are only needed for the forces
+
+    if( !_includeForces ){
+        return;
+    }
+
     dp1dr1 /= xx;
     dp1dr2 /= xx;
     dp2dr1 /= xx;
@@ -3074,23 +4347,4 @@ void MBPolReferenceElectrostaticsForce::computeWaterCharge(
         }
 
     }
-
-    // TODO implement as list
-
-    particleH1.otherSiteIndex[vsH1f] = particleH1.particleIndex;
-    particleH1.otherSiteIndex[vsH2f] = particleH2.particleIndex;
-    particleH1.otherSiteIndex[vsMf]  = particleM.particleIndex;
-
-    particleH2.otherSiteIndex[vsH1f] = particleH1.particleIndex;
-    particleH2.otherSiteIndex[vsH2f] = particleH2.particleIndex;
-    particleH2.otherSiteIndex[vsMf]  = particleM.particleIndex;
-
-    particleM.otherSiteIndex[vsH1f] = particleH1.particleIndex;
-    particleM.otherSiteIndex[vsH2f] = particleH2.particleIndex;
-    particleM.otherSiteIndex[vsMf]  = particleM.particleIndex;
-
-    particleO.otherSiteIndex[vsH1f] = particleH1.particleIndex;
-    particleO.otherSiteIndex[vsH2f] = particleH2.particleIndex;
-    particleO.otherSiteIndex[vsMf]  = particleM.particleIndex;
-
 }
@@ -30,11 +30,17 @@
 #include "openmm/MBPolElectrostaticsForce.h"
 #include <map>
 #include "openmm/reference/fftpack.h"
+#include "MBPolReferencePmeFFT.h"
+#include "ReferenceThreeNeighborList.h"
 #include <complex>
 #include <assert.h>
 
 using std::vector;
 
+namespace OpenMM {
+class ThreadPool;
+}
+
 typedef std::map< unsigned int, RealOpenMM> MapIntRealOpenMM;
 typedef MapIntRealOpenMM::iterator MapIntRealOpenMMI;
 typedef MapIntRealOpenMM::const_iterator MapIntRealOpenMMCI;
@@ -294,13 +300,18 @@ class MBPolReferenceElectrostaticsForce {
     *     virtual initializeInducedDipoles()                initialize induced dipoles; for PME, calculateReciprocalSpaceInducedDipoleField()
     *                                                       called in case polarization type == Direct
     *
-    *     convergeInduceDipoles()                           loop until induced dipoles converge
+    *     convergeInduceDipoles()                           loop until induced dipoles converge, or iterateInducedDipoles() for a fixed
+    *                                                       number of iterations, or extrapolateInducedDipoles() for the
+    *                                                       extrapolated (OPT) dipoles; with the ConjugateGradient
+    *                                                       solver, convergeInduceDipolesByConjugateGradient(), with the DIIS
+    *                                                       solver, convergeInduceDipolesByDIIS(), with the Dense solver or
+    *                                                       below the dense solver threshold, convergeInduceDipolesByDenseSolve()
     *
     *         updateInducedDipoleFields()                   update fields at each site due other induced dipoles
     *
     *           virtual calculateInducedDipoleFields()      calculate induced dipole field at each site by looping over particle pairs
     *                                                       for PME includes reciprocal space calculation calculateReciprocalSpaceInducedDipoleField(),
-    *                                                       direct space calculateDirectInducedDipolePairIxns() and self terms
+    *                                                       direct space calculateInducedDipolePairIxns() and self terms
     *
     *              virtual calculateInducedDipolePairIxns() field at particle i due particle j's induced dipole and vice versa; for GK includes GK field
     */
@@ -325,6 +336,38 @@ public:
         PME = 1
     };
 
+    /**
+     * This is an enumeration of the methods that may be used to converge the induced dipoles.
+     */
+    enum PolarizationSolver {
+
+        /**
+         * Successive over-relaxation of the induced dipoles.  This is the default.
+         */
+        SOR = 0,
+
+        /**
+         * Preconditioned conjugate gradient, with the blocks of the molecules as preconditioner.
+         */
+        ConjugateGradient = 1,
+
+        /**
+         * Direct inversion in the iterative subspace, as used by the CUDA platform.
+         */
+        DIIS = 2,
+
+        /**
+         * Factorization of the full polarization matrix of the polarizable sites, exact in one step;
+         * NoCutoff only, with PME an exception is thrown.
+         */
+        Dense = 3
+    };
+
+    /**
+     * The number of previous dipoles the DIIS solver extrapolates from, as on the CUDA platform.
+     */
+    static const int MaxPrevDIISDipoles = 20;
+
     enum ChargeDerivativesIndicesFinal { vsH1f, vsH2f, vsMf };
 
     /**
@@ -376,11 +419,99 @@ public:
      */
     int getMutualInducedDipoleIterations( void ) const;
 
+    /**
+     * Set the method used to converge the induced dipoles.
+     *
+     * @param polarizationSolver polarization solver
+     */
+    void setPolarizationSolver( PolarizationSolver polarizationSolver );
+
+    /**
+     * Get the method used to converge the induced dipoles.
+     *
+     * @return polarization solver
+     */
+    PolarizationSolver getPolarizationSolver( void ) const;
+
+    /**
+     * Set the number of polarizable sites up to which the Dense solver is used whatever the
+     * polarization solver, for NoCutoff only; a negative number never switches.
+     *
+     * @param threshold number of polarizable sites
+     */
+    void setDenseSolverThreshold( int threshold );
+
+    /**
+     * Get the number of polarizable sites up to which the Dense solver is used.
+     *
+     * @return number of polarizable sites
+     */
+    int getDenseSolverThreshold( void ) const;
+
     void setIncludeChargeRedistribution( bool includeChargeRedistribution );
 
 
     bool getIncludeChargeRedistribution( void ) const;
 
+    /**
+     * Set whether forces are computed. If not, calculateForceAndEnergy() only returns the energy:
+     * the charge derivatives and the force terms of the pair, reciprocal space and charge
+     * redistribution passes are skipped. The default is true.
+     */
+    void setIncludeForces( bool includeForces );
+
+    bool getIncludeForces( void ) const;
+
+    /**
+     * Set whether the dipole-dipole interaction tensor of the pair list is assembled once, as
+     * symmetric 3x3 blocks, and multiplied by the induced dipoles at each iteration instead of
+     * recomputing the pair interactions. The default is true.
+     */
+    void setUseDipoleFieldTensor( bool useDipoleFieldTensor );
+
+    bool getUseDipoleFieldTensor( void ) const;
+
+    /**
+     * Set the induced dipoles the iterations start from, e.g. extrapolated from previous steps;
+     * if not set, or empty, they start from the dipoles induced by the fixed field.
+     *
+     * @param inducedDipole       initial induced dipoles
+     * @param inducedDipolePolar  initial induced dipoles of the polar set
+     */
+    void setInitialInducedDipoles( const std::vector<RealVec>& inducedDipole, const std::vector<RealVec>& inducedDipolePolar );
+
+    /**
+     * Get the induced dipoles of the last calculation.
+     *
+     * @param inducedDipole       output induced dipoles
+     * @param inducedDipolePolar  output induced dipoles of the polar set
+     */
+    void getInducedDipoles( std::vector<RealVec>& inducedDipole, std::vector<RealVec>& inducedDipolePolar ) const;
+
+    /**
+     * Set uniform external fields whose induced dipoles are converged together with those of the
+     * fixed field, one more dipole set per field in the same iterations; the fixed field and the
+     * forces are not changed by them.
+     *
+     * @param externalFields      uniform fields, in the units of the fixed field
+     */
+    void setExternalFields( const std::vector<RealVec>& externalFields );
+
+    /**
+     * Get the dipoles induced by each external field at the last calculation.
+     *
+     * @param inducedDipoles      output induced dipoles, one vector per external field
+     */
+    void getExternalFieldInducedDipoles( std::vector<std::vector<RealVec> >& inducedDipoles ) const;
+
+    /**
+     * Get whether the last calculation iterated the direct dipoles only, the polar set having
+     * the same fixed field and initial dipoles, see calculateInducedDipoles().
+     *
+     * @return true if the polar dipoles were copied from the direct ones
+     */
+    bool getSingleDipoleSet( void ) const;
+
     void setTholeParameters( std::vector<RealOpenMM> tholeP) {
         _tholeParameters=tholeP;
     }
@@ -414,6 +545,40 @@ public:
      */
     RealOpenMM getMutualInducedDipoleTargetEpsilon( void ) const;
 
+    /**
+     * Set a fixed number of iterations of the induced dipoles, for the extended Lagrangian:
+     * the SOR updates start from the initial induced dipoles and the dipoles are not required
+     * to converge. A negative value, the default, iterates to convergence.
+     *
+     * @param iterations number of iterations, or a negative value
+     */
+    void setFixedInducedDipoleIterations( int iterations );
+
+    /**
+     * Get the fixed number of iterations of the induced dipoles, negative if they are iterated to convergence.
+     *
+     * @return number of iterations
+     */
+    int getFixedInducedDipoleIterations( void ) const;
+
+    /**
+     * Set the coefficients of the extrapolated (OPT) induced dipoles of Simmonett et al., J. Chem. Phys. 143, 074115 (2015):
+     * the induced dipoles are sum_k c_k mu_k, mu_0 being the dipoles induced by the fixed field and mu_k = alpha*(E + T*mu_(k-1))
+     * the plain iterations from them, so that a step costs as many field calculations as there are coefficients. The forces
+     * are the exact derivatives of the energy of the extrapolated dipoles (see calculateExtrapolatedDipoleForces()).
+     * An empty vector, the default, iterates the induced dipoles to convergence.
+     *
+     * @param coefficients coefficients c_0, c_1, ... or an empty vector
+     */
+    void setExtrapolationCoefficients( const std::vector<RealOpenMM>& coefficients );
+
+    /**
+     * Get the coefficients of the extrapolated induced dipoles, empty if they are iterated to convergence.
+     *
+     * @return coefficients
+     */
+    std::vector<RealOpenMM> getExtrapolationCoefficients( void ) const;
+
     /**
      * Set the maximum number of iterations to be executed in converging mutual induced dipoles.
      *
@@ -430,6 +595,14 @@ public:
      */
     int getMaximumMutualInducedDipoleIterations( void ) const;
 
+    /**
+     * Set the thread pool used to split the direct space pair loops between threads.
+     * If no pool is set (the default) all loops run on the calling thread.
+     *
+     * @param threadPool thread pool; the caller retains ownership
+     */
+    void setThreadPool( OpenMM::ThreadPool* threadPool );
+
     /**
      * Calculate force and energy.
      *
@@ -495,6 +668,28 @@ public:
                                           const std::vector<RealVec>& inputGrid,
                                           std::vector<RealOpenMM>& outputPotential );
 
+    /**
+     * Calculate the system polarizability, the derivative of the total induced dipole with respect to a
+     * uniform field; the induced dipoles of the fixed field and of a probe field along each axis are
+     * converged in one pass, whatever the polarization type.
+     *
+     * @param particlePositions         Cartesian coordinates of particles
+     * @param charges                   scalar charges for each particle
+     * @param tholes                    Thole factors for each particle
+     * @param dampingFactors            dampling factors for each particle
+     * @param polarity                  polarity for each particle
+     * @param outputPolarizability      output polarizability (xx, xy, xz, yx, yy, yz, zx, zy, zz), the first
+     *                                  index that of the dipole, in the units of the polarity
+     */
+    void calculateSystemPolarizability( const std::vector<OpenMM::RealVec>& particlePositions,
+                                        const std::vector<RealOpenMM>& charges,
+                                        const std::vector<int>& moleculeIndices,
+                                        const std::vector<int>& atomTypes,
+                                        const std::vector<RealOpenMM>& tholes,
+                                        const std::vector<RealOpenMM>& dampingFactors,
+                                        const std::vector<RealOpenMM>& polarity,
+                                        std::vector<RealOpenMM>& outputPolarizability );
+
 
 protected:
 
@@ -532,7 +727,11 @@ protected:
     unsigned int _numParticles;
 
     NonbondedMethod _nonbondedMethod;
+    PolarizationSolver _polarizationSolver;
+    int _denseSolverThreshold;
     bool _includeChargeRedistribution;
+    bool _includeForces;
+    bool _useDipoleFieldTensor;
     std::vector<RealOpenMM> _tholeParameters;
     RealOpenMM _electric;
     RealOpenMM _dielectric;
@@ -542,14 +741,68 @@ protected:
     std::vector<RealVec> _inducedDipole;
     std::vector<RealVec> _inducedDipolePolar;
 
+    std::vector<RealVec> _initialInducedDipole;
+    std::vector<RealVec> _initialInducedDipolePolar;
+
+    // uniform external fields, the polarity times them and the dipoles they induce
+
+    std::vector<RealVec> _externalFields;
+    std::vector<std::vector<RealVec> > _externalFieldFixedField;
+    std::vector<std::vector<RealVec> > _externalFieldDipole;
+
+    // perturbation orders (alpha*T)^k*alpha*E of the extrapolated induced dipoles
+
+    std::vector<std::vector<RealVec> > _ptDipole;
+    std::vector<std::vector<RealVec> > _ptDipolePolar;
+
     int _mutualInducedDipoleConverged;
     int _mutualInducedDipoleIterations;
     int _maximumMutualInducedDipoleIterations;
+    int _fixedInducedDipoleIterations;
+    bool _singleDipoleSet;
+    std::vector<RealOpenMM> _extrapolationCoefficients;
     RealOpenMM  _mutualInducedDipoleEpsilon;
     RealOpenMM  _mutualInducedDipoleTargetEpsilon;
     RealOpenMM  _polarSOR;
     RealOpenMM  _debye;
 
+    /*
+     * Work shared with the threads of _threadPool by threadComputeDirect()
+     */
+    enum ThreadStage { ScaleStage, InducedDipoleFieldStage, ElectrostaticStage };
+    class ThreadTask;
+
+    OpenMM::ThreadPool* _threadPool;
+    ThreadStage _threadStage;
+    const std::vector<ElectrostaticsParticleData>* _threadParticleData;
+    std::vector<std::vector<UpdateInducedDipoleFieldStruct> > _threadInducedDipoleFields;
+    std::vector<std::vector<RealVec> > _threadForces;
+    std::vector<std::vector<RealOpenMM> > _threadElectrostaticPotential;
+    std::vector<RealOpenMM> _threadEnergy;
+
+    /*
+     * Direct space pair list, see buildPairList(): the pairs (ii, jj), ii < jj, of row ii are
+     * jj = _pairNeighbors[_pairStart[ii]] .. _pairNeighbors[_pairStart[ii+1]-1], their
+     * Thole scaled dipole-dipole factors are at the same positions in _pairScale3 and _pairScale5,
+     * or, if _useDipoleFieldTensor is set, their dipole field tensors (xx, xy, xz, yy, yz, zz)
+     * at six times the position in _pairTensor
+     */
+    std::vector<unsigned int> _pairStart;
+    std::vector<unsigned int> _pairNeighbors;
+    std::vector<RealOpenMM> _pairScale3;
+    std::vector<RealOpenMM> _pairScale5;
+    std::vector<RealOpenMM> _pairTensor;
+
+    /*
+     * Block-Jacobi preconditioner of the conjugate gradient solver: the sites of molecule mm are
+     * _moleculeSites[_moleculeStart[mm]] .. _moleculeSites[_moleculeStart[mm+1]-1], the inverse of
+     * the block of the molecule, 3n x 3n for n sites, starts at _preconditionerStart[mm] in _preconditioner
+     */
+    std::vector<unsigned int> _moleculeStart;
+    std::vector<unsigned int> _moleculeSites;
+    std::vector<unsigned int> _preconditionerStart;
+    std::vector<RealOpenMM> _preconditioner;
+
     /**
      * Helper constructor method to centralize initialization of objects.
      *
@@ -648,7 +901,7 @@ protected:
     virtual void calculateFixedElectrostaticsFieldPairIxn( const ElectrostaticsParticleData& particleI, const ElectrostaticsParticleData& particleJ);
 
     /**
-     * Initialize induced dipoles
+     * Initialize induced dipoles, from the initial induced dipoles if they are set
      *
      * @param updateInducedDipoleFields vector of UpdateInducedDipoleFieldStruct containing input induced dipoles and output fields
      */
@@ -671,7 +924,127 @@ protected:
                                         const std::vector<RealVec>& inducedDipole,
                                         std::vector<RealVec>& field ) const;
 
-    virtual void precomputeScale35( const std::vector<ElectrostaticsParticleData>& particleData, RealOpenMM scale3[], RealOpenMM scale5[] );
+    /**
+     * Build the list of the particle pairs of the direct space loops; without a cutoff
+     * every pair ii < jj is listed.
+     *
+     * @param particleData              vector of particle positions and parameters (charge, labFrame dipoles, quadrupoles, ...)
+     */
+    virtual void buildPairList( const std::vector<ElectrostaticsParticleData>& particleData );
+
+    /**
+     * Precompute the Thole scaled dipole-dipole factors of the pairs of the pair list
+     * into _pairScale3 and _pairScale5, or their dipole field tensors into _pairTensor.
+     *
+     * @param particleData              vector of particle positions and parameters (charge, labFrame dipoles, quadrupoles, ...)
+     */
+    void precomputeScale35( const std::vector<ElectrostaticsParticleData>& particleData );
+
+    /**
+     * Precompute the factors of the pairs of one row of the pair list, see precomputeScale35().
+     *
+     * @param particleData              vector of particle positions and parameters (charge, labFrame dipoles, quadrupoles, ...)
+     * @param ii                        row index
+     */
+    void precomputeScale35Row( const std::vector<ElectrostaticsParticleData>& particleData, unsigned int ii );
+
+    /**
+     * Get the factors of the field at particle I due an induced dipole d at particle J,
+     * preFactor1*d + preFactor2*(d.deltaR)*deltaR, which also give the field at J due
+     * a dipole at I.
+     *
+     * @param particleI                 positions and parameters (charge, labFrame dipoles, quadrupoles, ...) for particle I
+     * @param particleJ                 positions and parameters (charge, labFrame dipoles, quadrupoles, ...) for particle J
+     * @param scale3                    Thole scaled scale3 factor of the pair
+     * @param scale5                    Thole scaled scale5 factor of the pair
+     * @param deltaR                    output particleJ.position - particleI.position
+     * @param preFactor1                output factor of d
+     * @param preFactor2                output factor of (d.deltaR)*deltaR
+     *
+     * @return false if the particles do not interact
+     */
+    virtual bool getInducedDipoleFieldFactors( const ElectrostaticsParticleData& particleI, const ElectrostaticsParticleData& particleJ,
+                                               RealOpenMM scale3, RealOpenMM scale5, RealVec& deltaR,
+                                               RealOpenMM& preFactor1, RealOpenMM& preFactor2 ) const;
+
+    /**
+     * Add the fields due the induced dipoles of the pairs of one row of the pair list,
+     * using the dipole field tensors in _pairTensor.
+     *
+     * @param ii                        row index
+     * @param updateInducedDipoleFields vector of UpdateInducedDipoleFieldStruct containing input induced dipoles and output fields
+     */
+    void multiplyDipoleFieldTensorRow( unsigned int ii, std::vector<UpdateInducedDipoleFieldStruct>& updateInducedDipoleFields ) const;
+
+    /**
+     * Get the dipole field tensor of a particle pair, the field at I due a dipole d at J being T*d.
+     *
+     * @param particleI                 positions and parameters (charge, labFrame dipoles, quadrupoles, ...) for particle I
+     * @param particleJ                 positions and parameters (charge, labFrame dipoles, quadrupoles, ...) for particle J
+     * @param tensor                    output xx, xy, xz, yy, yz, zz elements of T
+     */
+    void getDipoleFieldTensor( const ElectrostaticsParticleData& particleI, const ElectrostaticsParticleData& particleJ,
+                               RealOpenMM* tensor ) const;
+
+    /**
+     * Get the Thole scaled dipole-dipole factors for a particle pair.
+     *
+     * @param particleI                 positions and parameters (charge, labFrame dipoles, quadrupoles, ...) for particle I
+     * @param particleJ                 positions and parameters (charge, labFrame dipoles, quadrupoles, ...) for particle J
+     * @param scale3                    output scale3 factor
+     * @param scale5                    output scale5 factor
+     */
+    virtual void getScale35( const ElectrostaticsParticleData& particleI, const ElectrostaticsParticleData& particleJ,
+                             RealOpenMM& scale3, RealOpenMM& scale5 ) const;
+
+    /**
+     * Calculate the direct space fields due induced dipoles by looping over the pair list
+     * (split between the threads of the thread pool, if one is set).
+     *
+     * @param particleData              vector of particle positions and parameters (charge, labFrame dipoles, quadrupoles, ...)
+     * @param updateInducedDipoleFields vector of UpdateInducedDipoleFieldStruct containing input induced dipoles and output fields
+     */
+    void calculateDirectInducedDipoleFields( const std::vector<ElectrostaticsParticleData>& particleData,
+                                             std::vector<UpdateInducedDipoleFieldStruct>& updateInducedDipoleFields );
+
+    /**
+     * Calculate the direct space electrostatic interaction between particles I and J.
+     *
+     * @param particleData            vector of parameters (charge, labFrame dipoles, quadrupoles, ...) for particles
+     * @param iIndex                  index of particle I
+     * @param jIndex                  index of particle J
+     * @param forces                  vector of particle forces to be updated
+     * @param electrostaticPotential  vector of electrostatic potentials to be updated
+     *
+     * @return energy
+     */
+    virtual RealOpenMM calculateDirectElectrostaticPairIxn( const std::vector<ElectrostaticsParticleData>& particleData,
+                                                            unsigned int iIndex, unsigned int jIndex,
+                                                            std::vector<RealVec>& forces,
+                                                            std::vector<RealOpenMM>& electrostaticPotential ) const;
+
+    /**
+     * Calculate the direct space electrostatic interactions by looping over the pair list
+     * (split between the threads of the thread pool, if one is set).
+     *
+     * @param particleData            vector of parameters (charge, labFrame dipoles, quadrupoles, ...) for particles
+     * @param forces                  vector of particle forces to be updated
+     * @param electrostaticPotential  vector of electrostatic potentials to be updated
+     *
+     * @return energy
+     */
+    RealOpenMM calculateDirectElectrostatic( const std::vector<ElectrostaticsParticleData>& particleData,
+                                             std::vector<RealVec>& forces,
+                                             std::vector<RealOpenMM>& electrostaticPotential );
+
+    /**
+     * Compute the rows of the current pair loop (see ThreadStage) assigned to a thread.
+     *
+     * @param threads                 thread pool
+     * @param threadIndex             index of the thread
+     */
+    void threadComputeDirect( OpenMM::ThreadPool& threads, int threadIndex );
+
     /**
      * Calculate fields due induced dipoles at each site.
      *
@@ -689,8 +1062,7 @@ protected:
      * @param updateInducedDipoleFields vector of UpdateInducedDipoleFieldStruct containing input induced dipoles and output fields
      */
     virtual void calculateInducedDipoleFields( const std::vector<ElectrostaticsParticleData>& particleData,
-                                               std::vector<UpdateInducedDipoleFieldStruct>& updateInducedDipoleFields,
-						 const RealOpenMM scale3[], const RealOpenMM scale5[]);
+                                               std::vector<UpdateInducedDipoleFieldStruct>& updateInducedDipoleFields );
     /**
      * Converge induced dipoles.
      *
@@ -700,6 +1072,128 @@ protected:
     void convergeInduceDipoles( const std::vector<ElectrostaticsParticleData>& particleData,
                                 std::vector<UpdateInducedDipoleFieldStruct>& calculateInducedDipoleField );
 
+    /**
+     * Converge induced dipoles by preconditioned conjugate gradient.
+     *
+     * The induced dipoles solve (1 - alpha*T) mu = alpha*E, alpha being the polarity and T the
+     * field due the induced dipoles; this is solved for y = alpha^(-1/2) mu, for which the matrix
+     * 1 - alpha^(1/2)*T*alpha^(1/2) is symmetric; sites with zero polarity keep zero dipoles.
+     * All the dipole sets are iterated together, one field calculation per iteration.
+     *
+     * @param particleData              vector of particle positions and parameters (charge, labFrame dipoles, quadrupoles, ...)
+     * @param updateInducedDipoleFields vector of UpdateInducedDipoleFieldStruct containing input induced dipoles and output fields
+     */
+    void convergeInduceDipolesByConjugateGradient( const std::vector<ElectrostaticsParticleData>& particleData,
+                                                   std::vector<UpdateInducedDipoleFieldStruct>& updateInducedDipoleFields );
+
+    /**
+     * Solve for the induced dipoles with the full polarization matrix.
+     *
+     * The matrix 1 - alpha^(1/2)*T*alpha^(1/2) of the polarizable sites, see convergeInduceDipolesByConjugateGradient(),
+     * is assembled from the pair tensors and factorized once by Cholesky, or by LU if it is not positive definite,
+     * and solved for all the dipole sets together. NoCutoff only, T must hold all the pairs.
+     *
+     * @param particleData              vector of particle positions and parameters (charge, labFrame dipoles, quadrupoles, ...)
+     * @param updateInducedDipoleFields vector of UpdateInducedDipoleFieldStruct containing input induced dipoles and output fields
+     */
+    void convergeInduceDipolesByDenseSolve( const std::vector<ElectrostaticsParticleData>& particleData,
+                                            std::vector<UpdateInducedDipoleFieldStruct>& updateInducedDipoleFields );
+
+    /**
+     * Run the fixed number of SOR iterations of the induced dipoles set by setFixedInducedDipoleIterations(),
+     * without requiring them to converge.
+     *
+     * @param particleData              vector of particle positions and parameters (charge, labFrame dipoles, quadrupoles, ...)
+     * @param updateInducedDipoleFields vector of UpdateInducedDipoleFieldStruct containing input induced dipoles and output fields
+     */
+    void iterateInducedDipoles( const std::vector<ElectrostaticsParticleData>& particleData,
+                                std::vector<UpdateInducedDipoleFieldStruct>& updateInducedDipoleFields );
+
+    /**
+     * Compute the extrapolated induced dipoles sum_k C_k p_k from the perturbation orders p_k = (alpha*T)^k*alpha*E,
+     * C_k being the sum of the extrapolation coefficients from k on, and the fields due them.
+     *
+     * @param particleData              vector of particle positions and parameters (charge, labFrame dipoles, quadrupoles, ...)
+     * @param updateInducedDipoleFields vector of UpdateInducedDipoleFieldStruct containing input induced dipoles and output fields
+     */
+    void extrapolateInducedDipoles( const std::vector<ElectrostaticsParticleData>& particleData,
+                                    std::vector<UpdateInducedDipoleFieldStruct>& updateInducedDipoleFields );
+
+    /**
+     * Add the forces the extrapolated induced dipoles need beyond those of calculateElectrostatic().
+     *
+     * The energy of the extrapolated dipoles mu = sum_k C_k p_k is -1/2 E.mu; its derivative is that of
+     * converged dipoles, which calculateElectrostatic() computes, except that the induced dipole - induced
+     * dipole term -1/2 mu.dT.mu becomes -1/2 sum_(m,n) C_(m+n+1) p_m.dT.p_n. The difference is added here.
+     *
+     * @param particleData      vector of particle positions and parameters (charge, labFrame dipoles, quadrupoles, ...)
+     * @param forces            vector of particle forces to be updated
+     */
+    void calculateExtrapolatedDipoleForces( const std::vector<ElectrostaticsParticleData>& particleData,
+                                            std::vector<OpenMM::RealVec>& forces );
+
+    /**
+     * Calculate the induced dipole - induced dipole forces, those of calculateElectrostatic() that are
+     * bilinear in the induced dipoles and polar induced dipoles, for the given dipoles.
+     *
+     * @param particleData          vector of particle positions and parameters (charge, labFrame dipoles, quadrupoles, ...)
+     * @param inducedDipole         induced dipoles
+     * @param inducedDipolePolar    polar induced dipoles
+     * @param forces                vector of particle forces to be updated
+     */
+    virtual void calculateInducedDipoleForces( const std::vector<ElectrostaticsParticleData>& particleData,
+                                               const std::vector<RealVec>& inducedDipole,
+                                               const std::vector<RealVec>& inducedDipolePolar,
+                                               std::vector<OpenMM::RealVec>& forces );
+
+    /**
+     * Calculate the induced dipole - induced dipole force between particles I and K, see calculateInducedDipoleForces().
+     *
+     * @param particleData          vector of particle positions and parameters (charge, labFrame dipoles, quadrupoles, ...)
+     * @param iIndex                particle I index
+     * @param kIndex                particle K index
+     * @param inducedDipole         induced dipoles
+     * @param inducedDipolePolar    polar induced dipoles
+     * @param forces                vector of particle forces to be updated
+     */
+    virtual void calculateInducedDipolePairForce( const std::vector<ElectrostaticsParticleData>& particleData,
+                                                  unsigned int iIndex, unsigned int kIndex,
+                                                  const std::vector<RealVec>& inducedDipole,
+                                                  const std::vector<RealVec>& inducedDipolePolar,
+                                                  std::vector<OpenMM::RealVec>& forces ) const;
+
+    /**
+     * Converge induced dipoles by direct inversion in the iterative subspace (DIIS).
+     *
+     * Each iteration computes the dipoles induced by the current field and takes the combination
+     * of the last MaxPrevDIISDipoles of them that minimizes the combined change of the dipoles.
+     * Unlike CudaCalcMBPolElectrostaticsForceKernel::iterateDipolesByDIIS(), which uses the coefficients
+     * of the first dipole set for all sets, every set is extrapolated with its own coefficients, since
+     * the sets solve the same equations for different fields.  The fields are those of the returned dipoles.
+     *
+     * @param particleData              vector of particle positions and parameters (charge, labFrame dipoles, quadrupoles, ...)
+     * @param updateInducedDipoleFields vector of UpdateInducedDipoleFieldStruct containing input induced dipoles and output fields
+     */
+    void convergeInduceDipolesByDIIS( const std::vector<ElectrostaticsParticleData>& particleData,
+                                      std::vector<UpdateInducedDipoleFieldStruct>& updateInducedDipoleFields );
+
+    /**
+     * Build the block-Jacobi preconditioner of the conjugate gradient solver: for each molecule the
+     * inverse of 1 - alpha^(1/2)*T*alpha^(1/2) restricted to the direct space interactions between
+     * its own sites.
+     *
+     * @param particleData              vector of particle positions and parameters (charge, labFrame dipoles, quadrupoles, ...)
+     */
+    void buildMoleculePreconditioner( const std::vector<ElectrostaticsParticleData>& particleData );
+
+    /**
+     * Apply the block-Jacobi preconditioner, z = P^-1 r.
+     *
+     * @param residual                  input residual r
+     * @param preconditioned            output z
+     */
+    void applyMoleculePreconditioner( const std::vector<RealVec>& residual, std::vector<RealVec>& preconditioned ) const;
+
     /**
      * Update fields due to induced dipoles for each particle.
      *
@@ -707,8 +1201,7 @@ protected:
      * @param updateInducedDipoleFields vector of UpdateInducedDipoleFieldStruct containing input induced dipoles and output fields
      */
     RealOpenMM runUpdateInducedDipoleFields( const std::vector<ElectrostaticsParticleData>& particleData,
-                                          std::vector<UpdateInducedDipoleFieldStruct>& calculateInducedDipoleField,
-						 const RealOpenMM scale3[], const RealOpenMM scale5[]);
+                                          std::vector<UpdateInducedDipoleFieldStruct>& calculateInducedDipoleField );
 
     /**
      * Update induced dipole for a particle given updated induced dipole field at the site.
@@ -730,6 +1223,14 @@ protected:
      */
     virtual void calculateInducedDipoles( const std::vector<ElectrostaticsParticleData>& particleData );
 
+    /**
+     * Check whether the polar dipole set has the same fixed field and initial dipoles as the direct one,
+     * in which case its dipoles need not be iterated.
+     *
+     * @return true if the two sets are identical
+     */
+    bool hasIdenticalPolarDipoleSet( void ) const;
+
     /**
      * Setup:
      *        if needed invert multipole moments at chiral centers
@@ -899,6 +1400,23 @@ public:
      */
     void setPmeGridDimensions( std::vector<int>& pmeGridDimensions );
 
+    /**
+     * Get the order of the B-splines spreading the sites onto the PME grid.
+     *
+     * @return B-spline order
+     *
+     */
+    int getPmeBSplineOrder( void ) const;
+
+    /**
+     * Set the order of the B-splines spreading the sites onto the PME grid, between 4 and 8
+     * (default 5). A lower order is cheaper per site but needs a finer grid for the same accuracy.
+     *
+     * @param pmeBSplineOrder B-spline order
+     *
+     */
+    void setPmeBSplineOrder( int pmeBSplineOrder );
+
     /**
      * Set periodic box size.
      *
@@ -932,23 +1450,31 @@ protected:
 
 private:
 
-    static const int MBPOL_PME_ORDER;
+    static const int MBPOL_PME_MAX_ORDER;
     static const RealOpenMM SQRT_PI;
 
     RealOpenMM _alphaEwald;
     RealOpenMM _cutoffDistance;
     RealOpenMM _cutoffDistanceSquared;
 
+    // neighbors within the cutoff, from which buildPairList() takes the pair list
+    ThreeNeighborPairList _cutoffNeighbors;
+    std::vector<RealVec> _cutoffNeighborPositions;
+
     RealVec _invPeriodicBoxSize;
     RealVec _periodicBoxSize;
 
     int _totalGridSize;
     IntVec _pmeGridDimensions;
+    int _pmeOrder;
 
-    fftpack_t   _fftplan;
+    MBPolReferencePmeFFT* _fft;
 
+    // _pmeGrid holds a complex grid, two real grids as its real and imaginary
+    // parts, or the half spectrum of _pmeRealGrid
     unsigned int _pmeGridSize;
     t_complex* _pmeGrid;
+    std::vector<RealOpenMM> _pmeRealGrid;
 
     std::vector<RealOpenMM> _pmeBsplineModuli[3];
     std::vector<RealOpenMM4> _thetai[3];
@@ -957,18 +1483,20 @@ private:
     std::vector<RealOpenMM> _phid;
     std::vector<RealOpenMM> _phip;
     std::vector<RealOpenMM> _phidp;
-    std::vector<int> _pmeAtomRange;
-    std::vector<int2> _pmeAtomGridIndex;
+
+    // source spread by spreadOntoGrid(): the charges of _spreadParticleData, or
+    // the induced dipoles when _spreadInducedDipole is set; a single set
+    // (_spreadInducedDipolePolar NULL) and the charges go to _pmeRealGrid
+    const std::vector<ElectrostaticsParticleData>* _spreadParticleData;
+    const std::vector<RealVec>* _spreadInducedDipole;
+    const std::vector<RealVec>* _spreadInducedDipolePolar;
+    class SpreadTask;
+
     std::vector<RealOpenMM4> _pmeBsplineTheta;
     std::vector<RealOpenMM4> _pmeBsplineDtheta;
 
 
 
-    /**
-     * Zero Pme grid.
-     */
-    void initializePmeGrid( void );
-
     /**
      * Modify input vector of differences in particle positions for periodic boundary conditions.
      *
@@ -1039,34 +1567,28 @@ private:
     void computeMBPolBsplines( const std::vector<ElectrostaticsParticleData>& particleData );
 
     /**
-     * For each grid point, find the range of sorted atoms associated with that point.
+     * Set the x planes [xBegin, xEnd) of the PME grid to the sum of the B-spline footprints of
+     * the sites: the charges or a single set of induced dipoles on _pmeRealGrid, or the induced
+     * dipoles in the real part and the polar induced dipoles in the imaginary part of _pmeGrid
+     * (see _spreadInducedDipole).
      *
-     * @param particleData              vector of particle positions and parameters (charge, labFrame dipoles, quadrupoles, ...)
+     * @param xBegin first x plane written
+     * @param xEnd   one past the last x plane written
      */
-    void findMBPolAtomRangeForGrid( const vector<ElectrostaticsParticleData>& particleData );
+    void spreadOntoGridSlab( int xBegin, int xEnd );
 
     /**
-     * Get grid point given grid index.
+     * Spread the x planes owned by a thread of _threadPool.
      *
-     * @param gridIndex  input grid index
-     * @param gridPoint  output grid point
+     * @param threads                 thread pool
+     * @param threadIndex             index of the thread
      */
-    void getGridPointGivenGridIndex( int gridIndex, IntVec& gridPoint ) const;
+    void threadSpreadOntoGrid( OpenMM::ThreadPool& threads, int threadIndex );
 
     /**
-     * Compute induced dipole grid value.
-     *
-     * @param particleData            vector of particle positions and parameters (charge, labFrame dipoles, quadrupoles, ...)
-     * @param particleGridIndices     particle grid indices
-     * @param scale                   integer grid dimension/box size for each dimension
-     * @param ix                      x-dimension offset value
-     * @param iy                      y-dimension offset value
-     * @param gridPoint               grid point for which value is to be computed
-     * @param inputInducedDipole      induced dipole value
-     * @param inputInducedDipolePolar induced dipole value
+     * Spread the current source onto the PME grid, divided over the threads of _threadPool if set.
      */
-     RealOpenMM computeFixedElectrostaticssGridValue( const vector<ElectrostaticsParticleData>& particleData,
-                                                 const int2& particleGridIndices, const RealVec& scale, int ix, int iy, const IntVec& gridPoint ) const;
+    void spreadOntoGrid( void );
 
     /**
      * Spread fixed multipoles onto PME grid.
@@ -1076,10 +1598,12 @@ private:
     void spreadFixedElectrostaticssOntoGrid( const vector<ElectrostaticsParticleData>& particleData );
 
     /**
-     * Perform reciprocal convolution.
+     * Perform reciprocal convolution of the transform in _pmeGrid.
      *
+     * @param gridSizeZ  number of z points of the transform: the PME grid dimension for a
+     *                   complex grid, or MBPolReferencePmeFFT::getComplexSizeZ() for a half spectrum
      */
-    void performMBPolReciprocalConvolution( void );
+    void performMBPolReciprocalConvolution( int gridSizeZ );
 
     /**
      * Compute reciprocal potential due fixed multipoles at each particle site.
@@ -1110,9 +1634,36 @@ private:
      */
     void recordFixedElectrostaticsField( void );
 
-    void precomputeScale35( const std::vector<ElectrostaticsParticleData>& particleData, RealOpenMM scale3[], RealOpenMM scale5[] );
     /**
-     * Compute the potential due to the reciprocal space PME calculation for induced dipoles.
+     * Build the list of the particle pairs within the cutoff with a cell list, so that
+     * the direct space loops take time and memory linear in the number of particles.
+     *
+     * @param particleData              vector of particle positions and parameters (charge, labFrame dipoles, quadrupoles, ...)
+     */
+    void buildPairList( const std::vector<ElectrostaticsParticleData>& particleData );
+
+    /**
+     * Get the Ewald scaled dipole-dipole factors for a particle pair.
+     *
+     * @param particleI                 positions and parameters (charge, labFrame dipoles, quadrupoles, ...) for particle I
+     * @param particleJ                 positions and parameters (charge, labFrame dipoles, quadrupoles, ...) for particle J
+     * @param scale3                    output scale3 factor
+     * @param scale5                    output scale5 factor
+     */
+    void getScale35( const ElectrostaticsParticleData& particleI, const ElectrostaticsParticleData& particleJ,
+                     RealOpenMM& scale3, RealOpenMM& scale5 ) const;
+
+    /**
+     * Get the factors of the real space field at particle I due an induced dipole at particle J,
+     * see MBPolReferenceElectrostaticsForce::getInducedDipoleFieldFactors().
+     */
+    bool getInducedDipoleFieldFactors( const ElectrostaticsParticleData& particleI, const ElectrostaticsParticleData& particleJ,
+                                       RealOpenMM scale3, RealOpenMM scale5, RealVec& deltaR,
+                                       RealOpenMM& preFactor1, RealOpenMM& preFactor2 ) const;
+
+    /**
+     * Compute the potential due to the reciprocal space PME calculation for induced dipoles; the sets are
+     * spread two at a time, the first two last, as the reciprocal space forces use their potential.
      *
      * @param updateInducedDipoleFields vector of UpdateInducedDipoleFieldStruct containing input induced dipoles and output fields
      */
@@ -1142,7 +1693,7 @@ private:
      * @param particleJ                 positions and parameters (charge, labFrame dipoles, quadrupoles, ...) for particle J
      * @param updateInducedDipoleFields vector of UpdateInducedDipoleFieldStruct containing input induced dipoles and output fields
      */
-    void calculateDirectInducedDipolePairIxns( const ElectrostaticsParticleData& particleI,
+    void calculateInducedDipolePairIxns( const ElectrostaticsParticleData& particleI,
                                                const ElectrostaticsParticleData& particleJ,
                                                std::vector<UpdateInducedDipoleFieldStruct>& updateInducedDipoleFields,
                                                RealOpenMM precomputedScale3,
@@ -1156,28 +1707,23 @@ private:
     void initializeInducedDipoles( std::vector<UpdateInducedDipoleFieldStruct>& updateInducedDipoleFields );
 
     /**
-     * Compute induced dipole grid value.
+     * Spread induced dipoles onto grid; a set passed as both arguments is spread onto _pmeRealGrid.
      *
-     * @param atomIndices             indices of first and last atom contiputing to grid point value
-     * @param scale                   integer grid dimension/box size for each dimension
-     * @param ix                      x-dimension offset value
-     * @param iy                      y-dimension offset value
-     * @param gridPoint               grid point for which value is to be computed
      * @param inputInducedDipole      induced dipole value
      * @param inputInducedDipolePolar induced dipole polar value
      */
-    t_complex computeInducedDipoleGridValue( const int2& atomIndices, const RealVec& scale, int ix, int iy, const IntVec& gridPoint,
-                                             const std::vector<RealVec>& inputInducedDipole,
-                                             const std::vector<RealVec>& inputInducedDipolePolar ) const;
+    void spreadInducedDipolesOnGrid( const std::vector<RealVec>& inputInducedDipole,
+                                     const std::vector<RealVec>& inputInducedDipolePolar );
 
     /**
-     * Spread induced dipoles onto grid.
+     * Compute the reciprocal space potentials _phid and _phip of two sets of induced dipoles,
+     * which may be the same set.
      *
      * @param inputInducedDipole      induced dipole value
      * @param inputInducedDipolePolar induced dipole polar value
      */
-    void spreadInducedDipolesOnGrid( const std::vector<RealVec>& inputInducedDipole,
-                                     const std::vector<RealVec>& inputInducedDipolePolar );
+    void computeInducedDipolePotentials( const std::vector<RealVec>& inputInducedDipole,
+                                         const std::vector<RealVec>& inputInducedDipolePolar );
 
     /**
      * Calculate induced dipole fields.
@@ -1186,7 +1732,7 @@ private:
      * @param updateInducedDipoleFields vector of UpdateInducedDipoleFieldStruct containing input induced dipoles and output fields
      */
     void calculateInducedDipoleFields( const std::vector<ElectrostaticsParticleData>& particleData,
-                                       std::vector<UpdateInducedDipoleFieldStruct>& updateInducedDipoleFields, const RealOpenMM scale3[], const RealOpenMM scale5[]);
+                                       std::vector<UpdateInducedDipoleFieldStruct>& updateInducedDipoleFields );
 
     /**
      * Set reciprocal space induced dipole fields.
@@ -1204,6 +1750,22 @@ private:
      */
     RealOpenMM calculatePmeSelfEnergy( const std::vector<ElectrostaticsParticleData>& particleData, std::vector<RealVec>& forces, std::vector<RealOpenMM>& electrostaticPotential ) const;
 
+    /**
+     * Calculate direct space electrostatic interaction between particles I and J.
+     *
+     * @param particleData            vector of parameters (charge, labFrame dipoles, quadrupoles, ...) for particles
+     * @param iIndex                  index of particle I
+     * @param jIndex                  index of particle J
+     * @param forces                  vector of particle forces to be updated
+     * @param electrostaticPotential  vector of electrostatic potentials to be updated
+     *
+     * @return energy
+     */
+    RealOpenMM calculateDirectElectrostaticPairIxn( const std::vector<ElectrostaticsParticleData>& particleData,
+                                                    unsigned int iIndex, unsigned int jIndex,
+                                                    std::vector<RealVec>& forces,
+                                                    std::vector<RealOpenMM>& electrostaticPotential ) const;
+
     /**
      * Calculate reciprocal space energy/force for dipole interaction.
      *
@@ -1213,6 +1775,25 @@ private:
      RealOpenMM computeReciprocalSpaceInducedDipoleForceAndEnergy( const std::vector<ElectrostaticsParticleData>& particleData,
                                                                    std::vector<RealVec>& forces, std::vector<RealOpenMM>& electrostaticPotential) const;
 
+    /**
+     * Calculate the induced dipole - induced dipole forces, direct and reciprocal space,
+     * see MBPolReferenceElectrostaticsForce::calculateInducedDipoleForces().
+     */
+    void calculateInducedDipoleForces( const std::vector<ElectrostaticsParticleData>& particleData,
+                                       const std::vector<RealVec>& inducedDipole,
+                                       const std::vector<RealVec>& inducedDipolePolar,
+                                       std::vector<OpenMM::RealVec>& forces );
+
+    /**
+     * Calculate the direct space induced dipole - induced dipole force between particles I and K,
+     * see MBPolReferenceElectrostaticsForce::calculateInducedDipolePairForce().
+     */
+    void calculateInducedDipolePairForce( const std::vector<ElectrostaticsParticleData>& particleData,
+                                          unsigned int iIndex, unsigned int kIndex,
+                                          const std::vector<RealVec>& inducedDipole,
+                                          const std::vector<RealVec>& inducedDipolePolar,
+                                          std::vector<OpenMM::RealVec>& forces ) const;
+
     /**
      * Calculate electrostatic forces.
      *
@@ -0,0 +1,115 @@
+/* -------------------------------------------------------------------------- *
+ *                               OpenMMMBPol                                 *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2008-2009 Stanford University and the Authors.      *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * This program is free software: you can redistribute it and/or modify       *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * This program is distributed in the hope that it will be useful,            *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ *                                                                            *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.      *
+ * -------------------------------------------------------------------------- */
+
+#include "MBPolReferenceExtendedLagrangianDipoles.h"
+
+// an MD step moves an atom by a few hundredths of a nm at most
+
+const double MBPolReferenceExtendedLagrangianDipoles::maximumDisplacement = 0.05;
+
+// dissipation coefficients c_0 .. c_5 of the sixth order scheme of Niklasson et al.
+
+static const double dissipationCoefficients[6] = { -6.0, 14.0, -8.0, -3.0, 4.0, -1.0 };
+
+MBPolReferenceExtendedLagrangianDipoles::MBPolReferenceExtendedLagrangianDipoles( ) : _coupling(1.82), _dissipation(0.018) {
+}
+
+void MBPolReferenceExtendedLagrangianDipoles::setParameters( double coupling, double dissipation ){
+    _coupling    = coupling;
+    _dissipation = dissipation;
+}
+
+void MBPolReferenceExtendedLagrangianDipoles::reset( void ){
+    _positions.clear();
+    _auxiliaryDipoles.clear();
+    _auxiliaryDipolesPolar.clear();
+    _inducedDipole.clear();
+    _inducedDipolePolar.clear();
+}
+
+bool MBPolReferenceExtendedLagrangianDipoles::propagate( const std::vector<RealVec>& positions, const RealVec& box,
+                                                         std::vector<RealVec>& inducedDipole, std::vector<RealVec>& inducedDipolePolar ){
+
+    bool jump          = (_positions.size() != positions.size() || box[0] != _box[0] || box[1] != _box[1] || box[2] != _box[2]);
+    bool samePositions = !jump;
+    if( !jump ){
+        const double maxDisplacement2 = maximumDisplacement*maximumDisplacement;
+        for( unsigned int ii = 0; ii < positions.size(); ii++ ){
+            const RealVec delta = positions[ii] - _positions[ii];
+            const double displacement2 = delta.dot( delta );
+            if( displacement2 > 0.0 ){
+                samePositions = false;
+            }
+            if( displacement2 > maxDisplacement2 ){
+                jump = true;
+                break;
+            }
+        }
+    }
+    if( jump ){
+        reset();
+    }
+    _positions = positions;
+    _box       = box;
+
+    if( _auxiliaryDipoles.empty() ){
+        return false;
+    }
+
+    if( !samePositions ){
+        std::vector<RealVec> next( positions.size() );
+        std::vector<RealVec> nextPolar( positions.size() );
+        for( unsigned int ii = 0; ii < positions.size(); ii++ ){
+            next[ii]      = _auxiliaryDipoles[0][ii]*2.0 - _auxiliaryDipoles[1][ii] + (_inducedDipole[ii] - _auxiliaryDipoles[0][ii])*_coupling;
+            nextPolar[ii] = _auxiliaryDipolesPolar[0][ii]*2.0 - _auxiliaryDipolesPolar[1][ii] + (_inducedDipolePolar[ii] - _auxiliaryDipolesPolar[0][ii])*_coupling;
+            for( unsigned int kk = 0; kk < historySize; kk++ ){
+                next[ii]      += _auxiliaryDipoles[kk][ii]*(_dissipation*dissipationCoefficients[kk]);
+                nextPolar[ii] += _auxiliaryDipolesPolar[kk][ii]*(_dissipation*dissipationCoefficients[kk]);
+            }
+        }
+        _auxiliaryDipoles.pop_back();
+        _auxiliaryDipolesPolar.pop_back();
+        _auxiliaryDipoles.push_front( next );
+        _auxiliaryDipolesPolar.push_front( nextPolar );
+    }
+
+    inducedDipole      = _auxiliaryDipoles.front();
+    inducedDipolePolar = _auxiliaryDipolesPolar.front();
+    return true;
+}
+
+void MBPolReferenceExtendedLagrangianDipoles::record( const std::vector<RealVec>& inducedDipole, const std::vector<RealVec>& inducedDipolePolar ){
+
+    _inducedDipole      = inducedDipole;
+    _inducedDipolePolar = inducedDipolePolar;
+
+    // the converged dipoles of the first step are the whole history, the auxiliary dipoles at rest
+
+    if( _auxiliaryDipoles.empty() ){
+        _auxiliaryDipoles.assign( historySize, inducedDipole );
+        _auxiliaryDipolesPolar.assign( historySize, inducedDipolePolar );
+    }
+}
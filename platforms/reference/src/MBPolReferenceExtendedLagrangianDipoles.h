@@ -0,0 +1,132 @@
+/* -------------------------------------------------------------------------- *
+ *                               OpenMMMBPol                                 *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2008-2009 Stanford University and the Authors.      *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * This program is free software: you can redistribute it and/or modify       *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * This program is distributed in the hope that it will be useful,            *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ *                                                                            *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.      *
+ * -------------------------------------------------------------------------- */
+
+#ifndef __MBPolReferenceExtendedLagrangianDipoles_H__
+#define __MBPolReferenceExtendedLagrangianDipoles_H__
+
+#include "openmm/reference/RealVec.h"
+#include <deque>
+#include <vector>
+
+using OpenMM::RealVec;
+// ---------------------------------------------------------------------------------------
+
+/**
+ * Auxiliary induced dipoles of the extended Lagrangian polarization: they are propagated
+ * as extra dynamical variables by the time-reversible integration, with dissipation, of
+ * Niklasson et al., J. Chem. Phys. 130, 214109 (2009), harmonically coupled to the induced
+ * dipoles of each step:
+ *
+ *    x(t+dt) = 2 x(t) - x(t-dt) + coupling*(mu(t) - x(t)) + dissipation*sum_k c_k x(t-k dt),  k = 0..5
+ *
+ * The induced dipoles of a step, mu, are a fixed number of plain iterations from x, so that
+ * no self-consistent iterations are needed; the dissipation keeps x from drifting away from mu.
+ *
+ * The history is dropped, and the next step has to converge the induced dipoles to start a
+ * new one, when the positions jump (some particle has moved more than maximumDisplacement
+ * since the previous call, e.g. after Context::setPositions()) or the periodic box has changed.
+ * A call with unchanged positions reuses the current auxiliary dipoles.
+ */
+
+class MBPolReferenceExtendedLagrangianDipoles {
+
+public:
+
+    MBPolReferenceExtendedLagrangianDipoles( void );
+
+    ~MBPolReferenceExtendedLagrangianDipoles( ){};
+
+    /**---------------------------------------------------------------------------------------
+
+       Set the coupling of the auxiliary dipoles to the induced dipoles, (omega*dt)^2, and
+       the strength of the dissipation
+
+       @param coupling       coupling, 1.82 by default
+       @param dissipation    dissipation, 0.018 by default
+
+       --------------------------------------------------------------------------------------- */
+
+    void setParameters( double coupling, double dissipation );
+
+    /**---------------------------------------------------------------------------------------
+
+       Drop the history, e.g. when the parameters of the particles have changed
+
+       --------------------------------------------------------------------------------------- */
+
+    void reset( void );
+
+    /**---------------------------------------------------------------------------------------
+
+       Propagate the auxiliary dipoles to the positions of this step, first dropping the history
+       if the positions have jumped or the box has changed
+
+       @param positions             particle positions
+       @param box                   periodic box, a zero box if periodic boundary conditions are not used
+       @param inducedDipole         output auxiliary dipoles
+       @param inducedDipolePolar    output auxiliary dipoles of the polar set
+
+       @return false if there is no history, so that the induced dipoles have to be converged
+
+       --------------------------------------------------------------------------------------- */
+
+    bool propagate( const std::vector<RealVec>& positions, const RealVec& box,
+                    std::vector<RealVec>& inducedDipole, std::vector<RealVec>& inducedDipolePolar );
+
+    /**---------------------------------------------------------------------------------------
+
+       Record the induced dipoles of the positions of the last call to propagate(); after
+       a reset they start the history of the auxiliary dipoles
+
+       @param inducedDipole         induced dipoles
+       @param inducedDipolePolar    induced dipoles of the polar set
+
+       --------------------------------------------------------------------------------------- */
+
+    void record( const std::vector<RealVec>& inducedDipole, const std::vector<RealVec>& inducedDipolePolar );
+
+private:
+
+    static const unsigned int historySize = 6;
+    static const double maximumDisplacement;
+
+    double _coupling;
+    double _dissipation;
+    RealVec _box;
+    std::vector<RealVec> _positions;
+
+    // auxiliary dipoles x(t), x(t-dt), ..., newest first, and the induced dipoles of the last step
+
+    std::deque< std::vector<RealVec> > _auxiliaryDipoles;
+    std::deque< std::vector<RealVec> > _auxiliaryDipolesPolar;
+    std::vector<RealVec> _inducedDipole;
+    std::vector<RealVec> _inducedDipolePolar;
+
+};
+
+// ---------------------------------------------------------------------------------------
+
+#endif // __MBPolReferenceExtendedLagrangianDipoles_H__
@@ -0,0 +1,125 @@
+/* -------------------------------------------------------------------------- *
+ *                               OpenMMMBPol                                 *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2008-2009 Stanford University and the Authors.      *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * This program is free software: you can redistribute it and/or modify       *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * This program is distributed in the hope that it will be useful,            *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ *                                                                            *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.      *
+ * -------------------------------------------------------------------------- */
+
+#include "MBPolReferenceInducedDipolePredictor.h"
+
+// an MD step moves an atom by a few hundredths of a nm at most
+
+const double MBPolReferenceInducedDipolePredictor::maximumDisplacement = 0.05;
+
+MBPolReferenceInducedDipolePredictor::MBPolReferenceInducedDipolePredictor( ) : _samePositions(false) {
+}
+
+void MBPolReferenceInducedDipolePredictor::reset( void ){
+    _positions.clear();
+    _inducedDipoles.clear();
+    _inducedDipolesPolar.clear();
+    _samePositions = false;
+}
+
+unsigned int MBPolReferenceInducedDipolePredictor::getHistorySize( void ) const {
+    return _inducedDipoles.size();
+}
+
+static double binomial( int n, int k ){
+    if( k < 0 || k > n ){
+        return 0.0;
+    }
+    double value = 1.0;
+    for( int ii = 1; ii <= k; ii++ ){
+        value = value*(n - k + ii)/ii;
+    }
+    return value;
+}
+
+bool MBPolReferenceInducedDipolePredictor::predict( const std::vector<RealVec>& positions, const RealVec& box,
+                                                    std::vector<RealVec>& inducedDipole, std::vector<RealVec>& inducedDipolePolar ){
+
+    bool jump = (_positions.size() != positions.size() || box[0] != _box[0] || box[1] != _box[1] || box[2] != _box[2]);
+    _samePositions = !jump;
+    if( !jump ){
+        const double maxDisplacement2 = maximumDisplacement*maximumDisplacement;
+        for( unsigned int ii = 0; ii < positions.size(); ii++ ){
+            const RealVec delta = positions[ii] - _positions[ii];
+            const double displacement2 = delta.dot( delta );
+            if( displacement2 > 0.0 ){
+                _samePositions = false;
+            }
+            if( displacement2 > maxDisplacement2 ){
+                jump = true;
+                break;
+            }
+        }
+    }
+    if( jump ){
+        reset();
+    }
+    _positions = positions;
+    _box       = box;
+
+    if( _inducedDipoles.empty() ){
+        return false;
+    }
+    if( _samePositions ){
+        inducedDipole      = _inducedDipoles.front();
+        inducedDipolePolar = _inducedDipolesPolar.front();
+        return true;
+    }
+
+    // ASPC predictor of order k from the last k+1 steps:
+    // B_j = (-1)^(j+1) j binomial(2k+2, k+1-j)/binomial(2k, k), j = 1 (newest) .. k+1
+
+    int numSteps = _inducedDipoles.size();
+    int order    = numSteps - 1;
+    inducedDipole.assign( positions.size(), RealVec( 0.0, 0.0, 0.0 ) );
+    inducedDipolePolar.assign( positions.size(), RealVec( 0.0, 0.0, 0.0 ) );
+    for( int jj = 1; jj <= numSteps; jj++ ){
+        double coefficient = (jj % 2 == 1 ? 1.0 : -1.0)*jj*binomial( 2*order + 2, order + 1 - jj )/binomial( 2*order, order );
+        const std::vector<RealVec>& dipole      = _inducedDipoles[jj-1];
+        const std::vector<RealVec>& dipolePolar = _inducedDipolesPolar[jj-1];
+        for( unsigned int ii = 0; ii < positions.size(); ii++ ){
+            inducedDipole[ii]      += dipole[ii]*coefficient;
+            inducedDipolePolar[ii] += dipolePolar[ii]*coefficient;
+        }
+    }
+    return true;
+}
+
+void MBPolReferenceInducedDipolePredictor::record( const std::vector<RealVec>& inducedDipole, const std::vector<RealVec>& inducedDipolePolar ){
+
+    if( _samePositions && !_inducedDipoles.empty() ){
+        _inducedDipoles.front()      = inducedDipole;
+        _inducedDipolesPolar.front() = inducedDipolePolar;
+        return;
+    }
+    _inducedDipoles.push_front( inducedDipole );
+    _inducedDipolesPolar.push_front( inducedDipolePolar );
+    if( _inducedDipoles.size() > maximumHistory ){
+        _inducedDipoles.pop_back();
+        _inducedDipolesPolar.pop_back();
+    }
+    _samePositions = true;
+}
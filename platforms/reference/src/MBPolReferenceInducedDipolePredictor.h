@@ -0,0 +1,117 @@
+/* -------------------------------------------------------------------------- *
+ *                               OpenMMMBPol                                 *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2008-2009 Stanford University and the Authors.      *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * This program is free software: you can redistribute it and/or modify       *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * This program is distributed in the hope that it will be useful,            *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ *                                                                            *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.      *
+ * -------------------------------------------------------------------------- */
+
+#ifndef __MBPolReferenceInducedDipolePredictor_H__
+#define __MBPolReferenceInducedDipolePredictor_H__
+
+#include "openmm/reference/RealVec.h"
+#include <deque>
+#include <vector>
+
+using OpenMM::RealVec;
+// ---------------------------------------------------------------------------------------
+
+/**
+ * History of the converged induced dipoles of the last steps, from which the initial guess
+ * of the next step is extrapolated with the predictor of the always stable predictor-corrector
+ * (ASPC) method of Kolafa, J. Comput. Chem. 25, 335 (2004).
+ *
+ * The history is dropped when the positions jump (some particle has moved more than
+ * maximumDisplacement since the previous call, e.g. after Context::setPositions()) or the
+ * periodic box has changed (e.g. after a barostat move), as it no longer describes a trajectory.
+ * A call with unchanged positions reuses the last dipoles and does not extend the history.
+ */
+
+class MBPolReferenceInducedDipolePredictor {
+
+public:
+
+    MBPolReferenceInducedDipolePredictor( void );
+
+    ~MBPolReferenceInducedDipolePredictor( ){};
+
+    /**---------------------------------------------------------------------------------------
+
+       Drop the history, e.g. when the parameters of the particles have changed
+
+       --------------------------------------------------------------------------------------- */
+
+    void reset( void );
+
+    /**---------------------------------------------------------------------------------------
+
+       Get the number of steps in the history
+
+       --------------------------------------------------------------------------------------- */
+
+    unsigned int getHistorySize( void ) const;
+
+    /**---------------------------------------------------------------------------------------
+
+       Predict the induced dipoles for the positions of this step, first dropping the history
+       if the positions have jumped or the box has changed
+
+       @param positions             particle positions
+       @param box                   periodic box, a zero box if periodic boundary conditions are not used
+       @param inducedDipole         output predicted induced dipoles
+       @param inducedDipolePolar    output predicted induced dipoles of the polar set
+
+       @return false if there is no history to predict from
+
+       --------------------------------------------------------------------------------------- */
+
+    bool predict( const std::vector<RealVec>& positions, const RealVec& box,
+                  std::vector<RealVec>& inducedDipole, std::vector<RealVec>& inducedDipolePolar );
+
+    /**---------------------------------------------------------------------------------------
+
+       Record the converged induced dipoles for the positions of the last call to predict()
+
+       @param inducedDipole         converged induced dipoles
+       @param inducedDipolePolar    converged induced dipoles of the polar set
+
+       --------------------------------------------------------------------------------------- */
+
+    void record( const std::vector<RealVec>& inducedDipole, const std::vector<RealVec>& inducedDipolePolar );
+
+private:
+
+    static const unsigned int maximumHistory = 6;
+    static const double maximumDisplacement;
+
+    bool _samePositions;
+    RealVec _box;
+    std::vector<RealVec> _positions;
+
+    // newest first
+    std::deque< std::vector<RealVec> > _inducedDipoles;
+    std::deque< std::vector<RealVec> > _inducedDipolesPolar;
+
+};
+
+// ---------------------------------------------------------------------------------------
+
+#endif // __MBPolReferenceInducedDipolePredictor_H__
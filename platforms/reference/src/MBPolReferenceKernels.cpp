@@ -28,6 +28,7 @@
 #include "MBPolReferenceOneBodyForce.h"
 #include "MBPolReferenceTwoBodyForce.h"
 #include "MBPolReferenceThreeBodyForce.h"
+#include "mbpol_3body_constants.h"
 #include "openmm/reference/ReferencePlatform.h"
 #include "openmm/internal/ContextImpl.h"
 #include "openmm/MBPolElectrostaticsForce.h"
@@ -38,16 +39,43 @@
 #include "openmm/System.h"
 #include "openmm/internal/NonbondedForceImpl.h"
 #include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
 
 #include <cmath>
+#include <algorithm>
+#include <chrono>
 #ifdef _MSC_VER
 #include <windows.h>
 #endif
 
 using namespace  OpenMM;
 using namespace MBPolPlugin;
+
 using namespace std;
 
+// the smallest size not below minimum with no prime factors other than 2, 3, 5 and 7,
+// as NonbondedForceImpl::calcPMEParameters() picks
+
+static int findFFTDimension( int minimum ){
+    if( minimum < 1 ){
+        return 1;
+    }
+    while( true ){
+        int unfactored = minimum;
+        for( int factor = 2; factor < 8; factor++ ){
+            while( unfactored > 1 && unfactored % factor == 0 ){
+                unfactored /= factor;
+            }
+        }
+        if( unfactored == 1 ){
+            return minimum;
+        }
+        minimum++;
+    }
+}
+
 static vector<RealVec>& extractPositions(ContextImpl& context) {
     ReferencePlatform::PlatformData* data = reinterpret_cast<ReferencePlatform::PlatformData*>(context.getPlatformData());
     return *((vector<RealVec>*) data->positions);
@@ -102,6 +130,7 @@ double ReferenceCalcMBPolOneBodyForceKernel::execute(ContextImpl& context, bool
     vector<RealVec>& posData   = extractPositions(context);
     vector<RealVec>& forceData = extractForces(context);
     MBPolReferenceOneBodyForce force;
+    force.setIncludeForces( includeForces );
 
     if (usePBC)
     {
@@ -109,10 +138,14 @@ double ReferenceCalcMBPolOneBodyForceKernel::execute(ContextImpl& context, bool
         RealVec& box = extractBoxSize(context);
         force.setPeriodicBox(box);
     }
-    RealOpenMM energy      = force.calculateForceAndEnergy( numOneBodys, posData, allParticleIndices, forceData );
+    RealOpenMM energy      = computeForceAndEnergy( force, posData, forceData );
     return static_cast<double>(energy);
 }
 
+RealOpenMM ReferenceCalcMBPolOneBodyForceKernel::computeForceAndEnergy(const MBPolReferenceOneBodyForce& force, const vector<RealVec>& posData, vector<RealVec>& forceData) {
+    return force.calculateForceAndEnergy( numOneBodys, posData, allParticleIndices, forceData );
+}
+
 void ReferenceCalcMBPolOneBodyForceKernel::copyParametersToContext(ContextImpl& context, const MBPolOneBodyForce& force) {
     if (numOneBodys != force.getNumOneBodys())
         throw OpenMMException("updateParametersInContext: The number of stretch-bends has changed");
@@ -131,15 +164,20 @@ void ReferenceCalcMBPolOneBodyForceKernel::copyParametersToContext(ContextImpl&
 
 ReferenceCalcMBPolElectrostaticsForceKernel::ReferenceCalcMBPolElectrostaticsForceKernel(std::string name, const Platform& platform, const OpenMM::System& system) : 
          CalcMBPolElectrostaticsForceKernel(name, platform), system(system), numElectrostatics(0), mutualInducedMaxIterations(200), mutualInducedTargetEpsilon(1.0e-03),
-                                                         usePme(false),alphaEwald(0.0), cutoffDistance(1.0) {  
+                                                         usePme(false),alphaEwald(0.0), cutoffDistance(1.0), pmeBSplineOrder(5), ewaldErrorTolerance(1.0e-04), pmeTuningPending(false),
+                                                         electrostaticsEngine(NULL) {  
 
 }
 
 ReferenceCalcMBPolElectrostaticsForceKernel::~ReferenceCalcMBPolElectrostaticsForceKernel() {
+    delete electrostaticsEngine;
 }
 
 void ReferenceCalcMBPolElectrostaticsForceKernel::initialize(const OpenMM::System& system, const MBPolElectrostaticsForce& force) {
 
+    delete electrostaticsEngine;
+    electrostaticsEngine = NULL;
+
     numElectrostatics   = force.getNumElectrostatics();
 
     charges.resize(numElectrostatics);
@@ -173,6 +211,28 @@ void ReferenceCalcMBPolElectrostaticsForceKernel::initialize(const OpenMM::Syste
     mutualInducedTargetEpsilon = force.getMutualInducedTargetEpsilon();
 
     includeChargeRedistribution = force.getIncludeChargeRedistribution();
+    useDipoleFieldTensor = force.getUseDipoleFieldTensor();
+    polarizationSolver = force.getPolarizationSolver();
+    denseSolverThreshold = force.getDenseSolverThreshold();
+    if( polarizationSolver == MBPolElectrostaticsForce::Dense && force.getNonbondedMethod() != MBPolElectrostaticsForce::NoCutoff ){
+        throw OpenMMException("MBPolElectrostaticsForce: the Dense polarization solver needs NoCutoff");
+    }
+    useInducedDipolePredictor = force.getUseInducedDipolePredictor();
+    polarizationType = force.getPolarizationType();
+    double extendedLagrangianCoupling, extendedLagrangianDissipation;
+    force.getExtendedLagrangianParameters(extendedLagrangianCoupling, extendedLagrangianDissipation, extendedLagrangianIterations);
+    if( polarizationType == MBPolElectrostaticsForce::ExtendedLagrangian && extendedLagrangianIterations < 1 ){
+        throw OpenMMException("MBPolElectrostaticsForce: the extended Lagrangian needs at least one iteration per step");
+    }
+    extendedLagrangianDipoles.setParameters(extendedLagrangianCoupling, extendedLagrangianDissipation);
+    extrapolationCoefficients.clear();
+    if( polarizationType == MBPolElectrostaticsForce::Extrapolated ){
+        const std::vector<double>& coefficients = force.getExtrapolationCoefficients();
+        if( coefficients.empty() ){
+            throw OpenMMException("MBPolElectrostaticsForce: the extrapolated polarization needs at least one coefficient");
+        }
+        extrapolationCoefficients.assign(coefficients.begin(), coefficients.end());
+    }
     tholeParameters = force.getTholeParameters();
 
     // PME
@@ -182,8 +242,18 @@ void ReferenceCalcMBPolElectrostaticsForceKernel::initialize(const OpenMM::Syste
         usePme     = true;
         alphaEwald = force.getAEwald();
         cutoffDistance = force.getCutoffDistance();
+        pmeBSplineOrder = force.getPmeBSplineOrder();
+        if( pmeBSplineOrder < 4 || pmeBSplineOrder > 8 ){
+            throw OpenMMException("MBPolElectrostaticsForce: the PME B-spline order must be between 4 and 8");
+        }
+        ewaldErrorTolerance = force.getEwaldErrorTolerance();
+        pmeTuningCacheFile  = force.getPmeTuningCacheFile();
         force.getPmeGridDimensions(pmeGridDimension);
         if (pmeGridDimension[0] == 0 || alphaEwald == 0.0) {
+
+            // with the tuner, these are only the parameters until the first evaluation
+
+            pmeTuningPending = force.getUsePmeTuning();
             NonbondedForce nb;
             nb.setEwaldErrorTolerance(force.getEwaldErrorTolerance());
             nb.setCutoffDistance(force.getCutoffDistance());
@@ -197,11 +267,32 @@ void ReferenceCalcMBPolElectrostaticsForceKernel::initialize(const OpenMM::Syste
             pmeGridDimension[0] = gridSizeX;
             pmeGridDimension[1] = gridSizeY;
             pmeGridDimension[2] = gridSizeZ;
-            std::cout << "Computed PME parameters for MBPolElectrostaticsForce, alphaEwald:" <<
-                    alphaEwald << " pmeGrid: " <<  gridSizeX << "," <<  gridSizeY << ","<<  gridSizeZ << std::endl;
-        }    
+
+            // calcPMEParameters() sizes the grid for order 5, as 2*alpha*box/(3*tol^(1/5)); for
+            // order p the interpolation error goes as the grid spacing to the power p, so the
+            // size is rescaled to 2*alpha*box/(3*tol^(1/p))
+
+            if( pmeBSplineOrder != 5 ){
+                double tolerance = force.getEwaldErrorTolerance();
+                double scale     = pow(tolerance, 0.2 - 1.0/pmeBSplineOrder);
+                for( int ii = 0; ii < 3; ii++ ){
+                    int size = static_cast<int>(ceil(scale*pmeGridDimension[ii]));
+                    pmeGridDimension[ii] = findFFTDimension(std::max(size, pmeBSplineOrder + 1));
+                }
+                gridSizeX = pmeGridDimension[0];
+                gridSizeY = pmeGridDimension[1];
+                gridSizeZ = pmeGridDimension[2];
+            }
+            if( !pmeTuningPending ){
+                std::cout << "Computed PME parameters for MBPolElectrostaticsForce, alphaEwald:" <<
+                        alphaEwald << " pmeGrid: " <<  gridSizeX << "," <<  gridSizeY << ","<<  gridSizeZ << std::endl;
+            }
+        } else {
+            pmeTuningPending = false;
+        }
     } else {
         usePme = false;
+        pmeTuningPending = false;
     }
     return;
 }
@@ -213,12 +304,24 @@ MBPolReferenceElectrostaticsForce* ReferenceCalcMBPolElectrostaticsForceKernel::
     // mbpolReferenceElectrostaticsForce is set to MBPolReferencePmeElectrostaticsForce if 'usePme' is set
     // mbpolReferenceElectrostaticsForce is set to MBPolReferenceElectrostaticsForce otherwise
 
-    MBPolReferenceElectrostaticsForce* mbpolReferenceElectrostaticsForce = NULL;
+    // the instance is kept across calls: setPmeGridDimensions() only rebuilds the FFT plan and the
+    // B-spline moduli when the grid changes, and the work arrays keep their allocations
+
+    if( electrostaticsEngine == NULL ){
+        if( usePme ){
+            electrostaticsEngine = new MBPolReferencePmeElectrostaticsForce( );
+        } else {
+            electrostaticsEngine = new MBPolReferenceElectrostaticsForce( MBPolReferenceElectrostaticsForce::NoCutoff );
+        }
+    }
+    MBPolReferenceElectrostaticsForce* mbpolReferenceElectrostaticsForce = electrostaticsEngine;
+
     if( usePme ) {
 
-         MBPolReferencePmeElectrostaticsForce* mbpolReferencePmeElectrostaticsForce = new MBPolReferencePmeElectrostaticsForce( );
+         MBPolReferencePmeElectrostaticsForce* mbpolReferencePmeElectrostaticsForce = static_cast<MBPolReferencePmeElectrostaticsForce*>(mbpolReferenceElectrostaticsForce);
          mbpolReferencePmeElectrostaticsForce->setAlphaEwald( alphaEwald );
          mbpolReferencePmeElectrostaticsForce->setCutoffDistance( cutoffDistance );
+         mbpolReferencePmeElectrostaticsForce->setPmeBSplineOrder( pmeBSplineOrder );
          mbpolReferencePmeElectrostaticsForce->setPmeGridDimensions( pmeGridDimension );
          RealVec& box = extractBoxSize(context);
          double minAllowedSize = 1.999999*cutoffDistance;
@@ -226,16 +329,23 @@ MBPolReferenceElectrostaticsForce* ReferenceCalcMBPolElectrostaticsForceKernel::
             throw OpenMMException("The periodic box size has decreased to less than twice the nonbonded cutoff.");
          }
          mbpolReferencePmeElectrostaticsForce->setPeriodicBoxSize(box);
-         mbpolReferenceElectrostaticsForce = static_cast<MBPolReferenceElectrostaticsForce*>(mbpolReferencePmeElectrostaticsForce);
-
-    } else {
-         mbpolReferenceElectrostaticsForce = new MBPolReferenceElectrostaticsForce( MBPolReferenceElectrostaticsForce::NoCutoff );
     }
 
+    // the state of the previous step is not carried over: execute() sets the initial dipoles
+    // and the number of iterations again if the predictor or the extended Lagrangian apply
+
+    mbpolReferenceElectrostaticsForce->setInitialInducedDipoles( vector<RealVec>(), vector<RealVec>() );
+    mbpolReferenceElectrostaticsForce->setFixedInducedDipoleIterations( -1 );
+    mbpolReferenceElectrostaticsForce->setIncludeForces( true );
+
     mbpolReferenceElectrostaticsForce->setMutualInducedDipoleTargetEpsilon( mutualInducedTargetEpsilon );
     mbpolReferenceElectrostaticsForce->setMaximumMutualInducedDipoleIterations( mutualInducedMaxIterations );
 
     mbpolReferenceElectrostaticsForce->setIncludeChargeRedistribution(includeChargeRedistribution);
+    mbpolReferenceElectrostaticsForce->setUseDipoleFieldTensor(useDipoleFieldTensor);
+    mbpolReferenceElectrostaticsForce->setPolarizationSolver(static_cast<MBPolReferenceElectrostaticsForce::PolarizationSolver>(polarizationSolver));
+    mbpolReferenceElectrostaticsForce->setDenseSolverThreshold(denseSolverThreshold);
+    mbpolReferenceElectrostaticsForce->setExtrapolationCoefficients(extrapolationCoefficients);
     if (tholeParameters.size() > 0)
         mbpolReferenceElectrostaticsForce->setTholeParameters(tholeParameters);
 
@@ -245,15 +355,46 @@ MBPolReferenceElectrostaticsForce* ReferenceCalcMBPolElectrostaticsForceKernel::
 
 double ReferenceCalcMBPolElectrostaticsForceKernel::execute(ContextImpl& context, bool includeForces, bool includeEnergy) {
 
+    if( pmeTuningPending ){
+        tunePmeParameters( context );
+    }
+
     MBPolReferenceElectrostaticsForce* mbpolReferenceElectrostaticsForce = setupMBPolReferenceElectrostaticsForce( context );
 
     vector<RealVec>& posData   = extractPositions(context);
     vector<RealVec>& forceData = extractForces(context);
+    mbpolReferenceElectrostaticsForce->setIncludeForces( includeForces );
+
+    // with the extended Lagrangian, iterate a fixed number of times from the auxiliary dipoles,
+    // otherwise start from the dipoles extrapolated from the previous steps; the extrapolated
+    // polarization always starts from the dipoles induced by the fixed field
+
+    vector<RealVec> inducedDipole, inducedDipolePolar;
+    RealVec box = usePme ? extractBoxSize(context) : RealVec( 0.0, 0.0, 0.0 );
+    bool useExtendedLagrangian = (polarizationType == MBPolElectrostaticsForce::ExtendedLagrangian);
+    bool usePredictor          = (useInducedDipolePredictor && polarizationType == MBPolElectrostaticsForce::Mutual);
+    if( useExtendedLagrangian ){
+        if( extendedLagrangianDipoles.propagate( posData, box, inducedDipole, inducedDipolePolar ) ){
+            mbpolReferenceElectrostaticsForce->setInitialInducedDipoles( inducedDipole, inducedDipolePolar );
+            mbpolReferenceElectrostaticsForce->setFixedInducedDipoleIterations( extendedLagrangianIterations );
+        }
+    } else if( usePredictor ){
+        if( inducedDipolePredictor.predict( posData, box, inducedDipole, inducedDipolePolar ) ){
+            mbpolReferenceElectrostaticsForce->setInitialInducedDipoles( inducedDipole, inducedDipolePolar );
+        }
+    }
+
     RealOpenMM energy          = mbpolReferenceElectrostaticsForce->calculateForceAndEnergy( posData, charges, moleculeIndices, atomTypes, tholes,
                                                                                          dampingFactors, polarity,
                                                                                          forceData);
 
-    delete mbpolReferenceElectrostaticsForce;
+    if( useExtendedLagrangian ){
+        mbpolReferenceElectrostaticsForce->getInducedDipoles( inducedDipole, inducedDipolePolar );
+        extendedLagrangianDipoles.record( inducedDipole, inducedDipolePolar );
+    } else if( usePredictor ){
+        mbpolReferenceElectrostaticsForce->getInducedDipoles( inducedDipole, inducedDipolePolar );
+        inducedDipolePredictor.record( inducedDipole, inducedDipolePolar );
+    }
 
     return static_cast<double>(energy);
 }
@@ -277,8 +418,6 @@ void ReferenceCalcMBPolElectrostaticsForceKernel::getElectrostaticPotential(Cont
         outputElectrostaticPotential[ii] = potential[ii];
     }
 
-    delete mbpolReferenceElectrostaticsForce;
-
     return;
 }
 
@@ -298,7 +437,183 @@ void ReferenceCalcMBPolElectrostaticsForceKernel::getSystemElectrostaticsMoments
                                                                           dampingFactors, polarity,
                                                                           outputElectrostaticsMoments );
 
-    delete mbpolReferenceElectrostaticsForce;
+    return;
+}
+
+void ReferenceCalcMBPolElectrostaticsForceKernel::getSystemPolarizability(ContextImpl& context, std::vector< double >& outputPolarizability){
+
+    MBPolReferenceElectrostaticsForce* mbpolReferenceElectrostaticsForce = setupMBPolReferenceElectrostaticsForce( context );
+    vector<RealVec>& posData                                     = extractPositions(context);
+    vector<RealOpenMM> polarizability;
+    mbpolReferenceElectrostaticsForce->calculateSystemPolarizability( posData, charges, moleculeIndices, atomTypes, tholes,
+                                                                      dampingFactors, polarity,
+                                                                      polarizability );
+
+    outputPolarizability.assign( polarizability.begin(), polarizability.end() );
+
+    return;
+}
+
+void ReferenceCalcMBPolElectrostaticsForceKernel::getPmeParameters(ContextImpl& context, double& alpha, double& cutoff, int& nx, int& ny, int& nz, int& order){
+
+    if( !usePme ){
+        throw OpenMMException("MBPolElectrostaticsForce: the PME parameters are only defined for the PME nonbonded method");
+    }
+    if( pmeTuningPending ){
+        tunePmeParameters( context );
+    }
+
+    alpha  = alphaEwald;
+    cutoff = cutoffDistance;
+    nx     = pmeGridDimension[0];
+    ny     = pmeGridDimension[1];
+    nz     = pmeGridDimension[2];
+    order  = pmeBSplineOrder;
+
+    return;
+}
+
+// a line of the PME tuning cache is the key, the platform, number of sites, box edges, Ewald error
+// tolerance and requested cutoff, followed by the chosen alpha, cutoff, grid dimensions and order
+
+static std::string getPmeTuningCacheKey( const std::string& platformName, int numSites, const RealVec& box,
+                                         double tolerance, double cutoff ){
+    std::stringstream key;
+    key << platformName << " " << numSites << std::fixed << std::setprecision(6) << " " << box[0] << " " << box[1] << " " << box[2] <<
+           " " << std::scientific << tolerance << std::fixed << " " << cutoff;
+    return key.str();
+}
+
+static bool readPmeTuningCache( const std::string& fileName, const std::string& key, double& alpha, double& cutoff,
+                                std::vector<int>& gridDimension, int& order ){
+
+    std::ifstream cache(fileName.c_str());
+    std::string line;
+    while( std::getline(cache, line) ){
+        if( line.size() > key.size() && line.compare(0, key.size(), key) == 0 && line[key.size()] == ' ' ){
+            std::stringstream values(line.substr(key.size()));
+            gridDimension.resize(3);
+            if( values >> alpha >> cutoff >> gridDimension[0] >> gridDimension[1] >> gridDimension[2] >> order ){
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+static void appendPmeTuningCache( const std::string& fileName, const std::string& key, double alpha, double cutoff,
+                                  const std::vector<int>& gridDimension, int order ){
+
+    // a cache that cannot be written only costs the tuning of the next context
+
+    std::ofstream cache(fileName.c_str(), std::ios::app);
+    cache << key << std::setprecision(17) << " " << alpha << " " << cutoff << " " <<
+             gridDimension[0] << " " << gridDimension[1] << " " << gridDimension[2] << " " << order << std::endl;
+}
+
+// the cutoffs, as fractions of the requested one, and the B-spline orders tried by the tuner,
+// and the number of timed evaluations of each, after one that sets up the grid and FFT; shorter
+// cutoffs than requested are not tried, as the real space error of the induced dipoles decays
+// more slowly than the erfc(alpha*cutoff) that alpha is chosen from
+
+static const double pmeTuningCutoffScales[]   = { 1.0, 1.1, 1.2, 1.3 };
+static const int    pmeTuningMinOrder         = 4;
+static const int    pmeTuningMaxOrder         = 6;
+static const int    pmeTuningEvaluations      = 2;
+
+void ReferenceCalcMBPolElectrostaticsForceKernel::tunePmeParameters(ContextImpl& context){
+
+    pmeTuningPending = false;
+
+    RealVec box = extractBoxSize(context);
+    std::string key;
+    if( !pmeTuningCacheFile.empty() ){
+        key = getPmeTuningCacheKey( context.getPlatform().getName(), numElectrostatics, box, ewaldErrorTolerance, cutoffDistance );
+        double alpha, cutoff;
+        std::vector<int> gridDimension;
+        int order;
+        if( readPmeTuningCache( pmeTuningCacheFile, key, alpha, cutoff, gridDimension, order ) ){
+            alphaEwald       = static_cast<RealOpenMM>(alpha);
+            cutoffDistance   = static_cast<RealOpenMM>(cutoff);
+            pmeGridDimension = gridDimension;
+            pmeBSplineOrder  = order;
+            std::cout << "Cached PME parameters for MBPolElectrostaticsForce, alphaEwald:" << alphaEwald << " cutoff: " << cutoffDistance <<
+                    " pmeGrid: " << pmeGridDimension[0] << "," << pmeGridDimension[1] << "," << pmeGridDimension[2] <<
+                    " order: " << pmeBSplineOrder << std::endl;
+            return;
+        }
+    }
+
+    // alpha keeps erfc(alpha*cutoff) at the tolerance, and the grid is sized for it as in initialize();
+    // longer cutoffs than requested keep clear of the half box that setupMBPolReferenceElectrostaticsForce() checks,
+    // and a setting is dropped once an evaluation takes twice as long as the fastest so far
+
+    vector<RealVec>& posData  = extractPositions(context);
+    vector<RealVec> scratchForces( posData.size() );
+    double requestedCutoff    = cutoffDistance;
+    double shortestEdge       = std::min( box[0], std::min( box[1], box[2] ) );
+
+    double bestTime           = -1.0;
+    RealOpenMM bestAlpha      = alphaEwald;
+    RealOpenMM bestCutoff     = cutoffDistance;
+    std::vector<int> bestGrid = pmeGridDimension;
+    int bestOrder             = pmeBSplineOrder;
+    int numTimed              = 0;
+
+    int numScales = sizeof(pmeTuningCutoffScales)/sizeof(pmeTuningCutoffScales[0]);
+    for( int ii = 0; ii < numScales; ii++ ){
+        double cutoff = pmeTuningCutoffScales[ii]*requestedCutoff;
+        if( ii > 0 && cutoff > 0.45*shortestEdge ){
+            continue;
+        }
+        double alpha = sqrt(-log(2.0*ewaldErrorTolerance))/cutoff;
+        for( int order = pmeTuningMinOrder; order <= pmeTuningMaxOrder; order++ ){
+
+            alphaEwald      = static_cast<RealOpenMM>(alpha);
+            cutoffDistance  = static_cast<RealOpenMM>(cutoff);
+            pmeBSplineOrder = order;
+            for( int jj = 0; jj < 3; jj++ ){
+                int size = static_cast<int>(ceil(2.0*alpha*box[jj]/(3.0*pow(ewaldErrorTolerance, 1.0/order))));
+                pmeGridDimension[jj] = findFFTDimension(std::max(size, order + 1));
+            }
+
+            double time = -1.0;
+            for( int kk = 0; kk <= pmeTuningEvaluations; kk++ ){
+                MBPolReferenceElectrostaticsForce* mbpolReferenceElectrostaticsForce = setupMBPolReferenceElectrostaticsForce( context );
+                std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                mbpolReferenceElectrostaticsForce->calculateForceAndEnergy( posData, charges, moleculeIndices, atomTypes, tholes,
+                                                                           dampingFactors, polarity, scratchForces );
+                double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                if( kk > 0 && (time < 0.0 || seconds < time) ){
+                    time = seconds;
+                }
+                if( kk > 0 && bestTime > 0.0 && time > 2.0*bestTime ){
+                    break;
+                }
+            }
+            numTimed++;
+
+            if( bestTime < 0.0 || time < bestTime ){
+                bestTime   = time;
+                bestAlpha  = alphaEwald;
+                bestCutoff = cutoffDistance;
+                bestGrid   = pmeGridDimension;
+                bestOrder  = pmeBSplineOrder;
+            }
+        }
+    }
+
+    alphaEwald       = bestAlpha;
+    cutoffDistance   = bestCutoff;
+    pmeGridDimension = bestGrid;
+    pmeBSplineOrder  = bestOrder;
+    std::cout << "Tuned PME parameters for MBPolElectrostaticsForce over " << numTimed << " settings, alphaEwald:" << alphaEwald <<
+            " cutoff: " << cutoffDistance << " pmeGrid: " << pmeGridDimension[0] << "," << pmeGridDimension[1] << "," << pmeGridDimension[2] <<
+            " order: " << pmeBSplineOrder << " time: " << bestTime << " s" << std::endl;
+
+    if( !pmeTuningCacheFile.empty() ){
+        appendPmeTuningCache( pmeTuningCacheFile, key, alphaEwald, cutoffDistance, pmeGridDimension, pmeBSplineOrder );
+    }
 
     return;
 }
@@ -321,6 +636,11 @@ void ReferenceCalcMBPolElectrostaticsForceKernel::copyParametersToContext(Contex
         dampingFactors[i] = (RealOpenMM) dampingFactorD;
         polarity[i] = (RealOpenMM) polarityD;
     }
+
+    // dipoles of the old parameters are no use for extrapolation
+
+    inducedDipolePredictor.reset();
+    extendedLagrangianDipoles.reset();
 }
 
 
@@ -330,12 +650,14 @@ ReferenceCalcMBPolTwoBodyForceKernel::ReferenceCalcMBPolTwoBodyForceKernel(std::
     usePBC = 0;
     cutoff = 1.0e+10;
     neighborList = NULL;
+    monomers = new MBPolReferenceTwoBodyMonomers();
 }
 
 ReferenceCalcMBPolTwoBodyForceKernel::~ReferenceCalcMBPolTwoBodyForceKernel() {
     if( neighborList ){
         delete neighborList;
     } 
+    delete monomers;
 }
 
 void ReferenceCalcMBPolTwoBodyForceKernel::initialize(const OpenMM::System& system, const MBPolTwoBodyForce& force) {
@@ -357,30 +679,35 @@ void ReferenceCalcMBPolTwoBodyForceKernel::initialize(const OpenMM::System& syst
     cutoff                 = force.getCutoff();
     neighborList           = useCutoff ? new NeighborList() : NULL;
 
+    neighborListSkin.initialize( cutoff, force.getNeighborListSkin() );
+    oxygenPositions.resize(numParticles);
+    allExclusions.resize(numParticles);
+
 }
 
 double ReferenceCalcMBPolTwoBodyForceKernel::execute(ContextImpl& context, bool includeForces, bool includeEnergy) {
 
     vector<RealVec>& allPosData   = extractPositions(context);
-    vector<RealVec> posData;
-    posData.resize(numParticles);
-    vector<set<int> > allExclusions;
-    allExclusions.resize(numParticles);
-    // posData has only oxygens
+    // oxygenPositions has only oxygens
     for( int ii = 0; ii < numParticles; ii++ ){
-        posData[ii] = allPosData[allParticleIndices[ii][0]];
+        oxygenPositions[ii] = allPosData[allParticleIndices[ii][0]];
     }
     vector<RealVec>& forceData = extractForces(context);
     MBPolReferenceTwoBodyForce TwoBodyForce;
     RealOpenMM energy;
     TwoBodyForce.setCutoff( cutoff );
-    // neighborList created only with oxygens, then allParticleIndices is used to get reference to the hydrogens
+    TwoBodyForce.setIncludeForces( includeForces );
+    // neighborList created only with oxygens, then allParticleIndices is used to get reference to the hydrogens;
+    // it includes the pairs within cutoff + skin, the pairs beyond the cutoff are skipped by TwoBodyForce
 
+    double listDistance = neighborListSkin.update( oxygenPositions, extractBoxSize(context), usePBC );
+    if( listDistance > 0.0 ){
 #if OPENMM_MAJOR_VERSION == 6 && OPENMM_MINOR_VERSION <= 2
-    computeNeighborListVoxelHash( *neighborList, numParticles, posData, allExclusions, extractBoxSize(context), usePBC, cutoff, 0.0, false);
+        computeNeighborListVoxelHash( *neighborList, numParticles, oxygenPositions, allExclusions, extractBoxSize(context), usePBC, listDistance, 0.0, false);
 #else
-    computeNeighborListVoxelHash( *neighborList, numParticles, posData, allExclusions, extractBoxVectors(context), usePBC, cutoff, 0.0, false);
+        computeNeighborListVoxelHash( *neighborList, numParticles, oxygenPositions, allExclusions, extractBoxVectors(context), usePBC, listDistance, 0.0, false);
 #endif
+    }
     if( usePBC ){
         TwoBodyForce.setNonbondedMethod( MBPolReferenceTwoBodyForce::CutoffPeriodic);
         RealVec& box = extractBoxSize(context);
@@ -392,12 +719,24 @@ double ReferenceCalcMBPolTwoBodyForceKernel::execute(ContextImpl& context, bool
     } else {
         TwoBodyForce.setNonbondedMethod( MBPolReferenceTwoBodyForce::CutoffNonPeriodic);
     }
+    // the extra points of every molecule are computed once and the forces on them are
+    // distributed to the atoms in a single pass after all dimers
+    monomers->compute( allPosData, allParticleIndices, extractBoxSize(context), usePBC );
+    TwoBodyForce.setMonomers( monomers );
+    monomerForces.assign( monomers->getNumForces(), RealVec( 0.0, 0.0, 0.0 ) );
     // here we need allPosData, every atom!
-    energy  = TwoBodyForce.calculateForceAndEnergy( numParticles, allPosData, allParticleIndices, *neighborList, forceData);
+    energy  = computeForceAndEnergy( TwoBodyForce, allPosData, monomerForces );
+    if( includeForces ){
+        monomers->distributeForces( allParticleIndices, monomerForces, forceData );
+    }
 
     return static_cast<double>(energy);
 }
 
+RealOpenMM ReferenceCalcMBPolTwoBodyForceKernel::computeForceAndEnergy(const MBPolReferenceTwoBodyForce& force, const vector<RealVec>& allPosData, vector<RealVec>& forceData) {
+    return force.calculateForceAndEnergy( numParticles, allPosData, allParticleIndices, *neighborList, polynomialScratch, forceData );
+}
+
 void ReferenceCalcMBPolTwoBodyForceKernel::copyParametersToContext(ContextImpl& context, const MBPolTwoBodyForce& force) {
     if (numParticles != force.getNumParticles())
         throw OpenMMException("updateParametersInContext: The number of particles has changed");
@@ -411,6 +750,10 @@ void ReferenceCalcMBPolTwoBodyForceKernel::copyParametersToContext(ContextImpl&
         allParticleIndices[i] = particleIndices;
 
     }
+
+    // the molecules may have changed, start again from a fresh neighbor list
+
+    neighborListSkin.initialize( cutoff, force.getNeighborListSkin() );
 }
 
 ReferenceCalcMBPolThreeBodyForceKernel::ReferenceCalcMBPolThreeBodyForceKernel(std::string name, const Platform& platform, const OpenMM::System& system) :
@@ -419,12 +762,17 @@ ReferenceCalcMBPolThreeBodyForceKernel::ReferenceCalcMBPolThreeBodyForceKernel(s
     usePBC = 0;
     cutoff = 1.0e+10;
     neighborList = NULL;
+    variables = NULL;
+    neighborListThreads = NULL;
 }
 
 ReferenceCalcMBPolThreeBodyForceKernel::~ReferenceCalcMBPolThreeBodyForceKernel() {
     if( neighborList ){
         delete neighborList;
     }
+    if( variables ){
+        delete variables;
+    }
 }
 
 void ReferenceCalcMBPolThreeBodyForceKernel::initialize(const OpenMM::System& system, const MBPolThreeBodyForce& force) {
@@ -444,27 +792,39 @@ void ReferenceCalcMBPolThreeBodyForceKernel::initialize(const OpenMM::System& sy
     useCutoff              = (force.getNonbondedMethod() != MBPolThreeBodyForce::NoCutoff);
     usePBC                 = (force.getNonbondedMethod() == MBPolThreeBodyForce::CutoffPeriodic);
     cutoff                 = force.getCutoff();
-    neighborList           = useCutoff ? new ThreeNeighborList() : NULL;
+    neighborList           = useCutoff ? new ThreeNeighborPairList() : NULL;
+    variables              = useCutoff ? new MBPolReferenceThreeBodyVariables() : NULL;
+    tripletDistance        = std::min( cutoff, r3f/nm_to_A );
+
+    neighborListSkin.initialize( tripletDistance, force.getNeighborListSkin() );
+    oxygenPositions.resize(numParticles);
 
 }
 
 double ReferenceCalcMBPolThreeBodyForceKernel::execute(ContextImpl& context, bool includeForces, bool includeEnergy) {
 
     vector<RealVec>& allPosData   = extractPositions(context);
-    vector<RealVec> posData;
-    posData.resize(numParticles);
-    vector<set<int> > allExclusions;
-    allExclusions.resize(numParticles);
-    // posData has only oxygens
+    // oxygenPositions has only oxygens
     for( int ii = 0; ii < numParticles; ii++ ){
-        posData[ii] = allPosData[allParticleIndices[ii][0]];
+        oxygenPositions[ii] = allPosData[allParticleIndices[ii][0]];
     }
     vector<RealVec>& forceData = extractForces(context);
     MBPolReferenceThreeBodyForce force;
     RealOpenMM energy;
     force.setCutoff( cutoff );
-    // neighborList created only with oxygens, then allParticleIndices is used to get reference to the hydrogens
-    computeThreeNeighborListVoxelHash( *neighborList, numParticles, posData, extractBoxSize(context), usePBC, cutoff, 0.0);
+    force.setIncludeForces( includeForces );
+    // neighborList created only with oxygens, then allParticleIndices is used to get reference to the hydrogens;
+    // it holds the pairs within tripletDistance + skin, the triplets are generated from the pairs within
+    // tripletDistance at the current positions
+
+    periodicBoxSize = extractBoxSize(context);
+    double listDistance = neighborListSkin.update( oxygenPositions, periodicBoxSize, usePBC );
+    if( listDistance > 0.0 ){
+        neighborList->build( numParticles, oxygenPositions, periodicBoxSize, usePBC, listDistance, 0.0, neighborListThreads );
+    }
+    // the variables of a molecule or of a pair are computed once and shared by all the triplets they belong to
+    variables->compute( allPosData, allParticleIndices, *neighborList, periodicBoxSize, usePBC, neighborListThreads );
+    force.setVariables( variables );
     if( usePBC ){
         force.setNonbondedMethod( MBPolReferenceThreeBodyForce::CutoffPeriodic);
         RealVec& box = extractBoxSize(context);
@@ -477,11 +837,25 @@ double ReferenceCalcMBPolThreeBodyForceKernel::execute(ContextImpl& context, boo
         force.setNonbondedMethod( MBPolReferenceThreeBodyForce::CutoffNonPeriodic);
     }
     // here we need allPosData, every atom!
-    energy  = force.calculateForceAndEnergy( numParticles, allPosData, allParticleIndices, *neighborList, forceData);
+    energy  = computeForceAndEnergy( force, allPosData, forceData );
 
     return static_cast<double>(energy);
 }
 
+RealOpenMM ReferenceCalcMBPolThreeBodyForceKernel::computeForceAndEnergy(const MBPolReferenceThreeBodyForce& force, const vector<RealVec>& allPosData, vector<RealVec>& forceData) {
+    return computeTriplets( force, allPosData, 0, numParticles, triplets, forceData );
+}
+
+RealOpenMM ReferenceCalcMBPolThreeBodyForceKernel::computeTriplets(const MBPolReferenceThreeBodyForce& force, const vector<RealVec>& allPosData,
+                                                                   int firstMolecule, int lastMolecule, ThreeNeighborList& block, vector<RealVec>& forceData) const {
+    ThreeNeighborTripletGenerator generator( *neighborList, oxygenPositions, periodicBoxSize, usePBC, tripletDistance, 0.0, firstMolecule, lastMolecule );
+    RealOpenMM energy = 0.0;
+    while( generator.next( block, tripletBlockSize ) ){
+        energy += force.calculateForceAndEnergy( numParticles, allPosData, allParticleIndices, block, forceData );
+    }
+    return energy;
+}
+
 void ReferenceCalcMBPolThreeBodyForceKernel::copyParametersToContext(ContextImpl& context, const MBPolThreeBodyForce& force) {
     if (numParticles != force.getNumParticles())
         throw OpenMMException("updateParametersInContext: The number of particles has changed");
@@ -495,4 +869,8 @@ void ReferenceCalcMBPolThreeBodyForceKernel::copyParametersToContext(ContextImpl
         allParticleIndices[i] = particleIndices;
 
     }
+
+    // the molecules may have changed, start again from a fresh neighbor list
+
+    neighborListSkin.initialize( tripletDistance, force.getNeighborListSkin() );
 }
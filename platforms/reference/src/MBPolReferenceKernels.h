@@ -33,11 +33,21 @@
 #include "MBPolReferenceElectrostaticsForce.h"
 #include "openmm/reference/ReferenceNeighborList.h"
 #include "ReferenceThreeNeighborList.h"
+#include "MBPolReferenceVerletSkin.h"
+#include "MBPolReferenceInducedDipolePredictor.h"
+#include "MBPolReferenceExtendedLagrangianDipoles.h"
 #include "openmm/reference/SimTKOpenMMRealType.h"
 #include <string>
+#include <set>
 
 using std::string;
 
+class MBPolReferenceOneBodyForce;
+class MBPolReferenceTwoBodyForce;
+class MBPolReferenceTwoBodyMonomers;
+class MBPolReferenceThreeBodyForce;
+class MBPolReferenceThreeBodyVariables;
+
 namespace MBPolPlugin {
 /**
  * This kernel is invoked by MBPolOneBodyForce to calculate the forces acting on the system and the energy of the system.
@@ -69,7 +79,17 @@ public:
      * @param force      the MBPolOneBodyForce to copy the parameters from
      */
     void copyParametersToContext(ContextImpl& context, const MBPolOneBodyForce& force);
-private:
+protected:
+    /**
+     * Evaluate the one-body force of all monomers.
+     *
+     * @param force          the configured MBPolReferenceOneBodyForce
+     * @param posData        positions of all particles
+     * @param forceData      add forces to this vector
+     * @return the potential energy due to the force
+     */
+    virtual RealOpenMM computeForceAndEnergy(const MBPolReferenceOneBodyForce& force, const std::vector<RealVec>& posData, std::vector<RealVec>& forceData);
+
     int numOneBodys;
     std::vector< std::vector<int> > allParticleIndices;
     const System& system;
@@ -91,13 +111,15 @@ public:
      */
     void initialize(const System& system, const MBPolElectrostaticsForce& force);
     /**
-     * Setup for MBPolReferenceElectrostaticsForce instance. 
+     * Setup for MBPolReferenceElectrostaticsForce instance. The instance is created on the first call
+     * and kept by the kernel, so that its FFT plan, B-spline moduli and work arrays are reused; later
+     * calls only update the box, the PME grid if it changed, and the options.
      *
      * @param context        the current context
      *
-     * @return pointer to initialized instance of MBPolReferenceElectrostaticsForce
+     * @return pointer to initialized instance of MBPolReferenceElectrostaticsForce, owned by the kernel
      */
-    MBPolReferenceElectrostaticsForce* setupMBPolReferenceElectrostaticsForce(ContextImpl& context );
+    virtual MBPolReferenceElectrostaticsForce* setupMBPolReferenceElectrostaticsForce(ContextImpl& context );
     /**
      * Execute the kernel to calculate the forces and/or energy.
      *
@@ -129,6 +151,26 @@ public:
                                       quadrupole_zx, quadrupole_zy, quadrupole_zz )
      */
     void getSystemElectrostaticsMoments(ContextImpl& context, std::vector< double >& outputElectrostaticsMoments);
+
+    /**
+     * Get the system polarizability.
+     *
+     * @param context                context
+     * @param outputPolarizability   polarizability (xx, xy, xz, yx, yy, yz, zx, zy, zz)
+     */
+    void getSystemPolarizability(ContextImpl& context, std::vector< double >& outputPolarizability);
+    /**
+     * Get the PME parameters in use; if the tuner is on and has not run yet, it runs first.
+     *
+     * @param context    context
+     * @param alpha      the Ewald alpha parameter
+     * @param cutoff     the real space cutoff distance
+     * @param nx         the number of grid points along the X axis
+     * @param ny         the number of grid points along the Y axis
+     * @param nz         the number of grid points along the Z axis
+     * @param order      the B-spline order
+     */
+    void getPmeParameters(ContextImpl& context, double& alpha, double& cutoff, int& nx, int& ny, int& nz, int& order);
     /**
      * Copy changed parameters over to a context.
      *
@@ -137,7 +179,16 @@ public:
      */
     void copyParametersToContext(ContextImpl& context, const MBPolElectrostaticsForce& force);
 
-private:
+protected:
+
+    /**
+     * Time a few evaluations at the current positions for each cutoff and B-spline order the tuner
+     * tries, with the Ewald alpha and grid that meet the error tolerance in the current box, and keep
+     * the fastest; the choice is looked up in, or appended to, the cache file if one is set.
+     *
+     * @param context    context
+     */
+    void tunePmeParameters(ContextImpl& context);
 
     int numElectrostatics;
     MBPolElectrostaticsForce::NonbondedMethod nonbondedMethod;
@@ -150,6 +201,15 @@ private:
     std::vector<int>   moleculeIndices;
     std::vector<int>   atomTypes;
     bool includeChargeRedistribution;
+    bool useDipoleFieldTensor;
+    int polarizationSolver;
+    int denseSolverThreshold;
+    bool useInducedDipolePredictor;
+    MBPolReferenceInducedDipolePredictor inducedDipolePredictor;
+    int polarizationType;
+    int extendedLagrangianIterations;
+    MBPolReferenceExtendedLagrangianDipoles extendedLagrangianDipoles;
+    std::vector<RealOpenMM> extrapolationCoefficients;
     std::vector<RealOpenMM> tholeParameters;
 
     int mutualInducedMaxIterations;
@@ -159,6 +219,12 @@ private:
     RealOpenMM alphaEwald;
     RealOpenMM cutoffDistance;
     std::vector<int> pmeGridDimension;
+    int pmeBSplineOrder;
+    RealOpenMM ewaldErrorTolerance;
+    bool pmeTuningPending;
+    std::string pmeTuningCacheFile;
+
+    MBPolReferenceElectrostaticsForce* electrostaticsEngine;
 
     const System& system;
 };
@@ -193,7 +259,18 @@ public:
      * @param force      the MBPolTwoBodyForce to copy the parameters from
      */
     void copyParametersToContext(ContextImpl& context, const MBPolTwoBodyForce& force);
-private:
+protected:
+    /**
+     * Evaluate the two-body force over the neighbor list.
+     *
+     * @param force          the configured MBPolReferenceTwoBodyForce
+     * @param allPosData     positions of all particles
+     * @param forceData      add forces to this vector; the forces on the particles followed by
+     *                       the forces on the extra points (see MBPolReferenceTwoBodyMonomers)
+     * @return the potential energy due to the force
+     */
+    virtual RealOpenMM computeForceAndEnergy(const MBPolReferenceTwoBodyForce& force, const std::vector<RealVec>& allPosData, std::vector<RealVec>& forceData);
+
     int numParticles;
     int useCutoff;
     int usePBC;
@@ -201,6 +278,16 @@ private:
     std::vector< std::vector<int> > allParticleIndices;
     const System& system;
     NeighborList* neighborList;
+    // the neighbor list is kept between steps and only rebuilt when neighborListSkin asks for it
+    MBPolReferenceVerletSkin neighborListSkin;
+    std::vector<RealVec> oxygenPositions;
+    std::vector< std::set<int> > allExclusions;
+    // extra points of the molecules, computed each step, and the forces on
+    // the particles followed by the forces on the extra points
+    MBPolReferenceTwoBodyMonomers* monomers;
+    std::vector<RealVec> monomerForces;
+    // work space of the batched 2-body polynomial
+    std::vector<double> polynomialScratch;
 };
 
 /**
@@ -233,14 +320,52 @@ public:
      * @param force      the MBPolThreeBodyForce to copy the parameters from
      */
     void copyParametersToContext(ContextImpl& context, const MBPolThreeBodyForce& force);
-private:
+protected:
+    /**
+     * Evaluate the three-body force over the triplets of the neighbor list.
+     *
+     * @param force          the configured MBPolReferenceThreeBodyForce
+     * @param allPosData     positions of all particles
+     * @param forceData      add forces to this vector
+     * @return the potential energy due to the force
+     */
+    virtual RealOpenMM computeForceAndEnergy(const MBPolReferenceThreeBodyForce& force, const std::vector<RealVec>& allPosData, std::vector<RealVec>& forceData);
+    /**
+     * Evaluate the three-body force over the triplets centered on the molecules [firstMolecule, lastMolecule),
+     * generated tripletBlockSize at a time.
+     *
+     * @param force          the configured MBPolReferenceThreeBodyForce
+     * @param allPosData     positions of all particles
+     * @param firstMolecule  index of the first molecule
+     * @param lastMolecule   one past the index of the last molecule
+     * @param block          buffer for a block of triplets
+     * @param forceData      add forces to this vector
+     * @return the potential energy due to the force
+     */
+    RealOpenMM computeTriplets(const MBPolReferenceThreeBodyForce& force, const std::vector<RealVec>& allPosData,
+                               int firstMolecule, int lastMolecule, ThreeNeighborList& block, std::vector<RealVec>& forceData) const;
+
+    static const unsigned int tripletBlockSize = 256;
+
     int numParticles;
     int useCutoff;
     int usePBC;
     double cutoff;
     std::vector< std::vector<int> > allParticleIndices;
     const System& system;
-    ThreeNeighborList* neighborList;
+    // oxygen pairs the triplets are generated from; the triplets are never stored as a whole
+    ThreeNeighborPairList* neighborList;
+    // the neighbor list is kept between steps and only rebuilt when neighborListSkin asks for it
+    MBPolReferenceVerletSkin neighborListSkin;
+    // polynomial variables of the molecules and of the pairs of neighborList, computed each step
+    MBPolReferenceThreeBodyVariables* variables;
+    std::vector<RealVec> oxygenPositions;
+    RealVec periodicBoxSize;
+    // range of the O-O pairs of a triplet: the cutoff or the range of the 3-body switch if shorter
+    double tripletDistance;
+    ThreeNeighborList triplets;
+    // if set, the neighbor list and the variables are computed by the threads of this pool
+    OpenMM::ThreadPool* neighborListThreads;
 };
 
 } // namespace MBPolPlugin
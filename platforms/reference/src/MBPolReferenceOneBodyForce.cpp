@@ -43,7 +43,7 @@ using OpenMM::RealVec;
    --------------------------------------------------------------------------------------- */
 
 
-MBPolReferenceOneBodyForce::MBPolReferenceOneBodyForce( ) : _nonbondedMethod(NonPeriodic) {
+MBPolReferenceOneBodyForce::MBPolReferenceOneBodyForce( ) : _nonbondedMethod(NonPeriodic), _includeForces(true) {
 
     _periodicBoxDimensions = RealVec( 0.0, 0.0, 0.0 );
 }
@@ -65,6 +65,10 @@ void MBPolReferenceOneBodyForce::setNonbondedMethod( MBPolReferenceOneBodyForce:
     _nonbondedMethod = nonbondedMethod;
 }
 
+void MBPolReferenceOneBodyForce::setIncludeForces( bool includeForces ){
+    _includeForces = includeForces;
+}
+
 
 double MBPolReferenceOneBodyForce::calculateOneBodyIxn(const RealVec& positionO, const RealVec& positionH1, const RealVec& positionH2,
         RealVec& forceO, RealVec& forceH1, RealVec& forceH2) const
@@ -141,6 +145,17 @@ double MBPolReferenceOneBodyForce::calculateOneBodyIxn(const RealVec& positionO,
 
     double sum0(0), sum1(0), sum2(0), sum3(0);
 
+    const double cal2joule = 4.184;
+
+    if (!_includeForces) {
+        for (size_t j = 1; j < 245; ++j)
+            sum0 += c5z[j]*(fmat[0][idx1[j]]*fmat[1][idx2[j]]
+                          + fmat[0][idx2[j]]*fmat[1][idx1[j]])*fmat[2][idx3[j]];
+
+        const double Vc = 2*c5z[0] + efac*sum0;
+        return (Va + Vb + Vc + 0.44739574026257)*cm1_kcalmol*cal2joule;
+    }
+
     for (size_t j = 1; j < 245; ++j) {
         const size_t inI = idx1[j];
         const size_t inJ = idx2[j];
@@ -176,8 +191,6 @@ double MBPolReferenceOneBodyForce::calculateOneBodyIxn(const RealVec& positionO,
 
     const double dVcdcth = efac*sum3;
 
-    double cal2joule = 4.184;
-
     double fH1, fH2;
 
     for (size_t i = 0; i < 3; ++i) {
@@ -203,15 +216,20 @@ double MBPolReferenceOneBodyForce::calculateOneBodyIxn(const RealVec& positionO,
 
 RealOpenMM MBPolReferenceOneBodyForce::calculateForceAndEnergy( int numOneBodys, const std::vector<RealVec>& particlePositions, const std::vector<std::vector<int> >& allParticleIndices,
                                                                        vector<RealVec>& forces) const {
+    return calculateForceAndEnergy( 0, static_cast<unsigned int>(numOneBodys), particlePositions, allParticleIndices, forces );
+}
+
+RealOpenMM MBPolReferenceOneBodyForce::calculateForceAndEnergy( unsigned int firstMonomer, unsigned int lastMonomer, const std::vector<RealVec>& particlePositions,
+                                                                const std::vector<std::vector<int> >& allParticleIndices, vector<RealVec>& forces) const {
     RealOpenMM energy      = 0.0; 
-    for (unsigned int ii = 0; ii < static_cast<unsigned int>(numOneBodys); ii++) {
-        std::vector<RealVec> allPositions;
+    for (unsigned int ii = firstMonomer; ii < lastMonomer; ii++) {
+        RealVec allPositions[3];
 
         for (unsigned int i=0; i < 3; i++)
-            allPositions.push_back(particlePositions[allParticleIndices[ii][i]]);
+            allPositions[i] = particlePositions[allParticleIndices[ii][i]];
 
         if( _nonbondedMethod == Periodic )
-            imageMolecules(_periodicBoxDimensions, allPositions);
+            imageMolecules(_periodicBoxDimensions, allPositions, 1);
 
         energy                 +=  calculateOneBodyIxn(allPositions[0], allPositions[1], allPositions[2],
                 forces[allParticleIndices[ii][0]], forces[allParticleIndices[ii][1]], forces[allParticleIndices[ii][2]]);
@@ -52,6 +52,18 @@ public:
     RealOpenMM calculateForceAndEnergy( int numOneBodys, const std::vector<RealVec>& particlePositions, const std::vector<std::vector<int> >& allParticleIndices,
                                                                            std::vector<RealVec>& forces) const;
 
+    /**---------------------------------------------------------------------------------------
+    
+       Calculate the one-body ixn of the monomers [firstMonomer, lastMonomer);
+       used to split the monomers between threads
+    
+       @return energy
+    
+       --------------------------------------------------------------------------------------- */
+
+    RealOpenMM calculateForceAndEnergy( unsigned int firstMonomer, unsigned int lastMonomer, const std::vector<RealVec>& particlePositions,
+                                        const std::vector<std::vector<int> >& allParticleIndices, std::vector<RealVec>& forces) const;
+
 
     void setPeriodicBox( const RealVec& box );
 
@@ -61,11 +73,21 @@ public:
 
     void setNonbondedMethod( NonbondedMethod nonbondedMethod );
 
+    /**---------------------------------------------------------------------------------------
+    
+       Set whether forces are computed; if not, calculateForceAndEnergy() only returns
+       the energy and skips the derivatives. The default is true
+    
+       --------------------------------------------------------------------------------------- */
+
+    void setIncludeForces( bool includeForces );
+
 
 private:
 
     NonbondedMethod _nonbondedMethod;
     RealVec _periodicBoxDimensions;
+    bool _includeForces;
 
     /**---------------------------------------------------------------------------------------
     
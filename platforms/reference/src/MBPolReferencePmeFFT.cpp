@@ -0,0 +1,306 @@
+/* -------------------------------------------------------------------------- *
+ *                               OpenMMMBPol                                 *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2008-2009 Stanford University and the Authors.      *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * This program is free software: you can redistribute it and/or modify       *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * This program is distributed in the hope that it will be useful,            *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ *                                                                            *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.      *
+ * -------------------------------------------------------------------------- */
+
+#include "MBPolReferencePmeFFT.h"
+#include <cmath>
+
+#ifdef MBPOL_USE_FFTW
+
+#include <fftw3.h>
+#include <map>
+#include <pthread.h>
+
+// the grids are handed to FFTW as double and fftw_complex arrays
+
+typedef char RealOpenMMMustBeDouble[sizeof(RealOpenMM) == sizeof(double) ? 1 : -1];
+
+enum PlanKind { ComplexForward, ComplexBackward, RealToComplex, ComplexToReal };
+
+// The plans of every grid used in the process are made once and kept. The FFTW
+// planner is not thread safe, so the cache is guarded; executing a plan is.
+
+static pthread_mutex_t planCacheLock = PTHREAD_MUTEX_INITIALIZER;
+static std::map<std::vector<int>, fftw_plan> planCache;
+
+static fftw_plan getPlan( const int size[3], PlanKind kind ){
+
+    std::vector<int> key( size, size + 3 );
+    key.push_back( kind );
+
+    pthread_mutex_lock( &planCacheLock );
+    std::map<std::vector<int>, fftw_plan>::const_iterator cached = planCache.find( key );
+    if( cached != planCache.end() ){
+        fftw_plan plan = cached->second;
+        pthread_mutex_unlock( &planCacheLock );
+        return plan;
+    }
+
+    // FFTW_MEASURE overwrites the arrays it plans on, so scratch arrays are used;
+    // FFTW_UNALIGNED lets the plan run on any grid with the new-array execute functions
+
+    unsigned int flags           = FFTW_MEASURE | FFTW_UNALIGNED;
+    fftw_complex* complexScratch = fftw_alloc_complex( size[0]*size[1]*size[2] );
+    double* realScratch          = fftw_alloc_real( size[0]*size[1]*size[2] );
+    fftw_plan plan;
+    if( kind == ComplexForward ){
+        plan = fftw_plan_dft_3d( size[0], size[1], size[2], complexScratch, complexScratch, FFTW_FORWARD, flags );
+    } else if( kind == ComplexBackward ){
+        plan = fftw_plan_dft_3d( size[0], size[1], size[2], complexScratch, complexScratch, FFTW_BACKWARD, flags );
+    } else if( kind == RealToComplex ){
+        plan = fftw_plan_dft_r2c_3d( size[0], size[1], size[2], realScratch, complexScratch, flags );
+    } else {
+        plan = fftw_plan_dft_c2r_3d( size[0], size[1], size[2], complexScratch, realScratch, flags );
+    }
+    fftw_free( complexScratch );
+    fftw_free( realScratch );
+
+    planCache[key] = plan;
+    pthread_mutex_unlock( &planCacheLock );
+    return plan;
+}
+
+class MBPolReferencePmeFFT::Plans {
+public:
+    fftw_plan complexForward;
+    fftw_plan complexBackward;
+    fftw_plan realToComplex;
+    fftw_plan complexToReal;
+};
+
+MBPolReferencePmeFFT::MBPolReferencePmeFFT( int xsize, int ysize, int zsize ) : _plans(new Plans()) {
+    _size[0]                  = xsize;
+    _size[1]                  = ysize;
+    _size[2]                  = zsize;
+    _plans->complexForward    = getPlan( _size, ComplexForward );
+    _plans->complexBackward   = getPlan( _size, ComplexBackward );
+    _plans->realToComplex     = getPlan( _size, RealToComplex );
+    _plans->complexToReal     = getPlan( _size, ComplexToReal );
+}
+
+MBPolReferencePmeFFT::~MBPolReferencePmeFFT( ){
+    delete _plans;
+}
+
+const char* MBPolReferencePmeFFT::getBackendName( void ){
+    return "fftw";
+}
+
+void MBPolReferencePmeFFT::transformComplex( t_complex* grid, bool forward ){
+    fftw_complex* data = reinterpret_cast<fftw_complex*>( grid );
+    fftw_execute_dft( forward ? _plans->complexForward : _plans->complexBackward, data, data );
+}
+
+void MBPolReferencePmeFFT::transformRealToComplex( const RealOpenMM* realGrid, t_complex* complexGrid ){
+    fftw_execute_dft_r2c( _plans->realToComplex, const_cast<double*>( realGrid ), reinterpret_cast<fftw_complex*>( complexGrid ) );
+}
+
+void MBPolReferencePmeFFT::transformComplexToReal( t_complex* complexGrid, RealOpenMM* realGrid ){
+    fftw_execute_dft_c2r( _plans->complexToReal, reinterpret_cast<fftw_complex*>( complexGrid ), realGrid );
+}
+
+#else
+
+// With an even zsize the even and odd z points of a real grid are transformed
+// together as one complex grid of half the size and separated afterwards.
+// With an odd zsize the real grid is transformed as a complex one.
+
+class MBPolReferencePmeFFT::Plans {
+public:
+    fftpack_t full;
+    fftpack_t half;
+    std::vector<t_complex> work;
+
+    // exp(-2 pi i k/zsize) for k = 0, ..., zsize/2
+    std::vector<t_complex> twiddle;
+};
+
+MBPolReferencePmeFFT::MBPolReferencePmeFFT( int xsize, int ysize, int zsize ) : _plans(new Plans()) {
+
+    _size[0] = xsize;
+    _size[1] = ysize;
+    _size[2] = zsize;
+
+    fftpack_init_3d( &_plans->full, xsize, ysize, zsize );
+    _plans->half = NULL;
+    if( zsize % 2 == 0 ){
+        fftpack_init_3d( &_plans->half, xsize, ysize, zsize/2 );
+        _plans->work.resize( xsize*ysize*(zsize/2) );
+        _plans->twiddle.resize( zsize/2 + 1 );
+        for( int kk = 0; kk <= zsize/2; kk++ ){
+            _plans->twiddle[kk].re = cos( 2.0*M_PI*kk/zsize );
+            _plans->twiddle[kk].im = -sin( 2.0*M_PI*kk/zsize );
+        }
+    } else {
+        _plans->work.resize( xsize*ysize*zsize );
+    }
+}
+
+MBPolReferencePmeFFT::~MBPolReferencePmeFFT( ){
+    fftpack_destroy( _plans->full );
+    if( _plans->half ){
+        fftpack_destroy( _plans->half );
+    }
+    delete _plans;
+}
+
+const char* MBPolReferencePmeFFT::getBackendName( void ){
+    return "builtin";
+}
+
+void MBPolReferencePmeFFT::transformComplex( t_complex* grid, bool forward ){
+    fftpack_exec_3d( _plans->full, forward ? FFTPACK_FORWARD : FFTPACK_BACKWARD, grid, grid );
+}
+
+void MBPolReferencePmeFFT::transformRealToComplex( const RealOpenMM* realGrid, t_complex* complexGrid ){
+
+    int numLines          = _size[0]*_size[1];
+    int zsize             = _size[2];
+    int complexSizeZ      = zsize/2 + 1;
+    t_complex* work       = &_plans->work[0];
+
+    if( _plans->half == NULL ){
+        for( int ii = 0; ii < numLines*zsize; ii++ ){
+            work[ii].re = realGrid[ii];
+            work[ii].im = 0.0;
+        }
+        fftpack_exec_3d( _plans->full, FFTPACK_FORWARD, work, work );
+        for( int line = 0; line < numLines; line++ ){
+            for( int kk = 0; kk < complexSizeZ; kk++ ){
+                complexGrid[line*complexSizeZ+kk] = work[line*zsize+kk];
+            }
+        }
+        return;
+    }
+
+    int half = zsize/2;
+    for( int line = 0; line < numLines; line++ ){
+        for( int jj = 0; jj < half; jj++ ){
+            work[line*half+jj].re = realGrid[line*zsize+2*jj];
+            work[line*half+jj].im = realGrid[line*zsize+2*jj+1];
+        }
+    }
+    fftpack_exec_3d( _plans->half, FFTPACK_FORWARD, work, work );
+
+    // with Z the transform of e + i o, the transforms of the even and odd points are
+    // E[k] = (Z[k] + Z*[-k])/2 and O[k] = (Z[k] - Z*[-k])/2i, and X[k] = E[k] + exp(-2 pi i kz/zsize) O[k]
+
+    for( int xx = 0; xx < _size[0]; xx++ ){
+        int mx = (_size[0] - xx) % _size[0];
+        for( int yy = 0; yy < _size[1]; yy++ ){
+            int my = (_size[1] - yy) % _size[1];
+            const t_complex* line      = work + (xx*_size[1] + yy)*half;
+            const t_complex* lineMinus = work + (mx*_size[1] + my)*half;
+            t_complex* output          = complexGrid + (xx*_size[1] + yy)*complexSizeZ;
+            for( int kk = 0; kk < complexSizeZ; kk++ ){
+                const t_complex& zk      = line[kk % half];
+                const t_complex& zMinusK = lineMinus[(half - kk) % half];
+                const t_complex& twiddle = _plans->twiddle[kk];
+                RealOpenMM evenRe        = 0.5*(zk.re + zMinusK.re);
+                RealOpenMM evenIm        = 0.5*(zk.im - zMinusK.im);
+                RealOpenMM oddRe         = 0.5*(zk.im + zMinusK.im);
+                RealOpenMM oddIm         = -0.5*(zk.re - zMinusK.re);
+                output[kk].re            = evenRe + twiddle.re*oddRe - twiddle.im*oddIm;
+                output[kk].im            = evenIm + twiddle.re*oddIm + twiddle.im*oddRe;
+            }
+        }
+    }
+}
+
+void MBPolReferencePmeFFT::transformComplexToReal( t_complex* complexGrid, RealOpenMM* realGrid ){
+
+    int numLines          = _size[0]*_size[1];
+    int zsize             = _size[2];
+    int complexSizeZ      = zsize/2 + 1;
+    t_complex* work       = &_plans->work[0];
+
+    if( _plans->half == NULL ){
+
+        // the points kz > zsize/2 are X[kx,ky,kz] = X*[-kx,-ky,zsize-kz]
+
+        for( int xx = 0; xx < _size[0]; xx++ ){
+            int mx = (_size[0] - xx) % _size[0];
+            for( int yy = 0; yy < _size[1]; yy++ ){
+                int my = (_size[1] - yy) % _size[1];
+                const t_complex* line      = complexGrid + (xx*_size[1] + yy)*complexSizeZ;
+                const t_complex* lineMinus = complexGrid + (mx*_size[1] + my)*complexSizeZ;
+                t_complex* output          = work + (xx*_size[1] + yy)*zsize;
+                for( int kk = 0; kk < complexSizeZ; kk++ ){
+                    output[kk] = line[kk];
+                }
+                for( int kk = complexSizeZ; kk < zsize; kk++ ){
+                    output[kk].re =  lineMinus[zsize-kk].re;
+                    output[kk].im = -lineMinus[zsize-kk].im;
+                }
+            }
+        }
+        fftpack_exec_3d( _plans->full, FFTPACK_BACKWARD, work, work );
+        for( int ii = 0; ii < numLines*zsize; ii++ ){
+            realGrid[ii] = work[ii].re;
+        }
+        return;
+    }
+
+    // the reverse of transformRealToComplex(): Z[k] = E[k] + i O[k] with the (unnormalized)
+    // E[k] = X[k] + X[k+zsize/2] and O[k] = (X[k] - X[k+zsize/2]) exp(2 pi i kz/zsize),
+    // where X[kx,ky,kz+zsize/2] = X*[-kx,-ky,zsize/2-kz]
+
+    int half = zsize/2;
+    for( int xx = 0; xx < _size[0]; xx++ ){
+        int mx = (_size[0] - xx) % _size[0];
+        for( int yy = 0; yy < _size[1]; yy++ ){
+            int my = (_size[1] - yy) % _size[1];
+            const t_complex* line      = complexGrid + (xx*_size[1] + yy)*complexSizeZ;
+            const t_complex* lineMinus = complexGrid + (mx*_size[1] + my)*complexSizeZ;
+            t_complex* output          = work + (xx*_size[1] + yy)*half;
+            for( int kk = 0; kk < half; kk++ ){
+                const t_complex& xk      = line[kk];
+                const t_complex& xMinusK = lineMinus[half - kk];
+                const t_complex& twiddle = _plans->twiddle[kk];
+                RealOpenMM evenRe        = xk.re + xMinusK.re;
+                RealOpenMM evenIm        = xk.im - xMinusK.im;
+                RealOpenMM differenceRe  = xk.re - xMinusK.re;
+                RealOpenMM differenceIm  = xk.im + xMinusK.im;
+                RealOpenMM oddRe         = differenceRe*twiddle.re + differenceIm*twiddle.im;
+                RealOpenMM oddIm         = differenceIm*twiddle.re - differenceRe*twiddle.im;
+                output[kk].re            = evenRe - oddIm;
+                output[kk].im            = evenIm + oddRe;
+            }
+        }
+    }
+    fftpack_exec_3d( _plans->half, FFTPACK_BACKWARD, work, work );
+    for( int line = 0; line < numLines; line++ ){
+        for( int jj = 0; jj < half; jj++ ){
+            realGrid[line*zsize+2*jj]   = work[line*half+jj].re;
+            realGrid[line*zsize+2*jj+1] = work[line*half+jj].im;
+        }
+    }
+}
+
+#endif
+
+int MBPolReferencePmeFFT::getComplexSizeZ( void ) const {
+    return _size[2]/2 + 1;
+}
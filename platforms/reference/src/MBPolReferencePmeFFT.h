@@ -0,0 +1,129 @@
+/* -------------------------------------------------------------------------- *
+ *                               OpenMMMBPol                                 *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2008-2009 Stanford University and the Authors.      *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * This program is free software: you can redistribute it and/or modify       *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * This program is distributed in the hope that it will be useful,            *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ *                                                                            *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.      *
+ * -------------------------------------------------------------------------- */
+
+#ifndef __MBPolReferencePmeFFT_H__
+#define __MBPolReferencePmeFFT_H__
+
+#include "openmm/reference/SimTKOpenMMRealType.h"
+#include "openmm/reference/fftpack.h"
+#include <vector>
+
+// ---------------------------------------------------------------------------------------
+
+/**
+ * Unnormalized 3D FFTs of the PME grid, row major with z running fastest.
+ *
+ * A real grid of xsize*ysize*zsize points transforms to the half spectrum of
+ * xsize*ysize*(zsize/2 + 1) points; the rest follows from Hermitian symmetry.
+ * Two real grids may also be transformed together as the real and imaginary
+ * parts of a complex grid, as the PME convolution keeps them apart.
+ *
+ * The backend is chosen when the plugin is configured (MBPOL_FFT_BACKEND):
+ * "builtin" uses the fftpack of OpenMM, transforming a real grid with an even
+ * zsize as a complex grid of half the size; "fftw" uses FFTW 3, with the plans
+ * of all grids ever used kept in a process wide cache.
+ */
+
+class MBPolReferencePmeFFT {
+
+public:
+
+    /**---------------------------------------------------------------------------------------
+
+       Set up the transforms of a grid
+
+       @param xsize                 number of grid points along x
+       @param ysize                 number of grid points along y
+       @param zsize                 number of grid points along z
+
+       --------------------------------------------------------------------------------------- */
+
+    MBPolReferencePmeFFT( int xsize, int ysize, int zsize );
+
+    ~MBPolReferencePmeFFT( );
+
+    /**---------------------------------------------------------------------------------------
+
+       Get the name of the backend the plugin was configured with
+
+       --------------------------------------------------------------------------------------- */
+
+    static const char* getBackendName( void );
+
+    /**---------------------------------------------------------------------------------------
+
+       Get the number of z points of the half spectrum, zsize/2 + 1
+
+       --------------------------------------------------------------------------------------- */
+
+    int getComplexSizeZ( void ) const;
+
+    /**---------------------------------------------------------------------------------------
+
+       Transform a complex grid of xsize*ysize*zsize points in place
+
+       @param grid                  grid to transform
+       @param forward               true for the forward transform, exp(-i k.r)
+
+       --------------------------------------------------------------------------------------- */
+
+    void transformComplex( t_complex* grid, bool forward );
+
+    /**---------------------------------------------------------------------------------------
+
+       Forward transform of a real grid to its half spectrum
+
+       @param realGrid              input grid of xsize*ysize*zsize points
+       @param complexGrid           output half spectrum of xsize*ysize*(zsize/2 + 1) points
+
+       --------------------------------------------------------------------------------------- */
+
+    void transformRealToComplex( const RealOpenMM* realGrid, t_complex* complexGrid );
+
+    /**---------------------------------------------------------------------------------------
+
+       Backward transform of a half spectrum to a real grid; the half spectrum is overwritten
+
+       @param complexGrid           input half spectrum of xsize*ysize*(zsize/2 + 1) points
+       @param realGrid              output grid of xsize*ysize*zsize points
+
+       --------------------------------------------------------------------------------------- */
+
+    void transformComplexToReal( t_complex* complexGrid, RealOpenMM* realGrid );
+
+private:
+
+    int _size[3];
+
+    // backend data, see MBPolReferencePmeFFT.cpp
+    class Plans;
+    Plans* _plans;
+
+};
+
+// ---------------------------------------------------------------------------------------
+
+#endif // __MBPolReferencePmeFFT_H__
@@ -29,13 +29,13 @@
 #include <cctype>
 #include "mbpol_3body_constants.h"
 #include "poly-3b-v2x.h"
-#include <list>
+#include "openmm/internal/ThreadPool.h"
 #include <iostream>
 
 using std::vector;
 using OpenMM::RealVec;
 
-MBPolReferenceThreeBodyForce::MBPolReferenceThreeBodyForce( ) : _nonbondedMethod(NoCutoff), _cutoff(1.0e+10) {
+MBPolReferenceThreeBodyForce::MBPolReferenceThreeBodyForce( ) : _nonbondedMethod(NoCutoff), _cutoff(1.0e+10), _variables(NULL), _includeForces(true) {
 
     _periodicBoxDimensions = RealVec( 0.0, 0.0, 0.0 );
 }
@@ -64,45 +64,68 @@ RealVec MBPolReferenceThreeBodyForce::getPeriodicBox( void ) const {
     return _periodicBoxDimensions;
 }
 
-double var(const double& k,
-           const double& r0,
-           const OpenMM::RealVec& a1, const OpenMM::RealVec& a2)
-{
-    const double dx[3] = {(a1[0] - a2[0])*nm_to_A,
-                          (a1[1] - a2[1])*nm_to_A,
-                          (a1[2] - a2[2])*nm_to_A};
-
-    const double dsq = dx[0]*dx[0] + dx[1]*dx[1] + dx[2]*dx[2];
-    const double d = std::sqrt(dsq);
+void MBPolReferenceThreeBodyForce::setVariables( const MBPolReferenceThreeBodyVariables* variables ){
+    _variables = variables;
+}
 
-    return std::exp(-k*(d - r0));
+void MBPolReferenceThreeBodyForce::setIncludeForces( bool includeForces ){
+    _includeForces = includeForces;
 }
 
-void g_var(const double& g,
-           const double& k,
-           const double& r0,
-           const OpenMM::RealVec& a1, const OpenMM::RealVec& a2,
-           OpenMM::RealVec& g1,       OpenMM::RealVec& g2)
+// value of exp(-k*(d - r0)) and its gradient w.r.t. the position (A) of a1;
+// the exponential and the distance are computed once for both
+
+static double var(const double& k,
+                  const double& r0,
+                  const OpenMM::RealVec& a1, const OpenMM::RealVec& a2,
+                  OpenMM::RealVec& g1)
 {
-    const double dx[3] = {(a1[0] - a2[0])*nm_to_A,
-                          (a1[1] - a2[1])*nm_to_A,
-                          (a1[2] - a2[2])*nm_to_A};
+    const RealVec dx = (a1 - a2)*nm_to_A;
+    const double d = std::sqrt(dx.dot(dx));
+    const double v = std::exp(-k*(d - r0));
 
-    const double dsq = dx[0]*dx[0] + dx[1]*dx[1] + dx[2]*dx[2];
-    const double d = std::sqrt(dsq);
+    g1 = dx*(-k*v/d);
 
-    double gg = - k*g*std::exp(-k*(d - r0))/d;
+    return v;
+}
 
-    const double cal2joule = 4.184;
+// atoms of the variables of a molecule (O = 0, H1 = 1, H2 = 2) and of a pair
+// of molecules (m: 0..2, n: 3..5), in the order of MBPolReferenceThreeBodyVariables
 
-    gg *= cal2joule * 10.*-1;
+static const int monomerVariableAtoms[3][2] = { {1, 2}, {0, 1}, {0, 2} };
+static const int pairVariableAtoms[9][2]    = { {1, 4}, {1, 5}, {2, 4}, {2, 5},
+                                                {0, 4}, {0, 5}, {3, 1}, {3, 2}, {0, 3} };
 
-    for (int i = 0; i < 3; ++i) {
-        g1[i] += gg*dx[i];
-        g2[i] -= gg*dx[i];
-    }
+static double monomerVariable(int n, const RealVec* positions, RealVec& gradient)
+{
+    const RealVec& a1 = positions[monomerVariableAtoms[n][0]];
+    const RealVec& a2 = positions[monomerVariableAtoms[n][1]];
+    if (n == 0)
+        return var(kHH_intra, dHH_intra, a1, a2, gradient);
+    return var(kOH_intra, dOH_intra, a1, a2, gradient);
+}
+
+static double pairVariable(int n, const RealVec* positions, RealVec& gradient)
+{
+    const RealVec& a1 = positions[pairVariableAtoms[n][0]];
+    const RealVec& a2 = positions[pairVariableAtoms[n][1]];
+    if (n < 4)
+        return var(kHH, dHH, a1, a2, gradient);
+    if (n < 8)
+        return var(kOH, dOH, a1, a2, gradient);
+    return var(kOO, dOO, a1, a2, gradient);
 }
 
+// index in the 36 polynomial variables of the variables of the three pairs (a, b), (a, c), (b, c)
+// of a trimer, for the pair variables of (m, n) = (a, b), (a, c), (b, c); when m and n are the other
+// way round, the pair variable n is the one at swappedPairVariable[n]
+
+static const int trimerPairs[3][2]            = { {0, 1}, {0, 2}, {1, 2} };
+static const int trimerPairVariables[3][9]    = { { 9, 10, 13, 14, 21, 22, 25, 26, 33},
+                                                  {11, 12, 15, 16, 23, 24, 29, 30, 34},
+                                                  {17, 18, 19, 20, 27, 28, 31, 32, 35} };
+static const int swappedPairVariable[9]       = { 0, 2, 1, 3, 6, 7, 4, 5, 8 };
+
 double threebody_f_switch(const double& r, double& g)
 {
     if (r > r3f) {
@@ -119,10 +142,22 @@ double threebody_f_switch(const double& r, double& g)
     }
 }
 
-RealOpenMM MBPolReferenceThreeBodyForce::calculateTripletIxn( int siteI, int siteJ, int siteQ,
-                                                      const std::vector<RealVec>& particlePositions,
-                                                      const std::vector<std::vector<int> >& allParticleIndices,
-                                                      vector<RealVec>& forces ) const {
+// state of a trimer kept between the computation of the polynomial variables
+// and the distribution of the polynomial gradients
+
+struct MBPolReferenceThreeBodyForce::ThreeBodyTrimer {
+    int sites[3];
+    RealVec rab, rac, rbc;
+    double drab, drac, drbc;
+    // the two atoms (0..8) of each polynomial variable and its gradient w.r.t. the first one
+    int atoms[36][2];
+    RealVec gradients[36];
+};
+
+bool MBPolReferenceThreeBodyForce::setupTrimer( int siteI, int siteJ, int siteQ,
+                                                const std::vector<RealVec>& particlePositions,
+                                                const std::vector<std::vector<int> >& allParticleIndices,
+                                                ThreeBodyTrimer& trimer, double x[36] ) const {
 
         // siteI and siteJ are indices in a oxygen-only array, in order to get the position of an oxygen, we need:
         // allParticleIndices[siteI][0]
@@ -131,22 +166,24 @@ RealOpenMM MBPolReferenceThreeBodyForce::calculateTripletIxn( int siteI, int sit
         // same for the second water molecule
 
 
-        std::vector<RealVec> allPositions;
+        RealVec allPositions[9];
 
-        // the iterator constructor can also be used to construct from arrays:
-        int sites_array[] = {siteI, siteJ, siteQ};
-        std::list<int> sites (sites_array, sites_array + sizeof(sites_array) / sizeof(int) );
+        trimer.sites[0] = siteI;
+        trimer.sites[1] = siteJ;
+        trimer.sites[2] = siteQ;
 
-        for (std::list<int>::iterator it = sites.begin(); it != sites.end(); it++)
+        for (unsigned int s = 0; s < 3; s++)
         {
             for (unsigned int i=0; i < 3; i++)
-                allPositions.push_back(particlePositions[allParticleIndices[*it][i]]);
+                allPositions[3*s + i] = particlePositions[allParticleIndices[trimer.sites[s]][i]];
         }
 
         if( _nonbondedMethod == CutoffPeriodic )
-            imageMolecules(_periodicBoxDimensions, allPositions);
+            imageMolecules(_periodicBoxDimensions, allPositions, 3);
 
-        RealVec rab, rac, rbc;
+        RealVec& rab = trimer.rab;
+        RealVec& rac = trimer.rac;
+        RealVec& rbc = trimer.rbc;
         double drab(0), drac(0), drbc(0);
 
         rab = (allPositions[Oa] - allPositions[Ob])*nm_to_A;
@@ -158,55 +195,97 @@ RealOpenMM MBPolReferenceThreeBodyForce::calculateTripletIxn( int siteI, int sit
         rbc = (allPositions[Ob] - allPositions[Oc])*nm_to_A;
         drbc += rbc.dot(rbc);
 
-        drab = std::sqrt(drab);
-        drac = std::sqrt(drac);
-        drbc = std::sqrt(drbc);
+        trimer.drab = drab = std::sqrt(drab);
+        trimer.drac = drac = std::sqrt(drac);
+        trimer.drbc = drbc = std::sqrt(drbc);
 
         if ((drab < 2) or (drac < 2) or (drbc < 2))
-             return 0.;
-
-          double x[36];
-
-          x[0] = var(kHH_intra, dHH_intra, allPositions[Ha1], allPositions[Ha2]);
-          x[1] = var(kHH_intra, dHH_intra, allPositions[Hb1], allPositions[Hb2]);
-          x[2] = var(kHH_intra, dHH_intra, allPositions[Hc1], allPositions[Hc2]);
-          x[3] = var(kOH_intra, dOH_intra, allPositions[ Oa], allPositions[Ha1]);
-          x[4] = var(kOH_intra, dOH_intra, allPositions[ Oa], allPositions[Ha2]);
-          x[5] = var(kOH_intra, dOH_intra, allPositions[ Ob], allPositions[Hb1]);
-          x[6] = var(kOH_intra, dOH_intra, allPositions[ Ob], allPositions[Hb2]);
-          x[7] = var(kOH_intra, dOH_intra, allPositions[ Oc], allPositions[Hc1]);
-          x[8] = var(kOH_intra, dOH_intra, allPositions[ Oc], allPositions[Hc2]);
-
-          x[9] =  var(kHH, dHH, allPositions[Ha1], allPositions[Hb1]);
-          x[10] = var(kHH, dHH, allPositions[Ha1], allPositions[Hb2]);
-          x[11] = var(kHH, dHH, allPositions[Ha1], allPositions[Hc1]);
-          x[12] = var(kHH, dHH, allPositions[Ha1], allPositions[Hc2]);
-          x[13] = var(kHH, dHH, allPositions[Ha2], allPositions[Hb1]);
-          x[14] = var(kHH, dHH, allPositions[Ha2], allPositions[Hb2]);
-          x[15] = var(kHH, dHH, allPositions[Ha2], allPositions[Hc1]);
-          x[16] = var(kHH, dHH, allPositions[Ha2], allPositions[Hc2]);
-          x[17] = var(kHH, dHH, allPositions[Hb1], allPositions[Hc1]);
-          x[18] = var(kHH, dHH, allPositions[Hb1], allPositions[Hc2]);
-          x[19] = var(kHH, dHH, allPositions[Hb2], allPositions[Hc1]);
-          x[20] = var(kHH, dHH, allPositions[Hb2], allPositions[Hc2]);
-          x[21] = var(kOH, dOH, allPositions[ Oa], allPositions[Hb1]);
-          x[22] = var(kOH, dOH, allPositions[ Oa], allPositions[Hb2]);
-          x[23] = var(kOH, dOH, allPositions[ Oa], allPositions[Hc1]);
-          x[24] = var(kOH, dOH, allPositions[ Oa], allPositions[Hc2]);
-          x[25] = var(kOH, dOH, allPositions[ Ob], allPositions[Ha1]);
-          x[26] = var(kOH, dOH, allPositions[ Ob], allPositions[Ha2]);
-          x[27] = var(kOH, dOH, allPositions[ Ob], allPositions[Hc1]);
-          x[28] = var(kOH, dOH, allPositions[ Ob], allPositions[Hc2]);
-          x[29] = var(kOH, dOH, allPositions[ Oc], allPositions[Ha1]);
-          x[30] = var(kOH, dOH, allPositions[ Oc], allPositions[Ha2]);
-          x[31] = var(kOH, dOH, allPositions[ Oc], allPositions[Hb1]);
-          x[32] = var(kOH, dOH, allPositions[ Oc], allPositions[Hb2]);
-          x[33] = var(kOO, dOO, allPositions[ Oa], allPositions[ Ob]);
-          x[34] = var(kOO, dOO, allPositions[ Oa], allPositions[ Oc]);
-          x[35] = var(kOO, dOO, allPositions[ Ob], allPositions[ Oc]);
-
-          double g[36];
-          double retval = poly_3b_v2x::eval(thefit, x, g);
+             return false;
+
+        // screen out the trimers the switch turns off (fewer than two pairs within r3f)
+        // before the polynomial is evaluated
+
+        double gab, gac, gbc;
+        const double sab = threebody_f_switch(drab, gab);
+        const double sac = threebody_f_switch(drac, gac);
+        const double sbc = threebody_f_switch(drbc, gbc);
+
+        if (sab*sac + sab*sbc + sac*sbc == 0.0)
+             return false;
+
+        // intramolecular variables, from the cache if there is one
+
+        for (int m = 0; m < 3; ++m) {
+            const MBPolReferenceThreeBodyVariables::Variable* cached = NULL;
+            if (_variables)
+                cached = _variables->getMonomerVariables(trimer.sites[m]);
+
+            for (int n = 0; n < MBPolReferenceThreeBodyVariables::numMonomerVariables; ++n) {
+                const int xi = (n == 0 ? m : 2*m + 2 + n);
+                trimer.atoms[xi][0] = 3*m + monomerVariableAtoms[n][0];
+                trimer.atoms[xi][1] = 3*m + monomerVariableAtoms[n][1];
+                if (cached) {
+                    x[xi] = cached[n].value;
+                    trimer.gradients[xi] = cached[n].gradient;
+                } else {
+                    x[xi] = monomerVariable(n, &allPositions[3*m], trimer.gradients[xi]);
+                }
+            }
+        }
+
+        // intermolecular variables; the cache holds the pair with the lower molecule index first
+        // and is used only if it has the same periodic image of the pair as the trimer
+
+        for (int p = 0; p < 3; ++p) {
+            int m = trimerPairs[p][0];
+            int n = trimerPairs[p][1];
+            const MBPolReferenceThreeBodyVariables::Variable* cached = NULL;
+            if (_variables) {
+                if (trimer.sites[m] > trimer.sites[n])
+                    std::swap(m, n);
+                RealVec oxygenVector;
+                cached = _variables->getPairVariables(trimer.sites[m], trimer.sites[n], oxygenVector);
+                const RealVec delta = oxygenVector - (allPositions[3*m] - allPositions[3*n]);
+                if (cached && delta.dot(delta) > 1.0e-12)
+                    cached = NULL;
+            }
+
+            RealVec pairPositions[6];
+            if (!cached) {
+                for (int i = 0; i < 3; ++i) {
+                    pairPositions[i]     = allPositions[3*m + i];
+                    pairPositions[i + 3] = allPositions[3*n + i];
+                }
+            }
+
+            for (int v = 0; v < MBPolReferenceThreeBodyVariables::numPairVariables; ++v) {
+                const int xi = trimerPairVariables[p][m == trimerPairs[p][0] ? v : swappedPairVariable[v]];
+                for (int i = 0; i < 2; ++i) {
+                    const int atom = pairVariableAtoms[v][i];
+                    trimer.atoms[xi][i] = (atom < 3 ? 3*m + atom : 3*n + atom - 3);
+                }
+                if (cached) {
+                    x[xi] = cached[v].value;
+                    trimer.gradients[xi] = cached[v].gradient;
+                } else {
+                    x[xi] = pairVariable(v, pairPositions, trimer.gradients[xi]);
+                }
+            }
+        }
+
+        return true;
+}
+
+RealOpenMM MBPolReferenceThreeBodyForce::accumulateTrimerForces( const ThreeBodyTrimer& trimer, double retval, double g[36],
+                                                                  const std::vector<std::vector<int> >& allParticleIndices,
+                                                                  vector<RealVec>& forces ) const {
+
+          const RealVec& rab          = trimer.rab;
+          const RealVec& rac          = trimer.rac;
+          const RealVec& rbc          = trimer.rbc;
+          const double drab           = trimer.drab;
+          const double drac           = trimer.drac;
+          const double drbc           = trimer.drbc;
 
           double gab, gac, gbc;
 
@@ -219,46 +298,15 @@ RealOpenMM MBPolReferenceThreeBodyForce::calculateTripletIxn( int siteI, int sit
           for (int n = 0; n < 36; ++n)
               g[n] *= s;
 
-          std::vector<RealVec> allForces;
-          allForces.resize(allPositions.size());
-
-          g_var(g[0], kHH_intra, dHH_intra, allPositions[Ha1], allPositions[Ha2], allForces[ Ha1], allForces[ Ha2]);
-          g_var(g[1], kHH_intra, dHH_intra, allPositions[Hb1], allPositions[Hb2], allForces[ Hb1], allForces[ Hb2]);
-          g_var(g[2], kHH_intra, dHH_intra, allPositions[Hc1], allPositions[Hc2], allForces[ Hc1], allForces[ Hc2]);
-          g_var(g[3], kOH_intra, dOH_intra, allPositions[ Oa], allPositions[Ha1], allForces[  Oa], allForces[ Ha1]);
-          g_var(g[4], kOH_intra, dOH_intra, allPositions[ Oa], allPositions[Ha2], allForces[  Oa], allForces[ Ha2]);
-          g_var(g[5], kOH_intra, dOH_intra, allPositions[ Ob], allPositions[Hb1], allForces[  Ob], allForces[ Hb1]);
-          g_var(g[6], kOH_intra, dOH_intra, allPositions[ Ob], allPositions[Hb2], allForces[  Ob], allForces[ Hb2]);
-          g_var(g[7], kOH_intra, dOH_intra, allPositions[ Oc], allPositions[Hc1], allForces[  Oc], allForces[ Hc1]);
-          g_var(g[8], kOH_intra, dOH_intra, allPositions[ Oc], allPositions[Hc2], allForces[  Oc], allForces[ Hc2]);
-          g_var(g[9],  kHH, dHH,            allPositions[Ha1], allPositions[Hb1], allForces[ Ha1], allForces[ Hb1]);
-          g_var(g[10], kHH, dHH,            allPositions[Ha1], allPositions[Hb2], allForces[ Ha1], allForces[ Hb2]);
-          g_var(g[11], kHH, dHH,            allPositions[Ha1], allPositions[Hc1], allForces[ Ha1], allForces[ Hc1]);
-          g_var(g[12], kHH, dHH,            allPositions[Ha1], allPositions[Hc2], allForces[ Ha1], allForces[ Hc2]);
-          g_var(g[13], kHH, dHH,            allPositions[Ha2], allPositions[Hb1], allForces[ Ha2], allForces[ Hb1]);
-          g_var(g[14], kHH, dHH,            allPositions[Ha2], allPositions[Hb2], allForces[ Ha2], allForces[ Hb2]);
-          g_var(g[15], kHH, dHH,            allPositions[Ha2], allPositions[Hc1], allForces[ Ha2], allForces[ Hc1]);
-          g_var(g[16], kHH, dHH,            allPositions[Ha2], allPositions[Hc2], allForces[ Ha2], allForces[ Hc2]);
-          g_var(g[17], kHH, dHH,            allPositions[Hb1], allPositions[Hc1], allForces[ Hb1], allForces[ Hc1]);
-          g_var(g[18], kHH, dHH,            allPositions[Hb1], allPositions[Hc2], allForces[ Hb1], allForces[ Hc2]);
-          g_var(g[19], kHH, dHH,            allPositions[Hb2], allPositions[Hc1], allForces[ Hb2], allForces[ Hc1]);
-          g_var(g[20], kHH, dHH,            allPositions[Hb2], allPositions[Hc2], allForces[ Hb2], allForces[ Hc2]);
-          g_var(g[21], kOH, dOH,            allPositions[ Oa], allPositions[Hb1], allForces[  Oa], allForces[ Hb1]);
-          g_var(g[22], kOH, dOH,            allPositions[ Oa], allPositions[Hb2], allForces[  Oa], allForces[ Hb2]);
-          g_var(g[23], kOH, dOH,            allPositions[ Oa], allPositions[Hc1], allForces[  Oa], allForces[ Hc1]);
-          g_var(g[24], kOH, dOH,            allPositions[ Oa], allPositions[Hc2], allForces[  Oa], allForces[ Hc2]);
-          g_var(g[25], kOH, dOH,            allPositions[ Ob], allPositions[Ha1], allForces[  Ob], allForces[ Ha1]);
-          g_var(g[26], kOH, dOH,            allPositions[ Ob], allPositions[Ha2], allForces[  Ob], allForces[ Ha2]);
-          g_var(g[27], kOH, dOH,            allPositions[ Ob], allPositions[Hc1], allForces[  Ob], allForces[ Hc1]);
-          g_var(g[28], kOH, dOH,            allPositions[ Ob], allPositions[Hc2], allForces[  Ob], allForces[ Hc2]);
-          g_var(g[29], kOH, dOH,            allPositions[ Oc], allPositions[Ha1], allForces[  Oc], allForces[ Ha1]);
-          g_var(g[30], kOH, dOH,            allPositions[ Oc], allPositions[Ha2], allForces[  Oc], allForces[ Ha2]);
-          g_var(g[31], kOH, dOH,            allPositions[ Oc], allPositions[Hb1], allForces[  Oc], allForces[ Hb1]);
-          g_var(g[32], kOH, dOH,            allPositions[ Oc], allPositions[Hb2], allForces[  Oc], allForces[ Hb2]);
-          g_var(g[33], kOO, dOO,            allPositions[ Oa], allPositions[ Ob], allForces[  Oa], allForces[  Ob]);
-          g_var(g[34], kOO, dOO,            allPositions[ Oa], allPositions[ Oc], allForces[  Oa], allForces[  Oc]);
-          g_var(g[35], kOO, dOO,            allPositions[ Ob], allPositions[ Oc], allForces[  Ob], allForces[  Oc]);
+          const double cal2joule = 4.184;
+
+          RealVec allForces[9];
 
+          for (int n = 0; n < 36; ++n) {
+              const RealVec force = trimer.gradients[n]*(g[n]*cal2joule*-nm_to_A);
+              allForces[trimer.atoms[n][0]] += force;
+              allForces[trimer.atoms[n][1]] -= force;
+          }
 
           // gradients of the switching function
 
@@ -268,8 +316,6 @@ RealOpenMM MBPolReferenceThreeBodyForce::calculateTripletIxn( int siteI, int sit
 
           retval *= s;
 
-          const double cal2joule = 4.184;
-
           for (int n = 0; n < 3; ++n) {
               allForces[Oa][n] += (gab*rab[n] + gac*rac[n]) * cal2joule * -nm_to_A;
               allForces[Ob][n] += (gbc*rbc[n] - gab*rab[n]) * cal2joule * -nm_to_A;
@@ -277,11 +323,11 @@ RealOpenMM MBPolReferenceThreeBodyForce::calculateTripletIxn( int siteI, int sit
           }
 
           unsigned int j = 0;
-          for (std::list<int>::iterator it = sites.begin(); it != sites.end(); it++)
+          for (unsigned int s = 0; s < 3; s++)
           {
               for (unsigned int i=0; i < 3; i++)
               {
-                  forces[allParticleIndices[*it][i]] += allForces[j];
+                  forces[allParticleIndices[trimer.sites[s]][i]] += allForces[j];
                   j++;
               }
           }
@@ -292,10 +338,51 @@ RealOpenMM MBPolReferenceThreeBodyForce::calculateTripletIxn( int siteI, int sit
 
 }
 
+RealOpenMM MBPolReferenceThreeBodyForce::trimerEnergy( const ThreeBodyTrimer& trimer, double retval ) const {
+
+    double gab, gac, gbc;
+
+    const double sab = threebody_f_switch(trimer.drab, gab);
+    const double sac = threebody_f_switch(trimer.drac, gac);
+    const double sbc = threebody_f_switch(trimer.drbc, gbc);
+
+    const double cal2joule = 4.184;
+
+    return (sab*sac + sab*sbc + sac*sbc)*retval*cal2joule;
+}
+
+RealOpenMM MBPolReferenceThreeBodyForce::calculateTripletIxn( int siteI, int siteJ, int siteQ,
+                                                      const std::vector<RealVec>& particlePositions,
+                                                      const std::vector<std::vector<int> >& allParticleIndices,
+                                                      vector<RealVec>& forces ) const {
+
+        ThreeBodyTrimer trimer;
+        double x[36];
+
+        if (!setupTrimer(siteI, siteJ, siteQ, particlePositions, allParticleIndices, trimer, x))
+            return 0.;
+
+        double g[36];
+        double retval = poly_3b_v2x::eval(thefit, x, g);
+
+        return accumulateTrimerForces(trimer, retval, g, allParticleIndices, forces);
+}
+
+RealOpenMM MBPolReferenceThreeBodyForce::calculateForceAndEnergy( int numParticles,
+                                                             const vector<RealVec>& particlePositions,
+                                                             const std::vector<std::vector<int> >& allParticleIndices,
+                                                             const ThreeNeighborList& neighborList,
+                                                             vector<RealVec>& forces ) const {
+
+    return calculateForceAndEnergy( numParticles, particlePositions, allParticleIndices, neighborList,
+                                    0, neighborList.size(), forces );
+}
+
 RealOpenMM MBPolReferenceThreeBodyForce::calculateForceAndEnergy( int numParticles,
                                                              const vector<RealVec>& particlePositions,
                                                              const std::vector<std::vector<int> >& allParticleIndices,
                                                              const ThreeNeighborList& neighborList,
+                                                             unsigned int firstIndex, unsigned int lastIndex,
                                                              vector<RealVec>& forces ) const {
 
     // loop over neighbor list
@@ -304,19 +391,169 @@ RealOpenMM MBPolReferenceThreeBodyForce::calculateForceAndEnergy( int numParticl
     //        then call addReducedForce() to apportion force to particle and its covalent partner
     //        based on reduction factor
 
+    // the polynomial is evaluated for poly_3b_v2x::batch trimers at a time
+    // (see poly_3b_v2x::eval_batch); leftover trimers are computed one by one
+
+    ThreeBodyTrimer trimers[poly_3b_v2x::batch];
+    double x[36][poly_3b_v2x::batch];
+    double g[36][poly_3b_v2x::batch];
+    double E_poly[poly_3b_v2x::batch];
+    double xk[36], gk[36];
+    unsigned int numTrimers = 0;
+
     RealOpenMM energy = 0.;
     // std::cout << "Number of triplets from neighborList: " << neighborList.size() << std::endl;
-    for( unsigned int ii = 0; ii < neighborList.size(); ii++ ){
+    for( unsigned int ii = firstIndex; ii < lastIndex; ii++ ){
 
         MBPolPlugin::AtomTriplet triplet       = neighborList[ii];
         int siteI                   = triplet.first;
         int siteJ                   = triplet.second;
         int siteQ                   = triplet.third;
 
-        energy                     += calculateTripletIxn( siteI, siteJ, siteQ,
-                particlePositions, allParticleIndices, forces );
+        if( !setupTrimer( siteI, siteJ, siteQ, particlePositions, allParticleIndices, trimers[numTrimers], xk ) )
+            continue;
 
+        for( unsigned int jj = 0; jj < 36; jj++ )
+            x[jj][numTrimers] = xk[jj];
+
+        if( ++numTrimers < poly_3b_v2x::batch )
+            continue;
+
+        if( !_includeForces ){
+            poly_3b_v2x::eval_batch( thefit, x, E_poly );
+            for( unsigned int kk = 0; kk < numTrimers; kk++ )
+                energy += trimerEnergy( trimers[kk], E_poly[kk] );
+            numTrimers = 0;
+            continue;
+        }
+
+        poly_3b_v2x::eval_batch( thefit, x, g, E_poly );
+
+        for( unsigned int kk = 0; kk < numTrimers; kk++ ){
+            for( unsigned int jj = 0; jj < 36; jj++ )
+                gk[jj] = g[jj][kk];
+            energy += accumulateTrimerForces( trimers[kk], E_poly[kk], gk, allParticleIndices, forces );
+        }
+        numTrimers = 0;
+    }
+
+    for( unsigned int kk = 0; kk < numTrimers; kk++ ){
+        for( unsigned int jj = 0; jj < 36; jj++ )
+            xk[jj] = x[jj][kk];
+        if( !_includeForces ){
+            energy += trimerEnergy( trimers[kk], poly_3b_v2x::eval( thefit, xk ) );
+            continue;
+        }
+        const double E = poly_3b_v2x::eval( thefit, xk, gk );
+        energy += accumulateTrimerForces( trimers[kk], E, gk, allParticleIndices, forces );
     }
 
     return energy;
 }
+
+MBPolReferenceThreeBodyVariables::MBPolReferenceThreeBodyVariables( ) : pairList(NULL) {
+}
+
+/**
+ * Computes the variables of the molecules split in contiguous ranges between the threads of a pool.
+ */
+class ThreeBodyVariablesTask : public OpenMM::ThreadPool::Task {
+public:
+    ThreeBodyVariablesTask(MBPolReferenceThreeBodyVariables& variables, const vector<RealVec>& particlePositions,
+                           const std::vector<std::vector<int> >& allParticleIndices, const RealVec& box, bool usePeriodic) :
+            variables(variables), particlePositions(particlePositions), allParticleIndices(allParticleIndices),
+            box(box), usePeriodic(usePeriodic) {
+    }
+    void execute(OpenMM::ThreadPool& threads, int threadIndex) {
+        const int numMolecules = allParticleIndices.size();
+        const int numThreads = threads.getNumThreads();
+        variables.computeMolecules(numMolecules*threadIndex/numThreads, numMolecules*(threadIndex+1)/numThreads,
+                                   particlePositions, allParticleIndices, box, usePeriodic);
+    }
+    MBPolReferenceThreeBodyVariables& variables;
+    const vector<RealVec>& particlePositions;
+    const std::vector<std::vector<int> >& allParticleIndices;
+    const RealVec& box;
+    const bool usePeriodic;
+};
+
+void MBPolReferenceThreeBodyVariables::compute( const vector<RealVec>& particlePositions,
+                                                const std::vector<std::vector<int> >& allParticleIndices,
+                                                const ThreeNeighborPairList& pairList,
+                                                const RealVec& box, bool usePeriodic,
+                                                OpenMM::ThreadPool* threads ){
+
+    this->pairList = &pairList;
+    monomerVariables.resize(numMonomerVariables*allParticleIndices.size());
+    pairVariables.resize(numPairVariables*pairList.neighbors.size());
+    pairOxygenVectors.resize(pairList.neighbors.size());
+
+    if( threads != NULL && threads->getNumThreads() > 1 ){
+        ThreeBodyVariablesTask task(*this, particlePositions, allParticleIndices, box, usePeriodic);
+        threads->execute(task);
+        threads->waitForThreads();
+    } else {
+        computeMolecules(0, allParticleIndices.size(), particlePositions, allParticleIndices, box, usePeriodic);
+    }
+}
+
+void MBPolReferenceThreeBodyVariables::computeMolecules( int firstMolecule, int lastMolecule,
+                                                         const vector<RealVec>& particlePositions,
+                                                         const std::vector<std::vector<int> >& allParticleIndices,
+                                                         const RealVec& box, bool usePeriodic ){
+
+    // the molecules are imaged as in imageMolecules(): the hydrogens with respect to their
+    // oxygen and the second molecule of a pair with respect to the oxygen of the first
+
+    RealVec positions[6];
+    for( int m = firstMolecule; m < lastMolecule; m++ ){
+
+        for( int i = 0; i < 3; i++ )
+            positions[i] = particlePositions[allParticleIndices[m][i]];
+        if( usePeriodic ){
+            imageParticles(box, positions[0], positions[1]);
+            imageParticles(box, positions[0], positions[2]);
+        }
+
+        for( int v = 0; v < numMonomerVariables; v++ ){
+            Variable& variable = monomerVariables[numMonomerVariables*m + v];
+            variable.value = monomerVariable(v, positions, variable.gradient);
+        }
+
+        for( int ii = pairList->neighborStart[m]; ii < pairList->neighborStart[m+1]; ii++ ){
+            const int n = pairList->neighbors[ii];
+            if( n < m )
+                continue;
+
+            for( int i = 0; i < 3; i++ )
+                positions[i + 3] = particlePositions[allParticleIndices[n][i]];
+            if( usePeriodic ){
+                imageParticles(box, positions[0], positions[3]);
+                imageParticles(box, positions[3], positions[4]);
+                imageParticles(box, positions[3], positions[5]);
+            }
+
+            pairOxygenVectors[ii] = positions[0] - positions[3];
+            for( int v = 0; v < numPairVariables; v++ ){
+                Variable& variable = pairVariables[numPairVariables*ii + v];
+                variable.value = pairVariable(v, positions, variable.gradient);
+            }
+        }
+    }
+}
+
+const MBPolReferenceThreeBodyVariables::Variable* MBPolReferenceThreeBodyVariables::getPairVariables( int moleculeM, int moleculeN,
+                                                                                                       RealVec& oxygenVector ) const {
+
+    // the neighbors of a molecule are sorted
+
+    const vector<AtomIndex>::const_iterator first = pairList->neighbors.begin() + pairList->neighborStart[moleculeM];
+    const vector<AtomIndex>::const_iterator last  = pairList->neighbors.begin() + pairList->neighborStart[moleculeM+1];
+    const vector<AtomIndex>::const_iterator found = std::lower_bound(first, last, (AtomIndex) moleculeN);
+    if( found == last || (int) *found != moleculeN )
+        return NULL;
+
+    const int ii = found - pairList->neighbors.begin();
+    oxygenVector = pairOxygenVectors[ii];
+    return &pairVariables[numPairVariables*ii];
+}
@@ -39,6 +39,107 @@ class MBPolReferenceThreeBodyForce;
 
 // ---------------------------------------------------------------------------------------
 
+/**---------------------------------------------------------------------------------------
+
+   Variables of the 3-body polynomial computed once per step: the intramolecular variables
+   of every molecule and the intermolecular variables of every pair of the neighbor list,
+   shared by all the trimers the molecule or the pair belongs to
+
+   --------------------------------------------------------------------------------------- */
+
+class MBPolReferenceThreeBodyVariables {
+
+public:
+
+    /**
+     * A variable exp(-k*(d - d0)) of the distance d (A) between two atoms and its
+     * gradient w.r.t. the position (A) of the first atom.
+     */
+    struct Variable {
+        double value;
+        RealVec gradient;
+    };
+
+    /**
+     * Variables of a molecule: H1-H2, O-H1, O-H2.
+     */
+    static const int numMonomerVariables = 3;
+
+    /**
+     * Variables of a pair of molecules (m, n): H1m-H1n, H1m-H2n, H2m-H1n, H2m-H2n,
+     * Om-H1n, Om-H2n, On-H1m, On-H2m, Om-On.
+     */
+    static const int numPairVariables = 9;
+
+    MBPolReferenceThreeBodyVariables( void );
+
+    /**---------------------------------------------------------------------------------------
+
+       Compute the variables of all molecules and of the pairs of a neighbor list
+
+       @param particlePositions     Cartesian coordinates of particles
+       @param allParticleIndices    particle indices of each molecule
+       @param pairList              oxygen neighbor list; it must be kept until the next call
+       @param box                   periodic box dimensions
+       @param usePeriodic           if true, the molecules of a pair are imaged
+       @param threads               if given, the variables are computed by the threads of this pool
+
+       --------------------------------------------------------------------------------------- */
+
+    void compute( const std::vector<RealVec>& particlePositions,
+                  const std::vector<std::vector<int> >& allParticleIndices,
+                  const ThreeNeighborPairList& pairList,
+                  const RealVec& box, bool usePeriodic,
+                  OpenMM::ThreadPool* threads = NULL );
+
+    /**---------------------------------------------------------------------------------------
+
+       Compute the variables of the molecules [firstMolecule, lastMolecule) and of their pairs
+       with molecules of higher index; used to split compute() between threads
+
+       --------------------------------------------------------------------------------------- */
+
+    void computeMolecules( int firstMolecule, int lastMolecule,
+                           const std::vector<RealVec>& particlePositions,
+                           const std::vector<std::vector<int> >& allParticleIndices,
+                           const RealVec& box, bool usePeriodic );
+
+    /**---------------------------------------------------------------------------------------
+
+       Get the numMonomerVariables variables of a molecule
+
+       --------------------------------------------------------------------------------------- */
+
+    const Variable* getMonomerVariables( int molecule ) const {
+        return &monomerVariables[numMonomerVariables*molecule];
+    }
+
+    /**---------------------------------------------------------------------------------------
+
+       Get the numPairVariables variables of a pair of molecules
+
+       @param moleculeM             index of the first molecule, lower than moleculeN
+       @param moleculeN             index of the second molecule
+       @param oxygenVector          output Om - On (nm) for the image of n the variables were computed for
+
+       @return the variables or NULL if the pair is not in the neighbor list
+
+       --------------------------------------------------------------------------------------- */
+
+    const Variable* getPairVariables( int moleculeM, int moleculeN, RealVec& oxygenVector ) const;
+
+private:
+
+    const ThreeNeighborPairList* pairList;
+    std::vector<Variable> monomerVariables;
+    // numPairVariables entries for each entry of pairList->neighbors; only the
+    // entries (m, n) with m < n are computed
+    std::vector<Variable> pairVariables;
+    std::vector<RealVec> pairOxygenVectors;
+};
+
+// ---------------------------------------------------------------------------------------
+
 class MBPolReferenceThreeBodyForce {
 
 public:
@@ -135,6 +236,28 @@ public:
     
     RealVec getPeriodicBox( void ) const;
 
+    /**---------------------------------------------------------------------------------------
+    
+       Set the variables computed for this step; the trimers take their variables from them
+       instead of computing them. If not set (the default), all variables are computed
+    
+       @param variables variables computed for the current positions, or NULL
+    
+       --------------------------------------------------------------------------------------- */
+    
+    void setVariables( const MBPolReferenceThreeBodyVariables* variables );
+
+    /**---------------------------------------------------------------------------------------
+    
+       Set whether forces are computed; if not, calculateForceAndEnergy() only returns the
+       energy and evaluates the polynomial without its gradients. The default is true
+    
+       @param includeForces true if forces are to be computed
+    
+       --------------------------------------------------------------------------------------- */
+    
+    void setIncludeForces( bool includeForces );
+
     /**---------------------------------------------------------------------------------------
     
        Calculate ThreeBody ixn using neighbor list
@@ -156,6 +279,29 @@ public:
                                         const std::vector<std::vector<int> >& allParticleIndices,
                                         const ThreeNeighborList& neighborList,
                                         std::vector<OpenMM::RealVec>& forces ) const;
+
+    /**---------------------------------------------------------------------------------------
+    
+       Calculate ThreeBody ixn for the triplets [firstIndex, lastIndex) of the neighbor list;
+       used to split the list between threads
+    
+       @param numParticles            number of particles
+       @param particlePositions       Cartesian coordinates of particles
+       @param allParticleIndices      particle indices of each molecule
+       @param neighborList            neighbor list
+       @param firstIndex              index of the first entry of the neighbor list to compute
+       @param lastIndex               one past the index of the last entry to compute
+       @param forces                  add forces to this vector
+    
+       @return energy
+    
+       --------------------------------------------------------------------------------------- */
+    
+    RealOpenMM calculateForceAndEnergy( int numParticles, const std::vector<OpenMM::RealVec>& particlePositions, 
+                                        const std::vector<std::vector<int> >& allParticleIndices,
+                                        const ThreeNeighborList& neighborList,
+                                        unsigned int firstIndex, unsigned int lastIndex,
+                                        std::vector<OpenMM::RealVec>& forces ) const;
          
 private:
 
@@ -164,6 +310,63 @@ private:
 
     RealVec _periodicBoxDimensions;
 
+    const MBPolReferenceThreeBodyVariables* _variables;
+    bool _includeForces;
+
+    struct ThreeBodyTrimer;
+
+    /**---------------------------------------------------------------------------------------
+
+       Image a trimer and compute the 36 variables of the 3-body polynomial
+
+       @param  siteI                index of the first molecule
+       @param  siteJ                index of the second molecule
+       @param  siteQ                index of the third molecule
+       @param  particlePositions    Cartesian coordinates of particles
+       @param  allParticleIndices   particle indices of each molecule
+       @param  trimer               output state needed by accumulateTrimerForces()
+       @param  x                    output polynomial variables
+
+       @return false if the trimer is outside the range of the 3-body potential
+
+       --------------------------------------------------------------------------------------- */
+
+    bool setupTrimer( int siteI, int siteJ, int siteQ,
+                      const std::vector<RealVec>& particlePositions,
+                      const std::vector<std::vector<int> >& allParticleIndices,
+                      ThreeBodyTrimer& trimer, double x[36] ) const;
+
+    /**---------------------------------------------------------------------------------------
+
+       Apply the switch and add the forces of a trimer given the polynomial value and gradients
+
+       @param  trimer               trimer state from setupTrimer()
+       @param  retval               value of the polynomial
+       @param  g                    gradients of the polynomial w.r.t. its variables; scaled in place
+       @param  allParticleIndices   particle indices of each molecule
+       @param  forces               add forces to this vector
+
+       @return energy for ixn
+
+       --------------------------------------------------------------------------------------- */
+
+    RealOpenMM accumulateTrimerForces( const ThreeBodyTrimer& trimer, double retval, double g[36],
+                                       const std::vector<std::vector<int> >& allParticleIndices,
+                                       std::vector<RealVec>& forces ) const;
+
+    /**---------------------------------------------------------------------------------------
+
+       Apply the switch to the polynomial value of a trimer, without forces
+
+       @param  trimer               trimer state from setupTrimer()
+       @param  retval               value of the polynomial
+
+       @return energy for ixn
+
+       --------------------------------------------------------------------------------------- */
+
+    RealOpenMM trimerEnergy( const ThreeBodyTrimer& trimer, double retval ) const;
+
     /**---------------------------------------------------------------------------------------
 
        Calculate pair ixn
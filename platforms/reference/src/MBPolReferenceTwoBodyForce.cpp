@@ -34,7 +34,7 @@ using std::vector;
 using OpenMM::RealVec;
 using namespace MBPolPlugin;
 
-MBPolReferenceTwoBodyForce::MBPolReferenceTwoBodyForce( ) : _nonbondedMethod(NoCutoff), _cutoff(1.0e+10) {
+MBPolReferenceTwoBodyForce::MBPolReferenceTwoBodyForce( ) : _nonbondedMethod(NoCutoff), _cutoff(1.0e+10), _monomers(NULL), _includeForces(true) {
 
     _periodicBoxDimensions = RealVec( 0.0, 0.0, 0.0 );
 }
@@ -63,6 +63,14 @@ RealVec MBPolReferenceTwoBodyForce::getPeriodicBox( void ) const {
     return _periodicBoxDimensions;
 }
 
+void MBPolReferenceTwoBodyForce::setMonomers( const MBPolReferenceTwoBodyMonomers* monomers ){
+    _monomers = monomers;
+}
+
+void MBPolReferenceTwoBodyForce::setIncludeForces( bool includeForces ){
+    _includeForces = includeForces;
+}
+
 void imageParticles(const RealVec& box, const RealVec & referenceParticle, RealVec& particleToImage)
 {
     // Periodic boundary conditions imaging of particleToImage with respect to referenceParticle
@@ -76,6 +84,11 @@ void imageParticles(const RealVec& box, const RealVec & referenceParticle, RealV
 }
 
 void imageMolecules(const RealVec& box, std::vector<RealVec>& allPositions)
+{
+    imageMolecules(box, &allPositions[0], allPositions.size()/3);
+}
+
+void imageMolecules(const RealVec& box, RealVec* allPositions, unsigned int numMolecules)
 {
 
     // Take first oxygen as central atom
@@ -85,7 +98,7 @@ void imageMolecules(const RealVec& box, std::vector<RealVec>& allPositions)
     imageParticles(box, allPositions[Oa], allPositions[Ha1]);
     imageParticles(box, allPositions[Oa], allPositions[Ha2]);
 
-    if (allPositions.size() >= Hb1) // Two molecules
+    if (numMolecules >= 2) // Two molecules
     {
         // Now image the oxygen of the second molecule
 
@@ -95,7 +108,7 @@ void imageMolecules(const RealVec& box, std::vector<RealVec>& allPositions)
         imageParticles(box, allPositions[Ob], allPositions[Hb1]);
         imageParticles(box, allPositions[Ob], allPositions[Hb2]);
 
-        if (allPositions.size() >= Hc1) // Three molecules
+        if (numMolecules >= 3) // Three molecules
         {
             // Now image the oxygen of the third molecule
             imageParticles(box, allPositions[Oa], allPositions[Oc]);
@@ -107,10 +120,90 @@ void imageMolecules(const RealVec& box, std::vector<RealVec>& allPositions)
     }
 
 }
-RealOpenMM MBPolReferenceTwoBodyForce::calculatePairIxn( int siteI, int siteJ,
-                                                      const std::vector<RealVec>& particlePositions,
-                                                      const std::vector<std::vector<int> >& allParticleIndices,
-                                                      vector<RealVec>& forces ) const {
+static const double d0_intra = 1.0;
+static const double d0_inter = 4.0;
+
+void MBPolReferenceTwoBodyMonomers::compute( const std::vector<RealVec>& particlePositions,
+                                             const std::vector<std::vector<int> >& allParticleIndices,
+                                             const RealVec& box, bool usePeriodic ){
+
+    numParticles = particlePositions.size();
+    monomers.resize(allParticleIndices.size());
+
+    // same positions (A) and imaging as setupDimer() for the first molecule of a dimer
+
+    for( unsigned int ii = 0; ii < monomers.size(); ii++ ){
+        Monomer& m = monomers[ii];
+        RealVec pos[3];
+        for( unsigned int i = 0; i < 3; i++ )
+            pos[i] = particlePositions[allParticleIndices[ii][i]] * nm_to_A;
+        if( usePeriodic ){
+            imageParticles(box * nm_to_A, pos[0], pos[1]);
+            imageParticles(box * nm_to_A, pos[0], pos[2]);
+        }
+
+        monomer mono;
+        mono.setup(pos[0], pos[1], pos[2],
+                   in_plane_gamma, out_of_plane_gamma,
+                   m.extraPoints[0], m.extraPoints[1]);
+        m.oxygen = pos[0];
+        m.oh1    = mono.oh1;
+        m.oh2    = mono.oh2;
+
+        variable ctxt[3];
+        m.intraValues[0] = ctxt[0].v_exp(d0_intra, k_HH_intra, pos[1], pos[2]);
+        m.intraValues[1] = ctxt[1].v_exp(d0_intra, k_OH_intra, pos[0], pos[1]);
+        m.intraValues[2] = ctxt[2].v_exp(d0_intra, k_OH_intra, pos[0], pos[2]);
+        for( unsigned int i = 0; i < 3; i++ )
+            m.intraGradients[i] = ctxt[i].g;
+    }
+}
+
+void MBPolReferenceTwoBodyMonomers::distributeForces( const std::vector<std::vector<int> >& allParticleIndices,
+                                                      const std::vector<RealVec>& monomerForces,
+                                                      std::vector<RealVec>& forces ) const {
+
+    for( int ii = 0; ii < numParticles; ii++ )
+        forces[ii] += monomerForces[ii];
+
+    // the extra points are linear in the forces on them, so the sum over all dimers
+    // is distributed once per molecule
+
+    for( unsigned int ii = 0; ii < monomers.size(); ii++ ){
+        monomer mono;
+        mono.oh1 = monomers[ii].oh1;
+        mono.oh2 = monomers[ii].oh2;
+
+        RealVec extraForces[2] = { monomerForces[getExtraPointForceIndex(ii)],
+                                   monomerForces[getExtraPointForceIndex(ii) + 1] };
+        RealVec atomForces[3];
+        mono.grads(extraForces[0], extraForces[1],
+                   in_plane_gamma, out_of_plane_gamma,
+                   atomForces[0], atomForces[1], atomForces[2]);
+
+        for( unsigned int i = 0; i < 3; i++ )
+            forces[allParticleIndices[ii][i]] += atomForces[i];
+    }
+}
+
+// state of a dimer kept between the computation of the polynomial variables
+// and the distribution of the polynomial gradients
+
+struct MBPolReferenceTwoBodyForce::TwoBodyDimer {
+    int siteI;
+    int siteJ;
+    RealVec allPositions[6];
+    RealVec extraPoints[4];
+    RealVec dOO;
+    double rOO;
+    monomer ma, mb;
+    variable ctxt[31];
+};
+
+bool MBPolReferenceTwoBodyForce::setupDimer( int siteI, int siteJ,
+                                             const std::vector<RealVec>& particlePositions,
+                                             const std::vector<std::vector<int> >& allParticleIndices,
+                                             TwoBodyDimer& dimer, double v[31] ) const {
 
         // siteI and siteJ are indices in a oxygen-only array, in order to get the position of an oxygen, we need:
         // allParticleIndices[siteI][0]
@@ -119,102 +212,128 @@ RealOpenMM MBPolReferenceTwoBodyForce::calculatePairIxn( int siteI, int siteJ,
         // same for the second water molecule
         // offsets
 
-        std::vector<RealVec> allPositions;
+        dimer.siteI = siteI;
+        dimer.siteJ = siteJ;
 
-        for (unsigned int i=0; i < 3; i++)
-            allPositions.push_back(particlePositions[allParticleIndices[siteI][i]] * nm_to_A);
+        RealVec* allPositions = dimer.allPositions;
 
         for (unsigned int i=0; i < 3; i++)
-            allPositions.push_back(particlePositions[allParticleIndices[siteJ][i]] * nm_to_A);
+            allPositions[i] = particlePositions[allParticleIndices[siteI][i]] * nm_to_A;
 
-        std::vector<RealVec> extraPoints;
-        extraPoints.resize(4);
+        for (unsigned int i=0; i < 3; i++)
+            allPositions[i + 3] = particlePositions[allParticleIndices[siteJ][i]] * nm_to_A;
 
         if( _nonbondedMethod == CutoffPeriodic )
-            imageMolecules(_periodicBoxDimensions * nm_to_A, allPositions);
-
-        RealVec dOO = allPositions[Oa] - allPositions[Ob];
+            imageMolecules(_periodicBoxDimensions * nm_to_A, allPositions, 2);
 
-        const double rOOsq = dOO[0]*dOO[0] + dOO[1]*dOO[1] + dOO[2]*dOO[2];
-        const double rOO = std::sqrt(rOOsq);
+        dimer.dOO = dimer.allPositions[Oa] - dimer.allPositions[Ob];
 
-        if (rOO > r2f)
-            return 0.0;
-
-        if (rOO < 2.)
-            return 0.0;
+        const double rOOsq = dimer.dOO[0]*dimer.dOO[0] + dimer.dOO[1]*dimer.dOO[1] + dimer.dOO[2]*dimer.dOO[2];
+        dimer.rOO = std::sqrt(rOOsq);
 
+        // the neighbor list may be built with a skin beyond the cutoff
 
-        // the extra-points
+        if (dimer.rOO > r2f || dimer.rOO > _cutoff*nm_to_A)
+            return false;
 
-        monomer ma, mb;
+        if (dimer.rOO < 2.)
+            return false;
 
-        ma.setup(allPositions[Oa], allPositions[Ha1], allPositions[Ha2],
-                 in_plane_gamma, out_of_plane_gamma,
-                 extraPoints[Xa1], extraPoints[Xa2]);
+        RealVec* pos     = dimer.allPositions;
+        RealVec* extra   = dimer.extraPoints;
+        variable* ctxt   = dimer.ctxt;
 
-        mb.setup(allPositions[Ob], allPositions[Hb1], allPositions[Hb2],
-                 in_plane_gamma, out_of_plane_gamma,
-                 extraPoints[Xb1], extraPoints[Xb2]);
+        if (_monomers) {
 
-        // variables
+            // the extra-points and the intramolecular variables of the monomers,
+            // moved to the image of the molecule the dimer uses
 
-        const double d0_intra = 1.0;
-        const double d0_inter = 4.0;
+            const MBPolReferenceTwoBodyMonomers::Monomer& a = _monomers->getMonomer(siteI);
+            const MBPolReferenceTwoBodyMonomers::Monomer& b = _monomers->getMonomer(siteJ);
 
-        double v[31]; // stored separately (gets passed to poly::eval)
+            const RealVec shiftA = pos[Oa] - a.oxygen;
+            const RealVec shiftB = pos[Ob] - b.oxygen;
 
+            extra[Xa1] = a.extraPoints[0] + shiftA;
+            extra[Xa2] = a.extraPoints[1] + shiftA;
+            extra[Xb1] = b.extraPoints[0] + shiftB;
+            extra[Xb2] = b.extraPoints[1] + shiftB;
 
-        variable ctxt[31];
+            v[0] = a.intraValues[0];    ctxt[0].g = a.intraGradients[0];
+            v[1] = b.intraValues[0];    ctxt[1].g = b.intraGradients[0];
 
-        v[0] = ctxt[0].v_exp(d0_intra, k_HH_intra,   allPositions[Ha1], allPositions[Ha2]);
-        v[1] = ctxt[1].v_exp(d0_intra, k_HH_intra,   allPositions[Hb1], allPositions[Hb2]);
+            v[2] = a.intraValues[1];    ctxt[2].g = a.intraGradients[1];
+            v[3] = a.intraValues[2];    ctxt[3].g = a.intraGradients[2];
+            v[4] = b.intraValues[1];    ctxt[4].g = b.intraGradients[1];
+            v[5] = b.intraValues[2];    ctxt[5].g = b.intraGradients[2];
 
-        v[2] = ctxt[2].v_exp(d0_intra, k_OH_intra,   allPositions[Oa], allPositions[Ha1]);
-        v[3] = ctxt[3].v_exp(d0_intra, k_OH_intra,   allPositions[Oa], allPositions[Ha2]);
-        v[4] = ctxt[4].v_exp(d0_intra, k_OH_intra,   allPositions[Ob], allPositions[Hb1]);
-        v[5] = ctxt[5].v_exp(d0_intra, k_OH_intra,   allPositions[Ob], allPositions[Hb2]);
+        } else {
 
-        v[6] = ctxt[6].v_coul(d0_inter, k_HH_coul,   allPositions[Ha1], allPositions[Hb1]);
-        v[7] = ctxt[7].v_coul(d0_inter, k_HH_coul,   allPositions[Ha1], allPositions[Hb2]);
-        v[8] = ctxt[8].v_coul(d0_inter, k_HH_coul,   allPositions[Ha2], allPositions[Hb1]);
-        v[9] = ctxt[9].v_coul(d0_inter, k_HH_coul,   allPositions[Ha2], allPositions[Hb2]);
+            // the extra-points
 
-        v[10] = ctxt[10].v_coul(d0_inter, k_OH_coul, allPositions[Oa], allPositions[Hb1]);
-        v[11] = ctxt[11].v_coul(d0_inter, k_OH_coul, allPositions[Oa], allPositions[Hb2]);
-        v[12] = ctxt[12].v_coul(d0_inter, k_OH_coul, allPositions[Ob], allPositions[Ha1]);
-        v[13] = ctxt[13].v_coul(d0_inter, k_OH_coul, allPositions[Ob], allPositions[Ha2]);
+            dimer.ma.setup(pos[Oa], pos[Ha1], pos[Ha2],
+                     in_plane_gamma, out_of_plane_gamma,
+                     extra[Xa1], extra[Xa2]);
 
-        v[14] = ctxt[14].v_coul(d0_inter, k_OO_coul, allPositions[Oa], allPositions[Ob]);
+            dimer.mb.setup(pos[Ob], pos[Hb1], pos[Hb2],
+                     in_plane_gamma, out_of_plane_gamma,
+                     extra[Xb1], extra[Xb2]);
 
-        v[15] = ctxt[15].v_exp(d0_inter, k_XH_main,  extraPoints[Xa1], allPositions[Hb1]);
-        v[16] = ctxt[16].v_exp(d0_inter, k_XH_main,  extraPoints[Xa1], allPositions[Hb2]);
-        v[17] = ctxt[17].v_exp(d0_inter, k_XH_main,  extraPoints[Xa2], allPositions[Hb1]);
-        v[18] = ctxt[18].v_exp(d0_inter, k_XH_main,  extraPoints[Xa2], allPositions[Hb2]);
-        v[19] = ctxt[19].v_exp(d0_inter, k_XH_main,  extraPoints[Xb1], allPositions[Ha1]);
-        v[20] = ctxt[20].v_exp(d0_inter, k_XH_main,  extraPoints[Xb1], allPositions[Ha2]);
-        v[21] = ctxt[21].v_exp(d0_inter, k_XH_main,  extraPoints[Xb2], allPositions[Ha1]);
-        v[22] = ctxt[22].v_exp(d0_inter, k_XH_main,  extraPoints[Xb2], allPositions[Ha2]);
+            // variables
 
-        v[23] = ctxt[23].v_exp(d0_inter, k_XO_main,  allPositions[Oa ], extraPoints[Xb1]);
-        v[24] = ctxt[24].v_exp(d0_inter, k_XO_main,  allPositions[Oa ], extraPoints[Xb2]);
-        v[25] = ctxt[25].v_exp(d0_inter, k_XO_main,  allPositions[Ob ], extraPoints[Xa1]);
-        v[26] = ctxt[26].v_exp(d0_inter, k_XO_main,  allPositions[Ob ], extraPoints[Xa2]);
+            v[0] = ctxt[0].v_exp(d0_intra, k_HH_intra,   pos[Ha1], pos[Ha2]);
+            v[1] = ctxt[1].v_exp(d0_intra, k_HH_intra,   pos[Hb1], pos[Hb2]);
 
-        v[27] = ctxt[27].v_exp(d0_inter, k_XX_main,  extraPoints[Xa1], extraPoints[Xb1]);
-        v[28] = ctxt[28].v_exp(d0_inter, k_XX_main,  extraPoints[Xa1], extraPoints[Xb2]);
-        v[29] = ctxt[29].v_exp(d0_inter, k_XX_main,  extraPoints[Xa2], extraPoints[Xb1]);
-        v[30] = ctxt[30].v_exp(d0_inter, k_XX_main,  extraPoints[Xa2], extraPoints[Xb2]);
+            v[2] = ctxt[2].v_exp(d0_intra, k_OH_intra,   pos[Oa], pos[Ha1]);
+            v[3] = ctxt[3].v_exp(d0_intra, k_OH_intra,   pos[Oa], pos[Ha2]);
+            v[4] = ctxt[4].v_exp(d0_intra, k_OH_intra,   pos[Ob], pos[Hb1]);
+            v[5] = ctxt[5].v_exp(d0_intra, k_OH_intra,   pos[Ob], pos[Hb2]);
+        }
 
-        double g[31];
-        const double E_poly = poly_2b_v6x_eval(thefit, v, g);
+        v[6] = ctxt[6].v_coul(d0_inter, k_HH_coul,   pos[Ha1], pos[Hb1]);
+        v[7] = ctxt[7].v_coul(d0_inter, k_HH_coul,   pos[Ha1], pos[Hb2]);
+        v[8] = ctxt[8].v_coul(d0_inter, k_HH_coul,   pos[Ha2], pos[Hb1]);
+        v[9] = ctxt[9].v_coul(d0_inter, k_HH_coul,   pos[Ha2], pos[Hb2]);
+
+        v[10] = ctxt[10].v_coul(d0_inter, k_OH_coul, pos[Oa], pos[Hb1]);
+        v[11] = ctxt[11].v_coul(d0_inter, k_OH_coul, pos[Oa], pos[Hb2]);
+        v[12] = ctxt[12].v_coul(d0_inter, k_OH_coul, pos[Ob], pos[Ha1]);
+        v[13] = ctxt[13].v_coul(d0_inter, k_OH_coul, pos[Ob], pos[Ha2]);
+
+        v[14] = ctxt[14].v_coul(d0_inter, k_OO_coul, pos[Oa], pos[Ob]);
+
+        v[15] = ctxt[15].v_exp(d0_inter, k_XH_main,  extra[Xa1], pos[Hb1]);
+        v[16] = ctxt[16].v_exp(d0_inter, k_XH_main,  extra[Xa1], pos[Hb2]);
+        v[17] = ctxt[17].v_exp(d0_inter, k_XH_main,  extra[Xa2], pos[Hb1]);
+        v[18] = ctxt[18].v_exp(d0_inter, k_XH_main,  extra[Xa2], pos[Hb2]);
+        v[19] = ctxt[19].v_exp(d0_inter, k_XH_main,  extra[Xb1], pos[Ha1]);
+        v[20] = ctxt[20].v_exp(d0_inter, k_XH_main,  extra[Xb1], pos[Ha2]);
+        v[21] = ctxt[21].v_exp(d0_inter, k_XH_main,  extra[Xb2], pos[Ha1]);
+        v[22] = ctxt[22].v_exp(d0_inter, k_XH_main,  extra[Xb2], pos[Ha2]);
+
+        v[23] = ctxt[23].v_exp(d0_inter, k_XO_main,  pos[Oa ], extra[Xb1]);
+        v[24] = ctxt[24].v_exp(d0_inter, k_XO_main,  pos[Oa ], extra[Xb2]);
+        v[25] = ctxt[25].v_exp(d0_inter, k_XO_main,  pos[Ob ], extra[Xa1]);
+        v[26] = ctxt[26].v_exp(d0_inter, k_XO_main,  pos[Ob ], extra[Xa2]);
+
+        v[27] = ctxt[27].v_exp(d0_inter, k_XX_main,  extra[Xa1], extra[Xb1]);
+        v[28] = ctxt[28].v_exp(d0_inter, k_XX_main,  extra[Xa1], extra[Xb2]);
+        v[29] = ctxt[29].v_exp(d0_inter, k_XX_main,  extra[Xa2], extra[Xb1]);
+        v[30] = ctxt[30].v_exp(d0_inter, k_XX_main,  extra[Xa2], extra[Xb2]);
+
+        return true;
+}
 
+RealOpenMM MBPolReferenceTwoBodyForce::accumulateDimerForces( const TwoBodyDimer& dimer, double E_poly, const double g[31],
+                                                              const std::vector<std::vector<int> >& allParticleIndices,
+                                                              vector<RealVec>& forces ) const {
 
-        std::vector<RealVec> allForces;
-        allForces.resize(allPositions.size());
+        const variable* ctxt = dimer.ctxt;
+        int siteI            = dimer.siteI;
+        int siteJ            = dimer.siteJ;
 
-        std::vector<RealVec> extraForces;
-        extraForces.resize(extraPoints.size());
+        RealVec allForces[6];
+        RealVec extraForces[4];
 
         ctxt[0].grads(g[0],   allForces[Ha1], allForces[Ha2]);
         ctxt[1].grads(g[1],   allForces[Hb1], allForces[Hb2]);
@@ -255,23 +374,33 @@ RealOpenMM MBPolReferenceTwoBodyForce::calculatePairIxn( int siteI, int siteJ,
         ctxt[29].grads(g[29], extraForces[Xa2], extraForces[Xb1]);
         ctxt[30].grads(g[30], extraForces[Xa2], extraForces[Xb2]);
 
-        // distribute gradients w.r.t. the X-points
-
-        ma.grads(extraForces[Xa1], extraForces[Xa2],
-                 in_plane_gamma, out_of_plane_gamma,
-                 allForces[Oa], allForces[Ha1], allForces[Ha2]);
-
-        mb.grads(extraForces[Xb1], extraForces[Xb2],
-                 in_plane_gamma, out_of_plane_gamma,
-                 allForces[Ob], allForces[Hb1], allForces[Hb2]);
-
         // the switch
 
         double gsw;
-        double sw = f_switch(rOO, gsw);
+        double sw = f_switch(dimer.rOO, gsw);
 
         double cal2joule = 4.184;
 
+        // distribute gradients w.r.t. the X-points, or leave that to
+        // MBPolReferenceTwoBodyMonomers::distributeForces()
+
+        if (_monomers) {
+            const int extraI = _monomers->getExtraPointForceIndex(siteI);
+            const int extraJ = _monomers->getExtraPointForceIndex(siteJ);
+            forces[extraI]     += extraForces[Xa1] * sw * cal2joule * -10.;
+            forces[extraI + 1] += extraForces[Xa2] * sw * cal2joule * -10.;
+            forces[extraJ]     += extraForces[Xb1] * sw * cal2joule * -10.;
+            forces[extraJ + 1] += extraForces[Xb2] * sw * cal2joule * -10.;
+        } else {
+            dimer.ma.grads(extraForces[Xa1], extraForces[Xa2],
+                     in_plane_gamma, out_of_plane_gamma,
+                     allForces[Oa], allForces[Ha1], allForces[Ha2]);
+
+            dimer.mb.grads(extraForces[Xb1], extraForces[Xb2],
+                     in_plane_gamma, out_of_plane_gamma,
+                     allForces[Ob], allForces[Hb1], allForces[Hb2]);
+        }
+
         // first water molecule
         forces[allParticleIndices[siteI][0]] += allForces[Oa]  * sw * cal2joule * -10.;
         forces[allParticleIndices[siteI][1]] += allForces[Ha1] * sw * cal2joule * -10.;
@@ -282,9 +411,9 @@ RealOpenMM MBPolReferenceTwoBodyForce::calculatePairIxn( int siteI, int siteJ,
         forces[allParticleIndices[siteJ][2]] += allForces[Hb2] * sw * cal2joule * -10.;
 
         // gradient of the switch
-        gsw *= E_poly/rOO;
+        gsw *= E_poly/dimer.rOO;
         for (int i = 0; i < 3; ++i) {
-            const double d = gsw*dOO[i];
+            const double d = gsw*dimer.dOO[i];
             forces[allParticleIndices[siteI][0]][i] += d * cal2joule * -10.;
             forces[allParticleIndices[siteJ][0]][i] -= d * cal2joule * -10.;
         }
@@ -295,10 +424,50 @@ RealOpenMM MBPolReferenceTwoBodyForce::calculatePairIxn( int siteI, int siteJ,
 
 }
 
+RealOpenMM MBPolReferenceTwoBodyForce::dimerEnergy( const TwoBodyDimer& dimer, double E_poly ) const {
+
+    double gsw;
+    const double sw = f_switch(dimer.rOO, gsw);
+
+    const double cal2joule = 4.184;
+
+    return sw*E_poly*cal2joule;
+}
+
+RealOpenMM MBPolReferenceTwoBodyForce::calculatePairIxn( int siteI, int siteJ,
+                                                      const std::vector<RealVec>& particlePositions,
+                                                      const std::vector<std::vector<int> >& allParticleIndices,
+                                                      vector<RealVec>& forces ) const {
+
+        TwoBodyDimer dimer;
+        double v[31]; // stored separately (gets passed to poly::eval)
+
+        if (!setupDimer(siteI, siteJ, particlePositions, allParticleIndices, dimer, v))
+            return 0.0;
+
+        double g[31];
+        const double E_poly = poly_2b_v6x_eval(thefit, v, g);
+
+        return accumulateDimerForces(dimer, E_poly, g, allParticleIndices, forces);
+}
+
+RealOpenMM MBPolReferenceTwoBodyForce::calculateForceAndEnergy( int numParticles,
+                                                             const vector<RealVec>& particlePositions,
+                                                             const std::vector<std::vector<int> >& allParticleIndices,
+                                                             const NeighborList& neighborList,
+                                                             vector<double>& polynomialScratch,
+                                                             vector<RealVec>& forces ) const {
+
+    return calculateForceAndEnergy( numParticles, particlePositions, allParticleIndices, neighborList,
+                                    0, neighborList.size(), polynomialScratch, forces );
+}
+
 RealOpenMM MBPolReferenceTwoBodyForce::calculateForceAndEnergy( int numParticles,
                                                              const vector<RealVec>& particlePositions,
                                                              const std::vector<std::vector<int> >& allParticleIndices,
                                                              const NeighborList& neighborList,
+                                                             unsigned int firstIndex, unsigned int lastIndex,
+                                                             vector<double>& polynomialScratch,
                                                              vector<RealVec>& forces ) const {
 
     // loop over neighbor list
@@ -307,16 +476,64 @@ RealOpenMM MBPolReferenceTwoBodyForce::calculateForceAndEnergy( int numParticles
     //        then call addReducedForce() to apportion force to particle and its covalent partner
     //        based on reduction factor
 
+    // the polynomial is evaluated for poly_2b_v6x_batch dimers at a time
+    // (see poly_2b_v6x_eval_batch); dimers outside the cutoff are skipped
+    // before they enter a batch, leftover dimers are computed one by one
+
+    if( polynomialScratch.size() < poly_2b_v6x_scratch_size ){
+        polynomialScratch.resize( poly_2b_v6x_scratch_size );
+    }
+
+    TwoBodyDimer dimers[poly_2b_v6x_batch];
+    double v[31][poly_2b_v6x_batch];
+    double g[31][poly_2b_v6x_batch];
+    double E_poly[poly_2b_v6x_batch];
+    double vk[31], gk[31];
+    unsigned int numDimers = 0;
+
     RealOpenMM energy = 0.;
-    for( unsigned int ii = 0; ii < neighborList.size(); ii++ ){
+    for( unsigned int ii = firstIndex; ii < lastIndex; ii++ ){
 
         OpenMM::AtomPair pair       = neighborList[ii];
         int siteI                   = pair.first;
         int siteJ                   = pair.second;
 
-        energy                     += calculatePairIxn( siteI, siteJ,
-                particlePositions, allParticleIndices, forces );
+        if( !setupDimer( siteI, siteJ, particlePositions, allParticleIndices, dimers[numDimers], vk ) )
+            continue;
+
+        for( unsigned int jj = 0; jj < 31; jj++ )
+            v[jj][numDimers] = vk[jj];
+
+        if( ++numDimers < poly_2b_v6x_batch )
+            continue;
+
+        if( !_includeForces ){
+            poly_2b_v6x_eval_batch( thefit, v, E_poly, &polynomialScratch[0] );
+            for( unsigned int kk = 0; kk < numDimers; kk++ )
+                energy += dimerEnergy( dimers[kk], E_poly[kk] );
+            numDimers = 0;
+            continue;
+        }
+
+        poly_2b_v6x_eval_batch( thefit, v, g, E_poly, &polynomialScratch[0] );
 
+        for( unsigned int kk = 0; kk < numDimers; kk++ ){
+            for( unsigned int jj = 0; jj < 31; jj++ )
+                gk[jj] = g[jj][kk];
+            energy += accumulateDimerForces( dimers[kk], E_poly[kk], gk, allParticleIndices, forces );
+        }
+        numDimers = 0;
+    }
+
+    for( unsigned int kk = 0; kk < numDimers; kk++ ){
+        for( unsigned int jj = 0; jj < 31; jj++ )
+            vk[jj] = v[jj][kk];
+        if( !_includeForces ){
+            energy += dimerEnergy( dimers[kk], poly_2b_v6x_eval( thefit, vk ) );
+            continue;
+        }
+        const double E = poly_2b_v6x_eval( thefit, vk, gk );
+        energy += accumulateDimerForces( dimers[kk], E, gk, allParticleIndices, forces );
     }
 
     return energy;
@@ -41,6 +41,95 @@ typedef  RealOpenMM (MBPolReferenceTwoBodyForce::*CombiningFunction)( RealOpenMM
 void imageParticles(const RealVec& box, const RealVec & referenceParticle, RealVec& particleToImage);
 
 void imageMolecules(const RealVec& box, std::vector<RealVec>& allPositions);
+void imageMolecules(const RealVec& box, RealVec* allPositions, unsigned int numMolecules);
+
+// ---------------------------------------------------------------------------------------
+
+/**---------------------------------------------------------------------------------------
+
+   Monomer data of the 2-body force computed once per step: the extra points (X-sites)
+   of every molecule with the data to chain their gradients back to its atoms, and its
+   intramolecular variables of the 2-body polynomial
+
+   --------------------------------------------------------------------------------------- */
+
+class MBPolReferenceTwoBodyMonomers {
+
+public:
+
+    struct Monomer {
+        // position of the oxygen (A); the hydrogens and the extra points
+        // are next to it if the box is periodic
+        RealVec oxygen;
+        RealVec extraPoints[2];
+        // O-H vectors (A) the extra points are built from
+        RealVec oh1, oh2;
+        // H1-H2, O-H1 and O-H2 variables and their gradients w.r.t. the first atom
+        double intraValues[3];
+        RealVec intraGradients[3];
+    };
+
+    /**---------------------------------------------------------------------------------------
+
+       Compute the data of all molecules
+
+       @param particlePositions     Cartesian coordinates of particles
+       @param allParticleIndices    particle indices of each molecule
+       @param box                   periodic box dimensions
+       @param usePeriodic           if true, the hydrogens are imaged next to their oxygen
+
+       --------------------------------------------------------------------------------------- */
+
+    void compute( const std::vector<RealVec>& particlePositions,
+                  const std::vector<std::vector<int> >& allParticleIndices,
+                  const RealVec& box, bool usePeriodic );
+
+    const Monomer& getMonomer( int molecule ) const {
+        return monomers[molecule];
+    }
+
+    /**---------------------------------------------------------------------------------------
+
+       Get the number of entries of the force vector of MBPolReferenceTwoBodyForce using
+       these monomers: the forces on the particles followed by the forces on the two extra
+       points of each molecule
+
+       --------------------------------------------------------------------------------------- */
+
+    int getNumForces( void ) const {
+        return numParticles + 2*(int) monomers.size();
+    }
+
+    /**---------------------------------------------------------------------------------------
+
+       Get the index in the force vector of the force on the first extra point
+       of a molecule; the force on the second extra point follows it
+
+       --------------------------------------------------------------------------------------- */
+
+    int getExtraPointForceIndex( int molecule ) const {
+        return numParticles + 2*molecule;
+    }
+
+    /**---------------------------------------------------------------------------------------
+
+       Add the forces on the particles and on the extra points to the forces on the particles
+
+       @param allParticleIndices    particle indices of each molecule
+       @param monomerForces         forces on the particles and the extra points (getNumForces() entries)
+       @param forces                add forces to this vector
+
+       --------------------------------------------------------------------------------------- */
+
+    void distributeForces( const std::vector<std::vector<int> >& allParticleIndices,
+                           const std::vector<RealVec>& monomerForces,
+                           std::vector<RealVec>& forces ) const;
+
+private:
+
+    int numParticles;
+    std::vector<Monomer> monomers;
+};
 
 // ---------------------------------------------------------------------------------------
 
@@ -140,6 +229,31 @@ public:
     
     RealVec getPeriodicBox( void ) const;
 
+    /**---------------------------------------------------------------------------------------
+    
+       Set the monomer data computed for this step. The dimers take their extra points and
+       intramolecular variables from it, and the forces on the extra points are added to the
+       force vector (see MBPolReferenceTwoBodyMonomers::getNumForces()) instead of being
+       distributed to the atoms for every dimer. If not set (the default), all is computed
+       per dimer
+    
+       @param monomers monomer data computed for the current positions, or NULL
+    
+       --------------------------------------------------------------------------------------- */
+    
+    void setMonomers( const MBPolReferenceTwoBodyMonomers* monomers );
+
+    /**---------------------------------------------------------------------------------------
+    
+       Set whether forces are computed; if not, calculateForceAndEnergy() only returns the
+       energy and evaluates the polynomial without its gradients. The default is true
+    
+       @param includeForces true if forces are to be computed
+    
+       --------------------------------------------------------------------------------------- */
+    
+    void setIncludeForces( bool includeForces );
+
     /**---------------------------------------------------------------------------------------
     
        Calculate TwoBody ixn using neighbor list
@@ -151,6 +265,8 @@ public:
        @param epsilons                particle epsilons
        @param reductions              particle reduction factors
        @param neighborList            neighbor list
+       @param polynomialScratch       work space of the batched polynomial (see poly_2b_v6x_eval_batch),
+                                      resized if needed, so best kept from one call to the next
        @param forces                  add forces to this vector
     
        @return energy
@@ -160,6 +276,32 @@ public:
     RealOpenMM calculateForceAndEnergy( int numParticles, const std::vector<OpenMM::RealVec>& particlePositions, 
                                         const std::vector<std::vector<int> >& allParticleIndices,
                                         const NeighborList& neighborList,
+                                        std::vector<double>& polynomialScratch,
+                                        std::vector<OpenMM::RealVec>& forces ) const;
+
+    /**---------------------------------------------------------------------------------------
+    
+       Calculate TwoBody ixn for the pairs [firstIndex, lastIndex) of the neighbor list;
+       used to split the list between threads
+    
+       @param numParticles            number of particles
+       @param particlePositions       Cartesian coordinates of particles
+       @param allParticleIndices      particle indices of each molecule
+       @param neighborList            neighbor list
+       @param firstIndex              index of the first entry of the neighbor list to compute
+       @param lastIndex               one past the index of the last entry to compute
+       @param polynomialScratch       work space of the batched polynomial, one per thread
+       @param forces                  add forces to this vector
+    
+       @return energy
+    
+       --------------------------------------------------------------------------------------- */
+    
+    RealOpenMM calculateForceAndEnergy( int numParticles, const std::vector<OpenMM::RealVec>& particlePositions, 
+                                        const std::vector<std::vector<int> >& allParticleIndices,
+                                        const NeighborList& neighborList,
+                                        unsigned int firstIndex, unsigned int lastIndex,
+                                        std::vector<double>& polynomialScratch,
                                         std::vector<OpenMM::RealVec>& forces ) const;
          
 private:
@@ -169,6 +311,62 @@ private:
 
     RealVec _periodicBoxDimensions;
 
+    const MBPolReferenceTwoBodyMonomers* _monomers;
+    bool _includeForces;
+
+    struct TwoBodyDimer;
+
+    /**---------------------------------------------------------------------------------------
+
+       Image a dimer and compute the 31 variables of the 2-body polynomial
+
+       @param  siteI                index of the first molecule
+       @param  siteJ                index of the second molecule
+       @param  particlePositions    Cartesian coordinates of particles
+       @param  allParticleIndices   particle indices of each molecule
+       @param  dimer                output state needed by accumulateDimerForces()
+       @param  v                    output polynomial variables
+
+       @return false if the dimer is outside the range of the 2-body potential or the cutoff
+
+       --------------------------------------------------------------------------------------- */
+
+    bool setupDimer( int siteI, int siteJ,
+                     const std::vector<RealVec>& particlePositions,
+                     const std::vector<std::vector<int> >& allParticleIndices,
+                     TwoBodyDimer& dimer, double v[31] ) const;
+
+    /**---------------------------------------------------------------------------------------
+
+       Apply the switch and add the forces of a dimer given the polynomial value and gradients
+
+       @param  dimer                dimer state from setupDimer()
+       @param  E_poly               value of the polynomial
+       @param  g                    gradients of the polynomial w.r.t. its variables
+       @param  allParticleIndices   particle indices of each molecule
+       @param  forces               add forces to this vector
+
+       @return energy for ixn
+
+       --------------------------------------------------------------------------------------- */
+
+    RealOpenMM accumulateDimerForces( const TwoBodyDimer& dimer, double E_poly, const double g[31],
+                                      const std::vector<std::vector<int> >& allParticleIndices,
+                                      std::vector<RealVec>& forces ) const;
+
+    /**---------------------------------------------------------------------------------------
+
+       Apply the switch to the polynomial value of a dimer, without forces
+
+       @param  dimer                dimer state from setupDimer()
+       @param  E_poly               value of the polynomial
+
+       @return energy for ixn
+
+       --------------------------------------------------------------------------------------- */
+
+    RealOpenMM dimerEnergy( const TwoBodyDimer& dimer, double E_poly ) const;
+
     /**---------------------------------------------------------------------------------------
 
        Calculate pair ixn
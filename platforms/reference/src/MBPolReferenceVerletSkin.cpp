@@ -0,0 +1,101 @@
+/* -------------------------------------------------------------------------- *
+ *                               OpenMMMBPol                                 *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2008-2009 Stanford University and the Authors.      *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * This program is free software: you can redistribute it and/or modify       *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * This program is distributed in the hope that it will be useful,            *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ *                                                                            *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.      *
+ * -------------------------------------------------------------------------- */
+
+#include "MBPolReferenceVerletSkin.h"
+#include <algorithm>
+
+MBPolReferenceVerletSkin::MBPolReferenceVerletSkin( ) : _cutoff(0.0), _initialSkin(0.0), _skin(0.0), _listSkin(0.0),
+                                                        _stepsSinceRebuild(0), _numRebuilds(0) {
+}
+
+void MBPolReferenceVerletSkin::initialize( double cutoff, double skin ){
+    _cutoff            = cutoff;
+    _initialSkin       = skin;
+    _skin              = skin;
+    _stepsSinceRebuild = 0;
+    _numRebuilds       = 0;
+    _listPositions.clear();
+}
+
+double MBPolReferenceVerletSkin::getSkin( void ) const {
+    return _skin;
+}
+
+unsigned int MBPolReferenceVerletSkin::getNumRebuilds( void ) const {
+    return _numRebuilds;
+}
+
+double MBPolReferenceVerletSkin::update( const std::vector<RealVec>& oxygenPositions, const RealVec& box, bool usePeriodic ){
+
+    bool rebuild = (_skin <= 0.0 || _listPositions.size() != oxygenPositions.size());
+    if( !rebuild && usePeriodic ){
+        rebuild = (box[0] != _listBox[0] || box[1] != _listBox[1] || box[2] != _listBox[2]);
+    }
+
+    // the list stays valid as long as no oxygen has moved more than half the skin
+    // it was built with; positions are not wrapped, so a jump to another periodic
+    // image simply triggers a rebuild
+
+    if( !rebuild ){
+        const double maxDisplacement2 = 0.25*_listSkin*_listSkin;
+        for( unsigned int ii = 0; ii < oxygenPositions.size(); ii++ ){
+            const RealVec delta = oxygenPositions[ii] - _listPositions[ii];
+            if( delta.dot( delta ) > maxDisplacement2 ){
+                rebuild = true;
+                break;
+            }
+        }
+    }
+
+    if( !rebuild ){
+        _stepsSinceRebuild++;
+        return -1.0;
+    }
+
+    // retune the skin from the lifetime of the list being replaced: a thicker skin
+    // makes the list longer but lets it last more steps
+
+    if( _skin > 0.0 && _numRebuilds > 0 ){
+        if( _stepsSinceRebuild < minimumInterval ){
+            _skin = std::min( 1.25*_skin, 4.0*_initialSkin );
+        } else if( _stepsSinceRebuild > maximumInterval ){
+            _skin = std::max( 0.8*_skin, 0.25*_initialSkin );
+        }
+    }
+
+    _listSkin = _skin;
+    if( usePeriodic ){
+        const double maxListRange = 0.5*std::min( box[0], std::min( box[1], box[2] ) );
+        _listSkin = std::max( 0.0, std::min( _listSkin, maxListRange - _cutoff ) );
+    }
+
+    _listPositions     = oxygenPositions;
+    _listBox           = box;
+    _stepsSinceRebuild = 0;
+    _numRebuilds++;
+
+    return _cutoff + _listSkin;
+}
@@ -0,0 +1,116 @@
+/* -------------------------------------------------------------------------- *
+ *                               OpenMMMBPol                                 *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2008-2009 Stanford University and the Authors.      *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * This program is free software: you can redistribute it and/or modify       *
+ * it under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation, either version 3 of the License, or       *
+ * (at your option) any later version.                                        *
+ *                                                                            *
+ * This program is distributed in the hope that it will be useful,            *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the              *
+ * GNU Lesser General Public License for more details.                        *
+ *                                                                            *
+ * You should have received a copy of the GNU Lesser General Public License   *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.      *
+ * -------------------------------------------------------------------------- */
+
+#ifndef __MBPolReferenceVerletSkin_H__
+#define __MBPolReferenceVerletSkin_H__
+
+#include "openmm/reference/RealVec.h"
+#include <vector>
+
+using OpenMM::RealVec;
+// ---------------------------------------------------------------------------------------
+
+/**
+ * Bookkeeping for the persistent oxygen pair and triplet lists of the 2-body and 3-body
+ * kernels. A list built with cutoff + skin stays valid until some oxygen has moved more
+ * than half the skin since the list was built, or the periodic box has changed.
+ *
+ * The skin is tuned from the number of steps between rebuilds: it grows when the list
+ * is rebuilt more often than every minimumInterval steps and shrinks when it lasts
+ * longer than maximumInterval steps. A skin of zero rebuilds the list on every step.
+ */
+
+class MBPolReferenceVerletSkin {
+
+public:
+
+    MBPolReferenceVerletSkin( void );
+
+    ~MBPolReferenceVerletSkin( ){};
+
+    /**---------------------------------------------------------------------------------------
+
+       Set the cutoff of the interaction and the skin the list starts from; the next call
+       to update() always asks for a rebuild
+
+       @param cutoff        cutoff of the interaction (nm)
+       @param skin          initial skin (nm); zero disables the persistent list
+
+       --------------------------------------------------------------------------------------- */
+
+    void initialize( double cutoff, double skin );
+
+    /**---------------------------------------------------------------------------------------
+
+       Get the current skin (nm)
+
+       --------------------------------------------------------------------------------------- */
+
+    double getSkin( void ) const;
+
+    /**---------------------------------------------------------------------------------------
+
+       Get the number of times the list has been built
+
+       --------------------------------------------------------------------------------------- */
+
+    unsigned int getNumRebuilds( void ) const;
+
+    /**---------------------------------------------------------------------------------------
+
+       Check whether the list has to be rebuilt for this step; if so, retune the skin and
+       record the positions and box the new list is built for
+
+       @param oxygenPositions   positions of the oxygens
+       @param box               periodic box, ignored if usePeriodic is false
+       @param usePeriodic       true if periodic boundary conditions are used
+
+       @return the distance (cutoff + skin) the list has to be built for, or a negative
+               value if the current list is still valid
+
+       --------------------------------------------------------------------------------------- */
+
+    double update( const std::vector<RealVec>& oxygenPositions, const RealVec& box, bool usePeriodic );
+
+private:
+
+    static const unsigned int minimumInterval = 10;
+    static const unsigned int maximumInterval = 50;
+
+    double _cutoff;
+    double _initialSkin;
+    double _skin;
+    double _listSkin;
+    unsigned int _stepsSinceRebuild;
+    unsigned int _numRebuilds;
+    RealVec _listBox;
+    std::vector<RealVec> _listPositions;
+
+};
+
+// ---------------------------------------------------------------------------------------
+
+#endif // __MBPolReferenceVerletSkin_H__
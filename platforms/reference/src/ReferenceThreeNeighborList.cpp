@@ -1,6 +1,6 @@
 #include "ReferenceThreeNeighborList.h"
-#include <set>
-#include <map>
+#include "openmm/internal/ThreadPool.h"
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <cassert>
@@ -33,196 +33,337 @@ static double compPairDistanceSquared(const RealVec& pos1, const RealVec& pos2,
     return dx*dx + dy*dy + dz*dz;
 }
 
-class VoxelIndex
-{
-public:
-    VoxelIndex(int xx, int yy, int zz) : x(xx), y(yy), z(zz) {}
-
-    // operator<() needed for map
-    bool operator<(const VoxelIndex& other) const {
-        if      (x < other.x) return true;
-        else if (x > other.x) return false;
-        else if (y < other.y) return true;
-        else if (y > other.y) return false;
-        else if (z < other.z) return true;
-        else return false;
-    }
+// offset from a cell to one of the cells of its half-shell stencil; if the offset is
+// its own inverse (periodic box only two cells wide) the pair of cells is visited
+// only from the one with the lower index
 
-    int x;
-    int y;
-    int z;
+struct CellOffset
+{
+    int x, y, z;
+    bool selfInverse;
 };
 
-
-typedef std::pair<const RealVec*, AtomIndex> VoxelItem;
-typedef std::vector< VoxelItem > Voxel;
-
-class ThreeVoxelHash
+/**
+ * Dense cell list: the atoms are counting-sorted by cell into one contiguous array,
+ * cellStart[c] .. cellStart[c+1] holding the atoms of cell c.  The cells are at least
+ * maxDistance wide, so the pairs within maxDistance are found by visiting each cell,
+ * itself and the cells of its half-shell stencil; every pair of cells is visited once.
+ */
+class ThreeCellList
 {
 public:
-    ThreeVoxelHash(double vsx, double vsy, double vsz, const RealVec& periodicBoxSize, bool usePeriodic) :
-            voxelSizeX(vsx), voxelSizeY(vsy), voxelSizeZ(vsz), periodicBoxSize(periodicBoxSize), usePeriodic(usePeriodic) {
+    ThreeCellList(int nAtoms, const AtomLocationList& atomLocations, const RealVec& periodicBoxSize, bool usePeriodic, double maxDistance) :
+            atomLocations(atomLocations), periodicBoxSize(periodicBoxSize), usePeriodic(usePeriodic)
+    {
+        assert(maxDistance > 0);
+
         if (usePeriodic) {
-            nx = (int) floor(periodicBoxSize[0]/voxelSizeX+0.5);
-            ny = (int) floor(periodicBoxSize[1]/voxelSizeY+0.5);
-            nz = (int) floor(periodicBoxSize[2]/voxelSizeZ+0.5);
+            for (int d = 0; d < 3; d++) {
+                numCells[d] = max(1, (int) floor(periodicBoxSize[d]/maxDistance));
+                cellSize[d] = periodicBoxSize[d]/numCells[d];
+                origin[d]   = 0.0;
+            }
         }
+        else {
+
+            // cover the bounding box of the atoms; the cells are made coarser if the
+            // grid would have many more cells than atoms
+
+            RealVec lower, upper;
+            if (nAtoms > 0)
+                lower = upper = atomLocations[0];
+            for (int atom = 1; atom < nAtoms; atom++) {
+                for (int d = 0; d < 3; d++) {
+                    lower[d] = min(lower[d], atomLocations[atom][d]);
+                    upper[d] = max(upper[d], atomLocations[atom][d]);
+                }
+            }
+            double size = maxDistance;
+            const double maxCells = 8.0*nAtoms + 8.0;
+            while ((floor((upper[0]-lower[0])/size)+1)*(floor((upper[1]-lower[1])/size)+1)*(floor((upper[2]-lower[2])/size)+1) > maxCells)
+                size *= 2.0;
+            for (int d = 0; d < 3; d++) {
+                numCells[d] = (int) floor((upper[d]-lower[d])/size) + 1;
+                cellSize[d] = size;
+                origin[d]   = lower[d];
+            }
+        }
+        totalCells = numCells[0]*numCells[1]*numCells[2];
+
+        // counting sort of the atoms by cell
+
+        atomCell.resize(nAtoms);
+        cellStart.assign(totalCells+1, 0);
+        for (int atom = 0; atom < nAtoms; atom++) {
+            atomCell[atom] = getCellIndex(atomLocations[atom]);
+            cellStart[atomCell[atom]+1]++;
+        }
+        for (int cell = 0; cell < totalCells; cell++)
+            cellStart[cell+1] += cellStart[cell];
+        cellAtoms.resize(nAtoms);
+        vector<int> next(cellStart.begin(), cellStart.end()-1);
+        for (int atom = 0; atom < nAtoms; atom++)
+            cellAtoms[next[atomCell[atom]]++] = atom;
+
+        buildStencil();
     }
 
-    void insert(const AtomIndex& item, const RealVec& location)
-    {
-        VoxelIndex voxelIndex = getVoxelIndex(location);
-        if ( voxelMap.find(voxelIndex) == voxelMap.end() ) voxelMap[voxelIndex] = Voxel(); 
-        Voxel& voxel = voxelMap.find(voxelIndex)->second;
-        voxel.push_back( VoxelItem(&location, item) );
+    int getNumCells() const {
+        return totalCells;
     }
 
+    /**
+     * Append to pairs all pairs (atomI, atomJ), atomI > atomJ, with a squared distance in
+     * [minDistanceSquared, maxDistanceSquared] and atomI in the cells [firstCell, lastCell).
+     * The atom of a pair found through the stencil may lie in any cell.
+     */
+    void findPairs(int firstCell, int lastCell, double maxDistanceSquared, double minDistanceSquared, vector<AtomPair>& pairs) const
+    {
+        for (int cell = firstCell; cell < lastCell; cell++) {
+            int cx = cell/(numCells[1]*numCells[2]);
+            int cy = (cell/numCells[2])%numCells[1];
+            int cz = cell%numCells[2];
 
-    VoxelIndex getVoxelIndex(const RealVec& location) const {
-        double xperiodic, yperiodic, zperiodic;
-        if (!usePeriodic) {
-            xperiodic = location[0];
-            yperiodic = location[1];
-            zperiodic = location[2];
-        }
-        else {
-            xperiodic = location[0]-periodicBoxSize[0]*floor(location[0]/periodicBoxSize[0]);
-            yperiodic = location[1]-periodicBoxSize[1]*floor(location[1]/periodicBoxSize[1]);
-            zperiodic = location[2]-periodicBoxSize[2]*floor(location[2]/periodicBoxSize[2]);
+            // pairs within the cell
+
+            for (int ii = cellStart[cell]; ii < cellStart[cell+1]; ii++)
+                for (int jj = ii+1; jj < cellStart[cell+1]; jj++)
+                    addPair(cellAtoms[ii], cellAtoms[jj], maxDistanceSquared, minDistanceSquared, pairs);
+
+            // pairs with the cells of the stencil
+
+            for (vector<CellOffset>::const_iterator offset = stencil.begin(); offset != stencil.end(); ++offset) {
+                int nx = cx+offset->x;
+                int ny = cy+offset->y;
+                int nz = cz+offset->z;
+                if (usePeriodic) {
+                    nx %= numCells[0];
+                    ny %= numCells[1];
+                    nz %= numCells[2];
+                }
+                else if (nx < 0 || nx >= numCells[0] || ny < 0 || ny >= numCells[1] || nz < 0 || nz >= numCells[2])
+                    continue;
+                int neighborCell = (nx*numCells[1]+ny)*numCells[2]+nz;
+                if (offset->selfInverse && neighborCell < cell)
+                    continue;
+                for (int ii = cellStart[cell]; ii < cellStart[cell+1]; ii++)
+                    for (int jj = cellStart[neighborCell]; jj < cellStart[neighborCell+1]; jj++)
+                        addPair(cellAtoms[ii], cellAtoms[jj], maxDistanceSquared, minDistanceSquared, pairs);
+            }
         }
-        int x = int(floor(xperiodic / voxelSizeX));
-        int y = int(floor(yperiodic / voxelSizeY));
-        int z = int(floor(zperiodic / voxelSizeZ));
-        
-        return VoxelIndex(x, y, z);
     }
 
-    void getNeighbors(
-            std::vector< std::vector<AtomIndex> > & nearbyAtoms,
-            const VoxelItem& referencePoint, 
-            double maxDistance, 
-            double minDistance) const 
-    {
+private:
 
-        // Loop over neighboring voxels
-        // TODO use more clever selection of neighboring voxels
-        assert(maxDistance > 0);
-        assert(minDistance >= 0);
-        assert(voxelSizeX > 0);
-        assert(voxelSizeY > 0);
-        assert(voxelSizeZ > 0);
-
-        const AtomIndex atomI = referencePoint.second;
-        const RealVec& locationI = *referencePoint.first;
-        
-        double maxDistanceSquared = maxDistance * maxDistance;
-        double minDistanceSquared = minDistance * minDistance;
-
-        int dIndexX = int(maxDistance / voxelSizeX) + 1; // How may voxels away do we have to look?
-        int dIndexY = int(maxDistance / voxelSizeY) + 1;
-        int dIndexZ = int(maxDistance / voxelSizeZ) + 1;
-        VoxelIndex centerVoxelIndex = getVoxelIndex(locationI);
-        int lastx = centerVoxelIndex.x+dIndexX;
-        int lasty = centerVoxelIndex.y+dIndexY;
-        int lastz = centerVoxelIndex.z+dIndexZ;
-        if (usePeriodic) {
-            lastx = min(lastx, centerVoxelIndex.x-dIndexX+nx-1);
-            lasty = min(lasty, centerVoxelIndex.y-dIndexY+ny-1);
-            lastz = min(lastz, centerVoxelIndex.z-dIndexZ+nz-1);
+    int getCellIndex(const RealVec& location) const {
+        int index[3];
+        for (int d = 0; d < 3; d++) {
+            double position = location[d]-origin[d];
+            if (usePeriodic)
+                position -= periodicBoxSize[d]*floor(position/periodicBoxSize[d]);
+            index[d] = min(max((int) floor(position/cellSize[d]), 0), numCells[d]-1);
         }
+        return (index[0]*numCells[1]+index[1])*numCells[2]+index[2];
+    }
 
+    // the stencil holds one of each pair of opposite offsets to the 26 adjacent cells; in a
+    // periodic box fewer than three cells wide, offsets that lead to the same cell are merged
 
-        // Loop through nearby Voxels and create vectors of nearby Atoms and their locations
-        for (int x = centerVoxelIndex.x - dIndexX; x <= lastx; ++x)
-        {
-            for (int y = centerVoxelIndex.y - dIndexY; y <= lasty; ++y)
-            {
-                for (int z = centerVoxelIndex.z - dIndexZ; z <= lastz; ++z)
-                {
-                    VoxelIndex voxelIndex(x, y, z);
+    void buildStencil() {
+        stencil.clear();
+        for (int dx = -1; dx <= 1; dx++)
+            for (int dy = -1; dy <= 1; dy++)
+                for (int dz = -1; dz <= 1; dz++) {
+                    CellOffset offset = {dx, dy, dz, false};
+                    CellOffset inverse = {-dx, -dy, -dz, false};
                     if (usePeriodic) {
-                        voxelIndex.x = (x+nx)%nx;
-                        voxelIndex.y = (y+ny)%ny;
-                        voxelIndex.z = (z+nz)%nz;
+                        canonical(offset);
+                        canonical(inverse);
                     }
-                    if (voxelMap.find(voxelIndex) == voxelMap.end()) continue; // no such voxel; skip
-                    const Voxel& voxel = voxelMap.find(voxelIndex)->second;
-                    for (Voxel::const_iterator itemIter = voxel.begin(); itemIter != voxel.end(); ++itemIter)
-                    {
-                        const AtomIndex atomJ = itemIter->second;
-                        const RealVec& locationJ = *itemIter->first;
-                        
-                        // Ignore self hits
-                        if (atomI == atomJ) continue;
-                        
-                        double dSquared = compPairDistanceSquared(locationI, locationJ, periodicBoxSize, usePeriodic);
-                        if (dSquared > maxDistanceSquared) continue;
-                        if (dSquared < minDistanceSquared) continue;
-
-                        nearbyAtoms[atomI].push_back( atomJ );
-                    } // for atom indices
-                }  // for z
-            }  // for y
-        } // for x
+                    if (offset.x == 0 && offset.y == 0 && offset.z == 0)
+                        continue;
+                    bool known = false;
+                    for (unsigned int ii = 0; ii < stencil.size() && !known; ii++)
+                        known = sameOffset(stencil[ii], offset) || sameOffset(stencil[ii], inverse);
+                    if (known)
+                        continue;
+                    offset.selfInverse = sameOffset(offset, inverse);
+                    stencil.push_back(offset);
+                }
+    }
 
+    void canonical(CellOffset& offset) const {
+        offset.x = (offset.x+numCells[0])%numCells[0];
+        offset.y = (offset.y+numCells[1])%numCells[1];
+        offset.z = (offset.z+numCells[2])%numCells[2];
+    }
 
+    static bool sameOffset(const CellOffset& a, const CellOffset& b) {
+        return a.x == b.x && a.y == b.y && a.z == b.z;
     }
 
-private:
-    double voxelSizeX, voxelSizeY, voxelSizeZ;
-    int nx, ny, nz;
+    void addPair(AtomIndex atomI, AtomIndex atomJ, double maxDistanceSquared, double minDistanceSquared, vector<AtomPair>& pairs) const {
+        double dSquared = compPairDistanceSquared(atomLocations[atomI], atomLocations[atomJ], periodicBoxSize, usePeriodic);
+        if (dSquared > maxDistanceSquared) return;
+        if (dSquared < minDistanceSquared) return;
+        pairs.push_back(atomI > atomJ ? AtomPair(atomI, atomJ) : AtomPair(atomJ, atomI));
+    }
+
+    const AtomLocationList& atomLocations;
     const RealVec& periodicBoxSize;
     const bool usePeriodic;
-    std::map<VoxelIndex, Voxel> voxelMap;
+    int numCells[3];
+    double cellSize[3];
+    double origin[3];
+    int totalCells;
+    vector<int> atomCell;
+    vector<int> cellStart;
+    vector<AtomIndex> cellAtoms;
+    vector<CellOffset> stencil;
+};
+
+/**
+ * Finds the pairs within range, the cells split in contiguous ranges between the threads of a pool.
+ */
+class ThreePairTask : public OpenMM::ThreadPool::Task {
+public:
+    ThreePairTask(const ThreeCellList& cells, double maxDistanceSquared, double minDistanceSquared, vector<vector<AtomPair> >& threadPairs) :
+            cells(cells), maxDistanceSquared(maxDistanceSquared), minDistanceSquared(minDistanceSquared), threadPairs(threadPairs) {
+    }
+    void execute(OpenMM::ThreadPool& threads, int threadIndex) {
+        findPairs(threadIndex, threads.getNumThreads());
+    }
+    void findPairs(int threadIndex, int numThreads) {
+        vector<AtomPair>& pairs = threadPairs[threadIndex];
+        pairs.clear();
+        cells.findPairs(cells.getNumCells()*threadIndex/numThreads, cells.getNumCells()*(threadIndex+1)/numThreads,
+                        maxDistanceSquared, minDistanceSquared, pairs);
+    }
+    const ThreeCellList& cells;
+    const double maxDistanceSquared;
+    const double minDistanceSquared;
+    vector<vector<AtomPair> >& threadPairs;
 };
 
+void ThreeNeighborPairList::build(int nAtoms,
+                                  const AtomLocationList& atomLocations,
+                                  const RealVec& periodicBoxSize,
+                                  bool usePeriodic,
+                                  double maxDistance,
+                                  double minDistance,
+                                  OpenMM::ThreadPool* threads)
+{
+    assert(minDistance >= 0);
+
+    ThreeCellList cells(nAtoms, atomLocations, periodicBoxSize, usePeriodic, maxDistance);
+
+    // 1) pairs within range
+
+    int numThreads = (threads == NULL ? 1 : threads->getNumThreads());
+    vector<vector<AtomPair> > threadPairs(numThreads);
+    ThreePairTask task(cells, maxDistance*maxDistance, minDistance*minDistance, threadPairs);
+    if (numThreads > 1) {
+        threads->execute(task);
+        threads->waitForThreads();
+    }
+    else
+        task.findPairs(0, 1);
+
+    // 2) store each pair for both of its atoms; the neighbors of each atom are sorted
+    //    so that the list does not depend on the cell layout or the number of threads
+
+    neighborStart.assign(nAtoms+1, 0);
+    for (int thread = 0; thread < numThreads; thread++)
+        for (vector<AtomPair>::const_iterator pair = threadPairs[thread].begin(); pair != threadPairs[thread].end(); ++pair) {
+            neighborStart[pair->first+1]++;
+            neighborStart[pair->second+1]++;
+        }
+    for (int atom = 0; atom < nAtoms; atom++)
+        neighborStart[atom+1] += neighborStart[atom];
+    neighbors.resize(neighborStart[nAtoms]);
+    vector<int> next(neighborStart.begin(), neighborStart.end()-1);
+    for (int thread = 0; thread < numThreads; thread++)
+        for (vector<AtomPair>::const_iterator pair = threadPairs[thread].begin(); pair != threadPairs[thread].end(); ++pair) {
+            neighbors[next[pair->first]++]  = pair->second;
+            neighbors[next[pair->second]++] = pair->first;
+        }
+    for (int atom = 0; atom < nAtoms; atom++)
+        sort(neighbors.begin()+neighborStart[atom], neighbors.begin()+neighborStart[atom+1]);
+}
+
+ThreeNeighborTripletGenerator::ThreeNeighborTripletGenerator(const ThreeNeighborPairList& pairList,
+                                                             const AtomLocationList& atomLocations,
+                                                             const RealVec& periodicBoxSize,
+                                                             bool usePeriodic,
+                                                             double maxDistance,
+                                                             double minDistance,
+                                                             int firstAtom,
+                                                             int lastAtom) :
+        pairList(pairList), atomLocations(atomLocations), periodicBoxSize(periodicBoxSize), usePeriodic(usePeriodic),
+        maxDistanceSquared(maxDistance*maxDistance), minDistanceSquared(minDistance*minDistance),
+        lastAtom(min(lastAtom, pairList.getNumAtoms())), atom(firstAtom-1), ii(0), kk(0)
+{
+}
+
+bool ThreeNeighborTripletGenerator::inRange(AtomIndex atomI, AtomIndex atomJ) const
+{
+    double dSquared = compPairDistanceSquared(atomLocations[atomI], atomLocations[atomJ], periodicBoxSize, usePeriodic);
+    return (dSquared <= maxDistanceSquared && dSquared >= minDistanceSquared);
+}
+
+bool ThreeNeighborTripletGenerator::next(ThreeNeighborList& block, unsigned int blockSize)
+{
+    // a triplet with two pairs within range is given from the atom shared by the two
+    // pairs; if all three pairs are within range, only from the lowest indexed atom
+
+    block.clear();
+    while (block.size() < blockSize) {
+        if (ii+1 >= atomNeighbors.size()) {
+            if (++atom >= lastAtom) {
+                atom = lastAtom;
+                return !block.empty();
+            }
+            atomNeighbors.clear();
+            for (int jj = pairList.neighborStart[atom]; jj < pairList.neighborStart[atom+1]; jj++)
+                if (inRange(atom, pairList.neighbors[jj]))
+                    atomNeighbors.push_back(pairList.neighbors[jj]);
+            ii = 0;
+            kk = 1;
+            continue;
+        }
+        AtomIndex atomJ = atomNeighbors[ii];
+        AtomIndex atomK = atomNeighbors[kk];
+        if ((AtomIndex) atom < atomJ || !inRange(atomJ, atomK)) {
+            AtomTriplet triplet = {(AtomIndex) atom, atomJ, atomK};
+            block.push_back(triplet);
+        }
+        if (++kk >= atomNeighbors.size()) {
+            ii++;
+            kk = ii+1;
+        }
+    }
+    return true;
+}
 
-// O(n) neighbor list method using voxel hash data structure
 void OPENMM_EXPORT computeThreeNeighborListVoxelHash(
                               ThreeNeighborList& neighborList,
                               int nAtoms,
-                              const AtomLocationList& atomLocations, 
+                              const AtomLocationList& atomLocations,
                               const RealVec& periodicBoxSize,
                               bool usePeriodic,
                               double maxDistance,
-                              double minDistance                             )
+                              double minDistance,
+                              OpenMM::ThreadPool* threads )
 {
     neighborList.clear();
-    std::vector< std::vector<AtomIndex> > nearbyAtoms (nAtoms);
 
-    double edgeSizeX, edgeSizeY, edgeSizeZ;
-    if (!usePeriodic)
-        edgeSizeX = edgeSizeY = edgeSizeZ = maxDistance; // TODO - adjust this as needed
-    else {
-        edgeSizeX = periodicBoxSize[0]/floor(periodicBoxSize[0]/maxDistance);
-        edgeSizeY = periodicBoxSize[1]/floor(periodicBoxSize[1]/maxDistance);
-        edgeSizeZ = periodicBoxSize[2]/floor(periodicBoxSize[2]/maxDistance);
-    }
-    ThreeVoxelHash voxelHash(edgeSizeX, edgeSizeY, edgeSizeZ, periodicBoxSize, usePeriodic);
-    for (AtomIndex atomJ = 0; atomJ < (AtomIndex) nAtoms; ++atomJ) // use "j", because j > i for pairs
-    {
-        // 1) Find other atoms that are close to this one
-        const RealVec& location = atomLocations[atomJ];
-        voxelHash.getNeighbors( 
-            nearbyAtoms,
-            VoxelItem(&location, atomJ),
-            maxDistance, 
-            minDistance);
-            
-        // 2) Add this atom to the voxelHash
-        voxelHash.insert(atomJ, location);
-    }
-    for (AtomIndex atomI = 0; atomI < (AtomIndex) nAtoms; ++atomI)
-    {
-        for (std::vector<AtomIndex>::iterator atomJ_itr = nearbyAtoms[atomI].begin(); atomJ_itr != nearbyAtoms[atomI].end(); ++atomJ_itr)
-        {
-                for (std::vector<AtomIndex>::iterator atomK_itr = nearbyAtoms[*atomJ_itr].begin(); atomK_itr != nearbyAtoms[*atomJ_itr].end(); ++atomK_itr)
-                {
-                    AtomTriplet triplet = {atomI, *atomJ_itr, *atomK_itr};
-                    neighborList.push_back(triplet);
-                }
-        }
-    }
+    ThreeNeighborPairList pairList;
+    pairList.build(nAtoms, atomLocations, periodicBoxSize, usePeriodic, maxDistance, minDistance, threads);
+
+    ThreeNeighborTripletGenerator triplets(pairList, atomLocations, periodicBoxSize, usePeriodic, maxDistance, minDistance, 0, nAtoms);
+    ThreeNeighborList block;
+    while (triplets.next(block, 4096))
+        neighborList.insert(neighborList.end(), block.begin(), block.end());
 }
 
 } // namespace MBPolPlugin
@@ -0,0 +1,36 @@
+#include "mbpol_simd.h"
+
+namespace mbpol_simd {
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+
+// __builtin_cpu_supports also checks (via xgetbv) that the OS saves the
+// extended registers, so a true result means the lanes can be used
+
+bool cpu_has_avx2()
+{
+    static const bool has_avx2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    return has_avx2;
+}
+
+bool cpu_has_avx512()
+{
+    static const bool has_avx512 = __builtin_cpu_supports("avx512f");
+    return has_avx512;
+}
+
+#else
+
+bool cpu_has_avx2()
+{
+    return false;
+}
+
+bool cpu_has_avx512()
+{
+    return false;
+}
+
+#endif
+
+} // namespace mbpol_simd
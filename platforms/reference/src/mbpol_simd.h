@@ -0,0 +1,93 @@
+#ifndef MBPOL_SIMD_H
+#define MBPOL_SIMD_H
+
+//
+// lane types used to evaluate the generated polynomials for several dimers
+// or trimers at once; each type only provides the operations that appear in
+// the generated code (+, - and *, with scalars broadcast to all lanes)
+//
+// the lane types are only available in translation units compiled with the
+// corresponding instruction set enabled (-mavx2 -mfma, -mavx512f); which of
+// those is used is decided at run time with the functions below
+//
+
+#include <cstddef>
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+namespace mbpol_simd {
+
+// stands for the gradient array of a generated polynomial when only its value
+// is needed: the gradients are dropped as they are assigned, so the compiler
+// removes the terms that only contribute to them
+
+struct no_gradients {
+    struct dropped {
+        template <typename real>
+        void operator=(const real&) const {}
+    };
+    dropped operator[](unsigned) const { return dropped(); }
+};
+
+// run time detection of the instruction sets supported by the CPU and the OS
+
+bool cpu_has_avx2();
+bool cpu_has_avx512();
+
+// the work space of a generated polynomial from the first element of scratch
+// that is aligned for the lane type; scratch has room for one value of the
+// widest lane type more than is used from it
+
+template <typename lanes>
+lanes* aligned_lanes(double* scratch)
+{
+    const std::size_t alignment = sizeof(lanes);
+    const std::size_t address = reinterpret_cast<std::size_t>(scratch);
+    return reinterpret_cast<lanes*>((address + alignment - 1) & ~(alignment - 1));
+}
+
+#if defined(__AVX2__)
+struct lanes4 {
+    static const unsigned width = 4;
+
+    __m256d v;
+
+    lanes4() {}
+    lanes4(double s) : v(_mm256_set1_pd(s)) {}
+    lanes4(__m256d s) : v(s) {}
+
+    static lanes4 load(const double* p) { return _mm256_loadu_pd(p); }
+    void store(double* p) const { _mm256_storeu_pd(p, v); }
+
+    friend lanes4 operator+(const lanes4& x, const lanes4& y) { return _mm256_add_pd(x.v, y.v); }
+    friend lanes4 operator-(const lanes4& x, const lanes4& y) { return _mm256_sub_pd(x.v, y.v); }
+    friend lanes4 operator*(const lanes4& x, const lanes4& y) { return _mm256_mul_pd(x.v, y.v); }
+    friend lanes4 operator-(const lanes4& x) { return _mm256_xor_pd(x.v, _mm256_set1_pd(-0.0)); }
+};
+#endif // __AVX2__
+
+#if defined(__AVX512F__)
+struct lanes8 {
+    static const unsigned width = 8;
+
+    __m512d v;
+
+    lanes8() {}
+    lanes8(double s) : v(_mm512_set1_pd(s)) {}
+    lanes8(__m512d s) : v(s) {}
+
+    static lanes8 load(const double* p) { return _mm512_loadu_pd(p); }
+    void store(double* p) const { _mm512_storeu_pd(p, v); }
+
+    friend lanes8 operator+(const lanes8& x, const lanes8& y) { return _mm512_add_pd(x.v, y.v); }
+    friend lanes8 operator-(const lanes8& x, const lanes8& y) { return _mm512_sub_pd(x.v, y.v); }
+    friend lanes8 operator*(const lanes8& x, const lanes8& y) { return _mm512_mul_pd(x.v, y.v); }
+    friend lanes8 operator-(const lanes8& x) { return _mm512_sub_pd(_mm512_set1_pd(-0.0), x.v); }
+};
+#endif // __AVX512F__
+
+} // namespace mbpol_simd
+
+#endif // MBPOL_SIMD_H
@@ -0,0 +1,27 @@
+//
+// poly_2b_v6x_eval_batch with AVX2 lanes, compiled with -mavx2 -mfma
+//
+
+#include "poly-2b-v6x-impl.h"
+#include "mbpol_simd.h"
+
+#if defined(__AVX2__)
+
+void poly_2b_v6x_eval_avx2(const double a[1153],
+                           const double x[31][poly_2b_v6x_batch],
+                                 double g[31][poly_2b_v6x_batch],
+                                 double e[poly_2b_v6x_batch],
+                                 double scratch[poly_2b_v6x_scratch_size])
+{
+    poly_2b_v6x_eval_lanes<mbpol_simd::lanes4>(a, x, g, e, scratch);
+}
+
+void poly_2b_v6x_eval_avx2(const double a[1153],
+                           const double x[31][poly_2b_v6x_batch],
+                                 double e[poly_2b_v6x_batch],
+                                 double scratch[poly_2b_v6x_scratch_size])
+{
+    poly_2b_v6x_eval_lanes<mbpol_simd::lanes4>(a, x, e, scratch);
+}
+
+#endif // __AVX2__
@@ -0,0 +1,13918 @@
+#ifndef POLY_2B_V6X_IMPL_H
+#define POLY_2B_V6X_IMPL_H
+
+#include "poly-2b-v6x.h"
+#include "mbpol_simd.h"
+
+//
+// body of poly_2b_v6x_eval, templated on the number type so that the same
+// generated code is used for the scalar evaluation (real = double) and for
+// the batched evaluation over SIMD lanes (see mbpol_simd.h); with
+// gradients = mbpol_simd::no_gradients only the value is computed;
+// df is the work space for the derivatives of the intermediate terms
+//
+
+template <typename real, typename gradients>
+real poly_2b_v6x_eval_t(const double a[1153],
+                        const real x[31],
+                              gradients g,
+                              real df[4138])
+{
+    const real t1 = a[3];
+    const real t2 = a[57];
+    const real t3 = a[474];
+    const real t5 = x[30];
+    const real t4 = t3*t5;
+    const real t6 = (t2+t4)*t5;
+    const real t7 = a[465];
+    const real t8 = t7*t5;
+    const real t20 = x[29];
+    const real t9 = t3*t20;
+    const real t12 = a[48];
+    const real t13 = a[454];
+    const real t14 = t13*t20;
+    const real t15 = a[226];
+    const real t16 = t15*t5;
+    const real t17 = a[314];
+    const real t26 = x[28];
+    const real t18 = t17*t26;
+    const real t21 = a[236];
+    const real t23 = t13*t5;
+    const real t24 = t15*t20;
+    const real t37 = x[27];
+    const real t25 = t17*t37;
+    const real t28 = a[466];
+    const real t29 = t28*t5;
+    const real t30 = a[66];
+    const real t31 = t28*t20;
+    const real t32 = t28*t26;
+    const real t33 = t28*t37;
+    const real t34 = a[487];
+    const real t50 = x[26];
+    const real t35 = t34*t50;
+    const real t38 = a[449];
+    const real t39 = t38*t5;
+    const real t40 = a[34];
+    const real t41 = t38*t20;
+    const real t42 = a[311];
+    const real t43 = t42*t26;
+    const real t44 = t42*t37;
+    const real t45 = a[117];
+    const real t51 = a[36];
+    const real t52 = a[210];
+    const real t53 = t52*t5;
+    const real t54 = a[201];
+    const real t55 = t54*t20;
+    const real t56 = t52*t26;
+    const real t57 = t54*t37;
+    const real t58 = a[250];
+    const real t59 = t58*t50;
+    const real t67 = x[25];
+    const real t60 = t58*t67;
+    const real t61 = a[333];
+    const real t72 = x[24];
+    const real t62 = t61*t72;
+    const real t63 = a[189];
+    const real t73 = x[23];
+    const real t64 = t63*t73;
+    const real t65 = a[203];
+    const real t77 = x[22];
+    const real t10 = t65*t77;
+    const real t68 = (t51+t53+t55+t56+t57+t59+t60+t62+t64+t10)*t77;
+    const real t69 = a[5];
+    const real t70 = a[17];
+    const real t71 = a[105];
+    const real t19 = t71*t5;
+    const real t74 = (t70+t19)*t5;
+    const real t75 = a[458];
+    const real t76 = t75*t5;
+    const real t22 = t71*t20;
+    const real t79 = (t70+t76+t22)*t20;
+    const real t80 = a[367];
+    const real t27 = t80*t20;
+    const real t36 = t71*t26;
+    const real t84 = (t27+t70+t76+t36)*t26;
+    const real t85 = t52*t20;
+    const real t86 = t54*t26;
+    const real t87 = t61*t50;
+    const real t88 = t63*t67;
+    const real t89 = t58*t72;
+    const real t90 = t58*t73;
+    const real t91 = a[119];
+    const real t92 = t91*t77;
+    const real t93 = a[361];
+    const real t126 = x[21];
+    const real t94 = t93*t126;
+    const real t132 = x[20];
+    const real t95 = t91*t132;
+    const real t136 = x[19];
+    const real t96 = t93*t136;
+    const real t139 = x[18];
+    const real t97 = t65*t139;
+    const real t98 = t51+t53+t85+t86+t57+t87+t88+t89+t90+t92+t94+t95+t96+t97;
+    const real t46 = t80*t5;
+    const real t47 = t75*t20;
+    const real t48 = t75*t26;
+    const real t49 = t71*t37;
+    const real t105 = (t70+t46+t47+t48+t49)*t37;
+    const real t106 = a[327];
+    const real t107 = t106*t5;
+    const real t108 = t106*t20;
+    const real t109 = a[44];
+    const real t110 = t106*t26;
+    const real t111 = t106*t37;
+    const real t112 = a[197];
+    const real t113 = t112*t50;
+    const real t114 = t112*t67;
+    const real t115 = a[304];
+    const real t116 = t115*t72;
+    const real t117 = t115*t73;
+    const real t118 = a[402];
+    const real t143 = x[9];
+    const real t119 = t118*t143;
+    const real t120 = a[219];
+    const real t121 = t120*t139;
+    const real t145 = x[17];
+    const real t122 = t120*t145;
+    const real t123 = t107+t108+t109+t110+t111+t113+t114+t116+t117+t119+t121+t122;
+    const real t146 = x[16];
+    const real t124 = t120*t146;
+    const real t155 = x[15];
+    const real t125 = t120*t155;
+    const real t66 = a[479];
+    const real t179 = x[14];
+    const real t127 = t66*t179;
+    const real t128 = a[310];
+    const real t212 = x[11];
+    const real t129 = t128*t212;
+    const real t215 = x[10];
+    const real t130 = t128*t215;
+    const real t131 = a[192];
+    const real t133 = a[401];
+    const real t135 = a[244];
+    const real t137 = a[506];
+    const real t141 = a[494];
+    const real t240 = x[7];
+    const real t142 = t141*t240;
+    const real t254 = x[12];
+    const real t275 = x[13];
+    const real t309 = x[8];
+    const real t144 = t124+t125+t127+t129+t130+t131*t126+t133*t254+t135*t275+t137*t132+
+t131*t136+t118*t309+t142+t137*t77;
+    const real t147 = a[135];
+    const real t148 = t147*t5;
+    const real t149 = a[28];
+    const real t150 = t147*t20;
+    const real t151 = a[187];
+    const real t152 = t151*t26;
+    const real t153 = t151*t37;
+    const real t154 = a[359];
+    const real t83 = t154*t50;
+    const real t157 = (t148+t149+t150+t152+t153+t83)*t50;
+    const real t158 = a[500];
+    const real t159 = t158*t5;
+    const real t160 = a[29];
+    const real t161 = t158*t20;
+    const real t162 = t158*t26;
+    const real t163 = t158*t37;
+    const real t164 = a[364];
+    const real t165 = t164*t50;
+    const real t166 = t164*t67;
+    const real t167 = t164*t72;
+    const real t168 = t164*t73;
+    const real t169 = a[188];
+    const real t170 = t169*t77;
+    const real t171 = t169*t126;
+    const real t172 = t159+t160+t161+t162+t163+t165+t166+t167+t168+t170+t171;
+    const real t173 = t169*t132;
+    const real t174 = t169*t136;
+    const real t175 = t169*t139;
+    const real t176 = t169*t145;
+    const real t177 = t169*t146;
+    const real t178 = t169*t155;
+    const real t100 = a[145];
+    const real t180 = t100*t179;
+    const real t181 = a[281];
+    const real t182 = t181*t275;
+    const real t183 = t181*t254;
+    const real t184 = t181*t212;
+    const real t185 = t181*t215;
+    const real t186 = a[451];
+    const real t187 = t186*t143;
+    const real t188 = t173+t174+t175+t176+t177+t178+t180+t182+t183+t184+t185+t187;
+    const real t191 = a[46];
+    const real t192 = a[344];
+    const real t193 = t192*t5;
+    const real t194 = t192*t20;
+    const real t195 = t192*t26;
+    const real t196 = t192*t37;
+    const real t197 = a[379];
+    const real t198 = t197*t50;
+    const real t199 = t197*t67;
+    const real t200 = t197*t72;
+    const real t201 = t197*t73;
+    const real t202 = a[271];
+    const real t203 = t202*t77;
+    const real t204 = a[217];
+    const real t205 = t204*t126;
+    const real t206 = t202*t132;
+    const real t207 = t204*t136;
+    const real t208 = t202*t139;
+    const real t209 = t204*t145;
+    const real t210 = t202*t146;
+    const real t211 = t204*t155;
+    const real t101 = a[470];
+    const real t213 = t101*t179;
+    const real t214 = t191+t193+t194+t195+t196+t198+t199+t200+t201+t203+t205+t206+t207+
+t208+t209+t210+t211+t213;
+    const real t216 = a[75];
+    const real t217 = t216*t5;
+    const real t218 = a[22];
+    const real t219 = t216*t20;
+    const real t220 = t216*t26;
+    const real t221 = t216*t37;
+    const real t222 = a[366];
+    const real t223 = t222*t50;
+    const real t224 = t222*t67;
+    const real t225 = a[232];
+    const real t226 = t225*t72;
+    const real t227 = t225*t73;
+    const real t228 = a[386];
+    const real t229 = t228*t77;
+    const real t230 = a[302];
+    const real t231 = t230*t126;
+    const real t232 = t228*t132;
+    const real t233 = t230*t136;
+    const real t234 = a[412];
+    const real t235 = t234*t139;
+    const real t236 = a[376];
+    const real t237 = t236*t145;
+    const real t238 = t234*t146;
+    const real t239 = t236*t155;
+    const real t102 = a[237];
+    const real t241 = t102*t179;
+    const real t242 = a[215];
+    const real t243 = t242*t275;
+    const real t244 = a[371];
+    const real t245 = t244*t254;
+    const real t246 = t217+t218+t219+t220+t221+t223+t224+t226+t227+t229+t231+t232+t233+
+t235+t237+t238+t239+t241+t243+t245;
+    const real t248 = t151*t5;
+    const real t249 = t151*t20;
+    const real t250 = t147*t26;
+    const real t251 = t147*t37;
+    const real t252 = a[378];
+    const real t103 = t252*t50;
+    const real t104 = t154*t67;
+    const real t256 = (t149+t248+t249+t250+t251+t103+t104)*t67;
+    const real t134 = t123+t144;
+    const real t138 = t172+t188;
+    const real t257 = t68+t69+t74+t79+t84+t98*t139+t105+t134*t240+t157+t138*t143+t214*t179
++t246*t254+t256;
+    const real t258 = a[108];
+    const real t259 = t258*t5;
+    const real t260 = a[162];
+    const real t261 = t260*t20;
+    const real t262 = a[7];
+    const real t263 = t258*t26;
+    const real t264 = t260*t37;
+    const real t265 = a[303];
+    const real t266 = t265*t50;
+    const real t267 = t265*t67;
+    const real t268 = a[154];
+    const real t269 = t268*t72;
+    const real t270 = a[358];
+    const real t271 = t270*t73;
+    const real t272 = a[206];
+    const real t273 = t272*t77;
+    const real t274 = a[122];
+    const real t276 = t259+t261+t262+t263+t264+t266+t267+t269+t271+t273+t274*t126;
+    const real t277 = t276*t126;
+    const real t278 = t54*t5;
+    const real t279 = t52*t37;
+    const real t280 = t63*t72;
+    const real t281 = t61*t73;
+    const real t282 = a[340];
+    const real t284 = a[290];
+    const real t285 = t284*t126;
+    const real t287 = t51+t85+t278+t86+t279+t59+t60+t280+t281+t282*t77+t285+t65*t132;
+    const real t288 = t287*t132;
+    const real t289 = a[275];
+    const real t290 = t289*t50;
+    const real t291 = t289*t67;
+    const real t156 = t154*t72;
+    const real t294 = (t148+t249+t149+t250+t153+t290+t291+t156)*t72;
+    const real t295 = t258*t20;
+    const real t296 = t260*t26;
+    const real t297 = t268*t50;
+    const real t298 = t270*t67;
+    const real t299 = t265*t72;
+    const real t300 = t265*t73;
+    const real t301 = t93*t77;
+    const real t302 = a[78];
+    const real t303 = t302*t126;
+    const real t304 = t93*t132;
+    const real t305 = t302*t136;
+    const real t306 = t272*t139;
+    const real t307 = t274*t145;
+    const real t308 = t259+t262+t295+t296+t264+t297+t298+t299+t300+t301+t303+t304+t305+
+t306+t307;
+    const real t189 = t252*t72;
+    const real t190 = t154*t73;
+    const real t313 = (t150+t248+t149+t152+t251+t290+t291+t189+t190)*t73;
+    const real t314 = t260*t5;
+    const real t315 = t258*t37;
+    const real t316 = t270*t72;
+    const real t317 = t268*t73;
+    const real t318 = t284*t77;
+    const real t319 = a[174];
+    const real t321 = t272*t132;
+    const real t323 = t262+t295+t314+t296+t315+t266+t267+t316+t317+t318+t319*t126+t321+
+t274*t136;
+    const real t324 = t323*t136;
+    const real t325 = a[288];
+    const real t327 = a[418];
+    const real t328 = t327*t275;
+    const real t329 = a[328];
+    const real t330 = t329*t5;
+    const real t331 = t329*t20;
+    const real t332 = t329*t26;
+    const real t333 = t141*t309;
+    const real t334 = a[20];
+    const real t335 = t329*t37;
+    const real t336 = a[345];
+    const real t337 = t336*t50;
+    const real t338 = t336*t67;
+    const real t339 = t336*t72;
+    const real t340 = t336*t73;
+    const real t341 = a[82];
+    const real t342 = t341*t139;
+    const real t475 = x[6];
+    const real t343 = t325*t475+t328+t330+t331+t332+t333+t334+t335+t337+t338+t339+t340+
+t342;
+    const real t344 = a[185];
+    const real t345 = t344*t145;
+    const real t346 = t341*t146;
+    const real t347 = t344*t155;
+    const real t253 = a[468];
+    const real t349 = t253*t179;
+    const real t350 = t327*t212;
+    const real t351 = a[353];
+    const real t352 = t351*t215;
+    const real t353 = t344*t126;
+    const real t354 = t341*t77;
+    const real t355 = t341*t132;
+    const real t356 = t344*t136;
+    const real t357 = t351*t254;
+    const real t358 = t345+t346+t347+t349+t350+t352+t353+t354+t355+t356+t357+t142+t187;
+    const real t361 = t115*t50;
+    const real t362 = t115*t67;
+    const real t363 = t112*t72;
+    const real t364 = t112*t73;
+    const real t365 = t120*t77;
+    const real t366 = t120*t126;
+    const real t367 = t120*t132;
+    const real t368 = t109+t107+t108+t110+t111+t361+t362+t363+t364+t365+t366+t367;
+    const real t369 = t120*t136;
+    const real t374 = t128*t275;
+    const real t375 = t128*t254;
+    const real t378 = t369+t137*t139+t131*t145+t137*t146+t131*t155+t127+t374+t375+t135*
+t212+t133*t215+t119+t333;
+    const real t381 = t225*t50;
+    const real t382 = t225*t67;
+    const real t383 = t222*t72;
+    const real t384 = t222*t73;
+    const real t385 = t234*t77;
+    const real t386 = t236*t126;
+    const real t387 = t217+t218+t219+t220+t221+t381+t382+t383+t384+t385+t386;
+    const real t388 = t234*t132;
+    const real t389 = t236*t136;
+    const real t390 = t228*t139;
+    const real t391 = t230*t145;
+    const real t392 = t228*t146;
+    const real t393 = t230*t155;
+    const real t394 = a[153];
+    const real t395 = t394*t275;
+    const real t396 = a[551];
+    const real t397 = t396*t254;
+    const real t398 = t242*t212;
+    const real t399 = t244*t215;
+    const real t400 = t388+t389+t390+t391+t392+t393+t241+t395+t397+t398+t399;
+    const real t403 = t63*t50;
+    const real t404 = t61*t67;
+    const real t405 = t282*t139;
+    const real t406 = t284*t145;
+    const real t407 = t65*t146;
+    const real t408 = t51+t278+t55+t56+t279+t403+t404+t89+t90+t92+t94+t95+t96+t405+t406+
+t407;
+    const real t410 = a[26];
+    const real t411 = a[133];
+    const real t412 = t411*t5;
+    const real t413 = t411*t20;
+    const real t414 = t411*t26;
+    const real t415 = t411*t37;
+    const real t416 = a[124];
+    const real t417 = t416*t50;
+    const real t418 = t416*t67;
+    const real t419 = a[190];
+    const real t420 = t419*t72;
+    const real t421 = t419*t73;
+    const real t422 = a[422];
+    const real t423 = t422*t77;
+    const real t425 = a[260];
+    const real t426 = t425*t126;
+    const real t427 = t422*t132;
+    const real t428 = t425*t136;
+    const real t429 = a[155];
+    const real t430 = t429*t139;
+    const real t431 = a[301];
+    const real t432 = t431*t145;
+    const real t433 = t429*t146;
+    const real t434 = t431*t155;
+    const real t293 = a[480];
+    const real t436 = t293*t179;
+    const real t437 = a[533];
+    const real t438 = t437*t275;
+    const real t439 = t394*t254;
+    const real t440 = a[483];
+    const real t441 = t440*t212;
+    const real t442 = t426+t427+t428+t430+t432+t433+t434+t436+t438+t439+t441;
+    const real t445 = t419*t50;
+    const real t446 = t419*t67;
+    const real t447 = t416*t72;
+    const real t448 = t416*t73;
+    const real t449 = t429*t77;
+    const real t450 = t431*t126;
+    const real t451 = t429*t132;
+    const real t452 = t431*t136;
+    const real t453 = t422*t139;
+    const real t454 = t425*t145;
+    const real t455 = t422*t146;
+    const real t456 = t425*t155;
+    const real t457 = t440*t275;
+    const real t458 = t410+t412+t413+t414+t415+t445+t446+t447+t448+t449+t450+t451+t452+
+t453+t454+t455+t456+t436+t457;
+    const real t460 = t270*t50;
+    const real t461 = t268*t67;
+    const real t462 = t284*t139;
+    const real t463 = t319*t145;
+    const real t464 = t272*t146;
+    const real t465 = t274*t155;
+    const real t466 = t262+t314+t261+t263+t315+t460+t461+t299+t300+t301+t303+t304+t305+
+t462+t463+t464+t465;
+    const real t311 = (t343+t358)*t475;
+    const real t312 = t368+t378;
+    const real t322 = t387+t400;
+    const real t359 = t410+t412+t413+t414+t415+t417+t418+t420+t421+t423+t442;
+    const real t468 = t277+t288+t294+t308*t145+t313+t324+t311+t312*t309+t322*t215+t408*
+t146+t359*t212+t458*t275+t466*t155;
+    const real t471 = a[0];
+    const real t472 = a[37];
+    const real t473 = a[316];
+    const real t372 = t473*t5;
+    const real t476 = (t472+t372)*t5;
+    const real t477 = a[415];
+    const real t478 = t477*t5;
+    const real t479 = a[13];
+    const real t480 = a[497];
+    const real t481 = t480*t20;
+    const real t376 = t478+t479+t481;
+    const real t483 = t376*t20;
+    const real t484 = a[492];
+    const real t485 = t484*t20;
+    const real t486 = a[198];
+    const real t487 = t486*t5;
+    const real t488 = t473*t26;
+    const real t377 = t485+t487+t472+t488;
+    const real t490 = t377*t26;
+    const real t491 = t484*t5;
+    const real t492 = a[223];
+    const real t494 = t477*t26;
+    const real t495 = t480*t37;
+    const real t380 = t491+t492*t20+t479+t494+t495;
+    const real t497 = t380*t37;
+    const real t498 = a[431];
+    const real t499 = t498*t5;
+    const real t500 = a[11];
+    const real t501 = a[247];
+    const real t502 = t501*t20;
+    const real t503 = a[387];
+    const real t504 = t503*t37;
+    const real t505 = a[107];
+    const real t506 = t505*t26;
+    const real t507 = a[110];
+    const real t508 = t507*t50;
+    const real t401 = t499+t500+t502+t504+t506+t508;
+    const real t510 = t401*t50;
+    const real t511 = t503*t20;
+    const real t512 = a[299];
+    const real t513 = t512*t50;
+    const real t514 = t501*t37;
+    const real t515 = t505*t5;
+    const real t516 = t498*t26;
+    const real t517 = t507*t67;
+    const real t402 = t511+t513+t514+t500+t515+t516+t517;
+    const real t519 = t402*t67;
+    const real t520 = a[325];
+    const real t521 = t520*t20;
+    const real t522 = a[264];
+    const real t523 = t522*t5;
+    const real t524 = a[38];
+    const real t525 = t522*t26;
+    const real t526 = t520*t37;
+    const real t527 = a[278];
+    const real t528 = t527*t50;
+    const real t529 = t527*t67;
+    const real t530 = a[472];
+    const real t409 = t530*t72;
+    const real t533 = (t521+t523+t524+t525+t526+t528+t529+t409)*t72;
+    const real t534 = a[9];
+    const real t535 = a[306];
+    const real t536 = t535*t5;
+    const real t537 = a[129];
+    const real t538 = t537*t20;
+    const real t539 = t535*t26;
+    const real t540 = t537*t37;
+    const real t541 = a[338];
+    const real t542 = t541*t50;
+    const real t543 = t541*t67;
+    const real t544 = a[524];
+    const real t545 = t544*t72;
+    const real t546 = a[509];
+    const real t435 = t546*t73;
+    const real t549 = (t534+t536+t538+t539+t540+t542+t543+t545+t435)*t73;
+    const real t550 = a[208];
+    const real t551 = t550*t5;
+    const real t552 = a[67];
+    const real t553 = t550*t20;
+    const real t554 = t550*t26;
+    const real t555 = t550*t37;
+    const real t556 = a[445];
+    const real t557 = t556*t50;
+    const real t558 = t556*t67;
+    const real t559 = a[421];
+    const real t560 = t559*t72;
+    const real t561 = t559*t73;
+    const real t562 = a[457];
+    const real t563 = t562*t77;
+    const real t566 = a[6];
+    const real t567 = a[126];
+    const real t568 = t567*t5;
+    const real t569 = t567*t20;
+    const real t570 = t567*t26;
+    const real t571 = t567*t37;
+    const real t572 = a[491];
+    const real t573 = t572*t50;
+    const real t574 = t572*t67;
+    const real t575 = a[111];
+    const real t576 = t575*t72;
+    const real t577 = t575*t73;
+    const real t578 = a[425];
+    const real t579 = t578*t77;
+    const real t580 = a[259];
+    const real t581 = t580*t126;
+    const real t582 = t566+t568+t569+t570+t571+t573+t574+t576+t577+t579+t581;
+    const real t584 = a[45];
+    const real t585 = a[183];
+    const real t586 = t585*t20;
+    const real t587 = a[143];
+    const real t588 = t587*t5;
+    const real t589 = t587*t26;
+    const real t590 = t585*t37;
+    const real t591 = a[460];
+    const real t592 = t591*t50;
+    const real t593 = t591*t67;
+    const real t594 = a[279];
+    const real t596 = a[473];
+    const real t599 = a[417];
+    const real t600 = t599*t132;
+    const real t601 = t584+t586+t588+t589+t590+t592+t593+t594*t72+t596*t73+t579+t578*t126+
+t600;
+    const real t603 = a[137];
+    const real t604 = t603*t5;
+    const real t605 = a[150];
+    const real t606 = t605*t20;
+    const real t607 = a[50];
+    const real t608 = t603*t26;
+    const real t609 = t605*t37;
+    const real t610 = a[312];
+    const real t611 = t610*t50;
+    const real t612 = t610*t67;
+    const real t613 = a[141];
+    const real t614 = t613*t72;
+    const real t615 = a[427];
+    const real t616 = t615*t73;
+    const real t617 = a[382];
+    const real t619 = t604+t606+t607+t608+t609+t611+t612+t614+t616+t563+t581+t600+t617*
+t136;
+    const real t470 = t551+t552+t553+t554+t555+t557+t558+t560+t561+t563;
+    const real t489 = t619*t136;
+    const real t621 = t471+t476+t483+t490+t497+t510+t519+t533+t549+t470*t77+t582*t126+t601
+*t132+t489;
+    const real t493 = t274*t77;
+    const real t625 = (t259+t261+t262+t263+t264+t266+t267+t269+t271+t493)*t77;
+    const real t627 = t51+t53+t55+t56+t57+t59+t60+t62+t64+t273+t65*t126;
+    const real t628 = t627*t126;
+    const real t631 = t262+t295+t314+t296+t315+t266+t267+t316+t317+t319*t77+t285+t274*t132
+;
+    const real t632 = t631*t132;
+    const real t633 = t69+t74+t79+t84+t105+t157+t256+t294+t313+t625+t628+t632;
+    const real t636 = t51+t85+t278+t86+t279+t59+t60+t280+t281+t318+t282*t126+t321+t65*t136
+;
+    const real t637 = t636*t136;
+    const real t638 = t91*t126;
+    const real t639 = t91*t136;
+    const real t640 = t51+t53+t85+t86+t57+t87+t88+t89+t90+t301+t638+t304+t639+t97;
+    const real t642 = t302*t77;
+    const real t643 = t302*t132;
+    const real t644 = t259+t262+t295+t296+t264+t297+t298+t299+t300+t642+t94+t643+t96+t306+
+t307;
+    const real t646 = t51+t278+t55+t56+t279+t403+t404+t89+t90+t301+t638+t304+t639+t405+
+t406+t407;
+    const real t648 = t262+t314+t261+t263+t315+t460+t461+t299+t300+t642+t94+t643+t96+t462+
+t463+t464+t465;
+    const real t650 = t204*t77;
+    const real t651 = t202*t126;
+    const real t652 = t204*t132;
+    const real t653 = t202*t136;
+    const real t654 = t191+t193+t194+t195+t196+t198+t199+t200+t201+t650+t651+t652+t653+
+t208+t209+t210+t211+t213;
+    const real t656 = t230*t77;
+    const real t657 = t228*t126;
+    const real t658 = t230*t132;
+    const real t659 = t228*t136;
+    const real t660 = t244*t275;
+    const real t661 = t217+t218+t219+t220+t221+t223+t224+t226+t227+t656+t657+t658+t659+
+t235+t237+t238+t239+t241+t660;
+    const real t663 = t431*t77;
+    const real t664 = t429*t126;
+    const real t665 = t431*t132;
+    const real t666 = t429*t136;
+    const real t667 = t440*t254;
+    const real t668 = t410+t412+t413+t414+t415+t445+t446+t447+t448+t663+t664+t665+t666+
+t453+t454+t455+t456+t436+t243+t667;
+    const real t670 = t425*t77;
+    const real t672 = t422*t126;
+    const real t673 = t425*t132;
+    const real t674 = t422*t136;
+    const real t675 = t437*t254;
+    const real t676 = t672+t673+t674+t430+t432+t433+t434+t436+t395+t675+t441;
+    const real t679 = t236*t77;
+    const real t680 = t234*t126;
+    const real t681 = t217+t218+t219+t220+t221+t381+t382+t383+t384+t679+t680;
+    const real t682 = t236*t132;
+    const real t683 = t234*t136;
+    const real t684 = t396*t275;
+    const real t685 = t682+t683+t390+t391+t392+t393+t241+t684+t439+t398+t399;
+    const real t690 = t109+t107+t108+t110+t111+t113+t114+t116+t117+t131*t77+t137*t126;
+    const real t695 = t141*t143;
+    const real t696 = t131*t132+t137*t136+t121+t122+t124+t125+t127+t133*t275+t135*t254+
+t129+t130+t695;
+    const real t699 = t344*t77;
+    const real t700 = t341*t126;
+    const real t701 = t344*t132;
+    const real t702 = t334+t330+t331+t332+t335+t337+t338+t339+t340+t699+t700+t701;
+    const real t703 = t341*t136;
+    const real t704 = t351*t275;
+    const real t705 = t327*t254;
+    const real t707 = t703+t342+t345+t346+t347+t349+t704+t705+t350+t352+t695+t325*t309;
+    const real t629 = t410+t412+t413+t414+t415+t417+t418+t420+t421+t670+t676;
+    const real t634 = t681+t685;
+    const real t641 = t690+t696;
+    const real t649 = (t702+t707)*t309;
+    const real t710 = t637+t640*t139+t644*t145+t646*t146+t648*t155+t654*t179+t661*t275+
+t668*t254+t629*t212+t634*t215+t641*t143+t649;
+    const real t713 = a[1];
+    const real t714 = a[64];
+    const real t715 = a[399];
+    const real t716 = t715*t5;
+    const real t655 = t714+t716;
+    const real t718 = t655*t5;
+    const real t719 = a[60];
+    const real t720 = a[471];
+    const real t726 = t473*t20;
+    const real t662 = t487+t472+t726;
+    const real t728 = t662*t20;
+    const real t729 = t480*t26;
+    const real t669 = t478+t485+t479+t729;
+    const real t731 = t669*t26;
+    const real t732 = t477*t20;
+    const real t677 = t732+t492*t26+t491+t479+t495;
+    const real t735 = t677*t37;
+    const real t736 = t522*t20;
+    const real t737 = t520*t26;
+    const real t678 = t530*t50;
+    const real t740 = (t523+t524+t736+t737+t526+t678)*t50;
+    const real t741 = t535*t20;
+    const real t742 = t537*t26;
+    const real t743 = t544*t50;
+    const real t687 = t546*t67;
+    const real t746 = (t534+t536+t741+t742+t540+t743+t687)*t67;
+    const real t747 = t501*t26;
+    const real t748 = t505*t20;
+    const real t749 = t507*t72;
+    const real t689 = t747+t499+t528+t543+t504+t500+t748+t749;
+    const real t751 = t689*t72;
+    const real t752 = t512*t72;
+    const real t753 = t498*t20;
+    const real t754 = t503*t26;
+    const real t755 = t507*t73;
+    const real t691 = t514+t752+t500+t528+t753+t515+t543+t754+t755;
+    const real t757 = t691*t73;
+    const real t758 = a[139];
+    const real t759 = t758*t20;
+    const real t760 = a[274];
+    const real t761 = t760*t26;
+    const real t762 = a[14];
+    const real t763 = a[83];
+    const real t764 = t763*t5;
+    const real t765 = t763*t37;
+    const real t766 = a[96];
+    const real t767 = t766*t50;
+    const real t768 = a[200];
+    const real t769 = t768*t67;
+    const real t770 = t768*t72;
+    const real t771 = t766*t73;
+    const real t772 = a[255];
+    const real t773 = t772*t77;
+    const real t692 = t759+t761+t762+t764+t765+t767+t769+t770+t771+t773;
+    const real t775 = t692*t77;
+    const real t776 = a[84];
+    const real t777 = t776*t77;
+    const real t778 = t772*t126;
+    const real t779 = t759+t761+t762+t764+t765+t767+t769+t770+t771+t777+t778;
+    const real t780 = t779*t126;
+    const real t781 = t758*t5;
+    const real t782 = t763*t20;
+    const real t783 = t763*t26;
+    const real t784 = t760*t37;
+    const real t785 = t766*t72;
+    const real t786 = t768*t73;
+    const real t787 = a[354];
+    const real t788 = t787*t77;
+    const real t789 = a[79];
+    const real t790 = t789*t126;
+    const real t791 = t772*t132;
+    const real t792 = t781+t762+t782+t783+t784+t767+t769+t785+t786+t788+t790+t791;
+    const real t793 = t792*t132;
+    const real t794 = t789*t77;
+    const real t795 = t787*t126;
+    const real t796 = t776*t132;
+    const real t797 = t772*t136;
+    const real t798 = t781+t762+t782+t783+t784+t767+t769+t785+t786+t794+t795+t796+t797;
+    const real t799 = t798*t136;
+    const real t800 = t559*t50;
+    const real t801 = t559*t67;
+    const real t802 = t556*t72;
+    const real t803 = t556*t73;
+    const real t804 = t789*t132;
+    const real t805 = t789*t136;
+    const real t806 = t562*t139;
+    const real t807 = t551+t552+t553+t554+t555+t800+t801+t802+t803+t794+t790+t804+t805+
+t806;
+    const real t809 = t575*t50;
+    const real t810 = t575*t67;
+    const real t811 = t572*t72;
+    const real t812 = t572*t73;
+    const real t813 = t787*t132;
+    const real t814 = t787*t136;
+    const real t815 = t578*t139;
+    const real t816 = t580*t145;
+    const real t817 = t566+t568+t569+t570+t571+t809+t810+t811+t812+t788+t795+t813+t814+
+t815+t816;
+    const real t819 = t587*t20;
+    const real t820 = t585*t26;
+    const real t823 = t591*t72;
+    const real t824 = t591*t73;
+    const real t825 = t776*t126;
+    const real t826 = t776*t136;
+    const real t828 = t599*t146;
+    const real t829 = t584+t588+t819+t820+t590+t594*t50+t596*t67+t823+t824+t777+t825+t796+
+t826+t815+t578*t145+t828;
+    const real t831 = t603*t20;
+    const real t832 = t605*t26;
+    const real t833 = t613*t50;
+    const real t834 = t615*t67;
+    const real t835 = t610*t72;
+    const real t836 = t610*t73;
+    const real t838 = t604+t607+t831+t832+t609+t833+t834+t835+t836+t773+t778+t791+t797+
+t806+t816+t828+t617*t155;
+    const real t711 = t838*t155;
+    const real t840 = t471+t476+t728+t731+t735+t740+t746+t751+t757+t775+t780+t793+t799+
+t807*t139+t817*t145+t829*t146+t711;
+    const real t843 = a[59];
+    const real t844 = a[293];
+    const real t848 = a[548];
+    const real t849 = t848*t5;
+    const real t853 = a[220];
+    const real t864 = a[33];
+    const real t865 = a[482];
+    const real t866 = t865*t5;
+    const real t867 = t865*t20;
+    const real t868 = a[400];
+    const real t869 = t868*t26;
+    const real t870 = t868*t37;
+    const real t871 = a[337];
+    const real t875 = t868*t5;
+    const real t876 = t868*t20;
+    const real t877 = t865*t26;
+    const real t878 = t865*t37;
+    const real t879 = a[537];
+    const real t884 = a[177];
+    const real t885 = t884*t50;
+    const real t886 = t884*t67;
+    const real t894 = a[138];
+    const real t895 = t894*t5;
+    const real t896 = a[362];
+    const real t897 = t896*t20;
+    const real t898 = a[52];
+    const real t899 = t894*t26;
+    const real t900 = t896*t37;
+    const real t901 = a[317];
+    const real t902 = t901*t50;
+    const real t903 = t901*t67;
+    const real t904 = a[459];
+    const real t905 = t904*t72;
+    const real t906 = a[519];
+    const real t907 = t906*t73;
+    const real t908 = a[120];
+    const real t912 = a[475];
+    const real t915 = t895+t897+t898+t899+t900+t902+t903+t905+t907+t912*t77+t908*t126;
+    const real t917 = t894*t20;
+    const real t918 = t896*t5;
+    const real t919 = t896*t26;
+    const real t920 = t894*t37;
+    const real t921 = t906*t72;
+    const real t922 = t904*t73;
+    const real t923 = a[501];
+    const real t925 = a[536];
+    const real t928 = t917+t898+t918+t919+t920+t902+t903+t921+t922+t923*t77+t925*t126+t908
+*t132;
+    const real t934 = t917+t898+t918+t919+t920+t902+t903+t921+t922+t925*t77+t923*t126+t912
+*t132+t908*t136;
+    const real t936 = t904*t50;
+    const real t937 = t906*t67;
+    const real t938 = t901*t72;
+    const real t939 = t901*t73;
+    const real t940 = a[164];
+    const real t941 = t940*t77;
+    const real t942 = t940*t126;
+    const real t943 = t940*t132;
+    const real t944 = t940*t136;
+    const real t946 = t895+t898+t917+t919+t900+t936+t937+t938+t939+t941+t942+t943+t944+
+t908*t139;
+    const real t950 = t895+t898+t917+t919+t900+t936+t937+t938+t939+t941+t942+t943+t944+
+t912*t139+t908*t145;
+    const real t952 = t906*t50;
+    const real t953 = t904*t67;
+    const real t957 = t898+t918+t897+t899+t920+t952+t953+t938+t939+t941+t942+t943+t944+
+t923*t139+t925*t145+t908*t146;
+    const real t963 = t898+t918+t897+t899+t920+t952+t953+t938+t939+t941+t942+t943+t944+
+t925*t139+t923*t145+t912*t146+t908*t155;
+    const real t965 = a[199];
+    const real t971 = a[450];
+    const real t976 = a[346];
+    const real t856 = a[508];
+    const real t987 = t965*t5+a[68]+t965*t20+t965*t26+t965*t37+t971*t50+t971*t67+t971*t72+
+t971*t73+t976*t77+t976*t126+t976*t132+t976*t136+t976*t139+t976*t145+t976*t146+
+t976*t155+t856*t179;
+    const real t859 = t844*t5;
+    const real t862 = t844*t20;
+    const real t873 = t853*t20;
+    const real t874 = t844*t26;
+    const real t882 = t848*t20;
+    const real t883 = t853*t5;
+    const real t887 = t848*t26;
+    const real t888 = t844*t37;
+    const real t891 = t871*t50;
+    const real t909 = t879*t50;
+    const real t910 = t871*t67;
+    const real t914 = t871*t72;
+    const real t926 = t879*t72;
+    const real t927 = t871*t73;
+    const real t931 = t908*t77;
+    const real t955 = t987*t179;
+    const real t989 = a[2]+(t843+t859)*t5+(t849+t843+t862)*t20+(t849+t873+t843+t874)*t26+(
+t882+t883+t843+t887+t888)*t37+(t864+t866+t867+t869+t870+t891)*t50+(t875+t864+
+t876+t877+t878+t909+t910)*t67+(t876+t864+t866+t877+t870+t885+t886+t914)*t72+(
+t875+t864+t867+t869+t878+t885+t886+t926+t927)*t73+(t895+t897+t898+t899+t900+
+t902+t903+t905+t907+t931)*t77+t915*t126+t928*t132+t934*t136+t946*t139+t950*t145
++t957*t146+t963*t155+t955;
+    const real t991 = a[4];
+    const real t992 = a[15];
+    const real t993 = a[77];
+    const real t956 = t993*t5;
+    const real t996 = (t992+t956)*t5;
+    const real t997 = a[488];
+    const real t998 = t997*t5;
+    const real t999 = t993*t20;
+    const real t959 = t998+t992+t999;
+    const real t1001 = t959*t20;
+    const real t1002 = a[455];
+    const real t1003 = t1002*t5;
+    const real t1004 = a[265];
+    const real t1005 = t1004*t20;
+    const real t1006 = t993*t26;
+    const real t960 = t1003+t1005+t992+t1006;
+    const real t1008 = t960*t26;
+    const real t1011 = t1004*t5;
+    const real t1012 = t993*t37;
+    const real t964 = t992+t997*t26+t1002*t20+t1011+t1012;
+    const real t1014 = t964*t37;
+    const real t1015 = a[30];
+    const real t1016 = a[156];
+    const real t1017 = t1016*t5;
+    const real t1018 = t1016*t20;
+    const real t1019 = a[98];
+    const real t1020 = t1019*t26;
+    const real t1021 = t1019*t37;
+    const real t1022 = a[538];
+    const real t966 = t1022*t50;
+    const real t1025 = (t1015+t1017+t1018+t1020+t1021+t966)*t50;
+    const real t1026 = t1019*t5;
+    const real t1027 = t1019*t20;
+    const real t1028 = t1016*t26;
+    const real t1029 = t1016*t37;
+    const real t1030 = a[496];
+    const real t968 = t1030*t50;
+    const real t969 = t1022*t67;
+    const real t1034 = (t1015+t1026+t1027+t1028+t1029+t968+t969)*t67;
+    const real t1035 = a[444];
+    const real t1036 = t1035*t20;
+    const real t1037 = a[123];
+    const real t1038 = t1037*t5;
+    const real t1039 = a[51];
+    const real t1040 = t1037*t26;
+    const real t1041 = t1035*t37;
+    const real t1042 = a[252];
+    const real t1043 = t1042*t50;
+    const real t1044 = t1042*t67;
+    const real t1045 = a[140];
+    const real t972 = t1045*t72;
+    const real t1048 = (t1036+t1038+t1039+t1040+t1041+t1043+t1044+t972)*t72;
+    const real t1049 = t1035*t5;
+    const real t1050 = t1037*t20;
+    const real t1051 = t1035*t26;
+    const real t1052 = t1037*t37;
+    const real t1053 = a[522];
+    const real t974 = t1053*t72;
+    const real t975 = t1045*t73;
+    const real t1057 = (t1049+t1050+t1039+t1051+t1052+t1043+t1044+t974+t975)*t73;
+    const real t1058 = a[342];
+    const real t1059 = t1058*t20;
+    const real t1060 = a[205];
+    const real t1061 = t1060*t5;
+    const real t1062 = a[56];
+    const real t1063 = t1060*t26;
+    const real t1064 = t1058*t37;
+    const real t1065 = a[180];
+    const real t1066 = t1065*t50;
+    const real t1067 = t1065*t67;
+    const real t1068 = a[269];
+    const real t1069 = t1068*t72;
+    const real t1070 = a[158];
+    const real t1071 = t1070*t73;
+    const real t1072 = a[350];
+    const real t978 = t1072*t77;
+    const real t1075 = (t1059+t1061+t1062+t1063+t1064+t1066+t1067+t1069+t1071+t978)*t77;
+    const real t1076 = a[262];
+    const real t1079 = t1059+t1061+t1062+t1063+t1064+t1066+t1067+t1069+t1071+t1076*t77+
+t1072*t126;
+    const real t1080 = t1079*t126;
+    const real t1081 = t991+t996+t1001+t1008+t1014+t1025+t1034+t1048+t1057+t1075+t1080;
+    const real t1082 = t1060*t20;
+    const real t1083 = t1058*t5;
+    const real t1084 = t1058*t26;
+    const real t1085 = t1060*t37;
+    const real t1086 = t1070*t72;
+    const real t1087 = t1068*t73;
+    const real t1088 = a[507];
+    const real t1090 = a[234];
+    const real t1093 = t1082+t1062+t1083+t1084+t1085+t1066+t1067+t1086+t1087+t1088*t77+
+t1090*t126+t1072*t132;
+    const real t1094 = t1093*t132;
+    const real t1099 = t1082+t1062+t1083+t1084+t1085+t1066+t1067+t1086+t1087+t1090*t77+
+t1088*t126+t1076*t132+t1072*t136;
+    const real t1100 = t1099*t136;
+    const real t1101 = a[116];
+    const real t1102 = t1101*t5;
+    const real t1103 = a[32];
+    const real t1104 = t1101*t20;
+    const real t1105 = a[125];
+    const real t1106 = t1105*t26;
+    const real t1107 = t1105*t37;
+    const real t1108 = a[85];
+    const real t1109 = t1108*t50;
+    const real t1110 = a[391];
+    const real t1111 = t1110*t67;
+    const real t1112 = a[112];
+    const real t1113 = t1112*t72;
+    const real t1114 = t1112*t73;
+    const real t1115 = a[295];
+    const real t1116 = t1115*t77;
+    const real t1117 = t1115*t126;
+    const real t1118 = t1115*t132;
+    const real t1119 = t1115*t136;
+    const real t1120 = a[230];
+    const real t1122 = t1102+t1103+t1104+t1106+t1107+t1109+t1111+t1113+t1114+t1116+t1117+
+t1118+t1119+t1120*t139;
+    const real t1124 = a[53];
+    const real t1125 = a[69];
+    const real t1126 = t1125*t5;
+    const real t1127 = t1125*t20;
+    const real t1128 = a[324];
+    const real t1129 = t1128*t26;
+    const real t1130 = t1128*t37;
+    const real t1131 = a[227];
+    const real t1132 = t1131*t50;
+    const real t1133 = a[95];
+    const real t1134 = t1133*t67;
+    const real t1135 = a[70];
+    const real t1136 = t1135*t72;
+    const real t1137 = t1135*t73;
+    const real t1138 = a[74];
+    const real t1139 = t1138*t77;
+    const real t1140 = t1138*t126;
+    const real t1141 = t1138*t132;
+    const real t1142 = t1138*t136;
+    const real t1143 = a[309];
+    const real t1144 = t1143*t139;
+    const real t1145 = a[86];
+    const real t1147 = t1124+t1126+t1127+t1129+t1130+t1132+t1134+t1136+t1137+t1139+t1140+
+t1141+t1142+t1144+t1145*t145;
+    const real t1149 = t1105*t5;
+    const real t1150 = t1105*t20;
+    const real t1151 = t1101*t26;
+    const real t1152 = t1101*t37;
+    const real t1153 = t1110*t50;
+    const real t1154 = t1108*t67;
+    const real t1155 = a[467];
+    const real t1157 = a[424];
+    const real t1158 = t1157*t145;
+    const real t1160 = t1103+t1149+t1150+t1151+t1152+t1153+t1154+t1113+t1114+t1116+t1117+
+t1118+t1119+t1155*t139+t1158+t1120*t146;
+    const real t1162 = t1128*t5;
+    const real t1163 = t1128*t20;
+    const real t1164 = t1125*t26;
+    const real t1165 = t1125*t37;
+    const real t1166 = t1133*t50;
+    const real t1167 = t1131*t67;
+    const real t1168 = t1157*t139;
+    const real t1169 = a[239];
+    const real t1171 = t1143*t146;
+    const real t1173 = t1124+t1162+t1163+t1164+t1165+t1166+t1167+t1136+t1137+t1139+t1140+
+t1141+t1142+t1168+t1169*t145+t1171+t1145*t155;
+    const real t1175 = a[169];
+    const real t1176 = t1175*t5;
+    const real t1177 = a[18];
+    const real t1178 = t1175*t20;
+    const real t1179 = t1175*t26;
+    const real t1180 = t1175*t37;
+    const real t1181 = a[152];
+    const real t1182 = t1181*t50;
+    const real t1183 = t1181*t67;
+    const real t1184 = a[130];
+    const real t1185 = t1184*t72;
+    const real t1186 = t1184*t73;
+    const real t1187 = a[93];
+    const real t1188 = t1187*t77;
+    const real t1189 = t1187*t126;
+    const real t1190 = t1187*t132;
+    const real t1191 = t1187*t136;
+    const real t1192 = a[540];
+    const real t1194 = a[452];
+    const real t1013 = a[503];
+    const real t1199 = t1013*t179;
+    const real t1200 = t1176+t1177+t1178+t1179+t1180+t1182+t1183+t1185+t1186+t1188+t1189+
+t1190+t1191+t1192*t139+t1194*t145+t1192*t146+t1194*t155+t1199;
+    const real t1202 = a[42];
+    const real t1203 = a[313];
+    const real t1204 = t1203*t5;
+    const real t1205 = t1203*t20;
+    const real t1206 = t1203*t26;
+    const real t1207 = t1203*t37;
+    const real t1208 = a[88];
+    const real t1209 = t1208*t50;
+    const real t1210 = t1208*t67;
+    const real t1211 = t1208*t72;
+    const real t1212 = t1208*t73;
+    const real t1213 = a[339];
+    const real t1214 = t1213*t77;
+    const real t1215 = a[171];
+    const real t1216 = t1215*t126;
+    const real t1217 = t1213*t132;
+    const real t1218 = t1215*t136;
+    const real t1219 = t1215*t139;
+    const real t1220 = t1213*t145;
+    const real t1221 = t1215*t146;
+    const real t1222 = t1213*t155;
+    const real t1033 = a[266];
+    const real t1224 = t1033*t179;
+    const real t1225 = a[416];
+    const real t1226 = t1225*t275;
+    const real t1227 = t1202+t1204+t1205+t1206+t1207+t1209+t1210+t1211+t1212+t1214+t1216+
+t1217+t1218+t1219+t1220+t1221+t1222+t1224+t1226;
+    const real t1229 = t1215*t77;
+    const real t1230 = t1213*t126;
+    const real t1231 = t1215*t132;
+    const real t1232 = t1213*t136;
+    const real t1233 = a[514];
+    const real t1234 = t1233*t275;
+    const real t1235 = t1225*t254;
+    const real t1236 = t1202+t1204+t1205+t1206+t1207+t1209+t1210+t1211+t1212+t1229+t1230+
+t1231+t1232+t1219+t1220+t1221+t1222+t1224+t1234+t1235;
+    const real t1238 = a[254];
+    const real t1239 = t1238*t5;
+    const real t1240 = a[19];
+    const real t1241 = t1238*t20;
+    const real t1242 = t1238*t26;
+    const real t1243 = t1238*t37;
+    const real t1244 = a[550];
+    const real t1247 = a[377];
+    const real t1250 = a[136];
+    const real t1256 = a[439];
+    const real t1046 = a[531];
+    const real t1262 = t1046*t179;
+    const real t1264 = a[499];
+    const real t1265 = t1264*t212;
+    const real t1266 = t1250*t126+t1250*t132+t1250*t136+t1256*t139+t1256*t145+t1256*t146+
+t1256*t155+t1262+t1234+t1233*t254+t1265;
+    const real t1269 = a[65];
+    const real t1270 = a[258];
+    const real t1271 = t1270*t5;
+    const real t1272 = t1270*t20;
+    const real t1273 = t1270*t26;
+    const real t1274 = t1270*t37;
+    const real t1275 = a[163];
+    const real t1276 = t1275*t50;
+    const real t1277 = t1275*t67;
+    const real t1278 = a[225];
+    const real t1279 = t1278*t72;
+    const real t1280 = t1278*t73;
+    const real t1281 = a[114];
+    const real t1282 = t1281*t77;
+    const real t1283 = t1281*t126;
+    const real t1284 = t1269+t1271+t1272+t1273+t1274+t1276+t1277+t1279+t1280+t1282+t1283;
+    const real t1285 = t1281*t132;
+    const real t1286 = t1281*t136;
+    const real t1287 = a[149];
+    const real t1289 = a[221];
+    const real t1089 = a[394];
+    const real t1294 = t1089*t179;
+    const real t1295 = a[513];
+    const real t1297 = t1285+t1286+t1287*t139+t1289*t145+t1287*t146+t1289*t155+t1294+t1226
++t1235+t1265+t1295*t215;
+    const real t1195 = t1239+t1240+t1241+t1242+t1243+t1244*t50+t1244*t67+t1247*t72+t1247*
+t73+t1250*t77+t1266;
+    const real t1198 = (t1284+t1297)*t215;
+    const real t1300 = t1094+t1100+t1122*t139+t1147*t145+t1160*t146+t1173*t155+t1200*t179+
+t1227*t275+t1236*t254+t1195*t212+t1198;
+    const real t1303 = a[27];
+    const real t1304 = a[396];
+    const real t1305 = t1304*t5;
+    const real t1306 = a[146];
+    const real t1307 = t1306*t20;
+    const real t1201 = t1003+t992+t999;
+    const real t1316 = t1201*t20;
+    const real t1223 = t998+t1005+t992+t1006;
+    const real t1318 = t1223*t26;
+    const real t1245 = t1011+t992+t1002*t26+t997*t20+t1012;
+    const real t1322 = t1245*t37;
+    const real t1246 = t1045*t50;
+    const real t1325 = (t1038+t1039+t1050+t1051+t1041+t1246)*t50;
+    const real t1249 = t1053*t50;
+    const real t1251 = t1045*t67;
+    const real t1329 = (t1039+t1049+t1036+t1040+t1052+t1249+t1251)*t67;
+    const real t1253 = t1022*t72;
+    const real t1332 = (t1015+t1017+t1027+t1028+t1021+t1043+t1044+t1253)*t72;
+    const real t1255 = t1030*t72;
+    const real t1257 = t1022*t73;
+    const real t1336 = (t1015+t1026+t1018+t1020+t1029+t1043+t1044+t1255+t1257)*t73;
+    const real t1337 = t1135*t50;
+    const real t1338 = t1135*t67;
+    const real t1339 = t1131*t72;
+    const real t1340 = t1133*t73;
+    const real t1344 = t1112*t50;
+    const real t1345 = t1112*t67;
+    const real t1346 = t1108*t72;
+    const real t1347 = t1110*t73;
+    const real t1348 = t1143*t77;
+    const real t1350 = t1150+t1102+t1103+t1151+t1107+t1344+t1345+t1346+t1347+t1348+t1120*
+t126;
+    const real t1352 = t1133*t72;
+    const real t1353 = t1131*t73;
+    const real t1355 = t1157*t126;
+    const real t1357 = t1124+t1127+t1162+t1129+t1165+t1337+t1338+t1352+t1353+t1169*t77+
+t1355+t1145*t132;
+    const real t1359 = t1110*t72;
+    const real t1360 = t1108*t73;
+    const real t1361 = t1157*t77;
+    const real t1363 = t1143*t132;
+    const real t1365 = t1103+t1104+t1149+t1106+t1152+t1344+t1345+t1359+t1360+t1361+t1155*
+t126+t1363+t1120*t136;
+    const real t1367 = t1068*t50;
+    const real t1368 = t1070*t67;
+    const real t1369 = t1065*t72;
+    const real t1370 = t1065*t73;
+    const real t1371 = t1072*t139;
+    const real t1372 = t1061+t1062+t1082+t1084+t1064+t1367+t1368+t1369+t1370+t1139+t1117+
+t1141+t1119+t1371;
+    const real t1374 = t1076*t139;
+    const real t1375 = t1072*t145;
+    const real t1376 = t1061+t1062+t1082+t1084+t1064+t1367+t1368+t1369+t1370+t1139+t1117+
+t1141+t1119+t1374+t1375;
+    const real t1378 = t1070*t50;
+    const real t1379 = t1068*t67;
+    const real t1380 = t1088*t139;
+    const real t1381 = t1090*t145;
+    const real t1382 = t1072*t146;
+    const real t1383 = t1062+t1083+t1059+t1063+t1085+t1378+t1379+t1369+t1370+t1139+t1117+
+t1141+t1119+t1380+t1381+t1382;
+    const real t1385 = t1090*t139;
+    const real t1386 = t1088*t145;
+    const real t1387 = t1076*t146;
+    const real t1388 = t1072*t155;
+    const real t1389 = t1062+t1083+t1059+t1063+t1085+t1378+t1379+t1369+t1370+t1139+t1117+
+t1141+t1119+t1385+t1386+t1387+t1388;
+    const real t1391 = t1184*t50;
+    const real t1392 = t1184*t67;
+    const real t1393 = t1181*t72;
+    const real t1394 = t1181*t73;
+    const real t1399 = t1187*t139;
+    const real t1400 = t1187*t145;
+    const real t1401 = t1187*t146;
+    const real t1402 = t1187*t155;
+    const real t1403 = t1176+t1177+t1178+t1179+t1180+t1391+t1392+t1393+t1394+t1194*t77+
+t1192*t126+t1194*t132+t1192*t136+t1399+t1400+t1401+t1402+t1199;
+    const real t1405 = t1278*t50;
+    const real t1406 = t1278*t67;
+    const real t1407 = t1275*t72;
+    const real t1408 = t1275*t73;
+    const real t1413 = t1281*t139;
+    const real t1414 = t1281*t145;
+    const real t1415 = t1281*t146;
+    const real t1416 = t1281*t155;
+    const real t1418 = t1269+t1271+t1272+t1273+t1274+t1405+t1406+t1407+t1408+t1289*t77+
+t1287*t126+t1289*t132+t1287*t136+t1413+t1414+t1415+t1416+t1294+t1295*t275;
+    const real t1301 = t1145*t77;
+    const real t1319 = t1418*t275;
+    const real t1420 = t991+t996+t1316+t1318+t1322+t1325+t1329+t1332+t1336+(t1163+t1124+
+t1126+t1164+t1130+t1337+t1338+t1339+t1340+t1301)*t77+t1350*t126+t1357*t132+
+t1365*t136+t1372*t139+t1376*t145+t1383*t146+t1389*t155+t1403*t179+t1319;
+    const real t1422 = a[375];
+    const real t1423 = t1422*t5;
+    const real t1424 = a[25];
+    const real t1425 = a[166];
+    const real t1426 = t1425*t20;
+    const real t1427 = t1422*t26;
+    const real t1428 = t1425*t37;
+    const real t1429 = a[191];
+    const real t1430 = t1429*t50;
+    const real t1431 = t1429*t67;
+    const real t1432 = a[389];
+    const real t1433 = t1432*t72;
+    const real t1434 = a[249];
+    const real t1435 = t1434*t73;
+    const real t1436 = a[335];
+    const real t1440 = a[151];
+    const real t1441 = t1440*t5;
+    const real t1442 = a[267];
+    const real t1443 = t1442*t20;
+    const real t1444 = a[41];
+    const real t1445 = t1440*t26;
+    const real t1446 = t1442*t37;
+    const real t1447 = a[193];
+    const real t1448 = t1447*t50;
+    const real t1449 = t1447*t67;
+    const real t1450 = a[323];
+    const real t1451 = t1450*t72;
+    const real t1452 = a[410];
+    const real t1453 = t1452*t73;
+    const real t1454 = a[109];
+    const real t1455 = t1454*t77;
+    const real t1456 = a[222];
+    const real t1458 = t1441+t1443+t1444+t1445+t1446+t1448+t1449+t1451+t1453+t1455+t1456*
+t126;
+    const real t1460 = a[55];
+    const real t1461 = a[87];
+    const real t1462 = t1461*t5;
+    const real t1463 = t1461*t20;
+    const real t1464 = t1461*t26;
+    const real t1465 = t1461*t37;
+    const real t1466 = a[202];
+    const real t1467 = t1466*t50;
+    const real t1468 = t1466*t67;
+    const real t1469 = a[104];
+    const real t1470 = t1469*t72;
+    const real t1471 = t1469*t73;
+    const real t1472 = a[251];
+    const real t1473 = t1472*t77;
+    const real t1474 = a[73];
+    const real t1475 = t1474*t126;
+    const real t1476 = t1472*t132;
+    const real t1477 = t1460+t1462+t1463+t1464+t1465+t1467+t1468+t1470+t1471+t1473+t1475+
+t1476;
+    const real t1478 = t1474*t136;
+    const real t1479 = a[438];
+    const real t1480 = t1479*t139;
+    const real t1481 = a[176];
+    const real t1482 = t1481*t145;
+    const real t1483 = t1479*t146;
+    const real t1484 = t1481*t155;
+    const real t1321 = a[433];
+    const real t1486 = t1321*t179;
+    const real t1487 = a[99];
+    const real t1488 = t1487*t275;
+    const real t1489 = a[409];
+    const real t1490 = t1489*t254;
+    const real t1491 = a[541];
+    const real t1492 = t1491*t212;
+    const real t1493 = a[296];
+    const real t1494 = t1493*t215;
+    const real t1495 = a[529];
+    const real t1496 = t1495*t143;
+    const real t1497 = a[461];
+    const real t1498 = t1497*t309;
+    const real t1499 = t1478+t1480+t1482+t1483+t1484+t1486+t1488+t1490+t1492+t1494+t1496+
+t1498;
+    const real t1502 = a[607];
+    const real t1503 = t1502*t20;
+    const real t1504 = a[212];
+    const real t1505 = a[638];
+    const real t1506 = t1505*t5;
+    const real t1507 = t1505*t26;
+    const real t1508 = t1502*t37;
+    const real t1509 = a[913];
+    const real t1510 = t1509*t50;
+    const real t1511 = t1509*t67;
+    const real t1512 = a[701];
+    const real t1513 = t1512*t72;
+    const real t1514 = a[1020];
+    const real t1515 = t1514*t73;
+    const real t1516 = a[1087];
+    const real t1520 = a[670];
+    const real t1523 = t1503+t1504+t1506+t1507+t1508+t1510+t1511+t1513+t1515+t1520*t77+
+t1516*t126;
+    const real t1525 = t1502*t5;
+    const real t1526 = t1505*t20;
+    const real t1527 = t1502*t26;
+    const real t1528 = t1505*t37;
+    const real t1529 = t1514*t72;
+    const real t1530 = t1512*t73;
+    const real t1531 = a[1058];
+    const real t1533 = a[1102];
+    const real t1537 = t1525+t1526+t1504+t1527+t1528+t1510+t1511+t1529+t1530+t1531*t77+
+t1533*t126+t1520*t132+t1516*t136;
+    const real t1539 = a[257];
+    const real t1540 = a[737];
+    const real t1541 = t1540*t5;
+    const real t1542 = t1540*t20;
+    const real t1543 = t1540*t26;
+    const real t1544 = t1540*t37;
+    const real t1545 = a[948];
+    const real t1546 = t1545*t50;
+    const real t1547 = t1545*t67;
+    const real t1548 = a[857];
+    const real t1549 = t1548*t72;
+    const real t1550 = t1548*t73;
+    const real t1551 = a[813];
+    const real t1553 = a[1036];
+    const real t1557 = a[780];
+    const real t1558 = t1557*t139;
+    const real t1559 = t1557*t145;
+    const real t1560 = t1557*t146;
+    const real t1561 = t1557*t155;
+    const real t1331 = a[1042];
+    const real t1563 = t1331*t179;
+    const real t1564 = a[1034];
+    const real t1566 = t1539+t1541+t1542+t1543+t1544+t1546+t1547+t1549+t1550+t1551*t77+
+t1553*t126+t1551*t132+t1553*t136+t1558+t1559+t1560+t1561+t1563+t1564*t275;
+    const real t1568 = a[478];
+    const real t1569 = a[668];
+    const real t1343 = t1569*t5;
+    const real t1572 = (t1568+t1343)*t5;
+    const real t1573 = a[276];
+    const real t1574 = a[836];
+    const real t1575 = t1574*t5;
+    const real t1576 = t1574*t20;
+    const real t1577 = t1574*t26;
+    const real t1578 = t1574*t37;
+    const real t1579 = a[815];
+    const real t1580 = t1579*t50;
+    const real t1581 = t1579*t67;
+    const real t1582 = a[919];
+    const real t1583 = t1582*t72;
+    const real t1584 = t1582*t73;
+    const real t1585 = a[576];
+    const real t1586 = t1585*t77;
+    const real t1587 = a[994];
+    const real t1588 = t1587*t126;
+    const real t1589 = t1585*t132;
+    const real t1590 = t1573+t1575+t1576+t1577+t1578+t1580+t1581+t1583+t1584+t1586+t1588+
+t1589;
+    const real t1591 = t1587*t136;
+    const real t1592 = a[806];
+    const real t1593 = t1592*t139;
+    const real t1594 = a[896];
+    const real t1595 = t1594*t145;
+    const real t1596 = t1592*t146;
+    const real t1597 = t1594*t155;
+    const real t1351 = a[954];
+    const real t1599 = t1351*t179;
+    const real t1600 = a[1150];
+    const real t1601 = t1600*t275;
+    const real t1602 = a[739];
+    const real t1603 = t1602*t254;
+    const real t1604 = a[1023];
+    const real t1605 = t1604*t212;
+    const real t1606 = a[1044];
+    const real t1607 = t1606*t215;
+    const real t1608 = a[1045];
+    const real t1609 = t1608*t143;
+    const real t1610 = a[753];
+    const real t1611 = t1610*t309;
+    const real t1612 = t1591+t1593+t1595+t1596+t1597+t1599+t1601+t1603+t1605+t1607+t1609+
+t1611;
+    const real t1615 = a[848];
+    const real t1616 = t1615*t5;
+    const real t1617 = a[428];
+    const real t1618 = t1615*t20;
+    const real t1619 = a[802];
+    const real t1620 = t1619*t26;
+    const real t1621 = t1619*t37;
+    const real t1622 = a[792];
+    const real t1623 = t1622*t50;
+    const real t1624 = a[1122];
+    const real t1625 = t1624*t67;
+    const real t1626 = a[1018];
+    const real t1627 = t1626*t72;
+    const real t1628 = t1626*t73;
+    const real t1629 = a[856];
+    const real t1630 = t1629*t77;
+    const real t1631 = t1629*t126;
+    const real t1632 = t1629*t132;
+    const real t1633 = t1629*t136;
+    const real t1634 = a[1136];
+    const real t1636 = a[847];
+    const real t1638 = a[867];
+    const real t1640 = a[799];
+    const real t1642 = t1616+t1617+t1618+t1620+t1621+t1623+t1625+t1627+t1628+t1630+t1631+
+t1632+t1633+t1634*t139+t1636*t145+t1638*t146+t1640*t155;
+    const real t1644 = a[484];
+    const real t1645 = a[795];
+    const real t1646 = t1645*t5;
+    const real t1647 = t1645*t20;
+    const real t1648 = t1645*t26;
+    const real t1649 = t1645*t37;
+    const real t1650 = a[1106];
+    const real t1651 = t1650*t50;
+    const real t1652 = t1650*t67;
+    const real t1653 = a[1114];
+    const real t1654 = t1653*t72;
+    const real t1655 = t1653*t73;
+    const real t1656 = a[658];
+    const real t1657 = t1656*t77;
+    const real t1658 = t1656*t126;
+    const real t1659 = t1644+t1646+t1647+t1648+t1649+t1651+t1652+t1654+t1655+t1657+t1658;
+    const real t1660 = t1656*t132;
+    const real t1661 = t1656*t136;
+    const real t1662 = a[675];
+    const real t1664 = a[1038];
+    const real t1364 = a[907];
+    const real t1669 = t1364*t179;
+    const real t1670 = a[964];
+    const real t1671 = t1670*t275;
+    const real t1672 = t1670*t254;
+    const real t1673 = a[1142];
+    const real t1675 = a[681];
+    const real t1677 = t1660+t1661+t1662*t139+t1664*t145+t1662*t146+t1664*t155+t1669+t1671
++t1672+t1673*t212+t1675*t215;
+    const real t1680 = a[1062];
+    const real t1681 = t1680*t5;
+    const real t1682 = a[256];
+    const real t1683 = a[1039];
+    const real t1684 = t1683*t20;
+    const real t1685 = t1680*t26;
+    const real t1686 = t1683*t37;
+    const real t1687 = a[585];
+    const real t1688 = t1687*t50;
+    const real t1689 = t1687*t67;
+    const real t1690 = a[1151];
+    const real t1692 = a[1061];
+    const real t1696 = a[1141];
+    const real t1697 = t1696*t5;
+    const real t1698 = a[555];
+    const real t1699 = t1696*t20;
+    const real t1700 = t1696*t26;
+    const real t1701 = t1696*t37;
+    const real t1702 = a[1076];
+    const real t1705 = a[1014];
+    const real t1708 = a[940];
+    const real t1713 = a[703];
+    const real t1396 = a[1152];
+    const real t1719 = t1396*t179;
+    const real t1720 = t1697+t1698+t1699+t1700+t1701+t1702*t50+t1702*t67+t1705*t72+t1705*
+t73+t1708*t77+t1708*t126+t1708*t132+t1708*t136+t1713*t139+t1713*t145+t1713*t146
++t1713*t155+t1719;
+    const real t1722 = t1619*t5;
+    const real t1723 = t1619*t20;
+    const real t1724 = t1615*t26;
+    const real t1725 = t1615*t37;
+    const real t1726 = t1624*t50;
+    const real t1727 = t1622*t67;
+    const real t1729 = t1617+t1722+t1723+t1724+t1725+t1726+t1727+t1627+t1628+t1630+t1631+
+t1632+t1633+t1640*t139;
+    const real t1731 = a[933];
+    const real t1732 = t1731*t5;
+    const real t1733 = t1569*t20;
+    const real t1457 = t1516*t77;
+    const real t1518 = t1590+t1612;
+    const real t1522 = t1659+t1677;
+    const real t1532 = t1690*t72;
+    const real t1534 = t1692*t73;
+    const real t1554 = t1732+t1568+t1733;
+    const real t1736 = (t1503+t1504+t1506+t1507+t1508+t1510+t1511+t1513+t1515+t1457)*t77+
+t1523*t126+t1537*t136+t1566*t275+t1572+t1518*t309+t1642*t155+t1522*t215+(t1681+
+t1682+t1684+t1685+t1686+t1688+t1689+t1532+t1534)*t73+t1720*t179+t1729*t139+
+t1554*t20;
+    const real t1737 = a[630];
+    const real t1738 = t1737*t20;
+    const real t1739 = a[922];
+    const real t1740 = t1739*t5;
+    const real t1741 = t1569*t26;
+    const real t1744 = a[1046];
+    const real t1745 = t1744*t5;
+    const real t1746 = a[282];
+    const real t1747 = t1744*t20;
+    const real t1748 = a[860];
+    const real t1749 = t1748*t26;
+    const real t1750 = t1748*t37;
+    const real t1751 = a[1059];
+    const real t1755 = t1594*t139;
+    const real t1756 = t1592*t145;
+    const real t1757 = a[1081];
+    const real t1758 = t1757*t143;
+    const real t1759 = t1610*t240;
+    const real t1760 = t1580+t1581+t1583+t1584+t1755+t1756+t1758+t1759+t1576+t1599+t1577+
+t1578;
+    const real t1761 = a[893];
+    const real t1762 = t1761*t309;
+    const real t1763 = t1594*t146;
+    const real t1764 = t1592*t155;
+    const real t1765 = t1606*t212;
+    const real t1766 = t1604*t215;
+    const real t1767 = t1585*t126;
+    const real t1768 = t1585*t136;
+    const real t1769 = t1587*t132;
+    const real t1770 = t1587*t77;
+    const real t1771 = t1600*t254;
+    const real t1772 = t1602*t275;
+    const real t1773 = t1762+t1763+t1764+t1765+t1766+t1575+t1767+t1768+t1769+t1770+t1771+
+t1772+t1573;
+    const real t1780 = a[1132];
+    const real t1783 = t1539+t1541+t1542+t1543+t1544+t1546+t1547+t1549+t1550+t1553*t77+
+t1551*t126+t1553*t132+t1551*t136+t1558+t1559+t1560+t1561+t1563+t1780*t275+t1564
+*t254;
+    const real t1787 = t1617+t1722+t1723+t1724+t1725+t1726+t1727+t1627+t1628+t1630+t1631+
+t1632+t1633+t1638*t139+t1640*t145;
+    const real t1792 = t1525+t1526+t1504+t1527+t1528+t1510+t1511+t1529+t1530+t1533*t77+
+t1531*t126+t1516*t132;
+    const real t1800 = t1658+t1660+t1661+t1664*t139+t1662*t145+t1664*t146+t1662*t155+t1669
++t1671+t1672+t1675*t212;
+    const real t1803 = t1748*t5;
+    const real t1804 = t1748*t20;
+    const real t1805 = t1744*t26;
+    const real t1806 = t1744*t37;
+    const real t1807 = a[943];
+    const real t1812 = t1683*t5;
+    const real t1813 = t1680*t20;
+    const real t1814 = t1683*t26;
+    const real t1815 = t1680*t37;
+    const real t1819 = t1610*t475;
+    const real t1820 = t1761*t143;
+    const real t1823 = t1580+t1581+t1583+t1584+t1819+t1820+t1576+t1599+t1577+t1578+t1608*
+t240+t1757*t309+t1593;
+    const real t1824 = t1595+t1596+t1597+t1605+t1607+t1575+t1767+t1768+t1769+t1770+t1771+
+t1772+t1573;
+    const real t1829 = t1737*t5;
+    const real t1830 = t1569*t37;
+    const real t1833 = t1573+t1575+t1576+t1577+t1578+t1580+t1581+t1583+t1584+t1586+t1588;
+    const real t1834 = t1610*t143;
+    const real t1835 = t1589+t1591+t1755+t1756+t1763+t1764+t1599+t1601+t1603+t1765+t1766+
+t1834;
+    const real t1841 = t1616+t1617+t1618+t1620+t1621+t1623+t1625+t1627+t1628+t1630+t1631+
+t1632+t1633+t1636*t139+t1634*t145+t1640*t146;
+    const real t1691 = t1751*t50;
+    const real t1695 = t1760+t1773;
+    const real t1709 = t1644+t1646+t1647+t1648+t1649+t1651+t1652+t1654+t1655+t1657+t1800;
+    const real t1711 = t1807*t50;
+    const real t1712 = t1751*t67;
+    const real t1716 = t1692*t72;
+    const real t1721 = t1823+t1824;
+    const real t1735 = t1739*t20+t1568+t1731*t26+t1829+t1830;
+    const real t1743 = t1833+t1835;
+    const real t1843 = (t1738+t1740+t1568+t1741)*t26+(t1745+t1746+t1747+t1749+t1750+t1691)
+*t50+t1695*t240+t1783*t254+t1787*t145+t1792*t132+t1709*t212+(t1746+t1803+t1804+
+t1805+t1806+t1711+t1712)*t67+(t1812+t1682+t1813+t1814+t1815+t1688+t1689+t1716)*
+t72+t1721*t475+t1735*t37+t1743*t143+t1841*t146;
+    const real t1846 = a[16];
+    const real t1847 = a[184];
+    const real t1754 = t1847*t5;
+    const real t1850 = (t1846+t1754)*t5;
+    const real t1851 = t1425*t5;
+    const real t1852 = t1422*t20;
+    const real t1853 = t1425*t26;
+    const real t1854 = t1422*t37;
+    const real t1855 = t1434*t72;
+    const real t1856 = t1432*t73;
+    const real t1857 = a[393];
+    const real t1859 = a[89];
+    const real t1860 = t1859*t126;
+    const real t1862 = t1851+t1852+t1424+t1853+t1854+t1430+t1431+t1855+t1856+t1857*t77+
+t1860+t1436*t132;
+    const real t1864 = a[58];
+    const real t1865 = a[147];
+    const real t1866 = t1865*t20;
+    const real t1867 = a[388];
+    const real t1868 = t1867*t5;
+    const real t1869 = t1867*t26;
+    const real t1870 = t1865*t37;
+    const real t1871 = a[294];
+    const real t1872 = t1871*t50;
+    const real t1873 = t1871*t67;
+    const real t1874 = a[235];
+    const real t1777 = t1874*t72;
+    const real t1877 = (t1864+t1866+t1868+t1869+t1870+t1872+t1873+t1777)*t72;
+    const real t1878 = a[406];
+    const real t1879 = t1878*t20;
+    const real t1880 = a[229];
+    const real t1881 = t1880*t5;
+    const real t1882 = t1847*t26;
+    const real t1779 = t1879+t1846+t1881+t1882;
+    const real t1884 = t1779*t26;
+    const real t1885 = t1442*t5;
+    const real t1886 = t1440*t20;
+    const real t1887 = t1442*t26;
+    const real t1888 = t1440*t37;
+    const real t1889 = t1452*t72;
+    const real t1890 = t1450*t73;
+    const real t1891 = t1859*t77;
+    const real t1892 = a[549];
+    const real t1894 = t1454*t132;
+    const real t1896 = t1885+t1444+t1886+t1887+t1888+t1448+t1449+t1889+t1890+t1891+t1892*
+t126+t1894+t1456*t136;
+    const real t1898 = a[168];
+    const real t1899 = t1898*t5;
+    const real t1900 = a[23];
+    const real t1901 = t1898*t20;
+    const real t1902 = a[286];
+    const real t1903 = t1902*t26;
+    const real t1904 = t1902*t37;
+    const real t1905 = a[407];
+    const real t1906 = t1905*t50;
+    const real t1907 = a[142];
+    const real t1908 = t1907*t67;
+    const real t1909 = a[432];
+    const real t1910 = t1909*t72;
+    const real t1911 = t1909*t73;
+    const real t1912 = a[194];
+    const real t1913 = t1912*t77;
+    const real t1914 = a[157];
+    const real t1915 = t1914*t126;
+    const real t1916 = t1912*t132;
+    const real t1917 = t1914*t136;
+    const real t1918 = a[535];
+    const real t1919 = t1918*t139;
+    const real t1920 = a[489];
+    const real t1921 = t1920*t145;
+    const real t1922 = a[413];
+    const real t1923 = t1922*t146;
+    const real t1924 = t1899+t1900+t1901+t1903+t1904+t1906+t1908+t1910+t1911+t1913+t1915+
+t1916+t1917+t1919+t1921+t1923;
+    const real t1926 = a[207];
+    const real t1927 = t1926*t5;
+    const real t1928 = t1847*t20;
+    const real t1784 = t1846+t1927+t1928;
+    const real t1930 = t1784*t20;
+    const real t1931 = a[21];
+    const real t1932 = a[204];
+    const real t1933 = t1932*t5;
+    const real t1934 = t1932*t20;
+    const real t1935 = a[253];
+    const real t1936 = t1935*t26;
+    const real t1937 = t1935*t37;
+    const real t1938 = a[307];
+    const real t1785 = t1938*t50;
+    const real t1941 = (t1931+t1933+t1934+t1936+t1937+t1785)*t50;
+    const real t1942 = a[43];
+    const real t1943 = a[348];
+    const real t1944 = t1943*t5;
+    const real t1945 = t1943*t20;
+    const real t1946 = t1943*t26;
+    const real t1947 = t1943*t37;
+    const real t1948 = a[148];
+    const real t1949 = t1948*t50;
+    const real t1950 = t1948*t67;
+    const real t1951 = a[343];
+    const real t1952 = t1951*t72;
+    const real t1953 = t1951*t73;
+    const real t1954 = a[172];
+    const real t1955 = t1954*t77;
+    const real t1957 = a[336];
+    const real t1958 = t1957*t126;
+    const real t1959 = t1954*t132;
+    const real t1960 = t1957*t136;
+    const real t1961 = a[186];
+    const real t1962 = t1961*t139;
+    const real t1963 = a[305];
+    const real t1964 = t1963*t145;
+    const real t1965 = t1961*t146;
+    const real t1966 = t1963*t155;
+    const real t1788 = a[228];
+    const real t1968 = t1788*t179;
+    const real t1969 = a[159];
+    const real t1970 = t1969*t275;
+    const real t1971 = a[283];
+    const real t1972 = t1971*t254;
+    const real t1973 = a[182];
+    const real t1974 = t1973*t212;
+    const real t1975 = t1958+t1959+t1960+t1962+t1964+t1965+t1966+t1968+t1970+t1972+t1974;
+    const real t1978 = a[960];
+    const real t1979 = t1978*t5;
+    const real t1980 = a[891];
+    const real t1981 = t1980*t20;
+    const real t1982 = a[287];
+    const real t1983 = t1978*t26;
+    const real t1984 = t1980*t37;
+    const real t1985 = a[683];
+    const real t1986 = t1985*t50;
+    const real t1987 = t1985*t67;
+    const real t1988 = a[718];
+    const real t1989 = t1988*t72;
+    const real t1990 = a[678];
+    const real t1991 = t1990*t73;
+    const real t1992 = a[766];
+    const real t1994 = a[621];
+    const real t1995 = t1994*t126;
+    const real t1996 = a[652];
+    const real t1998 = t1979+t1981+t1982+t1983+t1984+t1986+t1987+t1989+t1991+t1992*t77+
+t1995+t1996*t132;
+    const real t2000 = a[721];
+    const real t2001 = t2000*t126;
+    const real t2002 = a[794];
+    const real t2003 = t2002*t132;
+    const real t2004 = t2000*t136;
+    const real t2005 = t2002*t77;
+    const real t2006 = a[659];
+    const real t2007 = t2006*t139;
+    const real t2008 = a[636];
+    const real t2009 = t2008*t72;
+    const real t2010 = a[624];
+    const real t2011 = t2010*t50;
+    const real t2012 = t2010*t67;
+    const real t2013 = t2006*t146;
+    const real t2014 = a[864];
+    const real t2015 = t2014*t155;
+    const real t2016 = a[711];
+    const real t2017 = t2016*t212;
+    const real t2018 = a[807];
+    const real t2019 = t2018*t215;
+    const real t2020 = t2001+t2003+t2004+t2005+t2007+t2009+t2011+t2012+t2013+t2015+t2017+
+t2019;
+    const real t2021 = a[868];
+    const real t2022 = t2021*t275;
+    const real t2023 = t2014*t145;
+    const real t2024 = a[131];
+    const real t2025 = t2008*t73;
+    const real t2026 = a[715];
+    const real t2027 = t2026*t5;
+    const real t2028 = t2026*t20;
+    const real t2029 = t2026*t26;
+    const real t2030 = t2026*t37;
+    const real t1791 = a[1121];
+    const real t2032 = t1791*t179;
+    const real t2033 = a[777];
+    const real t2034 = t2033*t143;
+    const real t2035 = a[677];
+    const real t2036 = t2035*t254;
+    const real t2037 = a[767];
+    const real t2038 = t2037*t309;
+    const real t2039 = a[719];
+    const real t2040 = t2039*t240;
+    const real t2041 = t2022+t2023+t2024+t2025+t2027+t2028+t2029+t2030+t2032+t2034+t2036+
+t2038+t2040;
+    const real t2044 = a[241];
+    const real t2045 = a[983];
+    const real t2046 = t2045*t5;
+    const real t2047 = a[932];
+    const real t2048 = t2047*t20;
+    const real t2049 = a[759];
+    const real t2050 = t2049*t26;
+    const real t1793 = t2044+t2046+t2048+t2050;
+    const real t2052 = t1793*t26;
+    const real t2053 = a[724];
+    const real t2054 = t2053*t5;
+    const real t2055 = a[554];
+    const real t2056 = t2053*t20;
+    const real t2057 = t2053*t26;
+    const real t2058 = t2053*t37;
+    const real t2059 = a[730];
+    const real t2060 = t2059*t50;
+    const real t2061 = t2059*t67;
+    const real t2062 = a[686];
+    const real t2063 = t2062*t72;
+    const real t2064 = t2062*t73;
+    const real t2065 = a[1089];
+    const real t2067 = a[1000];
+    const real t2071 = a[1031];
+    const real t2072 = t2071*t139;
+    const real t2073 = t2071*t145;
+    const real t2074 = t2071*t146;
+    const real t2075 = t2071*t155;
+    const real t1794 = a[1009];
+    const real t2077 = t1794*t179;
+    const real t2078 = a[1123];
+    const real t2079 = t2078*t275;
+    const real t2080 = a[704];
+    const real t2082 = t2054+t2055+t2056+t2057+t2058+t2060+t2061+t2063+t2064+t2065*t77+
+t2067*t126+t2065*t132+t2067*t136+t2072+t2073+t2074+t2075+t2077+t2079+t2080*t254
+;
+    const real t2084 = a[579];
+    const real t2085 = t2084*t5;
+    const real t2086 = a[270];
+    const real t2087 = t2084*t20;
+    const real t2088 = a[757];
+    const real t2089 = t2088*t26;
+    const real t2090 = t2088*t37;
+    const real t2091 = a[754];
+    const real t2092 = t2091*t50;
+    const real t2093 = a[699];
+    const real t2094 = t2093*t67;
+    const real t2095 = a[568];
+    const real t2096 = t2095*t72;
+    const real t2097 = t2095*t73;
+    const real t2098 = a[839];
+    const real t2099 = t2098*t77;
+    const real t2100 = a[583];
+    const real t2101 = t2100*t126;
+    const real t2102 = t2098*t132;
+    const real t2103 = t2100*t136;
+    const real t2104 = a[1115];
+    const real t2105 = t2104*t139;
+    const real t2106 = a[885];
+    const real t2107 = t2106*t145;
+    const real t2108 = t2085+t2086+t2087+t2089+t2090+t2092+t2094+t2096+t2097+t2099+t2101+
+t2102+t2103+t2105+t2107;
+    const real t2110 = a[181];
+    const real t2111 = a[613];
+    const real t2112 = t2111*t20;
+    const real t2113 = a[709];
+    const real t2114 = t2113*t5;
+    const real t2115 = t2113*t26;
+    const real t2116 = t2111*t37;
+    const real t2117 = a[679];
+    const real t2118 = t2117*t50;
+    const real t2119 = t2117*t67;
+    const real t2120 = a[765];
+    const real t2122 = a[901];
+    const real t1801 = t2120*t72;
+    const real t1802 = t2122*t73;
+    const real t2125 = (t2110+t2112+t2114+t2115+t2116+t2118+t2119+t1801+t1802)*t73;
+    const real t2126 = t2111*t5;
+    const real t2127 = t2113*t20;
+    const real t2128 = t2111*t26;
+    const real t2129 = t2113*t37;
+    const real t1809 = t2122*t72;
+    const real t2132 = (t2126+t2110+t2127+t2128+t2129+t2118+t2119+t1809)*t72;
+    const real t2133 = a[1035];
+    const real t2134 = t2133*t5;
+    const real t2135 = a[113];
+    const real t2136 = t2133*t20;
+    const real t2137 = t2133*t26;
+    const real t2138 = t2133*t37;
+    const real t2139 = a[865];
+    const real t2140 = t2139*t50;
+    const real t2141 = t2139*t67;
+    const real t2142 = a[830];
+    const real t2143 = t2142*t72;
+    const real t2144 = t2142*t73;
+    const real t2145 = a[992];
+    const real t2146 = t2145*t77;
+    const real t2147 = a[918];
+    const real t2148 = t2147*t126;
+    const real t2149 = t2134+t2135+t2136+t2137+t2138+t2140+t2141+t2143+t2144+t2146+t2148;
+    const real t2150 = t2145*t132;
+    const real t2151 = t2147*t136;
+    const real t2152 = a[661];
+    const real t2153 = t2152*t139;
+    const real t2154 = a[875];
+    const real t2155 = t2154*t145;
+    const real t2156 = t2152*t146;
+    const real t2157 = t2154*t155;
+    const real t1811 = a[819];
+    const real t2159 = t1811*t179;
+    const real t2160 = a[989];
+    const real t2161 = t2160*t275;
+    const real t2162 = a[899];
+    const real t2163 = t2162*t254;
+    const real t2164 = a[1128];
+    const real t2165 = t2164*t212;
+    const real t2166 = a[1143];
+    const real t2167 = t2166*t215;
+    const real t2168 = t2150+t2151+t2153+t2155+t2156+t2157+t2159+t2161+t2163+t2165+t2167;
+    const real t2172 = t2047*t5;
+    const real t2173 = a[1053];
+    const real t2175 = t2049*t37;
+    const real t1818 = t2045*t20+t2172+t2173*t26+t2044+t2175;
+    const real t2177 = t1818*t37;
+    const real t2178 = a[897];
+    const real t2179 = t2178*t5;
+    const real t2180 = a[127];
+    const real t2181 = t2178*t20;
+    const real t2182 = a[694];
+    const real t2183 = t2182*t26;
+    const real t2184 = t2182*t37;
+    const real t2185 = a[1003];
+    const real t1821 = t2185*t50;
+    const real t2188 = (t2179+t2180+t2181+t2183+t2184+t1821)*t50;
+    const real t2189 = a[435];
+    const real t2190 = a[1070];
+    const real t2191 = t2190*t5;
+    const real t2192 = t2190*t20;
+    const real t2193 = t2190*t26;
+    const real t2194 = t2190*t37;
+    const real t2195 = a[967];
+    const real t2196 = t2195*t50;
+    const real t2197 = t2195*t67;
+    const real t2198 = a[980];
+    const real t2199 = t2198*t72;
+    const real t2200 = t2198*t73;
+    const real t2201 = a[672];
+    const real t2203 = a[783];
+    const real t2207 = a[688];
+    const real t2208 = t2207*t139;
+    const real t2209 = t2207*t145;
+    const real t2210 = t2207*t146;
+    const real t2211 = t2207*t155;
+    const real t1825 = a[1129];
+    const real t2213 = t1825*t179;
+    const real t2214 = a[974];
+    const real t2216 = t2189+t2191+t2192+t2193+t2194+t2196+t2197+t2199+t2200+t2201*t77+
+t2203*t126+t2201*t132+t2203*t136+t2208+t2209+t2210+t2211+t2213+t2214*t275;
+    const real t2219 = t2154*t139;
+    const real t2220 = t2152*t145;
+    const real t2221 = t2154*t146;
+    const real t2222 = t2152*t155;
+    const real t2223 = t2166*t212;
+    const real t2224 = t2148+t2150+t2151+t2219+t2220+t2221+t2222+t2159+t2161+t2163+t2223;
+    const real t1837 = t2020+t2041;
+    const real t1842 = t2149+t2168;
+    const real t1848 = t2134+t2135+t2136+t2137+t2138+t2140+t2141+t2143+t2144+t2146+t2224;
+    const real t2227 = t1998*t132+t1837*t240+t2052+t2082*t254+t2108*t145+t2125+t2132+t1842
+*t215+t2177+t2188+t2216*t275+t1848*t212;
+    const real t2228 = t2182*t5;
+    const real t2229 = t2182*t20;
+    const real t2230 = t2178*t26;
+    const real t2231 = t2178*t37;
+    const real t2232 = a[1060];
+    const real t1858 = t2232*t50;
+    const real t1861 = t2185*t67;
+    const real t2236 = (t2228+t2180+t2229+t2230+t2231+t1858+t1861)*t67;
+    const real t2237 = t2088*t5;
+    const real t2238 = t2088*t20;
+    const real t2239 = t2084*t26;
+    const real t2240 = t2084*t37;
+    const real t2241 = t2093*t50;
+    const real t2242 = t2091*t67;
+    const real t2243 = a[560];
+    const real t2244 = t2243*t139;
+    const real t2245 = a[863];
+    const real t2246 = t2245*t145;
+    const real t2247 = t2106*t146;
+    const real t2248 = t2086+t2237+t2238+t2239+t2240+t2241+t2242+t2096+t2097+t2099+t2101+
+t2102+t2103+t2244+t2246+t2247;
+    const real t2250 = t2106*t139;
+    const real t2251 = t2085+t2086+t2087+t2089+t2090+t2092+t2094+t2096+t2097+t2099+t2101+
+t2102+t2103+t2250;
+    const real t2253 = t2039*t475;
+    const real t2254 = t2037*t143;
+    const real t2255 = t2001+t2003+t2004+t2005+t2009+t2011+t2012+t2022+t2024+t2025+t2253+
+t2254+t2027;
+    const real t2256 = a[1112];
+    const real t2258 = t2006*t155;
+    const real t2259 = t2016*t215;
+    const real t2260 = t2033*t309;
+    const real t2261 = t2014*t146;
+    const real t2262 = t2014*t139;
+    const real t2263 = t2018*t212;
+    const real t2264 = t2006*t145;
+    const real t2265 = t2028+t2029+t2030+t2032+t2036+t2256*t240+t2258+t2259+t2260+t2261+
+t2262+t2263+t2264;
+    const real t2268 = a[525];
+    const real t2269 = a[782];
+    const real t2270 = t2269*t5;
+    const real t2271 = t2269*t20;
+    const real t2272 = t2269*t26;
+    const real t2273 = t2269*t37;
+    const real t2274 = a[791];
+    const real t2275 = t2274*t50;
+    const real t2276 = t2274*t67;
+    const real t2277 = a[563];
+    const real t2278 = t2277*t72;
+    const real t2279 = t2277*t73;
+    const real t2280 = a[824];
+    const real t2281 = t2280*t77;
+    const real t2282 = a[744];
+    const real t2283 = t2282*t126;
+    const real t2284 = t2268+t2270+t2271+t2272+t2273+t2275+t2276+t2278+t2279+t2281+t2283;
+    const real t2285 = t2280*t132;
+    const real t2286 = t2282*t136;
+    const real t2287 = a[909];
+    const real t2288 = t2287*t139;
+    const real t2289 = a[618];
+    const real t2290 = t2289*t145;
+    const real t2291 = t2287*t146;
+    const real t2292 = t2289*t155;
+    const real t1876 = a[973];
+    const real t2294 = t1876*t179;
+    const real t2295 = a[758];
+    const real t2296 = t2295*t275;
+    const real t2297 = a[1091];
+    const real t2298 = t2297*t254;
+    const real t2299 = a[1075];
+    const real t2300 = t2299*t212;
+    const real t2301 = a[1008];
+    const real t2302 = t2301*t215;
+    const real t2303 = a[853];
+    const real t2304 = t2303*t143;
+    const real t2305 = t2285+t2286+t2288+t2290+t2291+t2292+t2294+t2296+t2298+t2300+t2302+
+t2304;
+    const real t2308 = a[558];
+    const real t2309 = a[939];
+    const real t2310 = t2309*t5;
+    const real t2311 = t2309*t20;
+    const real t2312 = t2309*t26;
+    const real t2313 = t2309*t37;
+    const real t2314 = a[808];
+    const real t2315 = t2314*t50;
+    const real t2316 = t2314*t67;
+    const real t2317 = a[1104];
+    const real t2318 = t2317*t72;
+    const real t2319 = t2317*t73;
+    const real t2320 = a[570];
+    const real t2322 = a[851];
+    const real t2326 = a[820];
+    const real t2327 = t2326*t139;
+    const real t2328 = t2326*t145;
+    const real t2329 = t2326*t146;
+    const real t2330 = t2326*t155;
+    const real t1883 = a[804];
+    const real t2332 = t1883*t179;
+    const real t2333 = t2308+t2310+t2311+t2312+t2313+t2315+t2316+t2318+t2319+t2320*t77+
+t2322*t126+t2320*t132+t2322*t136+t2327+t2328+t2329+t2330+t2332;
+    const real t2335 = t1980*t5;
+    const real t2336 = t1978*t20;
+    const real t2337 = t1980*t26;
+    const real t2338 = t1978*t37;
+    const real t2339 = t1990*t72;
+    const real t2340 = t1988*t73;
+    const real t2344 = t2268+t2270+t2271+t2272+t2273+t2275+t2276+t2278+t2279+t2281+t2283+
+t2285;
+    const real t2345 = t2289*t139;
+    const real t2346 = t2287*t145;
+    const real t2347 = t2289*t146;
+    const real t2348 = t2287*t155;
+    const real t2349 = t2301*t212;
+    const real t2350 = t2299*t215;
+    const real t2351 = a[1090];
+    const real t2352 = t2351*t143;
+    const real t2353 = t2303*t309;
+    const real t2354 = t2286+t2345+t2346+t2347+t2348+t2294+t2296+t2298+t2349+t2350+t2352+
+t2353;
+    const real t2357 = a[858];
+    const real t2358 = t2357*t20;
+    const real t2359 = a[272];
+    const real t2360 = a[650];
+    const real t2361 = t2360*t5;
+    const real t2362 = t2360*t26;
+    const real t2363 = t2357*t37;
+    const real t2364 = a[707];
+    const real t2365 = t2364*t50;
+    const real t2366 = t2364*t67;
+    const real t2367 = a[846];
+    const real t2368 = t2367*t72;
+    const real t2369 = a[1086];
+    const real t2370 = t2369*t73;
+    const real t2371 = t1994*t77;
+    const real t2372 = a[914];
+    const real t2374 = a[854];
+    const real t2375 = t2374*t132;
+    const real t2376 = a[632];
+    const real t2378 = t2358+t2359+t2361+t2362+t2363+t2365+t2366+t2368+t2370+t2371+t2372*
+t126+t2375+t2376*t136;
+    const real t2380 = t2245*t139;
+    const real t2381 = t2243*t145;
+    const real t2382 = t2104*t146;
+    const real t2383 = t2106*t155;
+    const real t2384 = t2086+t2237+t2238+t2239+t2240+t2241+t2242+t2096+t2097+t2099+t2101+
+t2102+t2103+t2380+t2381+t2382+t2383;
+    const real t1940 = t2049*t5;
+    const real t2388 = (t2044+t1940)*t5;
+    const real t2389 = t2360*t20;
+    const real t2390 = t2357*t5;
+    const real t2391 = t2357*t26;
+    const real t2392 = t2360*t37;
+    const real t2393 = t2369*t72;
+    const real t2394 = t2367*t73;
+    const real t2395 = t2374*t77;
+    const real t2397 = t2389+t2390+t2359+t2391+t2392+t2365+t2366+t2393+t2394+t2395+t2376*
+t126;
+    const real t2399 = t2173*t5;
+    const real t2400 = t2049*t20;
+    const real t1976 = t2044+t2399+t2400;
+    const real t2402 = t1976*t20;
+    const real t1997 = t2255+t2265;
+    const real t2031 = t2284+t2305;
+    const real t2051 = t1996*t77;
+    const real t2069 = t2344+t2354;
+    const real t2403 = t2236+t2248*t146+t2251*t139+t1997*t475+t2031*t143+t2333*t179+(t2335
++t2336+t1982+t2337+t2338+t1986+t1987+t2339+t2340+t2051)*t77+t2069*t309+t2378*
+t136+t2384*t155+t2388+t2397*t126+t2402;
+    const real t2109 = t1436*t77;
+    const real t2130 = t1477+t1499;
+    const real t2158 = t1736+t1843;
+    const real t2176 = t1942+t1944+t1945+t1946+t1947+t1949+t1950+t1952+t1953+t1955+t1975;
+    const real t2341 = x[2];
+    const real t2202 = (t2227+t2403)*t2341;
+    const real t2404 = x[3];
+    const real t2406 = (t1423+t1424+t1426+t1427+t1428+t1430+t1431+t1433+t1435+t2109)*t77+
+t1458*t126+t2130*t309+t2158*t2404+t1850+t1862*t132+t1877+t1884+t1896*t136+t1924
+*t146+t1930+t1941+t2176*t212+t2202;
+    const real t2407 = t1902*t5;
+    const real t2408 = t1902*t20;
+    const real t2409 = t1898*t26;
+    const real t2410 = t1898*t37;
+    const real t2411 = t1907*t50;
+    const real t2412 = t1905*t67;
+    const real t2413 = t1922*t139;
+    const real t2414 = t1900+t2407+t2408+t2409+t2410+t2411+t2412+t1910+t1911+t1913+t1915+
+t1916+t1917+t2413;
+    const real t2416 = t1920*t139;
+    const real t2417 = t1918*t145;
+    const real t2418 = a[373];
+    const real t2419 = t2418*t146;
+    const real t2420 = t1922*t155;
+    const real t2421 = t1899+t1900+t1901+t1903+t1904+t1906+t1908+t1910+t1911+t1913+t1915+
+t1916+t1917+t2416+t2417+t2419+t2420;
+    const real t2423 = t1460+t1462+t1463+t1464+t1465+t1467+t1468+t1470+t1471+t1473+t1475;
+    const real t2424 = t1481*t139;
+    const real t2425 = t1479*t145;
+    const real t2426 = t1481*t146;
+    const real t2427 = t1479*t155;
+    const real t2428 = t1493*t212;
+    const real t2429 = t1491*t215;
+    const real t2430 = t1497*t143;
+    const real t2431 = t1476+t1478+t2424+t2425+t2426+t2427+t1486+t1488+t1490+t2428+t2429+
+t2430;
+    const real t2434 = a[76];
+    const real t2435 = t2434*t5;
+    const real t2436 = a[62];
+    const real t2437 = t2434*t20;
+    const real t2438 = t2434*t26;
+    const real t2439 = t2434*t37;
+    const real t2440 = a[240];
+    const real t2441 = t2440*t50;
+    const real t2442 = t2440*t67;
+    const real t2443 = a[349];
+    const real t2444 = t2443*t72;
+    const real t2445 = t2443*t73;
+    const real t2446 = a[543];
+    const real t2448 = a[118];
+    const real t2452 = a[351];
+    const real t2453 = t2452*t139;
+    const real t2454 = t2452*t145;
+    const real t2455 = t2452*t146;
+    const real t2456 = t2452*t155;
+    const real t2204 = a[546];
+    const real t2458 = t2204*t179;
+    const real t2459 = t2435+t2436+t2437+t2438+t2439+t2441+t2442+t2444+t2445+t2446*t77+
+t2448*t126+t2446*t132+t2448*t136+t2453+t2454+t2455+t2456+t2458;
+    const real t2461 = t2418*t139;
+    const real t2462 = t1922*t145;
+    const real t2463 = t1900+t2407+t2408+t2409+t2410+t2411+t2412+t1910+t1911+t1913+t1915+
+t1916+t1917+t2461+t2462;
+    const real t2465 = t1942+t1944+t1945+t1946+t1947+t1949+t1950+t1952+t1953+t1955+t1958;
+    const real t2466 = t1963*t139;
+    const real t2467 = t1961*t145;
+    const real t2468 = t1963*t146;
+    const real t2469 = t1961*t155;
+    const real t2470 = a[341];
+    const real t2471 = t2470*t212;
+    const real t2472 = t1973*t215;
+    const real t2473 = t1959+t1960+t2466+t2467+t2468+t2469+t1968+t1970+t1972+t2471+t2472;
+    const real t2476 = a[115];
+    const real t2477 = t2476*t77;
+    const real t2478 = a[405];
+    const real t2479 = t2478*t146;
+    const real t2480 = a[440];
+    const real t2481 = t2480*t309;
+    const real t2482 = t2478*t139;
+    const real t2483 = a[224];
+    const real t2484 = t2483*t145;
+    const real t2485 = a[463];
+    const real t2486 = t2485*t72;
+    const real t2487 = a[291];
+    const real t2488 = t2487*t67;
+    const real t2489 = t2487*t50;
+    const real t2490 = a[532];
+    const real t2491 = t2490*t240;
+    const real t2492 = t2485*t73;
+    const real t2493 = a[263];
+    const real t2494 = t2493*t126;
+    const real t2495 = t2483*t155;
+    const real t2496 = t2477+t2479+t2481+t2482+t2484+t2486+t2488+t2489+t2491+t2492+t2494+
+t2495;
+    const real t2497 = a[72];
+    const real t2498 = t2497*t275;
+    const real t2499 = a[134];
+    const real t2500 = t2499*t254;
+    const real t2501 = t2476*t132;
+    const real t2502 = t2493*t136;
+    const real t2503 = a[398];
+    const real t2504 = t2503*t212;
+    const real t2505 = a[374];
+    const real t2506 = t2505*t215;
+    const real t2507 = a[12];
+    const real t2508 = a[370];
+    const real t2509 = t2508*t5;
+    const real t2510 = t2508*t20;
+    const real t2511 = t2508*t26;
+    const real t2512 = t2508*t37;
+    const real t2217 = a[91];
+    const real t2514 = t2217*t179;
+    const real t2515 = a[319];
+    const real t2516 = t2515*t143;
+    const real t2517 = t2498+t2500+t2501+t2502+t2504+t2506+t2507+t2509+t2510+t2511+t2512+
+t2514+t2516;
+    const real t2521 = t1878*t5;
+    const real t2523 = t1847*t37;
+    const real t2226 = t1846+t1926*t26+t2521+t1880*t20+t2523;
+    const real t2525 = t2226*t37;
+    const real t2526 = t1867*t20;
+    const real t2527 = t1865*t5;
+    const real t2528 = t1865*t26;
+    const real t2529 = t1867*t37;
+    const real t2530 = a[347];
+    const real t2233 = t2530*t72;
+    const real t2234 = t1874*t73;
+    const real t2534 = (t1864+t2526+t2527+t2528+t2529+t1872+t1873+t2233+t2234)*t73;
+    const real t2535 = a[24];
+    const real t2536 = a[510];
+    const real t2537 = t2536*t5;
+    const real t2538 = t2536*t20;
+    const real t2539 = t2536*t26;
+    const real t2540 = t2536*t37;
+    const real t2541 = a[414];
+    const real t2542 = t2541*t50;
+    const real t2543 = t2541*t67;
+    const real t2544 = a[71];
+    const real t2545 = t2544*t72;
+    const real t2546 = t2544*t73;
+    const real t2547 = a[321];
+    const real t2549 = a[495];
+    const real t2553 = a[404];
+    const real t2554 = t2553*t139;
+    const real t2555 = t2553*t145;
+    const real t2556 = t2553*t146;
+    const real t2557 = t2553*t155;
+    const real t2249 = a[383];
+    const real t2559 = t2249*t179;
+    const real t2560 = a[446];
+    const real t2561 = t2560*t275;
+    const real t2562 = a[527];
+    const real t2564 = t2535+t2537+t2538+t2539+t2540+t2542+t2543+t2545+t2546+t2547*t77+
+t2549*t126+t2547*t132+t2549*t136+t2554+t2555+t2556+t2557+t2559+t2561+t2562*t254
+;
+    const real t2566 = a[748];
+    const real t2567 = t2566*t5;
+    const real t2568 = a[245];
+    const real t2569 = t2566*t20;
+    const real t2570 = t2566*t26;
+    const real t2571 = t2566*t37;
+    const real t2572 = a[1124];
+    const real t2573 = t2572*t50;
+    const real t2574 = t2572*t67;
+    const real t2575 = a[816];
+    const real t2576 = t2575*t72;
+    const real t2577 = t2575*t73;
+    const real t2578 = a[988];
+    const real t2579 = t2578*t77;
+    const real t2581 = a[790];
+    const real t2582 = t2581*t126;
+    const real t2583 = t2578*t132;
+    const real t2584 = t2581*t136;
+    const real t2585 = a[778];
+    const real t2586 = t2585*t139;
+    const real t2587 = a[895];
+    const real t2588 = t2587*t145;
+    const real t2589 = t2585*t146;
+    const real t2590 = t2587*t155;
+    const real t2306 = a[1144];
+    const real t2592 = t2306*t179;
+    const real t2593 = a[1083];
+    const real t2594 = t2593*t275;
+    const real t2595 = a[569];
+    const real t2596 = t2595*t254;
+    const real t2597 = a[1097];
+    const real t2598 = t2597*t212;
+    const real t2599 = t2582+t2583+t2584+t2586+t2588+t2589+t2590+t2592+t2594+t2596+t2598;
+    const real t2602 = a[329];
+    const real t2603 = a[592];
+    const real t2604 = t2603*t5;
+    const real t2605 = t2603*t20;
+    const real t2606 = a[798];
+    const real t2607 = t2606*t26;
+    const real t2608 = t2606*t37;
+    const real t2609 = a[669];
+    const real t2307 = t2609*t50;
+    const real t2612 = (t2602+t2604+t2605+t2607+t2608+t2307)*t50;
+    const real t2613 = t2606*t5;
+    const real t2614 = t2606*t20;
+    const real t2615 = t2603*t26;
+    const real t2616 = t2603*t37;
+    const real t2617 = a[1065];
+    const real t2323 = t2617*t50;
+    const real t2324 = t2609*t67;
+    const real t2621 = (t2602+t2613+t2614+t2615+t2616+t2323+t2324)*t67;
+    const real t2622 = a[178];
+    const real t2623 = a[634];
+    const real t2624 = t2623*t5;
+    const real t2625 = t2623*t20;
+    const real t2626 = a[633];
+    const real t2627 = t2626*t26;
+    const real t2628 = t2626*t37;
+    const real t2629 = a[835];
+    const real t2630 = t2629*t50;
+    const real t2631 = a[680];
+    const real t2632 = t2631*t67;
+    const real t2633 = a[812];
+    const real t2634 = t2633*t72;
+    const real t2635 = t2633*t73;
+    const real t2636 = a[1011];
+    const real t2637 = t2636*t77;
+    const real t2638 = a[871];
+    const real t2639 = t2638*t126;
+    const real t2640 = t2636*t132;
+    const real t2641 = t2638*t136;
+    const real t2642 = a[962];
+    const real t2643 = t2642*t139;
+    const real t2644 = a[645];
+    const real t2645 = t2644*t145;
+    const real t2646 = a[995];
+    const real t2647 = t2646*t146;
+    const real t2648 = t2622+t2624+t2625+t2627+t2628+t2630+t2632+t2634+t2635+t2637+t2639+
+t2640+t2641+t2643+t2645+t2647;
+    const real t2650 = a[587];
+    const real t2651 = t2650*t5;
+    const real t2652 = a[785];
+    const real t2653 = t2652*t20;
+    const real t2654 = a[326];
+    const real t2655 = t2650*t26;
+    const real t2656 = t2652*t37;
+    const real t2657 = a[657];
+    const real t2658 = t2657*t50;
+    const real t2659 = t2657*t67;
+    const real t2660 = a[740];
+    const real t2661 = t2660*t72;
+    const real t2662 = a[616];
+    const real t2663 = t2662*t73;
+    const real t2664 = t2644*t77;
+    const real t2665 = a[1134];
+    const real t2667 = a[902];
+    const real t2668 = t2667*t132;
+    const real t2669 = a[612];
+    const real t2671 = t2651+t2653+t2654+t2655+t2656+t2658+t2659+t2661+t2663+t2664+t2665*
+t126+t2668+t2669*t136;
+    const real t2672 = t2671*t136;
+    const real t2673 = t2652*t5;
+    const real t2674 = t2650*t20;
+    const real t2675 = t2652*t26;
+    const real t2676 = t2650*t37;
+    const real t2677 = t2662*t72;
+    const real t2678 = t2660*t73;
+    const real t2679 = t2667*t77;
+    const real t2681 = t2654+t2673+t2674+t2675+t2676+t2658+t2659+t2677+t2678+t2679+t2669*
+t126;
+    const real t2682 = t2681*t126;
+    const real t2683 = a[97];
+    const real t2684 = a[596];
+    const real t2685 = t2684*t5;
+    const real t2686 = t2684*t20;
+    const real t2687 = t2684*t26;
+    const real t2688 = t2684*t37;
+    const real t2689 = a[720];
+    const real t2690 = t2689*t50;
+    const real t2691 = t2689*t67;
+    const real t2692 = a[702];
+    const real t2693 = t2692*t72;
+    const real t2694 = t2692*t73;
+    const real t2695 = a[961];
+    const real t2696 = t2695*t77;
+    const real t2697 = a[641];
+    const real t2698 = t2697*t126;
+    const real t2699 = t2695*t132;
+    const real t2700 = t2683+t2685+t2686+t2687+t2688+t2690+t2691+t2693+t2694+t2696+t2698+
+t2699;
+    const real t2701 = t2697*t136;
+    const real t2702 = a[605];
+    const real t2703 = t2702*t139;
+    const real t2704 = a[676];
+    const real t2705 = t2704*t145;
+    const real t2706 = t2702*t146;
+    const real t2707 = t2704*t155;
+    const real t2342 = a[1030];
+    const real t2709 = t2342*t179;
+    const real t2710 = a[1107];
+    const real t2711 = t2710*t275;
+    const real t2712 = a[979];
+    const real t2713 = t2712*t254;
+    const real t2714 = a[969];
+    const real t2715 = t2714*t212;
+    const real t2716 = a[1016];
+    const real t2717 = t2716*t215;
+    const real t2718 = a[584];
+    const real t2719 = t2718*t143;
+    const real t2720 = a[916];
+    const real t2721 = t2720*t309;
+    const real t2722 = t2701+t2703+t2705+t2706+t2707+t2709+t2711+t2713+t2715+t2717+t2719+
+t2721;
+    const real t2725 = a[381];
+    const real t2726 = a[934];
+    const real t2727 = t2726*t5;
+    const real t2728 = t2726*t20;
+    const real t2729 = t2726*t26;
+    const real t2730 = t2726*t37;
+    const real t2731 = a[831];
+    const real t2732 = t2731*t50;
+    const real t2733 = t2731*t67;
+    const real t2734 = t2731*t72;
+    const real t2735 = t2731*t73;
+    const real t2736 = a[862];
+    const real t2737 = t2736*t77;
+    const real t2738 = a[700];
+    const real t2739 = t2738*t126;
+    const real t2740 = t2725+t2727+t2728+t2729+t2730+t2732+t2733+t2734+t2735+t2737+t2739;
+    const real t2741 = t2736*t132;
+    const real t2742 = t2738*t136;
+    const real t2743 = t2736*t139;
+    const real t2744 = t2738*t145;
+    const real t2745 = t2736*t146;
+    const real t2746 = t2738*t155;
+    const real t2343 = a[727];
+    const real t2748 = t2343*t179;
+    const real t2749 = a[880];
+    const real t2750 = t2749*t275;
+    const real t2751 = a[1019];
+    const real t2752 = t2751*t254;
+    const real t2753 = t2749*t212;
+    const real t2754 = t2751*t215;
+    const real t2755 = a[1055];
+    const real t2757 = t2741+t2742+t2743+t2744+t2745+t2746+t2748+t2750+t2752+t2753+t2754+
+t2755*t143;
+    const real t2760 = a[597];
+    const real t2761 = t2760*t50;
+    const real t2762 = t2760*t67;
+    const real t2356 = t2609*t72;
+    const real t2765 = (t2602+t2604+t2614+t2615+t2608+t2761+t2762+t2356)*t72;
+    const real t2766 = t2660*t50;
+    const real t2767 = t2662*t67;
+    const real t2768 = t2657*t72;
+    const real t2769 = t2657*t73;
+    const real t2770 = t2638*t77;
+    const real t2771 = a[787];
+    const real t2772 = t2771*t126;
+    const real t2773 = t2638*t132;
+    const real t2774 = t2771*t136;
+    const real t2775 = t2644*t139;
+    const real t2776 = t2665*t145;
+    const real t2777 = t2667*t146;
+    const real t2778 = t2669*t155;
+    const real t2779 = t2651+t2654+t2674+t2675+t2656+t2766+t2767+t2768+t2769+t2770+t2772+
+t2773+t2774+t2775+t2776+t2777+t2778;
+    const real t2781 = a[552];
+    const real t2782 = a[874];
+    const real t2783 = t2782*t5;
+    const real t2784 = t2782*t20;
+    const real t2785 = a[951];
+    const real t2786 = t2785*t309;
+    const real t2787 = a[573];
+    const real t2788 = t2787*t143;
+    const real t2789 = t2785*t240;
+    const real t2790 = a[747];
+    const real t2791 = t2790*t50;
+    const real t2792 = a[671];
+    const real t2793 = t2792*t254;
+    const real t2794 = a[628];
+    const real t2795 = t2794*t126;
+    const real t2796 = a[946];
+    const real t2797 = t2796*t132;
+    const real t2798 = t2794*t136;
+    const real t2799 = a[687];
+    const real t2800 = t2799*t275;
+    const real t2377 = a[1079];
+    const real t2802 = t2377*t179;
+    const real t2803 = t2781+t2783+t2784+t2786+t2788+t2789+t2791+t2793+t2795+t2797+t2798+
+t2800+t2802;
+    const real t2804 = t2782*t26;
+    const real t2805 = t2782*t37;
+    const real t2806 = t2790*t67;
+    const real t2807 = t2790*t72;
+    const real t2808 = t2790*t73;
+    const real t2809 = t2796*t139;
+    const real t2810 = t2794*t145;
+    const real t2811 = t2796*t146;
+    const real t2812 = t2794*t155;
+    const real t2813 = t2799*t212;
+    const real t2814 = t2792*t215;
+    const real t2815 = a[642];
+    const real t2817 = t2796*t77;
+    const real t2818 = t2804+t2805+t2806+t2807+t2808+t2809+t2810+t2811+t2812+t2813+t2814+
+t2815*t475+t2817;
+    const real t2821 = a[924];
+    const real t2823 = a[231];
+    const real t2824 = a[617];
+    const real t2827 = a[823];
+    const real t2385 = t2821*t20;
+    const real t2386 = t2824*t5;
+    const real t2387 = t2821*t26;
+    const real t2396 = t2827*t37;
+    const real t2830 = (t2385+t2823+t2386+t2387+t2396)*t37;
+    const real t2401 = t2567+t2568+t2569+t2570+t2571+t2573+t2574+t2576+t2577+t2579+t2599;
+    const real t2415 = t2700+t2722;
+    const real t2432 = t2740+t2757;
+    const real t2449 = t2803+t2818;
+    const real t2831 = t2401*t212+t2612+t2621+t2648*t146+t2672+t2682+t2415*t309+t2432*t143
++t2765+t2779*t155+t2449*t475+t2830;
+    const real t2832 = t2821*t5;
+    const real t2451 = t2827*t20;
+    const real t2835 = (t2832+t2823+t2451)*t20;
+    const real t2460 = t2617*t72;
+    const real t2464 = t2609*t73;
+    const real t2839 = (t2605+t2613+t2602+t2607+t2616+t2761+t2762+t2460+t2464)*t73;
+    const real t2475 = t2824*t20;
+    const real t2513 = t2827*t26;
+    const real t2843 = (t2475+t2832+t2823+t2513)*t26;
+    const real t2844 = t2626*t5;
+    const real t2845 = t2626*t20;
+    const real t2846 = t2623*t26;
+    const real t2847 = t2623*t37;
+    const real t2848 = t2631*t50;
+    const real t2849 = t2629*t67;
+    const real t2850 = t2646*t139;
+    const real t2851 = t2622+t2844+t2845+t2846+t2847+t2848+t2849+t2634+t2635+t2637+t2639+
+t2640+t2641+t2850;
+    const real t2853 = a[930];
+    const real t2854 = t2853*t5;
+    const real t2855 = a[365];
+    const real t2856 = t2853*t20;
+    const real t2857 = t2853*t26;
+    const real t2858 = t2853*t37;
+    const real t2859 = a[872];
+    const real t2860 = t2859*t50;
+    const real t2861 = t2859*t67;
+    const real t2862 = a[889];
+    const real t2863 = t2862*t72;
+    const real t2864 = t2862*t73;
+    const real t2865 = a[982];
+    const real t2866 = t2865*t77;
+    const real t2867 = a[577];
+    const real t2868 = t2867*t126;
+    const real t2869 = t2865*t132;
+    const real t2870 = t2867*t136;
+    const real t2871 = a[653];
+    const real t2872 = t2871*t139;
+    const real t2873 = a[1029];
+    const real t2874 = t2873*t145;
+    const real t2875 = t2871*t146;
+    const real t2876 = t2873*t155;
+    const real t2519 = a[734];
+    const real t2878 = t2519*t179;
+    const real t2879 = a[1071];
+    const real t2880 = t2879*t275;
+    const real t2881 = a[991];
+    const real t2882 = t2881*t254;
+    const real t2883 = t2854+t2855+t2856+t2857+t2858+t2860+t2861+t2863+t2864+t2866+t2868+
+t2869+t2870+t2872+t2874+t2875+t2876+t2878+t2880+t2882;
+    const real t2885 = t2692*t67;
+    const real t2886 = t2689*t73;
+    const real t2887 = t2695*t146;
+    const real t2888 = t2712*t215;
+    const real t2889 = t2710*t212;
+    const real t2890 = t2697*t145;
+    const real t2891 = a[936];
+    const real t2892 = t2891*t309;
+    const real t2893 = t2720*t240;
+    const real t2894 = t2695*t139;
+    const real t2895 = t2697*t155;
+    const real t2896 = t2885+t2886+t2887+t2888+t2889+t2890+t2892+t2893+t2894+t2895+t2683+
+t2685;
+    const real t2897 = t2702*t77;
+    const real t2898 = t2714*t275;
+    const real t2899 = t2716*t254;
+    const real t2900 = t2702*t132;
+    const real t2901 = t2704*t136;
+    const real t2902 = t2704*t126;
+    const real t2903 = t2689*t72;
+    const real t2904 = t2692*t50;
+    const real t2905 = t2686+t2687+t2688+t2709+t2897+t2898+t2899+t2900+t2901+t2902+t2903+
+t2904+t2719;
+    const real t2908 = a[999];
+    const real t2909 = t2908*t5;
+    const real t2910 = a[395];
+    const real t2911 = t2908*t20;
+    const real t2912 = t2908*t26;
+    const real t2913 = t2908*t37;
+    const real t2914 = a[908];
+    const real t2915 = t2914*t50;
+    const real t2916 = t2914*t67;
+    const real t2917 = t2914*t72;
+    const real t2918 = t2914*t73;
+    const real t2919 = a[834];
+    const real t2920 = t2919*t77;
+    const real t2921 = a[562];
+    const real t2922 = t2921*t126;
+    const real t2923 = t2919*t132;
+    const real t2924 = t2921*t136;
+    const real t2925 = t2919*t139;
+    const real t2926 = t2921*t145;
+    const real t2927 = t2919*t146;
+    const real t2928 = t2921*t155;
+    const real t2520 = a[615];
+    const real t2930 = t2520*t179;
+    const real t2931 = t2909+t2910+t2911+t2912+t2913+t2915+t2916+t2917+t2918+t2920+t2922+
+t2923+t2924+t2925+t2926+t2927+t2928+t2930;
+    const real t2933 = t2633*t50;
+    const real t2934 = t2633*t67;
+    const real t2935 = t2629*t72;
+    const real t2936 = t2631*t73;
+    const real t2938 = t2644*t126;
+    const real t2940 = t2622+t2845+t2624+t2846+t2628+t2933+t2934+t2935+t2936+t2642*t77+
+t2938+t2646*t132;
+    const real t2941 = t2940*t132;
+    const real t2942 = t2631*t72;
+    const real t2943 = t2629*t73;
+    const real t2531 = t2646*t77;
+    const real t2946 = (t2622+t2844+t2625+t2627+t2847+t2933+t2934+t2942+t2943+t2531)*t77;
+    const real t2947 = t2662*t50;
+    const real t2948 = t2660*t67;
+    const real t2949 = t2667*t139;
+    const real t2950 = t2669*t145;
+    const real t2951 = t2654+t2673+t2653+t2655+t2676+t2947+t2948+t2768+t2769+t2770+t2772+
+t2773+t2774+t2949+t2950;
+    const real t2953 = t2862*t50;
+    const real t2954 = t2862*t67;
+    const real t2955 = t2859*t72;
+    const real t2956 = t2859*t73;
+    const real t2957 = t2871*t77;
+    const real t2958 = t2873*t126;
+    const real t2959 = t2854+t2855+t2856+t2857+t2858+t2953+t2954+t2955+t2956+t2957+t2958;
+    const real t2960 = t2871*t132;
+    const real t2961 = t2873*t136;
+    const real t2962 = t2865*t139;
+    const real t2963 = t2867*t145;
+    const real t2964 = t2865*t146;
+    const real t2965 = t2867*t155;
+    const real t2966 = t2595*t275;
+    const real t2967 = a[1111];
+    const real t2968 = t2967*t254;
+    const real t2969 = t2879*t212;
+    const real t2970 = t2881*t215;
+    const real t2971 = t2960+t2961+t2962+t2963+t2964+t2965+t2878+t2966+t2968+t2969+t2970;
+    const real t2533 = t2827*t5;
+    const real t2976 = (t2823+t2533)*t5;
+    const real t2977 = t2575*t50;
+    const real t2978 = t2575*t67;
+    const real t2979 = t2572*t72;
+    const real t2980 = t2572*t73;
+    const real t2981 = t2585*t77;
+    const real t2982 = t2587*t126;
+    const real t2983 = t2585*t132;
+    const real t2984 = t2587*t136;
+    const real t2985 = t2578*t139;
+    const real t2986 = t2581*t145;
+    const real t2987 = t2578*t146;
+    const real t2988 = t2581*t155;
+    const real t2989 = t2597*t275;
+    const real t2990 = t2567+t2568+t2569+t2570+t2571+t2977+t2978+t2979+t2980+t2981+t2982+
+t2983+t2984+t2985+t2986+t2987+t2988+t2592+t2989;
+    const real t2552 = t2896+t2905;
+    const real t2580 = t2959+t2971;
+    const real t2992 = t2835+t2839+t2843+t2851*t139+t2883*t254+t2552*t240+t2931*t179+t2941
++t2946+t2951*t145+t2580*t215+t2976+t2990*t275;
+    const real t2995 = t1935*t5;
+    const real t2996 = t1935*t20;
+    const real t2997 = t1932*t26;
+    const real t2998 = t1932*t37;
+    const real t2999 = a[539];
+    const real t2601 = t2999*t50;
+    const real t2610 = t1938*t67;
+    const real t3003 = (t1931+t2995+t2996+t2997+t2998+t2601+t2610)*t67;
+    const real t3004 = t2490*t475;
+    const real t3005 = t2480*t143;
+    const real t3006 = t2505*t212;
+    const real t3007 = t2503*t215;
+    const real t3008 = t2515*t309;
+    const real t3009 = a[523];
+    const real t3011 = t2483*t139;
+    const real t3012 = t2478*t145;
+    const real t3013 = t2483*t146;
+    const real t3014 = t2477+t3004+t3005+t3006+t3007+t3008+t3009*t240+t3011+t3012+t2486+
+t2488+t2489+t3013;
+    const real t3015 = t2478*t155;
+    const real t3016 = t3015+t2492+t2494+t2498+t2500+t2501+t2502+t2507+t2509+t2510+t2511+
+t2512+t2514;
+    const real t3019 = t2646*t145;
+    const real t3020 = t2622+t2844+t2845+t2846+t2847+t2848+t2849+t2634+t2635+t2637+t2639+
+t2640+t2641+t2949+t3019;
+    const real t3022 = t2683+t2685+t2686+t2687+t2688+t2690+t2691+t2693+t2694+t2696+t2698;
+    const real t3023 = t2704*t139;
+    const real t3024 = t2702*t145;
+    const real t3025 = t2704*t146;
+    const real t3026 = t2702*t155;
+    const real t3027 = t2716*t212;
+    const real t3028 = t2714*t215;
+    const real t3029 = t2720*t143;
+    const real t3030 = t2699+t2701+t3023+t3024+t3025+t3026+t2709+t2711+t2713+t3027+t3028+
+t3029;
+    const real t3033 = t2665*t139;
+    const real t3034 = t2669*t146;
+    const real t3035 = t2651+t2654+t2674+t2675+t2656+t2766+t2767+t2768+t2769+t2770+t2772+
+t2773+t2774+t3033+t2645+t3034;
+    const real t3038 = t2867*t139;
+    const real t3039 = t2865*t145;
+    const real t3040 = t2867*t146;
+    const real t3041 = t2865*t155;
+    const real t3042 = t2881*t212;
+    const real t3043 = t2958+t2960+t2961+t3038+t3039+t3040+t3041+t2878+t2966+t2968+t3042;
+    const real t3046 = t2642*t145;
+    const real t3047 = t2646*t155;
+    const real t3048 = t2622+t2624+t2625+t2627+t2628+t2630+t2632+t2634+t2635+t2637+t2639+
+t2640+t2641+t2775+t3046+t2777+t3047;
+    const real t2620 = t3022+t3030;
+    const real t2670 = t2854+t2855+t2856+t2857+t2858+t2953+t2954+t2955+t2956+t2957+t3043;
+    const real t3050 = t2612+t2621+t3020*t145+t2620*t143+t3035*t146+t2672+t2682+t2670*t212
++t3048*t155+t2765+t2830+t2835;
+    const real t3051 = t2581*t139;
+    const real t3052 = t2578*t145;
+    const real t3053 = t2581*t146;
+    const real t3054 = t2578*t155;
+    const real t3055 = t2567+t2568+t2569+t2570+t2571+t2977+t2978+t2979+t2980+t2981+t2982+
+t2983+t2984+t3051+t3052+t3053+t3054+t2592+t2989;
+    const real t3057 = t2669*t139;
+    const real t3058 = t2654+t2673+t2653+t2655+t2676+t2947+t2948+t2768+t2769+t2770+t2772+
+t2773+t2774+t3057;
+    const real t3060 = t2718*t309;
+    const real t3061 = t2695*t155;
+    const real t3062 = t2891*t143;
+    const real t3063 = t2720*t475;
+    const real t3064 = t2712*t212;
+    const real t3065 = t2710*t215;
+    const real t3066 = t2695*t145;
+    const real t3067 = t2885+t2886+t3060+t3061+t3062+t3063+t3064+t3065+t3066+t2683+t2685+
+t2686+t2687;
+    const real t3068 = t2697*t146;
+    const real t3069 = t2697*t139;
+    const real t3070 = t2688+t2709+t2897+t3068+t2898+t2899+t2789+t2900+t2901+t2902+t3069+
+t2903+t2904;
+    const real t3073 = t2921*t139;
+    const real t3074 = t2919*t145;
+    const real t3075 = t2921*t146;
+    const real t3076 = t2919*t155;
+    const real t3077 = t2909+t2910+t2911+t2912+t2913+t2915+t2916+t2917+t2918+t2920+t2922+
+t2923+t2924+t3073+t3074+t3075+t3076+t2930;
+    const real t3080 = t2799*t215;
+    const real t3081 = t2787*t309;
+    const real t3082 = t2815*t240+t2781+t3080+t2783+t2784+t2791+t2793+t2795+t2797+t2798+
+t2800+t3081;
+    const real t3083 = t2785*t143;
+    const real t3084 = t2796*t145;
+    const real t3085 = t2796*t155;
+    const real t3086 = t2792*t212;
+    const real t3087 = t2794*t139;
+    const real t3088 = t2794*t146;
+    const real t3089 = t3083+t3084+t2802+t3085+t3086+t2804+t2805+t2806+t2807+t2808+t3087+
+t3088+t2817;
+    const real t3092 = t2873*t139;
+    const real t3093 = t2871*t145;
+    const real t3094 = t2873*t146;
+    const real t3095 = t2871*t155;
+    const real t3096 = t2854+t2855+t2856+t2857+t2858+t2860+t2861+t2863+t2864+t2866+t2868+
+t2869+t2870+t3092+t3093+t3094+t3095+t2878+t2880+t2882;
+    const real t3098 = t2725+t2727+t2728+t2729+t2730+t2732+t2733+t2734+t2735+t2737+t2739+
+t2741;
+    const real t3099 = t2738*t139;
+    const real t3100 = t2736*t145;
+    const real t3101 = t2738*t146;
+    const real t3102 = t2736*t155;
+    const real t3103 = t2751*t212;
+    const real t3104 = t2749*t215;
+    const real t3106 = t2742+t3099+t3100+t3101+t3102+t2748+t2750+t2752+t3103+t3104+t2719+
+t2755*t309;
+    const real t3109 = t2567+t2568+t2569+t2570+t2571+t2573+t2574+t2576+t2577+t2579+t2582;
+    const real t3110 = t2587*t139;
+    const real t3111 = t2585*t145;
+    const real t3112 = t2587*t146;
+    const real t3113 = t2585*t155;
+    const real t3114 = t2597*t215;
+    const real t3115 = t2583+t2584+t3110+t3111+t3112+t3113+t2592+t2594+t2596+t2969+t3114;
+    const real t2758 = t3067+t3070;
+    const real t2764 = t3082+t3089;
+    const real t2816 = t3098+t3106;
+    const real t2820 = t3109+t3115;
+    const real t3118 = t2839+t2843+t3055*t275+t3058*t139+t2758*t475+t2941+t2946+t3077*t179
++t2764*t240+t3096*t254+t2976+t2816*t309+t2820*t215;
+    const real t3121 = a[47];
+    const real t3122 = a[453];
+    const real t3123 = t3122*t5;
+    const real t3124 = t3122*t20;
+    const real t3125 = t3122*t26;
+    const real t3126 = t3122*t37;
+    const real t3127 = a[512];
+    const real t3128 = t3127*t50;
+    const real t3129 = t3127*t67;
+    const real t3130 = a[380];
+    const real t3131 = t3130*t72;
+    const real t3132 = t3130*t73;
+    const real t3133 = a[261];
+    const real t3135 = a[481];
+    const real t3139 = a[100];
+    const real t3140 = t3139*t139;
+    const real t3141 = t3139*t145;
+    const real t3142 = t3139*t146;
+    const real t3143 = t3139*t155;
+    const real t2825 = a[121];
+    const real t3145 = t2825*t179;
+    const real t3146 = a[211];
+    const real t3148 = t3121+t3123+t3124+t3125+t3126+t3128+t3129+t3131+t3132+t3133*t77+
+t3135*t126+t3133*t132+t3135*t136+t3140+t3141+t3142+t3143+t3145+t3146*t275;
+    const real t2838 = t2423+t2431;
+    const real t2852 = t2465+t2473;
+    const real t2884 = t2496+t2517;
+    const real t2929 = t2831+t2992;
+    const real t2937 = t3014+t3016;
+    const real t2944 = t3050+t3118;
+    const real t3116 = x[4];
+    const real t3120 = x[5];
+    const real t3150 = t2414*t139+t2421*t155+t2838*t143+t2459*t179+t2463*t145+t2852*t215+
+t2884*t240+t2525+t2534+t2564*t254+t2929*t3116+t3003+t2937*t475+t2944*t3120+
+t3148*t275;
+    const real t3153 = a[61];
+    const real t3154 = a[456];
+    const real t3155 = t3154*t5;
+    const real t3156 = t3154*t20;
+    const real t3157 = a[233];
+    const real t3158 = t3157*t26;
+    const real t3159 = t3157*t37;
+    const real t3160 = a[516];
+    const real t3162 = a[477];
+    const real t3166 = a[63];
+    const real t3167 = a[292];
+    const real t3168 = t3167*t5;
+    const real t3169 = t3167*t20;
+    const real t3170 = t3167*t26;
+    const real t3171 = t3167*t37;
+    const real t3172 = a[334];
+    const real t3173 = t3172*t50;
+    const real t3174 = t3172*t67;
+    const real t3175 = a[357];
+    const real t3176 = t3175*t72;
+    const real t3177 = t3175*t73;
+    const real t3178 = a[132];
+    const real t3180 = a[356];
+    const real t3184 = a[103];
+    const real t3185 = t3184*t139;
+    const real t3186 = t3184*t145;
+    const real t3187 = t3184*t146;
+    const real t3188 = t3184*t155;
+    const real t2972 = a[352];
+    const real t3190 = t2972*t179;
+    const real t3191 = a[505];
+    const real t3193 = t3166+t3168+t3169+t3170+t3171+t3173+t3174+t3176+t3177+t3178*t77+
+t3180*t126+t3178*t132+t3180*t136+t3185+t3186+t3187+t3188+t3190+t3191*t275;
+    const real t3195 = a[544];
+    const real t3196 = t3195*t143;
+    const real t3197 = a[179];
+    const real t3199 = a[420];
+    const real t3200 = t3199*t475;
+    const real t3201 = a[426];
+    const real t3203 = a[408];
+    const real t3204 = t3203*t254;
+    const real t3205 = a[553];
+    const real t3206 = t3205*t275;
+    const real t3207 = a[280];
+    const real t3208 = t3207*t136;
+    const real t3209 = a[443];
+    const real t3210 = t3209*t77;
+    const real t3211 = t3207*t126;
+    const real t3212 = t3209*t132;
+    const real t3213 = a[308];
+    const real t3214 = t3213*t5;
+    const real t3215 = a[10];
+    const real t3216 = t3213*t20;
+    const real t3217 = t3196+t3197*t240+t3200+t3201*t309+t3204+t3206+t3208+t3210+t3211+
+t3212+t3214+t3215+t3216;
+    const real t3218 = t3213*t26;
+    const real t3219 = t3213*t37;
+    const real t3220 = a[196];
+    const real t3221 = t3220*t50;
+    const real t3222 = t3220*t67;
+    const real t3223 = a[368];
+    const real t3224 = t3223*t72;
+    const real t3225 = t3223*t73;
+    const real t3226 = a[284];
+    const real t3227 = t3226*t139;
+    const real t3228 = a[331];
+    const real t3229 = t3228*t145;
+    const real t3230 = t3226*t146;
+    const real t3231 = t3228*t155;
+    const real t3001 = a[102];
+    const real t3233 = t3001*t179;
+    const real t3234 = a[369];
+    const real t3235 = t3234*t212;
+    const real t3236 = a[436];
+    const real t3237 = t3236*t215;
+    const real t3238 = t3218+t3219+t3221+t3222+t3224+t3225+t3227+t3229+t3230+t3231+t3233+
+t3235+t3237;
+    const real t3241 = a[35];
+    const real t3242 = a[173];
+    const real t3243 = t3242*t20;
+    const real t3244 = a[363];
+    const real t3245 = t3244*t5;
+    const real t3246 = t3244*t26;
+    const real t3247 = t3242*t37;
+    const real t3248 = a[297];
+    const real t3249 = t3248*t50;
+    const real t3250 = t3248*t67;
+    const real t3251 = a[170];
+    const real t3252 = t3251*t72;
+    const real t3253 = a[530];
+    const real t3254 = t3253*t73;
+    const real t3255 = a[273];
+    const real t3257 = a[355];
+    const real t3259 = a[385];
+    const real t3261 = a[144];
+    const real t3263 = t3241+t3243+t3245+t3246+t3247+t3249+t3250+t3252+t3254+t3255*t77+
+t3257*t126+t3259*t132+t3261*t136;
+    const real t3265 = a[430];
+    const real t3266 = t3265*t5;
+    const real t3267 = a[8];
+    const real t3268 = t3265*t20;
+    const real t3269 = a[195];
+    const real t3270 = t3269*t26;
+    const real t3271 = t3269*t37;
+    const real t3272 = a[216];
+    const real t3273 = t3272*t50;
+    const real t3274 = a[165];
+    const real t3275 = t3274*t67;
+    const real t3276 = a[441];
+    const real t3277 = t3276*t72;
+    const real t3278 = t3276*t73;
+    const real t3279 = a[300];
+    const real t3280 = t3279*t77;
+    const real t3281 = t3279*t126;
+    const real t3282 = t3279*t132;
+    const real t3283 = t3279*t136;
+    const real t3284 = a[384];
+    const real t3286 = a[423];
+    const real t3288 = t3266+t3267+t3268+t3270+t3271+t3273+t3275+t3277+t3278+t3280+t3281+
+t3282+t3283+t3284*t139+t3286*t145;
+    const real t3290 = a[761];
+    const real t3291 = t3290*t5;
+    const real t3292 = a[332];
+    const real t3293 = t3290*t20;
+    const real t3294 = a[578];
+    const real t3295 = t3294*t26;
+    const real t3296 = t3294*t37;
+    const real t3297 = a[731];
+    const real t3298 = t3297*t50;
+    const real t3299 = a[655];
+    const real t3300 = t3299*t67;
+    const real t3301 = a[580];
+    const real t3302 = t3301*t72;
+    const real t3303 = t3301*t73;
+    const real t3304 = a[608];
+    const real t3305 = t3304*t77;
+    const real t3306 = a[760];
+    const real t3307 = t3306*t126;
+    const real t3308 = t3304*t132;
+    const real t3309 = t3306*t136;
+    const real t3310 = a[1002];
+    const real t3311 = t3310*t139;
+    const real t3312 = t3291+t3292+t3293+t3295+t3296+t3298+t3300+t3302+t3303+t3305+t3307+
+t3308+t3309+t3311;
+    const real t3314 = a[1092];
+    const real t3315 = t3314*t139;
+    const real t3316 = t3310*t145;
+    const real t3317 = t3291+t3292+t3293+t3295+t3296+t3298+t3300+t3302+t3303+t3305+t3307+
+t3308+t3309+t3315+t3316;
+    const real t3319 = a[246];
+    const real t3320 = a[837];
+    const real t3321 = t3320*t5;
+    const real t3322 = a[1069];
+    const real t3323 = t3322*t20;
+    const real t3324 = t3320*t26;
+    const real t3325 = t3322*t37;
+    const real t3326 = a[841];
+    const real t3327 = t3326*t50;
+    const real t3328 = t3326*t67;
+    const real t3329 = a[1103];
+    const real t3330 = t3329*t72;
+    const real t3331 = a[929];
+    const real t3332 = t3331*t73;
+    const real t3333 = a[938];
+    const real t3335 = a[818];
+    const real t3336 = t3335*t126;
+    const real t3337 = a[842];
+    const real t3339 = t3319+t3321+t3323+t3324+t3325+t3327+t3328+t3330+t3332+t3333*t77+
+t3336+t3337*t132;
+    const real t3341 = a[817];
+    const real t3342 = t3341*t20;
+    const real t3343 = a[564];
+    const real t3344 = t3343*t5;
+    const real t3345 = a[493];
+    const real t3346 = t3343*t26;
+    const real t3347 = t3341*t37;
+    const real t3348 = a[647];
+    const real t3349 = t3348*t50;
+    const real t3350 = t3348*t67;
+    const real t3351 = a[966];
+    const real t3352 = t3351*t72;
+    const real t3353 = a[619];
+    const real t3354 = t3353*t73;
+    const real t3355 = a[926];
+    const real t3356 = t3355*t77;
+    const real t3357 = a[1040];
+    const real t3359 = t3342+t3344+t3345+t3346+t3347+t3349+t3350+t3352+t3354+t3356+t3357*
+t126;
+    const real t3361 = a[213];
+    const real t3362 = a[873];
+    const real t3363 = t3362*t5;
+    const real t3364 = a[965];
+    const real t3365 = t3364*t20;
+    const real t3366 = t3362*t26;
+    const real t3367 = t3364*t37;
+    const real t3368 = a[768];
+    const real t3369 = t3368*t50;
+    const real t3370 = t3368*t67;
+    const real t3371 = a[986];
+    const real t3373 = a[717];
+    const real t3044 = t3371*t72;
+    const real t3045 = t3373*t73;
+    const real t3376 = (t3361+t3363+t3365+t3366+t3367+t3369+t3370+t3044+t3045)*t73;
+    const real t3377 = a[894];
+    const real t3378 = t3377*t5;
+    const real t3379 = a[268];
+    const real t3380 = t3377*t20;
+    const real t3381 = a[878];
+    const real t3382 = t3381*t26;
+    const real t3383 = t3381*t37;
+    const real t3384 = a[861];
+    const real t3056 = t3384*t50;
+    const real t3387 = (t3378+t3379+t3380+t3382+t3383+t3056)*t50;
+    const real t3388 = a[732];
+    const real t3389 = t3388*t5;
+    const real t3390 = a[248];
+    const real t3391 = t3388*t20;
+    const real t3392 = t3388*t26;
+    const real t3393 = t3388*t37;
+    const real t3394 = a[947];
+    const real t3395 = t3394*t50;
+    const real t3396 = t3394*t67;
+    const real t3397 = a[786];
+    const real t3398 = t3397*t72;
+    const real t3399 = t3397*t73;
+    const real t3400 = a[903];
+    const real t3401 = t3400*t77;
+    const real t3402 = a[789];
+    const real t3403 = t3402*t126;
+    const real t3404 = t3389+t3390+t3391+t3392+t3393+t3395+t3396+t3398+t3399+t3401+t3403;
+    const real t3405 = t3400*t132;
+    const real t3406 = t3402*t136;
+    const real t3407 = a[1027];
+    const real t3408 = t3407*t139;
+    const real t3409 = a[945];
+    const real t3410 = t3409*t145;
+    const real t3411 = t3407*t146;
+    const real t3412 = t3409*t155;
+    const real t3071 = a[660];
+    const real t3414 = t3071*t179;
+    const real t3415 = a[1049];
+    const real t3416 = t3415*t275;
+    const real t3417 = a[1017];
+    const real t3418 = t3417*t254;
+    const real t3419 = a[955];
+    const real t3420 = t3419*t212;
+    const real t3421 = a[1026];
+    const real t3422 = t3421*t215;
+    const real t3423 = t3405+t3406+t3408+t3410+t3411+t3412+t3414+t3416+t3418+t3420+t3422;
+    const real t3426 = a[710];
+    const real t3427 = t3426*t5;
+    const real t3428 = a[469];
+    const real t3429 = t3426*t20;
+    const real t3430 = t3426*t26;
+    const real t3431 = t3426*t37;
+    const real t3432 = a[639];
+    const real t3433 = t3432*t50;
+    const real t3434 = t3432*t67;
+    const real t3435 = a[656];
+    const real t3436 = t3435*t72;
+    const real t3437 = t3435*t73;
+    const real t3438 = a[708];
+    const real t3439 = t3438*t77;
+    const real t3440 = a[648];
+    const real t3441 = t3440*t126;
+    const real t3442 = t3427+t3428+t3429+t3430+t3431+t3433+t3434+t3436+t3437+t3439+t3441;
+    const real t3443 = t3438*t132;
+    const real t3444 = t3440*t136;
+    const real t3445 = a[695];
+    const real t3446 = t3445*t139;
+    const real t3447 = a[593];
+    const real t3448 = t3447*t145;
+    const real t3449 = t3445*t146;
+    const real t3450 = t3447*t155;
+    const real t3072 = a[606];
+    const real t3452 = t3072*t179;
+    const real t3453 = a[886];
+    const real t3454 = t3453*t275;
+    const real t3455 = a[1010];
+    const real t3456 = t3455*t254;
+    const real t3457 = a[1032];
+    const real t3458 = t3457*t212;
+    const real t3459 = a[627];
+    const real t3460 = t3459*t215;
+    const real t3461 = a[572];
+    const real t3462 = t3461*t143;
+    const real t3463 = t3443+t3444+t3446+t3448+t3449+t3450+t3452+t3454+t3456+t3458+t3460+
+t3462;
+    const real t3466 = t3364*t5;
+    const real t3467 = t3362*t20;
+    const real t3468 = t3364*t26;
+    const real t3469 = t3362*t37;
+    const real t3078 = t3373*t72;
+    const real t3472 = (t3466+t3361+t3467+t3468+t3469+t3369+t3370+t3078)*t72;
+    const real t3090 = a[725];
+    const real t3474 = t3090*t179;
+    const real t3475 = a[826];
+    const real t3476 = t3475*t212;
+    const real t3477 = a[682];
+    const real t3478 = t3477*t309;
+    const real t3479 = a[852];
+    const real t3480 = t3479*t215;
+    const real t3481 = a[822];
+    const real t3482 = t3481*t240;
+    const real t3483 = a[736];
+    const real t3484 = t3483*t136;
+    const real t3485 = a[106];
+    const real t3486 = a[764];
+    const real t3487 = t3486*t143;
+    const real t3488 = a[850];
+    const real t3489 = t3488*t275;
+    const real t3490 = a[887];
+    const real t3491 = t3490*t146;
+    const real t3492 = a[581];
+    const real t3493 = t3492*t155;
+    const real t3494 = t3483*t126;
+    const real t3495 = t3474+t3476+t3478+t3480+t3482+t3484+t3485+t3487+t3489+t3491+t3493+
+t3494;
+    const real t3496 = a[843];
+    const real t3497 = t3496*t72;
+    const real t3498 = a[610];
+    const real t3499 = t3498*t50;
+    const real t3500 = a[970];
+    const real t3501 = t3500*t77;
+    const real t3502 = t3490*t139;
+    const real t3503 = a[594];
+    const real t3504 = t3503*t20;
+    const real t3505 = t3492*t145;
+    const real t3506 = t3503*t5;
+    const real t3507 = a[1048];
+    const real t3508 = t3507*t254;
+    const real t3509 = t3503*t26;
+    const real t3510 = t3503*t37;
+    const real t3511 = t3498*t67;
+    const real t3512 = t3496*t73;
+    const real t3513 = t3500*t132;
+    const real t3514 = t3497+t3499+t3501+t3502+t3504+t3505+t3506+t3508+t3509+t3510+t3511+
+t3512+t3513;
+    const real t3517 = t3427+t3428+t3429+t3430+t3431+t3433+t3434+t3436+t3437+t3439+t3441+
+t3443;
+    const real t3518 = t3447*t139;
+    const real t3519 = t3445*t145;
+    const real t3520 = t3447*t146;
+    const real t3521 = t3445*t155;
+    const real t3522 = t3459*t212;
+    const real t3523 = t3457*t215;
+    const real t3524 = a[1050];
+    const real t3525 = t3524*t143;
+    const real t3526 = t3461*t309;
+    const real t3527 = t3444+t3518+t3519+t3520+t3521+t3452+t3454+t3456+t3522+t3523+t3525+
+t3526;
+    const real t3530 = a[390];
+    const real t3531 = a[770];
+    const real t3532 = t3531*t5;
+    const real t3533 = t3531*t20;
+    const real t3534 = t3531*t26;
+    const real t3535 = t3531*t37;
+    const real t3536 = a[595];
+    const real t3537 = t3536*t50;
+    const real t3538 = t3536*t67;
+    const real t3539 = a[1133];
+    const real t3540 = t3539*t72;
+    const real t3541 = t3539*t73;
+    const real t3542 = a[1138];
+    const real t3544 = a[844];
+    const real t3548 = a[774];
+    const real t3549 = t3548*t139;
+    const real t3550 = t3548*t145;
+    const real t3551 = t3548*t146;
+    const real t3552 = t3548*t155;
+    const real t3091 = a[601];
+    const real t3554 = t3091*t179;
+    const real t3555 = a[654];
+    const real t3556 = t3555*t275;
+    const real t3557 = a[1146];
+    const real t3559 = t3530+t3532+t3533+t3534+t3535+t3537+t3538+t3540+t3541+t3542*t77+
+t3544*t126+t3542*t132+t3544*t136+t3549+t3550+t3551+t3552+t3554+t3556+t3557*t254
+;
+    const real t3136 = t3404+t3423;
+    const real t3138 = t3442+t3463;
+    const real t3147 = t3495+t3514;
+    const real t3151 = t3517+t3527;
+    const real t3561 = t3312*t139+t3317*t145+t3339*t132+t3359*t126+t3376+t3387+t3136*t215+
+t3138*t143+t3472+t3147*t240+t3151*t309+t3559*t254;
+    const real t3562 = a[1149];
+    const real t3563 = t3562*t5;
+    const real t3564 = a[437];
+    const real t3565 = a[956];
+    const real t3566 = t3565*t20;
+    const real t3567 = a[906];
+    const real t3568 = t3567*t26;
+    const real t3163 = t3563+t3564+t3566+t3568;
+    const real t3570 = t3163*t26;
+    const real t3571 = a[952];
+    const real t3573 = t3565*t5;
+    const real t3575 = t3567*t37;
+    const real t3179 = t3564+t3571*t26+t3573+t3562*t20+t3575;
+    const real t3577 = t3179*t37;
+    const real t3578 = t3294*t5;
+    const real t3579 = t3294*t20;
+    const real t3580 = t3290*t26;
+    const real t3581 = t3290*t37;
+    const real t3582 = t3299*t50;
+    const real t3583 = t3297*t67;
+    const real t3584 = a[1012];
+    const real t3585 = t3584*t139;
+    const real t3586 = a[1021];
+    const real t3587 = t3586*t145;
+    const real t3588 = t3310*t146;
+    const real t3589 = t3292+t3578+t3579+t3580+t3581+t3582+t3583+t3302+t3303+t3305+t3307+
+t3308+t3309+t3585+t3587+t3588;
+    const real t3591 = t3479*t212;
+    const real t3592 = t3475*t215;
+    const real t3593 = t3474+t3484+t3485+t3489+t3494+t3497+t3499+t3501+t3504+t3591+t3592+
+t3506+t3508;
+    const real t3594 = t3486*t309;
+    const real t3595 = t3490*t155;
+    const real t3596 = t3492*t146;
+    const real t3597 = t3481*t475;
+    const real t3598 = t3492*t139;
+    const real t3599 = t3490*t145;
+    const real t3600 = a[651];
+    const real t3602 = t3477*t143;
+    const real t3603 = t3509+t3510+t3511+t3512+t3513+t3594+t3595+t3596+t3597+t3598+t3599+
+t3600*t240+t3602;
+    const real t3606 = t3343*t20;
+    const real t3607 = t3341*t5;
+    const real t3608 = t3341*t26;
+    const real t3609 = t3343*t37;
+    const real t3610 = t3353*t72;
+    const real t3611 = t3351*t73;
+    const real t3612 = t3335*t77;
+    const real t3613 = a[971];
+    const real t3615 = t3355*t132;
+    const real t3617 = t3606+t3345+t3607+t3608+t3609+t3349+t3350+t3610+t3611+t3612+t3613*
+t126+t3615+t3357*t136;
+    const real t3619 = t3381*t5;
+    const real t3620 = t3381*t20;
+    const real t3621 = t3377*t26;
+    const real t3622 = t3377*t37;
+    const real t3623 = a[1137];
+    const real t3189 = t3623*t50;
+    const real t3192 = t3384*t67;
+    const real t3627 = (t3619+t3379+t3620+t3621+t3622+t3189+t3192)*t67;
+    const real t3628 = t3586*t139;
+    const real t3629 = t3584*t145;
+    const real t3630 = t3314*t146;
+    const real t3631 = t3310*t155;
+    const real t3632 = t3292+t3578+t3579+t3580+t3581+t3582+t3583+t3302+t3303+t3305+t3307+
+t3308+t3309+t3628+t3629+t3630+t3631;
+    const real t3634 = t3320*t20;
+    const real t3635 = t3322*t5;
+    const real t3636 = t3322*t26;
+    const real t3637 = t3320*t37;
+    const real t3638 = t3331*t72;
+    const real t3639 = t3329*t73;
+    const real t3644 = t3409*t139;
+    const real t3645 = t3407*t145;
+    const real t3646 = t3409*t146;
+    const real t3647 = t3407*t155;
+    const real t3648 = t3421*t212;
+    const real t3649 = t3403+t3405+t3406+t3644+t3645+t3646+t3647+t3414+t3416+t3418+t3648;
+    const real t3652 = a[866];
+    const real t3653 = t3652*t5;
+    const real t3654 = a[320];
+    const real t3655 = t3652*t20;
+    const real t3656 = t3652*t26;
+    const real t3657 = t3652*t37;
+    const real t3658 = a[1085];
+    const real t3659 = t3658*t50;
+    const real t3660 = t3658*t67;
+    const real t3661 = a[1105];
+    const real t3662 = t3661*t72;
+    const real t3663 = t3661*t73;
+    const real t3664 = a[773];
+    const real t3666 = a[1099];
+    const real t3670 = a[673];
+    const real t3671 = t3670*t139;
+    const real t3672 = t3670*t145;
+    const real t3673 = t3670*t146;
+    const real t3674 = t3670*t155;
+    const real t3198 = a[1037];
+    const real t3676 = t3198*t179;
+    const real t3677 = a[912];
+    const real t3679 = t3653+t3654+t3655+t3656+t3657+t3659+t3660+t3662+t3663+t3664*t77+
+t3666*t126+t3664*t132+t3666*t136+t3671+t3672+t3673+t3674+t3676+t3677*t275;
+    const real t3681 = a[911];
+    const real t3682 = t3681*t5;
+    const real t3683 = a[557];
+    const real t3684 = t3681*t20;
+    const real t3685 = t3681*t26;
+    const real t3686 = t3681*t37;
+    const real t3687 = a[705];
+    const real t3688 = t3687*t50;
+    const real t3689 = t3687*t67;
+    const real t3690 = a[698];
+    const real t3691 = t3690*t72;
+    const real t3692 = t3690*t73;
+    const real t3693 = a[625];
+    const real t3695 = a[993];
+    const real t3699 = a[743];
+    const real t3700 = t3699*t139;
+    const real t3701 = t3699*t145;
+    const real t3702 = t3699*t146;
+    const real t3703 = t3699*t155;
+    const real t3258 = a[609];
+    const real t3705 = t3258*t179;
+    const real t3706 = t3682+t3683+t3684+t3685+t3686+t3688+t3689+t3691+t3692+t3693*t77+
+t3695*t126+t3693*t132+t3695*t136+t3700+t3701+t3702+t3703+t3705;
+    const real t3287 = t3567*t5;
+    const real t3710 = (t3564+t3287)*t5;
+    const real t3711 = t3571*t5;
+    const real t3712 = t3567*t20;
+    const real t3313 = t3711+t3564+t3712;
+    const real t3714 = t3313*t20;
+    const real t3334 = t3593+t3603;
+    const real t3360 = t3337*t77;
+    const real t3375 = t3389+t3390+t3391+t3392+t3393+t3395+t3396+t3398+t3399+t3401+t3649;
+    const real t3715 = t3570+t3577+t3589*t146+t3334*t475+t3617*t136+t3627+t3632*t155+(
+t3634+t3319+t3635+t3636+t3637+t3327+t3328+t3638+t3639+t3360)*t77+t3375*t212+
+t3679*t275+t3706*t179+t3710+t3714;
+    const real t3718 = a[92];
+    const real t3719 = t3718*t5;
+    const real t3720 = a[54];
+    const real t3721 = a[504];
+    const real t3722 = t3721*t20;
+    const real t3723 = t3718*t26;
+    const real t3724 = t3721*t37;
+    const real t3725 = a[528];
+    const real t3726 = t3725*t50;
+    const real t3727 = t3725*t67;
+    const real t3728 = a[518];
+    const real t3730 = a[80];
+    const real t3734 = a[49];
+    const real t3735 = a[403];
+    const real t3736 = t3735*t5;
+    const real t3737 = t3735*t20;
+    const real t3738 = t3735*t26;
+    const real t3739 = t3735*t37;
+    const real t3740 = a[429];
+    const real t3741 = t3740*t50;
+    const real t3742 = t3740*t67;
+    const real t3743 = a[322];
+    const real t3744 = t3743*t72;
+    const real t3745 = t3743*t73;
+    const real t3746 = a[160];
+    const real t3747 = t3746*t77;
+    const real t3748 = t3746*t126;
+    const real t3749 = t3734+t3736+t3737+t3738+t3739+t3741+t3742+t3744+t3745+t3747+t3748;
+    const real t3750 = t3746*t132;
+    const real t3751 = t3746*t136;
+    const real t3752 = a[101];
+    const real t3754 = a[318];
+    const real t3424 = a[542];
+    const real t3759 = t3424*t179;
+    const real t3760 = a[486];
+    const real t3761 = t3760*t275;
+    const real t3762 = t3760*t254;
+    const real t3763 = a[559];
+    const real t3765 = a[243];
+    const real t3767 = t3750+t3751+t3752*t139+t3754*t145+t3752*t146+t3754*t155+t3759+t3761
++t3762+t3763*t212+t3765*t215;
+    const real t3770 = t3721*t5;
+    const real t3771 = t3718*t20;
+    const real t3772 = t3721*t26;
+    const real t3773 = t3718*t37;
+    const real t3777 = t3157*t5;
+    const real t3778 = t3157*t20;
+    const real t3779 = t3154*t26;
+    const real t3780 = t3154*t37;
+    const real t3784 = t3207*t77;
+    const real t3785 = t3209*t126;
+    const real t3786 = t3215+t3214+t3216+t3218+t3219+t3221+t3222+t3224+t3225+t3784+t3785;
+    const real t3787 = t3207*t132;
+    const real t3788 = t3209*t136;
+    const real t3789 = t3228*t139;
+    const real t3790 = t3226*t145;
+    const real t3791 = t3228*t146;
+    const real t3792 = t3226*t155;
+    const real t3793 = t3203*t275;
+    const real t3794 = t3205*t254;
+    const real t3795 = t3236*t212;
+    const real t3796 = t3234*t215;
+    const real t3797 = t3199*t143;
+    const real t3798 = t3787+t3788+t3789+t3790+t3791+t3792+t3233+t3793+t3794+t3795+t3796+
+t3797;
+    const real t3801 = t3199*t240;
+    const real t3802 = t3195*t309;
+    const real t3803 = t3795+t3796+t3789+t3801+t3802+t3204+t3791+t3206+t3790+t3208+t3210+
+t3211;
+    const real t3804 = t3201*t143;
+    const real t3805 = t3792+t3212+t3804+t3214+t3215+t3216+t3218+t3219+t3221+t3222+t3224+
+t3225+t3233;
+    const real t3808 = a[923];
+    const real t3809 = t3808*t5;
+    const real t3810 = a[442];
+    const real t3811 = t3808*t20;
+    const real t3812 = t3808*t26;
+    const real t3813 = t3808*t37;
+    const real t3814 = a[733];
+    const real t3815 = t3814*t50;
+    const real t3816 = t3814*t67;
+    const real t3817 = a[1028];
+    const real t3818 = t3817*t72;
+    const real t3819 = t3817*t73;
+    const real t3820 = a[746];
+    const real t3821 = t3820*t77;
+    const real t3822 = t3820*t126;
+    const real t3823 = t3809+t3810+t3811+t3812+t3813+t3815+t3816+t3818+t3819+t3821+t3822;
+    const real t3824 = t3820*t132;
+    const real t3825 = t3820*t136;
+    const real t3826 = a[561];
+    const real t3828 = a[1088];
+    const real t3473 = a[1094];
+    const real t3833 = t3473*t179;
+    const real t3834 = a[750];
+    const real t3835 = t3834*t275;
+    const real t3836 = t3834*t254;
+    const real t3837 = a[849];
+    const real t3839 = a[723];
+    const real t3841 = t3824+t3825+t3826*t139+t3828*t145+t3826*t146+t3828*t155+t3833+t3835
++t3836+t3837*t212+t3839*t215;
+    const real t3844 = a[1126];
+    const real t3846 = a[985];
+    const real t3848 = a[788];
+    const real t3849 = t3848*t5;
+    const real t3850 = a[209];
+    const real t3851 = a[942];
+    const real t3852 = t3851*t37;
+    const real t3855 = a[640];
+    const real t3856 = t3855*t5;
+    const real t3857 = a[547];
+    const real t3858 = t3855*t20;
+    const real t3859 = a[1004];
+    const real t3860 = t3859*t26;
+    const real t3861 = t3859*t37;
+    const real t3862 = a[1130];
+    const real t3866 = a[629];
+    const real t3867 = t3866*t5;
+    const real t3868 = a[582];
+    const real t3869 = t3868*t20;
+    const real t3870 = a[392];
+    const real t3871 = t3866*t26;
+    const real t3872 = t3868*t37;
+    const real t3873 = a[771];
+    const real t3874 = t3873*t50;
+    const real t3875 = t3873*t67;
+    const real t3876 = a[910];
+    const real t3877 = t3876*t72;
+    const real t3878 = a[811];
+    const real t3879 = t3878*t73;
+    const real t3880 = a[892];
+    const real t3882 = a[751];
+    const real t3884 = a[963];
+    const real t3886 = a[888];
+    const real t3888 = t3867+t3869+t3870+t3871+t3872+t3874+t3875+t3877+t3879+t3880*t77+
+t3882*t126+t3884*t132+t3886*t136;
+    const real t3890 = a[1052];
+    const real t3891 = t3890*t20;
+    const real t3892 = a[1022];
+    const real t3893 = t3892*t5;
+    const real t3894 = a[502];
+    const real t3895 = t3892*t26;
+    const real t3896 = t3890*t37;
+    const real t3897 = a[749];
+    const real t3898 = t3897*t50;
+    const real t3899 = t3897*t67;
+    const real t3900 = a[1006];
+    const real t3902 = a[828];
+    const real t3912 = t3822+t3824+t3825+t3828*t139+t3826*t145+t3828*t146+t3826*t155+t3833
++t3835+t3836+t3839*t212;
+    const real t3915 = t3846*t5;
+    const real t3916 = t3851*t20;
+    const real t3919 = t3844*t5;
+    const real t3920 = t3848*t20;
+    const real t3921 = t3851*t26;
+    const real t3924 = t3890*t5;
+    const real t3925 = t3892*t20;
+    const real t3926 = t3890*t26;
+    const real t3927 = t3892*t37;
+    const real t3931 = t3859*t5;
+    const real t3932 = t3859*t20;
+    const real t3933 = t3855*t26;
+    const real t3934 = t3855*t37;
+    const real t3935 = a[1139];
+    const real t3940 = a[953];
+    const real t3941 = t3940*t5;
+    const real t3942 = a[520];
+    const real t3943 = t3940*t20;
+    const real t3944 = t3940*t26;
+    const real t3945 = t3940*t37;
+    const real t3946 = a[829];
+    const real t3947 = t3946*t50;
+    const real t3948 = t3946*t67;
+    const real t3949 = a[1109];
+    const real t3950 = t3949*t72;
+    const real t3951 = t3949*t73;
+    const real t3952 = a[1077];
+    const real t3954 = a[590];
+    const real t3958 = a[716];
+    const real t3959 = t3958*t139;
+    const real t3960 = t3958*t145;
+    const real t3961 = t3958*t146;
+    const real t3962 = t3958*t155;
+    const real t3590 = a[928];
+    const real t3964 = t3590*t179;
+    const real t3965 = a[1078];
+    const real t3967 = t3941+t3942+t3943+t3944+t3945+t3947+t3948+t3950+t3951+t3952*t77+
+t3954*t126+t3952*t132+t3954*t136+t3959+t3960+t3961+t3962+t3964+t3965*t275;
+    const real t3969 = a[881];
+    const real t3970 = t3969*t5;
+    const real t3971 = a[556];
+    const real t3972 = t3969*t20;
+    const real t3973 = t3969*t26;
+    const real t3974 = t3969*t37;
+    const real t3975 = a[693];
+    const real t3978 = a[566];
+    const real t3981 = a[920];
+    const real t3986 = a[814];
+    const real t3618 = a[1131];
+    const real t3992 = t3618*t179;
+    const real t3993 = t3970+t3971+t3972+t3973+t3974+t3975*t50+t3975*t67+t3978*t72+t3978*
+t73+t3981*t77+t3981*t126+t3981*t132+t3981*t136+t3986*t139+t3986*t145+t3986*t146
++t3986*t155+t3992;
+    const real t3668 = t3823+t3841;
+    const real t3680 = t3844*t20+t3846*t26+t3849+t3850+t3852;
+    const real t3696 = t3862*t50;
+    const real t3707 = t3900*t72;
+    const real t3708 = t3902*t73;
+    const real t3716 = t3809+t3810+t3811+t3812+t3813+t3815+t3816+t3818+t3819+t3821+t3912;
+    const real t3753 = t3902*t72;
+    const real t3757 = t3935*t50;
+    const real t3758 = t3862*t67;
+    const real t3995 = t3668*t215+t3680*t37+(t3856+t3857+t3858+t3860+t3861+t3696)*t50+
+t3888*t136+(t3891+t3893+t3894+t3895+t3896+t3898+t3899+t3707+t3708)*t73+t3716*
+t212+(t3850+t3915+t3916)*t20+(t3919+t3850+t3920+t3921)*t26+(t3924+t3894+t3925+
+t3926+t3927+t3898+t3899+t3753)*t72+(t3931+t3857+t3932+t3933+t3934+t3757+t3758)*
+t67+t3967*t275+t3993*t179;
+    const real t4000 = a[925];
+    const real t4003 = t3941+t3942+t3943+t3944+t3945+t3947+t3948+t3950+t3951+t3954*t77+
+t3952*t126+t3954*t132+t3952*t136+t3959+t3960+t3961+t3962+t3964+t4000*t275+t3965
+*t254;
+    const real t4005 = a[1013];
+    const real t4007 = a[838];
+    const real t4008 = t4007*t475;
+    const real t4009 = a[662];
+    const real t4010 = t4009*t136;
+    const real t4011 = t4009*t126;
+    const real t4012 = a[905];
+    const real t4013 = t4012*t143;
+    const real t4014 = a[685];
+    const real t4015 = t4014*t5;
+    const real t4016 = a[1108];
+    const real t4017 = t4016*t254;
+    const real t4018 = a[975];
+    const real t4020 = a[796];
+    const real t4021 = t4020*t275;
+    const real t4022 = a[315];
+    const real t4023 = a[643];
+    const real t4024 = t4023*t73;
+    const real t4025 = t4014*t20;
+    const real t4026 = t4014*t26;
+    const real t4027 = t4005*t240+t4008+t4010+t4011+t4013+t4015+t4017+t4018*t309+t4021+
+t4022+t4024+t4025+t4026;
+    const real t4028 = t4014*t37;
+    const real t4029 = a[738];
+    const real t4030 = t4029*t50;
+    const real t4031 = t4029*t67;
+    const real t4032 = t4023*t72;
+    const real t4033 = a[620];
+    const real t4034 = t4033*t132;
+    const real t4035 = t4033*t77;
+    const real t3806 = a[635];
+    const real t4037 = t3806*t179;
+    const real t4038 = a[800];
+    const real t4039 = t4038*t155;
+    const real t4040 = a[666];
+    const real t4041 = t4040*t139;
+    const real t4042 = t4038*t145;
+    const real t4043 = t4040*t146;
+    const real t4044 = a[1140];
+    const real t4045 = t4044*t212;
+    const real t4046 = a[603];
+    const real t4047 = t4046*t215;
+    const real t4048 = t4028+t4030+t4031+t4032+t4034+t4035+t4037+t4039+t4041+t4042+t4043+
+t4045+t4047;
+    const real t4051 = a[462];
+    const real t4052 = a[998];
+    const real t4053 = t4052*t5;
+    const real t4054 = t4052*t20;
+    const real t4055 = a[776];
+    const real t4056 = t4055*t26;
+    const real t4057 = t4055*t37;
+    const real t4058 = a[957];
+    const real t4059 = t4058*t50;
+    const real t4060 = a[1093];
+    const real t4061 = t4060*t67;
+    const real t4062 = a[987];
+    const real t4063 = t4062*t72;
+    const real t4064 = t4062*t73;
+    const real t4065 = a[809];
+    const real t4066 = t4065*t77;
+    const real t4067 = t4065*t126;
+    const real t4068 = t4065*t132;
+    const real t4069 = t4065*t136;
+    const real t4070 = a[1057];
+    const real t4072 = a[1098];
+    const real t4074 = a[978];
+    const real t4076 = t4051+t4053+t4054+t4056+t4057+t4059+t4061+t4063+t4064+t4066+t4067+
+t4068+t4069+t4070*t139+t4072*t145+t4074*t146;
+    const real t4078 = t4055*t5;
+    const real t4079 = t4055*t20;
+    const real t4080 = t4052*t26;
+    const real t4081 = t4052*t37;
+    const real t4082 = t4060*t50;
+    const real t4083 = t4058*t67;
+    const real t4084 = a[981];
+    const real t4087 = t4051+t4078+t4079+t4080+t4081+t4082+t4083+t4063+t4064+t4066+t4067+
+t4068+t4069+t4084*t139+t4074*t145;
+    const real t4089 = t4009*t77;
+    const real t4090 = t4033*t126;
+    const real t4091 = t4022+t4015+t4025+t4026+t4028+t4030+t4031+t4032+t4024+t4089+t4090;
+    const real t4092 = t4009*t132;
+    const real t4093 = t4033*t136;
+    const real t4094 = t4038*t139;
+    const real t4095 = t4040*t145;
+    const real t4096 = t4038*t146;
+    const real t4097 = t4040*t155;
+    const real t4098 = t4016*t275;
+    const real t4099 = t4020*t254;
+    const real t4100 = t4046*t212;
+    const real t4101 = t4044*t215;
+    const real t4102 = t4007*t143;
+    const real t4103 = t4092+t4093+t4094+t4095+t4096+t4097+t4037+t4098+t4099+t4100+t4101+
+t4102;
+    const real t4110 = t4051+t4053+t4054+t4056+t4057+t4059+t4061+t4063+t4064+t4066+t4067+
+t4068+t4069+t4072*t139+t4070*t145+t4084*t146+t4074*t155;
+    const real t4115 = t3867+t3869+t3870+t3871+t3872+t3874+t3875+t3877+t3879+t3882*t77+
+t3880*t126+t3886*t132;
+    const real t4117 = t4010+t4011+t4015+t4017+t4021+t4022+t4024+t4025+t4026+t4028+t4030+
+t4031;
+    const real t4118 = t4007*t240;
+    const real t4119 = t4018*t143;
+    const real t4120 = t4012*t309;
+    const real t4121 = t4032+t4034+t4035+t4094+t4095+t4096+t4097+t4100+t4101+t4037+t4118+
+t4119+t4120;
+    const real t4124 = t3866*t20;
+    const real t4125 = t3868*t5;
+    const real t4126 = t3868*t26;
+    const real t4127 = t3866*t37;
+    const real t4128 = t3878*t72;
+    const real t4129 = t3876*t73;
+    const real t4132 = t4124+t3870+t4125+t4126+t4127+t3874+t3875+t4128+t4129+t3884*t77+
+t3886*t126;
+    const real t4137 = t4022+t4015+t4025+t4026+t4028+t4030+t4031+t4032+t4024+t4089+t4090+
+t4092;
+    const real t4138 = t4005*t143;
+    const real t4139 = t4007*t309;
+    const real t4140 = t4093+t4041+t4042+t4043+t4039+t4037+t4098+t4099+t4045+t4047+t4138+
+t4139;
+    const real t4144 = t4051+t4078+t4079+t4080+t4081+t4082+t4083+t4063+t4064+t4066+t4067+
+t4068+t4069+t4074*t139;
+    const real t3864 = t3851*t5;
+    const real t4148 = (t3850+t3864)*t5;
+    const real t3883 = t4027+t4048;
+    const real t3901 = t4091+t4103;
+    const real t3906 = t4117+t4121;
+    const real t3909 = t3886*t77;
+    const real t3913 = t4137+t4140;
+    const real t4149 = t4003*t254+t3883*t475+t4076*t146+t4087*t145+t3901*t143+t4110*t155+
+t4115*t132+t3906*t240+t4132*t126+(t4124+t3870+t4125+t4126+t4127+t3874+t3875+
+t4128+t4129+t3909)*t77+t3913*t309+t4144*t139+t4148;
+    const real t4152 = a[411];
+    const real t4153 = t4152*t5;
+    const real t4154 = a[31];
+    const real t4155 = t4152*t20;
+    const real t4156 = t4152*t26;
+    const real t4157 = t4152*t37;
+    const real t4158 = a[534];
+    const real t4161 = a[464];
+    const real t4164 = a[238];
+    const real t4169 = a[372];
+    const real t3918 = a[485];
+    const real t4175 = t3918*t179;
+    const real t4176 = t4153+t4154+t4155+t4156+t4157+t4158*t50+t4158*t67+t4161*t72+t4161*
+t73+t4164*t77+t4164*t126+t4164*t132+t4164*t136+t4169*t139+t4169*t145+t4169*t146
++t4169*t155+t4175;
+    const real t4178 = t3269*t5;
+    const real t4179 = t3269*t20;
+    const real t4180 = t3265*t26;
+    const real t4181 = t3265*t37;
+    const real t4182 = t3274*t50;
+    const real t4183 = t3272*t67;
+    const real t4184 = a[397];
+    const real t4186 = a[419];
+    const real t4189 = t4178+t3267+t4179+t4180+t4181+t4182+t4183+t3277+t3278+t3280+t3281+
+t3282+t3283+t4184*t139+t4186*t145+t3286*t146;
+    const real t3968 = t3160*t50;
+    const real t3976 = t3162*t67;
+    const real t3982 = t3217+t3238;
+    const real t3987 = t3561+t3715;
+    const real t3989 = t3728*t72;
+    const real t3990 = t3730*t73;
+    const real t3996 = t3749+t3767;
+    const real t3998 = t3730*t72;
+    const real t4002 = t3162*t50;
+    const real t4019 = t3786+t3798;
+    const real t4049 = t3803+t3805;
+    const real t4135 = x[1];
+    const real t4073 = (t3995+t4149)*t4135;
+    const real t4191 = (t3153+t3155+t3156+t3158+t3159+t3968+t3976)*t67+t3193*t275+t3982*
+t475+t3263*t136+t3288*t145+t3987*t2404+(t3719+t3720+t3722+t3723+t3724+t3726+
+t3727+t3989+t3990)*t73+t3996*t215+(t3770+t3771+t3720+t3772+t3773+t3726+t3727+
+t3998)*t72+(t3153+t3777+t3778+t3779+t3780+t4002)*t50+t4019*t143+t4049*t240+
+t4073+t4176*t179+t4189*t146;
+    const real t4192 = a[40];
+    const real t4193 = a[360];
+    const real t4085 = t4193*t5;
+    const real t4196 = (t4192+t4085)*t5;
+    const real t4197 = a[696];
+    const real t4198 = t4197*t67;
+    const real t4199 = a[775];
+    const real t4200 = t4199*t37;
+    const real t4201 = a[950];
+    const real t4202 = t4201*t77;
+    const real t4203 = a[242];
+    const real t4204 = a[1041];
+    const real t4205 = t4204*t240;
+    const real t4206 = t4197*t50;
+    const real t4207 = a[622];
+    const real t4208 = t4207*t254;
+    const real t4088 = a[691];
+    const real t4210 = t4088*t179;
+    const real t4211 = a[870];
+    const real t4212 = t4211*t212;
+    const real t4213 = a[598];
+    const real t4214 = t4213*t146;
+    const real t4215 = a[664];
+    const real t4216 = t4215*t475;
+    const real t4217 = a[1001];
+    const real t4218 = t4217*t72;
+    const real t4219 = a[810];
+    const real t4220 = t4219*t126;
+    const real t4221 = t4198+t4200+t4202+t4203+t4205+t4206+t4208+t4210+t4212+t4214+t4216+
+t4218+t4220;
+    const real t4222 = a[588];
+    const real t4223 = t4222*t143;
+    const real t4224 = a[1005];
+    const real t4225 = t4224*t155;
+    const real t4226 = a[1047];
+    const real t4228 = t4199*t20;
+    const real t4229 = a[1007];
+    const real t4230 = t4229*t275;
+    const real t4231 = t4213*t139;
+    const real t4232 = t4199*t26;
+    const real t4233 = t4199*t5;
+    const real t4234 = t4219*t136;
+    const real t4235 = t4217*t73;
+    const real t4236 = a[1025];
+    const real t4237 = t4236*t215;
+    const real t4238 = t4201*t132;
+    const real t4239 = t4224*t145;
+    const real t4240 = t4223+t4225+t4226*t309+t4228+t4230+t4231+t4232+t4233+t4234+t4235+
+t4237+t4238+t4239;
+    const real t4243 = a[611];
+    const real t4244 = t4243*t5;
+    const real t4245 = a[434];
+    const real t4246 = a[840];
+    const real t4247 = t4246*t20;
+    const real t4248 = t4243*t26;
+    const real t4249 = t4246*t37;
+    const real t4250 = a[631];
+    const real t4251 = t4250*t50;
+    const real t4252 = t4250*t67;
+    const real t4253 = a[833];
+    const real t4254 = t4253*t72;
+    const real t4255 = a[575];
+    const real t4256 = t4255*t73;
+    const real t4257 = a[977];
+    const real t4259 = a[1015];
+    const real t4261 = a[1118];
+    const real t4263 = a[855];
+    const real t4265 = t4244+t4245+t4247+t4248+t4249+t4251+t4252+t4254+t4256+t4257*t77+
+t4259*t126+t4261*t132+t4263*t136;
+    const real t4266 = t4265*t136;
+    const real t4267 = a[289];
+    const real t4268 = a[663];
+    const real t4109 = t4268*t5;
+    const real t4271 = (t4267+t4109)*t5;
+    const real t4272 = a[81];
+    const real t4273 = a[742];
+    const real t4274 = t4273*t5;
+    const real t4275 = t4273*t20;
+    const real t4276 = a[586];
+    const real t4277 = t4276*t26;
+    const real t4278 = t4276*t37;
+    const real t4279 = a[1063];
+    const real t4112 = t4279*t50;
+    const real t4282 = (t4272+t4274+t4275+t4277+t4278+t4112)*t50;
+    const real t4283 = a[712];
+    const real t4285 = a[900];
+    const real t4287 = a[745];
+    const real t4288 = t4287*t5;
+    const real t4289 = t4268*t37;
+    const real t4122 = t4283*t26+t4267+t4285*t20+t4288+t4289;
+    const real t4291 = t4122*t37;
+    const real t4292 = a[161];
+    const real t4293 = a[614];
+    const real t4294 = t4293*t5;
+    const real t4295 = t4293*t20;
+    const real t4296 = t4293*t26;
+    const real t4297 = t4293*t37;
+    const real t4298 = a[649];
+    const real t4299 = t4298*t50;
+    const real t4300 = t4298*t67;
+    const real t4301 = a[805];
+    const real t4302 = t4301*t72;
+    const real t4303 = t4301*t73;
+    const real t4304 = a[915];
+    const real t4305 = t4304*t77;
+    const real t4306 = a[714];
+    const real t4307 = t4306*t126;
+    const real t4308 = t4292+t4294+t4295+t4296+t4297+t4299+t4300+t4302+t4303+t4305+t4307;
+    const real t4309 = t4304*t132;
+    const real t4310 = t4306*t136;
+    const real t4311 = a[772];
+    const real t4312 = t4311*t139;
+    const real t4313 = a[904];
+    const real t4314 = t4313*t145;
+    const real t4315 = t4311*t146;
+    const real t4316 = t4313*t155;
+    const real t4123 = a[890];
+    const real t4318 = t4123*t179;
+    const real t4319 = a[1117];
+    const real t4320 = t4319*t275;
+    const real t4321 = a[803];
+    const real t4322 = t4321*t254;
+    const real t4323 = a[958];
+    const real t4324 = t4323*t212;
+    const real t4325 = a[968];
+    const real t4326 = t4325*t215;
+    const real t4327 = a[565];
+    const real t4328 = t4327*t143;
+    const real t4329 = t4309+t4310+t4312+t4314+t4315+t4316+t4318+t4320+t4322+t4324+t4326+
+t4328;
+    const real t4332 = t4276*t5;
+    const real t4333 = t4276*t20;
+    const real t4334 = t4273*t26;
+    const real t4335 = t4273*t37;
+    const real t4336 = a[1082];
+    const real t4130 = t4336*t50;
+    const real t4131 = t4279*t67;
+    const real t4340 = (t4332+t4272+t4333+t4334+t4335+t4130+t4131)*t67;
+    const real t4341 = a[941];
+    const real t4342 = t4341*t5;
+    const real t4343 = a[218];
+    const real t4344 = t4341*t20;
+    const real t4345 = t4341*t26;
+    const real t4346 = t4341*t37;
+    const real t4347 = a[877];
+    const real t4348 = t4347*t50;
+    const real t4349 = t4347*t67;
+    const real t4350 = a[713];
+    const real t4351 = t4350*t72;
+    const real t4352 = t4350*t73;
+    const real t4353 = a[1051];
+    const real t4354 = t4353*t77;
+    const real t4356 = t4353*t126;
+    const real t4357 = t4353*t132;
+    const real t4358 = t4353*t136;
+    const real t4359 = a[827];
+    const real t4361 = a[762];
+    const real t4134 = a[667];
+    const real t4366 = t4134*t179;
+    const real t4367 = a[972];
+    const real t4368 = t4367*t275;
+    const real t4369 = t4367*t254;
+    const real t4370 = a[741];
+    const real t4372 = t4356+t4357+t4358+t4359*t139+t4361*t145+t4359*t146+t4361*t155+t4366
++t4368+t4369+t4370*t212;
+    const real t4375 = a[515];
+    const real t4376 = a[832];
+    const real t4377 = t4376*t5;
+    const real t4378 = t4376*t20;
+    const real t4379 = t4376*t26;
+    const real t4380 = t4376*t37;
+    const real t4381 = a[1074];
+    const real t4382 = t4381*t50;
+    const real t4383 = t4381*t67;
+    const real t4384 = a[1116];
+    const real t4385 = t4384*t72;
+    const real t4386 = t4384*t73;
+    const real t4387 = a[755];
+    const real t4388 = t4387*t77;
+    const real t4389 = t4387*t126;
+    const real t4390 = t4375+t4377+t4378+t4379+t4380+t4382+t4383+t4385+t4386+t4388+t4389;
+    const real t4391 = t4387*t132;
+    const real t4392 = t4387*t136;
+    const real t4393 = a[935];
+    const real t4395 = a[859];
+    const real t4145 = a[898];
+    const real t4400 = t4145*t179;
+    const real t4401 = a[1110];
+    const real t4402 = t4401*t275;
+    const real t4403 = t4401*t254;
+    const real t4404 = a[1073];
+    const real t4405 = t4404*t212;
+    const real t4406 = a[697];
+    const real t4408 = t4391+t4392+t4393*t139+t4395*t145+t4393*t146+t4395*t155+t4400+t4402
++t4403+t4405+t4406*t215;
+    const real t4411 = t4287*t20;
+    const real t4412 = t4285*t5;
+    const real t4413 = t4268*t26;
+    const real t4160 = t4267+t4411+t4412+t4413;
+    const real t4415 = t4160*t26;
+    const real t4416 = a[277];
+    const real t4417 = a[869];
+    const real t4418 = t4417*t20;
+    const real t4419 = a[959];
+    const real t4420 = t4419*t5;
+    const real t4421 = t4419*t26;
+    const real t4422 = t4417*t37;
+    const real t4423 = a[684];
+    const real t4424 = t4423*t50;
+    const real t4425 = t4423*t67;
+    const real t4426 = a[882];
+    const real t4162 = t4426*t72;
+    const real t4429 = (t4416+t4418+t4420+t4421+t4422+t4424+t4425+t4162)*t72;
+    const real t4433 = t4244+t4245+t4247+t4248+t4249+t4251+t4252+t4254+t4256+t4259*t77+
+t4257*t126+t4263*t132;
+    const real t4434 = t4433*t132;
+    const real t4168 = t4221+t4240;
+    const real t4171 = t4308+t4329;
+    const real t4173 = t4342+t4343+t4344+t4345+t4346+t4348+t4349+t4351+t4352+t4354+t4372;
+    const real t4177 = t4390+t4408;
+    const real t4435 = t4168*t475+t4266+t4271+t4282+t4291+t4171*t143+t4340+t4173*t212+
+t4177*t215+t4415+t4429+t4434;
+    const real t4436 = t4246*t5;
+    const real t4437 = t4243*t20;
+    const real t4438 = t4246*t26;
+    const real t4439 = t4243*t37;
+    const real t4440 = t4255*t72;
+    const real t4441 = t4253*t73;
+    const real t4187 = t4263*t77;
+    const real t4444 = (t4436+t4437+t4245+t4438+t4439+t4251+t4252+t4440+t4441+t4187)*t77;
+    const real t4445 = t4219*t77;
+    const real t4446 = t4201*t126;
+    const real t4447 = t4219*t132;
+    const real t4448 = t4233+t4203+t4228+t4232+t4200+t4206+t4198+t4218+t4235+t4445+t4446+
+t4447;
+    const real t4449 = t4201*t136;
+    const real t4450 = t4207*t275;
+    const real t4451 = t4229*t254;
+    const real t4452 = t4204*t143;
+    const real t4453 = t4215*t309;
+    const real t4454 = t4449+t4231+t4239+t4214+t4225+t4210+t4450+t4451+t4212+t4237+t4452+
+t4453;
+    const real t4459 = t4436+t4437+t4245+t4438+t4439+t4251+t4252+t4440+t4441+t4261*t77+
+t4263*t126;
+    const real t4460 = t4459*t126;
+    const real t4461 = t4306*t77;
+    const real t4462 = t4304*t126;
+    const real t4463 = t4321*t275;
+    const real t4464 = t4461+t4312+t4292+t4302+t4318+t4462+t4463+t4296+t4299+t4295+t4294+
+t4297;
+    const real t4465 = t4306*t132;
+    const real t4466 = t4304*t136;
+    const real t4467 = t4327*t240;
+    const real t4468 = t4319*t254;
+    const real t4469 = t4222*t309;
+    const real t4470 = a[1068];
+    const real t4471 = t4470*t143;
+    const real t4472 = t4300+t4465+t4303+t4314+t4466+t4467+t4316+t4468+t4469+t4324+t4326+
+t4471+t4315;
+    const real t4475 = a[589];
+    const real t4476 = t4475*t5;
+    const real t4477 = a[128];
+    const real t4478 = t4475*t20;
+    const real t4479 = a[821];
+    const real t4480 = t4479*t26;
+    const real t4481 = t4479*t37;
+    const real t4482 = a[623];
+    const real t4483 = t4482*t50;
+    const real t4484 = a[996];
+    const real t4485 = t4484*t67;
+    const real t4486 = a[604];
+    const real t4487 = t4486*t72;
+    const real t4488 = t4486*t73;
+    const real t4489 = a[883];
+    const real t4490 = t4489*t77;
+    const real t4491 = t4489*t126;
+    const real t4492 = t4489*t132;
+    const real t4493 = t4489*t136;
+    const real t4494 = a[1024];
+    const real t4495 = t4494*t139;
+    const real t4496 = a[722];
+    const real t4498 = t4476+t4477+t4478+t4480+t4481+t4483+t4485+t4487+t4488+t4490+t4491+
+t4492+t4493+t4495+t4496*t145;
+    const real t4500 = t4479*t5;
+    const real t4501 = t4479*t20;
+    const real t4502 = t4475*t26;
+    const real t4503 = t4475*t37;
+    const real t4504 = t4484*t50;
+    const real t4505 = t4482*t67;
+    const real t4506 = a[949];
+    const real t4507 = t4506*t139;
+    const real t4508 = a[644];
+    const real t4510 = t4494*t146;
+    const real t4512 = t4477+t4500+t4501+t4502+t4503+t4504+t4505+t4487+t4488+t4490+t4491+
+t4492+t4493+t4507+t4508*t145+t4510+t4496*t155;
+    const real t4514 = t4419*t20;
+    const real t4515 = t4417*t5;
+    const real t4516 = t4417*t26;
+    const real t4517 = t4419*t37;
+    const real t4518 = a[1135];
+    const real t4241 = t4518*t72;
+    const real t4242 = t4426*t73;
+    const real t4522 = (t4416+t4514+t4515+t4516+t4517+t4424+t4425+t4241+t4242)*t73;
+    const real t4523 = a[490];
+    const real t4524 = a[599];
+    const real t4525 = t4524*t5;
+    const real t4526 = t4524*t20;
+    const real t4527 = a[1096];
+    const real t4528 = t4527*t26;
+    const real t4529 = t4527*t37;
+    const real t4530 = a[1043];
+    const real t4531 = t4530*t50;
+    const real t4532 = a[931];
+    const real t4533 = t4532*t67;
+    const real t4534 = a[756];
+    const real t4535 = t4534*t72;
+    const real t4536 = t4534*t73;
+    const real t4537 = a[692];
+    const real t4538 = t4537*t77;
+    const real t4539 = t4537*t126;
+    const real t4540 = t4537*t132;
+    const real t4541 = t4537*t136;
+    const real t4542 = a[728];
+    const real t4544 = t4523+t4525+t4526+t4528+t4529+t4531+t4533+t4535+t4536+t4538+t4539+
+t4540+t4541+t4542*t139;
+    const real t4546 = t4283*t5;
+    const real t4547 = t4268*t20;
+    const real t4262 = t4546+t4267+t4547;
+    const real t4549 = t4262*t20;
+    const real t4550 = a[626];
+    const real t4551 = t4550*t5;
+    const real t4552 = a[298];
+    const real t4553 = t4550*t20;
+    const real t4554 = t4550*t26;
+    const real t4555 = t4550*t37;
+    const real t4556 = a[976];
+    const real t4557 = t4556*t50;
+    const real t4558 = t4556*t67;
+    const real t4559 = a[937];
+    const real t4560 = t4559*t72;
+    const real t4561 = t4559*t73;
+    const real t4562 = a[600];
+    const real t4563 = t4562*t77;
+    const real t4564 = t4562*t126;
+    const real t4565 = t4562*t132;
+    const real t4566 = t4562*t136;
+    const real t4567 = a[801];
+    const real t4569 = a[690];
+    const real t4264 = a[665];
+    const real t4574 = t4264*t179;
+    const real t4575 = t4551+t4552+t4553+t4554+t4555+t4557+t4558+t4560+t4561+t4563+t4564+
+t4565+t4566+t4567*t139+t4569*t145+t4567*t146+t4569*t155+t4574;
+    const real t4577 = a[571];
+    const real t4578 = t4577*t5;
+    const real t4579 = a[167];
+    const real t4580 = t4577*t20;
+    const real t4581 = t4577*t26;
+    const real t4582 = t4577*t37;
+    const real t4583 = a[689];
+    const real t4584 = t4583*t50;
+    const real t4585 = t4583*t67;
+    const real t4586 = a[574];
+    const real t4587 = t4586*t72;
+    const real t4588 = t4586*t73;
+    const real t4589 = a[921];
+    const real t4590 = t4589*t77;
+    const real t4591 = a[646];
+    const real t4592 = t4591*t126;
+    const real t4593 = t4589*t132;
+    const real t4594 = t4591*t136;
+    const real t4595 = a[779];
+    const real t4596 = t4595*t139;
+    const real t4597 = a[797];
+    const real t4598 = t4597*t145;
+    const real t4599 = t4595*t146;
+    const real t4600 = t4597*t155;
+    const real t4284 = a[591];
+    const real t4602 = t4284*t179;
+    const real t4603 = a[876];
+    const real t4604 = t4603*t275;
+    const real t4605 = a[944];
+    const real t4606 = t4605*t254;
+    const real t4607 = t4578+t4579+t4580+t4581+t4582+t4584+t4585+t4587+t4588+t4590+t4592+
+t4593+t4594+t4596+t4598+t4599+t4600+t4602+t4604+t4606;
+    const real t4609 = t4527*t5;
+    const real t4610 = t4527*t20;
+    const real t4611 = t4524*t26;
+    const real t4612 = t4524*t37;
+    const real t4613 = t4532*t50;
+    const real t4614 = t4530*t67;
+    const real t4615 = a[1100];
+    const real t4617 = t4506*t145;
+    const real t4619 = t4523+t4609+t4610+t4611+t4612+t4613+t4614+t4535+t4536+t4538+t4539+
+t4540+t4541+t4615*t139+t4617+t4542*t146;
+    const real t4621 = t4591*t77;
+    const real t4622 = t4589*t126;
+    const real t4623 = t4591*t132;
+    const real t4624 = t4589*t136;
+    const real t4625 = t4605*t275;
+    const real t4626 = t4578+t4579+t4580+t4581+t4582+t4584+t4585+t4587+t4588+t4621+t4622+
+t4623+t4624+t4596+t4598+t4599+t4600+t4602+t4625;
+    const real t4317 = t4448+t4454;
+    const real t4331 = t4464+t4472;
+    const real t4628 = t4444+t4317*t309+t4460+t4331*t240+t4498*t145+t4512*t155+t4522+t4544
+*t139+t4549+t4575*t179+t4607*t254+t4619*t146+t4626*t275;
+    const real t4633 = t4523+t4609+t4610+t4611+t4612+t4613+t4614+t4535+t4536+t4538+t4539+
+t4540+t4541+t4507+t4615*t145+t4510+t4542*t155;
+    const real t4635 = t4597*t139;
+    const real t4636 = t4595*t145;
+    const real t4637 = t4597*t146;
+    const real t4638 = t4595*t155;
+    const real t4639 = t4578+t4579+t4580+t4581+t4582+t4584+t4585+t4587+t4588+t4621+t4622+
+t4623+t4624+t4635+t4636+t4637+t4638+t4602+t4625;
+    const real t4641 = t4292+t4294+t4295+t4296+t4297+t4299+t4300+t4302+t4303+t4305+t4307+
+t4309;
+    const real t4642 = t4313*t139;
+    const real t4643 = t4311*t145;
+    const real t4644 = t4313*t146;
+    const real t4645 = t4311*t155;
+    const real t4646 = t4325*t212;
+    const real t4647 = t4323*t215;
+    const real t4648 = t4327*t309;
+    const real t4649 = t4310+t4642+t4643+t4644+t4645+t4318+t4320+t4322+t4646+t4647+t4452+
+t4648;
+    const real t4653 = t4476+t4477+t4478+t4480+t4481+t4483+t4485+t4487+t4488+t4490+t4491+
+t4492+t4493+t4496*t139;
+    const real t4659 = t4551+t4552+t4553+t4554+t4555+t4557+t4558+t4560+t4561+t4563+t4564+
+t4565+t4566+t4569*t139+t4567*t145+t4569*t146+t4567*t155+t4574;
+    const real t4662 = t4523+t4525+t4526+t4528+t4529+t4531+t4533+t4535+t4536+t4538+t4539+
+t4540+t4541+t4495+t4542*t145;
+    const real t4409 = t4641+t4649;
+    const real t4664 = t4266+t4633*t155+t4271+t4282+t4639*t275+t4291+t4409*t309+t4340+
+t4653*t139+t4659*t179+t4662*t145+t4415;
+    const real t4671 = t4389+t4391+t4392+t4395*t139+t4393*t145+t4395*t146+t4393*t155+t4400
++t4402+t4403+t4406*t212;
+    const real t4674 = t4205+t4223+t4642+t4643+t4644+t4645+t4461+t4646+t4647+t4292+t4302+
+t4318+t4462;
+    const real t4676 = t4327*t475;
+    const real t4677 = t4463+t4296+t4299+t4295+t4294+t4297+t4300+t4465+t4303+t4466+t4468+
+t4470*t309+t4676;
+    const real t4680 = t4198+t4200+t4202+t4203+t4206+t4208+t4210+t4218+t4220+t4228+t4230+
+t4232;
+    const real t4681 = t4215*t240;
+    const real t4682 = t4226*t143;
+    const real t4683 = t4224*t139;
+    const real t4684 = t4213*t145;
+    const real t4685 = t4224*t146;
+    const real t4686 = t4213*t155;
+    const real t4687 = t4236*t212;
+    const real t4688 = t4211*t215;
+    const real t4689 = t4233+t4234+t4681+t4682+t4469+t4683+t4684+t4685+t4686+t4687+t4688+
+t4235+t4238;
+    const real t4692 = t4578+t4579+t4580+t4581+t4582+t4584+t4585+t4587+t4588+t4590+t4592+
+t4593+t4594+t4635+t4636+t4637+t4638+t4602+t4604+t4606;
+    const real t4694 = t4233+t4203+t4228+t4232+t4200+t4206+t4198+t4218+t4235+t4445+t4446;
+    const real t4695 = t4215*t143;
+    const real t4696 = t4447+t4449+t4683+t4684+t4685+t4686+t4210+t4450+t4451+t4687+t4688+
+t4695;
+    const real t4701 = t4477+t4500+t4501+t4502+t4503+t4504+t4505+t4487+t4488+t4490+t4491+
+t4492+t4493+t4508*t139+t4617+t4496*t146;
+    const real t4703 = t4342+t4343+t4344+t4345+t4346+t4348+t4349+t4351+t4352+t4354+t4356;
+    const real t4709 = t4357+t4358+t4361*t139+t4359*t145+t4361*t146+t4359*t155+t4366+t4368
++t4369+t4405+t4370*t215;
+    const real t4509 = t4375+t4377+t4378+t4379+t4380+t4382+t4383+t4385+t4386+t4388+t4671;
+    const real t4513 = t4674+t4677;
+    const real t4520 = t4680+t4689;
+    const real t4545 = t4694+t4696;
+    const real t4570 = t4703+t4709;
+    const real t4712 = t4429+t4434+t4509*t212+t4444+t4460+t4513*t475+t4520*t240+t4522+
+t4692*t254+t4549+t4545*t143+t4701*t146+t4570*t215;
+    const real t4715 = a[285];
+    const real t4716 = t4715*t20;
+    const real t4717 = a[175];
+    const real t4718 = t4717*t5;
+    const real t4719 = t4193*t26;
+    const real t4725 = t3241+t3243+t3245+t3246+t3247+t3249+t3250+t3252+t3254+t3257*t77+
+t3255*t126+t3261*t132;
+    const real t4727 = t3242*t5;
+    const real t4728 = t3244*t20;
+    const real t4729 = t3242*t26;
+    const real t4730 = t3244*t37;
+    const real t4731 = t3253*t72;
+    const real t4732 = t3251*t73;
+    const real t4740 = t4178+t3267+t4179+t4180+t4181+t4182+t4183+t3277+t3278+t3280+t3281+
+t3282+t3283+t4186*t139+t4184*t145+t3284*t146+t3286*t155;
+    const real t4742 = t3215+t3214+t3216+t3218+t3219+t3221+t3222+t3224+t3225+t3784+t3785+
+t3787;
+    const real t4743 = t3197*t143;
+    const real t4744 = t3199*t309;
+    const real t4745 = t3788+t3227+t3229+t3230+t3231+t3233+t3793+t3794+t3235+t3237+t4743+
+t4744;
+    const real t4748 = t4715*t5;
+    const real t4749 = a[90];
+    const real t4752 = t4193*t37;
+    const real t4757 = t4727+t3241+t4728+t4729+t4730+t3249+t3250+t4731+t4732+t3259*t77+
+t3261*t126;
+    const real t4763 = a[511];
+    const real t4766 = t3166+t3168+t3169+t3170+t3171+t3173+t3174+t3176+t3177+t3180*t77+
+t3178*t126+t3180*t132+t3178*t136+t3185+t3186+t3187+t3188+t3190+t4763*t275+t3191
+*t254;
+    const real t4768 = t3306*t77;
+    const real t4769 = t3304*t126;
+    const real t4770 = t3306*t132;
+    const real t4771 = t3304*t136;
+    const real t4772 = t3291+t3292+t3293+t3295+t3296+t3298+t3300+t3302+t3303+t4768+t4769+
+t4770+t4771+t3315+t3316;
+    const real t4777 = t3483*t77;
+    const real t4778 = t3500*t126;
+    const real t4779 = t3485+t3506+t3504+t3509+t3510+t3499+t3511+t3497+t3512+t4777+t4778;
+    const real t4780 = t3483*t132;
+    const real t4781 = t3500*t136;
+    const real t4782 = t3507*t275;
+    const real t4783 = t3488*t254;
+    const real t4784 = t3481*t143;
+    const real t4785 = t4780+t4781+t3502+t3505+t3491+t3493+t3474+t4782+t4783+t3476+t3480+
+t4784;
+    const real t4793 = t3653+t3654+t3655+t3656+t3657+t3659+t3660+t3662+t3663+t3666*t77+
+t3664*t126+t3666*t132+t3664*t136+t3671+t3672+t3673+t3674+t3676+t3556+t3677*t254
+;
+    const real t4795 = t3402*t77;
+    const real t4797 = t3400*t126;
+    const real t4798 = t3402*t132;
+    const real t4799 = t3400*t136;
+    const real t4800 = t3417*t275;
+    const real t4801 = t3415*t254;
+    const real t4802 = t4797+t4798+t4799+t3644+t3645+t3646+t3647+t3414+t4800+t4801+t3648;
+    const real t4805 = t3389+t3390+t3391+t3392+t3393+t3395+t3396+t3398+t3399+t4795+t4797;
+    const real t4806 = t4798+t4799+t3408+t3410+t3411+t3412+t3414+t4800+t4801+t3420+t3422;
+    const real t4814 = t3530+t3532+t3533+t3534+t3535+t3537+t3538+t3540+t3541+t3544*t77+
+t3542*t126+t3544*t132+t3542*t136+t3549+t3550+t3551+t3552+t3554+t3557*t275;
+    const real t4665 = t3357*t77;
+    const real t4668 = t4779+t4785;
+    const real t4672 = t3389+t3390+t3391+t3392+t3393+t3395+t3396+t3398+t3399+t4795+t4802;
+    const real t4675 = t4805+t4806;
+    const real t4816 = t4772*t145+(t3342+t3344+t3345+t3346+t3347+t3349+t3350+t3352+t3354+
+t4665)*t77+t3376+t3387+t4668*t143+t4793*t254+t3472+t4672*t212+t4675*t215+t3570+
+t3577+t4814*t275;
+    const real t4818 = t3634+t3319+t3635+t3636+t3637+t3327+t3328+t3638+t3639+t3356+t3337*
+t126;
+    const real t4820 = t3436+t3437+t3434+t3429+t3446+t3448+t3449+t3427+t3433+t3431+t3478+
+t3450;
+    const real t4821 = t3455*t275;
+    const real t4822 = t3440*t77;
+    const real t4823 = t3453*t254;
+    const real t4824 = t3461*t240;
+    const real t4825 = t3438*t126;
+    const real t4826 = t3440*t132;
+    const real t4827 = t3438*t136;
+    const real t4828 = t3458+t3460+t3428+t3430+t3487+t4821+t4822+t4823+t4824+t3452+t4825+
+t4826+t4827;
+    const real t4831 = t3485+t3506+t3504+t3509+t3510+t3499+t3511+t3497+t3512+t4777+t4778+
+t4780;
+    const real t4832 = t3600*t143;
+    const real t4833 = t3481*t309;
+    const real t4834 = t4781+t3598+t3599+t3596+t3595+t3474+t4782+t4783+t3591+t3592+t4832+
+t4833;
+    const real t4839 = t3319+t3321+t3323+t3324+t3325+t3327+t3328+t3330+t3332+t3612+t3333*
+t126+t3615+t3337*t136;
+    const real t4845 = t3682+t3683+t3684+t3685+t3686+t3688+t3689+t3691+t3692+t3695*t77+
+t3693*t126+t3695*t132+t3693*t136+t3700+t3701+t3702+t3703+t3705;
+    const real t4847 = t3292+t3578+t3579+t3580+t3581+t3582+t3583+t3302+t3303+t4768+t4769+
+t4770+t4771+t3585+t3587+t3588;
+    const real t4849 = t3291+t3292+t3293+t3295+t3296+t3298+t3300+t3302+t3303+t4768+t4769+
+t4770+t4771+t3311;
+    const real t4853 = t3606+t3345+t3607+t3608+t3609+t3349+t3350+t3610+t3611+t3613*t77+
+t3336+t3357*t132;
+    const real t4855 = t3461*t475;
+    const real t4856 = t3436+t3437+t3434+t3429+t4855+t3427+t3433+t3431+t3428+t3430+t4821+
+t3594+t3518;
+    const real t4858 = t3521+t4822+t4823+t3519+t3520+t3452+t4825+t4826+t4827+t3602+t3524*
+t240+t3522+t3523;
+    const real t4861 = t3292+t3578+t3579+t3580+t3581+t3582+t3583+t3302+t3303+t4768+t4769+
+t4770+t4771+t3628+t3629+t3630+t3631;
+    const real t4707 = t4820+t4828;
+    const real t4710 = t4831+t4834;
+    const real t4723 = t4856+t4858;
+    const real t4863 = t4818*t126+t3627+t4707*t240+t4710*t309+t4839*t136+t4845*t179+t4847*
+t146+t4849*t139+t4853*t132+t4723*t475+t3710+t3714+t4861*t155;
+    const real t4872 = t3748+t3750+t3751+t3754*t139+t3752*t145+t3754*t146+t3752*t155+t3759
++t3761+t3762+t3765*t212;
+    const real t4875 = t4749*t5;
+    const real t4876 = t4193*t20;
+    const real t4880 = t3266+t3267+t3268+t3270+t3271+t3273+t3275+t3277+t3278+t3280+t3281+
+t3282+t3283+t3286*t139;
+    const real t4739 = t4435+t4628;
+    const real t4746 = t4664+t4712;
+    const real t4754 = t3261*t77;
+    const real t4759 = t4742+t4745;
+    const real t4764 = t4748+t4749*t26+t4717*t20+t4192+t4752;
+    const real t4774 = t4816+t4863;
+    const real t4776 = t3734+t3736+t3737+t3738+t3739+t3741+t3742+t3744+t3745+t3747+t4872;
+    const real t4882 = t4196+t4739*t3116+t4746*t3120+(t4192+t4716+t4718+t4719)*t26+t4725*
+t132+(t4727+t3241+t4728+t4729+t4730+t3249+t3250+t4731+t4732+t4754)*t77+t4740*
+t155+t4759*t309+t4764*t37+t4757*t126+t4766*t254+t4774*t2341+t4776*t212+(t4875+
+t4192+t4876)*t20+t4880*t139;
+    const real t4889 = t1163+t1124+t1126+t1164+t1130+t1337+t1338+t1339+t1340+t1348+t1145*
+t126;
+    const real t4893 = t1103+t1104+t1149+t1106+t1152+t1344+t1345+t1359+t1360+t1155*t77+
+t1355+t1120*t132;
+    const real t4897 = t1124+t1127+t1162+t1129+t1165+t1337+t1338+t1352+t1353+t1361+t1169*
+t126+t1363+t1145*t136;
+    const real t4899 = t1061+t1062+t1082+t1084+t1064+t1367+t1368+t1369+t1370+t1116+t1140+
+t1118+t1142+t1371;
+    const real t4901 = t1061+t1062+t1082+t1084+t1064+t1367+t1368+t1369+t1370+t1116+t1140+
+t1118+t1142+t1374+t1375;
+    const real t4903 = t1062+t1083+t1059+t1063+t1085+t1378+t1379+t1369+t1370+t1116+t1140+
+t1118+t1142+t1380+t1381+t1382;
+    const real t4905 = t1062+t1083+t1059+t1063+t1085+t1378+t1379+t1369+t1370+t1116+t1140+
+t1118+t1142+t1385+t1386+t1387+t1388;
+    const real t4911 = t1176+t1177+t1178+t1179+t1180+t1391+t1392+t1393+t1394+t1192*t77+
+t1194*t126+t1192*t132+t1194*t136+t1399+t1400+t1401+t1402+t1199;
+    const real t4925 = t1264*t275;
+    const real t4926 = t1239+t1240+t1241+t1242+t1243+t1247*t50+t1247*t67+t1244*t72+t1244*
+t73+t1256*t77+t1256*t126+t1256*t132+t1256*t136+t1250*t139+t1250*t145+t1250*t146
++t1250*t155+t1262+t4925;
+    const real t4933 = t1269+t1271+t1272+t1273+t1274+t1405+t1406+t1407+t1408+t1287*t77+
+t1289*t126+t1287*t132+t1289*t136+t1413+t1414+t1415+t1416+t1294+t4925+t1295*t254
+;
+    const real t4843 = t1120*t77;
+    const real t4864 = t4933*t254;
+    const real t4935 = t991+t996+t1316+t1318+t1322+t1325+t1329+t1332+t1336+(t1150+t1102+
+t1103+t1151+t1107+t1344+t1345+t1346+t1347+t4843)*t77+t4889*t126+t4893*t132+
+t4897*t136+t4899*t139+t4901*t145+t4903*t146+t4905*t155+t4911*t179+t4926*t275+
+t4864;
+    const real t4865 = t480*t5;
+    const real t4944 = (t479+t4865)*t5;
+    const real t4867 = t478+t472+t726;
+    const real t4946 = t4867*t20;
+    const real t4947 = t492*t5;
+    const real t4868 = t485+t479+t4947+t729;
+    const real t4949 = t4868*t26;
+    const real t4951 = t473*t37;
+    const real t4870 = t491+t472+t494+t486*t20+t4951;
+    const real t4953 = t4870*t37;
+    const real t4954 = t505*t37;
+    const real t4955 = t501*t5;
+    const real t4871 = t754+t4954+t500+t753+t4955+t508;
+    const real t4957 = t4871*t50;
+    const real t4958 = t498*t37;
+    const real t4959 = t503*t5;
+    const real t4873 = t747+t500+t4958+t748+t4959+t513+t517;
+    const real t4961 = t4873*t67;
+    const real t4962 = t537*t5;
+    const real t4963 = t535*t37;
+    const real t4874 = t546*t72;
+    const real t4966 = (t741+t534+t4962+t742+t4963+t542+t543+t4874)*t72;
+    const real t4967 = t520*t5;
+    const real t4968 = t522*t37;
+    const real t4878 = t530*t73;
+    const real t4971 = (t524+t4967+t736+t737+t4968+t528+t529+t545+t4878)*t73;
+    const real t4972 = t585*t5;
+    const real t4973 = t587*t37;
+    const real t4976 = t599*t77;
+    const real t4979 = t605*t5;
+    const real t4980 = t603*t37;
+    const real t4981 = t615*t72;
+    const real t4982 = t613*t73;
+    const real t4984 = t607+t831+t4979+t832+t4980+t611+t612+t4981+t4982+t4976+t617*t126;
+    const real t4885 = t584+t4972+t819+t820+t4973+t592+t593+t596*t72+t594*t73+t4976;
+    const real t4887 = t4984*t126;
+    const real t4986 = t471+t4944+t4946+t4949+t4953+t4957+t4961+t4966+t4971+t4885*t77+
+t4887;
+    const real t4888 = t8+t2+t9;
+    const real t4890 = t4888*t20;
+    const real t4892 = (t12+t14+t16+t18)*t26;
+    const real t4895 = t21*t26+t12+t23+t24+t25;
+    const real t4896 = t4895*t37;
+    const real t4898 = t29+t30+t31+t32+t33+t35;
+    const real t4900 = t4898*t50;
+    const real t4902 = t45*t67;
+    const real t4906 = (t39+t40+t41+t43+t44+t35+t4902)*t67;
+    const real t4915 = t720*t20;
+    const real t4917 = (t719+t716+t4915)*t20;
+    const real t4924 = t1303+t1305+t1307;
+    const real t4927 = t4924*t20;
+    const real t4928 = t720*t26;
+    const real t4930 = (t719+t1307+t716+t4928)*t26;
+    const real t4941 = t720*t5;
+    const real t4943 = (t719+t4941)*t5;
+    const real t4988 = (t1+t6+t4890+t4892+t4896+t4900+t4906)*t67+(t257+t468)*t475+t621*
+t136+(t633+t710)*t309+(t713+t718+t4917)*t20+t840*t155+t989*t179+(t1081+t1300)*
+t215+(t713+t718+t4927+t4930)*t26+t1420*t275+(t2406+t3150)*t2341+(t4191+t4882)*
+t4135+t4935*t254+(t713+t4943)*t5+t4986*t126;
+    const real t4952 = t17*t5;
+    const real t4991 = (t12+t4952)*t5;
+    const real t4992 = t21*t5;
+    const real t4993 = t17*t20;
+    const real t4996 = t3*t26;
+    const real t5000 = t3*t37;
+    const real t5003 = t42*t5;
+    const real t5004 = t42*t20;
+    const real t5005 = t38*t26;
+    const real t5006 = t38*t37;
+    const real t5012 = t580*t77;
+    const real t5015 = t562*t126;
+    const real t5016 = t551+t552+t553+t554+t555+t557+t558+t560+t561+t579+t5015;
+    const real t5019 = t604+t606+t607+t608+t609+t611+t612+t614+t616+t5012+t5015+t617*t132;
+    const real t4964 = t566+t568+t569+t570+t571+t573+t574+t576+t577+t5012;
+    const real t4970 = t5019*t132;
+    const real t5021 = t471+t476+t483+t490+t497+t510+t519+t533+t549+t4964*t77+t5016*t126+
+t4970;
+    const real t4974 = t479+t4947+t481;
+    const real t5024 = t4974*t20;
+    const real t4975 = t478+t472+t485+t488;
+    const real t5026 = t4975*t26;
+    const real t4978 = t732+t491+t472+t486*t26+t4951;
+    const real t5029 = t4978*t37;
+    const real t4983 = t546*t50;
+    const real t5032 = (t534+t4962+t538+t539+t4963+t4983)*t50;
+    const real t4987 = t530*t67;
+    const real t5035 = (t524+t4967+t521+t525+t4968+t743+t4987)*t67;
+    const real t4990 = t516+t4955+t529+t4954+t542+t511+t500+t749;
+    const real t5037 = t4990*t72;
+    const real t4994 = t4958+t506+t542+t500+t529+t502+t752+t4959+t755;
+    const real t5039 = t4994*t73;
+    const real t5040 = t760*t5;
+    const real t5041 = t758*t37;
+    const real t5042 = t768*t50;
+    const real t5043 = t766*t67;
+    const real t4995 = t762+t782+t5040+t783+t5041+t5042+t5043+t770+t771+t773;
+    const real t5045 = t4995*t77;
+    const real t5046 = t762+t782+t5040+t783+t5041+t5042+t5043+t770+t771+t777+t778;
+    const real t5047 = t5046*t126;
+    const real t5048 = t760*t20;
+    const real t5049 = t758*t26;
+    const real t5050 = t762+t764+t5048+t5049+t765+t5042+t5043+t785+t786+t788+t790+t791;
+    const real t5051 = t5050*t132;
+    const real t5052 = t762+t764+t5048+t5049+t765+t5042+t5043+t785+t786+t794+t795+t796+
+t797;
+    const real t5053 = t5052*t136;
+    const real t5054 = t615*t50;
+    const real t5055 = t613*t67;
+    const real t5057 = t607+t4979+t606+t608+t4980+t5054+t5055+t835+t836+t773+t778+t791+
+t797+t617*t139;
+    const real t4998 = t5057*t139;
+    const real t5059 = t471+t4944+t5024+t5026+t5029+t5032+t5035+t5037+t5039+t5045+t5047+
+t5051+t5053+t4998;
+    const real t5061 = t2493*t77;
+    const real t5062 = t2476*t126;
+    const real t5063 = t2493*t132;
+    const real t5064 = t2509+t2507+t2510+t2511+t2512+t2489+t2488+t2486+t2492+t5061+t5062+
+t5063;
+    const real t5065 = t2476*t136;
+    const real t5066 = t2499*t275;
+    const real t5067 = t2497*t254;
+    const real t5068 = t3009*t143;
+    const real t5069 = t2490*t309;
+    const real t5070 = t5065+t3011+t3012+t3013+t3015+t2514+t5066+t5067+t3006+t3007+t5068+
+t5069;
+    const real t5078 = t3121+t3123+t3124+t3125+t3126+t3128+t3129+t3131+t3132+t3135*t77+
+t3133*t126+t3135*t132+t3133*t136+t3140+t3141+t3142+t3143+t3145+t2561+t3146*t254
+;
+    const real t5082 = t1885+t1444+t1886+t1887+t1888+t1448+t1449+t1889+t1890+t1892*t77+
+t1860+t1456*t132;
+    const real t5084 = t1914*t77;
+    const real t5085 = t1912*t126;
+    const real t5086 = t1914*t132;
+    const real t5087 = t1912*t136;
+    const real t5088 = t1900+t2407+t2408+t2409+t2410+t2411+t2412+t1910+t1911+t5084+t5085+
+t5086+t5087+t2461+t2462;
+    const real t5092 = t2622+t2845+t2624+t2846+t2628+t2933+t2934+t2935+t2936+t2664+t2642*
+t126+t2668+t2646*t136;
+    const real t5093 = t5092*t136;
+    const real t5094 = t2921*t77;
+    const real t5095 = t2919*t126;
+    const real t5096 = t2921*t132;
+    const real t5097 = t2919*t136;
+    const real t5098 = t2909+t2910+t2911+t2912+t2913+t2915+t2916+t2917+t2918+t5094+t5095+
+t5096+t5097+t3073+t3074+t3075+t3076+t2930;
+    const real t5100 = t2695*t126;
+    const real t5101 = t2697*t77;
+    const real t5102 = t2710*t254;
+    const real t5103 = t2712*t275;
+    const real t5104 = t2697*t132;
+    const real t5105 = t2695*t136;
+    const real t5106 = t5100+t5101+t5102+t5103+t5104+t5105+t2892+t2893+t2683+t2685+t2686+
+t2687;
+    const real t5107 = t2688+t2690+t2691+t2693+t2694+t3023+t3024+t3025+t3026+t2709+t3027+
+t3028+t3083;
+    const real t5014 = t2669*t77;
+    const real t5112 = (t2654+t2673+t2674+t2675+t2676+t2658+t2659+t2677+t2678+t5014)*t77;
+    const real t5115 = t2651+t2653+t2654+t2655+t2656+t2658+t2659+t2661+t2663+t2665*t77+
+t2938+t2669*t132;
+    const real t5116 = t5115*t132;
+    const real t5118 = t2622+t2844+t2625+t2627+t2847+t2933+t2934+t2942+t2943+t2679+t2646*
+t126;
+    const real t5119 = t5118*t126;
+    const real t5120 = t2873*t77;
+    const real t5122 = t2871*t126;
+    const real t5123 = t2873*t132;
+    const real t5124 = t2871*t136;
+    const real t5125 = t2967*t275;
+    const real t5126 = t5122+t5123+t5124+t3038+t3039+t3040+t3041+t2878+t5125+t2596+t3042;
+    const real t5129 = t2704*t77;
+    const real t5130 = t2702*t126;
+    const real t5131 = t2704*t132;
+    const real t5132 = t2683+t2685+t2686+t2687+t2688+t2904+t2885+t2903+t2886+t5129+t5130+
+t5131;
+    const real t5133 = t2702*t136;
+    const real t5134 = t2716*t275;
+    const real t5135 = t2714*t254;
+    const real t5136 = t5133+t3069+t3066+t3068+t3061+t2709+t5134+t5135+t3064+t3065+t3083+
+t2721;
+    const real t5139 = t2771*t77;
+    const real t5140 = t2771*t132;
+    const real t5141 = t2651+t2654+t2674+t2675+t2656+t2766+t2767+t2768+t2769+t5139+t2639+
+t5140+t2641+t3033+t2645+t3034;
+    const real t5143 = t2794*t77;
+    const real t5144 = t2796*t126;
+    const real t5145 = t2781+t2783+t2784+t2804+t2805+t2791+t2806+t2807+t2808+t5143+t5144;
+    const real t5146 = t2794*t132;
+    const real t5147 = t2796*t136;
+    const real t5148 = t2792*t275;
+    const real t5149 = t2799*t254;
+    const real t5151 = t5146+t5147+t3087+t3084+t3088+t3085+t2802+t5148+t5149+t3086+t3080+
+t2815*t143;
+    const real t5027 = t5106+t5107;
+    const real t5030 = t2854+t2855+t2856+t2857+t2858+t2953+t2954+t2955+t2956+t5120+t5126;
+    const real t5033 = t5132+t5136;
+    const real t5038 = t5145+t5151;
+    const real t5154 = t5093+t5098*t179+t2612+t2621+t5027*t240+t5112+t5116+t5119+t5030*
+t212+t5033*t309+t5141*t146+t5038*t143;
+    const real t5155 = t2636*t126;
+    const real t5156 = t2636*t136;
+    const real t5157 = t2622+t2624+t2625+t2627+t2628+t2630+t2632+t2634+t2635+t2770+t5155+
+t2773+t5156+t2775+t3046+t2777+t3047;
+    const real t5160 = t2751*t275;
+    const real t5161 = t2749*t254;
+    const real t5162 = t2718*t240;
+    const real t5163 = t2725+t3060+t2729+t2755*t475+t5160+t5161+t5162+t2733+t2734+t3100+
+t3101+t3102+t2748;
+    const real t5164 = t2736*t136;
+    const real t5165 = t2738*t132;
+    const real t5166 = t2736*t126;
+    const real t5167 = t2738*t77;
+    const real t5168 = t3103+t3104+t2735+t5164+t5165+t5166+t5167+t2788+t3099+t2728+t2727+
+t2730+t2732;
+    const real t5171 = t2867*t77;
+    const real t5172 = t2865*t126;
+    const real t5173 = t2867*t132;
+    const real t5174 = t2865*t136;
+    const real t5175 = t2881*t275;
+    const real t5176 = t2854+t2855+t2856+t2857+t2858+t2860+t2861+t2863+t2864+t5171+t5172+
+t5173+t5174+t3092+t3093+t3094+t3095+t2878+t5175;
+    const real t5178 = t2654+t2673+t2653+t2655+t2676+t2947+t2948+t2768+t2769+t5139+t2639+
+t5140+t2641+t3057;
+    const real t5180 = t2622+t2844+t2845+t2846+t2847+t2848+t2849+t2634+t2635+t2770+t5155+
+t2773+t5156+t2949+t3019;
+    const real t5182 = t2587*t77;
+    const real t5183 = t2585*t126;
+    const real t5184 = t2587*t132;
+    const real t5185 = t2585*t136;
+    const real t5186 = t2597*t254;
+    const real t5187 = t2567+t2568+t2569+t2570+t2571+t2977+t2978+t2979+t2980+t5182+t5183+
+t5184+t5185+t3051+t3052+t3053+t3054+t2592+t2880+t5186;
+    const real t5189 = t2581*t77;
+    const real t5190 = t2578*t126;
+    const real t5191 = t2567+t2568+t2569+t2570+t2571+t2573+t2574+t2576+t2577+t5189+t5190;
+    const real t5192 = t2581*t132;
+    const real t5193 = t2578*t136;
+    const real t5194 = t2593*t254;
+    const real t5195 = t5192+t5193+t3110+t3111+t3112+t3113+t2592+t2966+t5194+t2969+t3114;
+    const real t5060 = t5163+t5168;
+    const real t5076 = t5191+t5195;
+    const real t5198 = t5157*t155+t5060*t475+t2765+t5176*t275+t5178*t139+t2830+t2835+t2839
++t2843+t5180*t145+t5187*t254+t5076*t215+t2976;
+    const real t5205 = t2435+t2436+t2437+t2438+t2439+t2441+t2442+t2444+t2445+t2448*t77+
+t2446*t126+t2448*t132+t2446*t136+t2453+t2454+t2455+t2456+t2458;
+    const real t5212 = t2535+t2537+t2538+t2539+t2540+t2542+t2543+t2545+t2546+t2549*t77+
+t2547*t126+t2549*t132+t2547*t136+t2554+t2555+t2556+t2557+t2559+t2562*t275;
+    const real t5217 = t1900+t2407+t2408+t2409+t2410+t2411+t2412+t1910+t1911+t5084+t5085+
+t5086+t5087+t2413;
+    const real t5220 = t1423+t1424+t1426+t1427+t1428+t1430+t1431+t1433+t1435+t1455+t1436*
+t126;
+    const real t5222 = t1497*t475;
+    const real t5223 = t1472*t136;
+    const real t5224 = t1489*t275;
+    const real t5226 = t1487*t254;
+    const real t5227 = t1472*t126;
+    const real t5228 = t1474*t77;
+    const real t5229 = t5222+t3005+t1467+t1468+t1470+t1480+t1460+t5223+t5224+t1495*t240+
+t5226+t5227+t5228;
+    const real t5230 = t1474*t132;
+    const real t5231 = t1471+t3008+t5230+t1482+t1483+t1492+t1494+t1484+t1486+t1462+t1463+
+t1464+t1465;
+    const real t5111 = t5064+t5070;
+    const real t5127 = t5154+t5198;
+    const real t5142 = t1456*t77;
+    const real t5159 = t5229+t5231;
+    const real t5234 = t5111*t309+t1850+t5078*t254+t5082*t132+t1877+t5088*t145+t5127*t3120
++t5205*t179+t5212*t275+t1884+(t1441+t1443+t1444+t1445+t1446+t1448+t1449+t1451+
+t1453+t5142)*t77+t5217*t139+t5220*t126+t5159*t475;
+    const real t5235 = t1957*t77;
+    const real t5236 = t1954*t126;
+    const real t5237 = t1942+t1944+t1945+t1946+t1947+t1949+t1950+t1952+t1953+t5235+t5236;
+    const real t5238 = t1957*t132;
+    const real t5239 = t1954*t136;
+    const real t5240 = t1971*t275;
+    const real t5241 = t1969*t254;
+    const real t5242 = t5238+t5239+t2466+t2467+t2468+t2469+t1968+t5240+t5241+t2471+t2472;
+    const real t5245 = t1497*t240;
+    const real t5246 = t5245+t2481+t1467+t1468+t1470+t1460+t5223+t5224+t5226+t5227+t5228+
+t1471;
+    const real t5247 = t5230+t2424+t2425+t2426+t2427+t2428+t2429+t1486+t2516+t1462+t1463+
+t1464+t1465;
+    const real t5252 = t1851+t1852+t1424+t1853+t1854+t1430+t1431+t1855+t1856+t1891+t1857*
+t126+t1894+t1436*t136;
+    const real t5254 = t2509+t2507+t2510+t2511+t2512+t2489+t2488+t2486+t2492+t5061+t5062;
+    const real t5255 = t2490*t143;
+    const real t5256 = t5063+t5065+t2482+t2484+t2479+t2495+t2514+t5066+t5067+t2504+t2506+
+t5255;
+    const real t5260 = t5190+t5192+t5193+t2586+t2588+t2589+t2590+t2592+t2966+t5194+t2598;
+    const real t5263 = t3062+t3063+t5100+t5101+t5102+t5103+t5104+t5105+t2683+t2685+t2686+
+t2687+t2688;
+    const real t5264 = t2690+t2691+t2693+t2694+t5162+t2786+t2709+t2703+t2705+t2706+t2707+
+t2715+t2717;
+    const real t5267 = t2651+t2654+t2674+t2675+t2656+t2766+t2767+t2768+t2769+t5139+t2639+
+t5140+t2641+t2775+t2776+t2777+t2778;
+    const real t5269 = t2909+t2910+t2911+t2912+t2913+t2915+t2916+t2917+t2918+t5094+t5095+
+t5096+t5097+t2925+t2926+t2927+t2928+t2930;
+    const real t5271 = t2683+t2685+t2686+t2687+t2688+t2904+t2885+t2903+t2886+t5129+t5130;
+    const real t5272 = t5131+t5133+t2894+t2890+t2887+t2895+t2709+t5134+t5135+t2889+t2888+
+t3029;
+    const real t5275 = t2854+t2855+t2856+t2857+t2858+t2860+t2861+t2863+t2864+t5171+t5172+
+t5173+t5174+t2872+t2874+t2875+t2876+t2878+t5175;
+    const real t5179 = t2567+t2568+t2569+t2570+t2571+t2573+t2574+t2576+t2577+t5189+t5260;
+    const real t5188 = t5263+t5264;
+    const real t5200 = t5271+t5272;
+    const real t5277 = t5093+t2612+t2621+t5179*t212+t5188*t475+t5267*t155+t5269*t179+t5112
++t5200*t143+t5275*t275+t5116+t5119;
+    const real t5278 = t2622+t2844+t2845+t2846+t2847+t2848+t2849+t2634+t2635+t2770+t5155+
+t2773+t5156+t2850;
+    const real t5280 = t2654+t2673+t2653+t2655+t2676+t2947+t2948+t2768+t2769+t5139+t2639+
+t5140+t2641+t2949+t2950;
+    const real t5282 = t2622+t2624+t2625+t2627+t2628+t2630+t2632+t2634+t2635+t2770+t5155+
+t2773+t5156+t2643+t2645+t2647;
+    const real t5284 = t2854+t2855+t2856+t2857+t2858+t2953+t2954+t2955+t2956+t5120+t5122;
+    const real t5285 = t5123+t5124+t2962+t2963+t2964+t2965+t2878+t5125+t2596+t2969+t2970;
+    const real t5288 = t2567+t2568+t2569+t2570+t2571+t2977+t2978+t2979+t2980+t5182+t5183+
+t5184+t5185+t2985+t2986+t2987+t2988+t2592+t2880+t5186;
+    const real t5290 = t2781+t2783+t2784+t2804+t2805+t2791+t2806+t2807+t2808+t5143+t5144+
+t5146;
+    const real t5292 = t5147+t2809+t2810+t2811+t2812+t2802+t5148+t5149+t2813+t2814+t3083+
+t2815*t309;
+    const real t5296 = t2725+t2755*t240+t2729+t5160+t5161+t2733+t2734+t2748+t2735+t5164+
+t5165+t5166;
+    const real t5297 = t5167+t3081+t2728+t2743+t2744+t2745+t2753+t2754+t2719+t2746+t2727+
+t2730+t2732;
+    const real t5209 = t5284+t5285;
+    const real t5213 = t5290+t5292;
+    const real t5215 = t5296+t5297;
+    const real t5300 = t5278*t139+t5280*t145+t5282*t146+t2765+t2830+t2835+t2839+t2843+
+t5209*t215+t5288*t254+t5213*t309+t2976+t5215*t240;
+    const real t5303 = t1899+t1900+t1901+t1903+t1904+t1906+t1908+t1910+t1911+t5084+t5085+
+t5086+t5087+t1919+t1921+t1923;
+    const real t5306 = t5236+t5238+t5239+t1962+t1964+t1965+t1966+t1968+t5240+t5241+t1974;
+    const real t5310 = t2335+t2336+t1982+t2337+t2338+t1986+t1987+t2339+t2340+t2395+t1996*
+t126;
+    const real t5316 = t2310+t2308+t2311+t2312+t2313+t2315+t2316+t2318+t2319+t2322*t77+
+t2320*t126+t2322*t132+t2320*t136+t2327+t2328+t2329+t2330+t2332;
+    const real t5320 = t2358+t2359+t2361+t2362+t2363+t2365+t2366+t2368+t2370+t2372*t77+
+t1995+t2376*t132;
+    const real t5322 = t2147*t77;
+    const real t5324 = t2145*t126;
+    const real t5325 = t2147*t132;
+    const real t5326 = t2145*t136;
+    const real t5327 = t2162*t275;
+    const real t5328 = t2160*t254;
+    const real t5329 = t5324+t5325+t5326+t2219+t2220+t2221+t2222+t2159+t5327+t5328+t2223;
+    const real t5332 = t2100*t77;
+    const real t5333 = t2098*t126;
+    const real t5334 = t2100*t132;
+    const real t5335 = t2098*t136;
+    const real t5336 = t2237+t2086+t2238+t2239+t2240+t2241+t2242+t2096+t2097+t5332+t5333+
+t5334+t5335+t2244+t2246+t2247;
+    const real t5340 = t1981+t1979+t1982+t1983+t1984+t1986+t1987+t1989+t1991+t2371+t1992*
+t126+t2375+t1996*t136;
+    const real t5253 = t2134+t2135+t2136+t2137+t2138+t2140+t2141+t2143+t2144+t5322+t5329;
+    const real t5342 = t2052+t5310*t126+t5316*t179+t2125+t2132+t2177+t2188+t5320*t132+
+t5253*t212+t5336*t146+t2236+t5340*t136;
+    const real t5343 = t2086+t2085+t2087+t2089+t2090+t2092+t2094+t2096+t2097+t5332+t5333+
+t5334+t5335+t2250;
+    const real t5345 = t2086+t2085+t2087+t2089+t2090+t2092+t2094+t2096+t2097+t5332+t5333+
+t5334+t5335+t2105+t2107;
+    const real t5347 = t2303*t240;
+    const real t5348 = t2268+t2272+t2273+t2034+t5347+t2294+t2038+t2270+t2271+t2275+t2276+
+t2278;
+    const real t5349 = t2295*t254;
+    const real t5350 = t2280*t126;
+    const real t5351 = t2282*t77;
+    const real t5352 = t2297*t275;
+    const real t5353 = t2282*t132;
+    const real t5354 = t2280*t136;
+    const real t5355 = t2279+t2288+t5349+t5350+t5351+t5352+t5353+t5354+t2290+t2291+t2300+
+t2302+t2292;
+    const real t5358 = t2345+t2346+t2268+t2347+t2348+t2349+t2350+t2272+t2273+t2254+t2294+
+t2270+t2271;
+    const real t5359 = t2303*t475;
+    const real t5361 = t2275+t2276+t2278+t2279+t5359+t5349+t5350+t5351+t5352+t5353+t5354+
+t2351*t240+t2260;
+    const real t5364 = t2000*t77;
+    const real t5365 = t2002*t126;
+    const real t5366 = t2000*t132;
+    const real t5367 = t2027+t2024+t2028+t2029+t2030+t2011+t2012+t2009+t2025+t5364+t5365+
+t5366;
+    const real t5368 = t2002*t136;
+    const real t5369 = t2035*t275;
+    const real t5370 = t2021*t254;
+    const real t5371 = t2256*t143;
+    const real t5372 = t2039*t309;
+    const real t5373 = t5368+t2262+t2264+t2261+t2258+t2032+t5369+t5370+t2263+t2259+t5371+
+t5372;
+    const real t5376 = t2237+t2086+t2238+t2239+t2240+t2241+t2242+t2096+t2097+t5332+t5333+
+t5334+t5335+t2380+t2381+t2382+t2383;
+    const real t5383 = t2055+t2054+t2056+t2057+t2058+t2060+t2061+t2063+t2064+t2067*t77+
+t2065*t126+t2067*t132+t2065*t136+t2072+t2073+t2074+t2075+t2077+t2080*t275;
+    const real t5390 = t2191+t2189+t2192+t2193+t2194+t2196+t2197+t2199+t2200+t2203*t77+
+t2201*t126+t2203*t132+t2201*t136+t2208+t2209+t2210+t2211+t2213+t2079+t2214*t254
+;
+    const real t5392 = t2134+t2135+t2136+t2137+t2138+t2140+t2141+t2143+t2144+t5322+t5324;
+    const real t5393 = t5325+t5326+t2153+t2155+t2156+t2157+t2159+t5327+t5328+t2165+t2167;
+    const real t5396 = t2027+t2024+t2028+t2029+t2030+t2011+t2012+t2009+t2025+t5364+t5365;
+    const real t5397 = t2039*t143;
+    const real t5398 = t5366+t5368+t2007+t2023+t2013+t2015+t2032+t5369+t5370+t2017+t2019+
+t5397;
+    const real t5287 = t5348+t5355;
+    const real t5291 = t5358+t5361;
+    const real t5294 = t5367+t5373;
+    const real t5302 = t5392+t5393;
+    const real t5305 = t5396+t5398;
+    const real t5308 = t2376*t77;
+    const real t5404 = t5343*t139+t5345*t145+t5287*t240+t5291*t475+t5294*t309+t2388+t5376*
+t155+t5383*t275+t2402+t5390*t254+t5302*t215+t5305*t143+(t2389+t2390+t2359+t2391
++t2392+t2365+t2366+t2393+t2394+t5308)*t77;
+    const real t5407 = t1899+t1900+t1901+t1903+t1904+t1906+t1908+t1910+t1911+t5084+t5085+
+t5086+t5087+t2416+t2417+t2419+t2420;
+    const real t5312 = t5237+t5242;
+    const real t5314 = t5246+t5247;
+    const real t5318 = t5254+t5256;
+    const real t5321 = t5277+t5300;
+    const real t5331 = t1942+t1944+t1945+t1946+t1947+t1949+t1950+t1952+t1953+t5235+t5306;
+    const real t5339 = (t5342+t5404)*t2404;
+    const real t5409 = t5312*t215+t5314*t240+t5252*t136+t5318*t143+t1930+t1941+t5321*t3116
++t2525+t2534+t5303*t146+t3003+t5331*t212+t5339+t5407*t155;
+    const real t5414 = t599*t139;
+    const real t5415 = t584+t4972+t586+t589+t4973+t596*t50+t594*t67+t823+t824+t777+t825+
+t796+t826+t5414;
+    const real t5418 = t607+t4979+t606+t608+t4980+t5054+t5055+t835+t836+t773+t778+t791+
+t797+t5414+t617*t145;
+    const real t5360 = t5418*t145;
+    const real t5420 = t471+t4944+t5024+t5026+t5029+t5032+t5035+t5037+t5039+t5045+t5047+
+t5051+t5053+t5415*t139+t5360;
+    const real t5422 = t1306*t5;
+    const real t5425 = t715*t20;
+    const real t5429 = t715*t26;
+    const real t5437 = t580*t139;
+    const real t5438 = t566+t568+t569+t570+t571+t809+t810+t811+t812+t788+t795+t813+t814+
+t5437;
+    const real t5440 = t562*t145;
+    const real t5441 = t551+t552+t553+t554+t555+t800+t801+t802+t803+t794+t790+t804+t805+
+t815+t5440;
+    const real t5444 = t604+t607+t831+t832+t609+t833+t834+t835+t836+t773+t778+t791+t797+
+t5437+t5440+t617*t146;
+    const real t5375 = t5444*t146;
+    const real t5446 = t471+t476+t728+t731+t735+t740+t746+t751+t757+t775+t780+t793+t799+
+t5438*t139+t5441*t145+t5375;
+    const real t5448 = t282*t145;
+    const real t5449 = t65*t155;
+    const real t5450 = t51+t278+t55+t56+t279+t403+t404+t89+t90+t92+t94+t95+t96+t462+t5448+
+t464+t5449;
+    const real t5452 = t328+t695+t330+t331+t332+t334+t335+t337+t338+t339+t340+t349;
+    const real t5454 = t186*t309;
+    const real t5455 = t344*t139;
+    const real t5456 = t341*t145;
+    const real t5457 = t344*t146;
+    const real t5458 = t341*t155;
+    const real t5459 = t351*t212;
+    const real t5460 = t327*t215;
+    const real t5461 = t325*t240+t5454+t353+t354+t355+t356+t357+t5455+t5456+t5457+t5458+
+t5459+t5460;
+    const real t5464 = t65*t145;
+    const real t5465 = t51+t53+t85+t86+t57+t87+t88+t89+t90+t92+t94+t95+t96+t306+t5464;
+    const real t5467 = t109+t107+t108+t110+t111+t361+t362+t363+t364+t365+t366;
+    const real t5474 = t367+t369+t131*t139+t137*t145+t131*t146+t137*t155+t127+t374+t375+
+t133*t212+t135*t215+t695;
+    const real t5387 = (t5452+t5461)*t240;
+    const real t5389 = t5467+t5474;
+    const real t5477 = t68+t69+t74+t79+t84+t105+t5450*t155+t5387+t5465*t145+t157+t5389*
+t143+t256;
+    const real t5479 = t230*t139;
+    const real t5480 = t228*t145;
+    const real t5481 = t230*t146;
+    const real t5482 = t228*t155;
+    const real t5483 = t244*t212;
+    const real t5484 = t386+t388+t389+t5479+t5480+t5481+t5482+t241+t395+t397+t5483;
+    const real t5487 = t319*t139;
+    const real t5488 = t274*t146;
+    const real t5489 = t262+t314+t261+t263+t315+t460+t461+t299+t300+t301+t303+t304+t305+
+t5487+t406+t5488;
+    const real t5491 = t204*t139;
+    const real t5492 = t202*t145;
+    const real t5493 = t204*t146;
+    const real t5494 = t202*t155;
+    const real t5495 = t191+t193+t194+t195+t196+t198+t199+t200+t201+t203+t205+t206+t207+
+t5491+t5492+t5493+t5494+t213;
+    const real t5497 = t236*t139;
+    const real t5498 = t234*t145;
+    const real t5499 = t236*t146;
+    const real t5500 = t234*t155;
+    const real t5501 = t217+t218+t219+t220+t221+t223+t224+t226+t227+t229+t231+t232+t233+
+t5497+t5498+t5499+t5500+t241+t243+t245;
+    const real t5503 = t159+t160+t161+t162+t163+t165+t166+t167+t168+t170+t171+t173;
+    const real t5504 = t174+t175+t176+t177+t178+t180+t182+t183+t184+t185+t119+t5454;
+    const real t5507 = t274*t139;
+    const real t5508 = t259+t262+t295+t296+t264+t297+t298+t299+t300+t301+t303+t304+t305+
+t5507;
+    const real t5510 = t410+t412+t413+t414+t415+t417+t418+t420+t421+t423+t426;
+    const real t5511 = t431*t139;
+    const real t5512 = t429*t145;
+    const real t5513 = t431*t146;
+    const real t5514 = t429*t155;
+    const real t5515 = t440*t215;
+    const real t5516 = t427+t428+t5511+t5512+t5513+t5514+t436+t438+t439+t398+t5515;
+    const real t5519 = t425*t139;
+    const real t5520 = t422*t145;
+    const real t5521 = t425*t146;
+    const real t5522 = t422*t155;
+    const real t5523 = t410+t412+t413+t414+t415+t445+t446+t447+t448+t449+t450+t451+t452+
+t5519+t5520+t5521+t5522+t436+t457;
+    const real t5394 = t217+t218+t219+t220+t221+t381+t382+t383+t384+t385+t5484;
+    const real t5402 = t5503+t5504;
+    const real t5406 = t5510+t5516;
+    const real t5525 = t277+t288+t5394*t212+t294+t313+t5489*t146+t5495*t179+t5501*t254+
+t5402*t309+t324+t5508*t139+t5406*t215+t5523*t275;
+    const real t5533 = t15*t26;
+    const real t5536 = a[39];
+    const real t5537 = a[476];
+    const real t5539 = a[498];
+    const real t5541 = a[330];
+    const real t5542 = t5541*t5;
+    const real t5543 = t5541*t37;
+    const real t5544 = a[447];
+    const real t5545 = t5544*t50;
+    const real t5549 = t5541*t20;
+    const real t5550 = t5541*t26;
+    const real t5552 = a[545];
+    const real t5553 = t5552*t50;
+    const real t5554 = t5544*t67;
+    const real t5558 = t34*t72;
+    const real t5591 = t1452*t50;
+    const real t5592 = t1450*t67;
+    const real t5593 = t1447*t72;
+    const real t5594 = t1447*t73;
+    const real t5596 = t1859*t145;
+    const real t5598 = t1885+t1444+t1443+t1445+t1888+t5591+t5592+t5593+t5594+t5084+t1915+
+t5086+t1917+t1892*t139+t5596+t1456*t146;
+    const real t5600 = t1434*t50;
+    const real t5601 = t1432*t67;
+    const real t5602 = t1429*t72;
+    const real t5603 = t1429*t73;
+    const real t5604 = t1859*t139;
+    const real t5606 = t1454*t146;
+    const real t5608 = t1851+t1424+t1426+t1427+t1854+t5600+t5601+t5602+t5603+t1913+t5085+
+t1916+t5087+t5604+t1857*t145+t5606+t1436*t155;
+    const real t5610 = t2443*t50;
+    const real t5611 = t2443*t67;
+    const real t5612 = t2440*t72;
+    const real t5613 = t2440*t73;
+    const real t5614 = t2452*t77;
+    const real t5615 = t2452*t126;
+    const real t5616 = t2452*t132;
+    const real t5617 = t2452*t136;
+    const real t5622 = t2436+t2435+t2437+t2438+t2439+t5610+t5611+t5612+t5613+t5614+t5615+
+t5616+t5617+t2448*t139+t2446*t145+t2448*t146+t2446*t155+t2458;
+    const real t5624 = t1951*t50;
+    const real t5625 = t1951*t67;
+    const real t5626 = t1948*t72;
+    const real t5627 = t1948*t73;
+    const real t5628 = t1961*t77;
+    const real t5629 = t1963*t126;
+    const real t5630 = t1961*t132;
+    const real t5631 = t1963*t136;
+    const real t5632 = t1957*t139;
+    const real t5633 = t1954*t145;
+    const real t5634 = t1957*t146;
+    const real t5635 = t1954*t155;
+    const real t5636 = t1973*t275;
+    const real t5637 = t1944+t1942+t1945+t1946+t1947+t5624+t5625+t5626+t5627+t5628+t5629+
+t5630+t5631+t5632+t5633+t5634+t5635+t1968+t5636;
+    const real t5639 = t1963*t77;
+    const real t5640 = t1961*t126;
+    const real t5641 = t1963*t132;
+    const real t5642 = t1961*t136;
+    const real t5643 = t2470*t275;
+    const real t5644 = t1973*t254;
+    const real t5645 = t1944+t1942+t1945+t1946+t1947+t5624+t5625+t5626+t5627+t5639+t5640+
+t5641+t5642+t5632+t5633+t5634+t5635+t1968+t5643+t5644;
+    const real t5647 = t2544*t50;
+    const real t5648 = t2544*t67;
+    const real t5649 = t2541*t72;
+    const real t5650 = t2541*t73;
+    const real t5651 = t2553*t77;
+    const real t5653 = t2553*t126;
+    const real t5654 = t2553*t132;
+    const real t5655 = t2553*t136;
+    const real t5661 = t5653+t5654+t5655+t2549*t139+t2547*t145+t2549*t146+t2547*t155+t2559
++t5240+t1972+t2562*t212;
+    const real t5664 = t3130*t50;
+    const real t5665 = t3130*t67;
+    const real t5666 = t3127*t72;
+    const real t5667 = t3127*t73;
+    const real t5668 = t3139*t77;
+    const real t5669 = t3139*t126;
+    const real t5670 = t3121+t3123+t3124+t3125+t3126+t5664+t5665+t5666+t5667+t5668+t5669;
+    const real t5671 = t3139*t132;
+    const real t5672 = t3139*t136;
+    const real t5677 = t2560*t212;
+    const real t5679 = t5671+t5672+t3135*t139+t3133*t145+t3135*t146+t3133*t155+t3145+t1970
++t5241+t5677+t3146*t215;
+    const real t5682 = t2485*t50;
+    const real t5683 = t2485*t67;
+    const real t5684 = t2487*t72;
+    const real t5685 = t2487*t73;
+    const real t5686 = t2478*t77;
+    const real t5687 = t2483*t126;
+    const real t5688 = t2509+t2507+t2510+t2511+t2512+t5682+t5683+t5684+t5685+t5686+t5687;
+    const real t5689 = t2478*t132;
+    const real t5690 = t2483*t136;
+    const real t5691 = t2493*t139;
+    const real t5692 = t2476*t145;
+    const real t5693 = t2493*t146;
+    const real t5694 = t2476*t155;
+    const real t5695 = t2503*t275;
+    const real t5696 = t2505*t254;
+    const real t5697 = t2499*t212;
+    const real t5698 = t2497*t215;
+    const real t5699 = t5689+t5690+t5691+t5692+t5693+t5694+t2514+t5695+t5696+t5697+t5698+
+t5255;
+    const real t5442 = t1846+t1926*t20+t2521+t1880*t26+t2523;
+    const real t5705 = t5442*t37;
+    const real t5443 = t1874*t50;
+    const real t5708 = (t1864+t1868+t2526+t2528+t1870+t5443)*t50;
+    const real t5447 = t2530*t50;
+    const real t5451 = t1874*t67;
+    const real t5712 = (t2527+t1864+t1866+t1869+t2529+t5447+t5451)*t67;
+    const real t5462 = t1938*t72;
+    const real t5715 = (t1931+t1933+t2996+t2997+t1937+t1872+t1873+t5462)*t72;
+    const real t5466 = t2999*t72;
+    const real t5468 = t1938*t73;
+    const real t5719 = (t1931+t2995+t1934+t1936+t2998+t1872+t1873+t5466+t5468)*t73;
+    const real t5476 = t2535+t2537+t2538+t2539+t2540+t5647+t5648+t5649+t5650+t5651+t5661;
+    const real t5485 = t5670+t5679;
+    const real t5490 = t5688+t5699;
+    const real t5720 = t5598*t146+t5608*t155+t5622*t179+t5637*t275+t5645*t254+t5476*t212+
+t5485*t215+t5490*t143+t5705+t5708+t5712+t5715+t5719;
+    const real t5721 = t1909*t50;
+    const real t5722 = t1909*t67;
+    const real t5723 = t1907*t72;
+    const real t5724 = t1905*t73;
+    const real t5502 = t1922*t77;
+    const real t5727 = (t1900+t1901+t2407+t1903+t2410+t5721+t5722+t5723+t5724+t5502)*t77;
+    const real t5728 = t1905*t72;
+    const real t5729 = t1907*t73;
+    const real t5733 = t2408+t1899+t1900+t2409+t1904+t5721+t5722+t5728+t5729+t1918*t77+
+t1920*t126+t1922*t132;
+    const real t5734 = t5733*t132;
+    const real t5739 = t2408+t1899+t1900+t2409+t1904+t5721+t5722+t5728+t5729+t1920*t77+
+t1918*t126+t2418*t132+t1922*t136;
+    const real t5740 = t5739*t136;
+    const real t5741 = t1469*t50;
+    const real t5742 = t1469*t67;
+    const real t5743 = t1466*t72;
+    const real t5744 = t1466*t73;
+    const real t5745 = t1481*t77;
+    const real t5746 = t1479*t126;
+    const real t5747 = t1481*t132;
+    const real t5748 = t1462+t1460+t1463+t1464+t1465+t5741+t5742+t5743+t5744+t5745+t5746+
+t5747;
+    const real t5749 = t1479*t136;
+    const real t5750 = t1474*t139;
+    const real t5751 = t1472*t145;
+    const real t5752 = t1474*t146;
+    const real t5753 = t1472*t155;
+    const real t5754 = t1493*t275;
+    const real t5755 = t1491*t254;
+    const real t5756 = t1489*t212;
+    const real t5757 = t1487*t215;
+    const real t5758 = t5749+t5750+t5751+t5752+t5753+t1486+t5754+t5755+t5756+t5757+t2516+
+t1498;
+    const real t5761 = t2478*t126;
+    const real t5762 = t2505*t275;
+    const real t5763 = t2483*t77;
+    const real t5764 = t2503*t254;
+    const real t5765 = t2483*t132;
+    const real t5766 = t2478*t136;
+    const real t5767 = t5693+t5692+t5691+t2481+t5761+t5762+t5763+t5764+t5765+t5766+t5694+
+t5697;
+    const real t5768 = t5698+t5068+t2491+t2507+t2509+t2510+t2511+t2512+t5682+t5683+t5684+
+t5685+t2514;
+    const real t5528 = t1846+t1881+t1928;
+    const real t5772 = t5528*t20;
+    const real t5529 = t1927+t1846+t1879+t1882;
+    const real t5774 = t5529*t26;
+    const real t5777 = t1900+t1901+t2407+t1903+t2410+t5721+t5722+t5723+t5724+t2418*t77+
+t1922*t126;
+    const real t5778 = t5777*t126;
+    const real t5779 = t2095*t50;
+    const real t5780 = t2095*t67;
+    const real t5781 = t2091*t72;
+    const real t5782 = t2093*t73;
+    const real t5532 = t2106*t77;
+    const real t5785 = (t2085+t2086+t2238+t2239+t2090+t5779+t5780+t5781+t5782+t5532)*t77;
+    const real t5788 = t2085+t2086+t2238+t2239+t2090+t5779+t5780+t5781+t5782+t2104*t77+
+t2106*t126;
+    const real t5789 = t5788*t126;
+    const real t5790 = t2093*t72;
+    const real t5791 = t2091*t73;
+    const real t5795 = t2237+t2086+t2087+t2089+t2240+t5779+t5780+t5790+t5791+t2243*t77+
+t2245*t126+t2106*t132;
+    const real t5796 = t5795*t132;
+    const real t5801 = t2237+t2086+t2087+t2089+t2240+t5779+t5780+t5790+t5791+t2245*t77+
+t2243*t126+t2104*t132+t2106*t136;
+    const real t5802 = t5801*t136;
+    const real t5557 = t2399+t2048+t2044+t2050;
+    const real t5804 = t5557*t26;
+    const real t5559 = t2122*t50;
+    const real t5807 = (t2126+t2110+t2112+t2115+t2129+t5559)*t50;
+    const real t5561 = t2120*t50;
+    const real t5562 = t2122*t67;
+    const real t5811 = (t2114+t2110+t2127+t2128+t2116+t5561+t5562)*t67;
+    const real t5566 = t2173*t20+t2044+t2045*t26+t2172+t2175;
+    const real t5815 = t5566*t37;
+    const real t5816 = t2277*t67;
+    const real t5817 = t2274*t73;
+    const real t5818 = t2033*t240;
+    const real t5819 = t2289*t77;
+    const real t5820 = t2287*t126;
+    const real t5821 = t2287*t136;
+    const real t5822 = t2289*t132;
+    const real t5823 = t2277*t50;
+    const real t5824 = t2268+t2272+t2273+t5816+t5817+t2254+t5818+t5819+t5820+t5821+t5822+
+t5823+t2294;
+    const real t5825 = t2301*t275;
+    const real t5826 = t2299*t254;
+    const real t5827 = t2274*t72;
+    const real t5828 = t2282*t139;
+    const real t5829 = t2280*t145;
+    const real t5831 = t2297*t212;
+    const real t5832 = t2295*t215;
+    const real t5833 = t2282*t146;
+    const real t5834 = t2280*t155;
+    const real t5835 = t5825+t5826+t5827+t2270+t2271+t5359+t5828+t5829+t2351*t309+t5831+
+t5832+t5833+t5834;
+    const real t5838 = t2062*t50;
+    const real t5839 = t2062*t67;
+    const real t5840 = t2059*t72;
+    const real t5841 = t2059*t73;
+    const real t5842 = t2071*t77;
+    const real t5844 = t2071*t126;
+    const real t5845 = t2071*t132;
+    const real t5846 = t2071*t136;
+    const real t5852 = t5844+t5845+t5846+t2067*t139+t2065*t145+t2067*t146+t2065*t155+t2077
++t5327+t2163+t2080*t212;
+    const real t5855 = t2198*t50;
+    const real t5856 = t2198*t67;
+    const real t5857 = t2195*t72;
+    const real t5858 = t2195*t73;
+    const real t5859 = t2207*t77;
+    const real t5860 = t2207*t126;
+    const real t5861 = t2189+t2191+t2192+t2193+t2194+t5855+t5856+t5857+t5858+t5859+t5860;
+    const real t5862 = t2207*t132;
+    const real t5863 = t2207*t136;
+    const real t5868 = t2078*t212;
+    const real t5870 = t5862+t5863+t2203*t139+t2201*t145+t2203*t146+t2201*t155+t2213+t2161
++t5328+t5868+t2214*t215;
+    const real t5873 = t1988*t50;
+    const real t5874 = t1990*t67;
+    const real t5875 = t1985*t72;
+    const real t5876 = t1985*t73;
+    const real t5877 = t1994*t139;
+    const real t5879 = t2374*t146;
+    const real t5881 = t1982+t1979+t2336+t2337+t1984+t5873+t5874+t5875+t5876+t2099+t5333+
+t2102+t5335+t5877+t1992*t145+t5879+t1996*t155;
+    const real t5580 = t5824+t5835;
+    const real t5582 = t2055+t2054+t2056+t2057+t2058+t5838+t5839+t5840+t5841+t5842+t5852;
+    const real t5584 = t5861+t5870;
+    const real t5883 = t5785+t5789+t5796+t5802+t5804+t5807+t5811+t5815+t5580*t475+t5582*
+t212+t5584*t215+t5881*t155;
+    const real t5884 = t2008*t50;
+    const real t5885 = t2008*t67;
+    const real t5886 = t2010*t72;
+    const real t5887 = t2010*t73;
+    const real t5888 = t2006*t77;
+    const real t5889 = t2014*t126;
+    const real t5890 = t2027+t2024+t2028+t2029+t2030+t5884+t5885+t5886+t5887+t5888+t5889;
+    const real t5891 = t2006*t132;
+    const real t5892 = t2014*t136;
+    const real t5893 = t2000*t139;
+    const real t5894 = t2002*t145;
+    const real t5895 = t2000*t146;
+    const real t5896 = t2002*t155;
+    const real t5897 = t2016*t275;
+    const real t5898 = t2018*t254;
+    const real t5899 = t2035*t212;
+    const real t5900 = t2021*t215;
+    const real t5901 = t5891+t5892+t5893+t5894+t5895+t5896+t2032+t5897+t5898+t5899+t5900+
+t5397;
+    const real t5904 = t2287*t77;
+    const real t5905 = t2289*t126;
+    const real t5906 = t2287*t132;
+    const real t5907 = t2268+t2270+t2271+t2272+t2273+t5823+t5816+t5827+t5817+t5904+t5905+
+t5906;
+    const real t5908 = t2289*t136;
+    const real t5909 = t2299*t275;
+    const real t5910 = t2301*t254;
+    const real t5911 = t5908+t5828+t5829+t5833+t5834+t2294+t5909+t5910+t5831+t5832+t2034+
+t2353;
+    const real t5914 = t2317*t50;
+    const real t5915 = t2317*t67;
+    const real t5916 = t2314*t72;
+    const real t5917 = t2314*t73;
+    const real t5918 = t2326*t77;
+    const real t5919 = t2326*t126;
+    const real t5920 = t2326*t132;
+    const real t5921 = t2326*t136;
+    const real t5926 = t2310+t2308+t2311+t2312+t2313+t5914+t5915+t5916+t5917+t5918+t5919+
+t5920+t5921+t2322*t139+t2320*t145+t2322*t146+t2320*t155+t2332;
+    const real t5595 = t2185*t72;
+    const real t5930 = (t2229+t2179+t2180+t2230+t2184+t2118+t2119+t5595)*t72;
+    const real t5599 = t2232*t72;
+    const real t5605 = t2185*t73;
+    const real t5934 = (t2181+t2228+t2180+t2183+t2231+t2118+t2119+t5599+t5605)*t73;
+    const real t5609 = t2044+t2046+t2400;
+    const real t5936 = t5609*t20;
+    const real t5937 = t2369*t50;
+    const real t5938 = t2367*t67;
+    const real t5939 = t2364*t72;
+    const real t5940 = t2364*t73;
+    const real t5942 = t2359+t2390+t2358+t2362+t2392+t5937+t5938+t5939+t5940+t5332+t2101+
+t5334+t2103+t2376*t139;
+    const real t5944 = t1990*t50;
+    const real t5945 = t1988*t67;
+    const real t5946 = t2374*t139;
+    const real t5948 = t1982+t2335+t1981+t1983+t2338+t5944+t5945+t5875+t5876+t2099+t5333+
+t2102+t5335+t5946+t1996*t145;
+    const real t5950 = t2367*t50;
+    const real t5951 = t2369*t67;
+    const real t5953 = t1994*t145;
+    const real t5955 = t2359+t2361+t2389+t2391+t2363+t5950+t5951+t5939+t5940+t5332+t2101+
+t5334+t2103+t2372*t139+t5953+t2376*t146;
+    const real t5957 = t2142*t50;
+    const real t5958 = t2142*t67;
+    const real t5959 = t2139*t72;
+    const real t5960 = t2139*t73;
+    const real t5961 = t2154*t77;
+    const real t5962 = t2152*t126;
+    const real t5963 = t2154*t132;
+    const real t5964 = t2152*t136;
+    const real t5965 = t2147*t139;
+    const real t5966 = t2145*t145;
+    const real t5967 = t2147*t146;
+    const real t5968 = t2145*t155;
+    const real t5969 = t2166*t275;
+    const real t5970 = t2134+t2135+t2136+t2137+t2138+t5957+t5958+t5959+t5960+t5961+t5962+
+t5963+t5964+t5965+t5966+t5967+t5968+t2159+t5969;
+    const real t5972 = t2152*t77;
+    const real t5973 = t2154*t126;
+    const real t5974 = t2152*t132;
+    const real t5975 = t2154*t136;
+    const real t5976 = t2164*t275;
+    const real t5977 = t2166*t254;
+    const real t5978 = t2134+t2135+t2136+t2137+t2138+t5957+t5958+t5959+t5960+t5972+t5973+
+t5974+t5975+t5965+t5966+t5967+t5968+t2159+t5976+t5977;
+    const real t5980 = t2014*t77;
+    const real t5981 = t2014*t132;
+    const real t5982 = t2016*t254;
+    const real t5983 = t2018*t275;
+    const real t5984 = t2006*t126;
+    const real t5985 = t2006*t136;
+    const real t5986 = t2024+t5980+t5981+t5982+t5983+t5984+t5985+t2027+t2028+t2029+t2030+
+t5884;
+    const real t5987 = t5885+t5886+t5887+t2032+t2038+t5893+t5894+t5895+t5896+t5899+t5900+
+t5371+t2040;
+    const real t5623 = t5890+t5901;
+    const real t5646 = t5907+t5911;
+    const real t5663 = t5986+t5987;
+    const real t5990 = t5623*t143+t5646*t309+t5926*t179+t5930+t5934+t2388+t5936+t5942*t139
++t5948*t145+t5955*t146+t5970*t275+t5978*t254+t5663*t240;
+    const real t5993 = t1481*t126;
+    const real t5994 = t1479*t77;
+    const real t5995 = t1493*t254;
+    const real t5996 = t1479*t132;
+    const real t5997 = t1481*t136;
+    const real t5998 = t2515*t240;
+    const real t5999 = t1491*t275;
+    const real t6000 = t5222+t5993+t5994+t5995+t5996+t5997+t3005+t5998+t5999+t1460+t5750+
+t5751+t5752;
+    const real t6002 = t5753+t5756+t5757+t1495*t309+t5741+t5742+t5743+t5744+t1486+t1462+
+t1463+t1464+t1465;
+    const real t6005 = t1450*t50;
+    const real t6006 = t1452*t67;
+    const real t6008 = t1444+t1441+t1886+t1887+t1446+t6005+t6006+t5593+t5594+t5084+t1915+
+t5086+t1917+t1456*t139;
+    const real t6010 = t1432*t50;
+    const real t6011 = t1434*t67;
+    const real t6012 = t1454*t139;
+    const real t6014 = t1423+t1424+t1852+t1853+t1428+t6010+t6011+t5602+t5603+t1913+t5085+
+t1916+t5087+t6012+t1436*t145;
+    const real t5678 = t5748+t5758;
+    const real t5681 = t5767+t5768;
+    const real t5702 = (t5883+t5990)*t3120;
+    const real t5703 = t6000+t6002;
+    const real t6016 = t5727+t5734+t5740+t1850+t5678*t309+t5681*t240+t5772+t5774+t5778+
+t5702+t5703*t475+t6008*t139+t6014*t145;
+    const real t6019 = t69+t74+t79+t84+t105+t157+t256+t294+t313+t625+t628;
+    const real t6020 = t259+t262+t295+t296+t264+t297+t298+t299+t300+t642+t94+t643+t96+
+t5507;
+    const real t6022 = t51+t53+t85+t86+t57+t87+t88+t89+t90+t301+t638+t304+t639+t306+t5464;
+    const real t6024 = t262+t314+t261+t263+t315+t460+t461+t299+t300+t642+t94+t643+t96+
+t5487+t406+t5488;
+    const real t6026 = t51+t278+t55+t56+t279+t403+t404+t89+t90+t301+t638+t304+t639+t462+
+t5448+t464+t5449;
+    const real t6028 = t191+t193+t194+t195+t196+t198+t199+t200+t201+t650+t651+t652+t653+
+t5491+t5492+t5493+t5494+t213;
+    const real t6030 = t217+t218+t219+t220+t221+t223+t224+t226+t227+t656+t657+t658+t659+
+t5497+t5498+t5499+t5500+t241+t660;
+    const real t6032 = t410+t412+t413+t414+t415+t445+t446+t447+t448+t663+t664+t665+t666+
+t5519+t5520+t5521+t5522+t436+t243+t667;
+    const real t6035 = t680+t682+t683+t5479+t5480+t5481+t5482+t241+t684+t439+t5483;
+    const real t6038 = t410+t412+t413+t414+t415+t417+t418+t420+t421+t670+t672;
+    const real t6039 = t673+t674+t5511+t5512+t5513+t5514+t436+t395+t675+t398+t5515;
+    const real t6042 = t334+t330+t331+t332+t335+t337+t338+t339+t340+t699+t700;
+    const real t6044 = t701+t703+t5455+t5456+t5457+t5458+t349+t704+t705+t5459+t5460+t325*
+t143;
+    const real t5725 = t217+t218+t219+t220+t221+t381+t382+t383+t384+t679+t6035;
+    const real t5730 = t6038+t6039;
+    const real t5735 = (t6042+t6044)*t143;
+    const real t6047 = t632+t637+t6020*t139+t6022*t145+t6024*t146+t6026*t155+t6028*t179+
+t6030*t275+t6032*t254+t5725*t212+t5730*t215+t5735;
+    const real t6056 = t5669+t5671+t5672+t3133*t139+t3135*t145+t3133*t146+t3135*t155+t3145
++t1970+t5241+t3146*t212;
+    const real t6060 = t2497*t212;
+    const real t6061 = t3004+t5761+t5762+t5763+t3005+t5998+t5764+t3009*t309+t5765+t5766+
+t6060+t2507+t2509;
+    const real t6062 = t2476*t139;
+    const real t6063 = t2493*t145;
+    const real t6064 = t2476*t146;
+    const real t6065 = t2493*t155;
+    const real t6066 = t2499*t215;
+    const real t6067 = t2510+t2511+t2512+t5682+t5683+t5684+t5685+t6062+t6063+t6064+t6065+
+t2514+t6066;
+    const real t6074 = t2435+t2436+t2437+t2438+t2439+t5610+t5611+t5612+t5613+t5614+t5615+
+t5616+t5617+t2446*t139+t2448*t145+t2446*t146+t2448*t155+t2458;
+    const real t6077 = t1423+t1424+t1852+t1853+t1428+t6010+t6011+t5602+t5603+t1913+t5085+
+t1916+t5087+t1436*t139;
+    const real t5783 = t3121+t3123+t3124+t3125+t3126+t5664+t5665+t5666+t5667+t5668+t6056;
+    const real t5786 = t6061+t6067;
+    const real t6079 = t5705+t5708+t5712+t5715+t5719+t5727+t5734+t5740+t5783*t212+t5786*
+t475+t1850+t6074*t179+t6077*t139;
+    const real t6080 = t5993+t5994+t5245+t5995+t2481+t5996+t5997+t1496+t5999+t1460+t5741+
+t5742;
+    const real t6081 = t1472*t139;
+    const real t6082 = t1474*t145;
+    const real t6083 = t1472*t146;
+    const real t6084 = t1474*t155;
+    const real t6085 = t1487*t212;
+    const real t6086 = t1489*t215;
+    const real t6087 = t5743+t5744+t6081+t6082+t6083+t6084+t1486+t6085+t6086+t1462+t1463+
+t1464+t1465;
+    const real t6090 = t2509+t2507+t2510+t2511+t2512+t5682+t5683+t5684+t5685+t5686+t5687+
+t5689;
+    const real t6091 = t5690+t6062+t6063+t6064+t6065+t2514+t5695+t5696+t6060+t6066+t2516+
+t5069;
+    const real t6094 = t1954*t139;
+    const real t6095 = t1957*t145;
+    const real t6096 = t1954*t146;
+    const real t6097 = t1957*t155;
+    const real t6098 = t1942+t1944+t1945+t1946+t1947+t5624+t5625+t5626+t5627+t5639+t5640+
+t5641+t5642+t6094+t6095+t6096+t6097+t1968+t5643+t5644;
+    const real t6100 = t1514*t50;
+    const real t6101 = t1512*t67;
+    const real t6102 = t1509*t72;
+    const real t6103 = t1509*t73;
+    const real t6107 = t1525+t1504+t1503+t1507+t1528+t6100+t6101+t6102+t6103+t1630+t1631+
+t1632+t1633+t1533*t139+t1531*t145+t1516*t146;
+    const real t6134 = t1697+t1698+t1699+t1700+t1701+t1705*t50+t1705*t67+t1702*t72+t1702*
+t73+t1713*t77+t1713*t126+t1713*t132+t1713*t136+t1708*t139+t1708*t145+t1708*t146
++t1708*t155+t1719;
+    const real t6136 = t1548*t50;
+    const real t6137 = t1548*t67;
+    const real t6138 = t1545*t72;
+    const real t6139 = t1545*t73;
+    const real t6140 = t1557*t77;
+    const real t6142 = t1557*t126;
+    const real t6143 = t1557*t132;
+    const real t6144 = t1557*t136;
+    const real t6150 = t6142+t6143+t6144+t1551*t139+t1553*t145+t1551*t146+t1553*t155+t1563
++t1671+t1672+t1564*t212;
+    const real t6153 = t1626*t50;
+    const real t6154 = t1626*t67;
+    const real t6155 = t1624*t72;
+    const real t6156 = t1622*t73;
+    const real t6160 = t1622*t72;
+    const real t6161 = t1624*t73;
+    const real t6166 = t1723+t1616+t1617+t1724+t1621+t6153+t6154+t6160+t6161+t1634*t77+
+t1636*t126+t1638*t132+t1640*t136;
+    const real t6168 = t1653*t50;
+    const real t6169 = t1653*t67;
+    const real t6170 = t1650*t72;
+    const real t6171 = t1650*t73;
+    const real t6176 = t1656*t139;
+    const real t6177 = t1656*t145;
+    const real t6178 = t1656*t146;
+    const real t6179 = t1656*t155;
+    const real t6182 = t1646+t1644+t1647+t1648+t1649+t6168+t6169+t6170+t6171+t1662*t77+
+t1664*t126+t1662*t132+t1664*t136+t6176+t6177+t6178+t6179+t1669+t1673*t275+t1675
+*t254;
+    const real t5880 = t1568+t1731*t20+t1829+t1739*t26+t1830;
+    const real t5902 = t1751*t72;
+    const real t5913 = t1690*t50;
+    const real t5922 = t1692*t67;
+    const real t5929 = t1541+t1539+t1542+t1543+t1544+t6136+t6137+t6138+t6139+t6140+t6150;
+    const real t5932 = t1640*t77;
+    const real t6186 = t6107*t146+t5880*t37+(t1804+t1745+t1746+t1805+t1750+t1688+t1689+
+t5902)*t72+(t1681+t1682+t1813+t1814+t1686+t5913+t5922)*t67+(t1732+t1568+t1738+
+t1741)*t26+t6134*t179+t5929*t212+(t1617+t1618+t1722+t1620+t1725+t6153+t6154+
+t6155+t6156+t5932)*t77+t6166*t136+t1572+t6182*t254+(t1740+t1568+t1733)*t20;
+    const real t6191 = t1541+t1539+t1542+t1543+t1544+t6136+t6137+t6138+t6139+t6140+t6142;
+    const real t6198 = t6143+t6144+t1553*t139+t1551*t145+t1553*t146+t1551*t155+t1563+t1671
++t1672+t1780*t212+t1564*t215;
+    const real t6206 = t1646+t1644+t1647+t1648+t1649+t6168+t6169+t6170+t6171+t1664*t77+
+t1662*t126+t1664*t132+t1662*t136+t6176+t6177+t6178+t6179+t1669+t1675*t275;
+    const real t6208 = t1585*t145;
+    const real t6211 = t1600*t215;
+    const real t6212 = t1587*t146;
+    const real t6213 = t1602*t212;
+    const real t6214 = t1585*t155;
+    const real t6215 = t1587*t139;
+    const real t6216 = t1592*t132;
+    const real t6217 = t1594*t136;
+    const real t6218 = t1582*t50;
+    const real t6219 = t1819+t6208+t1757*t240+t1608*t309+t6211+t1820+t6212+t6213+t6214+
+t6215+t6216+t6217+t6218;
+    const real t6220 = t1579*t72;
+    const real t6221 = t1582*t67;
+    const real t6222 = t1604*t275;
+    const real t6223 = t1606*t254;
+    const real t6224 = t1579*t73;
+    const real t6225 = t1592*t77;
+    const real t6226 = t1594*t126;
+    const real t6227 = t6220+t6221+t1576+t1599+t1577+t6222+t6223+t6224+t1578+t6225+t6226+
+t1575+t1573;
+    const real t6234 = t1525+t1504+t1503+t1507+t1528+t6100+t6101+t6102+t6103+t1630+t1631+
+t1632+t1633+t1531*t139+t1533*t145+t1520*t146+t1516*t155;
+    const real t6236 = t1512*t50;
+    const real t6237 = t1514*t67;
+    const real t6239 = t1506+t1504+t1526+t1527+t1508+t6236+t6237+t6102+t6103+t1630+t1631+
+t1632+t1633+t1516*t139;
+    const real t6241 = t1594*t77;
+    const real t6242 = t1592*t126;
+    const real t6243 = t1573+t1575+t1576+t1577+t1578+t6218+t6221+t6220+t6224+t6241+t6242;
+    const real t6244 = t1594*t132;
+    const real t6245 = t1592*t136;
+    const real t6246 = t1585*t139;
+    const real t6247 = t1587*t145;
+    const real t6248 = t1585*t146;
+    const real t6249 = t1587*t155;
+    const real t6250 = t1606*t275;
+    const real t6251 = t1604*t254;
+    const real t6252 = t1600*t212;
+    const real t6253 = t1602*t215;
+    const real t6254 = t6244+t6245+t6246+t6247+t6248+t6249+t1599+t6250+t6251+t6252+t6253+
+t1834;
+    const real t6259 = t1506+t1504+t1526+t1527+t1508+t6236+t6237+t6102+t6103+t1630+t1631+
+t1632+t1633+t1520*t139+t1516*t145;
+    const real t6261 = t1573+t1575+t1576+t1577+t1578+t6218+t6221+t6220+t6224+t6241+t6242+
+t6244;
+    const real t6262 = t6245+t6215+t6208+t6212+t6214+t1599+t6250+t6251+t6213+t6211+t1758+
+t1611;
+    const real t6270 = t1617+t1618+t1722+t1620+t1725+t6153+t6154+t6155+t6156+t1638*t77+
+t1640*t126;
+    const real t6272 = t6216+t6217+t1759+t6218+t6220+t6221+t1576+t1599+t1577+t6222+t6223+
+t6224;
+    const real t6273 = t1578+t1762+t1609+t6246+t6225+t6226+t6247+t6252+t6248+t6249+t6253+
+t1575+t1573;
+    const real t6279 = t1723+t1616+t1617+t1724+t1621+t6153+t6154+t6160+t6161+t1636*t77+
+t1634*t126+t1640*t132;
+    const real t6034 = t1807*t72;
+    const real t6036 = t1751*t73;
+    const real t6041 = t6191+t6198;
+    const real t6046 = t6219+t6227;
+    const real t6051 = t6243+t6254;
+    const real t6054 = t6261+t6262;
+    const real t6057 = t1692*t50;
+    const real t6069 = t6272+t6273;
+    const real t6281 = (t1746+t1803+t1747+t1749+t1806+t1688+t1689+t6034+t6036)*t73+t6041*
+t215+t6206*t275+t6046*t475+t6234*t155+t6239*t139+t6051*t143+t6259*t145+t6054*
+t309+(t1812+t1682+t1684+t1685+t1815+t6057)*t50+t6270*t126+t6069*t240+t6279*t132
+;
+    const real t6285 = t1441+t1444+t1886+t1887+t1446+t6005+t6006+t5593+t5594+t5084+t1915+
+t5086+t1917+t6012+t1456*t145;
+    const real t6287 = t2535+t2537+t2538+t2539+t2540+t5647+t5648+t5649+t5650+t5651+t5653;
+    const real t6293 = t5654+t5655+t2547*t139+t2549*t145+t2547*t146+t2549*t155+t2559+t5240
++t1972+t5677+t2562*t215;
+    const real t6296 = t2268+t2270+t2271+t2272+t2273+t5823+t5816+t5827+t5817+t5904+t5905;
+    const real t6297 = t2280*t139;
+    const real t6298 = t2282*t145;
+    const real t6299 = t2280*t146;
+    const real t6300 = t2282*t155;
+    const real t6301 = t2295*t212;
+    const real t6302 = t2297*t215;
+    const real t6303 = t5906+t5908+t6297+t6298+t6299+t6300+t2294+t5909+t5910+t6301+t6302+
+t2304;
+    const real t6308 = t1979+t1982+t2336+t2337+t1984+t5873+t5874+t5875+t5876+t2099+t5333+
+t2102+t5335+t1992*t139+t5953+t1996*t146;
+    const real t6310 = t2145*t139;
+    const real t6311 = t2147*t145;
+    const real t6312 = t2145*t146;
+    const real t6313 = t2147*t155;
+    const real t6314 = t2134+t2135+t2136+t2137+t2138+t5957+t5958+t5959+t5960+t5972+t5973+
+t5974+t5975+t6310+t6311+t6312+t6313+t2159+t5976+t5977;
+    const real t6317 = t2359+t2390+t2358+t2362+t2392+t5937+t5938+t5939+t5940+t5332+t2101+
+t5334+t2103+t5946+t2376*t145;
+    const real t6319 = t2134+t2135+t2136+t2137+t2138+t5957+t5958+t5959+t5960+t5961+t5962+
+t5963+t5964+t6310+t6311+t6312+t6313+t2159+t5969;
+    const real t6322 = t2024+t2256*t309+t5980+t5981+t2253+t2254+t5818+t5982+t5983+t5984+
+t5985+t2027+t2028;
+    const real t6323 = t2002*t139;
+    const real t6324 = t2000*t145;
+    const real t6325 = t2002*t146;
+    const real t6326 = t2000*t155;
+    const real t6327 = t2021*t212;
+    const real t6328 = t2035*t215;
+    const real t6329 = t2029+t2030+t5884+t5885+t5886+t5887+t6323+t6324+t6325+t6326+t2032+
+t6327+t6328;
+    const real t6332 = t2055+t2054+t2056+t2057+t2058+t5838+t5839+t5840+t5841+t5842+t5844;
+    const real t6338 = t5845+t5846+t2065*t139+t2067*t145+t2065*t146+t2067*t155+t2077+t5327
++t2163+t5868+t2080*t215;
+    const real t6110 = t6296+t6303;
+    const real t6116 = t6322+t6329;
+    const real t6118 = t6332+t6338;
+    const real t6341 = t6110*t143+t6308*t146+t6314*t254+t6317*t145+t5785+t5789+t5796+t5802
++t5804+t6319*t275+t6116*t475+t6118*t215;
+    const real t6344 = t2359+t2361+t2389+t2391+t2363+t5950+t5951+t5939+t5940+t5332+t2101+
+t5334+t2103+t5877+t2372*t145+t5879+t2376*t155;
+    const real t6347 = t2335+t1982+t1981+t1983+t2338+t5944+t5945+t5875+t5876+t2099+t5333+
+t2102+t5335+t1996*t139;
+    const real t6349 = t2027+t2024+t2028+t2029+t2030+t5884+t5885+t5886+t5887+t5888+t5889+
+t5891;
+    const real t6350 = t5892+t6323+t6324+t6325+t6326+t2032+t5897+t5898+t6327+t6328+t2034+
+t5372;
+    const real t6357 = t2310+t2308+t2311+t2312+t2313+t5914+t5915+t5916+t5917+t5918+t5919+
+t5920+t5921+t2320*t139+t2322*t145+t2320*t146+t2322*t155+t2332;
+    const real t6359 = t2268+t2272+t2273+t5816+t5817+t5819+t5820+t5821+t5822+t5823+t6300+
+t6299;
+    const real t6360 = t6297+t6298+t5347+t6302+t2352+t6301+t2294+t5825+t5826+t2038+t5827+
+t2270+t2271;
+    const real t6369 = t5860+t5862+t5863+t2201*t139+t2203*t145+t2201*t146+t2203*t155+t2213
++t2161+t5328+t2214*t212;
+    const real t6135 = t6349+t6350;
+    const real t6146 = t6359+t6360;
+    const real t6148 = t2191+t2189+t2192+t2193+t2194+t5855+t5856+t5857+t5858+t5859+t6369;
+    const real t6372 = t6344*t155+t6347*t139+t6135*t309+t6357*t179+t6146*t240+t5807+t5811+
+t5815+t5930+t5934+t6148*t212+t2388+t5936;
+    const real t6377 = t1444+t1885+t1443+t1445+t1888+t5591+t5592+t5593+t5594+t5084+t1915+
+t5086+t1917+t5604+t1892*t145+t5606+t1456*t155;
+    const real t6379 = t1942+t1944+t1945+t1946+t1947+t5624+t5625+t5626+t5627+t5628+t5629+
+t5630+t5631+t6094+t6095+t6096+t6097+t1968+t5636;
+    const real t6383 = t1851+t1424+t1426+t1427+t1854+t5600+t5601+t5602+t5603+t1913+t5085+
+t1916+t5087+t1857*t139+t5596+t1436*t146;
+    const real t6385 = t1460+t1462+t1463+t1464+t1465+t5741+t5742+t5743+t5744+t5745+t5746;
+    const real t6386 = t5747+t5749+t6081+t6082+t6083+t6084+t1486+t5754+t5755+t6085+t6086+
+t2430;
+    const real t6159 = t6080+t6087;
+    const real t6163 = t6090+t6091;
+    const real t6167 = t6186+t6281;
+    const real t6174 = t6287+t6293;
+    const real t6181 = (t6341+t6372)*t3116;
+    const real t6187 = t6385+t6386;
+    const real t6389 = t6159*t240+t6163*t309+t6098*t254+t6167*t3120+t6285*t145+t5772+t5774
++t5778+t6174*t215+t6181+t6377*t155+t6379*t275+t6383*t146+t6187*t143;
+    const real t6394 = t1124+t1126+t1127+t1129+t1130+t1132+t1134+t1136+t1137+t1139+t1140+
+t1141+t1142+t1145*t139;
+    const real t6397 = t1102+t1103+t1104+t1106+t1107+t1109+t1111+t1113+t1114+t1116+t1117+
+t1118+t1119+t1144+t1120*t145;
+    const real t6401 = t1124+t1162+t1163+t1164+t1165+t1166+t1167+t1136+t1137+t1139+t1140+
+t1141+t1142+t1169*t139+t1158+t1145*t146;
+    const real t6405 = t1103+t1149+t1150+t1151+t1152+t1153+t1154+t1113+t1114+t1116+t1117+
+t1118+t1119+t1168+t1155*t145+t1171+t1120*t155;
+    const real t6411 = t1176+t1177+t1178+t1179+t1180+t1182+t1183+t1185+t1186+t1188+t1189+
+t1190+t1191+t1194*t139+t1192*t145+t1194*t146+t1192*t155+t1199;
+    const real t6413 = t1213*t139;
+    const real t6414 = t1215*t145;
+    const real t6415 = t1213*t146;
+    const real t6416 = t1215*t155;
+    const real t6417 = t1202+t1204+t1205+t1206+t1207+t1209+t1210+t1211+t1212+t1214+t1216+
+t1217+t1218+t6413+t6414+t6415+t6416+t1224+t1226;
+    const real t6419 = t1202+t1204+t1205+t1206+t1207+t1209+t1210+t1211+t1212+t1229+t1230+
+t1231+t1232+t6413+t6414+t6415+t6416+t1224+t1234+t1235;
+    const real t6427 = t1283+t1285+t1286+t1289*t139+t1287*t145+t1289*t146+t1287*t155+t1294
++t1226+t1235+t1295*t212;
+    const real t6232 = t1269+t1271+t1272+t1273+t1274+t1276+t1277+t1279+t1280+t1282+t6427;
+    const real t6233 = t6232*t212;
+    const real t6430 = t1080+t1094+t1100+t6394*t139+t6397*t145+t6401*t146+t6405*t155+t6411
+*t179+t6417*t275+t6419*t254+t6233;
+    const real t6433 = t3253*t50;
+    const real t6434 = t3251*t67;
+    const real t6435 = t3248*t72;
+    const real t6436 = t3248*t73;
+    const real t6439 = t4727+t3241+t3243+t3246+t4730+t6433+t6434+t6435+t6436+t3280+t3281+
+t3282+t3283+t3259*t139+t3261*t145;
+    const real t6441 = a[997];
+    const real t6442 = t6441*t155;
+    const real t6443 = t6441*t145;
+    const real t6444 = a[1101];
+    const real t6446 = a[1145];
+    const real t6448 = a[990];
+    const real t6449 = t6448*t20;
+    const real t6450 = a[752];
+    const real t6451 = t6450*t72;
+    const real t6240 = a[884];
+    const real t6453 = t6240*t179;
+    const real t6455 = a[984];
+    const real t6457 = a[1095];
+    const real t6458 = t6457*t212;
+    const real t6459 = a[845];
+    const real t6460 = t6459*t215;
+    const real t6461 = t6459*t254;
+    const real t6462 = t6441*t126;
+    const real t6463 = t6442+t6443+t6444*t309+t6446*t143+t6449+t6451+t6453+t6444*t240+
+t6455*t475+t6458+t6460+t6461+t6462;
+    const real t6464 = a[706];
+    const real t6465 = t6464*t77;
+    const real t6466 = t6457*t275;
+    const real t6467 = t6464*t146;
+    const real t6468 = t6464*t139;
+    const real t6469 = t6450*t50;
+    const real t6470 = t6448*t5;
+    const real t6471 = t6448*t26;
+    const real t6472 = t6448*t37;
+    const real t6473 = t6464*t132;
+    const real t6474 = t6450*t67;
+    const real t6475 = t6450*t73;
+    const real t6476 = t6441*t136;
+    const real t6477 = a[214];
+    const real t6478 = t6465+t6466+t6467+t6468+t6469+t6470+t6471+t6472+t6473+t6474+t6475+
+t6476+t6477;
+    const real t6481 = a[567];
+    const real t6482 = t6481*t5;
+    const real t6483 = a[521];
+    const real t6484 = t6481*t20;
+    const real t6485 = t6481*t26;
+    const real t6486 = t6481*t37;
+    const real t6487 = a[763];
+    const real t6488 = t6487*t50;
+    const real t6489 = t6487*t67;
+    const real t6490 = a[1064];
+    const real t6491 = t6490*t72;
+    const real t6492 = t6490*t73;
+    const real t6493 = a[735];
+    const real t6494 = t6493*t77;
+    const real t6496 = t6493*t126;
+    const real t6497 = t6493*t132;
+    const real t6498 = t6493*t136;
+    const real t6499 = a[1033];
+    const real t6501 = a[793];
+    const real t6260 = a[1056];
+    const real t6506 = t6260*t179;
+    const real t6507 = a[1125];
+    const real t6508 = t6507*t275;
+    const real t6509 = t6507*t254;
+    const real t6510 = a[726];
+    const real t6512 = t6496+t6497+t6498+t6499*t139+t6501*t145+t6499*t146+t6501*t155+t6506
++t6508+t6509+t6510*t212;
+    const real t6515 = t6490*t50;
+    const real t6516 = t6490*t67;
+    const real t6517 = t6487*t72;
+    const real t6518 = t6487*t73;
+    const real t6523 = t6493*t139;
+    const real t6524 = t6493*t145;
+    const real t6525 = t6493*t146;
+    const real t6526 = t6493*t155;
+    const real t6528 = t6482+t6483+t6484+t6485+t6486+t6515+t6516+t6517+t6518+t6499*t77+
+t6501*t126+t6499*t132+t6501*t136+t6523+t6524+t6525+t6526+t6506+t6510*t275;
+    const real t6530 = a[1113];
+    const real t6531 = t6530*t5;
+    const real t6532 = a[448];
+    const real t6533 = t6530*t20;
+    const real t6534 = a[784];
+    const real t6535 = t6534*t26;
+    const real t6536 = t6534*t37;
+    const real t6537 = a[1148];
+    const real t6539 = a[1119];
+    const real t6543 = a[517];
+    const real t6544 = a[917];
+    const real t6545 = t6544*t5;
+    const real t6546 = a[1084];
+    const real t6548 = a[825];
+    const real t6552 = a[94];
+    const real t6553 = a[927];
+    const real t6554 = t6553*t5;
+    const real t6555 = t6553*t20;
+    const real t6556 = a[781];
+    const real t6557 = t6556*t26;
+    const real t6558 = t6556*t37;
+    const real t6559 = a[1054];
+    const real t6560 = t6559*t50;
+    const real t6561 = a[1066];
+    const real t6562 = t6561*t67;
+    const real t6563 = a[602];
+    const real t6564 = t6563*t72;
+    const real t6565 = t6563*t73;
+    const real t6566 = a[674];
+    const real t6567 = t6566*t77;
+    const real t6568 = t6566*t126;
+    const real t6569 = t6566*t132;
+    const real t6570 = t6566*t136;
+    const real t6571 = a[879];
+    const real t6573 = t6552+t6554+t6555+t6557+t6558+t6560+t6562+t6564+t6565+t6567+t6568+
+t6569+t6570+t6571*t139;
+    const real t6575 = a[637];
+    const real t6578 = t6552+t6554+t6555+t6557+t6558+t6560+t6562+t6564+t6565+t6567+t6568+
+t6569+t6570+t6575*t139+t6571*t145;
+    const real t6581 = a[729];
+    const real t6586 = a[769];
+    const real t6591 = a[1067];
+    const real t6315 = a[1147];
+    const real t6602 = a[526]+t6581*t5+t6581*t20+t6581*t26+t6581*t37+t6586*t50+t6586*t67+
+t6586*t72+t6586*t73+t6591*t77+t6591*t126+t6591*t132+t6591*t136+t6591*t139+t6591
+*t145+t6591*t146+t6591*t155+t6315*t179;
+    const real t6604 = t6556*t5;
+    const real t6605 = t6553*t37;
+    const real t6606 = t6563*t50;
+    const real t6607 = t6563*t67;
+    const real t6608 = t6561*t72;
+    const real t6609 = t6559*t73;
+    const real t6610 = a[1080];
+    const real t6612 = a[1120];
+    const real t6616 = t6555+t6552+t6604+t6557+t6605+t6606+t6607+t6608+t6609+t6610*t77+
+t6612*t126+t6575*t132+t6571*t136;
+    const real t6621 = t6556*t20;
+    const real t6622 = t6553*t26;
+    const real t6623 = t6561*t50;
+    const real t6624 = t6559*t67;
+    const real t6628 = t6552+t6604+t6621+t6622+t6605+t6623+t6624+t6564+t6565+t6567+t6568+
+t6569+t6570+t6612*t139+t6610*t145+t6571*t146;
+    const real t6630 = t6534*t5;
+    const real t6631 = t6530*t37;
+    const real t6632 = a[1072];
+    const real t6633 = t6632*t50;
+    const real t6634 = t6632*t67;
+    const real t6335 = t6463+t6478;
+    const real t6337 = t6482+t6483+t6484+t6485+t6486+t6488+t6489+t6491+t6492+t6494+t6512;
+    const real t6342 = t6537*t50;
+    const real t6343 = t6539*t67;
+    const real t6348 = t6546*t20;
+    const real t6351 = t6548*t26;
+    const real t6361 = t6548*t5;
+    const real t6365 = t6539*t72;
+    const real t6638 = t6335*t475+t6337*t212+t6528*t275+(t6531+t6532+t6533+t6535+t6536+
+t6342+t6343)*t67+(t6543+t6545+t6348+t6351)*t26+t6573*t139+t6578*t145+t6602*t179
++t6616*t136+(t6543+t6361)*t5+t6628*t146+(t6630+t6533+t6532+t6535+t6631+t6633+
+t6634+t6365)*t72;
+    const real t6642 = t6534*t20;
+    const real t6643 = t6530*t26;
+    const real t6652 = t6552+t6604+t6621+t6622+t6605+t6623+t6624+t6564+t6565+t6567+t6568+
+t6569+t6570+t6610*t139+t6612*t145+t6575*t146+t6571*t155;
+    const real t6654 = t6441*t77;
+    const real t6655 = t6464*t126;
+    const real t6656 = t6441*t132;
+    const real t6657 = t6470+t6477+t6449+t6471+t6472+t6469+t6474+t6451+t6475+t6654+t6655+
+t6656;
+    const real t6658 = t6464*t136;
+    const real t6659 = t6459*t275;
+    const real t6660 = t6457*t254;
+    const real t6661 = t6444*t143;
+    const real t6663 = t6658+t6468+t6443+t6467+t6442+t6453+t6659+t6660+t6458+t6460+t6661+
+t6455*t309;
+    const real t6667 = t6464*t145;
+    const real t6668 = t6441*t139;
+    const real t6669 = t6441*t146;
+    const real t6670 = t6464*t155;
+    const real t6671 = t6446*t309+t6661+t6667+t6668+t6669+t6670+t6449+t6451+t6453+t6461+
+t6462+t6465;
+    const real t6673 = t6459*t212;
+    const real t6674 = t6457*t215;
+    const real t6675 = t6466+t6469+t6470+t6471+t6472+t6473+t6474+t6475+t6476+t6455*t240+
+t6673+t6674+t6477;
+    const real t6678 = t6482+t6483+t6484+t6485+t6486+t6488+t6489+t6491+t6492+t6494+t6496;
+    const real t6683 = a[1127];
+    const real t6686 = t6497+t6498+t6501*t139+t6499*t145+t6501*t146+t6499*t155+t6506+t6508
++t6509+t6683*t212+t6510*t215;
+    const real t6695 = t6555+t6552+t6604+t6557+t6605+t6606+t6607+t6608+t6609+t6612*t77+
+t6610*t126+t6571*t132;
+    const real t6697 = t6470+t6477+t6449+t6471+t6472+t6469+t6474+t6451+t6475+t6654+t6655;
+    const real t6699 = t6656+t6658+t6668+t6667+t6669+t6670+t6453+t6659+t6660+t6673+t6674+
+t6455*t143;
+    const real t6708 = t6482+t6483+t6484+t6485+t6486+t6515+t6516+t6517+t6518+t6501*t77+
+t6499*t126+t6501*t132+t6499*t136+t6523+t6524+t6525+t6526+t6506+t6683*t275+t6510
+*t254;
+    const real t6710 = t6559*t72;
+    const real t6711 = t6561*t73;
+    const real t6717 = t6552+t6554+t6621+t6622+t6558+t6606+t6607+t6710+t6711+t6575*t77+
+t6571*t126;
+    const real t6404 = t6548*t20;
+    const real t6408 = t6537*t72;
+    const real t6409 = t6539*t73;
+    const real t6420 = t6657+t6663;
+    const real t6422 = t6671+t6675;
+    const real t6424 = t6678+t6686;
+    const real t6426 = t6539*t50;
+    const real t6432 = t6697+t6699;
+    const real t6440 = t6571*t77;
+    const real t6454 = t6544*t20;
+    const real t6456 = t6546*t5;
+    const real t6479 = t6544*t26;
+    const real t6480 = t6548*t37;
+    const real t6725 = (t6545+t6543+t6404)*t20+(t6531+t6532+t6642+t6643+t6536+t6633+t6634+
+t6408+t6409)*t73+t6652*t155+t6420*t309+t6422*t240+t6424*t215+(t6532+t6630+t6642
++t6643+t6631+t6426)*t50+t6695*t132+t6432*t143+t6708*t254+(t6552+t6554+t6621+
+t6622+t6558+t6606+t6607+t6710+t6711+t6440)*t77+t6717*t126+(t6543+t6454+t6456+
+t6479+t6480)*t37;
+    const real t6728 = t3226*t132;
+    const real t6729 = t3228*t136;
+    const real t6730 = t3228*t126;
+    const real t6731 = t3234*t275;
+    const real t6732 = t3236*t254;
+    const real t6733 = t3226*t77;
+    const real t6734 = t3223*t50;
+    const real t6735 = t3223*t67;
+    const real t6736 = t3220*t72;
+    const real t6737 = t4743+t6728+t6729+t6730+t3801+t6731+t6732+t6733+t3802+t6734+t6735+
+t6736;
+    const real t6738 = t3220*t73;
+    const real t6739 = t3207*t139;
+    const real t6740 = t3209*t145;
+    const real t6741 = t3207*t146;
+    const real t6742 = t3209*t155;
+    const real t6743 = t3203*t212;
+    const real t6744 = t3205*t215;
+    const real t6745 = t6738+t6739+t6740+t6741+t6742+t6743+t6744+t3214+t3215+t3216+t3218+
+t3219+t3233;
+    const real t6748 = t3276*t50;
+    const real t6749 = t3276*t67;
+    const real t6750 = t3274*t72;
+    const real t6751 = t3272*t73;
+    const real t6756 = t3267+t4178+t3268+t3270+t4181+t6748+t6749+t6750+t6751+t4186*t77+
+t4184*t126+t3284*t132+t3286*t136;
+    const real t6758 = t3743*t50;
+    const real t6759 = t3743*t67;
+    const real t6760 = t3740*t72;
+    const real t6761 = t3740*t73;
+    const real t6766 = t3746*t139;
+    const real t6767 = t3746*t145;
+    const real t6768 = t3746*t146;
+    const real t6769 = t3746*t155;
+    const real t6771 = t3734+t3736+t3737+t3738+t3739+t6758+t6759+t6760+t6761+t3754*t77+
+t3752*t126+t3754*t132+t3752*t136+t6766+t6767+t6768+t6769+t3759+t3765*t275;
+    const real t6779 = t3734+t3736+t3737+t3738+t3739+t6758+t6759+t6760+t6761+t3752*t77+
+t3754*t126+t3752*t132+t3754*t136+t6766+t6767+t6768+t6769+t3759+t3763*t275+t3765
+*t254;
+    const real t6781 = t3272*t72;
+    const real t6782 = t3274*t73;
+    const real t6794 = t4727+t3241+t3243+t3246+t4730+t6433+t6434+t6435+t6436+t3280+t3281+
+t3282+t3283+t3261*t139;
+    const real t6796 = t3251*t50;
+    const real t6797 = t3253*t67;
+    const real t6802 = t3241+t3245+t4728+t4729+t3247+t6796+t6797+t6435+t6436+t3280+t3281+
+t3282+t3283+t3255*t139+t3257*t145+t3259*t146+t3261*t155;
+    const real t6804 = t3175*t50;
+    const real t6805 = t3175*t67;
+    const real t6806 = t3172*t72;
+    const real t6807 = t3172*t73;
+    const real t6808 = t3184*t77;
+    const real t6810 = t3184*t126;
+    const real t6811 = t3184*t132;
+    const real t6812 = t3184*t136;
+    const real t6818 = t6810+t6811+t6812+t3178*t139+t3180*t145+t3178*t146+t3180*t155+t3190
++t3761+t3762+t3191*t212;
+    const real t6823 = t4179+t3266+t3267+t4180+t3271+t6748+t6749+t6781+t6782+t3284*t77+
+t3286*t126;
+    const real t6826 = t3209*t139;
+    const real t6827 = t3207*t145;
+    const real t6828 = t3209*t146;
+    const real t6829 = t3207*t155;
+    const real t6830 = t3205*t212;
+    const real t6832 = t6728+t6729+t3197*t309+t6730+t3196+t3200+t6826+t6827+t6828+t6829+
+t6830+t6731+t3201*t240;
+    const real t6833 = t3203*t215;
+    const real t6834 = t6732+t6733+t6833+t6734+t6735+t6736+t6738+t3214+t3215+t3216+t3218+
+t3219+t3233;
+    const real t6585 = t6638+t6725;
+    const real t6588 = t6737+t6745;
+    const real t6594 = t3286*t77;
+    const real t6597 = t3162*t72;
+    const real t6600 = t3160*t72;
+    const real t6601 = t3162*t73;
+    const real t6615 = t3166+t3168+t3169+t3170+t3171+t6804+t6805+t6806+t6807+t6808+t6818;
+    const real t6619 = t6832+t6834;
+    const real t6837 = t6439*t145+t6585*t4135+t6588*t240+t6756*t136+t6771*t275+t6779*t254+
+(t4179+t3266+t3267+t4180+t3271+t6748+t6749+t6781+t6782+t6594)*t77+(t3156+t3777+
+t3153+t3158+t3780+t3726+t3727+t6597)*t72+(t3778+t3153+t3155+t3779+t3159+t3726+
+t3727+t6600+t6601)*t73+t6794*t139+t6802*t155+t6615*t212+t6823*t126+t6619*t475+
+t4196;
+    const real t6849 = t3228*t77;
+    const real t6850 = t3226*t126;
+    const real t6851 = t3228*t132;
+    const real t6852 = t3215+t3214+t3216+t3218+t3219+t6734+t6735+t6736+t6738+t6849+t6850+
+t6851;
+    const real t6853 = t3226*t136;
+    const real t6854 = t3236*t275;
+    const real t6855 = t3234*t254;
+    const real t6856 = t6853+t6826+t6827+t6828+t6829+t3233+t6854+t6855+t6830+t6833+t3804+
+t4744;
+    const real t6861 = t4023*t50;
+    const real t6862 = t4023*t67;
+    const real t6863 = t4029*t72;
+    const real t6864 = t4029*t73;
+    const real t6865 = t4009*t139;
+    const real t6866 = t4033*t145;
+    const real t6867 = t4009*t146;
+    const real t6868 = t4033*t155;
+    const real t6869 = t4016*t212;
+    const real t6870 = t6861+t6862+t6863+t6864+t6865+t6866+t6867+t6868+t6869+t4015+t4022+
+t4025;
+    const real t6871 = t4044*t275;
+    const real t6872 = t4040*t77;
+    const real t6873 = t4046*t254;
+    const real t6874 = t4038*t126;
+    const real t6875 = t4040*t132;
+    const real t6876 = t4038*t136;
+    const real t6877 = t4020*t215;
+    const real t6878 = t4026+t4028+t6871+t6872+t6873+t6874+t6875+t6876+t4037+t4138+t4118+
+t6877+t4120;
+    const real t6883 = t3949*t50;
+    const real t6884 = t3949*t67;
+    const real t6885 = t3946*t72;
+    const real t6886 = t3946*t73;
+    const real t6887 = t3958*t77;
+    const real t6889 = t3958*t126;
+    const real t6890 = t3958*t132;
+    const real t6891 = t3958*t136;
+    const real t6897 = t6889+t6890+t6891+t3952*t139+t3954*t145+t3952*t146+t3954*t155+t3964
++t3835+t3836+t3965*t212;
+    const real t6904 = t3876*t50;
+    const real t6905 = t3878*t67;
+    const real t6906 = t3873*t72;
+    const real t6907 = t3873*t73;
+    const real t6911 = t3867+t3870+t4124+t4126+t3872+t6904+t6905+t6906+t6907+t4066+t4067+
+t4068+t4069+t3882*t139+t3880*t145+t3886*t146;
+    const real t6917 = t3817*t50;
+    const real t6918 = t3817*t67;
+    const real t6919 = t3814*t72;
+    const real t6920 = t3814*t73;
+    const real t6925 = t3820*t139;
+    const real t6926 = t3820*t145;
+    const real t6927 = t3820*t146;
+    const real t6928 = t3820*t155;
+    const real t6931 = t3809+t3810+t3811+t3812+t3813+t6917+t6918+t6919+t6920+t3826*t77+
+t3828*t126+t3826*t132+t3828*t136+t6925+t6926+t6927+t6928+t3833+t3837*t275+t3839
+*t254;
+    const real t6933 = t4062*t50;
+    const real t6934 = t4062*t67;
+    const real t6935 = t4060*t72;
+    const real t6936 = t4058*t73;
+    const real t6952 = t3970+t3971+t3972+t3973+t3974+t3978*t50+t3978*t67+t3975*t72+t3975*
+t73+t3986*t77+t3986*t126+t3986*t132+t3986*t136+t3981*t139+t3981*t145+t3981*t146
++t3981*t155+t3992;
+    const real t6954 = t4038*t77;
+    const real t6955 = t4040*t126;
+    const real t6956 = t4022+t4015+t4025+t4026+t4028+t6861+t6862+t6863+t6864+t6954+t6955;
+    const real t6957 = t4038*t132;
+    const real t6958 = t4040*t136;
+    const real t6959 = t4046*t275;
+    const real t6960 = t4044*t254;
+    const real t6961 = t6957+t6958+t6865+t6866+t6867+t6868+t4037+t6959+t6960+t6869+t6877+
+t4102;
+    const real t6681 = t6870+t6878;
+    const real t6687 = t3942+t3941+t3943+t3944+t3945+t6883+t6884+t6885+t6886+t6887+t6897;
+    const real t6691 = t3846*t20+t3850+t3849+t3844*t26+t3852;
+    const real t6694 = t3900*t50;
+    const real t6696 = t3902*t67;
+    const real t6702 = t4074*t77;
+    const real t6706 = t6956+t6961;
+    const real t6709 = t3935*t72;
+    const real t6712 = t3862*t73;
+    const real t6968 = (t3850+t3919+t3916)*t20+t6681*t240+(t3915+t3850+t3920+t3921)*t26+
+t6687*t212+t6691*t37+t6911*t146+(t3893+t3894+t3925+t3926+t3896+t6694+t6696)*t67
++t6931*t254+(t4054+t4051+t4078+t4056+t4081+t6933+t6934+t6935+t6936+t6702)*t77+
+t6952*t179+t6706*t143+(t3931+t3857+t3858+t3860+t3934+t3898+t3899+t6709+t6712)*
+t73;
+    const real t6969 = t3878*t50;
+    const real t6970 = t3876*t67;
+    const real t6973 = t3870+t4125+t3869+t3871+t4127+t6969+t6970+t6906+t6907+t4066+t4067+
+t4068+t4069+t3884*t139+t3886*t145;
+    const real t6975 = t3942+t3941+t3943+t3944+t3945+t6883+t6884+t6885+t6886+t6887+t6889;
+    const real t6982 = t6890+t6891+t3954*t139+t3952*t145+t3954*t146+t3952*t155+t3964+t3835
++t3836+t4000*t212+t3965*t215;
+    const real t6986 = t3870+t4125+t3869+t3871+t4127+t6969+t6970+t6906+t6907+t4066+t4067+
+t4068+t4069+t3886*t139;
+    const real t6990 = t4054+t4051+t4078+t4056+t4081+t6933+t6934+t6935+t6936+t4084*t77+
+t4074*t126;
+    const real t6997 = t3809+t3810+t3811+t3812+t3813+t6917+t6918+t6919+t6920+t3828*t77+
+t3826*t126+t3828*t132+t3826*t136+t6925+t6926+t6927+t6928+t3833+t3839*t275;
+    const real t7002 = t4033*t139;
+    const real t7003 = t4009*t145;
+    const real t7004 = t4033*t146;
+    const real t7005 = t4009*t155;
+    const real t7006 = t4020*t212;
+    const real t7007 = t4016*t215;
+    const real t7008 = t7002+t7003+t7004+t7005+t7006+t7007+t6861+t6862+t6863+t6864+t4008+
+t4013+t4015;
+    const real t7011 = t4022+t4025+t4026+t4028+t6871+t4005*t309+t6872+t6873+t6874+t4018*
+t240+t6875+t6876+t4037;
+    const real t7014 = t4022+t4015+t4025+t4026+t4028+t6861+t6862+t6863+t6864+t6954+t6955+
+t6957;
+    const real t7015 = t6958+t7002+t7003+t7004+t7005+t4037+t6959+t6960+t7006+t7007+t4119+
+t4139;
+    const real t7021 = t4058*t72;
+    const real t7022 = t4060*t73;
+    const real t7026 = t4079+t4053+t4051+t4080+t4057+t6933+t6934+t7021+t7022+t4070*t77+
+t4072*t126+t4074*t132;
+    const real t7032 = t4079+t4053+t4051+t4080+t4057+t6933+t6934+t7021+t7022+t4072*t77+
+t4070*t126+t4084*t132+t4074*t136;
+    const real t7038 = t3867+t3870+t4124+t4126+t3872+t6904+t6905+t6906+t6907+t4066+t4067+
+t4068+t4069+t3880*t139+t3882*t145+t3884*t146+t3886*t155;
+    const real t6780 = t6975+t6982;
+    const real t6787 = t3862*t72;
+    const real t6790 = t7008+t7011;
+    const real t6792 = t7014+t7015;
+    const real t6795 = t3902*t50;
+    const real t7040 = t6973*t145+t6780*t215+t6986*t139+t6990*t126+t6997*t275+(t3932+t3857
++t3856+t3933+t3861+t3898+t3899+t6787)*t72+t6790*t475+t4148+t6792*t309+(t3894+
+t3924+t3891+t3895+t3927+t6795)*t50+t7026*t132+t7032*t136+t7038*t155;
+    const real t7043 = t3215+t3214+t3216+t3218+t3219+t6734+t6735+t6736+t6738+t6849+t6850;
+    const real t7044 = t6851+t6853+t6739+t6740+t6741+t6742+t3233+t6854+t6855+t6743+t6744+
+t3797;
+    const real t7047 = t3166+t3168+t3169+t3170+t3171+t6804+t6805+t6806+t6807+t6808+t6810;
+    const real t7054 = t6811+t6812+t3180*t139+t3178*t145+t3180*t146+t3178*t155+t3190+t3761
++t3762+t4763*t212+t3191*t215;
+    const real t7057 = t4255*t50;
+    const real t7058 = t4253*t67;
+    const real t7059 = t4250*t72;
+    const real t7060 = t4250*t73;
+    const real t7061 = t4261*t139;
+    const real t7062 = t4263*t145;
+    const real t7063 = t4436+t4245+t4247+t4248+t4439+t7057+t7058+t7059+t7060+t4490+t4539+
+t4492+t4541+t7061+t7062;
+    const real t7065 = t4534*t50;
+    const real t7066 = t4534*t67;
+    const real t7067 = t4530*t72;
+    const real t7068 = t4532*t73;
+    const real t7069 = t4494*t77;
+    const real t7071 = t4523+t4610+t4525+t4611+t4529+t7065+t7066+t7067+t7068+t7069+t4542*
+t126;
+    const real t7073 = t4486*t50;
+    const real t7074 = t4486*t67;
+    const real t7075 = t4484*t72;
+    const real t7076 = t4482*t73;
+    const real t7078 = t4506*t126;
+    const real t7080 = t4500+t4477+t4478+t4480+t4503+t7073+t7074+t7075+t7076+t4508*t77+
+t7078+t4496*t132;
+    const real t7082 = t4217*t50;
+    const real t7083 = t4217*t67;
+    const real t7084 = t4197*t72;
+    const real t7085 = t4197*t73;
+    const real t7086 = t4224*t77;
+    const real t7087 = t4213*t126;
+    const real t7088 = t4224*t132;
+    const real t7089 = t4203+t4233+t4228+t4232+t4200+t7082+t7083+t7084+t7085+t7086+t7087+
+t7088;
+    const real t7090 = t4213*t136;
+    const real t7091 = t4201*t139;
+    const real t7092 = t4219*t145;
+    const real t7093 = t4201*t146;
+    const real t7094 = t4219*t155;
+    const real t7095 = t4236*t275;
+    const real t7096 = t4211*t254;
+    const real t7097 = t4229*t212;
+    const real t7098 = t4207*t215;
+    const real t7099 = t7090+t7091+t7092+t7093+t7094+t4210+t7095+t7096+t7097+t7098+t4682+
+t4453;
+    const real t6822 = t4267+t4412+t4547;
+    const real t7103 = t6822*t20;
+    const real t6831 = t4267+t4283*t20+t4285*t26+t4288+t4289;
+    const real t7107 = t6831*t37;
+    const real t6835 = t4426*t50;
+    const real t7110 = (t4416+t4420+t4514+t4516+t4422+t6835)*t50;
+    const real t6838 = t4279*t72;
+    const real t7113 = (t4274+t4272+t4333+t4334+t4278+t4424+t4425+t6838)*t72;
+    const real t6840 = t4336*t72;
+    const real t6841 = t4279*t73;
+    const real t7117 = (t4332+t4275+t4272+t4277+t4335+t4424+t4425+t6840+t6841)*t73;
+    const real t7118 = t4384*t50;
+    const real t7119 = t4384*t67;
+    const real t7120 = t4381*t72;
+    const real t7121 = t4381*t73;
+    const real t7126 = t4387*t139;
+    const real t7127 = t4387*t145;
+    const real t7128 = t4387*t146;
+    const real t7129 = t4387*t155;
+    const real t7131 = t4377+t4375+t4378+t4379+t4380+t7118+t7119+t7120+t7121+t4395*t77+
+t4393*t126+t4395*t132+t4393*t136+t7126+t7127+t7128+t7129+t4400+t4406*t275;
+    const real t7133 = t4325*t275;
+    const real t7134 = t4323*t254;
+    const real t7135 = t4311*t126;
+    const real t7136 = t4313*t77;
+    const real t7137 = t4311*t136;
+    const real t7138 = t4313*t132;
+    const real t7139 = t7133+t7134+t7135+t7136+t7137+t7138+t4292+t4452+t4318+t4296+t4295+
+t4294;
+    const real t7140 = t4301*t67;
+    const real t7141 = t4298*t72;
+    const real t7142 = t4298*t73;
+    const real t7143 = t4301*t50;
+    const real t7144 = t4304*t139;
+    const real t7145 = t4306*t145;
+    const real t7146 = t4304*t146;
+    const real t7147 = t4306*t155;
+    const real t7148 = t4319*t212;
+    const real t7149 = t4321*t215;
+    const real t7150 = t4297+t4467+t4469+t7140+t7141+t7142+t7143+t7144+t7145+t7146+t7147+
+t7148+t7149;
+    const real t6859 = t7089+t7099;
+    const real t6880 = t7139+t7150;
+    const real t7153 = t4271+t7063*t145+t7071*t126+t7080*t132+t6859*t309+t7103+t7107+t7110
++t7113+t7117+t7131*t275+t6880*t240;
+    const real t7154 = t4532*t72;
+    const real t7155 = t4530*t73;
+    const real t7156 = t4506*t77;
+    const real t7158 = t4494*t132;
+    const real t7160 = t4526+t4609+t4523+t4528+t4612+t7065+t7066+t7154+t7155+t7156+t4615*
+t126+t7158+t4542*t136;
+    const real t7162 = t4263*t139;
+    const real t7163 = t4436+t4245+t4247+t4248+t4439+t7057+t7058+t7059+t7060+t4490+t4539+
+t4492+t4541+t7162;
+    const real t7165 = t4203+t4233+t4228+t4232+t4200+t7082+t7083+t7084+t7085+t7086+t7087;
+    const real t7166 = t4219*t139;
+    const real t7167 = t4201*t145;
+    const real t7168 = t4219*t146;
+    const real t7169 = t4201*t155;
+    const real t7170 = t4207*t212;
+    const real t7171 = t4229*t215;
+    const real t7172 = t7088+t7090+t7166+t7167+t7168+t7169+t4210+t7095+t7096+t7170+t7171+
+t4695;
+    const real t7175 = t4350*t50;
+    const real t7176 = t4350*t67;
+    const real t7177 = t4347*t72;
+    const real t7178 = t4347*t73;
+    const real t7183 = t4353*t139;
+    const real t7184 = t4353*t145;
+    const real t7185 = t4353*t146;
+    const real t7186 = t4353*t155;
+    const real t7187 = t4404*t275;
+    const real t7189 = t4343+t4342+t4344+t4345+t4346+t7175+t7176+t7177+t7178+t4361*t77+
+t4359*t126+t4361*t132+t4359*t136+t7183+t7184+t7185+t7186+t4366+t7187+t4370*t254
+;
+    const real t6898 = t4267+t4546+t4411+t4413;
+    const real t7192 = t6898*t26;
+    const real t7193 = t4586*t50;
+    const real t7194 = t4586*t67;
+    const real t7195 = t4583*t72;
+    const real t7196 = t4583*t73;
+    const real t7197 = t4597*t77;
+    const real t7198 = t4595*t126;
+    const real t7199 = t4578+t4579+t4580+t4581+t4582+t7193+t7194+t7195+t7196+t7197+t7198;
+    const real t7200 = t4597*t132;
+    const real t7201 = t4595*t136;
+    const real t7202 = t4589*t139;
+    const real t7203 = t4591*t145;
+    const real t7204 = t4589*t146;
+    const real t7205 = t4591*t155;
+    const real t7206 = t4603*t212;
+    const real t7207 = t4605*t215;
+    const real t7208 = t7200+t7201+t7202+t7203+t7204+t7205+t4602+t4402+t4369+t7206+t7207;
+    const real t7211 = t4253*t50;
+    const real t7212 = t4255*t67;
+    const real t7213 = t4259*t139;
+    const real t7214 = t4257*t145;
+    const real t7215 = t4263*t146;
+    const real t7216 = t4245+t4244+t4437+t4438+t4249+t7211+t7212+t7059+t7060+t4490+t4539+
+t4492+t4541+t7213+t7214+t7215;
+    const real t7218 = t4257*t139;
+    const real t7219 = t4259*t145;
+    const real t7220 = t4261*t146;
+    const real t7221 = t4263*t155;
+    const real t7222 = t4245+t4244+t4437+t4438+t4249+t7211+t7212+t7059+t7060+t4490+t4539+
+t4492+t4541+t7218+t7219+t7220+t7221;
+    const real t7224 = t4559*t50;
+    const real t7225 = t4559*t67;
+    const real t7226 = t4556*t72;
+    const real t7227 = t4556*t73;
+    const real t7232 = t4562*t139;
+    const real t7233 = t4562*t145;
+    const real t7234 = t4562*t146;
+    const real t7235 = t4562*t155;
+    const real t7236 = t4552+t4551+t4553+t4554+t4555+t7224+t7225+t7226+t7227+t4569*t77+
+t4567*t126+t4569*t132+t4567*t136+t7232+t7233+t7234+t7235+t4574;
+    const real t6903 = t4518*t50;
+    const real t6908 = t4426*t67;
+    const real t7241 = (t4416+t4515+t4418+t4421+t4517+t6903+t6908)*t67;
+    const real t7243 = t4591*t139;
+    const real t7244 = t4589*t145;
+    const real t7245 = t4591*t146;
+    const real t7246 = t4589*t155;
+    const real t7247 = t4605*t212;
+    const real t7248 = t7198+t7200+t7201+t7243+t7244+t7245+t7246+t4602+t4402+t4369+t7247;
+    const real t7251 = t4321*t212;
+    const real t7252 = t4204*t309;
+    const real t7253 = t4223+t7251+t7133+t7134+t7135+t7136+t7137+t7138+t7252+t4292+t4318+
+t4296+t4295;
+    const real t7254 = t4306*t139;
+    const real t7255 = t4304*t145;
+    const real t7256 = t4306*t146;
+    const real t7257 = t4304*t155;
+    const real t7258 = t4319*t215;
+    const real t7260 = t4294+t4297+t7140+t7141+t7142+t7254+t7255+t7256+t7257+t7258+t7143+
+t4676+t4470*t240;
+    const real t7263 = t4482*t72;
+    const real t7264 = t4484*t73;
+    const real t6914 = t7165+t7172;
+    const real t6921 = t7199+t7208;
+    const real t6930 = t4578+t4579+t4580+t4581+t4582+t7193+t7194+t7195+t7196+t7197+t7248;
+    const real t6937 = t7253+t7260;
+    const real t6939 = t4496*t77;
+    const real t7268 = t7160*t136+t7163*t139+t6914*t143+t7189*t254+t7192+t6921*t215+t7216*
+t146+t7222*t155+t7236*t179+t7241+t6930*t212+t6937*t475+(t4476+t4477+t4501+t4502
++t4481+t7073+t7074+t7263+t7264+t6939)*t77;
+    const real t7283 = t4153+t4154+t4155+t4156+t4157+t4161*t50+t4161*t67+t4158*t72+t4158*
+t73+t4169*t77+t4169*t126+t4169*t132+t4169*t136+t4164*t139+t4164*t145+t4164*t146
++t4164*t155+t4175;
+    const real t7288 = t3241+t3245+t4728+t4729+t3247+t6796+t6797+t6435+t6436+t3280+t3281+
+t3282+t3283+t3257*t139+t3255*t145+t3261*t146;
+    const real t7293 = t3267+t4178+t3268+t3270+t4181+t6748+t6749+t6750+t6751+t4184*t77+
+t4186*t126+t3286*t132;
+    const real t7295 = t3301*t50;
+    const real t7296 = t3301*t67;
+    const real t7297 = t3299*t72;
+    const real t7298 = t3297*t73;
+    const real t7303 = t3293+t3578+t3292+t3295+t3581+t7295+t7296+t7297+t7298+t3586*t77+
+t3584*t126+t3314*t132+t3310*t136;
+    const real t7304 = t7303*t136;
+    const real t7305 = t3397*t50;
+    const real t7306 = t3397*t67;
+    const real t7307 = t3394*t72;
+    const real t7308 = t3394*t73;
+    const real t7309 = t3407*t77;
+    const real t7310 = t3409*t126;
+    const real t7311 = t3407*t132;
+    const real t7312 = t3409*t136;
+    const real t7313 = t3400*t139;
+    const real t7314 = t3402*t145;
+    const real t7315 = t3400*t146;
+    const real t7316 = t3402*t155;
+    const real t7317 = t3419*t275;
+    const real t7318 = t3421*t254;
+    const real t7319 = t3389+t3390+t3391+t3392+t3393+t7305+t7306+t7307+t7308+t7309+t7310+
+t7311+t7312+t7313+t7314+t7315+t7316+t3414+t7317+t7318;
+    const real t7321 = t3331*t50;
+    const real t7322 = t3329*t67;
+    const real t7323 = t3326*t72;
+    const real t7324 = t3326*t73;
+    const real t7326 = t3319+t3635+t3323+t3324+t3637+t7321+t7322+t7323+t7324+t3305+t4769+
+t3308+t4771+t3337*t139;
+    const real t7328 = t3435*t50;
+    const real t7329 = t3435*t67;
+    const real t7330 = t3432*t72;
+    const real t7331 = t3432*t73;
+    const real t7332 = t3445*t77;
+    const real t7333 = t3447*t126;
+    const real t7334 = t3427+t3428+t3429+t3430+t3431+t7328+t7329+t7330+t7331+t7332+t7333;
+    const real t7335 = t3445*t132;
+    const real t7336 = t3447*t136;
+    const real t7337 = t3438*t139;
+    const real t7338 = t3440*t145;
+    const real t7339 = t3438*t146;
+    const real t7340 = t3440*t155;
+    const real t7341 = t3457*t275;
+    const real t7342 = t3459*t254;
+    const real t7343 = t3453*t212;
+    const real t7344 = t3455*t215;
+    const real t7345 = t7335+t7336+t7337+t7338+t7339+t7340+t3452+t7341+t7342+t7343+t7344+
+t3462;
+    const real t7348 = t3539*t50;
+    const real t7349 = t3539*t67;
+    const real t7350 = t3536*t72;
+    const real t7351 = t3536*t73;
+    const real t7352 = t3548*t77;
+    const real t7353 = t3548*t126;
+    const real t7354 = t3530+t3532+t3533+t3534+t3535+t7348+t7349+t7350+t7351+t7352+t7353;
+    const real t7355 = t3548*t132;
+    const real t7356 = t3548*t136;
+    const real t7361 = t3555*t212;
+    const real t7363 = t7355+t7356+t3542*t139+t3544*t145+t3542*t146+t3544*t155+t3554+t4800
++t3418+t7361+t3557*t215;
+    const real t7366 = t3353*t50;
+    const real t7367 = t3351*t67;
+    const real t7368 = t3348*t72;
+    const real t7369 = t3348*t73;
+    const real t7370 = t3335*t139;
+    const real t7372 = t3355*t146;
+    const real t7374 = t3345+t3607+t3342+t3346+t3609+t7366+t7367+t7368+t7369+t4768+t3307+
+t4770+t3309+t7370+t3613*t145+t7372+t3357*t155;
+    const real t7376 = t3661*t50;
+    const real t7377 = t3661*t67;
+    const real t7378 = t3658*t72;
+    const real t7379 = t3658*t73;
+    const real t7380 = t3670*t77;
+    const real t7382 = t3670*t126;
+    const real t7383 = t3670*t132;
+    const real t7384 = t3670*t136;
+    const real t7390 = t7382+t7383+t7384+t3664*t139+t3666*t145+t3664*t146+t3666*t155+t3676
++t3416+t4801+t3677*t212;
+    const real t7393 = t3496*t50;
+    const real t7394 = t3496*t67;
+    const real t7395 = t3498*t72;
+    const real t7396 = t3498*t73;
+    const real t7397 = t3490*t77;
+    const real t7398 = t3492*t126;
+    const real t7399 = t3490*t132;
+    const real t7400 = t3485+t3506+t3504+t3509+t3510+t7393+t7394+t7395+t7396+t7397+t7398+
+t7399;
+    const real t7401 = t3492*t136;
+    const real t7402 = t3500*t139;
+    const real t7403 = t3483*t145;
+    const real t7404 = t3500*t146;
+    const real t7405 = t3483*t155;
+    const real t7406 = t3475*t275;
+    const real t7407 = t3479*t254;
+    const real t7408 = t3488*t212;
+    const real t7409 = t3507*t215;
+    const real t7410 = t7401+t7402+t7403+t7404+t7405+t3474+t7406+t7407+t7408+t7409+t3487+
+t4833;
+    const real t7413 = t3297*t72;
+    const real t7414 = t3299*t73;
+    const real t6994 = t3310*t77;
+    const real t7417 = (t3292+t3291+t3579+t3580+t3296+t7295+t7296+t7413+t7414+t6994)*t77;
+    const real t7420 = t3292+t3291+t3579+t3580+t3296+t7295+t7296+t7413+t7414+t3314*t77+
+t3310*t126;
+    const real t7421 = t7420*t126;
+    const real t6999 = t3384*t72;
+    const real t7424 = (t3620+t3378+t3379+t3621+t3383+t3369+t3370+t6999)*t72;
+    const real t7425 = t3690*t50;
+    const real t7426 = t3690*t67;
+    const real t7427 = t3687*t72;
+    const real t7428 = t3687*t73;
+    const real t7429 = t3699*t77;
+    const real t7430 = t3699*t126;
+    const real t7431 = t3699*t132;
+    const real t7432 = t3699*t136;
+    const real t7437 = t3682+t3683+t3684+t3685+t3686+t7425+t7426+t7427+t7428+t7429+t7430+
+t7431+t7432+t3693*t139+t3695*t145+t3693*t146+t3695*t155+t3705;
+    const real t7017 = t7334+t7345;
+    const real t7019 = t7354+t7363;
+    const real t7024 = t3653+t3654+t3655+t3656+t3657+t7376+t7377+t7378+t7379+t7380+t7390;
+    const real t7027 = t7400+t7410;
+    const real t7439 = t7304+t7319*t254+t7326*t139+t7017*t143+t7019*t215+t7374*t155+t7024*
+t212+t7027*t309+t7417+t7421+t7424+t7437*t179;
+    const real t7440 = t3329*t50;
+    const real t7441 = t3331*t67;
+    const real t7443 = t3335*t145;
+    const real t7445 = t3319+t3321+t3634+t3636+t3325+t7440+t7441+t7323+t7324+t3305+t4769+
+t3308+t4771+t3333*t139+t7443+t3337*t146;
+    const real t7033 = t3563+t3564+t3712;
+    const real t7448 = t7033*t20;
+    const real t7452 = t3293+t3578+t3292+t3295+t3581+t7295+t7296+t7297+t7298+t3584*t77+
+t3586*t126+t3310*t132;
+    const real t7453 = t7452*t132;
+    const real t7037 = t3623*t72;
+    const real t7039 = t3384*t73;
+    const real t7457 = (t3379+t3380+t3619+t3382+t3622+t3369+t3370+t7037+t7039)*t73;
+    const real t7046 = t3571*t20+t3564+t3562*t26+t3573+t3575;
+    const real t7461 = t7046*t37;
+    const real t7048 = t3373*t50;
+    const real t7464 = (t3466+t3361+t3365+t3366+t3469+t7048)*t50;
+    const real t7050 = t3371*t50;
+    const real t7051 = t3373*t67;
+    const real t7468 = (t3361+t3363+t3467+t3468+t3367+t7050+t7051)*t67;
+    const real t7469 = t3409*t77;
+    const real t7470 = t3407*t126;
+    const real t7471 = t3409*t132;
+    const real t7472 = t3407*t136;
+    const real t7473 = t3421*t275;
+    const real t7474 = t3389+t3390+t3391+t3392+t3393+t7305+t7306+t7307+t7308+t7469+t7470+
+t7471+t7472+t7313+t7314+t7315+t7316+t3414+t7473;
+    const real t7476 = t3351*t50;
+    const real t7477 = t3353*t67;
+    const real t7478 = t3355*t139;
+    const real t7480 = t3344+t3345+t3606+t3608+t3347+t7476+t7477+t7368+t7369+t4768+t3307+
+t4770+t3309+t7478+t3357*t145;
+    const real t7055 = t3711+t3566+t3564+t3568;
+    const real t7483 = t7055*t26;
+    const real t7484 = t3457*t254;
+    const real t7485 = t3447*t132;
+    const real t7486 = t3445*t136;
+    const real t7487 = t3447*t77;
+    const real t7488 = t3429+t3427+t3431+t3478+t3428+t3430+t7484+t4824+t3452+t7485+t7486+
+t7487;
+    const real t7489 = t3445*t126;
+    const real t7490 = t3459*t275;
+    const real t7491 = t7489+t7330+t7328+t7329+t7331+t7490+t3525+t7337+t7338+t7339+t7340+
+t7343+t7344;
+    const real t7494 = t3479*t275;
+    const real t7495 = t3490*t136;
+    const real t7496 = t3492*t77;
+    const real t7497 = t3474+t7402+t7403+t7404+t7405+t7408+t7395+t7393+t7394+t7396+t7494+
+t7495+t7496;
+    const real t7498 = t3490*t126;
+    const real t7499 = t3492*t132;
+    const real t7500 = t3475*t254;
+    const real t7502 = t3486*t240;
+    const real t7503 = t7498+t7499+t3485+t3504+t7500+t3506+t3509+t3510+t7409+t3597+t3602+
+t3600*t309+t7502;
+    const real t7077 = t7488+t7491;
+    const real t7081 = t7497+t7503;
+    const real t7506 = t7445*t146+t7448+t7453+t7457+t7461+t7464+t7468+t3710+t7474*t275+
+t7480*t145+t7483+t7077*t240+t7081*t475;
+    const real t7515 = t3319+t3321+t3634+t3636+t3325+t7440+t7441+t7323+t7324+t3305+t4769+
+t3308+t4771+t7370+t3333*t145+t7372+t3337*t155;
+    const real t7517 = t3402*t139;
+    const real t7518 = t3400*t145;
+    const real t7519 = t3402*t146;
+    const real t7520 = t3400*t155;
+    const real t7521 = t3389+t3390+t3391+t3392+t3393+t7305+t7306+t7307+t7308+t7309+t7310+
+t7311+t7312+t7517+t7518+t7519+t7520+t3414+t7317+t7318;
+    const real t7523 = t3427+t3428+t3429+t3430+t3431+t7328+t7329+t7330+t7331+t7332+t7333+
+t7335;
+    const real t7524 = t3440*t139;
+    const real t7525 = t3438*t145;
+    const real t7526 = t3440*t146;
+    const real t7527 = t3438*t155;
+    const real t7528 = t3455*t212;
+    const real t7529 = t3453*t215;
+    const real t7530 = t7336+t7524+t7525+t7526+t7527+t3452+t7341+t7342+t7528+t7529+t3487+
+t3526;
+    const real t7534 = t3319+t3635+t3323+t3324+t3637+t7321+t7322+t7323+t7324+t3305+t4769+
+t3308+t4771+t7478+t3337*t145;
+    const real t7538 = t3345+t3607+t3342+t3346+t3609+t7366+t7367+t7368+t7369+t4768+t3307+
+t4770+t3309+t3613*t139+t7443+t3357*t146;
+    const real t7544 = t3682+t3683+t3684+t3685+t3686+t7425+t7426+t7427+t7428+t7429+t7430+
+t7431+t7432+t3695*t139+t3693*t145+t3695*t146+t3693*t155+t3705;
+    const real t7546 = t3389+t3390+t3391+t3392+t3393+t7305+t7306+t7307+t7308+t7469+t7470+
+t7471+t7472+t7517+t7518+t7519+t7520+t3414+t7473;
+    const real t7116 = t7523+t7530;
+    const real t7548 = t7515*t155+t7304+t7521*t254+t7116*t309+t7534*t145+t7538*t146+t7417+
+t7421+t7544*t179+t7546*t275+t7424+t7448;
+    const real t7550 = t3344+t3345+t3606+t3608+t3347+t7476+t7477+t7368+t7369+t4768+t3307+
+t4770+t3309+t3357*t139;
+    const real t7552 = t3483*t146;
+    const real t7553 = t3500*t155;
+    const real t7554 = t3488*t215;
+    const real t7555 = t3507*t212;
+    const real t7556 = t3483*t139;
+    const real t7557 = t3474+t7395+t7393+t7394+t7396+t7552+t7553+t7554+t7555+t7556+t7494+
+t7495;
+    const real t7558 = t3500*t145;
+    const real t7559 = t7496+t7498+t7499+t7558+t3478+t3482+t3485+t3504+t7500+t3506+t3509+
+t3510+t4832;
+    const real t7562 = t3653+t3654+t3655+t3656+t3657+t7376+t7377+t7378+t7379+t7380+t7382;
+    const real t7568 = t7383+t7384+t3666*t139+t3664*t145+t3666*t146+t3664*t155+t3676+t3416
++t4801+t7361+t3677*t215;
+    const real t7571 = t3485+t3506+t3504+t3509+t3510+t7393+t7394+t7395+t7396+t7397+t7398;
+    const real t7572 = t7399+t7401+t7556+t7558+t7552+t7553+t3474+t7406+t7407+t7555+t7554+
+t4784;
+    const real t7575 = t3429+t4855+t3427+t3431+t3428+t3430+t7484+t7526+t7527+t7524+t7525+
+t3452+t3602;
+    const real t7577 = t7485+t7486+t7529+t3524*t309+t7528+t7487+t7489+t7330+t7328+t7329+
+t7331+t7490+t7502;
+    const real t7586 = t7353+t7355+t7356+t3544*t139+t3542*t145+t3544*t146+t3542*t155+t3554
++t4800+t3418+t3557*t212;
+    const real t7188 = t7557+t7559;
+    const real t7191 = t7562+t7568;
+    const real t7210 = t7571+t7572;
+    const real t7223 = t7575+t7577;
+    const real t7229 = t3530+t3532+t3533+t3534+t3535+t7348+t7349+t7350+t7351+t7352+t7586;
+    const real t7589 = t7550*t139+t7453+t7457+t7188*t240+t7191*t215+t7461+t7464+t7468+
+t7210*t143+t3710+t7223*t475+t7483+t7229*t212;
+    const real t7597 = t4343+t4342+t4344+t4345+t4346+t7175+t7176+t7177+t7178+t4359*t77+
+t4361*t126+t4359*t132+t4361*t136+t7183+t7184+t7185+t7186+t4366+t4370*t275;
+    const real t7599 = t4595*t77;
+    const real t7601 = t4597*t126;
+    const real t7602 = t4595*t132;
+    const real t7603 = t4597*t136;
+    const real t7604 = t7601+t7602+t7603+t7243+t7244+t7245+t7246+t4602+t4368+t4403+t7247;
+    const real t7611 = t4552+t4551+t4553+t4554+t4555+t7224+t7225+t7226+t7227+t4567*t77+
+t4569*t126+t4567*t132+t4569*t136+t7232+t7233+t7234+t7235+t4574;
+    const real t7617 = t4476+t4477+t4501+t4502+t4481+t7073+t7074+t7263+t7264+t7069+t4496*
+t126;
+    const real t7619 = t4311*t77;
+    const real t7620 = t4313*t126;
+    const real t7621 = t4311*t132;
+    const real t7622 = t4294+t4292+t4295+t4296+t4297+t7143+t7140+t7141+t7142+t7619+t7620+
+t7621;
+    const real t7623 = t4313*t136;
+    const real t7624 = t4323*t275;
+    const real t7625 = t4325*t254;
+    const real t7626 = t7623+t7254+t7255+t7256+t7257+t4318+t7624+t7625+t7251+t7258+t4471+
+t4648;
+    const real t7265 = t4578+t4579+t4580+t4581+t4582+t7193+t7194+t7195+t7196+t7599+t7604;
+    const real t7269 = t4542*t77;
+    const real t7273 = t7622+t7626;
+    const real t7629 = t7597*t275+t4271+t7265*t212+t7103+t7107+t7110+t7113+t7117+t7611*
+t179+(t4523+t4610+t4525+t4611+t4529+t7065+t7066+t7067+t7068+t7269)*t77+t7617*
+t126+t7273*t309;
+    const real t7630 = t4436+t4245+t4247+t4248+t4439+t7057+t7058+t7059+t7060+t4538+t4491+
+t4540+t4493+t7061+t7062;
+    const real t7632 = t4294+t4292+t4295+t4296+t4297+t7143+t7140+t7141+t7142+t7619+t7620;
+    const real t7633 = t7621+t7623+t7144+t7145+t7146+t7147+t4318+t7624+t7625+t7148+t7149+
+t4328;
+    const real t7636 = t4245+t4244+t4437+t4438+t4249+t7211+t7212+t7059+t7060+t4538+t4491+
+t4540+t4493+t7218+t7219+t7220+t7221;
+    const real t7638 = t4578+t4579+t4580+t4581+t4582+t7193+t7194+t7195+t7196+t7599+t7601;
+    const real t7639 = t7602+t7603+t7202+t7203+t7204+t7205+t4602+t4368+t4403+t7206+t7207;
+    const real t7642 = t4211*t275;
+    const real t7643 = t4200+t4203+t4210+t4216+t7642+t4223+t4228+t4232+t4233+t7083+t7252+
+t7097+t7098;
+    const real t7644 = t4213*t132;
+    const real t7646 = t4236*t254;
+    const real t7647 = t4224*t126;
+    const real t7648 = t4213*t77;
+    const real t7649 = t4224*t136;
+    const real t7650 = t7644+t4226*t240+t7646+t7084+t7082+t7092+t7091+t7647+t7648+t7085+
+t7649+t7093+t7094;
+    const real t7653 = t4436+t4245+t4247+t4248+t4439+t7057+t7058+t7059+t7060+t4538+t4491+
+t4540+t4493+t7162;
+    const real t7657 = t4500+t4477+t4478+t4480+t4503+t7073+t7074+t7075+t7076+t7156+t4508*
+t126+t7158+t4496*t136;
+    const real t7659 = t4200+t4203+t4210+t7642+t4228+t4232+t4233+t7083+t7644+t7646+t7084+
+t7082;
+    const real t7660 = t7647+t7648+t7085+t7649+t4452+t4681+t7171+t7170+t7167+t7166+t7169+
+t7168+t4469;
+    const real t7668 = t4377+t4375+t4378+t4379+t4380+t7118+t7119+t7120+t7121+t4393*t77+
+t4395*t126+t4393*t132+t4395*t136+t7126+t7127+t7128+t7129+t4400+t7187+t4406*t254
+;
+    const real t7672 = t4526+t4609+t4523+t4528+t4612+t7065+t7066+t7154+t7155+t4615*t77+
+t7078+t4542*t132;
+    const real t7674 = t4245+t4244+t4437+t4438+t4249+t7211+t7212+t7059+t7060+t4538+t4491+
+t4540+t4493+t7213+t7214+t7215;
+    const real t7287 = t7632+t7633;
+    const real t7291 = t7638+t7639;
+    const real t7294 = t7643+t7650;
+    const real t7302 = t7659+t7660;
+    const real t7676 = t7630*t145+t7287*t143+t7636*t155+t7291*t215+t7294*t475+t7653*t139+
+t7657*t136+t7192+t7302*t240+t7668*t254+t7241+t7672*t132+t7674*t146;
+    const real t7360 = t4192+t4748+t4749*t20+t4717*t26+t4752;
+    const real t7364 = t3730*t50;
+    const real t7381 = t6852+t6856;
+    const real t7493 = x[0];
+    const real t7387 = (t6968+t7040)*t7493;
+    const real t7388 = t7043+t7044;
+    const real t7391 = t7047+t7054;
+    const real t7411 = t7153+t7268;
+    const real t7419 = t7439+t7506;
+    const real t7423 = t3728*t50;
+    const real t7433 = t3730*t67;
+    const real t7436 = t7548+t7589;
+    const real t7442 = t7629+t7676;
+    const real t7679 = (t4192+t4875+t4716+t4719)*t26+t7360*t37+(t3770+t3720+t3722+t3723+
+t3773+t7364)*t50+(t4192+t4718+t4876)*t20+t7381*t309+t7387+t7388*t143+t7391*t215
++t7411*t2404+t7283*t179+t7288*t146+t7293*t132+t7419*t3120+(t3719+t3720+t3771+
+t3772+t3724+t7423+t7433)*t67+t7436*t3116+t7442*t2341;
+    const real t7446 = t4992+t12+t4993;
+    const real t7447 = t7446*t20;
+    const real t7450 = (t14+t2+t16+t4996)*t26;
+    const real t7454 = t7*t26+t2+t23+t24+t5000;
+    const real t7455 = t7454*t37;
+    const real t7456 = t45*t50;
+    const real t7459 = (t40+t5003+t5004+t5005+t5006+t7456)*t50;
+    const real t7479 = t1303+t5422;
+    const real t7481 = t7479*t5;
+    const real t7492 = (t714+t1305+t5425)*t20;
+    const real t7501 = t714+t1305+t1304*t20+t5429;
+    const real t7504 = t7501*t26;
+    const real t7505 = t720*t37;
+    const real t7508 = (t5425+t5422+t719+t5429+t7505)*t37;
+    const real t7516 = (t12+t16+t4993)*t20;
+    const real t7531 = (t8+t2+t14+t4996)*t26;
+    const real t7532 = t21*t20;
+    const real t7535 = (t12+t23+t7532+t5533+t25)*t37;
+    const real t7539 = t5536+t5537*t26+t5539*t20+t5542+t5543+t5545;
+    const real t7540 = t7539*t50;
+    const real t7541 = t5537*t5;
+    const real t7542 = t5539*t37;
+    const real t7545 = (t5536+t7541+t5549+t5550+t7542+t5553+t5554)*t67;
+    const real t7549 = t29+t30+t31+t32+t33+t5553+t5552*t67+t5558;
+    const real t7551 = t7549*t72;
+    const real t7560 = t45*t73;
+    const real t7563 = (t40+t39+t5004+t5005+t44+t5545+t5554+t5558+t7560)*t73;
+    const real t7566 = t617*t77;
+    const real t7569 = (t607+t831+t4979+t832+t4980+t611+t612+t4981+t4982+t7566)*t77;
+    const real t7576 = (t2+t16+t9)*t20;
+    const real t7579 = (t14+t12+t4992+t18)*t26;
+    const real t7580 = t7*t20;
+    const real t7582 = (t5533+t2+t7580+t23+t5000)*t37;
+    const real t7585 = t5549+t5539*t5+t5536+t5550+t5537*t37+t5545;
+    const real t7587 = t7585*t50;
+    const real t7591 = t5537*t20+t5539*t26+t5536+t5542+t5543+t5553+t5554;
+    const real t7592 = t7591*t67;
+    const real t7593 = t45*t72;
+    const real t7595 = (t40+t41+t5003+t43+t5006+t5545+t5554+t7593)*t72;
+    const real t7610 = t991+t996+t1001+t1008+t1014+t1025+t1034+t1048+t1057+t1075+t6430;
+    const real t7682 = (t1+t4991+t7447+t7450+t7455+t7459)*t50+t5021*t132+t5059*t139+(t5234
++t5409)*t2404+t5420*t145+(t713+t7481+t7492+t7504+t7508)*t37+t5446*t146+(t5477+
+t5525)*t240+(t1+t6+t7516+t7531+t7535+t7540+t7545+t7551+t7563)*t73+(t471+t4944+
+t4946+t4949+t4953+t4957+t4961+t4966+t4971+t7569)*t77+(t1+t4991+t7576+t7579+
+t7582+t7587+t7592+t7595)*t72+(t5720+t6016)*t3120+(t6019+t6047)*t143+(t6079+
+t6389)*t3116+t7610*t212+(t6837+t7679)*t7493;
+    df[4135] = t7493*t2341;
+    const real t7615 = df[4135];
+    df[4134] = t7615*t146;
+    df[4133] = t7615*t132;
+    df[4132] = t7615*t254;
+    df[4131] = t7615*t240;
+    df[4130] = df[4131];
+    df[4129] = t7615*t136;
+    df[4128] = t7615*t139;
+    df[4127] = t7615*t475;
+    const real t7616 = df[4127];
+    const real t7922 = df[4130];
+    df[4126] = t7922+t7616;
+    df[4125] = df[4126];
+    df[4124] = df[4125];
+    df[4123] = df[4126];
+    df[4122] = df[4123];
+    df[4120] = df[4123];
+    df[4119] = t7615*t215;
+    df[4118] = df[4119];
+    df[4117] = t7615*t155;
+    df[4116] = t7615*t143;
+    df[4115] = df[4116];
+    df[4114] = t7615*t145;
+    df[4112] = t7615*t309;
+    const real t7923 = df[4115];
+    const real t7928 = df[4112];
+    df[4111] = t7923+t7928;
+    df[4110] = df[4111];
+    df[4109] = df[4110];
+    df[4107] = df[4111];
+    df[4106] = df[4107];
+    df[4105] = df[4106];
+    df[4104] = t7615*t126;
+    df[4103] = t7615*t179;
+    df[4102] = t7615*t212;
+    const real t7637 = df[4102];
+    const real t7947 = df[4118];
+    df[4101] = t7947+t7637;
+    df[4100] = df[4101];
+    df[4099] = df[4101];
+    df[4098] = df[4099];
+    df[4097] = t7615*t275;
+    df[4096] = t7493*t3116;
+    const real t7641 = df[4096];
+    df[4095] = t7641*t212;
+    df[4094] = t7641*t475;
+    df[4093] = df[4094];
+    df[4092] = t7641*t143;
+    df[4091] = df[4092];
+    df[4090] = t7641*t215;
+    df[4089] = df[4090];
+    df[4088] = t7641*t240;
+    const real t7948 = df[4091];
+    const real t7949 = df[4088];
+    df[4087] = t7948+t7949;
+    df[4085] = df[4087];
+    df[4084] = df[4085];
+    df[4083] = df[4084];
+    df[4082] = df[4083];
+    df[4081] = df[4082];
+    df[4080] = t7641*t139;
+    df[4078] = t7641*t275;
+    df[4077] = t7641*t179;
+    df[4076] = t7641*t146;
+    df[4075] = t7641*t145;
+    df[4074] = t7641*t309;
+    const real t7654 = df[4074];
+    const real t7953 = df[4093];
+    df[4073] = t7953+t7654;
+    df[4072] = df[4073];
+    df[4071] = df[4073];
+    df[4070] = df[4071];
+    df[4069] = df[4070];
+    df[4068] = df[4069];
+    df[4066] = t7641*t254;
+    const real t7656 = df[4078];
+    const real t7658 = df[4066];
+    df[4065] = t7656+t7658;
+    df[4064] = df[4065];
+    df[4063] = df[4064];
+    df[4062] = df[4063];
+    df[4061] = t7641*t155;
+    df[4060] = t7493*t3120;
+    const real t7661 = df[4060];
+    df[4059] = t7661*t475;
+    const real t7662 = df[4059];
+    df[4058] = t7953+t7662;
+    df[4057] = t7949+t7662;
+    df[4056] = df[4057];
+    df[4055] = df[4056];
+    df[4053] = df[4057];
+    df[4052] = df[4053];
+    df[4051] = df[4052];
+    df[4050] = t7661*t240;
+    const real t7957 = df[4050];
+    df[4049] = t7953+t7957;
+    df[4048] = df[4049];
+    df[4046] = df[4049];
+    df[4045] = df[4046];
+    df[4044] = df[4045];
+    df[4043] = df[4045];
+    df[4042] = t7641+t7661;
+    df[4041] = t7661*t145;
+    const real t7666 = df[4075];
+    const real t7667 = df[4041];
+    df[4040] = t7666+t7667;
+    const real t7669 = df[4080];
+    df[4039] = t7669+t7667;
+    df[4038] = df[4039];
+    df[4037] = t7661*t275;
+    const real t7670 = df[4037];
+    df[4036] = t7656+t7670;
+    df[4035] = df[4036];
+    df[4034] = df[4035];
+    df[4033] = df[4034];
+    df[4032] = df[4033];
+    df[4031] = df[4042];
+    df[4030] = df[4031];
+    df[4029] = df[4030];
+    df[4028] = df[4029];
+    df[4027] = df[4028];
+    const real t7671 = df[4027];
+    df[4026] = t7671*t132;
+    df[4025] = df[4031];
+    df[4024] = t7661*t146;
+    const real t7673 = df[4076];
+    const real t7675 = df[4024];
+    df[4023] = t7673+t7675;
+    const real t7677 = df[4061];
+    df[4022] = t7677+t7675;
+    df[4021] = df[4022];
+    df[4019] = t7661*t179;
+    const real t7680 = df[4077];
+    const real t7681 = df[4019];
+    df[4018] = t7680+t7681;
+    df[4017] = df[4018];
+    df[4016] = df[4017];
+    df[4015] = df[4016];
+    df[4014] = df[4015];
+    df[4013] = df[4014];
+    df[4012] = df[4013];
+    df[4011] = df[4012];
+    df[4010] = df[4042];
+    df[4009] = df[4010];
+    const real t7958 = df[4009];
+    df[4008] = t7958*t126;
+    const real t7684 = df[4008];
+    const real t7686 = t7958*t77;
+    df[4006] = t7684+t7686;
+    df[4005] = df[4006];
+    df[4004] = t7661*t309;
+    const real t7687 = df[4004];
+    df[4003] = t7662+t7687;
+    df[4002] = df[4003];
+    df[4001] = t7948+t7687;
+    df[4000] = df[4001];
+    df[3999] = df[4002];
+    df[3998] = df[3999];
+    df[3997] = df[3998];
+    df[3996] = df[3997];
+    df[3995] = df[4000];
+    df[3993] = df[4001];
+    df[3992] = df[3993];
+    df[3991] = df[3992];
+    df[3990] = t7948+t7949+t7662+t7687;
+    df[3989] = df[3990];
+    df[3988] = df[3989];
+    df[3987] = df[3988];
+    df[3986] = t7661*t212;
+    const real t7690 = df[3986];
+    const real t7974 = df[4089];
+    df[3985] = t7974+t7690;
+    df[3984] = df[3985];
+    df[3983] = df[3985];
+    df[3982] = df[3983];
+    df[3981] = df[3982];
+    df[3980] = df[3981];
+    df[3979] = df[3980];
+    df[3978] = df[3979];
+    df[3977] = t7661*t155;
+    const real t7692 = df[3977];
+    df[3976] = t7677+t7692;
+    df[3975] = df[3976];
+    df[3974] = t7669+t7673+t7667+t7692;
+    df[3973] = df[3974];
+    df[3972] = t7673+t7692;
+    df[3971] = df[3972];
+    df[3970] = t7661*t215;
+    const real t7693 = df[3970];
+    df[3969] = t7974+t7693;
+    const real t7694 = df[4095];
+    df[3968] = t7694+t7693;
+    df[3967] = df[3968];
+    df[3965] = df[3968];
+    df[3964] = df[3965];
+    df[3963] = df[3964];
+    df[3962] = df[3963];
+    df[3961] = df[3962];
+    df[3960] = df[3961];
+    df[3959] = t7661*t143;
+    const real t7696 = df[3959];
+    df[3958] = t7957+t7696;
+    df[3957] = df[3958];
+    df[3956] = t7654+t7696;
+    df[3955] = df[3956];
+    df[3954] = df[3957];
+    df[3953] = df[3954];
+    df[3952] = df[3953];
+    df[3951] = df[3952];
+    df[3950] = df[3955];
+    df[3949] = df[3956];
+    df[3947] = df[3949];
+    df[3946] = df[3947];
+    df[3945] = t7953+t7654+t7957+t7696;
+    df[3944] = df[3945];
+    df[3943] = df[3944];
+    df[3942] = df[3943];
+    df[3941] = t7661*t139;
+    const real t7699 = df[3941];
+    df[3940] = t7666+t7677+t7675+t7699;
+    df[3939] = df[3940];
+    df[3938] = t7666+t7699;
+    df[3937] = df[3938];
+    df[3936] = t7661*t254;
+    const real t7700 = df[3936];
+    df[3935] = t7658+t7700;
+    df[3934] = df[3935];
+    df[3933] = t7670+t7700;
+    df[3932] = df[3933];
+    df[3931] = df[3932];
+    df[3930] = df[3931];
+    df[3929] = df[3934];
+    df[3928] = df[3929];
+    df[3927] = df[3928];
+    df[3926] = df[3927];
+    df[3925] = t7656+t7658+t7670+t7700;
+    df[3924] = df[3925];
+    df[3923] = df[3924];
+    df[3922] = df[3923];
+    df[3920] = t7958*t136;
+    const real t7702 = df[4026];
+    const real t7703 = df[3920];
+    df[3919] = t7702+t7703;
+    df[3918] = df[3919];
+    df[3917] = t7702+t7684+t7686+t7703;
+    df[3916] = df[3917];
+    df[3915] = t7493*t132;
+    df[3914] = t7493*t146;
+    df[3913] = t7493*t179;
+    df[3912] = t7493*t2404;
+    const real t7704 = df[4104];
+    const real t7705 = df[3912];
+    const real t7706 = t7705*t77;
+    df[3911] = t7704+t7706;
+    df[3910] = df[3911];
+    df[3909] = t7705*t475;
+    const real t7999 = df[3909];
+    df[3908] = t7928+t7999;
+    df[3907] = df[3908];
+    df[3906] = df[3907];
+    df[3905] = df[3906];
+    df[3904] = df[3905];
+    df[3902] = t7616+t7999;
+    df[3901] = df[3908];
+    df[3900] = t7705*t212;
+    const real t7709 = df[3900];
+    df[3899] = t7637+t7709;
+    df[3898] = df[3899];
+    df[3897] = df[3898];
+    df[3896] = df[3897];
+    df[3895] = df[3896];
+    df[3894] = t7615+t7705;
+    df[3893] = t7705*t179;
+    const real t7710 = df[4103];
+    const real t7711 = df[3893];
+    df[3892] = t7710+t7711;
+    df[3891] = df[3892];
+    df[3890] = df[3891];
+    df[3889] = df[3890];
+    df[3888] = df[3889];
+    df[3887] = df[3888];
+    df[3886] = df[3887];
+    df[3885] = df[3886];
+    df[3884] = t7705*t155;
+    const real t7712 = df[4117];
+    const real t7713 = df[3884];
+    df[3883] = t7712+t7713;
+    df[3882] = df[3883];
+    df[3881] = df[3882];
+    df[3880] = df[3881];
+    df[3879] = t7705*t146;
+    const real t7714 = df[4134];
+    const real t7715 = df[3879];
+    df[3878] = t7714+t7715;
+    df[3877] = df[3878];
+    df[3876] = df[3877];
+    df[3875] = t7714+t7712+t7713+t7715;
+    df[3874] = df[3875];
+    df[3873] = t7705*t215;
+    const real t7716 = df[3873];
+    df[3872] = t7947+t7716;
+    df[3871] = df[3872];
+    df[3870] = df[3871];
+    df[3869] = df[3870];
+    df[3868] = df[3869];
+    df[3867] = df[3868];
+    df[3866] = t7709+t7716;
+    df[3865] = df[3866];
+    df[3863] = df[3866];
+    df[3862] = df[3863];
+    df[3861] = t7947+t7637+t7709+t7716;
+    df[3860] = df[3861];
+    df[3859] = df[3860];
+    df[3858] = df[3859];
+    df[3857] = df[3894];
+    df[3856] = t7705*t254;
+    const real t7718 = df[4132];
+    const real t7719 = df[3856];
+    df[3855] = t7718+t7719;
+    const real t7720 = df[4097];
+    df[3854] = t7720+t7719;
+    df[3853] = df[3854];
+    df[3852] = df[3853];
+    df[3851] = df[3852];
+    df[3850] = df[3851];
+    df[3849] = df[3850];
+    df[3848] = df[3849];
+    df[3847] = df[3848];
+    df[3846] = t7705*t143;
+    const real t8004 = df[3846];
+    df[3845] = t7922+t8004;
+    df[3844] = df[3845];
+    df[3843] = df[3844];
+    df[3842] = df[3843];
+    df[3841] = df[3842];
+    df[3840] = df[3841];
+    df[3838] = t7705*t139;
+    const real t7722 = df[4128];
+    const real t7723 = df[3838];
+    df[3837] = t7722+t7723;
+    df[3836] = t7705*t136;
+    const real t7724 = df[4129];
+    const real t7725 = df[3836];
+    df[3835] = t7724+t7725;
+    df[3834] = df[3835];
+    const real t7726 = df[4133];
+    df[3833] = t7726+t7725;
+    df[3832] = df[3833];
+    df[3830] = t7705*t240;
+    const real t7728 = df[3830];
+    df[3829] = t7923+t7728;
+    df[3828] = df[3829];
+    df[3827] = df[3828];
+    df[3826] = df[3827];
+    df[3825] = df[3826];
+    df[3824] = df[3825];
+    df[3823] = t7923+t7928+t7999+t7728;
+    df[3822] = df[3823];
+    df[3821] = df[3822];
+    df[3820] = df[3821];
+    df[3818] = t7999+t7728;
+    df[3817] = df[3818];
+    df[3816] = df[3817];
+    df[3815] = df[3816];
+    df[3814] = df[3815];
+    df[3813] = df[3814];
+    df[3812] = t7705*t275;
+    const real t7730 = df[3812];
+    df[3811] = t7718+t7730;
+    df[3810] = df[3811];
+    df[3809] = df[3810];
+    df[3808] = df[3809];
+    df[3807] = df[3808];
+    df[3806] = df[3807];
+    df[3805] = df[3806];
+    df[3804] = df[3805];
+    df[3803] = df[3894];
+    df[3802] = df[3803];
+    df[3801] = df[3802];
+    df[3800] = df[3801];
+    df[3799] = df[3800];
+    df[3798] = t7705*t309;
+    const real t7731 = df[3798];
+    df[3797] = t7616+t7731;
+    df[3796] = df[3797];
+    df[3795] = t8004+t7731;
+    df[3794] = df[3795];
+    df[3793] = df[3797];
+    df[3792] = df[3793];
+    df[3791] = df[3792];
+    df[3790] = df[3791];
+    df[3789] = df[3794];
+    df[3787] = df[3795];
+    df[3786] = df[3787];
+    df[3785] = df[3786];
+    df[3784] = t7922+t7616+t8004+t7731;
+    df[3783] = df[3784];
+    df[3782] = df[3783];
+    df[3781] = df[3782];
+    df[3780] = t7705*t132;
+    const real t7734 = df[3780];
+    df[3779] = t7726+t7734;
+    df[3778] = t7724+t7734;
+    df[3777] = df[3778];
+    df[3776] = t7724+t7704+t7706+t7734;
+    df[3775] = df[3776];
+    df[3774] = t7705*t126;
+    const real t7735 = df[3774];
+    df[3773] = t7704+t7735;
+    const real t7736 = t7615*t77;
+    df[3772] = t7736+t7735;
+    df[3771] = df[3772];
+    df[3770] = t7726+t7736+t7725+t7735;
+    df[3769] = df[3770];
+    df[3768] = t7705*t145;
+    const real t7737 = df[4114];
+    const real t7738 = df[3768];
+    df[3767] = t7737+t7738;
+    df[3766] = df[3767];
+    df[3765] = t7714+t7722+t7712+t7737+t7713+t7715+t7723+t7738;
+    df[3764] = df[3765];
+    df[3763] = t7722+t7737+t7723+t7738;
+    df[3762] = df[3763];
+    df[3761] = t7493*t215;
+    df[3760] = df[3761];
+    df[3759] = t7493*t143;
+    df[3758] = df[3759];
+    df[3757] = t7493*t7493;
+    const real t7739 = df[3757];
+    df[3756] = t7739*t155;
+    df[3755] = t7739*t136;
+    df[3754] = t7739*t132;
+    const real t7740 = df[3755];
+    const real t7741 = df[3754];
+    df[3753] = t7740+t7741;
+    df[3752] = df[3753];
+    df[3751] = t7739*t309;
+    df[3750] = df[3751];
+    df[3749] = t7739*t475;
+    df[3748] = df[3749];
+    const real t7742 = df[3748];
+    const real t8019 = df[3750];
+    df[3747] = t8019+t7742;
+    df[3746] = df[3747];
+    df[3745] = df[3746];
+    df[3744] = df[3745];
+    df[3743] = df[3744];
+    df[3742] = df[3743];
+    df[3741] = t7739*t275;
+    df[3740] = t7739*t126;
+    df[3739] = t7739*t139;
+    df[3738] = t7739*t215;
+    df[3737] = df[3738];
+    df[3736] = t7739*t145;
+    const real t7743 = df[3739];
+    const real t7744 = df[3736];
+    df[3735] = t7743+t7744;
+    df[3734] = df[3735];
+    df[3732] = t7739*t143;
+    const real t7746 = df[3732];
+    df[3731] = t8019+t7746;
+    df[3730] = df[3731];
+    df[3729] = df[3730];
+    df[3728] = df[3731];
+    df[3726] = df[3728];
+    df[3725] = df[3726];
+    df[3724] = t7739*t179;
+    const real t7749 = df[3740];
+    const real t7750 = t7739*t77;
+    df[3723] = t7749+t7750;
+    df[3722] = df[3723];
+    df[3721] = t7740+t7741+t7749+t7750;
+    df[3720] = df[3721];
+    df[3719] = t7739*t254;
+    const real t7751 = df[3741];
+    const real t7752 = df[3719];
+    df[3718] = t7751+t7752;
+    df[3717] = df[3718];
+    df[3716] = df[3717];
+    df[3715] = df[3716];
+    df[3714] = df[3715];
+    df[3713] = df[3714];
+    df[3712] = df[3713];
+    df[3711] = df[3712];
+    df[3710] = t7739*t146;
+    const real t7753 = df[3756];
+    const real t7754 = df[3710];
+    df[3709] = t7753+t7743+t7744+t7754;
+    df[3708] = df[3709];
+    df[3707] = t7753+t7754;
+    df[3706] = df[3707];
+    df[3705] = t7739*t212;
+    const real t7755 = df[3705];
+    const real t8020 = df[3737];
+    df[3704] = t8020+t7755;
+    df[3703] = df[3704];
+    df[3702] = df[3704];
+    df[3701] = df[3702];
+    df[3700] = df[3701];
+    df[3699] = df[3700];
+    df[3698] = df[3699];
+    df[3697] = df[3698];
+    df[3696] = t7739*t240;
+    const real t7757 = df[3696];
+    df[3695] = t7746+t7757;
+    df[3694] = t7742+t7757;
+    df[3693] = df[3694];
+    df[3692] = df[3693];
+    df[3691] = df[3692];
+    df[3690] = df[3691];
+    df[3689] = df[3690];
+    df[3687] = df[3695];
+    df[3686] = df[3687];
+    df[3685] = df[3686];
+    df[3684] = df[3685];
+    df[3683] = df[3684];
+    df[3682] = t8019+t7742+t7746+t7757;
+    df[3681] = df[3682];
+    df[3680] = df[3681];
+    df[3679] = df[3680];
+    df[3678] = t7493*t309;
+    const real t8023 = df[3758];
+    const real t8025 = df[3678];
+    df[3677] = t8023+t8025;
+    df[3676] = df[3677];
+    df[3675] = df[3676];
+    df[3673] = df[3677];
+    df[3672] = df[3673];
+    df[3671] = df[3672];
+    df[3669] = t7493*t475;
+    const real t8043 = df[3669];
+    df[3668] = t8025+t8043;
+    df[3666] = df[3668];
+    df[3665] = df[3666];
+    df[3664] = df[3665];
+    df[3663] = df[3664];
+    df[3662] = df[3663];
+    df[3661] = t7493*t126;
+    df[3660] = t7493*t212;
+    const real t7764 = df[3660];
+    const real t8046 = df[3760];
+    df[3659] = t8046+t7764;
+    df[3658] = df[3659];
+    df[3657] = df[3659];
+    df[3656] = df[3657];
+    df[3655] = df[3656];
+    df[3654] = df[3655];
+    df[3653] = df[3654];
+    df[3652] = df[3653];
+    df[3651] = t7493*t155;
+    const real t7766 = df[3914];
+    const real t7767 = df[3651];
+    df[3650] = t7766+t7767;
+    df[3649] = df[3650];
+    df[3648] = t7493*t139;
+    const real t7768 = t7493*t77;
+    const real t7769 = df[3661];
+    df[3647] = t7768+t7769;
+    df[3646] = df[3647];
+    df[3645] = t7493*t254;
+    df[3644] = t7493*t275;
+    const real t7770 = df[3645];
+    const real t7771 = df[3644];
+    df[3643] = t7770+t7771;
+    df[3642] = df[3643];
+    df[3641] = df[3642];
+    df[3640] = df[3641];
+    df[3639] = df[3640];
+    df[3638] = df[3639];
+    df[3637] = df[3638];
+    df[3636] = df[3637];
+    df[3635] = t7493*t136;
+    const real t7772 = df[3915];
+    const real t7773 = df[3635];
+    df[3634] = t7772+t7773;
+    df[3633] = df[3634];
+    df[3632] = t7772+t7768+t7769+t7773;
+    df[3631] = df[3632];
+    df[3630] = t7493*t240;
+    const real t7774 = df[3630];
+    df[3629] = t8023+t7774;
+    df[3628] = df[3629];
+    df[3627] = df[3628];
+    df[3626] = df[3627];
+    df[3625] = df[3626];
+    df[3624] = df[3625];
+    df[3623] = t8023+t8025+t8043+t7774;
+    df[3621] = df[3623];
+    df[3620] = df[3621];
+    df[3619] = df[3620];
+    df[3618] = t8043+t7774;
+    df[3617] = df[3618];
+    df[3616] = df[3617];
+    df[3615] = df[3616];
+    df[3614] = df[3615];
+    df[3613] = df[3614];
+    df[3612] = t7493*t4135;
+    const real t7776 = df[3612];
+    df[3611] = t7776*t126;
+    const real t7777 = t7776*t77;
+    const real t7778 = df[3611];
+    df[3610] = t7777+t7778;
+    df[3609] = df[3610];
+    df[3608] = t7776*t254;
+    df[3607] = t7776*t143;
+    df[3606] = df[3607];
+    df[3605] = t7776*t132;
+    df[3604] = t7776*t215;
+    df[3603] = df[3604];
+    df[3602] = t7776*t240;
+    const real t8049 = df[3606];
+    const real t8052 = df[3602];
+    df[3601] = t8049+t8052;
+    df[3600] = df[3601];
+    df[3598] = df[3601];
+    df[3597] = df[3598];
+    df[3596] = df[3597];
+    df[3595] = df[3596];
+    df[3594] = t7776*t309;
+    const real t7781 = df[3594];
+    df[3593] = t8052+t7781;
+    df[3592] = t8049+t7781;
+    df[3591] = df[3592];
+    df[3590] = df[3591];
+    df[3588] = df[3592];
+    df[3587] = df[3588];
+    df[3586] = df[3587];
+    df[3585] = t7776*t155;
+    const real t7784 = t73+t50;
+    df[3584] = t7776*t7784;
+    df[3583] = df[3584];
+    const real t7785 = t7776*t73;
+    const real t7787 = t7776*t72;
+    df[3581] = t7785+t7787;
+    df[3580] = df[3581];
+    df[3579] = t7776*t50+t7787;
+    df[3578] = df[3579];
+    df[3577] = t7776*t146;
+    const real t7789 = df[3585];
+    const real t7790 = df[3577];
+    df[3576] = t7789+t7790;
+    df[3575] = df[3576];
+    df[3574] = t7777+t7778+t7789+t7790;
+    df[3573] = df[3574];
+    df[3572] = t7776*t136;
+    const real t7791 = df[3605];
+    const real t7792 = df[3572];
+    df[3571] = t7791+t7792;
+    df[3570] = df[3571];
+    df[3569] = t7777+t7778+t7791+t7792;
+    df[3568] = df[3569];
+    df[3567] = t7791+t7789+t7790+t7792;
+    df[3566] = df[3567];
+    df[3565] = t7776*t179;
+    df[3564] = t7776*t145;
+    df[3563] = t7776*t139;
+    const real t7793 = df[3564];
+    const real t7794 = df[3563];
+    df[3562] = t7789+t7790+t7793+t7794;
+    df[3561] = df[3562];
+    df[3560] = df[3561];
+    df[3559] = df[3560];
+    df[3558] = df[3559];
+    df[3557] = df[3558];
+    df[3556] = t7793+t7794;
+    df[3555] = df[3556];
+    df[3554] = t7777+t7778+t7793+t7794;
+    df[3553] = t7791+t7792+t7793+t7794;
+    df[3552] = df[3553];
+    df[3551] = df[3554];
+    df[3550] = t7776*t20+t7776*t26;
+    df[3549] = t7785+t7776*t67;
+    const real t7798 = t67+t72;
+    df[3548] = t7776*t7798;
+    df[3547] = df[3548];
+    df[3546] = df[3549];
+    df[3545] = t7776*t275;
+    const real t7799 = df[3608];
+    const real t7800 = df[3545];
+    df[3544] = t7799+t7800;
+    df[3543] = df[3544];
+    df[3542] = df[3543];
+    df[3541] = df[3542];
+    df[3540] = df[3541];
+    df[3539] = df[3540];
+    df[3538] = df[3539];
+    df[3537] = df[3538];
+    df[3536] = t7776*t212;
+    const real t7801 = df[3536];
+    const real t8089 = df[3603];
+    df[3535] = t8089+t7801;
+    df[3534] = df[3535];
+    df[3533] = t7799+t8089+t7800+t7801;
+    df[3532] = df[3534];
+    df[3531] = df[3532];
+    df[3530] = df[3535];
+    df[3529] = df[3530];
+    df[3528] = df[3529];
+    df[3527] = df[3528];
+    df[3526] = df[3527];
+    df[3525] = df[3526];
+    df[3524] = df[3533];
+    df[3523] = df[3524];
+    df[3522] = df[3523];
+    df[3521] = df[3522];
+    df[3520] = t7776*t475;
+    const real t7803 = df[3520];
+    df[3519] = t8052+t7803;
+    df[3518] = t8049+t8052+t7781+t7803;
+    df[3517] = df[3518];
+    df[3516] = df[3519];
+    df[3515] = df[3517];
+    df[3514] = df[3515];
+    df[3513] = df[3514];
+    df[3512] = df[3513];
+    df[3511] = t7781+t7803;
+    df[3510] = df[3511];
+    df[3509] = df[3516];
+    df[3508] = df[3516];
+    df[3506] = df[3519];
+    df[3505] = df[3506];
+    df[3504] = df[3511];
+    df[3503] = df[3504];
+    df[3502] = df[3518];
+    df[3501] = df[3502];
+    df[3500] = df[3501];
+    df[3499] = df[3503];
+    df[3498] = df[3499];
+    df[3497] = t7493*t145;
+    const real t7805 = df[3648];
+    const real t7806 = df[3497];
+    df[3496] = t7766+t7767+t7805+t7806;
+    df[3495] = df[3496];
+    df[3494] = t7805+t7806;
+    df[3493] = df[3494];
+    df[3491] = t212*t212;
+    df[3490] = t212*t254;
+    df[3489] = t212*t275;
+    const real t7807 = df[3490];
+    const real t7808 = df[3489];
+    df[3488] = t7807+t7808;
+    df[3487] = df[3488];
+    df[3486] = df[3487];
+    df[3485] = df[3486];
+    df[3484] = t212*t179;
+    df[3483] = t212*t155;
+    df[3482] = t212*t146;
+    df[3481] = t212*t145;
+    df[3480] = t212*t139;
+    df[3478] = t3116*t143;
+    df[3477] = df[3478];
+    df[3476] = t3116*t146;
+    df[3475] = t3116*t275;
+    df[3474] = t3116*t155;
+    df[3473] = t3116*t3116;
+    const real t7809 = df[3473];
+    df[3472] = t7809*t212;
+    df[3471] = t7809*t240;
+    df[3470] = df[3471];
+    df[3469] = t7809*t179;
+    df[3468] = t7809*t309;
+    df[3467] = df[3468];
+    df[3466] = t7809*t139;
+    df[3465] = t7809*t155;
+    df[3463] = t7809*t215;
+    df[3462] = df[3463];
+    df[3461] = t7809*t475;
+    const real t8105 = df[3467];
+    const real t8112 = df[3461];
+    df[3460] = t8105+t8112;
+    df[3459] = df[3460];
+    df[3458] = df[3459];
+    df[3457] = df[3458];
+    df[3456] = df[3457];
+    df[3455] = df[3456];
+    df[3453] = t7809*t275;
+    df[3452] = t7809*t145;
+    df[3451] = t7809*t254;
+    const real t7812 = df[3453];
+    const real t7813 = df[3451];
+    df[3450] = t7812+t7813;
+    df[3449] = df[3450];
+    df[3448] = df[3449];
+    df[3447] = df[3448];
+    df[3446] = t7809*t146;
+    df[3445] = t7809*t143;
+    const real t7814 = df[3445];
+    const real t8120 = df[3470];
+    df[3444] = t8120+t7814;
+    df[3443] = df[3444];
+    df[3442] = df[3444];
+    df[3441] = df[3442];
+    df[3440] = df[3443];
+    df[3439] = df[3440];
+    df[3437] = t3116*t215;
+    df[3436] = df[3437];
+    df[3435] = t3116*t145;
+    df[3434] = t3116*t3120;
+    const real t7816 = df[3434];
+    df[3433] = t7816*t132;
+    df[3432] = t7816*t240;
+    df[3431] = df[3432];
+    df[3430] = t7816*t126;
+    df[3429] = t7816*t309;
+    df[3428] = df[3429];
+    df[3427] = t7816*t145;
+    df[3426] = t7816*t143;
+    const real t7817 = df[3426];
+    const real t8128 = df[3431];
+    df[3425] = t8128+t7817;
+    df[3424] = df[3425];
+    const real t8133 = df[3428];
+    df[3423] = t8133+t7817;
+    df[3422] = df[3423];
+    df[3421] = df[3424];
+    df[3420] = df[3421];
+    df[3419] = df[3420];
+    df[3418] = df[3419];
+    df[3417] = df[3422];
+    df[3416] = df[3423];
+    df[3414] = df[3416];
+    df[3413] = df[3414];
+    df[3412] = t7816*t139;
+    const real t7820 = df[3427];
+    const real t7821 = df[3412];
+    df[3411] = t7820+t7821;
+    df[3410] = df[3411];
+    df[3409] = t7816*t155;
+    df[3408] = t7816*t475;
+    const real t7822 = df[3408];
+    df[3407] = t8128+t7822;
+    df[3406] = df[3407];
+    df[3405] = t8128+t8133+t7817+t7822;
+    df[3404] = df[3407];
+    df[3403] = df[3404];
+    df[3402] = df[3405];
+    df[3401] = df[3402];
+    df[3399] = df[3405];
+    df[3398] = df[3404];
+    df[3397] = df[3398];
+    df[3396] = t8133+t7822;
+    df[3395] = df[3396];
+    df[3394] = df[3395];
+    df[3393] = df[3394];
+    df[3392] = df[3393];
+    df[3391] = df[3392];
+    df[3390] = t7816*t275;
+    df[3389] = t7816*t215;
+    df[3388] = df[3389];
+    df[3386] = t7816*t254;
+    const real t7826 = df[3390];
+    const real t7827 = df[3386];
+    df[3385] = t7826+t7827;
+    df[3384] = df[3385];
+    df[3383] = df[3384];
+    df[3382] = df[3383];
+    df[3381] = df[3382];
+    df[3380] = df[3381];
+    df[3379] = df[3380];
+    df[3378] = df[3379];
+    df[3377] = t7816*t136;
+    const real t7828 = df[3433];
+    const real t7829 = df[3377];
+    df[3376] = t7828+t7829;
+    df[3375] = df[3376];
+    const real t7830 = df[3430];
+    const real t7831 = t7816*t77;
+    df[3374] = t7830+t7831;
+    df[3373] = df[3374];
+    df[3372] = t7828+t7830+t7831+t7829;
+    df[3371] = df[3372];
+    df[3370] = t7816*t212;
+    const real t7832 = df[3370];
+    const real t8140 = df[3388];
+    df[3369] = t8140+t7832;
+    df[3368] = df[3369];
+    df[3367] = df[3369];
+    df[3366] = df[3367];
+    df[3365] = df[3366];
+    df[3364] = df[3365];
+    df[3363] = df[3364];
+    df[3362] = df[3363];
+    df[3361] = t7816*t179;
+    df[3360] = t7816*t146;
+    const real t7834 = df[3409];
+    const real t7835 = df[3360];
+    df[3359] = t7820+t7821+t7834+t7835;
+    df[3358] = df[3359];
+    df[3357] = t7834+t7835;
+    df[3356] = df[3357];
+    df[3355] = t3116*t254;
+    const real t7836 = df[3475];
+    const real t7837 = df[3355];
+    df[3354] = t7836+t7837;
+    df[3353] = df[3354];
+    df[3352] = df[3353];
+    df[3351] = df[3352];
+    df[3350] = t3116*t309;
+    df[3349] = df[3350];
+    df[3348] = t3116*t240;
+    const real t8145 = df[3477];
+    const real t8146 = df[3348];
+    df[3347] = t8145+t8146;
+    df[3346] = df[3347];
+    df[3345] = df[3346];
+    df[3344] = df[3345];
+    df[3343] = df[3344];
+    df[3342] = df[3343];
+    df[3339] = t3116*t139;
+    df[3338] = t3116*t179;
+    df[3337] = t3116*t475;
+    const real t8147 = df[3349];
+    const real t8148 = df[3337];
+    df[3336] = t8147+t8148;
+    df[3335] = df[3336];
+    df[3334] = df[3335];
+    df[3333] = df[3334];
+    df[3332] = df[3333];
+    df[3330] = df[3336];
+    df[3329] = t3116*t212;
+    df[3327] = t143*t143;
+    df[3326] = df[3327];
+    df[3325] = t143*t215;
+    df[3324] = df[3325];
+    df[3323] = t143*t212;
+    df[3322] = t143*t254;
+    df[3321] = t143*t275;
+    df[3320] = t143*t179;
+    df[3319] = t143*t155;
+    df[3318] = t143*t146;
+    df[3317] = t143*t145;
+    df[3316] = t143*t139;
+    df[3313] = t3120*t145;
+    const real t7841 = df[3435];
+    const real t7842 = df[3313];
+    df[3312] = t7841+t7842;
+    const real t7843 = df[3339];
+    df[3311] = t7843+t7842;
+    df[3310] = df[3311];
+    df[3309] = t3120*t139;
+    const real t7844 = df[3309];
+    df[3308] = t7841+t7844;
+    df[3307] = df[3308];
+    df[3306] = t3120*t475;
+    df[3305] = df[3306];
+    const real t7846 = df[3305];
+    df[3304] = t8146+t7846;
+    df[3303] = t8148+t7846;
+    df[3302] = df[3304];
+    df[3301] = df[3302];
+    df[3300] = df[3301];
+    df[3299] = df[3300];
+    df[3298] = df[3299];
+    df[3297] = t3120*t3120;
+    const real t7847 = df[3297];
+    df[3296] = t7847*t240;
+    df[3295] = df[3296];
+    const real t7849 = df[3295];
+    df[3294] = t8112+t7849;
+    df[3293] = df[3294];
+    df[3292] = df[3293];
+    df[3291] = df[3292];
+    df[3290] = df[3291];
+    df[3289] = df[3290];
+    df[3288] = t7847*t254;
+    const real t7850 = df[3288];
+    df[3287] = t7813+t7850;
+    df[3286] = df[3287];
+    df[3285] = df[3286];
+    df[3284] = df[3285];
+    df[3283] = df[3284];
+    df[3282] = df[3283];
+    df[3281] = t7847*t275;
+    const real t7851 = df[3281];
+    df[3280] = t7812+t7851;
+    df[3279] = t7850+t7851;
+    df[3278] = df[3279];
+    df[3277] = df[3278];
+    df[3276] = df[3277];
+    df[3275] = df[3280];
+    df[3274] = df[3275];
+    df[3273] = df[3274];
+    df[3272] = df[3273];
+    df[3271] = t7812+t7813+t7850+t7851;
+    df[3270] = df[3271];
+    df[3269] = df[3270];
+    df[3268] = df[3269];
+    df[3267] = t7847*t146;
+    const real t7852 = df[3446];
+    const real t7853 = df[3267];
+    df[3266] = t7852+t7853;
+    const real t7854 = df[3465];
+    df[3265] = t7854+t7853;
+    df[3264] = df[3265];
+    df[3263] = t7847*t145;
+    const real t7855 = df[3452];
+    const real t7856 = df[3263];
+    df[3262] = t7855+t7856;
+    const real t7857 = df[3466];
+    df[3261] = t7857+t7856;
+    df[3260] = df[3261];
+    df[3259] = t7847*t139;
+    const real t7858 = df[3259];
+    df[3258] = t7854+t7855+t7853+t7858;
+    df[3257] = df[3258];
+    df[3256] = t7855+t7858;
+    df[3255] = df[3256];
+    df[3254] = t7809+t7847;
+    df[3253] = df[3254];
+    df[3252] = df[3253];
+    df[3251] = t7847*t179;
+    const real t7859 = df[3469];
+    const real t7860 = df[3251];
+    df[3250] = t7859+t7860;
+    df[3249] = df[3250];
+    df[3248] = df[3249];
+    df[3247] = df[3248];
+    df[3246] = df[3247];
+    df[3245] = df[3246];
+    df[3244] = df[3245];
+    df[3243] = df[3244];
+    df[3242] = t7847*t309;
+    const real t8195 = df[3242];
+    df[3241] = t7814+t8195;
+    df[3240] = df[3241];
+    df[3239] = df[3240];
+    df[3237] = df[3241];
+    df[3236] = df[3237];
+    df[3235] = df[3236];
+    df[3234] = t7847*t143;
+    const real t7864 = df[3234];
+    df[3233] = t7849+t7864;
+    df[3232] = df[3233];
+    df[3231] = t8105+t7864;
+    df[3230] = df[3231];
+    df[3229] = df[3232];
+    df[3228] = df[3229];
+    df[3227] = df[3228];
+    df[3226] = df[3227];
+    df[3225] = df[3230];
+    df[3224] = df[3231];
+    df[3222] = df[3224];
+    df[3221] = df[3222];
+    df[3220] = t8105+t8112+t7849+t7864;
+    df[3219] = df[3220];
+    df[3218] = df[3219];
+    df[3217] = df[3220];
+    df[3215] = t7847*t155;
+    const real t7868 = df[3215];
+    df[3214] = t7854+t7868;
+    df[3213] = df[3214];
+    df[3212] = t7857+t7852+t7856+t7868;
+    df[3211] = df[3212];
+    df[3210] = t7852+t7868;
+    df[3209] = df[3210];
+    df[3208] = t7847*t215;
+    const real t7869 = df[3208];
+    const real t8196 = df[3462];
+    df[3207] = t8196+t7869;
+    const real t7870 = df[3472];
+    df[3206] = t7870+t7869;
+    df[3205] = df[3206];
+    df[3203] = df[3206];
+    df[3202] = df[3203];
+    df[3201] = df[3202];
+    df[3200] = df[3201];
+    df[3199] = df[3200];
+    df[3198] = df[3199];
+    df[3197] = t7847*t212;
+    const real t7872 = df[3197];
+    df[3196] = t8196+t7872;
+    df[3195] = df[3196];
+    df[3194] = df[3196];
+    df[3193] = df[3194];
+    df[3192] = df[3193];
+    df[3191] = df[3192];
+    df[3190] = df[3191];
+    df[3189] = df[3190];
+    df[3188] = t7847*t475;
+    const real t7874 = df[3188];
+    df[3187] = t8195+t7874;
+    df[3186] = df[3187];
+    df[3185] = df[3186];
+    df[3184] = df[3185];
+    df[3183] = df[3184];
+    df[3182] = df[3183];
+    df[3181] = t8120+t7814+t8195+t7874;
+    df[3180] = t8120+t7874;
+    df[3179] = df[3180];
+    df[3177] = df[3181];
+    df[3176] = df[3180];
+    df[3175] = df[3176];
+    df[3174] = df[3175];
+    df[3173] = df[3174];
+    df[3172] = t8112+t7874;
+    df[3171] = df[3177];
+    df[3170] = df[3171];
+    df[3169] = df[3254];
+    df[3168] = df[3169];
+    df[3167] = df[3168];
+    df[3166] = df[3168];
+    df[3165] = df[3166];
+    const real t8200 = df[3165];
+    df[3164] = t8200*t136;
+    df[3162] = t8200*t132;
+    const real t7878 = df[3164];
+    const real t7879 = df[3162];
+    df[3161] = t7878+t7879;
+    df[3160] = df[3161];
+    df[3158] = t8200*t126;
+    const real t7881 = df[3158];
+    const real t7883 = t8200*t77;
+    df[3156] = t7881+t7883;
+    df[3155] = df[3156];
+    df[3154] = t7878+t7879+t7881+t7883;
+    df[3153] = df[3154];
+    df[3152] = t3116+t3120;
+    const real t8220 = df[3152];
+    df[3151] = t8220*t126;
+    df[3148] = t3120*t240;
+    df[3147] = df[3148];
+    const real t7885 = df[3147];
+    df[3146] = t8148+t7885;
+    df[3145] = df[3146];
+    df[3144] = df[3145];
+    df[3143] = df[3144];
+    df[3142] = df[3143];
+    df[3141] = df[3142];
+    df[3140] = t3120*t309;
+    const real t7886 = df[3140];
+    df[3139] = t7846+t7886;
+    df[3138] = df[3139];
+    df[3137] = t8145+t7886;
+    df[3136] = df[3137];
+    df[3135] = df[3138];
+    df[3134] = df[3138];
+    df[3133] = df[3134];
+    df[3132] = df[3133];
+    df[3131] = df[3136];
+    df[3129] = df[3137];
+    df[3128] = df[3129];
+    df[3127] = df[3128];
+    df[3126] = t8145+t8146+t7846+t7886;
+    df[3125] = df[3126];
+    df[3124] = df[3126];
+    df[3123] = df[3124];
+    df[3121] = t8220*t136;
+    df[3119] = t8220*t132;
+    const real t7891 = df[3121];
+    const real t7892 = df[3119];
+    df[3118] = t7891+t7892;
+    df[3117] = df[3118];
+    const real t7893 = df[3151];
+    const real t7895 = t8220*t77;
+    df[3115] = t7893+t7895;
+    df[3114] = df[3115];
+    df[3113] = t7893+t7891+t7892+t7895;
+    df[3112] = df[3113];
+    df[3105] = t3120*t143;
+    const real t7896 = df[3105];
+    df[3104] = t7885+t7896;
+    df[3103] = df[3104];
+    df[3102] = t8147+t7896;
+    df[3101] = df[3102];
+    df[3100] = df[3103];
+    df[3099] = df[3100];
+    df[3098] = df[3099];
+    df[3097] = df[3098];
+    df[3096] = df[3101];
+    df[3095] = df[3102];
+    df[3093] = df[3095];
+    df[3092] = df[3093];
+    df[3091] = t8147+t8148+t7885+t7896;
+    df[3090] = df[3091];
+    df[3089] = df[3090];
+    df[3088] = df[3089];
+    df[3087] = t3120*t215;
+    const real t7899 = df[3087];
+    const real t8254 = df[3436];
+    df[3086] = t8254+t7899;
+    const real t7900 = df[3329];
+    df[3085] = t7900+t7899;
+    df[3084] = df[3085];
+    df[3082] = df[3085];
+    df[3081] = df[3082];
+    df[3080] = df[3081];
+    df[3079] = df[3080];
+    df[3078] = df[3079];
+    df[3077] = df[3078];
+    df[3076] = t3120*t212;
+    const real t7902 = df[3076];
+    df[3075] = t8254+t7902;
+    df[3074] = df[3075];
+    df[3073] = df[3075];
+    df[3072] = df[3073];
+    df[3071] = df[3072];
+    df[3070] = df[3071];
+    df[3069] = df[3070];
+    df[3068] = df[3069];
+    df[3067] = t3120*t254;
+    const real t7904 = df[3067];
+    df[3066] = t7837+t7904;
+    df[3065] = df[3066];
+    df[3064] = df[3065];
+    df[3063] = df[3064];
+    df[3062] = df[3063];
+    df[3061] = df[3062];
+    df[3060] = t3120*t275;
+    const real t7905 = df[3060];
+    df[3059] = t7836+t7905;
+    df[3058] = t7904+t7905;
+    df[3057] = df[3058];
+    df[3056] = df[3057];
+    df[3055] = df[3056];
+    df[3054] = df[3059];
+    df[3053] = df[3054];
+    df[3052] = df[3053];
+    df[3051] = df[3052];
+    df[3050] = t7836+t7837+t7904+t7905;
+    df[3049] = df[3050];
+    df[3048] = df[3049];
+    df[3047] = df[3048];
+    df[3046] = t3120*t179;
+    const real t7906 = df[3338];
+    const real t7907 = df[3046];
+    df[3045] = t7906+t7907;
+    df[3044] = df[3045];
+    df[3043] = df[3044];
+    df[3042] = df[3043];
+    df[3041] = df[3042];
+    df[3040] = df[3041];
+    df[3039] = df[3040];
+    df[3038] = df[3039];
+    df[3037] = t3120*t155;
+    const real t7908 = df[3474];
+    const real t7909 = df[3037];
+    df[3036] = t7908+t7909;
+    df[3035] = df[3036];
+    const real t7910 = df[3476];
+    df[3034] = t7910+t7843+t7842+t7909;
+    df[3033] = df[3034];
+    df[3032] = t7910+t7909;
+    df[3031] = df[3032];
+    df[3030] = t3120*t146;
+    const real t7911 = df[3030];
+    df[3029] = t7910+t7911;
+    df[3028] = t7908+t7841+t7844+t7911;
+    df[3027] = df[3028];
+    df[3026] = t7908+t7911;
+    df[3025] = df[3026];
+    const real t7912 = t72+t73;
+    df[3024] = t7912*t73;
+    const real t7913 = t67+t73;
+    df[3023] = t7913*t73+t7798*t72;
+    const real t7917 = t72*t67;
+    df[3022] = t7798*t73+t7917;
+    df[3021] = t73*t67+t72*t50;
+    df[3020] = df[3021];
+    const real t7921 = t50+t72;
+    df[3019] = t7784*t73+t7921*t72;
+    df[3018] = t73*t50+t7917;
+    df[3017] = df[3018];
+    const real t7924 = t73*t37;
+    const real t7925 = t72*t37;
+    df[3016] = t7924+t7925;
+    df[3014] = t240*t275;
+    const real t7926 = df[3322];
+    const real t7927 = df[3014];
+    df[3013] = t7926+t7927;
+    df[3012] = df[3013];
+    df[3011] = df[3012];
+    df[3010] = df[3011];
+    df[3009] = t240*t215;
+    const real t8339 = df[3324];
+    const real t8345 = df[3009];
+    df[3008] = t8339+t8345;
+    df[3007] = df[3008];
+    df[3006] = df[3007];
+    df[3005] = df[3006];
+    df[3004] = df[3005];
+    df[3002] = t240*t139;
+    const real t7929 = df[3316];
+    const real t7930 = df[3002];
+    df[3001] = t7929+t7930;
+    df[3000] = t240*t309;
+    df[2999] = df[3000];
+    df[2998] = t240*t254;
+    const real t7931 = df[3321];
+    const real t7932 = df[2998];
+    df[2997] = t7931+t7932;
+    df[2996] = df[2997];
+    df[2995] = df[2996];
+    df[2994] = df[2995];
+    df[2993] = t240*t179;
+    const real t7933 = df[3320];
+    const real t7934 = df[2993];
+    df[2992] = t7933+t7934;
+    df[2991] = df[2992];
+    df[2990] = df[2991];
+    df[2989] = df[2990];
+    df[2988] = t240*t146;
+    const real t7935 = df[3318];
+    const real t7936 = df[2988];
+    df[2987] = t7935+t7936;
+    df[2986] = df[2987];
+    df[2985] = t240*t212;
+    const real t7937 = df[3323];
+    const real t7938 = df[2985];
+    df[2984] = t7937+t7938;
+    df[2983] = df[2984];
+    df[2982] = df[2983];
+    df[2981] = df[2982];
+    df[2980] = df[2981];
+    df[2978] = t240*t143;
+    df[2977] = df[2978];
+    df[2976] = t240*t145;
+    const real t7939 = df[3317];
+    const real t7940 = df[2976];
+    df[2975] = t7939+t7940;
+    df[2974] = t240*t240;
+    const real t7941 = df[2974];
+    const real t8354 = df[3326];
+    df[2973] = t8354+t7941;
+    df[2972] = df[2973];
+    df[2971] = df[2972];
+    df[2970] = df[2971];
+    df[2969] = df[2970];
+    df[2968] = df[2969];
+    const real t8358 = df[2999];
+    df[2967] = t8358+t7941;
+    df[2965] = t240*t155;
+    const real t7942 = df[3319];
+    const real t7943 = df[2965];
+    df[2964] = t7942+t7943;
+    df[2963] = df[2964];
+    df[2961] = t146*t146;
+    df[2960] = t146*t145;
+    const real t7944 = df[2961];
+    const real t7945 = df[2960];
+    df[2959] = t7944+t7945;
+    df[2958] = t146*t139;
+    const real t7946 = df[2958];
+    df[2957] = t7944+t7946;
+    df[2956] = (t26+t37)*t37;
+    df[2955] = (t20+t37)*t37;
+    df[2954] = (t5+t37)*t37;
+    df[2952] = t145*t145;
+    df[2951] = t145*t139;
+    const real t7950 = df[2952];
+    const real t7951 = df[2951];
+    df[2950] = t7950+t7951;
+    df[2948] = t2404*t155;
+    df[2947] = t2404*t2404;
+    const real t7952 = df[2947];
+    df[2946] = t7952*t143;
+    const real t8403 = df[2946];
+    df[2945] = t7864+t8403;
+    df[2943] = t7952*t215;
+    df[2942] = df[2943];
+    df[2941] = t7952*t254;
+    df[2940] = t7952*t275;
+    df[2939] = t7952*t155;
+    df[2938] = t7952*t309;
+    const real t7954 = df[2938];
+    df[2937] = t8105+t7954;
+    df[2936] = t7849+t7954;
+    df[2935] = t8403+t7954;
+    df[2934] = df[2935];
+    df[2933] = df[2934];
+    df[2931] = df[2935];
+    df[2930] = df[2931];
+    df[2929] = df[2930];
+    df[2928] = t7952*t475;
+    const real t8406 = df[2928];
+    df[2927] = t7874+t8406;
+    df[2925] = t7952*t240;
+    const real t8412 = df[2925];
+    df[2924] = t8406+t8412;
+    df[2923] = df[2924];
+    df[2922] = df[2923];
+    df[2921] = df[2922];
+    df[2920] = df[2921];
+    df[2919] = df[2920];
+    df[2917] = t8120+t8412;
+    df[2916] = t7952*t145;
+    df[2915] = t7952*t139;
+    df[2913] = t7952*t136;
+    df[2912] = t7952*t146;
+    const real t7961 = df[2939];
+    const real t7962 = df[2916];
+    const real t7963 = df[2915];
+    const real t7964 = df[2912];
+    df[2911] = t7857+t7852+t7856+t7868+t7961+t7962+t7963+t7964;
+    df[2910] = t7854+t7855+t7853+t7858+t7961+t7962+t7963+t7964;
+    df[2909] = df[2911];
+    df[2908] = df[2910];
+    df[2907] = t7952*t212;
+    const real t7965 = df[2907];
+    const real t8415 = df[2942];
+    df[2906] = t7870+t7869+t8415+t7965;
+    df[2905] = t8196+t7872+t8415+t7965;
+    df[2904] = t8415+t7965;
+    df[2903] = df[2904];
+    df[2902] = df[2904];
+    df[2901] = df[2902];
+    df[2900] = t7952*t132;
+    df[2899] = t7952*t179;
+    df[2898] = t7952*t126;
+    df[2897] = t2404*t212;
+    df[2896] = t2404*t146;
+    df[2895] = t2404*t3116;
+    const real t7967 = df[2895];
+    df[2894] = t7967*t240;
+    df[2893] = df[2894];
+    df[2892] = t7967*t309;
+    df[2891] = df[2892];
+    df[2890] = t7967*t254;
+    df[2889] = t7967*t215;
+    df[2888] = df[2889];
+    df[2887] = t7967*t146;
+    df[2886] = t7967*t145;
+    df[2885] = t7967*t139;
+    df[2883] = t7967*t275;
+    df[2882] = t7967*t143;
+    df[2881] = df[2882];
+    df[2880] = t7967*t179;
+    df[2879] = t7967*t155;
+    df[2878] = t7967*t475;
+    df[2877] = df[2878];
+    df[2876] = t7967*t212;
+    df[2875] = t2404*t143;
+    const real t8427 = df[2875];
+    df[2874] = t7896+t8427;
+    df[2872] = t2404*t136;
+    df[2871] = t2404*t240;
+    df[2870] = df[2871];
+    const real t7970 = df[2870];
+    df[2869] = t8146+t7970;
+    df[2868] = t2404*t215;
+    const real t7971 = df[2897];
+    const real t7972 = df[2868];
+    df[2867] = t7900+t7899+t7971+t7972;
+    df[2866] = t8254+t7902+t7971+t7972;
+    df[2865] = t7971+t7972;
+    df[2864] = df[2865];
+    df[2862] = df[2865];
+    df[2861] = df[2862];
+    df[2859] = t2404*t475;
+    const real t8430 = df[2859];
+    df[2858] = t7970+t8430;
+    df[2856] = df[2858];
+    df[2855] = df[2856];
+    df[2854] = df[2855];
+    df[2853] = df[2854];
+    df[2852] = df[2853];
+    df[2851] = t7846+t8430;
+    df[2850] = t2404*t126;
+    df[2849] = t2404*t139;
+    df[2848] = t2404*t275;
+    df[2847] = t2404*t179;
+    df[2846] = t2404*t3120;
+    const real t7976 = df[2846];
+    df[2845] = t7976*t215;
+    const real t7977 = df[2876];
+    const real t8437 = df[2845];
+    df[2844] = t7977+t8437;
+    df[2843] = df[2844];
+    df[2842] = df[2843];
+    df[2840] = df[2844];
+    df[2839] = df[2840];
+    df[2838] = t7976*t254;
+    const real t7980 = df[2890];
+    const real t7981 = df[2838];
+    df[2837] = t7980+t7981;
+    df[2836] = df[2837];
+    df[2835] = df[2836];
+    df[2834] = df[2835];
+    df[2833] = df[2834];
+    df[2832] = t7976*t145;
+    df[2831] = t7976*t139;
+    df[2830] = t7976*t275;
+    const real t7982 = df[2883];
+    const real t7983 = df[2830];
+    df[2829] = t7982+t7983;
+    df[2828] = df[2829];
+    df[2827] = df[2828];
+    df[2826] = df[2827];
+    df[2825] = df[2826];
+    df[2824] = t7976*t475;
+    const real t7984 = df[2824];
+    const real t8443 = df[2893];
+    df[2823] = t8443+t7984;
+    df[2822] = df[2823];
+    df[2821] = df[2822];
+    df[2820] = df[2821];
+    const real t8444 = df[2877];
+    df[2818] = t8444+t7984;
+    df[2817] = df[2822];
+    df[2816] = df[2817];
+    df[2815] = t7976*t155;
+    const real t7987 = df[2887];
+    const real t7988 = df[2885];
+    const real t7989 = df[2832];
+    const real t7990 = df[2815];
+    df[2814] = t7987+t7988+t7989+t7990;
+    df[2813] = df[2814];
+    df[2811] = t7976*t143;
+    const real t7992 = df[2811];
+    const real t8445 = df[2891];
+    df[2810] = t8445+t7992;
+    df[2809] = df[2810];
+    df[2808] = df[2809];
+    df[2807] = df[2810];
+    df[2805] = df[2807];
+    df[2804] = df[2805];
+    df[2803] = t7976*t146;
+    const real t7995 = df[2886];
+    const real t7996 = df[2879];
+    const real t7997 = df[2831];
+    const real t7998 = df[2803];
+    df[2802] = t7995+t7996+t7997+t7998;
+    df[2801] = df[2802];
+    df[2800] = t7976*t309;
+    const real t8507 = df[2881];
+    const real t8508 = df[2800];
+    df[2799] = t8507+t8508;
+    df[2798] = df[2799];
+    df[2797] = df[2798];
+    df[2795] = df[2799];
+    df[2794] = df[2795];
+    df[2793] = df[2794];
+    df[2792] = t7976*t212;
+    const real t8002 = df[2792];
+    const real t8525 = df[2888];
+    df[2791] = t8525+t8002;
+    df[2790] = df[2791];
+    df[2789] = df[2790];
+    df[2788] = df[2791];
+    df[2787] = df[2788];
+    df[2786] = t7967+t7976;
+    const real t8526 = df[2786];
+    df[2785] = t8526*t126;
+    df[2783] = t8526*t132;
+    df[2781] = t7976*t240;
+    df[2780] = df[2781];
+    const real t8007 = df[2780];
+    df[2779] = t8444+t8007;
+    df[2778] = df[2779];
+    df[2777] = df[2778];
+    df[2776] = df[2777];
+    df[2775] = df[2776];
+    df[2774] = df[2775];
+    df[2773] = t7976*t179;
+    const real t8008 = df[2880];
+    const real t8009 = df[2773];
+    df[2772] = t8008+t8009;
+    df[2771] = df[2772];
+    df[2770] = df[2771];
+    df[2769] = df[2770];
+    df[2767] = t8526*t136;
+    df[2766] = t2404*t145;
+    const real t8011 = df[2948];
+    const real t8012 = df[2896];
+    const real t8013 = df[2849];
+    const real t8014 = df[2766];
+    df[2765] = t7910+t7843+t7842+t7909+t8011+t8012+t8013+t8014;
+    df[2764] = t7908+t7841+t7844+t7911+t8011+t8012+t8013+t8014;
+    df[2763] = df[2765];
+    df[2762] = df[2764];
+    df[2761] = t2404*t132;
+    df[2760] = t2404*t254;
+    df[2759] = t2404*t309;
+    const real t8015 = df[2759];
+    df[2758] = t8147+t8015;
+    df[2757] = t7885+t8015;
+    df[2756] = t8427+t8015;
+    df[2755] = df[2756];
+    df[2754] = df[2755];
+    df[2752] = df[2756];
+    df[2751] = df[2752];
+    df[2750] = df[2751];
+    df[2748] = t139*t139;
+    const real t8018 = df[2748];
+    df[2747] = t7950+t8018;
+    df[2746] = df[2747];
+    df[2745] = t145+t139;
+    const real t8534 = df[2745];
+    df[2744] = t8534*t136;
+    df[2742] = t8534*t132;
+    const real t8021 = df[2744];
+    const real t8022 = df[2742];
+    df[2741] = t8021+t8022;
+    df[2740] = df[2741];
+    df[2738] = t8534*t126;
+    const real t8024 = df[2738];
+    const real t8026 = t8534*t77;
+    df[2736] = t8021+t8022+t8024+t8026;
+    df[2735] = df[2736];
+    df[2734] = t8024+t8026;
+    df[2733] = df[2734];
+    df[2724] = t132*t132;
+    df[2723] = t132*t126;
+    const real t8027 = df[2724];
+    const real t8028 = df[2723];
+    df[2722] = t8027+t8028;
+    const real t8029 = t132*t77;
+    df[2721] = t8029+t8027;
+    const real t8030 = t50*t50;
+    const real t8031 = t72*t72;
+    df[2720] = t8030+t8031;
+    const real t8032 = t73*t73;
+    df[2719] = t8030+t8032;
+    df[2718] = df[2719];
+    df[2717] = df[2720];
+    const real t8033 = t50*t37;
+    df[2716] = t8033+t7925;
+    const real t8034 = t50*t26;
+    const real t8035 = t73*t26;
+    df[2715] = t8034+t8035;
+    const real t8036 = t50*t20;
+    const real t8037 = t73*t20;
+    df[2714] = t8036+t8037;
+    const real t8038 = t72*t26;
+    df[2713] = t8036+t8038;
+    df[2709] = t126*t126;
+    const real t8039 = t77*t77;
+    const real t8040 = df[2709];
+    df[2708] = t8039+t8040;
+    df[2707] = df[2708];
+    df[2706] = t8039+t7950+t8018+t8040;
+    df[2705] = df[2706];
+    const real t8041 = t126*t77;
+    df[2704] = t8041+t8040;
+    df[2703] = t7951+t8041;
+    df[2702] = df[2703];
+    df[2701] = t77+t126;
+    const real t8042 = t8534*t67;
+    const real t8545 = df[2701];
+    const real t8044 = t8545*t73;
+    df[2700] = t8042+t8044;
+    df[2699] = df[2700];
+    const real t8045 = t8534*t50;
+    const real t8047 = t8545*t72;
+    df[2697] = t8045+t8047;
+    df[2696] = df[2697];
+    const real t8048 = t8534*t73;
+    const real t8050 = t8545*t67;
+    df[2694] = t8048+t8050;
+    df[2693] = df[2694];
+    const real t8051 = t8534*t72;
+    const real t8053 = t8545*t50;
+    df[2691] = t8051+t8053;
+    df[2690] = df[2691];
+    const real t8054 = t8534*t37;
+    const real t8056 = t8545*t37;
+    df[2688] = t8054+t8056;
+    const real t8058 = t8534*t20;
+    const real t8060 = t8545*t26;
+    df[2686] = t8058+t8060;
+    df[2684] = t77+t145+t139+t126;
+    df[2682] = t254*t254;
+    df[2681] = t254*t275;
+    const real t8061 = df[2682];
+    const real t8062 = df[2681];
+    df[2680] = t8061+t8062;
+    df[2679] = t254*t179;
+    df[2678] = t254*t155;
+    df[2677] = t254*t146;
+    df[2676] = t254*t145;
+    df[2675] = t254*t139;
+    df[2674] = t254*t136;
+    df[2673] = t254*t132;
+    df[2672] = t254*t126;
+    df[2670] = t4135*t139;
+    const real t8063 = t7493*t20;
+    const real t8064 = t4135*t20;
+    df[2669] = t8063+t8064;
+    const real t8065 = t7493*t26;
+    df[2668] = t8065+t8064;
+    df[2667] = t4135*t212;
+    df[2666] = t4135*t2341;
+    const real t8066 = df[2666];
+    df[2665] = t8066*t155;
+    df[2664] = t8066*t475;
+    df[2663] = df[2664];
+    const real t8067 = df[2663];
+    df[2662] = t7953+t8067;
+    df[2661] = t8066*t132;
+    df[2660] = t8066*t139;
+    df[2659] = t8066*t146;
+    df[2658] = t8066*t179;
+    df[2657] = t8066*t136;
+    df[2656] = t8066*t309;
+    const real t8068 = df[2656];
+    df[2655] = t7687+t8068;
+    df[2654] = t7949+t8068;
+    df[2652] = t8066*t240;
+    const real t8069 = df[2652];
+    df[2651] = t8067+t8069;
+    df[2650] = df[2651];
+    df[2649] = df[2650];
+    df[2648] = t7957+t8069;
+    df[2647] = df[2649];
+    df[2646] = df[2647];
+    df[2645] = df[2650];
+    df[2643] = t8066*t126;
+    df[2641] = t8066*t275;
+    df[2640] = t8066*t215;
+    df[2639] = df[2640];
+    df[2638] = t8066*t212;
+    const real t8071 = df[2638];
+    const real t8571 = df[2639];
+    df[2637] = t7974+t7690+t8571+t8071;
+    df[2636] = t7694+t7693+t8571+t8071;
+    df[2635] = t8571+t8071;
+    df[2634] = df[2635];
+    df[2633] = df[2635];
+    df[2632] = df[2633];
+    df[2631] = t8066*t254;
+    df[2630] = t8066*t143;
+    const real t8073 = df[2630];
+    df[2629] = t7948+t8073;
+    df[2628] = t8068+t8073;
+    df[2627] = df[2628];
+    df[2626] = df[2627];
+    df[2625] = df[2628];
+    df[2623] = df[2625];
+    df[2622] = df[2623];
+    df[2621] = t8066*t145;
+    const real t8076 = df[2665];
+    const real t8077 = df[2660];
+    const real t8078 = df[2659];
+    const real t8079 = df[2621];
+    df[2620] = t7666+t7677+t7675+t7699+t8076+t8077+t8078+t8079;
+    df[2619] = t7669+t7673+t7667+t7692+t8076+t8077+t8078+t8079;
+    df[2618] = df[2620];
+    df[2617] = df[2619];
+    df[2616] = t4135*t254;
+    df[2615] = t4135*t126;
+    df[2614] = t7493*t37+t4135*t37;
+    df[2613] = df[2614];
+    df[2612] = t4135*t309;
+    const real t8082 = df[2612];
+    df[2611] = t8025+t8082;
+    df[2610] = t7774+t8082;
+    df[2608] = t4135*t155;
+    const real t8083 = t4135*t77;
+    const real t8084 = df[2615];
+    df[2607] = t8083+t8084;
+    df[2606] = df[2607];
+    df[2605] = t7805+t7806+t8083+t8084;
+    df[2604] = t7766+t7767+t8083+t8084;
+    df[2603] = df[2604];
+    df[2602] = df[2605];
+    df[2601] = t4135*t132;
+    const real t8085 = t4135*t26;
+    df[2600] = t8065+t8085;
+    df[2599] = t8063+t8085;
+    df[2598] = df[2600];
+    df[2597] = t4135*t3120;
+    const real t8086 = df[2597];
+    df[2596] = t8086*t215;
+    df[2595] = df[2596];
+    df[2594] = t8086*t146;
+    df[2593] = t8086*t143;
+    const real t8579 = df[2593];
+    df[2592] = t8004+t8579;
+    df[2590] = t8086*t254;
+    df[2589] = t8086*t240;
+    const real t8088 = df[2589];
+    df[2588] = t8579+t8088;
+    df[2587] = df[2588];
+    df[2586] = df[2587];
+    df[2585] = df[2586];
+    df[2584] = df[2585];
+    df[2583] = df[2584];
+    df[2582] = t7731+t8088;
+    df[2581] = t7922+t8088;
+    df[2579] = t8086*t475;
+    const real t8583 = df[2579];
+    df[2578] = t7999+t8583;
+    df[2576] = t8086*t212;
+    df[2574] = t8086*t145;
+    df[2573] = t8086*t179;
+    df[2572] = t8086*t139;
+    df[2571] = t8086*t309;
+    const real t8091 = df[2571];
+    df[2570] = t7928+t8091;
+    df[2569] = t8583+t8091;
+    df[2568] = df[2569];
+    df[2567] = df[2568];
+    df[2566] = df[2567];
+    df[2565] = df[2566];
+    df[2564] = df[2565];
+    df[2562] = t8086*t275;
+    const real t8093 = df[2590];
+    const real t8094 = df[2562];
+    df[2561] = t8093+t8094;
+    df[2560] = df[2561];
+    df[2559] = df[2560];
+    df[2558] = df[2559];
+    df[2557] = t8086*t155;
+    df[2556] = t4135*t3116;
+    const real t8095 = df[2556];
+    df[2555] = t8095*t275;
+    const real t8096 = df[2555];
+    df[2554] = t8094+t8096;
+    df[2553] = df[2554];
+    df[2552] = df[2553];
+    df[2551] = df[2552];
+    df[2550] = df[2551];
+    df[2549] = t8095*t146;
+    const real t8097 = df[2594];
+    const real t8098 = df[2549];
+    df[2548] = t8097+t8098;
+    const real t8099 = df[2557];
+    df[2547] = t8099+t8098;
+    df[2546] = df[2547];
+    df[2545] = t7726+t7725+t8099+t8098;
+    df[2544] = t7736+t7735+t8099+t8098;
+    df[2543] = df[2544];
+    df[2542] = df[2545];
+    df[2541] = t8095*t254;
+    const real t8100 = df[2541];
+    df[2540] = t8093+t8100;
+    df[2539] = df[2540];
+    df[2538] = t7947+t7637+t7709+t7716+t8093+t8094+t8096+t8100;
+    df[2537] = t8096+t8100;
+    df[2536] = df[2537];
+    df[2535] = df[2536];
+    df[2534] = df[2535];
+    df[2533] = df[2539];
+    df[2532] = df[2533];
+    df[2531] = df[2532];
+    df[2530] = df[2531];
+    df[2529] = t8093+t8094+t8096+t8100;
+    df[2528] = df[2529];
+    df[2527] = df[2528];
+    df[2526] = df[2527];
+    df[2525] = df[2538];
+    df[2524] = df[2525];
+    df[2523] = df[2524];
+    df[2522] = df[2523];
+    df[2521] = t8095*t179;
+    const real t8101 = df[2573];
+    const real t8102 = df[2521];
+    df[2520] = t7710+t7711+t8101+t8102;
+    df[2519] = t8101+t8102;
+    df[2518] = df[2519];
+    df[2517] = df[2518];
+    df[2516] = df[2517];
+    df[2515] = df[2516];
+    df[2514] = df[2515];
+    df[2513] = df[2514];
+    df[2512] = df[2513];
+    df[2511] = df[2520];
+    df[2510] = df[2511];
+    df[2509] = df[2510];
+    df[2508] = df[2509];
+    df[2507] = t8086+t8095;
+    const real t8103 = df[3799];
+    const real t8104 = t8103*t20;
+    const real t8585 = df[2507];
+    const real t8106 = t8585*t20;
+    df[2506] = t8104+t8106;
+    const real t8107 = df[3857];
+    const real t8108 = t8107*t26;
+    df[2505] = t8108+t8106;
+    df[2504] = t8095*t139;
+    const real t8109 = df[2574];
+    const real t8110 = df[2504];
+    df[2503] = t7713+t7715+t7723+t7738+t8109+t8099+t8098+t8110;
+    df[2502] = t7714+t7722+t7712+t7737+t8109+t8099+t8098+t8110;
+    df[2501] = df[2503];
+    df[2500] = df[2502];
+    df[2499] = t8109+t8099+t8098+t8110;
+    df[2498] = df[2499];
+    df[2497] = t8109+t8110;
+    df[2496] = df[2497];
+    df[2495] = t7736+t7735+t8109+t8110;
+    df[2494] = t7726+t7725+t8109+t8110;
+    df[2493] = df[2494];
+    df[2492] = df[2495];
+    const real t8111 = t8107*t67;
+    const real t8113 = t8585*t73;
+    df[2490] = t8111+t8113;
+    const real t8114 = t8103*t50;
+    df[2489] = t8114+t8113;
+    df[2488] = df[2490];
+    df[2487] = df[2489];
+    df[2486] = t8095*t155;
+    const real t8115 = df[2486];
+    df[2485] = t8099+t8115;
+    df[2484] = df[2485];
+    df[2483] = t8097+t8115;
+    df[2482] = df[2483];
+    df[2481] = t7724+t7734+t8097+t8115;
+    df[2480] = t7704+t7706+t8097+t8115;
+    df[2479] = df[2480];
+    df[2478] = df[2481];
+    df[2477] = t8095*t145;
+    const real t8116 = df[2477];
+    df[2476] = t8109+t8116;
+    const real t8117 = df[2572];
+    df[2475] = t7714+t7722+t7712+t7737+t8097+t8117+t8115+t8116;
+    df[2474] = t7713+t7715+t7723+t7738+t8097+t8117+t8115+t8116;
+    df[2473] = df[2475];
+    df[2472] = df[2474];
+    df[2471] = t8097+t8117+t8115+t8116;
+    df[2470] = df[2471];
+    df[2469] = t8117+t8116;
+    df[2468] = df[2469];
+    df[2467] = t7704+t7706+t8117+t8116;
+    df[2466] = t7724+t7734+t8117+t8116;
+    df[2465] = df[2466];
+    df[2464] = df[2467];
+    df[2463] = t8095*t240;
+    const real t8118 = df[2463];
+    df[2462] = t7928+t8118;
+    df[2461] = t7922+t7728+t8088+t8118;
+    df[2460] = t8583+t8118;
+    df[2459] = t7728+t8118;
+    df[2458] = df[2460];
+    df[2457] = df[2458];
+    df[2455] = df[2460];
+    df[2454] = df[2455];
+    df[2453] = df[2454];
+    df[2451] = t8585*t126;
+    df[2450] = t8095*t309;
+    const real t8121 = df[2450];
+    df[2449] = t7731+t8121;
+    df[2448] = t7922+t7728+t8091+t8121;
+    df[2447] = t8579+t8121;
+    df[2446] = df[2447];
+    df[2445] = df[2446];
+    df[2443] = df[2447];
+    df[2442] = df[2443];
+    df[2441] = df[2442];
+    const real t8124 = df[2451];
+    const real t8126 = t8585*t77;
+    df[2439] = t8124+t8126;
+    df[2438] = df[2439];
+    df[2437] = t7722+t7737+t7723+t7738+t8124+t8126;
+    df[2436] = t7714+t7712+t7713+t7715+t8124+t8126;
+    df[2435] = df[2436];
+    df[2434] = df[2437];
+    df[2432] = df[2507];
+    const real t8611 = df[2432];
+    df[2431] = t8611*t132;
+    const real t8129 = df[3800]*t73;
+    const real t8130 = df[3799]*t72;
+    const real t8132 = t8611*t72;
+    df[2429] = t8129+t8130+t8113+t8132;
+    df[2428] = df[2429];
+    df[2427] = t8114+t8132;
+    df[2426] = t8111+t8132;
+    df[2425] = df[2427];
+    df[2424] = df[2426];
+    df[2423] = t8611;
+    const real t8612 = df[2423];
+    const real t8134 = t8612*t26;
+    df[2422] = t8108+t8134;
+    df[2421] = t8104+t8134;
+    df[2420] = df[2422];
+    df[2419] = t8095*t215;
+    const real t8135 = df[2419];
+    const real t8613 = df[2595];
+    df[2418] = t8613+t8135;
+    const real t8136 = df[2576];
+    df[2417] = t7947+t7637+t8136+t8135;
+    df[2416] = t7709+t7716+t8136+t8135;
+    df[2415] = t7718+t7730+t8136+t8135;
+    df[2414] = t8136+t8135;
+    df[2413] = df[2414];
+    df[2411] = df[2414];
+    df[2410] = df[2411];
+    df[2409] = df[2410];
+    df[2408] = df[2409];
+    df[2407] = df[2408];
+    df[2406] = df[2407];
+    df[2405] = df[2415];
+    df[2404] = df[2405];
+    df[2403] = df[2404];
+    df[2402] = df[2403];
+    df[2401] = t8095*t212;
+    const real t8138 = df[2401];
+    df[2400] = t7709+t7716+t8613+t8138;
+    df[2399] = t7947+t7637+t8613+t8138;
+    df[2398] = t7720+t7719+t8613+t8138;
+    df[2397] = t8613+t8138;
+    df[2396] = df[2397];
+    df[2395] = df[2397];
+    df[2394] = df[2395];
+    df[2393] = df[2394];
+    df[2392] = df[2393];
+    df[2391] = df[2392];
+    df[2390] = df[2391];
+    df[2389] = df[2398];
+    df[2388] = df[2389];
+    df[2387] = df[2388];
+    df[2386] = df[2387];
+    const real t8141 = t8612*t67;
+    df[2384] = t8129+t8141;
+    df[2383] = t8130+t8141;
+    df[2382] = df[2383];
+    df[2381] = df[2384];
+    df[2380] = t8095*t143;
+    const real t8142 = df[2380];
+    df[2379] = t7923+t8142;
+    df[2378] = t8118+t8142;
+    df[2377] = df[2378];
+    df[2376] = t8091+t8142;
+    df[2375] = df[2376];
+    df[2374] = t7923+t7928+t7999+t7728+t8583+t8091+t8118+t8142;
+    df[2373] = df[2377];
+    df[2372] = df[2373];
+    df[2371] = df[2372];
+    df[2370] = df[2377];
+    df[2369] = df[2375];
+    df[2368] = df[2376];
+    df[2366] = df[2368];
+    df[2365] = df[2366];
+    df[2364] = t8583+t8091+t8118+t8142;
+    df[2363] = df[2364];
+    df[2362] = df[2363];
+    df[2361] = df[2364];
+    df[2360] = df[2374];
+    df[2359] = df[2360];
+    df[2358] = df[2359];
+    df[2357] = df[2359];
+    df[2355] = t8103*t37+t8612*t37;
+    df[2354] = df[2355];
+    const real t8149 = t8612*t50;
+    df[2352] = t8130+t8149;
+    df[2351] = t8129+t8149;
+    df[2350] = df[2351];
+    df[2349] = df[2352];
+    df[2348] = t7615+t7705+t8086+t8095;
+    df[2346] = t8612*t136;
+    const real t8151 = df[2431];
+    const real t8152 = df[2346];
+    df[2345] = t8151+t8152;
+    df[2344] = df[2345];
+    df[2343] = t8124+t8126+t8151+t8152;
+    df[2342] = df[2343];
+    df[2341] = t7714+t7712+t7713+t7715+t8151+t8152;
+    df[2340] = t7722+t7737+t7723+t7738+t8151+t8152;
+    df[2339] = df[2340];
+    df[2338] = df[2341];
+    df[2337] = t8095*t475;
+    const real t8153 = df[2337];
+    df[2336] = t8121+t8153;
+    df[2335] = t8088+t8153;
+    df[2334] = df[2336];
+    df[2333] = t8579+t8088+t8121+t8153;
+    df[2332] = df[2335];
+    df[2331] = t7922+t7616+t8004+t7731+t8579+t8088+t8121+t8153;
+    df[2330] = df[2331];
+    df[2329] = df[2334];
+    df[2328] = df[2335];
+    df[2327] = df[2330];
+    df[2326] = df[2329];
+    df[2325] = t7616+t7999+t8583+t8153;
+    df[2323] = df[2328];
+    df[2322] = df[2333];
+    df[2321] = t7616+t8153;
+    df[2320] = df[2336];
+    df[2319] = df[2320];
+    df[2318] = df[2330];
+    df[2317] = df[2323];
+    df[2316] = df[2322];
+    df[2315] = t8583+t8153;
+    df[2314] = df[2317];
+    df[2313] = df[2318];
+    df[2312] = df[2316];
+    df[2311] = t7493+t4135;
+    df[2309] = t4135*t146;
+    const real t8156 = df[2608];
+    const real t8157 = df[2309];
+    df[2308] = t8156+t8157;
+    df[2307] = df[2308];
+    df[2306] = t7772+t7773+t8156+t8157;
+    df[2305] = t7768+t7769+t8156+t8157;
+    df[2304] = df[2305];
+    df[2303] = df[2306];
+    df[2302] = t4135*t179;
+    const real t8158 = df[3913];
+    const real t8159 = df[2302];
+    df[2301] = t8158+t8159;
+    df[2300] = df[2301];
+    df[2299] = df[2300];
+    df[2298] = df[2299];
+    df[2297] = df[2298];
+    df[2296] = t4135*t4135;
+    const real t8160 = df[2296];
+    df[2295] = t7739+t8160;
+    df[2294] = t8160*t139;
+    df[2293] = t8160*t309;
+    const real t8161 = df[2293];
+    df[2292] = t8019+t8161;
+    df[2291] = t7757+t8161;
+    df[2289] = t8160*t126;
+    const real t8162 = t8160*t77;
+    const real t8163 = df[2289];
+    df[2288] = t8162+t8163;
+    df[2287] = df[2288];
+    df[2286] = t7743+t7744+t8162+t8163;
+    df[2285] = t7753+t7754+t8162+t8163;
+    df[2284] = df[2286];
+    df[2283] = df[2285];
+    df[2282] = t8160*t240;
+    const real t8164 = df[2282];
+    df[2281] = t7757+t8164;
+    df[2280] = t8019+t8164;
+    df[2279] = df[2281];
+    df[2277] = t8160*t132;
+    df[2276] = t8160*t155;
+    df[2275] = t8160*t143;
+    const real t8165 = df[2275];
+    df[2274] = t7746+t8165;
+    df[2273] = t8164+t8165;
+    df[2272] = df[2273];
+    df[2271] = t8161+t8165;
+    df[2270] = df[2271];
+    df[2269] = df[2272];
+    df[2268] = df[2269];
+    df[2267] = df[2268];
+    df[2266] = df[2267];
+    df[2265] = df[2270];
+    df[2264] = df[2271];
+    df[2262] = df[2264];
+    df[2261] = df[2262];
+    df[2260] = t8160*t145;
+    const real t8168 = df[2294];
+    const real t8169 = df[2260];
+    df[2259] = t8168+t8169;
+    df[2258] = df[2259];
+    df[2257] = t7749+t7750+t8168+t8169;
+    df[2256] = t7740+t7741+t8168+t8169;
+    df[2255] = df[2256];
+    df[2254] = df[2257];
+    df[2253] = t8160*t146;
+    const real t8170 = df[2276];
+    const real t8171 = df[2253];
+    df[2252] = t7753+t7743+t7744+t7754+t8168+t8170+t8169+t8171;
+    df[2251] = df[2252];
+    df[2250] = df[2251];
+    df[2249] = df[2250];
+    df[2248] = t8168+t8170+t8169+t8171;
+    df[2247] = df[2248];
+    df[2246] = t8170+t8171;
+    df[2245] = df[2246];
+    df[2244] = t7740+t7741+t8170+t8171;
+    df[2243] = t7749+t7750+t8170+t8171;
+    df[2242] = df[2243];
+    df[2241] = df[2244];
+    df[2240] = t8160*t475;
+    const real t8172 = df[2240];
+    df[2239] = t8161+t8172;
+    df[2238] = df[2239];
+    df[2237] = df[2238];
+    df[2236] = df[2237];
+    df[2235] = df[2236];
+    df[2234] = df[2235];
+    df[2233] = t8019+t7742+t7746+t7757+t8161+t8164+t8165+t8172;
+    df[2232] = t8164+t8172;
+    df[2231] = df[2232];
+    df[2230] = t8161+t8164+t8165+t8172;
+    df[2229] = df[2230];
+    df[2228] = df[2229];
+    df[2227] = df[2233];
+    df[2225] = df[2227];
+    df[2224] = df[2225];
+    df[2223] = df[2229];
+    df[2222] = df[2232];
+    df[2221] = df[2222];
+    df[2220] = df[2224];
+    df[2219] = t7742+t8172;
+    df[2218] = df[2221];
+    df[2217] = df[2218];
+    df[2216] = df[2219];
+    df[2215] = t8160*t254;
+    df[2213] = t8160*t179;
+    const real t8176 = df[3724];
+    const real t8177 = df[2213];
+    df[2212] = t8176+t8177;
+    df[2211] = df[2212];
+    df[2210] = df[2211];
+    df[2209] = df[2210];
+    df[2208] = df[2209];
+    df[2207] = t8160*t275;
+    const real t8178 = df[2215];
+    const real t8179 = df[2207];
+    df[2206] = t8020+t7755+t8178+t8179;
+    df[2205] = t8178+t8179;
+    df[2204] = df[2205];
+    df[2203] = df[2204];
+    df[2202] = df[2203];
+    df[2201] = df[2202];
+    df[2200] = df[2201];
+    df[2199] = df[2200];
+    df[2198] = df[2199];
+    df[2197] = df[2206];
+    df[2196] = df[2197];
+    df[2195] = df[2196];
+    df[2194] = df[2195];
+    const real t8180 = t7739*t73;
+    const real t8181 = t8160*t67;
+    df[2193] = t8180+t8181;
+    const real t8182 = t7739*t72;
+    df[2192] = t8182+t8181;
+    df[2191] = df[2192];
+    df[2190] = df[2193];
+    const real t8183 = t7739*t50;
+    const real t8184 = t8160*t72;
+    df[2189] = t8183+t8184;
+    const real t8185 = t7739*t67;
+    df[2188] = t8185+t8184;
+    df[2187] = df[2188];
+    df[2186] = df[2189];
+    const real t8186 = t7739*t26;
+    const real t8187 = t8160*t26;
+    df[2185] = t8186+t8187;
+    df[2184] = df[2185];
+    const real t8188 = t7739*t20;
+    df[2183] = t8188+t8187;
+    const real t8189 = t8160*t20;
+    df[2182] = t8188+t8189;
+    df[2181] = t8186+t8189;
+    df[2180] = t8160*t212;
+    df[2179] = t8182+t8180+t8160*t7912;
+    df[2178] = df[2179];
+    const real t8191 = t8160*t73;
+    df[2177] = t8185+t8191;
+    df[2176] = t8183+t8191;
+    df[2175] = df[2177];
+    df[2174] = df[2176];
+    df[2173] = t8160*t136;
+    const real t8192 = df[2277];
+    const real t8193 = df[2173];
+    df[2172] = t8192+t8193;
+    df[2171] = df[2172];
+    df[2170] = t8162+t8163+t8192+t8193;
+    df[2169] = df[2170];
+    df[2168] = t7753+t7754+t8192+t8193;
+    df[2167] = t7743+t7744+t8192+t8193;
+    df[2166] = df[2167];
+    df[2165] = df[2168];
+    const real t8194 = t8160*t50;
+    df[2164] = t8182+t8194;
+    df[2163] = t8180+t8194;
+    df[2162] = df[2163];
+    df[2161] = df[2164];
+    df[2160] = t7739*t37+t8160*t37;
+    df[2159] = df[2160];
+    df[2158] = t8160*t215;
+    const real t8197 = df[2180];
+    const real t8198 = df[2158];
+    df[2157] = t8020+t7755+t8197+t8198;
+    df[2156] = df[2157];
+    df[2155] = t7751+t7752+t8197+t8198;
+    df[2154] = t8197+t8198;
+    df[2153] = df[2154];
+    df[2151] = df[2154];
+    df[2150] = df[2151];
+    df[2149] = df[2150];
+    df[2148] = df[2149];
+    df[2147] = df[2148];
+    df[2146] = df[2147];
+    df[2145] = df[2155];
+    df[2144] = df[2145];
+    df[2143] = df[2144];
+    df[2142] = df[2143];
+    df[2141] = t4135*t240;
+    const real t8655 = df[2141];
+    df[2140] = t8025+t8655;
+    df[2138] = t7774+t8655;
+    df[2137] = df[2138];
+    df[2136] = t4135*t143;
+    const real t8202 = df[2136];
+    df[2135] = t8023+t8202;
+    df[2134] = t8655+t8202;
+    df[2133] = df[2134];
+    df[2132] = t8082+t8202;
+    df[2131] = df[2132];
+    df[2130] = df[2134];
+    df[2129] = df[2133];
+    df[2128] = df[2129];
+    df[2127] = df[2128];
+    df[2126] = df[2131];
+    df[2125] = df[2132];
+    df[2123] = df[2125];
+    df[2122] = df[2123];
+    const real t8205 = t7493*t72;
+    const real t8206 = t4135*t50;
+    df[2121] = t8205+t8206;
+    const real t8207 = t7493*t73;
+    df[2120] = t8207+t8206;
+    df[2119] = df[2120];
+    df[2118] = df[2121];
+    const real t8208 = t7493*t50;
+    const real t8209 = t4135*t72;
+    df[2117] = t8208+t8209;
+    const real t8210 = t7493*t67;
+    df[2116] = t8210+t8209;
+    df[2115] = df[2116];
+    df[2114] = df[2117];
+    df[2113] = t4135*t215;
+    const real t8211 = df[2667];
+    const real t8212 = df[2113];
+    df[2112] = t8046+t7764+t8211+t8212;
+    df[2111] = df[2112];
+    df[2110] = t7770+t7771+t8211+t8212;
+    df[2109] = t8211+t8212;
+    df[2108] = df[2109];
+    df[2106] = df[2109];
+    df[2105] = df[2106];
+    df[2104] = df[2105];
+    df[2103] = df[2104];
+    df[2102] = df[2103];
+    df[2101] = df[2102];
+    df[2100] = df[2110];
+    df[2099] = df[2100];
+    df[2098] = df[2099];
+    df[2097] = df[2098];
+    df[2096] = t7493*t7912+t4135*t7912;
+    df[2095] = df[2096];
+    const real t8216 = t4135*t73;
+    df[2094] = t8210+t8216;
+    df[2093] = t8208+t8216;
+    df[2092] = df[2093];
+    df[2091] = df[2094];
+    df[2090] = t4135*t2404;
+    const real t8217 = df[2090];
+    df[2089] = t8066+t8217;
+    const real t8218 = df[4025];
+    const real t8219 = t8218*t20;
+    const real t8673 = df[2089];
+    const real t8221 = t8673*t20;
+    df[2088] = t8219+t8221;
+    const real t8222 = df[4029]*t26;
+    df[2087] = t8222+t8221;
+    df[2086] = t7641+t7661+t8066+t8217;
+    df[2085] = t8217*t179;
+    const real t8223 = df[2658];
+    const real t8224 = df[2085];
+    df[2084] = t7680+t7681+t8223+t8224;
+    df[2083] = t8223+t8224;
+    df[2082] = df[2083];
+    df[2081] = df[2082];
+    df[2080] = df[2081];
+    df[2079] = df[2080];
+    df[2078] = df[2079];
+    df[2077] = df[2078];
+    df[2076] = df[2077];
+    df[2075] = df[2084];
+    df[2074] = df[2075];
+    df[2073] = df[2074];
+    df[2072] = df[2073];
+    df[2071] = t8217*t275;
+    const real t8225 = df[2631];
+    const real t8226 = df[2071];
+    df[2070] = t7974+t7690+t8225+t8226;
+    df[2069] = t8225+t8226;
+    df[2068] = df[2069];
+    df[2067] = df[2068];
+    df[2066] = df[2067];
+    df[2065] = df[2066];
+    df[2064] = df[2065];
+    df[2063] = df[2064];
+    df[2062] = df[2063];
+    df[2061] = df[2070];
+    df[2060] = df[2061];
+    df[2059] = df[2060];
+    df[2058] = df[2059];
+    df[2057] = t8217*t212;
+    const real t8227 = df[2057];
+    df[2056] = t8071+t8227;
+    df[2055] = df[2056];
+    df[2054] = df[2055];
+    df[2053] = df[2054];
+    df[2052] = df[2053];
+    const real t8228 = df[2643];
+    const real t8229 = t8217*t77;
+    df[2051] = t8228+t8229;
+    df[2050] = df[2051];
+    df[2049] = t7666+t7699+t8228+t8229;
+    df[2048] = t7677+t7675+t8228+t8229;
+    df[2047] = df[2049];
+    df[2046] = df[2048];
+    df[2045] = t8217*t155;
+    const real t8230 = df[2045];
+    df[2044] = t8076+t8230;
+    df[2043] = df[2044];
+    df[2042] = df[2043];
+    df[2041] = df[2042];
+    const real t8231 = t7671*t73;
+    const real t8233 = t8673*t67;
+    df[2039] = t8231+t8233;
+    const real t8234 = t7958*t72;
+    df[2038] = t8234+t8233;
+    df[2037] = df[2038];
+    df[2036] = df[2039];
+    df[2035] = t8217*t136;
+    const real t8235 = df[2657];
+    const real t8236 = df[2035];
+    df[2034] = t8235+t8236;
+    df[2033] = df[2034];
+    const real t8237 = df[2661];
+    df[2032] = t8237+t8236;
+    df[2031] = df[2032];
+    df[2030] = t7673+t7692+t8237+t8236;
+    df[2029] = t7669+t7667+t8237+t8236;
+    df[2028] = df[2030];
+    df[2027] = df[2029];
+    df[2026] = t8217*t475;
+    const real t8238 = df[2026];
+    df[2025] = t7953+t7662+t8067+t8238;
+    df[2024] = t8068+t8238;
+    df[2023] = df[2024];
+    df[2022] = t7662+t8238;
+    df[2021] = df[2023];
+    df[2020] = df[2021];
+    df[2019] = t8067+t8238;
+    df[2017] = df[2024];
+    df[2016] = df[2017];
+    df[2015] = t8217*t146;
+    const real t8240 = df[2015];
+    df[2014] = t8078+t8240;
+    df[2013] = df[2014];
+    df[2012] = df[2013];
+    df[2011] = t8076+t8078+t8230+t8240;
+    df[2010] = df[2011];
+    df[2009] = t7702+t7703+t8076+t8078+t8230+t8240;
+    df[2008] = t7684+t7686+t8076+t8078+t8230+t8240;
+    df[2007] = df[2008];
+    df[2006] = df[2009];
+    df[2005] = t8673;
+    const real t8675 = df[2005];
+    df[2004] = t7671*t37+t8675*t37;
+    df[2003] = df[2004];
+    const real t8245 = t8675*t26;
+    df[2001] = t8222+t8245;
+    df[2000] = df[2001];
+    df[1999] = t8219+t8245;
+    df[1997] = t8217*t254;
+    const real t8247 = df[1997];
+    df[1996] = t8225+t8247;
+    const real t8248 = df[2641];
+    df[1995] = t7694+t7693+t8248+t8247;
+    df[1994] = t8248+t8247;
+    df[1993] = df[1994];
+    df[1992] = df[1993];
+    df[1991] = df[1992];
+    df[1990] = df[1991];
+    df[1989] = df[1990];
+    df[1988] = df[1989];
+    df[1987] = df[1988];
+    df[1986] = df[1995];
+    df[1985] = df[1986];
+    df[1984] = df[1985];
+    df[1983] = df[1984];
+    df[1982] = t8217*t309;
+    const real t8249 = df[1982];
+    df[1981] = t7654+t8249;
+    df[1980] = t7957+t8249;
+    df[1979] = t8067+t8249;
+    df[1978] = df[1979];
+    df[1977] = df[1978];
+    df[1976] = df[1977];
+    df[1975] = df[1976];
+    df[1974] = df[1978];
+    df[1972] = t8217*t240;
+    const real t8250 = df[1972];
+    df[1971] = t8238+t8250;
+    df[1970] = t8068+t8073+t8238+t8250;
+    df[1969] = df[1970];
+    df[1968] = t7948+t7949+t7662+t7687+t8068+t8073+t8238+t8250;
+    df[1967] = df[1968];
+    df[1966] = df[1971];
+    df[1965] = df[1968];
+    df[1964] = t8073+t8250;
+    df[1963] = df[1965];
+    df[1962] = df[1964];
+    df[1961] = df[1966];
+    df[1960] = df[1969];
+    df[1959] = df[1960];
+    df[1957] = df[1971];
+    df[1956] = df[1964];
+    df[1955] = df[1956];
+    df[1954] = df[1957];
+    df[1953] = t7654+t7687+t8069+t8250;
+    df[1952] = df[1954];
+    df[1951] = t7949+t8250;
+    df[1950] = df[1955];
+    df[1949] = t7949+t7957+t8069+t8250;
+    df[1948] = df[1950];
+    df[1947] = df[1965];
+    df[1946] = df[2089];
+    const real t8253 = df[4027]*t50;
+    const real t8681 = df[1946];
+    const real t8255 = t8681*t72;
+    df[1945] = t8253+t8255;
+    const real t8256 = df[4028]*t67;
+    df[1944] = t8256+t8255;
+    df[1943] = df[1944];
+    df[1942] = df[1945];
+    df[1941] = t8217*t143;
+    const real t8257 = df[1941];
+    df[1940] = t7696+t8257;
+    df[1939] = t8069+t8257;
+    df[1938] = df[1939];
+    df[1937] = t8249+t8257;
+    df[1936] = df[1937];
+    df[1935] = t7953+t7654+t7957+t7696+t8067+t8069+t8249+t8257;
+    df[1934] = df[1938];
+    df[1933] = df[1934];
+    df[1932] = df[1933];
+    df[1931] = df[1932];
+    df[1930] = df[1936];
+    df[1929] = df[1937];
+    df[1927] = df[1929];
+    df[1926] = df[1927];
+    df[1925] = t8067+t8069+t8249+t8257;
+    df[1924] = df[1925];
+    df[1923] = df[1924];
+    df[1922] = df[1923];
+    df[1921] = df[1935];
+    df[1920] = df[1921];
+    df[1919] = df[1920];
+    df[1918] = df[1919];
+    df[1917] = t8217*t215;
+    const real t8260 = df[1917];
+    df[1916] = t8571+t8260;
+    df[1915] = df[1916];
+    df[1914] = t7694+t7693+t8227+t8260;
+    df[1913] = t7974+t7690+t8227+t8260;
+    df[1912] = t7656+t7658+t7670+t7700+t8571+t8071+t8227+t8260;
+    df[1911] = df[1915];
+    df[1910] = df[1911];
+    df[1909] = df[1910];
+    df[1908] = df[1909];
+    df[1907] = t8227+t8260;
+    df[1906] = df[1907];
+    df[1904] = df[1907];
+    df[1903] = df[1904];
+    df[1902] = t8071+t8571+t8227+t8260;
+    df[1901] = df[1902];
+    df[1900] = df[1901];
+    df[1899] = df[1900];
+    df[1898] = df[1912];
+    df[1897] = df[1898];
+    df[1896] = df[1897];
+    df[1895] = df[1896];
+    const real t8263 = t8681*t50;
+    df[1893] = t8234+t8263;
+    df[1892] = t8231+t8263;
+    df[1891] = df[1892];
+    df[1890] = df[1893];
+    const real t8265 = t8681*t73;
+    df[1888] = t8231+t8234+t8255+t8265;
+    df[1887] = df[1888];
+    df[1886] = t8256+t8265;
+    df[1885] = t8253+t8265;
+    df[1884] = df[1885];
+    df[1883] = df[1886];
+    df[1882] = t8217*t126;
+    const real t8266 = df[1882];
+    df[1881] = t8228+t8266;
+    const real t8267 = t8066*t77;
+    df[1880] = t8267+t8266;
+    df[1879] = df[1880];
+    df[1878] = t8237+t8267+t8236+t8266;
+    df[1877] = df[1878];
+    df[1876] = t7669+t7667+t8267+t8266;
+    df[1875] = t7673+t7692+t8267+t8266;
+    df[1874] = df[1876];
+    df[1873] = df[1875];
+    df[1872] = t8217*t132;
+    const real t8268 = df[1872];
+    df[1871] = t8237+t8268;
+    df[1870] = t8235+t8268;
+    df[1869] = df[1870];
+    df[1868] = t8235+t8228+t8229+t8268;
+    df[1867] = df[1868];
+    df[1866] = t7677+t7675+t8235+t8268;
+    df[1865] = t7666+t7699+t8235+t8268;
+    df[1864] = df[1865];
+    df[1863] = df[1866];
+    df[1862] = t8217*t145;
+    const real t8269 = df[1862];
+    df[1861] = t8079+t8269;
+    df[1860] = df[1861];
+    df[1859] = t8217*t139;
+    const real t8270 = df[1859];
+    df[1858] = t8077+t8270;
+    df[1857] = t7669+t7673+t7667+t7692+t8230+t8240+t8269+t8270;
+    df[1856] = t7666+t7677+t7675+t7699+t8230+t8240+t8269+t8270;
+    df[1855] = df[1857];
+    df[1854] = df[1856];
+    df[1853] = t8076+t8077+t8078+t8079+t8230+t8240+t8269+t8270;
+    df[1852] = df[1853];
+    df[1851] = t8077+t8079+t8269+t8270;
+    df[1850] = df[1851];
+    df[1849] = t7684+t7686+t8077+t8079+t8269+t8270;
+    df[1848] = t7702+t7703+t8077+t8079+t8269+t8270;
+    df[1847] = df[1848];
+    df[1846] = df[1849];
+    df[1845] = t4135*t145;
+    const real t8271 = df[2670];
+    const real t8272 = df[1845];
+    df[1844] = t7766+t7767+t7805+t7806+t8271+t8156+t8157+t8272;
+    df[1843] = df[1844];
+    df[1842] = df[1843];
+    df[1841] = df[1842];
+    df[1840] = t8271+t8156+t8157+t8272;
+    df[1839] = df[1840];
+    df[1838] = t8271+t8272;
+    df[1837] = df[1838];
+    df[1836] = t7768+t7769+t8271+t8272;
+    df[1835] = t7772+t7773+t8271+t8272;
+    df[1834] = df[1835];
+    df[1833] = df[1836];
+    df[1832] = t4135*t136;
+    const real t8273 = df[2601];
+    const real t8274 = df[1832];
+    df[1831] = t8273+t8274;
+    df[1830] = df[1831];
+    df[1829] = t8083+t8084+t8273+t8274;
+    df[1828] = df[1829];
+    df[1827] = t7766+t7767+t8273+t8274;
+    df[1826] = t7805+t7806+t8273+t8274;
+    df[1825] = df[1827];
+    df[1824] = df[1826];
+    df[1823] = t4135*t475;
+    const real t8275 = df[1823];
+    df[1822] = t8082+t8275;
+    df[1821] = df[1822];
+    df[1820] = t8023+t8025+t8043+t7774+t8082+t8655+t8202+t8275;
+    df[1819] = df[1821];
+    df[1818] = df[1819];
+    df[1817] = df[1818];
+    df[1816] = df[1817];
+    df[1815] = t8082+t8655+t8202+t8275;
+    df[1814] = df[1815];
+    df[1813] = df[1814];
+    df[1812] = df[1813];
+    df[1811] = df[1820];
+    df[1810] = df[1811];
+    df[1808] = df[1811];
+    df[1807] = df[1808];
+    df[1806] = t8655+t8275;
+    df[1805] = df[1806];
+    df[1804] = df[1805];
+    df[1803] = df[1804];
+    df[1802] = df[1803];
+    df[1801] = df[1802];
+    df[1800] = t8043+t8275;
+    df[1799] = df[1800];
+    df[1798] = t4135*t275;
+    const real t8277 = df[2616];
+    const real t8278 = df[1798];
+    df[1797] = t8046+t7764+t8277+t8278;
+    df[1796] = t8277+t8278;
+    df[1795] = df[1796];
+    df[1794] = df[1795];
+    df[1793] = df[1794];
+    df[1792] = df[1793];
+    df[1791] = df[1792];
+    df[1790] = df[1791];
+    df[1789] = df[1790];
+    df[1788] = df[1797];
+    df[1787] = df[1788];
+    df[1786] = df[1787];
+    df[1785] = df[1786];
+    const real t8279 = t4135*t67;
+    df[1784] = t8207+t8279;
+    df[1783] = t8205+t8279;
+    df[1782] = df[1783];
+    df[1781] = df[1784];
+    df[1779] = t2341*t275;
+    const real t8280 = df[2760];
+    const real t8281 = df[1779];
+    df[1778] = t7900+t7899+t8280+t8281;
+    df[1777] = t8280+t8281;
+    df[1776] = df[1777];
+    df[1775] = df[1776];
+    df[1774] = df[1775];
+    df[1773] = df[1774];
+    df[1772] = df[1773];
+    df[1771] = df[1772];
+    df[1770] = df[1771];
+    df[1769] = df[1778];
+    df[1768] = df[1769];
+    df[1767] = df[1768];
+    df[1766] = df[1767];
+    df[1765] = t2341*t3120;
+    const real t8282 = df[1765];
+    df[1764] = t8282*t215;
+    const real t8688 = df[1764];
+    df[1763] = t8437+t8688;
+    df[1762] = df[1763];
+    df[1761] = df[1762];
+    df[1760] = df[1761];
+    df[1759] = df[1760];
+    df[1757] = t8282*t309;
+    const real t8284 = df[1757];
+    df[1756] = t7984+t8284;
+    df[1755] = df[1756];
+    df[1754] = df[1755];
+    df[1753] = df[1754];
+    df[1752] = df[1753];
+    df[1751] = df[1754];
+    df[1749] = t8282*t254;
+    const real t8285 = df[1749];
+    df[1748] = t7983+t8285;
+    df[1747] = df[1748];
+    df[1746] = df[1747];
+    df[1745] = df[1746];
+    df[1744] = t8282*t240;
+    const real t8286 = df[1744];
+    df[1743] = t7992+t8286;
+    df[1742] = df[1743];
+    df[1741] = df[1742];
+    df[1740] = df[1741];
+    df[1739] = df[1740];
+    df[1738] = t8445+t8508+t8007+t8286;
+    df[1736] = t8443+t8286;
+    df[1735] = df[1743];
+    df[1734] = t8282*t179;
+    const real t8288 = df[1734];
+    df[1733] = t8009+t8288;
+    df[1732] = df[1733];
+    df[1731] = df[1732];
+    df[1730] = df[1731];
+    df[1729] = t8282*t475;
+    const real t8689 = df[1729];
+    df[1728] = t8508+t8689;
+    df[1727] = df[1728];
+    df[1725] = df[1728];
+    df[1724] = df[1725];
+    df[1723] = df[1724];
+    df[1722] = t8444+t8689;
+    df[1721] = df[1722];
+    df[1720] = df[1723];
+    df[1719] = t7984+t8689;
+    df[1718] = t8282*t139;
+    const real t8291 = df[1718];
+    df[1717] = t7997+t8291;
+    df[1716] = t8282*t275;
+    const real t8292 = df[1716];
+    df[1715] = t7981+t8292;
+    df[1714] = df[1715];
+    df[1713] = df[1714];
+    df[1712] = df[1713];
+    df[1710] = t8282*t155;
+    const real t8294 = df[1710];
+    df[1709] = t7990+t8294;
+    df[1708] = df[1709];
+    df[1707] = t8282*t212;
+    const real t8295 = df[1707];
+    df[1706] = t8002+t8295;
+    df[1705] = df[1706];
+    df[1704] = df[1705];
+    df[1703] = df[1704];
+    df[1702] = df[1703];
+    df[1701] = t8282*t146;
+    const real t8296 = df[1701];
+    df[1700] = t7998+t8296;
+    df[1699] = df[1700];
+    df[1698] = t8282*t143;
+    const real t8297 = df[1698];
+    df[1697] = t8507+t8297;
+    df[1696] = t8007+t8297;
+    df[1695] = df[1696];
+    df[1694] = df[1695];
+    df[1693] = df[1694];
+    df[1692] = df[1693];
+    df[1691] = df[1692];
+    df[1689] = t8282*t145;
+    const real t8298 = df[1689];
+    df[1688] = t7989+t8298;
+    df[1687] = t2341*t475;
+    const real t8690 = df[1687];
+    df[1686] = t8015+t8690;
+    df[1684] = df[1686];
+    df[1683] = df[1684];
+    df[1682] = df[1683];
+    df[1681] = t8430+t8690;
+    df[1680] = df[1682];
+    df[1679] = df[1680];
+    df[1678] = t8148+t7846+t8430+t8690;
+    df[1677] = t8148+t8690;
+    df[1676] = t2404+t2341;
+    const real t8301 = t8220*t73;
+    const real t8691 = df[1676];
+    const real t8303 = t8691*t67;
+    df[1675] = t8301+t8303;
+    const real t8304 = t8220*t72;
+    df[1674] = t8304+t8303;
+    df[1673] = df[1674];
+    df[1672] = df[1675];
+    df[1671] = t2341*t3116;
+    const real t8305 = df[1671];
+    df[1670] = t8305*t275;
+    const real t8306 = df[1670];
+    df[1669] = t8292+t8306;
+    df[1668] = t7980+t8306;
+    df[1667] = df[1668];
+    df[1666] = df[1667];
+    df[1665] = df[1666];
+    df[1664] = df[1669];
+    df[1663] = df[1664];
+    df[1662] = df[1663];
+    df[1661] = df[1662];
+    df[1660] = t7980+t7981+t8292+t8306;
+    df[1659] = df[1660];
+    df[1658] = df[1659];
+    df[1657] = df[1658];
+    df[1656] = t7967+t7976+t8282+t8305;
+    df[1655] = t8305*t215;
+    const real t8307 = df[1655];
+    df[1654] = t8525+t8307;
+    df[1653] = t8525+t8437+t8688+t8307;
+    df[1652] = t8295+t8307;
+    df[1651] = t7977+t8437+t8295+t8307;
+    df[1650] = df[1654];
+    df[1649] = df[1650];
+    df[1648] = df[1649];
+    df[1647] = df[1648];
+    df[1646] = df[1652];
+    df[1645] = df[1646];
+    df[1643] = df[1652];
+    df[1642] = df[1643];
+    df[1641] = t8525+t8002+t8295+t8307;
+    df[1640] = df[1641];
+    df[1639] = df[1640];
+    df[1638] = df[1639];
+    df[1637] = t8305*t145;
+    const real t8309 = df[1637];
+    df[1636] = t7995+t8309;
+    df[1635] = t7995+t7989+t8298+t8309;
+    df[1634] = t7995+t7997+t8291+t8309;
+    df[1633] = df[1634];
+    df[1632] = t8282+t8305;
+    const real t8310 = df[2785];
+    const real t8693 = df[1632];
+    const real t8312 = t8693*t77;
+    df[1631] = t8310+t8312;
+    df[1630] = df[1631];
+    df[1628] = t8693*t132;
+    const real t8314 = df[2783];
+    const real t8315 = df[1628];
+    df[1627] = t8314+t8315;
+    const real t8316 = df[2767];
+    df[1626] = t8316+t8315;
+    df[1625] = df[1626];
+    df[1624] = t8310+t8316+t8312+t8315;
+    df[1623] = df[1624];
+    df[1622] = t8305*t179;
+    const real t8317 = df[1622];
+    df[1621] = t8008+t8009+t8288+t8317;
+    df[1620] = t8008+t8317;
+    df[1619] = df[1620];
+    df[1618] = df[1619];
+    df[1617] = df[1618];
+    df[1616] = t8288+t8317;
+    df[1615] = df[1616];
+    df[1614] = df[1615];
+    df[1613] = df[1614];
+    df[1612] = df[1621];
+    df[1611] = df[1612];
+    df[1610] = df[1611];
+    df[1609] = df[1610];
+    df[1608] = df[1609];
+    df[1607] = df[1608];
+    df[1606] = df[1607];
+    df[1605] = df[1606];
+    df[1604] = t8305*t240;
+    const real t8318 = df[1604];
+    df[1603] = t8507+t8508+t8689+t8318;
+    df[1602] = df[1603];
+    df[1601] = t8689+t8318;
+    df[1600] = df[1601];
+    df[1599] = df[1600];
+    df[1598] = df[1599];
+    df[1597] = df[1598];
+    df[1596] = df[1597];
+    df[1594] = t8507+t8318;
+    df[1593] = df[1594];
+    df[1592] = t8007+t8318;
+    df[1591] = df[1592];
+    df[1590] = df[1593];
+    df[1589] = df[1590];
+    df[1588] = df[1589];
+    df[1587] = df[1588];
+    df[1586] = df[1603];
+    df[1585] = df[1586];
+    df[1584] = t8305*t254;
+    const real t8320 = df[1584];
+    df[1583] = t8285+t8320;
+    df[1582] = t7980+t7981+t8285+t8320;
+    df[1581] = t8525+t7982+t7983+t8002+t8285+t8295+t8307+t8320;
+    df[1580] = t7982+t8320;
+    df[1579] = df[1580];
+    df[1578] = df[1579];
+    df[1577] = df[1578];
+    df[1576] = df[1583];
+    df[1575] = df[1576];
+    df[1574] = df[1575];
+    df[1573] = df[1574];
+    df[1572] = t7982+t7983+t8285+t8320;
+    df[1571] = df[1572];
+    df[1570] = df[1571];
+    df[1569] = df[1570];
+    df[1568] = df[1581];
+    df[1567] = df[1568];
+    df[1566] = df[1567];
+    df[1565] = df[1566];
+    df[1564] = t8305*t139;
+    const real t8321 = df[1564];
+    df[1563] = t7988+t8321;
+    df[1562] = t7988+t7989+t8298+t8321;
+    df[1561] = df[1562];
+    df[1560] = t7988+t7989+t8310+t8298+t8312+t8321;
+    df[1559] = t7988+t7989+t8316+t8298+t8315+t8321;
+    df[1558] = df[1559];
+    df[1557] = df[1560];
+    df[1556] = df[1656];
+    df[1555] = df[1556];
+    df[1554] = df[1656];
+    const real t8323 = df[1554];
+    const real t8694 = df[1555];
+    df[1553] = t8694*t26+t8323*t20;
+    df[1551] = df[1554];
+    df[1550] = t8305*t475;
+    const real t8326 = df[1550];
+    df[1549] = t8286+t8326;
+    df[1548] = t8445+t8326;
+    df[1547] = df[1548];
+    df[1546] = df[1547];
+    df[1545] = df[1546];
+    df[1544] = df[1545];
+    df[1543] = df[1544];
+    df[1542] = t8445+t7992+t8286+t8326;
+    df[1541] = df[1542];
+    df[1540] = df[1541];
+    df[1539] = df[1540];
+    df[1538] = df[1539];
+    df[1536] = df[1542];
+    df[1535] = df[1549];
+    df[1534] = df[1535];
+    df[1533] = df[1534];
+    df[1532] = df[1533];
+    df[1531] = df[1532];
+    df[1530] = df[1536];
+    df[1529] = t8689+t8326;
+    df[1528] = t7984+t8326;
+    df[1527] = t8444+t8326;
+    df[1526] = df[1530];
+    df[1525] = df[1526];
+    df[1524] = t8305*t155;
+    const real t8328 = df[1524];
+    df[1523] = t7996+t8328;
+    df[1522] = t7996+t7990+t8294+t8328;
+    df[1521] = df[1523];
+    df[1520] = df[1522];
+    df[1519] = t8291+t8296+t8309+t8328;
+    df[1518] = t7987+t7988+t7989+t7990+t8291+t8296+t8309+t8328;
+    df[1517] = df[1519];
+    df[1516] = df[1518];
+    df[1515] = t7995+t7996+t7997+t7998+t8291+t8296+t8309+t8328;
+    df[1514] = df[1515];
+    df[1513] = t7996+t7998+t8296+t8328;
+    df[1512] = df[1513];
+    df[1511] = df[1551];
+    const real t8330 = t8694*t73;
+    const real t8331 = df[1511];
+    const real t8332 = t8331*t72;
+    df[1510] = t8330+t8332;
+    df[1509] = df[1510];
+    df[1508] = t8305*t143;
+    const real t8333 = df[1508];
+    df[1507] = t8443+t8333;
+    df[1506] = df[1507];
+    df[1505] = t8284+t8333;
+    df[1504] = df[1505];
+    df[1503] = t8443+t7984+t8284+t8333;
+    df[1502] = df[1506];
+    df[1501] = df[1502];
+    df[1500] = df[1501];
+    df[1499] = df[1500];
+    df[1498] = df[1504];
+    df[1497] = df[1505];
+    df[1495] = df[1497];
+    df[1494] = df[1495];
+    df[1493] = df[1503];
+    df[1492] = df[1493];
+    df[1491] = df[1492];
+    df[1490] = df[1493];
+    df[1489] = df[1490];
+    df[1488] = df[1491];
+    df[1487] = df[1489];
+    df[1486] = df[1487];
+    df[1485] = t8305*t309;
+    const real t8336 = df[1485];
+    df[1484] = t8508+t8336;
+    df[1483] = t8443+t8284+t8318+t8336;
+    df[1482] = t8444+t8336;
+    df[1481] = df[1482];
+    df[1480] = t8297+t8336;
+    df[1479] = df[1480];
+    df[1478] = t8507+t8444+t8508+t8007+t8689+t8297+t8318+t8336;
+    df[1477] = df[1481];
+    df[1476] = df[1477];
+    df[1475] = df[1476];
+    df[1474] = df[1475];
+    df[1473] = df[1479];
+    df[1471] = df[1480];
+    df[1470] = df[1471];
+    df[1469] = df[1470];
+    df[1468] = t8444+t8007+t8297+t8336;
+    df[1467] = df[1468];
+    df[1466] = df[1467];
+    df[1465] = df[1466];
+    df[1464] = df[1478];
+    df[1463] = df[1464];
+    df[1462] = df[1463];
+    df[1461] = df[1462];
+    df[1460] = df[1632];
+    const real t8699 = df[1460];
+    df[1459] = t8699*t126;
+    const real t8340 = df[1459];
+    df[1458] = t8310+t8340;
+    const real t8341 = t8526*t77;
+    df[1457] = t8341+t8340;
+    df[1456] = df[1457];
+    df[1455] = t7995+t7997+t8341+t8291+t8309+t8340;
+    df[1454] = t7996+t7998+t8341+t8296+t8328+t8340;
+    df[1453] = df[1454];
+    df[1452] = df[1455];
+    df[1450] = t8699*t136;
+    const real t8343 = df[1450];
+    df[1449] = t8316+t8343;
+    df[1448] = df[1449];
+    df[1447] = t8314+t8343;
+    df[1446] = df[1447];
+    df[1445] = t8314+t8341+t8340+t8343;
+    df[1444] = df[1445];
+    df[1443] = t7996+t7998+t8314+t8296+t8328+t8343;
+    df[1442] = t7995+t7997+t8314+t8291+t8309+t8343;
+    df[1441] = df[1442];
+    df[1440] = df[1443];
+    df[1439] = t8305*t146;
+    const real t8344 = df[1439];
+    df[1438] = t7987+t8344;
+    df[1437] = t7987+t7998+t8296+t8344;
+    df[1436] = df[1438];
+    df[1435] = t7995+t7996+t7997+t7998+t8294+t8298+t8321+t8344;
+    df[1434] = t8294+t8298+t8321+t8344;
+    df[1433] = df[1435];
+    df[1432] = df[1434];
+    df[1431] = t7987+t7988+t7989+t7990+t8294+t8298+t8321+t8344;
+    df[1430] = df[1431];
+    df[1429] = t7987+t7990+t8294+t8344;
+    df[1428] = df[1429];
+    df[1427] = t7987+t7990+t8316+t8294+t8315+t8344;
+    df[1426] = t7987+t7990+t8310+t8294+t8312+t8344;
+    df[1425] = df[1426];
+    df[1424] = df[1427];
+    df[1423] = df[1511];
+    const real t8700 = df[1423];
+    const real t8346 = t8700*t67;
+    df[1422] = t8330+t8346;
+    df[1421] = t8332+t8346;
+    df[1420] = df[1421];
+    df[1419] = df[1422];
+    const real t8348 = t8700*t50;
+    df[1417] = t8332+t8348;
+    df[1416] = t8330+t8348;
+    df[1415] = df[1416];
+    df[1414] = df[1417];
+    df[1413] = t8305*t212;
+    const real t8349 = df[1413];
+    df[1412] = t7977+t8349;
+    df[1411] = t8525+t8002+t8688+t8349;
+    df[1410] = t8688+t8349;
+    df[1409] = t7980+t7977+t8437+t7981+t8688+t8292+t8306+t8349;
+    df[1408] = df[1412];
+    df[1407] = df[1408];
+    df[1406] = df[1407];
+    df[1405] = df[1406];
+    df[1404] = df[1410];
+    df[1403] = df[1404];
+    df[1402] = df[1410];
+    df[1401] = df[1402];
+    df[1400] = t7977+t8437+t8688+t8349;
+    df[1399] = df[1400];
+    df[1398] = df[1399];
+    df[1397] = df[1398];
+    df[1396] = df[1409];
+    df[1395] = df[1396];
+    df[1394] = df[1395];
+    df[1393] = df[1394];
+    df[1392] = t2341*t254;
+    const real t8351 = df[1392];
+    df[1391] = t8280+t8351;
+    const real t8352 = df[2848];
+    df[1390] = t8254+t7902+t8352+t8351;
+    df[1389] = t8352+t8351;
+    df[1388] = df[1389];
+    df[1387] = df[1388];
+    df[1386] = df[1387];
+    df[1385] = df[1386];
+    df[1384] = df[1385];
+    df[1383] = df[1384];
+    df[1382] = df[1383];
+    df[1381] = df[1390];
+    df[1380] = df[1381];
+    df[1379] = df[1380];
+    df[1378] = df[1379];
+    const real t8353 = t8220*t67;
+    const real t8355 = t8691*t73;
+    df[1376] = t8353+t8355;
+    const real t8356 = t8220*t50;
+    df[1375] = t8356+t8355;
+    df[1374] = df[1376];
+    df[1373] = df[1375];
+    df[1371] = t8220*t37+t8691*t37;
+    df[1370] = df[1371];
+    df[1369] = t2341*t240;
+    const real t8361 = df[1369];
+    df[1368] = t8147+t7886+t7970+t8361;
+    df[1367] = t8147+t8148+t7885+t7896+t8427+t8015+t8690+t8361;
+    df[1366] = df[1367];
+    df[1365] = df[1366];
+    df[1364] = df[1365];
+    df[1363] = df[1366];
+    df[1362] = t8427+t8361;
+    df[1361] = df[1362];
+    df[1360] = t8690+t8361;
+    df[1359] = df[1360];
+    df[1358] = df[1359];
+    df[1357] = df[1358];
+    df[1355] = df[1362];
+    df[1354] = df[1360];
+    df[1353] = t8427+t8015+t8690+t8361;
+    df[1352] = t7885+t8361;
+    df[1351] = df[1353];
+    df[1350] = df[1351];
+    df[1349] = df[1350];
+    df[1348] = df[1355];
+    df[1347] = df[1348];
+    df[1346] = t8146+t7885+t7970+t8361;
+    df[1345] = df[1347];
+    df[1344] = df[1354];
+    df[1343] = t2341*t215;
+    const real t8706 = df[1343];
+    df[1342] = t7972+t8706;
+    df[1341] = df[1342];
+    df[1340] = df[1341];
+    df[1339] = df[1340];
+    df[1338] = df[1339];
+    df[1337] = df[1338];
+    df[1335] = t2341*t145;
+    const real t8364 = df[1335];
+    df[1334] = t8014+t8364;
+    df[1333] = df[1334];
+    df[1332] = t2341*t179;
+    const real t8365 = df[2847];
+    const real t8366 = df[1332];
+    df[1331] = t7906+t7907+t8365+t8366;
+    df[1330] = t8365+t8366;
+    df[1329] = df[1330];
+    df[1328] = df[1329];
+    df[1327] = df[1328];
+    df[1326] = df[1327];
+    df[1325] = df[1326];
+    df[1324] = df[1325];
+    df[1323] = df[1324];
+    df[1322] = df[1331];
+    df[1321] = df[1322];
+    df[1320] = df[1321];
+    df[1319] = df[1320];
+    df[1318] = t2341*t143;
+    const real t8367 = df[1318];
+    df[1317] = t8145+t8367;
+    df[1316] = t7970+t8367;
+    df[1315] = df[1316];
+    df[1314] = df[1315];
+    df[1313] = df[1314];
+    df[1312] = df[1313];
+    df[1311] = df[1312];
+    df[1309] = t2341*t155;
+    const real t8368 = df[1309];
+    df[1308] = t8011+t8368;
+    df[1307] = df[1308];
+    df[1306] = df[1307];
+    df[1305] = df[1306];
+    df[1304] = t2341*t139;
+    const real t8369 = df[1304];
+    df[1303] = t8013+t8369;
+    df[1302] = t8013+t8014+t8364+t8369;
+    df[1301] = df[1302];
+    df[1300] = t7893+t7895+t8013+t8014+t8364+t8369;
+    df[1299] = t7891+t7892+t8013+t8014+t8364+t8369;
+    df[1298] = df[1299];
+    df[1297] = df[1300];
+    df[1295] = t2341*t2341;
+    const real t8370 = df[1295];
+    df[1294] = t7952+t8370;
+    const real t8705 = df[3252];
+    const real t8371 = t8705*t20;
+    const real t8372 = df[1294];
+    const real t8373 = t8372*t20;
+    df[1293] = t8371+t8373;
+    const real t8374 = t8200*t26;
+    df[1292] = t8374+t8373;
+    df[1291] = t8370*t126;
+    const real t8375 = df[2898];
+    const real t8376 = df[1291];
+    df[1290] = t8375+t8376;
+    const real t8377 = t7952*t77;
+    df[1289] = t8377+t8376;
+    df[1288] = df[1289];
+    df[1287] = t7855+t7858+t8377+t8376;
+    df[1286] = t7854+t7853+t8377+t8376;
+    df[1285] = df[1287];
+    df[1284] = df[1286];
+    df[1283] = t7809+t7847+t7952+t8370;
+    df[1282] = t8370*t155;
+    const real t8378 = df[1282];
+    df[1281] = t7961+t8378;
+    df[1280] = df[1281];
+    df[1279] = df[1280];
+    df[1278] = df[1279];
+    df[1277] = t8370*t136;
+    const real t8379 = df[2913];
+    const real t8380 = df[1277];
+    df[1276] = t8379+t8380;
+    df[1275] = df[1276];
+    const real t8381 = df[2900];
+    df[1274] = t8381+t8380;
+    df[1273] = df[1274];
+    df[1272] = t8377+t8381+t8376+t8380;
+    df[1271] = df[1272];
+    df[1270] = t7854+t7853+t8381+t8380;
+    df[1269] = t7855+t7858+t8381+t8380;
+    df[1268] = df[1270];
+    df[1267] = df[1269];
+    df[1266] = t8370*t309;
+    const real t8382 = df[1266];
+    df[1265] = t8195+t8382;
+    df[1264] = t8120+t8382;
+    df[1263] = t8406+t8382;
+    df[1262] = df[1263];
+    df[1261] = df[1262];
+    df[1260] = df[1261];
+    df[1259] = df[1260];
+    df[1258] = df[1259];
+    const real t8384 = t8370*t77;
+    df[1256] = t8375+t8384;
+    df[1255] = df[1256];
+    df[1254] = t7857+t7856+t8375+t8384;
+    df[1253] = t7852+t7868+t8375+t8384;
+    df[1252] = df[1253];
+    df[1251] = df[1254];
+    df[1250] = t8370*t179;
+    const real t8385 = df[2899];
+    const real t8386 = df[1250];
+    df[1249] = t7859+t7860+t8385+t8386;
+    df[1248] = t8385+t8386;
+    df[1247] = df[1248];
+    df[1246] = df[1247];
+    df[1245] = df[1246];
+    df[1244] = df[1245];
+    df[1243] = df[1244];
+    df[1242] = df[1243];
+    df[1241] = df[1242];
+    df[1240] = df[1249];
+    df[1239] = df[1240];
+    df[1238] = df[1239];
+    df[1237] = df[1238];
+    df[1236] = t8370*t143;
+    const real t8387 = df[1236];
+    df[1235] = t7814+t8387;
+    df[1234] = t8412+t8387;
+    df[1233] = df[1234];
+    df[1232] = t8382+t8387;
+    df[1231] = df[1232];
+    df[1230] = t8120+t7814+t8195+t7874+t8406+t8412+t8382+t8387;
+    df[1229] = df[1233];
+    df[1228] = df[1229];
+    df[1227] = df[1228];
+    df[1226] = df[1227];
+    df[1225] = df[1231];
+    df[1224] = df[1232];
+    df[1222] = df[1224];
+    df[1221] = df[1222];
+    df[1220] = t8406+t8412+t8382+t8387;
+    df[1219] = df[1220];
+    df[1218] = df[1219];
+    df[1217] = df[1218];
+    df[1216] = df[1230];
+    df[1215] = df[1216];
+    df[1214] = df[1216];
+    df[1213] = df[1214];
+    df[1212] = t8370*t475;
+    const real t8390 = df[1212];
+    df[1211] = t7954+t8390;
+    df[1210] = df[1211];
+    df[1209] = df[1210];
+    df[1208] = df[1209];
+    df[1207] = t8406+t8390;
+    df[1206] = df[1208];
+    df[1205] = df[1206];
+    df[1203] = t8112+t7874+t8406+t8390;
+    df[1202] = t8112+t8390;
+    df[1201] = t8370*t139;
+    const real t8392 = df[1201];
+    df[1200] = t7963+t8392;
+    df[1199] = t8370*t146;
+    const real t8393 = df[1199];
+    df[1198] = t7964+t8393;
+    df[1197] = df[1198];
+    df[1196] = df[1197];
+    df[1195] = t7961+t7964+t8378+t8393;
+    df[1194] = df[1195];
+    df[1193] = t7878+t7879+t7961+t7964+t8378+t8393;
+    df[1192] = t7881+t7883+t7961+t7964+t8378+t8393;
+    df[1191] = df[1192];
+    df[1190] = df[1193];
+    df[1189] = t8372;
+    const real t8708 = t8705;
+    const real t8394 = t8708*t73;
+    const real t8395 = df[1189];
+    const real t8396 = t8395*t67;
+    df[1188] = t8394+t8396;
+    const real t8398 = t8708*t72;
+    df[1187] = t8398+t8396;
+    df[1186] = df[1187];
+    df[1185] = df[1188];
+    df[1183] = t8370*t212;
+    const real t8400 = df[1183];
+    df[1182] = t7965+t8400;
+    df[1181] = df[1182];
+    df[1180] = df[1181];
+    df[1179] = df[1180];
+    df[1178] = df[1179];
+    df[1177] = t8370*t275;
+    const real t8401 = df[2941];
+    const real t8402 = df[1177];
+    df[1176] = t7870+t7869+t8401+t8402;
+    df[1175] = t8401+t8402;
+    df[1174] = df[1175];
+    df[1173] = df[1174];
+    df[1172] = df[1173];
+    df[1171] = df[1172];
+    df[1170] = df[1171];
+    df[1169] = df[1170];
+    df[1168] = df[1169];
+    df[1167] = df[1176];
+    df[1166] = df[1167];
+    df[1165] = df[1166];
+    df[1164] = df[1165];
+    df[1163] = df[1294];
+    const real t8709 = df[1163];
+    const real t8404 = t8709*t50;
+    df[1162] = t8398+t8404;
+    df[1161] = t8394+t8404;
+    df[1160] = df[1161];
+    df[1159] = df[1162];
+    const real t8710 = df[3167];
+    df[1157] = t8710*t37+t8709*t37;
+    df[1156] = df[1157];
+    df[1155] = t8370*t215;
+    const real t8408 = df[1155];
+    df[1154] = t8415+t8408;
+    df[1153] = df[1154];
+    df[1152] = t8196+t7872+t8400+t8408;
+    df[1151] = t7870+t7869+t8400+t8408;
+    df[1150] = t7812+t7813+t7850+t7851+t8415+t7965+t8400+t8408;
+    df[1149] = df[1153];
+    df[1148] = df[1149];
+    df[1147] = df[1148];
+    df[1146] = df[1147];
+    df[1145] = t8400+t8408;
+    df[1144] = df[1145];
+    df[1142] = df[1145];
+    df[1141] = df[1142];
+    df[1140] = t8415+t7965+t8400+t8408;
+    df[1139] = df[1140];
+    df[1138] = df[1139];
+    df[1137] = df[1138];
+    df[1136] = df[1150];
+    df[1135] = df[1136];
+    df[1134] = df[1135];
+    df[1133] = df[1134];
+    const real t8410 = t8710;
+    const real t8411 = t8410*t50;
+    const real t8413 = t8709*t72;
+    df[1131] = t8411+t8413;
+    const real t8414 = t8410*t67;
+    df[1130] = t8414+t8413;
+    df[1129] = df[1130];
+    df[1128] = df[1131];
+    const real t8416 = t8709*t73;
+    df[1126] = t8394+t8398+t8413+t8416;
+    df[1125] = df[1126];
+    df[1124] = t8414+t8416;
+    df[1123] = t8411+t8416;
+    df[1122] = df[1124];
+    df[1121] = df[1123];
+    df[1120] = t8370*t145;
+    const real t8417 = df[1120];
+    df[1119] = t7962+t8417;
+    df[1118] = df[1119];
+    df[1117] = t7854+t7855+t7853+t7858+t8378+t8392+t8393+t8417;
+    df[1116] = t7857+t7852+t7856+t7868+t8378+t8392+t8393+t8417;
+    df[1115] = df[1117];
+    df[1114] = df[1116];
+    df[1113] = t7961+t7962+t7963+t7964+t8378+t8392+t8393+t8417;
+    df[1112] = df[1113];
+    df[1111] = t7962+t7963+t8392+t8417;
+    df[1110] = df[1111];
+    df[1109] = t7881+t7883+t7962+t7963+t8392+t8417;
+    df[1108] = t7878+t7879+t7962+t7963+t8392+t8417;
+    df[1107] = df[1108];
+    df[1106] = df[1109];
+    df[1105] = t8370*t254;
+    const real t8418 = df[1105];
+    df[1104] = t8401+t8418;
+    const real t8419 = df[2940];
+    df[1103] = t8196+t7872+t8419+t8418;
+    df[1102] = t8419+t8418;
+    df[1101] = df[1102];
+    df[1100] = df[1101];
+    df[1099] = df[1100];
+    df[1098] = df[1099];
+    df[1097] = df[1098];
+    df[1096] = df[1097];
+    df[1095] = df[1096];
+    df[1094] = df[1103];
+    df[1093] = df[1094];
+    df[1092] = df[1093];
+    df[1091] = df[1092];
+    const real t8421 = t8709*t26;
+    df[1089] = t8374+t8421;
+    df[1088] = df[1089];
+    df[1087] = t8371+t8421;
+    df[1086] = t8370*t240;
+    const real t8422 = df[1086];
+    df[1085] = t7849+t8422;
+    df[1084] = t8120+t7849+t8412+t8422;
+    df[1083] = t8390+t8422;
+    df[1082] = t8105+t8195+t8412+t8422;
+    df[1081] = t8105+t8112+t7849+t7864+t8403+t7954+t8390+t8422;
+    df[1080] = df[1081];
+    df[1079] = df[1080];
+    df[1078] = df[1080];
+    df[1077] = df[1078];
+    df[1076] = t8403+t7954+t8390+t8422;
+    df[1075] = t8403+t8422;
+    df[1074] = df[1083];
+    df[1072] = df[1075];
+    df[1071] = df[1072];
+    df[1070] = df[1071];
+    df[1069] = df[1070];
+    df[1068] = df[1076];
+    df[1067] = df[1068];
+    df[1066] = df[1067];
+    df[1065] = df[1069];
+    df[1064] = df[1083];
+    df[1063] = df[1064];
+    df[1062] = df[1063];
+    df[1061] = df[1062];
+    df[1060] = t8370*t132;
+    const real t8424 = df[1060];
+    df[1059] = t8381+t8424;
+    df[1058] = t8379+t8424;
+    df[1057] = df[1058];
+    df[1056] = t8379+t8375+t8384+t8424;
+    df[1055] = df[1056];
+    df[1054] = t7852+t7868+t8379+t8424;
+    df[1053] = t7857+t7856+t8379+t8424;
+    df[1052] = df[1053];
+    df[1051] = df[1054];
+    df[1050] = t2341*t212;
+    const real t8425 = df[1050];
+    df[1049] = t7971+t8425;
+    df[1048] = t8254+t7902+t8706+t8425;
+    df[1047] = t7900+t7899+t8706+t8425;
+    df[1046] = t7836+t7837+t7904+t7905+t7971+t7972+t8706+t8425;
+    df[1045] = df[1049];
+    df[1044] = df[1045];
+    df[1043] = df[1044];
+    df[1042] = df[1043];
+    df[1041] = t8706+t8425;
+    df[1040] = df[1041];
+    df[1039] = df[1041];
+    df[1038] = df[1039];
+    df[1037] = t7971+t7972+t8706+t8425;
+    df[1036] = df[1037];
+    df[1035] = df[1036];
+    df[1034] = df[1035];
+    df[1033] = df[1046];
+    df[1032] = df[1033];
+    df[1031] = df[1032];
+    df[1030] = df[1031];
+    const real t8428 = t8691*t50;
+    df[1028] = t8304+t8428;
+    df[1027] = t8301+t8428;
+    df[1026] = df[1027];
+    df[1025] = df[1028];
+    const real t8429 = t8220*t20;
+    const real t8431 = t8691*t20;
+    df[1023] = t8429+t8431;
+    const real t8432 = t8220*t26;
+    df[1022] = t8432+t8431;
+    df[1021] = t2341*t146;
+    const real t8433 = df[1021];
+    df[1020] = t8012+t8433;
+    df[1019] = df[1020];
+    df[1018] = df[1019];
+    df[1017] = t7908+t7841+t7844+t7911+t8364+t8368+t8369+t8433;
+    df[1016] = t7910+t7843+t7842+t7909+t8364+t8368+t8369+t8433;
+    df[1015] = df[1017];
+    df[1014] = df[1016];
+    df[1013] = t8011+t8012+t8013+t8014+t8364+t8368+t8369+t8433;
+    df[1012] = df[1013];
+    df[1011] = t8011+t8012+t8368+t8433;
+    df[1010] = df[1011];
+    df[1009] = t7891+t7892+t8011+t8012+t8368+t8433;
+    df[1008] = t7893+t7895+t8011+t8012+t8368+t8433;
+    df[1007] = df[1008];
+    df[1006] = df[1009];
+    df[1005] = t2341*t136;
+    const real t8434 = df[2872];
+    const real t8435 = df[1005];
+    df[1004] = t8434+t8435;
+    df[1003] = df[1004];
+    const real t8436 = df[2761];
+    df[1002] = t8436+t8435;
+    df[1001] = df[1002];
+    df[1000] = t7908+t7911+t8436+t8435;
+    df[999] = t7841+t7844+t8436+t8435;
+    df[998] = df[999];
+    df[997] = df[1000];
+    const real t8438 = t8691*t26;
+    df[995] = t8432+t8438;
+    df[994] = t8429+t8438;
+    df[993] = df[995];
+    const real t8440 = t8691*t72;
+    df[991] = t8301+t8304+t8355+t8440;
+    df[990] = df[991];
+    df[989] = t8356+t8440;
+    df[988] = t8353+t8440;
+    df[987] = df[989];
+    df[986] = df[988];
+    df[985] = t2341*t132;
+    const real t8441 = df[985];
+    df[984] = t8436+t8441;
+    df[983] = t8434+t8441;
+    df[982] = df[983];
+    df[981] = t7910+t7909+t8434+t8441;
+    df[980] = t7843+t7842+t8434+t8441;
+    df[979] = df[980];
+    df[978] = df[981];
+    df[977] = t3116+t3120+t2404+t2341;
+    df[976] = t2341*t2404;
+    const real t8442 = df[976];
+    df[975] = t8442*t146;
+    df[974] = t8442*t143;
+    const real t8720 = df[974];
+    df[973] = t7817+t8720;
+    df[971] = t7816*t37+t8442*t37;
+    df[970] = df[971];
+    df[969] = t8442*t475;
+    df[968] = df[969];
+    const real t8446 = df[968];
+    df[967] = t7822+t8446;
+    df[966] = df[967];
+    const real t8447 = t7816*t50;
+    const real t8448 = t8442*t72;
+    df[965] = t8447+t8448;
+    const real t8449 = t7816*t67;
+    df[964] = t8449+t8448;
+    df[963] = df[964];
+    df[962] = df[965];
+    const real t8450 = t7816*t73;
+    const real t8451 = t8442*t67;
+    df[961] = t8450+t8451;
+    const real t8452 = t7816*t72;
+    df[960] = t8452+t8451;
+    df[959] = df[960];
+    df[958] = df[961];
+    df[957] = t8442*t212;
+    df[956] = t8442*t132;
+    df[955] = t8442*t145;
+    df[954] = t8442*t254;
+    df[953] = t8442*t240;
+    const real t8453 = df[953];
+    df[952] = t8446+t8453;
+    df[951] = df[952];
+    df[950] = df[951];
+    df[949] = df[950];
+    df[948] = df[949];
+    df[947] = df[948];
+    df[946] = t8720+t8453;
+    df[945] = df[946];
+    df[944] = df[945];
+    df[943] = df[944];
+    df[942] = t8128+t8453;
+    df[940] = df[942];
+    df[939] = t8133+t8453;
+    df[938] = df[946];
+    df[937] = df[938];
+    const real t8455 = t8442*t50;
+    df[936] = t8452+t8455;
+    df[935] = t8450+t8455;
+    df[934] = df[935];
+    df[933] = df[936];
+    const real t8456 = t7816*t26;
+    const real t8457 = t8442*t26;
+    df[932] = t8456+t8457;
+    const real t8458 = t7816*t20;
+    df[931] = t8458+t8457;
+    df[930] = df[932];
+    const real t8460 = t8442*t20;
+    df[928] = t8458+t8460;
+    df[927] = t8456+t8460;
+    df[926] = t8442*t139;
+    const real t8461 = df[955];
+    const real t8462 = df[926];
+    df[925] = t8461+t8462;
+    df[924] = df[925];
+    df[923] = t7830+t7831+t8461+t8462;
+    df[922] = t7828+t7829+t8461+t8462;
+    df[921] = df[922];
+    df[920] = df[923];
+    df[919] = t8442*t179;
+    const real t8463 = df[3361];
+    const real t8464 = df[919];
+    df[918] = t8463+t8464;
+    df[917] = df[918];
+    df[916] = df[917];
+    df[915] = df[916];
+    df[914] = df[915];
+    const real t8465 = t8442*t73;
+    df[913] = t8450+t8452+t8448+t8465;
+    df[912] = df[913];
+    df[911] = t8449+t8465;
+    df[910] = t8447+t8465;
+    df[909] = df[910];
+    df[908] = df[911];
+    df[907] = t8442*t215;
+    const real t8466 = df[957];
+    const real t8467 = df[907];
+    df[906] = t8140+t7832+t8466+t8467;
+    df[905] = df[906];
+    df[904] = t7826+t7827+t8466+t8467;
+    df[903] = t8466+t8467;
+    df[902] = df[903];
+    df[900] = df[903];
+    df[899] = df[900];
+    df[898] = df[899];
+    df[897] = df[898];
+    df[896] = df[897];
+    df[895] = df[896];
+    df[894] = df[904];
+    df[893] = df[894];
+    df[892] = df[893];
+    df[891] = df[892];
+    df[890] = t8442*t155;
+    const real t8469 = df[975];
+    const real t8470 = df[890];
+    df[889] = t7820+t7821+t7834+t7835+t8469+t8461+t8462+t8470;
+    df[888] = df[889];
+    df[887] = df[888];
+    df[886] = df[887];
+    df[885] = t8469+t8461+t8462+t8470;
+    df[884] = df[885];
+    df[883] = t8469+t8470;
+    df[882] = df[883];
+    df[881] = t7828+t7829+t8469+t8470;
+    df[880] = t7830+t7831+t8469+t8470;
+    df[879] = df[880];
+    df[878] = df[881];
+    df[877] = t8442*t309;
+    const real t8471 = df[877];
+    df[876] = t8133+t8471;
+    df[875] = t8128+t8471;
+    df[874] = t8446+t8471;
+    df[873] = df[874];
+    df[872] = t8720+t8471;
+    df[871] = df[872];
+    df[870] = t8128+t8133+t7817+t7822+t8720+t8446+t8453+t8471;
+    df[869] = df[873];
+    df[868] = df[869];
+    df[867] = df[868];
+    df[866] = df[873];
+    df[865] = df[871];
+    df[863] = df[872];
+    df[862] = df[863];
+    df[861] = df[862];
+    df[860] = t8720+t8446+t8453+t8471;
+    df[859] = df[860];
+    df[858] = df[859];
+    df[857] = df[858];
+    df[856] = df[870];
+    df[855] = df[856];
+    df[854] = df[855];
+    df[853] = df[855];
+    df[852] = t7816+t8442;
+    df[851] = t8442*t275;
+    const real t8474 = df[954];
+    const real t8475 = df[851];
+    df[850] = t8140+t7832+t8474+t8475;
+    df[849] = t8474+t8475;
+    df[848] = df[849];
+    df[847] = df[848];
+    df[846] = df[847];
+    df[845] = df[846];
+    df[844] = df[845];
+    df[843] = df[844];
+    df[842] = df[843];
+    df[841] = df[850];
+    df[840] = df[841];
+    df[839] = df[840];
+    df[838] = df[839];
+    df[837] = t8442*t136;
+    const real t8476 = df[956];
+    const real t8477 = df[837];
+    df[836] = t8476+t8477;
+    df[835] = df[836];
+    df[834] = t7834+t7835+t8476+t8477;
+    df[833] = t7820+t7821+t8476+t8477;
+    df[832] = df[833];
+    df[831] = df[834];
+    df[830] = t8442*t126;
+    const real t8478 = t8442*t77;
+    const real t8479 = df[830];
+    df[829] = t8478+t8479;
+    df[828] = df[829];
+    df[827] = t8476+t8478+t8477+t8479;
+    df[826] = df[827];
+    df[825] = t7820+t7821+t8478+t8479;
+    df[824] = t7834+t7835+t8478+t8479;
+    df[823] = df[825];
+    df[822] = df[824];
+    df[821] = t2341*t309;
+    const real t8480 = df[821];
+    df[820] = t7886+t8480;
+    df[819] = t8146+t8480;
+    df[818] = t8430+t8480;
+    df[817] = df[818];
+    df[816] = t8367+t8480;
+    df[815] = df[816];
+    df[814] = t8145+t8146+t7846+t7886+t7970+t8430+t8367+t8480;
+    df[813] = df[817];
+    df[812] = df[813];
+    df[811] = df[812];
+    df[810] = df[817];
+    df[809] = df[815];
+    df[807] = df[816];
+    df[806] = df[807];
+    df[805] = df[806];
+    df[804] = t7970+t8430+t8367+t8480;
+    df[803] = df[804];
+    df[802] = df[803];
+    df[801] = df[802];
+    df[800] = df[814];
+    df[799] = df[800];
+    df[798] = df[799];
+    df[797] = df[798];
+    df[796] = t2341*t126;
+    const real t8483 = df[2850];
+    const real t8484 = df[796];
+    df[795] = t8483+t8484;
+    const real t8485 = t2404*t77;
+    df[794] = t8485+t8484;
+    df[793] = df[794];
+    df[792] = t8485+t8436+t8435+t8484;
+    df[791] = df[792];
+    df[790] = t7841+t7844+t8485+t8484;
+    df[789] = t7908+t7911+t8485+t8484;
+    df[788] = df[789];
+    df[787] = df[790];
+    const real t8486 = t2341*t77;
+    df[786] = t8483+t8486;
+    df[785] = df[786];
+    df[784] = t8434+t8483+t8486+t8441;
+    df[783] = df[784];
+    df[782] = t7843+t7842+t8483+t8486;
+    df[781] = t7910+t7909+t8483+t8486;
+    df[780] = df[781];
+    df[779] = df[782];
+    df[777] = t275*t275;
+    const real t8487 = df[777];
+    df[776] = t8061+t8487;
+    df[775] = df[776];
+    df[774] = df[775];
+    df[773] = df[774];
+    df[772] = df[773];
+    df[771] = df[772];
+    df[770] = df[771];
+    df[769] = df[770];
+    df[768] = t275*t179;
+    const real t8488 = df[2679];
+    const real t8489 = df[768];
+    df[767] = t8488+t8489;
+    df[766] = df[767];
+    df[765] = df[766];
+    df[764] = df[765];
+    df[763] = df[764];
+    df[762] = df[763];
+    df[761] = df[762];
+    df[760] = df[761];
+    df[759] = t275*t155;
+    const real t8490 = df[2678];
+    const real t8491 = df[759];
+    df[758] = t8490+t8491;
+    df[757] = df[758];
+    df[756] = df[757];
+    df[755] = df[756];
+    df[754] = t275*t146;
+    const real t8492 = df[2677];
+    const real t8493 = df[754];
+    df[753] = t8492+t8493;
+    df[752] = df[753];
+    df[751] = df[752];
+    df[750] = t8490+t8492+t8491+t8493;
+    df[749] = df[750];
+    df[748] = t275*t145;
+    const real t8494 = df[2676];
+    const real t8495 = df[748];
+    df[747] = t8494+t8495;
+    df[746] = df[747];
+    df[745] = t275*t139;
+    const real t8496 = df[2675];
+    const real t8497 = df[745];
+    df[744] = t8496+t8497;
+    df[743] = t8490+t8492+t8494+t8496+t8491+t8493+t8495+t8497;
+    df[742] = df[743];
+    df[741] = t8494+t8496+t8495+t8497;
+    df[740] = df[741];
+    df[739] = t275*t136;
+    const real t8498 = df[2674];
+    const real t8499 = df[739];
+    df[738] = t8498+t8499;
+    df[737] = df[738];
+    const real t8500 = df[2673];
+    df[736] = t8500+t8499;
+    df[735] = df[736];
+    df[734] = t275*t132;
+    const real t8501 = df[734];
+    df[733] = t8500+t8501;
+    df[732] = t8498+t8501;
+    df[731] = df[732];
+    df[730] = t275*t126;
+    const real t8502 = df[2672];
+    const real t8503 = df[730];
+    df[729] = t8502+t8503;
+    const real t8504 = t254*t77;
+    df[728] = t8504+t8503;
+    df[727] = df[728];
+    df[726] = t8504+t8500+t8499+t8503;
+    df[725] = df[726];
+    const real t8505 = t275*t77;
+    df[724] = t8502+t8505;
+    df[723] = df[724];
+    df[722] = t8498+t8502+t8505+t8501;
+    df[721] = df[722];
+    df[720] = t254+t275;
+    df[719] = df[720];
+    df[718] = df[719];
+    df[717] = df[718];
+    df[716] = df[717];
+    df[715] = df[716];
+    df[714] = df[715];
+    const real t8506 = t20+t26;
+    df[713] = t8506*t26;
+    df[712] = t8506*t37+t26*t20;
+    df[710] = t215*t215;
+    const real t8509 = df[3491];
+    const real t8510 = df[710];
+    df[709] = t8509+t8061+t8487+t8510;
+    df[708] = t8509+t8510;
+    df[707] = df[708];
+    df[705] = df[708];
+    df[704] = df[705];
+    df[703] = df[704];
+    df[702] = df[703];
+    df[701] = df[702];
+    df[700] = df[701];
+    df[699] = df[709];
+    df[698] = df[699];
+    df[697] = df[698];
+    df[696] = df[697];
+    df[695] = t215*t212;
+    const real t8512 = df[695];
+    df[694] = t8510+t8512;
+    df[693] = t8062+t8512;
+    df[692] = df[693];
+    df[691] = df[692];
+    df[690] = df[691];
+    df[689] = df[690];
+    df[688] = t215*t254;
+    const real t8513 = df[688];
+    df[687] = t8509+t7807+t8510+t8513;
+    df[686] = t7807+t8512+t8513;
+    df[685] = t7807+t8513;
+    df[684] = df[685];
+    df[683] = df[684];
+    df[682] = df[683];
+    df[681] = t215*t275;
+    const real t8514 = df[681];
+    df[680] = t8509+t7808+t8510+t8514;
+    df[679] = t7807+t7808+t8513+t8514;
+    df[678] = t8513+t8514;
+    df[677] = df[678];
+    df[676] = df[677];
+    df[675] = df[676];
+    df[674] = t7808+t8514;
+    df[673] = df[674];
+    df[672] = df[673];
+    df[671] = df[672];
+    df[670] = df[679];
+    df[669] = df[670];
+    df[668] = df[669];
+    df[667] = df[668];
+    df[666] = df[667];
+    df[665] = df[666];
+    df[664] = df[665];
+    df[663] = df[664];
+    df[662] = t215*t179;
+    const real t8515 = df[3484];
+    const real t8516 = df[662];
+    df[661] = t8515+t8488+t8489+t8516;
+    df[660] = t8515+t8516;
+    df[659] = df[660];
+    df[658] = df[659];
+    df[657] = df[658];
+    df[656] = df[657];
+    df[655] = df[656];
+    df[654] = df[655];
+    df[653] = df[654];
+    df[652] = df[661];
+    df[651] = df[652];
+    df[650] = df[651];
+    df[649] = df[650];
+    df[648] = t215*t155;
+    const real t8517 = df[3483];
+    const real t8518 = df[648];
+    df[647] = t8517+t8518;
+    df[646] = df[647];
+    const real t8519 = df[3482];
+    df[645] = t8519+t8518;
+    df[644] = df[645];
+    df[643] = t8519+t8498+t8501+t8518;
+    df[642] = t8519+t8502+t8505+t8518;
+    df[641] = df[642];
+    df[640] = df[643];
+    df[639] = t215*t146;
+    const real t8520 = df[639];
+    df[638] = t8519+t8520;
+    df[637] = t8517+t8520;
+    df[636] = df[637];
+    df[635] = t8517+t8500+t8499+t8520;
+    df[634] = t8517+t8504+t8503+t8520;
+    df[633] = df[634];
+    df[632] = df[635];
+    df[631] = t215*t145;
+    const real t8521 = df[3481];
+    const real t8522 = df[631];
+    df[630] = t8521+t8522;
+    const real t8523 = df[3480];
+    df[629] = t8519+t8523+t8490+t8492+t8494+t8496+t8518+t8522;
+    df[628] = t8519+t8523+t8491+t8493+t8495+t8497+t8518+t8522;
+    df[627] = df[629];
+    df[626] = df[628];
+    df[625] = t8519+t8523+t8518+t8522;
+    df[624] = df[625];
+    df[623] = t8523+t8522;
+    df[622] = df[623];
+    df[621] = t8523+t8502+t8505+t8522;
+    df[620] = t8523+t8498+t8501+t8522;
+    df[619] = df[620];
+    df[618] = df[621];
+    df[617] = t215*t139;
+    const real t8524 = df[617];
+    df[616] = t8517+t8521+t8491+t8493+t8495+t8497+t8520+t8524;
+    df[615] = t8517+t8521+t8490+t8492+t8494+t8496+t8520+t8524;
+    df[614] = df[616];
+    df[613] = df[615];
+    df[612] = t8517+t8521+t8520+t8524;
+    df[611] = df[612];
+    df[610] = t8521+t8524;
+    df[609] = df[610];
+    df[608] = t8521+t8504+t8503+t8524;
+    df[607] = t8521+t8500+t8499+t8524;
+    df[606] = df[607];
+    df[605] = df[608];
+    df[604] = t212+t215;
+    const real t8727 = df[604];
+    df[603] = t8727*t136;
+    df[601] = t8727*t132;
+    const real t8527 = df[603];
+    const real t8528 = df[601];
+    df[600] = t8527+t8528;
+    df[599] = df[600];
+    df[598] = t8490+t8492+t8491+t8493+t8527+t8528;
+    df[597] = t8494+t8496+t8495+t8497+t8527+t8528;
+    df[596] = df[598];
+    df[595] = df[597];
+    df[592] = t8727*t126;
+    const real t8530 = df[592];
+    const real t8532 = t8727*t77;
+    df[590] = t8530+t8532;
+    df[589] = df[590];
+    df[588] = t8527+t8528+t8530+t8532;
+    df[587] = df[588];
+    df[586] = t8494+t8496+t8495+t8497+t8530+t8532;
+    df[585] = t8490+t8492+t8491+t8493+t8530+t8532;
+    df[584] = df[586];
+    df[583] = df[585];
+    const real t8533 = df[715]*t67;
+    const real t8535 = t8727*t73;
+    df[581] = t8533+t8535;
+    const real t8536 = df[714]*t50;
+    df[580] = t8536+t8535;
+    df[579] = df[580];
+    df[578] = df[581];
+    const real t8537 = df[717]*t73;
+    const real t8538 = df[716]*t72;
+    const real t8540 = t8727*t72;
+    df[576] = t8537+t8538+t8535+t8540;
+    df[575] = df[576];
+    df[574] = t8536+t8540;
+    df[573] = t8533+t8540;
+    df[572] = df[574];
+    df[571] = df[573];
+    const real t8542 = t8727*t67;
+    df[569] = t8537+t8542;
+    df[568] = t8538+t8542;
+    df[567] = df[568];
+    df[566] = df[569];
+    const real t8544 = t8727*t50;
+    df[564] = t8538+t8544;
+    df[563] = t8537+t8544;
+    df[562] = df[563];
+    df[561] = df[564];
+    const real t8738 = df[714];
+    df[559] = t8738*t37+t8727*t37;
+    df[558] = df[559];
+    const real t8739 = t8738;
+    const real t8548 = t8739*t26;
+    const real t8550 = t8727*t26;
+    df[556] = t8548+t8550;
+    df[555] = df[556];
+    const real t8552 = t8739*t20;
+    df[554] = t8552+t8550;
+    const real t8554 = t8727*t20;
+    df[552] = t8552+t8554;
+    df[551] = t8548+t8554;
+    df[550] = t212+t254+t215+t275;
+    df[548] = t179*t179;
+    df[547] = t179*t155;
+    df[546] = t179*t146;
+    const real t8555 = df[547];
+    const real t8556 = df[546];
+    df[545] = t8555+t8556;
+    df[544] = df[545];
+    df[543] = t179*t145;
+    df[542] = t179*t139;
+    const real t8557 = df[543];
+    const real t8558 = df[542];
+    df[541] = t8555+t8556+t8557+t8558;
+    df[540] = df[541];
+    df[539] = df[540];
+    df[538] = df[539];
+    df[537] = df[538];
+    df[536] = df[537];
+    df[535] = t8557+t8558;
+    df[534] = df[535];
+    df[533] = t179*t136;
+    df[532] = t179*t132;
+    const real t8559 = df[533];
+    const real t8560 = df[532];
+    df[531] = t8559+t8560;
+    df[530] = df[531];
+    df[529] = t8555+t8556+t8559+t8560;
+    df[528] = t8557+t8558+t8559+t8560;
+    df[527] = df[529];
+    df[526] = df[528];
+    df[525] = t179*t126;
+    const real t8561 = t179*t77;
+    const real t8562 = df[525];
+    df[524] = t8561+t8562;
+    df[523] = df[524];
+    df[522] = t8561+t8559+t8560+t8562;
+    df[521] = df[522];
+    df[520] = t8561+t8557+t8558+t8562;
+    df[519] = t8561+t8555+t8556+t8562;
+    df[518] = df[519];
+    df[517] = df[520];
+    df[516] = t179*t7912;
+    df[515] = df[516];
+    df[514] = t179*t7913;
+    df[513] = t179*t7798;
+    df[512] = df[513];
+    df[511] = df[514];
+    df[510] = t179*t7921;
+    df[509] = t179*t7784;
+    df[508] = df[509];
+    df[507] = df[510];
+    df[506] = t179*t8506;
+    df[504] = t155*t155;
+    const real t8563 = df[504];
+    df[503] = t7944+t7950+t8018+t8563;
+    df[502] = df[503];
+    df[501] = t7944+t8563;
+    df[500] = df[501];
+    df[499] = t8039+t7944+t8040+t8563;
+    df[498] = df[499];
+    df[497] = t155*t146;
+    const real t8564 = df[497];
+    df[496] = t8563+t8564;
+    df[495] = t7951+t8564;
+    df[494] = df[495];
+    df[493] = df[494];
+    df[492] = df[493];
+    df[491] = t8041+t8564;
+    df[490] = df[491];
+    df[489] = t155*t145;
+    const real t8565 = df[489];
+    df[488] = t8563+t8565;
+    df[487] = t7945+t8564+t8565;
+    df[486] = t7946+t8565;
+    df[485] = df[486];
+    df[484] = df[485];
+    df[483] = df[484];
+    df[482] = df[483];
+    df[481] = df[482];
+    df[480] = t155*t139;
+    const real t8566 = df[480];
+    df[479] = t8563+t8566;
+    df[478] = t7945+t8566;
+    df[477] = df[478];
+    df[476] = df[477];
+    df[475] = df[476];
+    df[474] = df[475];
+    df[473] = df[474];
+    df[472] = t146+t155;
+    const real t8741 = df[472];
+    df[471] = t8741*t136;
+    const real t8568 = df[471];
+    df[470] = t7944+t7950+t8018+t8021+t8563+t8568;
+    df[469] = t7951+t8021+t8564+t8568;
+    df[468] = t7946+t8021+t8565+t8568;
+    df[467] = t7945+t8021+t8566+t8568;
+    df[465] = t8741*t132;
+    const real t8570 = df[465];
+    df[464] = t7944+t7950+t8018+t8022+t8563+t8570;
+    df[463] = t7945+t8022+t8566+t8570;
+    df[462] = t7946+t8022+t8565+t8570;
+    df[461] = t8021+t8022+t8568+t8570;
+    df[460] = df[461];
+    df[459] = t8568+t8570;
+    df[458] = t8024+t8026+t8568+t8570;
+    df[457] = df[458];
+    df[456] = df[459];
+    df[454] = t8741*t126;
+    const real t8572 = df[454];
+    df[453] = t7944+t7950+t8018+t8024+t8563+t8572;
+    df[452] = t7951+t8024+t8564+t8572;
+    const real t8574 = t8741*t77;
+    df[450] = t7944+t7950+t8018+t8026+t8563+t8574;
+    df[449] = t8024+t8026+t8572+t8574;
+    df[448] = df[449];
+    df[447] = t8568+t8570+t8572+t8574;
+    df[446] = df[447];
+    df[445] = t8021+t8022+t8572+t8574;
+    df[444] = df[445];
+    df[443] = t8572+t8574;
+    df[442] = df[443];
+    const real t8576 = t8741*t73;
+    df[440] = t8048+t8576;
+    df[439] = t8053+t8576;
+    df[438] = df[439];
+    df[437] = df[440];
+    const real t8578 = t8741*t72;
+    df[435] = t8051+t8578;
+    df[434] = t8050+t8578;
+    df[433] = df[434];
+    const real t8580 = t8741*t67;
+    df[431] = t8042+t8580;
+    df[430] = t8047+t8580;
+    df[429] = df[430];
+    const real t8582 = t8741*t50;
+    df[427] = t8044+t8582;
+    df[426] = df[427];
+    const real t8584 = t8741*t37;
+    df[424] = t8054+t8584;
+    const real t8586 = t8741*t26;
+    df[422] = t8060+t8586;
+    const real t8588 = t8545*t20;
+    const real t8590 = t8741*t20;
+    df[420] = t8588+t8590;
+    const real t8591 = t20*t20;
+    const real t8592 = t26*t26;
+    df[418] = t8591+t8592+t8506*t5;
+    df[416] = t309*t309;
+    const real t8753 = df[416];
+    df[415] = t8354+t8753;
+    df[414] = df[415];
+    df[413] = df[414];
+    df[411] = df[415];
+    df[410] = df[411];
+    df[409] = df[410];
+    df[408] = t309*t143;
+    const real t8754 = df[2977];
+    const real t8755 = df[408];
+    df[407] = t8754+t7941+t8753+t8755;
+    df[405] = t309*t215;
+    const real t8756 = df[405];
+    df[404] = t7937+t8756;
+    df[403] = df[404];
+    df[402] = df[403];
+    df[400] = df[404];
+    df[399] = df[400];
+    df[398] = t309*t212;
+    const real t8602 = df[398];
+    df[397] = t8339+t8602;
+    df[396] = df[397];
+    df[395] = df[396];
+    df[394] = df[397];
+    df[393] = df[394];
+    df[392] = t309*t254;
+    const real t8604 = df[392];
+    df[391] = t7926+t8604;
+    df[390] = df[391];
+    df[389] = df[390];
+    df[388] = df[389];
+    df[387] = df[388];
+    df[386] = t309*t275;
+    const real t8605 = df[386];
+    df[385] = t7931+t8605;
+    df[384] = df[385];
+    df[383] = df[384];
+    df[382] = df[383];
+    df[381] = df[382];
+    df[380] = t309*t179;
+    const real t8606 = df[380];
+    df[379] = t7933+t8606;
+    df[378] = df[379];
+    df[377] = df[378];
+    df[376] = df[377];
+    df[375] = t309*t155;
+    df[374] = t309*t146;
+    df[373] = t309*t145;
+    const real t8607 = df[375];
+    const real t8608 = df[373];
+    df[372] = t7935+t7929+t8607+t8608;
+    df[371] = df[372];
+    df[370] = t309*t139;
+    const real t8609 = df[374];
+    const real t8610 = df[370];
+    df[369] = t7942+t7939+t8609+t8610;
+    df[368] = df[369];
+    df[367] = t143+t309;
+    const real t8757 = df[367];
+    df[366] = t8757*t136;
+    df[363] = t8757*t132;
+    df[361] = t8757*t126;
+    df[358] = t136*t136;
+    const real t8614 = df[358];
+    df[357] = t8027+t8614;
+    df[356] = df[357];
+    df[355] = t8039+t8027+t8040+t8614;
+    df[354] = df[355];
+    df[353] = t7944+t8027+t8563+t8614;
+    df[352] = t7950+t8018+t8027+t8614;
+    df[351] = df[352];
+    df[350] = df[353];
+    df[349] = t136*t132;
+    const real t8615 = df[349];
+    df[348] = t8614+t8615;
+    df[347] = t8041+t8615;
+    df[346] = df[347];
+    df[345] = t8564+t8615;
+    df[344] = t7951+t8615;
+    df[343] = df[345];
+    df[342] = df[344];
+    df[341] = t136*t126;
+    const real t8616 = df[341];
+    df[340] = t8614+t8616;
+    df[339] = t8028+t8615+t8616;
+    df[338] = t8029+t8616;
+    df[337] = df[338];
+    df[336] = df[337];
+    df[335] = df[336];
+    df[334] = t7946+t8029+t8565+t8616;
+    df[333] = df[334];
+    df[332] = df[333];
+    df[331] = df[332];
+    const real t8617 = t136*t77;
+    df[330] = t8617+t8614;
+    df[329] = t8028+t8617;
+    df[328] = df[329];
+    df[327] = df[328];
+    df[326] = df[327];
+    df[325] = t7945+t8028+t8566+t8617;
+    df[324] = df[325];
+    df[323] = df[324];
+    df[322] = df[323];
+    df[321] = t132+t136;
+    const real t8760 = df[321];
+    const real t8619 = t8760*t73;
+    df[320] = t8044+t8619;
+    df[319] = t8047+t8576+t8578+t8619;
+    df[318] = t8048+t8051+t8047+t8619;
+    df[317] = t8580+t8619;
+    df[316] = t8045+t8619;
+    df[315] = df[316];
+    df[314] = df[317];
+    const real t8621 = t8760*t72;
+    df[312] = t8048+t8051+t8044+t8621;
+    df[311] = t8044+t8576+t8578+t8621;
+    df[310] = t8582+t8621;
+    df[309] = t8042+t8621;
+    df[308] = df[310];
+    df[307] = df[309];
+    const real t8623 = t8760*t67;
+    df[305] = t8050+t8623;
+    df[304] = t8051+t8623;
+    df[303] = t8576+t8623;
+    df[302] = df[303];
+    df[301] = df[305];
+    df[300] = df[304];
+    const real t8625 = t8760*t50;
+    df[298] = t8053+t8625;
+    df[297] = t8048+t8625;
+    df[296] = t8578+t8625;
+    df[295] = df[297];
+    df[294] = df[296];
+    const real t8627 = t8760*t37;
+    df[292] = t8584+t8627;
+    df[291] = t8056+t8627;
+    df[290] = t8054+t8056+t8584+t8627;
+    const real t8628 = t8534*t26;
+    const real t8630 = t8760*t26;
+    df[288] = t8628+t8630;
+    df[287] = t8590+t8630;
+    df[286] = t8628+t8060+t8586+t8630;
+    const real t8632 = t8760*t20;
+    df[284] = t8058+t8632;
+    df[283] = t8628+t8588+t8586+t8632;
+    df[282] = t146+t132+t155+t136;
+    df[280] = t475*t155;
+    const real t8633 = df[280];
+    df[279] = t8607+t8633;
+    df[278] = t7942+t7943+t8607+t8633;
+    df[277] = df[279];
+    df[276] = df[278];
+    df[275] = t7935+t7936+t8607+t8633;
+    df[274] = df[275];
+    df[273] = t475*t275;
+    const real t8634 = df[273];
+    df[272] = t7927+t8634;
+    df[271] = t8604+t8634;
+    df[270] = df[271];
+    df[269] = df[270];
+    df[268] = df[269];
+    df[267] = df[272];
+    df[266] = df[267];
+    df[265] = df[266];
+    df[264] = df[265];
+    df[263] = t7926+t7927+t8604+t8634;
+    df[262] = df[263];
+    df[261] = df[262];
+    df[260] = df[261];
+    df[259] = t475*t212;
+    const real t8635 = df[259];
+    df[258] = t8602+t8635;
+    df[257] = t7937+t8345+t8756+t8635;
+    df[256] = t8345+t8635;
+    df[255] = t8339+t7926+t7927+t8345+t8602+t8604+t8634+t8635;
+    df[254] = df[258];
+    df[253] = df[254];
+    df[252] = df[253];
+    df[251] = df[252];
+    df[250] = df[256];
+    df[249] = df[250];
+    df[248] = df[256];
+    df[247] = df[248];
+    df[246] = t8339+t8345+t8602+t8635;
+    df[245] = df[246];
+    df[244] = df[245];
+    df[243] = df[244];
+    df[242] = df[255];
+    df[241] = df[242];
+    df[240] = df[241];
+    df[239] = df[240];
+    df[238] = t475*t146;
+    const real t8637 = df[238];
+    df[237] = t8609+t8637;
+    df[236] = t7935+t7936+t8609+t8637;
+    df[235] = df[237];
+    df[234] = t7942+t7943+t8609+t8637;
+    df[233] = df[234];
+    df[232] = t475*t215;
+    const real t8638 = df[232];
+    df[231] = t8756+t8638;
+    df[230] = t8339+t8345+t8756+t8638;
+    df[229] = t7938+t8638;
+    df[228] = t8339+t7938+t8602+t8638;
+    df[227] = df[231];
+    df[226] = df[227];
+    df[225] = df[226];
+    df[224] = df[225];
+    df[223] = df[229];
+    df[222] = df[223];
+    df[220] = df[229];
+    df[219] = df[220];
+    df[218] = t7937+t7938+t8756+t8638;
+    df[217] = df[218];
+    df[216] = df[217];
+    df[215] = df[216];
+    df[214] = t475*t309;
+    const real t8768 = df[214];
+    df[213] = t8754+t8768;
+    df[212] = df[213];
+    df[211] = df[212];
+    df[209] = df[213];
+    df[208] = df[209];
+    df[207] = df[208];
+    df[206] = df[207];
+    df[205] = df[206];
+    df[204] = df[205];
+    df[203] = df[204];
+    df[202] = t475*t475;
+    const real t8643 = df[202];
+    df[201] = t7941+t8643;
+    df[200] = df[201];
+    df[199] = df[200];
+    df[198] = df[199];
+    df[197] = df[198];
+    df[196] = t8753+t8643;
+    df[195] = df[196];
+    df[194] = t8354+t7941+t8753+t8643;
+    df[193] = df[195];
+    df[192] = df[193];
+    df[191] = df[192];
+    df[189] = df[196];
+    df[188] = df[194];
+    df[187] = df[188];
+    df[186] = df[187];
+    df[185] = df[186];
+    df[184] = df[185];
+    df[183] = t8768+t8643;
+    df[182] = df[184];
+    df[181] = df[182];
+    df[180] = df[181];
+    df[179] = df[201];
+    df[178] = t240+t475;
+    const real t8769 = df[178];
+    df[177] = t8769*t136;
+    const real t8646 = df[366];
+    const real t8647 = df[177];
+    df[176] = t8646+t8647;
+    df[175] = df[176];
+    const real t8648 = df[363];
+    df[174] = t8648+t8647;
+    df[173] = df[174];
+    df[172] = t7935+t7936+t8607+t8648+t8633+t8647;
+    df[171] = df[172];
+    df[170] = t475+t240+t143+t309;
+    df[169] = t475*t145;
+    const real t8649 = df[169];
+    df[168] = t8608+t8649;
+    df[167] = t7939+t7940+t8608+t8649;
+    df[166] = t7930+t7936+t8633+t8649;
+    df[165] = t7942+t7939+t7930+t7936+t8609+t8610+t8633+t8649;
+    df[164] = df[166];
+    df[163] = df[165];
+    df[162] = t7935+t7929+t7930+t7936+t8607+t8608+t8633+t8649;
+    df[161] = df[162];
+    df[160] = t7929+t7930+t8608+t8649;
+    df[159] = df[160];
+    df[158] = t7929+t7930+t8608+t8648+t8647+t8649;
+    df[157] = df[158];
+    df[156] = df[170];
+    const real t8770 = df[156];
+    const real t8650 = t8770*t73;
+    const real t8652 = t8770*t72;
+    df[155] = t8650+t8652;
+    df[154] = df[155];
+    df[152] = t8769*t132;
+    const real t8654 = df[152];
+    df[151] = t8648+t8654;
+    df[150] = t8646+t8654;
+    df[149] = df[150];
+    df[148] = t7942+t7943+t8609+t8646+t8637+t8654;
+    df[147] = df[148];
+    df[145] = t8769*t126;
+    const real t8656 = df[361];
+    const real t8657 = df[145];
+    df[144] = t8656+t8657;
+    const real t8659 = t8757*t77;
+    df[143] = t8659+t8657;
+    df[142] = df[143];
+    df[141] = t8648+t8659+t8647+t8657;
+    df[140] = df[141];
+    df[139] = t7929+t7930+t8608+t8659+t8649+t8657;
+    df[138] = t7935+t7936+t8607+t8659+t8633+t8657;
+    df[137] = df[138];
+    df[136] = df[139];
+    const real t8661 = t8770*t67;
+    df[133] = t8650+t8661;
+    df[132] = t8652+t8661;
+    df[131] = df[132];
+    df[130] = df[133];
+    df[129] = t475*t254;
+    const real t8662 = df[129];
+    df[128] = t7932+t8662;
+    df[127] = t7926+t7932+t8604+t8662;
+    df[126] = t7937+t7931+t7932+t7938+t8756+t8605+t8638+t8662;
+    df[125] = t8605+t8662;
+    df[124] = df[125];
+    df[123] = df[124];
+    df[122] = df[123];
+    df[121] = df[128];
+    df[120] = df[121];
+    df[119] = df[120];
+    df[118] = df[119];
+    df[117] = t7931+t7932+t8605+t8662;
+    df[116] = df[117];
+    df[115] = df[116];
+    df[114] = df[115];
+    df[113] = df[126];
+    df[112] = df[113];
+    df[111] = df[112];
+    df[110] = df[111];
+    df[109] = t475*t179;
+    const real t8663 = df[109];
+    df[108] = t7933+t7934+t8606+t8663;
+    df[107] = t8606+t8663;
+    df[106] = df[107];
+    df[105] = df[106];
+    df[104] = df[105];
+    df[103] = t7934+t8663;
+    df[102] = df[103];
+    df[101] = df[102];
+    df[100] = df[101];
+    df[99] = df[108];
+    df[98] = df[99];
+    df[97] = df[98];
+    df[96] = df[97];
+    df[95] = df[96];
+    df[94] = df[95];
+    df[93] = df[94];
+    df[92] = df[93];
+    df[91] = t475*t143;
+    const real t8664 = df[91];
+    df[90] = t8643+t8664;
+    df[89] = t8358+t8664;
+    df[88] = df[89];
+    df[87] = df[88];
+    df[86] = df[87];
+    df[85] = df[86];
+    df[84] = df[85];
+    df[83] = df[84];
+    df[82] = df[83];
+    df[81] = df[82];
+    df[80] = df[81];
+    df[79] = df[89];
+    df[77] = df[79];
+    df[76] = df[77];
+    df[75] = df[76];
+    df[74] = df[75];
+    df[73] = df[74];
+    df[72] = df[73];
+    df[71] = df[72];
+    df[70] = df[71];
+    df[69] = df[70];
+    df[68] = df[69];
+    const real t8668 = t8770*t50;
+    df[66] = t8652+t8668;
+    df[65] = t8650+t8668;
+    df[64] = df[65];
+    df[63] = df[66];
+    df[62] = t475*t240;
+    const real t8669 = df[62];
+    df[61] = t8643+t8669;
+    df[60] = t8755+t8669;
+    df[59] = df[60];
+    df[58] = t8754+t8755+t8768+t8669;
+    df[57] = df[59];
+    df[56] = df[57];
+    df[54] = df[60];
+    df[53] = df[54];
+    df[52] = t8358+t8768+t8669;
+    df[51] = df[54];
+    df[50] = df[51];
+    df[49] = df[50];
+    df[48] = df[49];
+    df[47] = df[58];
+    df[46] = df[47];
+    df[45] = df[46];
+    df[44] = df[45];
+    df[42] = t475*t139;
+    const real t8672 = df[42];
+    df[41] = t8610+t8672;
+    df[40] = t7935+t7929+t7940+t7943+t8607+t8608+t8637+t8672;
+    df[39] = t7940+t7943+t8637+t8672;
+    df[38] = df[40];
+    df[37] = df[39];
+    df[36] = t7942+t7939+t7940+t7943+t8609+t8610+t8637+t8672;
+    df[35] = df[36];
+    df[34] = t7939+t7940+t8610+t8672;
+    df[33] = df[34];
+    df[32] = t7939+t7940+t8610+t8646+t8654+t8672;
+    df[31] = df[32];
+    df[28] = t8770*t26+t8770*t20;
+    const real t8677 = t8769*t77;
+    df[25] = t8656+t8677;
+    df[24] = df[25];
+    df[23] = t8646+t8656+t8654+t8677;
+    df[22] = df[23];
+    df[21] = t7939+t7940+t8610+t8656+t8672+t8677;
+    df[20] = t7942+t7943+t8609+t8656+t8637+t8677;
+    df[19] = df[20];
+    df[18] = df[21];
+    const real t8678 = t67*t67;
+    df[17] = t8032+t8678;
+    df[16] = t8031+t8678;
+    df[15] = df[16];
+    df[14] = df[17];
+    df[13] = (t50+t67)*t67;
+    df[12] = t73*t72+t67*t50;
+    df[11] = df[12];
+    df[10] = df[11];
+    df[9] = df[10];
+    const real t8682 = t67*t37;
+    df[8] = t7924+t8682;
+    df[7] = t8033+t8682;
+    df[6] = t8033+t7924+t7925+t8682;
+    const real t8683 = t67*t26;
+    df[5] = t8038+t8683;
+    const real t8684 = t72*t20;
+    df[4] = t8034+t8037+t8684+t8683;
+    df[3] = t8034+t8035+t8038+t8683;
+    const real t8685 = t67*t20;
+    df[2] = t8684+t8685;
+    df[1] = t8035+t8685;
+    const real t8718 = t257+t468+t311+t8282*t2758+t8217*t3334+df[2851]*t1497+df[2927]*
+t2303+t8326*t2815+t8305*t2449+t7952*t5291+t7816*t6046;
+    const real t8801 = df[1799];
+    const real t8733 = t7809*t6116+df[2022]*t3481+t7739*t6790+t8160*t3883+t7705*t6937+
+t7967*t5188+t8801*t3199+t7803*t6455+t7661*t7081+t7641*t7223+t8370*t1997+df
+[2321]*t4215;
+    const real t8814 = df[1721];
+    const real t8823 = df[966];
+    const real t8826 = df[2216];
+    const real t8751 = t7847*t5580+df[1677]*t2490+t8814*t2720+df[2662]*t3461+t8066*t4723+
+df[1202]*t2039+t7776*t6335+t8095*t4168+t8823*t1610+t8442*t1721+t8826*t4007;
+    const real t8765 = df[2578]*t4327+t8086*t4513+t7615*t7294+t8643*t325+t7984*t2755+t7976
+*t5060+t7493*t6619+t2404*t5159+t2341*t2937+t3120*t5703+t3116*t5786+t4135*t3982;
+    const real t8786 = t2341*t2884+t3116*t6159+t475*t134+t5387+t5477+t5525+df[2581]*t4215+
+t8043*t3201+t8370*t1837+t7616*t4226+t7615*t7302+t8430*t1495+df[2869]*t1497+
+t8305*t2552+t8690*t3009+df[3172]*t2033+df[1352]*t2490;
+    const real t8805 = t7803*t6444;
+    const real t8871 = df[2137];
+    const real t8806 = t8086*t4520+t8095*t4331+t8390*t2256+t7952*t5287+t7941*t325+t7816*
+t6069+t7809*t6146+t7999*t4470+t8172*t4005+t7822*t1757+t8871*t3199+t8286*t2815+
+t7976*t5027+t7739*t6681+df[2818]*t2718+t7705*t6880+t8805;
+    const real t8831 = t8275*t3197+df[1529]*t2785+t8443*t2755+t7967*t5215+t7742*t4018+df
+[2648]*t3461+t8067*t3524+t8066*t4707+t8238*t3600+df[940]*t1610+t8282*t2764+df
+[2315]*t4204+t7641*t7188+df[61]*t141+df[4058]*t3486+t7661*t7077+t8446*t1608;
+    const real t8904 = df[2279];
+    const real t8918 = df[1591];
+    const real t8856 = t8442*t1695+t8904*t4007+t8160*t3906+df[2917]*t2303+t8406*t2351+
+t8052*t6455+t7776*t6422+df[1951]*t3481+t8217*t3147+df[3303]*t2515+t8918*t2720+
+df[1085]*t2039+t7847*t5663+df[2459]*t4327+t7493*t6588+t2404*t5314+t4135*t4049+
+t3120*t5681;
+    const real t8881 = t4135*t4759+t710+t7967*t5213+t7781*t6455+t8445*t2815+df[2937]*t2039
++t7952*t5294+t8172*t4018+t8904*t4012+df[2292]*t4007+t8160*t3913+t7742*t4005+
+t8153*t4226+df[2449]*t4215+t7816*t6054+t8112*t2256+t7809*t6135+t649+df[2967]*
+t186+t7739*t6792;
+    const real t8914 = t8305*t2415+t8918*t2891+df[1681]*t2515+df[1484]*t2720+df[1719]*
+t2718+df[3902]*t4204+t7661*t7027+t7662*t3600+t7641*t7116+df[820]*t1497+df[876]*
+t1610;
+    const real t8943 = t7953*t3524+t7615*t7273+t8442*t1518+df[940]*t1761+t8052*t6446+t8753
+*t325+t7776*t6420+t8043*t3197+t8669*t118+df[183]*t141+df[2461]*t4222+t8095*
+t4317+df[2570]*t4327+t8086*t4409+t8583*t4470+t7822*t1608+df[2019]*t3486+t8871*
+t3195+t8148*t3009+df[1949]*t3477;
+    const real t8971 = df[2655]*t3481+t8066*t4710+df[2758]*t2490+t7976*t5033+t2404*t5111+
+t3116*t6163+t240*t5402+t2341*t2130+t475*t312+t7493*t7381+t3120*t5678;
+    const real t9000 = t475*t138+t3120*t5490+t4135*t4019+t3116*t6187+t7493*t7388+t2341*
+t2838+t309*t641+t240*t5389+t2404*t5318+df[2757]*t3009+t7739*t6706+t7992*t2815+
+t7976*t5038+df[2874]*t2490+df[1940]*t3461+t8049*t6455+t7776*t6432+t8442*t1743+
+df[2135]*t3199+df[2140]*t3201;
+    const real t9036 = t7803*t6446+t7641*t7210+df[2610]*t3197+df[875]*t1608+df[52]*t118+df
+[90]*t186+t7967*t5200+df[1264]*t2351+df[2379]*t4327+t8095*t4171+df[2448]*t4204;
+    const real t9075 = t8282*t2620+t8814*t2891+df[1738]*t2785+t7847*t5623+t8354*t325+df
+[2025]*t3477+t8370*t2031+df[1317]*t1497+t8801*t3195+df[2462]*t4470+df[1368]*
+t2515;
+    const real t9107 = df[1678]*t2480+df[1203]*t2037+df[1235]*t2303+t7705*t6914+df[1528]*
+t2787+df[1483]*t2718+t8305*t2432+t8333*t2755+t6019+t5735+t6047;
+    const real t9124 = t240*t5406+t309*t634+t143*t5730+t7493*t7391+t475*t322+t3116*t6174+
+t3120*t5485+t2404*t5312+t4135*t3996+t2341*t2852+t1081+df[3826]*t4321+df[2566]*
+t4323+df[2128]*t3234;
+    const real t9104 = df[2016];
+    const real t9111 = df[1679];
+    const real t9140 = t8198*t3839+df[2372]*t4325+t8135*t4406+t8754*t135+df[3005]*t440+df
+[1976]*t3457+t8217*t3136+t9104*t3475+df[3498]*t6459+df[2970]*t327+df[1648]*
+t2881+t8305*t2580+t9111*t2503+df[1228]*t2301+df[1260]*t2299;
+    const real t9121 = df[1934];
+    const real t9123 = df[1948];
+    const real t9130 = df[1205];
+    const real t9132 = df[2326];
+    const real t9157 = t8020*t3965+df[3744]*t4016+t7739*t6780+t8046*t3191+df[1476]*t2716+
+df[1501]*t2751+t9121*t3459+t9123*t3479+df[3953]*t3455+t7693*t3557+df[1148]*
+t2166+t8370*t1842+t9130*t2016+t9132*t4236+df[1069]*t2018;
+    const real t9134 = df[1361];
+    const real t9175 = t9134*t2505+df[3333]*t2499+df[3344]*t1489+df[3439]*t2297+df[3457]*
+t2035+t8196*t2080+t7809*t6118+t8212*t3765+df[3842]*t4229+t8095*t4177+df[1313]*
+t1491+df[1339]*t1973+df[3666]*t3203+df[3687]*t4020+t7974*t3677;
+    const real t9153 = df[3796];
+    const real t9162 = df[4072];
+    const real t9166 = df[1587];
+    const real t9159 = df[4081];
+    const real t9194 = t9153*t4207+t8160*t3668+df[2236]*t4046+df[2268]*t4044+df[3999]*
+t3507+t9159*t3488+t7661*t7019+t9162*t3453+df[1545]*t2792+df[56]*t128+t9166*
+t2712+t7899*t3146+df[3100]*t2497+t8467*t1675;
+    const real t9180 = df[3600];
+    const real t9187 = df[1751];
+    const real t9210 = t8442*t1522+df[943]*t1604+df[192]*t351+t8768*t133+df[225]*t244+
+t7967*t5209+t7952*t5302+df[86]*t181+t9180*t6457+t8089*t6510+t7776*t6424+df
+[3626]*t3205+t7976*t5076+df[1910]*t3421+t9187*t2749;
+    const real t9193 = df[1720];
+    const real t9201 = df[3135];
+    const real t9228 = df[1760]*t2597+t8282*t2820+t7869*t2214+t7847*t5584+t9193*t2710+df
+[1735]*t2799+df[3869]*t4605+df[3905]*t4319+t7705*t6921+t9201*t1487+df[3182]*
+t2295+t8510*t1295+df[868]*t1606+df[3228]*t2021+t7615*t7291;
+    const real t9209 = df[3391];
+    const real t9242 = t7641*t7191+df[1818]*t3236+df[812]*t1493+t8140*t1564+t9209*t1600+df
+[3420]*t1602+t7816*t6041+t8254*t2562+df[2585]*t4211+t8613*t4370+t8086*t4570+
+t8066*t4675+df[1693]*t2714+t1300+t1198;
+    const real t9259 = t2404*t5331+t475*t359+t143*t5725+t3116*t5783+t2341*t2176+t4135*
+t4776+t240*t5394+t7493*t6615+t215*t1195+t3120*t5476+t309*t629+t1075+t991+t996+
+t1001+t1008+t1014+t9162*t3455;
+    const real t9254 = df[3439];
+    const real t9279 = df[4081]*t3507+t7694*t3557+t7641*t7229+t7615*t7265+df[2969]*t351+
+t8754*t133+df[2981]*t244+df[3086]*t2560+df[1227]*t2299+df[1259]*t2301+t8466*
+t1675+t8136*t4406+df[2584]*t4236+t8140*t1780+df[3391]*t1602+df[3419]*t1600+
+t9254*t2295+df[1692]*t2716;
+    const real t9255 = t9193;
+    const real t9301 = df[1703]*t2881+t8282*t2670+t9255*t2712+df[3456]*t2021+t8467*t1673+
+t7900*t3146+df[3330]*t2497+t7832*t1564+t8370*t1848+df[1206]*t2018+df[230]*t242+
+df[252]*t440+t8198*t3837+t7967*t5179+t7952*t5253+df[3997]*t3488+t7661*t7024+
+t7976*t5030;
+    const real t9291 = df[943];
+    const real t9295 = df[3498];
+    const real t9324 = t8442*t1709+df[1544]*t2799+t9153*t4229+df[3825]*t4319+df[3841]*
+t4207+df[3868]*t4603+df[1653]*t2879+t9111*t2505+df[2235]*t4044+df[3343]*t1487+
+t9291*t1606+t7809*t6148+t8509*t1295+t9295*t6457+t7801*t6510+df[811]*t1491+df
+[867]*t1604+df[1312]*t1493+t7816*t5929;
+    const real t9297 = t9187;
+    const real t9325 = df[1739];
+    const real t9348 = df[2565]*t4325+t9297*t2751+t8138*t4370+df[2418]*t4404+t8095*t4173+
+df[1475]*t2714+df[1500]*t2749+t8046*t4763+t7902*t2562+df[2267]*t4046+df[85]*
+t181+df[3896]*t4605+df[3901]*t4321+t7705*t6930+df[3952]*t3453+df[3969]*t3555+
+t7690*t3677+t9325*t2792;
+    const real t9332 = df[2319];
+    const real t9343 = df[56];
+    const real t9370 = t9180*t6459+t8089*t6683+df[3625]*t3203+t7764*t3191+df[3663]*t3205+
+df[3684]*t4016+t7755*t3965+t7739*t6687+t8020*t4000+df[3743]*t4020+t7870*t2214+
+t8086*t4509+t9332*t4211+t8305*t2401+t9166*t2710+t9343*t128+t9104*t3479+df[2053]
+*t3421;
+    const real t9395 = df[1406]*t2597+t8211*t3765+t7776*t6337+t8197*t3839+t8160*t3716+df
+[1147]*t2164+df[694]*t1264+df[1179]*t2166+t8066*t4672+df[2371]*t4323+df[3207]*
+t2078+t9121*t3457+t9123*t3475+df[1975]*t3459+df[191]*t327+t8768*t135+df[1338]*
+t2470+t9134*t2503;
+    const real t9365 = t9201;
+    const real t9376 = df[3182];
+    const real t9409 = t8217*t3375+t8212*t3763+df[2127]*t3236+df[1065]*t2016+df[3098]*
+t2499+t9365*t1489+t9376*t2297+t7872*t2080+t7847*t5582+df[3227]*t2035+df[1909]*
+t3419+df[1817]*t3234+df[1043]*t1973+t1025+t1034+t1048+t1057+t6233+t6430;
+    const real t9389 = df[1801];
+    const real t9402 = df[3096];
+    const real t9431 = t2341*t2564+t3120*t5645+t240*t5501+t475*t246+t3116*t6098+t212*t6419
++t143*t6032+t7493*t6779+t4135*t4766+t2404*t5078+t215*t1236+t309*t668+df[3284]*
+t2166+t8282*t3096+t9389*t3203+df[3063]*t1973+t9402*t2505;
+    const real t9406 = df[2919];
+    const real t9408 = df[1531];
+    const real t9415 = df[1473];
+    const real t9417 = df[1498];
+    const real t9424 = df[2933];
+    const real t9433 = df[222];
+    const real t9455 = df[1914]*t3417+df[2867]*t1969+df[1411]*t2595+t7719*t4370+t7967*
+t5288+t9415*t2712+t9417*t2751+df[2906]*t2160+t9406*t2295+t9408*t2792+t9424*
+t2021+t7705*t7189+t8401*t2214+df[1574]*t2881+df[119]*t244+t7809*t6314+t9433*
+t396;
+    const real t9423 = df[3505];
+    const real t9432 = df[3403];
+    const real t9435 = df[211];
+    const real t9442 = df[3289];
+    const real t9445 = df[3298];
+    const real t9457 = df[3729];
+    const real t9459 = df[2754];
+    const real t9477 = t9435*t128+df[198]*t351+df[257]*t394+t8086*t4692+t9423*t6459+t9442*
+t2016+t7847*t5978+t9445*t1493+df[2532]*t4605+t7827*t1675+t7816*t6182+t9432*
+t1606+t8095*t4607+df[1048]*t1971+t7752*t3839+t9457*t4044+t9459*t2497;
+    const real t9446 = df[905]*t1670;
+    const real t9462 = df[1074];
+    const real t9469 = df[865];
+    const real t9471 = df[3675];
+    const real t9476 = df[2626];
+    const real t9481 = df[3590];
+    const real t9487 = df[2774];
+    const real t9498 = t9462*t2035+t7739*t6931+t8418*t2080+t7770*t3765+t9469*t1602+t9446+
+t9471*t3234+t8061*t1295+t8474*t1564+t9476*t3488+t8225*t3677+t8066*t4793+t9481*
+t6457+t7799*t6510+t8280*t3146+df[1152]*t2162+t9487*t2710+t8370*t2082;
+    const real t9465 = df[2816];
+    const real t9467 = df[3813];
+    const real t9472 = df[1357];
+    const real t9490 = df[2797];
+    const real t9493 = df[3789];
+    const real t9495 = df[1225];
+    const real t9497 = df[2808];
+    const real t9506 = df[2842];
+    const real t9510 = df[2852];
+    const real t9516 = df[3689];
+    const real t9520 = t9490*t2714+t9493*t4211+t9495*t2297+t9497*t2799+t9465*t2749+t9467*
+t4323+df[2834]*t2597+t7976*t5187+t9506*t2593+t9472*t2499+t9510*t1487+t8351*
+t2562+df[948]*t1600+t8442*t1783+t9516*t4046+df[2400]*t4367+df[2417]*t4401;
+    const real t9491 = df[2156]*t3834;
+    const real t9499 = df[2314];
+    const real t9503 = df[1961];
+    const real t9525 = df[2445];
+    const real t9527 = df[2457];
+    const real t9532 = df[2126];
+    const real t9535 = df[2217];
+    const real t9537 = df[2265];
+    const real t9543 = df[4109];
+    const real t9545 = df[3225];
+    const real t9548 = df[1930];
+    const real t9550 = df[3995];
+    const real t9553 = df[3131];
+    const real t9539 = t7718*t4406+t9525*t4229+t9527*t4319+t7615*t7668+t7641*t7521+t9532*
+t3205+t9491+t8178*t3965+t9535*t4016+t9537*t4020+t8160*t4003+t9543*t4325+t9545*
+t2018+t9499*t4207+t9548*t3455+t9550*t3479+t9503*t3507+t9553*t1491;
+    const real t9507 = df[3616];
+    const real t9512 = df[2646];
+    const real t9564 = df[809];
+    const real t9567 = df[413];
+    const real t9574 = df[395];
+    const real t9582 = df[3417];
+    const real t9561 = df[3141]*t2503+t9507*t3236+t8512*t1233+df[687]*t1225+t9512*t3453+
+t7776*t6708+t9564*t1489+t9567*t327+df[3531]*t6507+t8755*t135+t9574*t437+df[388]
+*t440+t8277*t3191+t8669*t133+t9582*t1604+df[84]*t181+df[2637]*t3415;
+    const real t9529 = df[4122];
+    const real t9538 = df[2111]*t3760;
+    const real t9540 = df[3179];
+    const real t9589 = df[3239];
+    const real t9592 = df[2369];
+    const real t9599 = df[4055];
+    const real t9607 = df[1596];
+    const real t9609 = df[1645];
+    const real t9612 = df[3950];
+    const real t9579 = t9589*t2301+t9529*t4236+t9592*t4321+t8217*t3559+t8247*t3557+df
+[4043]*t3457+t9599*t3475+t9538+t9540*t2299+t7952*t5390+df[3928]*t3421+t9607*
+t2716+t9609*t2967+t9612*t3459+t8305*t2883+t7661*t7319+t4935+t4864;
+    const real t9563 = t9564;
+    const real t9565 = t9582;
+    const real t9569 = t9469;
+    const real t9571 = df[3141];
+    const real t9602 = t309*t661+t475*t458+t254*t4926+t3120*t5637+t2404*t5212+t240*t5523+
+t3116*t6379+t212*t6417+t143*t6030+t215*t1227+t4135*t3193+t7493*t6771+t2341*
+t3148+t9563*t1487+t9565*t1606+t7816*t6206+t8475*t1564+t9569*t1600+t9571*t2505;
+    const real t9573 = t9567;
+    const real t9576 = t9553;
+    const real t9581 = t9589;
+    const real t9583 = t9545;
+    const real t9597 = t9435;
+    const real t9643 = df[402];
+    const real t9667 = df[249];
+    const real t9627 = t9573*t351+t8755*t133+t9576*t1493+t9643*t396+t9540*t2301+t9581*
+t2299+t9583*t2016+df[3273]*t2166+df[3289]*t2018+df[3283]*t2164+df[3300]*t1491+
+t8669*t135+df[127]*t242+df[3052]*t1973+df[179]*t327+df[228]*t394+t9597*t128+df
+[3062]*t2470+t9667*t437+df[265]*t440;
+    const real t9603 = t9402;
+    const real t9606 = t9497;
+    const real t9611 = t9525;
+    const real t9619 = t9476;
+    const real t9655 = t9603*t2503+df[382]*t244+t9606*t2792+t9465*t2751+df[2826]*t2881+
+t7720*t4370+t9611*t4207+df[2453]*t4321+df[2531]*t4603+df[2551]*t4605+t8095*
+t4626+t8086*t4639+t8277*t4763+t9619*t3507+df[2636]*t3417+t8248*t3557+t8066*
+t4814+df[2645]*t3455+df[2680]*t1264+df[2416]*t4401;
+    const real t9633 = t9481;
+    const real t9636 = t9510;
+    const real t9641 = t9543;
+    const real t9646 = t9424;
+    const real t9654 = t9459;
+    const real t9659 = t9490;
+    const real t9726 = df[2789];
+    const real t9679 = t8370*t2216+t9633*t6459+t8352*t2562+t9636*t1489+df[2866]*t1971+
+t7967*t5275+t9641*t4323+df[2905]*t2162+df[2919]*t2297+t9646*t2035+t8419*t2080+
+t7952*t5383+t7615*t7597+df[4120]*t4211+df[83]*t181+t9654*t2499+df[2774]*t2712+
+t9726*t2967+t9659*t2716+t7976*t5176;
+    const real t9664 = t9495;
+    const real t9670 = df[3509];
+    const real t9742 = df[3531];
+    const real t9707 = t8402*t2214+df[3613]*t3234+t9664*t2295+t9446+t7809*t6319+t8442*
+t1566+t8474*t1780+df[949]*t1602+t9670*t6457+t9742*t6507+df[1047]*t1969+t7800*
+t6510+t9462*t2021+t7847*t5970+df[686]*t1233+df[680]*t1225+t7826*t1675+t7641*
+t7546+t7827*t1673;
+    const real t9690 = t9537;
+    const real t9692 = df[4048];
+    const real t9694 = df[4051];
+    const real t9699 = t9592;
+    const real t9703 = t9550;
+    const real t9705 = t9532;
+    const real t9715 = t9417;
+    const real t9734 = t9432*t1604+t8487*t1295+t8179*t3965+t9690*t4016+t9692*t3459+t9694*
+t3479+t7661*t7474+df[2323]*t4229+t9699*t4319+df[2399]*t4367+t9703*t3475+t9705*
+t3203+t9491+df[2217]*t4020+t8178*t4000+df[4033]*t3421+t8160*t3967+df[1913]*
+t3415+t7739*t6997+t9715*t2749;
+    const real t9718 = t9607;
+    const real t9720 = t9493;
+    const real t9730 = t9516;
+    const real t9735 = t9415;
+    const real t9737 = t9457;
+    const real t9745 = t9548;
+    const real t9747 = df[1952];
+    const real t9795 = df[1403];
+    const real t9762 = df[1532]*t2799+t9718*t2714+t9720*t4236+df[1582]*t2879+t7799*t6683+
+t7771*t3765+t7770*t3763+t9472*t2497+df[1391]*t2560+t9730*t4044+t9795*t2593+
+t7752*t3837+t9735*t2710+t9737*t4046+df[1104]*t2078+t7776*t6528+df[1151]*t2160+
+df[3927]*t3419+t9745*t3453+t9747*t3488;
+    const real t9751 = t9612;
+    const real t9770 = t9471;
+    const real t9786 = df[1996]*t3555+t9751*t3457+t8226*t3677+t8217*t3679+t9538+t9467*
+t4325+t7730*t4406+t8305*t2990+df[1662]*t2597+df[1651]*t2595+t7705*t7131+t8282*
+t3055+df[3855]*t4404+t9389*t3205+t8278*t3191+t8281*t3146+t7751*t3839+t9770*
+t3236+t1420+t1319;
+    const real t9801 = t254*t4911+t309*t654+t143*t6028+t3116*t6074+t475*t214+t212*t6411+
+t7493*t7283+t275*t1403+t240*t5495+t4135*t4176+t3120*t5622;
+    const real t9805 = df[548];
+    const real t9815 = t2341*t2459+t2404*t5205+t215*t1200+t989+t955+t9805*t856+t7976*t5098
++df[2145]*t3473+t7641*t7544+t7816*t6134+df[1381]*t2249+df[2073]*t3258;
+    const real t9832 = df[1396]*t2306+t7705*t7236+t8217*t3706+t8066*t4845+df[242]*t293+df
+[2509]*t4264+df[2525]*t4284+t8095*t4575+df[1320]*t2204+t8086*t4659+df[1366]*
+t2217;
+    const real t9852 = df[1526]*t2377+t7661*t7437+df[2061]*t3198+t8370*t2333+df[2405]*
+t4145+df[1167]*t1825+df[188]*t253+t7739*t6952+df[1216]*t1876+t7847*t5926+df
+[1238]*t1883+df[113]*t102;
+    const real t9875 = df[1094]*t1794+df[97]*t101+df[2389]*t4134+df[2227]*t3806+df[800]*
+t1321+df[1136]*t1811+df[1080]*t1791+df[82]*t100+df[2360]*t4123+df[1788]*t2972+
+df[1811]*t3001;
+    const real t9878 = df[3565];
+    const real t9899 = df[2313];
+    const real t9896 = df[856]*t1351+t9878*t6315+df[2298]*t3918+df[894]*t1364+t7776*t6602+
+t8442*t1720+df[915]*t1396+df[1898]*t3071+t9899*t4088+df[1921]*t3072+df[699]*
+t1089+df[1986]*t3091;
+    const real t9916 = df[1033]*t1788+df[47]*t66+t8282*t3077+df[3524]*t6260+df[1769]*t2825
++df[841]*t1331+df[1568]*t2519+t7615*t7611+df[650]*t1013+t7967*t5269+df[1610]*
+t2520+df[668]*t1033;
+    const real t9936 = t7809*t6357+df[2197]*t3590+t8160*t3993+t7952*t5316+df[2209]*t3618+
+df[2100]*t3424+df[1464]*t2342+df[1493]*t2343+df[692]*t1046+t8305*t2931+df[3500]
+*t6240+df[1947]*t3090;
+    const real t9954 = t7493*t6802+t309*t648+t240*t5450+t275*t1389+t2404*t5407+t475*t466+
+t2341*t2421+t4135*t4740+t3120*t5608+t179*t963+t254*t4905+t215*t1173+t143*t6026+
+t3116*t6377;
+    const real t9957 = t8176*t3981;
+    const real t9960 = t8020*t3952;
+    const real t9948 = df[1752];
+    const real t9970 = t212*t6405+t711+df[3485]*t1215+t9957+t9948*t2736+df[3595]*t6464+
+t9960+t8442*t1642+t9255*t2695+df[1730]*t2919+df[1745]*t2871+df[1178]*t2152+
+t8066*t4861+t7641*t7515+df[3790]*t4219;
+    const real t9972 = t8102*t4569;
+    const real t9976 = t8046*t3178;
+    const real t9977 = t8101*t4567;
+    const real t9944 = df[1708];
+    const real t9952 = t9325*t2796;
+    const real t9965 = df[867];
+    const real t9987 = t9972+t7776*t6652+t9965*t1594+df[1665]*t2581+t9976+t9977+t8095*
+t4512+df[1172]*t2207+t9944*t2646+t8282*t3048+t7753*t3886+t7739*t7038+t8086*
+t4633+df[3742]*t4009+t9952;
+    const real t9991 = t7764*t3180;
+    const real t9992 = t8464*t1713;
+    const real t9995 = t7694*t3542;
+    const real t9996 = t7974*t3664;
+    const real t9997 = t7755*t3954;
+    const real t9959 = t9291;
+    const real t10004 = df[3715]*t3820+df[3662]*t3207+df[3683]*t4033+t9991+t9992+df[1712]*
+t2578+t9959*t1592+t9995+t9996+t9997+t7767*t3261+t8470*t1640+df[1684]*t2478+df
+[2534]*t4597+df[1691]*t2702;
+    const real t10008 = t8467*t1664;
+    const real t10013 = t8089*t6499;
+    const real t10015 = t7681*t3695;
+    const real t10016 = t7859*t2322;
+    const real t10019 = t9878*t6591;
+    const real t10020 = t7680*t3693;
+    const real t9975 = t9159;
+    const real t10021 = df[3640]*t3746+t10008+df[3624]*t3209+df[1702]*t2865+df[846]*t1557+
+df[1647]*t2867+t10013+t9975*t3500+t10015+t10016+df[1759]*t2585+t7868*t1996+
+t10019+t10020;
+    const real t10026 = t7907*t2446;
+    const real t9985 = df[2234];
+    const real t10012 = t9985*t4038;
+    const real t10038 = df[224]*t230+t7789*t6571+df[4062]*t3400+df[1278]*t2106+t10026+
+t10012+t7909*t1436+df[1258]*t2287+df[3851]*t4353+df[3867]*t4591+df[3010]*t422+
+df[1908]*t3409+df[3004]*t429+df[2994]*t234+df[2989]*t202;
+    const real t10041 = t8177*t3986;
+    const real t10045 = t8754*t137;
+    const real t10046 = t8613*t4359;
+    const real t10048 = t7801*t6501;
+    const real t10053 = t8768*t131;
+    const real t10043 = df[811];
+    const real t10055 = t8156*t3286+t10041+df[1245]*t2326+df[1226]*t2289+df[2202]*t3958+
+t10045+t10046+df[1146]*t2154+t10048+t8115*t4496+df[4068]*t3438+df[1617]*t2921+
+t7677*t3337+t10053+t10043*t1481;
+    const real t10056 = t8198*t3828;
+    const real t10057 = t8515*t1192;
+    const real t10063 = t7899*t3133;
+    const real t10064 = t8211*t3752;
+    const real t10067 = t7902*t2547;
+    const real t10023 = t9295*t6441;
+    const real t10031 = df[2963];
+    const real t10072 = t10056+t10057+t8517*t1120+df[3541]*t6493+t10023+df[3880]*t4263+
+t10063+t10064+df[1931]*t3447+t8370*t2384+t10067+df[3097]*t2476+df[3055]*t1954+
+df[3824]*t4306+t10031*t65;
+    const real t10082 = t8136*t4393;
+    const real t10090 = t8466*t1662;
+    const real t10040 = df[277];
+    const real t10091 = df[2968]*t341+df[2980]*t228+t7615*t7636+t9130*t2006+df[2583]*t4213
++t10082+t7952*t5376+t10040*t274+df[1816]*t3228+df[1793]*t3184+df[268]*t425+df
+[3808]*t4387+df[2564]*t4311+t10090;
+    const real t10095 = t8062*t1250;
+    const real t10101 = t8254*t2549;
+    const real t10103 = t8512*t1256;
+    const real t10104 = t7690*t3666;
+    const real t10105 = t8463*t1708;
+    const real t10065 = t9343*t120;
+    const real t10107 = df[251]*t431+df[1774]*t3139+df[3840]*t4201+t10095+df[2266]*t4040+
+df[1305]*t1922+df[1327]*t2452+df[1311]*t1479+t10065+t10101+df[3351]*t1957+
+t10103+t10104+t10105+df[2080]*t3699;
+    const real t10109 = t8212*t3754;
+    const real t10112 = t7832*t1553;
+    const real t10113 = t8140*t1551;
+    const real t10116 = t8197*t3826;
+    const real t10123 = t7869*t2201;
+    const real t10100 = df[1975];
+    const real t10124 = t10109+t8217*t3632+df[1499]*t2738+t10112+t10113+df[3382]*t1656+df
+[3392]*t1585+t10116+df[2558]*t4595+t8099*t4542+t7705*t7222+t10100*t3445+df
+[1345]*t2483+df[3184]*t2280+t10123;
+    const real t10125 = t8158*t4164;
+    const real t10137 = t7860*t2320;
+    const real t10094 = df[2020];
+    const real t10097 = t9132;
+    const real t10143 = t10125+df[1042]*t1963+t9365*t1472+t8170*t4074+df[3895]*t4589+t8563
+*t617+df[3904]*t4304+df[1337]*t1961+df[3889]*t4562+df[1948]*t3492+df[1386]*
+t2553+t10137+df[1405]*t2587+t10094*t3490+t10097*t4224;
+    const real t10153 = t9805*t976;
+    const real t10154 = t8159*t4169;
+    const real t10156 = t7872*t2065;
+    const real t10135 = df[1065];
+    const real t10161 = df[104]*t204+df[3276]*t2145+df[2066]*t3670+t7847*t5881+df[3226]*
+t2002+df[3930]*t3402+t10135*t2014+t10153+t10154+t8160*t4110+t10156+df[1991]*
+t3548+df[81]*t169+t8555*t908+t7967*t5267;
+    const real t10165 = t8138*t4361;
+    const real t10166 = t8510*t1289;
+    const real t10168 = t7906*t2448;
+    const real t10148 = df[2371];
+    const real t10177 = df[1577]*t2873+t8518*t1145+df[3996]*t3483+t10165+t10166+t10148*
+t4313+t10168+t7692*t3357+df[1474]*t2704+df[3332]*t2493+df[675]*t1213+df[1099]*
+t2071+t7834*t1516+df[3342]*t1474+df[2041]*t3310;
+    const real t10181 = t8516*t1194;
+    const real t10182 = t7693*t3544;
+    const real t10184 = t7900*t3135;
+    const real t10189 = t8196*t2067;
+    const real t10141 = df[3441];
+    const real t10195 = df[122]*t236+df[2052]*t3407+t10181+t10182+df[3951]*t3440+t10184+df
+[1589]*t2697+df[3447]*t2147+t10141*t2282+df[773]*t1281+t10189+df[2130]*t3226+df
+[3455]*t2000+df[755]*t1072+t7809*t6344;
+    const real t10200 = t8509*t1287;
+    const real t10201 = t8135*t4395;
+    const real t10209 = t7870*t2203;
+    const real t10158 = df[1521];
+    const real t10191 = df[191];
+    const real t10210 = t8305*t2779+df[764]*t1187+t7854*t2376+t7908*t1456+t10200+t10201+
+t7976*t5157+t10158*t2669+t7661*t7374+t10191*t344+df[1543]*t2794+df[3418]*t1587+
+t7816*t6234+t10209+t840;
+    const real t10231 = t475*t408+t309*t646+t7493*t7288+t212*t6401+t3116*t6383+t4135*t4189
++t254*t4903+t275*t1383+t240*t5489+t179*t957+t143*t6024+t215*t1160+t2341*t1924+
+t2404*t5303+t3120*t5598+t155*t829;
+    const real t10235 = t7899*t3135;
+    const real t10190 = t9965;
+    const real t10220 = df[1345];
+    const real t10193 = t10220*t2478;
+    const real t10194 = df[1436];
+    const real t10239 = t9957+t9992+t10019+t10041+t10095+t10103+t10105+t10125+t10153+
+t10154+t10190*t1592+t10193+t10235+t10194*t2646+t9123*t3490+df[3714]*t3820;
+    const real t10243 = t7902*t2549;
+    const real t10246 = t7755*t3952;
+    const real t10248 = t8102*t4567;
+    const real t10254 = t8197*t3828;
+    const real t10255 = t8509*t1289;
+    const real t10204 = df[276];
+    const real t10225 = df[2534];
+    const real t10232 = df[268];
+    const real t10238 = df[1712];
+    const real t10242 = df[1278];
+    const real t10257 = t10225*t4595+df[1792]*t3184+t10243+t7754*t3886+t10204*t272+t10246+
+df[845]*t1557+t10248+t10232*t422+df[3540]*t6493+df[1326]*t2452+t10238*t2581+df
+[1680]*t2483+t10254+t10255+t10242*t2104;
+    const real t10260 = t8196*t2065;
+    const real t10269 = t8254*t2547;
+    const real t10245 = df[3485];
+    const real t10249 = df[1665];
+    const real t10252 = df[3455];
+    const real t10256 = df[104];
+    const real t10263 = df[3447];
+    const real t10267 = df[3418];
+    const real t10272 = df[3055];
+    const real t10274 = df[1405];
+    const real t10277 = df[1931];
+    const real t10276 = t10245*t1213+t10249*t2578+t10260+t10252*t2002+t10256*t202+t7852*
+t1996+t8519*t1145+t10141*t2280+t10263*t2145+df[3850]*t4353+t10269+t10267*t1585+
+df[496]*t599+t10272*t1957+t10274*t2585+t10277*t3445;
+    const real t10283 = t8089*t6501;
+    const real t10236 = t9948;
+    const real t10251 = df[1727]*t2697;
+    const real t10280 = df[1337];
+    const real t10284 = df[251];
+    const real t10286 = df[1759];
+    const real t10290 = df[3595];
+    const real t10292 = df[1745];
+    const real t10300 = df[3624];
+    const real t10302 = df[1730];
+    const real t10296 = t10280*t1963+t9332*t4213+t10284*t429+t10286*t2587+t10283+t10236*
+t2738+t10290*t6441+t10292*t2873+df[2234]*t4040+df[1740]*t2794+t7790*t6571+t7776
+*t6628+t7789*t6575+t10300*t3207+t10251+t10302*t2921;
+    const real t10306 = t7694*t3544;
+    const real t10308 = t8140*t1553;
+    const real t10266 = df[2986];
+    const real t10304 = df[2127];
+    const real t10309 = df[1042];
+    const real t10312 = df[1018];
+    const real t10315 = df[3840];
+    const real t10321 = df[1258];
+    const real t10323 = df[2994];
+    const real t10325 = df[3332];
+    const real t10327 = df[2989];
+    const real t10333 = df[3824];
+    const real t10313 = t10304*t3228+t10309*t1961+t10312*t1922+t10315*t4219+t7834*t1520+
+t10321*t2289+t10323*t236+t10325*t2476+t10327*t204+t10306+t10266*t274+t10308+
+t10333*t4304+t7816*t6107+t9209*t1587+df[1244]*t2326;
+    const real t10318 = t7974*t3666;
+    const real t10319 = t8212*t3752;
+    const real t10320 = t7832*t1551;
+    const real t10338 = df[1647];
+    const real t10342 = df[2980];
+    const real t10348 = df[3683];
+    const real t10351 = df[675];
+    const real t10364 = df[755];
+    const real t10331 = t10338*t2865+t10342*t230+df[3381]*t1656+t10318+t10319+t10320+
+t10348*t4009+t10351*t1215+df[772]*t1281+df[1773]*t3139+df[763]*t1187+t8160*
+t4076+t7766*t3261+t7705*t7216+t8170*t4084+t10364*t1076;
+    const real t10339 = t7764*t3178;
+    const real t10341 = t8754*t131;
+    const real t10344 = t7906*t2446;
+    const real t10345 = t7900*t3133;
+    const real t10289 = df[235];
+    const real t10367 = df[3662];
+    const real t10373 = df[224];
+    const real t10375 = df[751];
+    const real t10378 = df[3010];
+    const real t10382 = df[1617];
+    const real t10384 = df[3351];
+    const real t10388 = df[3342];
+    const real t10350 = t10367*t3209+t10289*t65+t10373*t228+t10375*t1072+t10378*t425+t8555
+*t912+t8556*t908+t10339+t10382*t2919+t10341+t10384*t1954+t10388*t1472+t10344+
+t10345+t9975*t3483+t8217*t3589+t8066*t4847;
+    const real t10355 = t8211*t3754;
+    const real t10359 = t7907*t2448;
+    const real t10368 = t8768*t137;
+    const real t10305 = t10043;
+    const real t10310 = df[3035];
+    const real t10393 = df[2968];
+    const real t10395 = df[3930];
+    const real t10416 = df[1908];
+    const real t10418 = df[2266];
+    const real t10370 = t10393*t344+t10355+t10395*t3400+t10305*t1479+df[1098]*t2071+t10359
++t10310*t1454+df[80]*t169+t8157*t3286+df[1385]*t2553+t7911*t1456+t7835*t1516+
+t7615*t7674+t10416*t3407+t10368+t10418*t4038;
+    const real t10377 = t8510*t1287;
+    const real t10385 = t8516*t1192;
+    const real t10329 = t10135*t2006;
+    const real t10330 = t10191;
+    const real t10420 = df[122];
+    const real t10423 = df[3895];
+    const real t10428 = df[3004];
+    const real t10433 = df[1702];
+    const real t10439 = df[1311];
+    const real t10443 = df[1305];
+    const real t10387 = t10420*t234+t10423*t4591+t8171*t4074+t10428*t431+t10329+t10330*
+t341+t10377+t7767*t3259+t7976*t5141+t10433*t2867+t8282*t3035+df[3639]*t3746+
+t10439*t1481+df[2201]*t3958+t10385+t10443*t2418;
+    const real t10400 = t7859*t2320;
+    const real t10402 = t8198*t3826;
+    const real t10403 = t7870*t2201;
+    const real t10406 = t8515*t1194;
+    const real t10343 = df[1699];
+    const real t10353 = df[3510]*t6464;
+    const real t10354 = df[2484];
+    const real t10450 = df[1691];
+    const real t10452 = df[3880];
+    const real t10458 = df[3867];
+    const real t10460 = df[3904];
+    const real t10407 = t10065+t10343*t2669+df[3888]*t4562+t8370*t2248+t10450*t2704+t10452
+*t4261+t10353+t10354*t4494+t7910*t1436+t10400+t10458*t4589+t10402+t10403+t10460
+*t4306+t7809*t6308+t10406;
+    const real t10409 = t7801*t6499;
+    const real t10410 = t7860*t2322;
+    const real t10411 = t8466*t1664;
+    const real t10415 = t8138*t4359;
+    const real t10422 = t8046*t3180;
+    const real t10365 = df[1520];
+    const real t10369 = df[3213];
+    const real t10465 = df[3876];
+    const real t10467 = df[1577];
+    const real t10469 = df[1543];
+    const real t10475 = df[2052];
+    const real t10482 = df[1196];
+    const real t10493 = df[3226];
+    const real t10425 = t10465*t4263+t10409+t10410+t10411+t10467*t2871+t10469*t2796+t10365
+*t2667+t10415+t10475*t3409+t10369*t2374+t10482*t2106+t8156*t3284+t7675*t3337+
+t10493*t2000+t10422+t8097*t4496+t7952*t5336;
+    const real t10434 = t7680*t3695;
+    const real t10502 = df[1499];
+    const real t10505 = t10094*t3492;
+    const real t10507 = df[3996];
+    const real t10513 = df[1226];
+    const real t10517 = df[3276];
+    const real t10528 = df[4068];
+    const real t10530 = df[3790];
+    const real t10445 = t7753*t3884+t10502*t2736+t10505+t10507*t3500+t9130*t2014+df[2079]*
+t3699+t10434+df[3807]*t4387+t10513*t2287+t7673*t3357+t10517*t2147+t9166*t2695+
+t7847*t5955+df[2065]*t3670+t10528*t3440+t10530*t4201;
+    const real t10453 = t8135*t4393;
+    const real t10455 = t8020*t3954;
+    const real t10414 = df[3975];
+    const real t10532 = df[4062];
+    const real t10547 = df[2558];
+    const real t10551 = df[2564];
+    const real t10462 = t10532*t3402+t8442*t1841+t8469*t1640+t7944*t617+t7853*t2376+t7661*
+t7445+t8305*t2648+t10453+t7641*t7538+t10455+t7739*t6911+t10547*t4597+t10414*
+t3355+t10551*t4313+df[1990]*t3548+t8470*t1638;
+    const real t10464 = t7693*t3542;
+    const real t10474 = t7872*t2067;
+    const real t10476 = t7681*t3693;
+    const real t10479 = t8613*t4361;
+    const real t10426 = t10100;
+    const real t10560 = df[3097];
+    const real t10568 = df[3951];
+    const real t10570 = df[1146];
+    const real t10572 = df[1816];
+    const real t10576 = df[2041];
+    const real t10578 = df[1178];
+    const real t10480 = t10464+t8098*t4542+t8520*t1120+t10560*t2493+t8095*t4619+t10426*
+t3447+t10568*t3438+t10570*t2152+t10572*t3226+df[3183]*t2282+t10474+t10576*t3314
++t10476+t10578*t2154+t8086*t4701+t10479;
+    const real t10484 = t8467*t1662;
+    const real t10487 = t8136*t4395;
+    const real t10488 = t8101*t4569;
+    const real t10491 = t7690*t3664;
+    const real t10495 = t7869*t2203;
+    const real t10438 = df[646];
+    const real t10441 = t10148;
+    const real t10586 = df[3742];
+    const real t10591 = df[2012];
+    const real t10594 = df[1474];
+    const real t10597 = df[3132];
+    const real t10599 = df[2583];
+    const real t10497 = df[1171]*t2207+t9959*t1594+t10484+t10438*t1143+t10586*t4033+t10487
++t10488+t10441*t4311+t10591*t3310+t10491+t10594*t2702+t7967*t5282+t10597*t1474+
+t10495+t10599*t4224+t5375+t5446;
+    const real t10519 = t7493*t6439+t143*t6022+t309*t644+t2404*t5088+t2341*t2463+t3120*
+t6014+t215*t1147+t212*t6397+t275*t1376+t3116*t6285+t475*t308+t240*t5465+t155*
+t817+t146*t5441+t179*t950+t4135*t3288+t254*t4901+t9957;
+    const real t10520 = t9960+t9972+t9976+t9977+t9991+t9992+t9995+t9996+t9997+t10008+
+t10013+t10015+t10016+t10019+t10020+t10026+t10041+t10045;
+    const real t10522 = t10046+t10048+t10053+t10056+t10057+t10063+t10064+t10067+t10082+
+t10090+t10095+t10101+t10103+t10104+t10105+t10109+t10112+t10113;
+    const real t10523 = t10116+t10123+t10125+t10137+t10153+t10154+t10156+t10165+t10166+
+t10168+t10181+t10182+t10184+t10189+t10200+t10201+t10209+t5360;
+    const real t10471 = t10348;
+    const real t10473 = t10528;
+    const real t10477 = t10274;
+    const real t10483 = t10572;
+    const real t10489 = t10338;
+    const real t10492 = t10532;
+    const real t10494 = t10597;
+    const real t10499 = t10599;
+    const real t10503 = t10367;
+    const real t10632 = df[80]*t169;
+    const real t10544 = t5420+df[3539]*t6493+t10471*t4033+t10473*t3438+t10477*t2587+t10632
++t7806*t3261+t10023+t10483*t3228+df[1208]*t2006+t10489*t2867+t10492*t3400+
+t10494*t1472+t8470*t1636+t10499*t4213+df[1636]*t2669+t10503*t3207+t7677*t3333;
+    const real t10506 = t10382;
+    const real t10510 = t10256;
+    const real t10516 = t10560;
+    const real t10521 = t10252;
+    const real t10525 = t10551;
+    const real t10564 = t10506*t2921+df[1384]*t2553+t7854*t2372+t10510*t204+t7809*t6317+
+t7692*t3613+t8109*t4542+t8086*t4662+t10516*t2476+t7855*t2376+t10521*t2000+
+t10525*t4311+df[3638]*t3746+t7767*t3257+t7661*t7480+t8517*t1155+t10190*t1594+df
+[771]*t1281;
+    const real t10533 = t10304;
+    const real t10538 = t10482;
+    const real t10541 = t10300;
+    const real t10546 = t10280;
+    const real t10549 = t10467;
+    const real t10553 = t10378;
+    const real t10556 = t10315;
+    const real t10588 = t10533*t3226+t8521*t1120+t10426*t3445+t7976*t5180+t10538*t2245+df
+[1791]*t3184+t10541*t3209+t10220*t2483+df[1587]*t2697+t10546*t1961+t10441*t4313
++t10549*t2873+t9209*t1585+t8160*t4087+t10553*t422+df[2020]*t3490+t10556*t4201+
+t10330*t344;
+    const real t10559 = t10333;
+    const real t10561 = t10323;
+    const real t10563 = t10416;
+    const real t10566 = t10327;
+    const real t10574 = t10428;
+    const real t10579 = t10420;
+    const real t10608 = t10559*t4306+t10561*t234+t10563*t3409+t10566*t202+df[3806]*t4387+
+df[1097]*t2071+df[3380]*t1656+t9944*t2642+t7705*t7063+t8370*t2108+t10574*t429+
+t8282*t3020+df[1243]*t2326+t8522*t1145+t10579*t236+t7834*t1533+df[1679]*t2478+
+t8156*t4184;
+    const real t10584 = t9376;
+    const real t10587 = t10263;
+    const real t10592 = t10325;
+    const real t10601 = t10249;
+    const real t10603 = df[937];
+    const real t10631 = t10584*t2280+t8442*t1787+t10587*t2147+df[4085]*t3500+t10592*t2493+
+t8305*t2951+t7666*t3337+t7641*t7534+t8469*t1634+t7908*t1892+t7754*t3880+t8461*
+t1640+t10601*t2581+t10603*t1592+df[3713]*t3820+t7967*t5280+df[2200]*t3958+df
+[844]*t1557;
+    const real t10610 = df[1333];
+    const real t10613 = df[1962];
+    const real t10617 = t10547;
+    const real t10623 = t10290;
+    const real t10630 = t10439;
+    const real t10652 = t10610*t1922+t7952*t5345+t10613*t3492+t8095*t4498+t8099*t4615+
+t10617*t4595+df[2078]*t3699+t7842*t1436+t7816*t6259+df[1325]*t2452+t10623*t6464
++t7909*t1857+t10040*t319+df[762]*t1187+t7841*t1456+df[1772]*t3139+t10630*t1479+
+t7789*t6612;
+    const real t10634 = t10245;
+    const real t10637 = t10232;
+    const real t10640 = t10267;
+    const real t10642 = t10443;
+    const real t10644 = t10286;
+    const real t10646 = t10284;
+    const real t10648 = t10530;
+    const real t10650 = t10493;
+    const real t10658 = t10238;
+    const real t10660 = t9254;
+    const real t10662 = t10594;
+    const real t10664 = t10418;
+    const real t10673 = t10634*t1215+df[2064]*t3670+t10637*t425+t7790*t6610+t10640*t1587+
+t10642*t1918+t10644*t2585+t10646*t431+t10648*t4219+t10650*t2002+t8170*t4070+
+t8116*t4496+t8115*t4508+df[1072]*t2014+t10658*t2578+t10660*t2282+t10662*t2704+
+t10664*t4040;
+    const real t10669 = t10342;
+    const real t10671 = t10433;
+    const real t10675 = t10351;
+    const real t10679 = t10507;
+    const real t10684 = t10393;
+    const real t10686 = t10309;
+    const real t10691 = t10591;
+    const real t10693 = t10312;
+    const real t10695 = df[168]*t274+t7868*t1992+t10669*t228+t10671*t2865+t7835*t1531+
+t10675*t1213+t8066*t4772+t8518*t1169+t10679*t3483+t10305*t1481+df[2975]*t65+
+t10684*t341+t10686*t1963+t8169*t4074+t7753*t3882+t7739*t6973+t10691*t3586+
+t10693*t1920;
+    const real t10696 = t10450;
+    const real t10698 = df[1860];
+    const real t10700 = df[3766];
+    const real t10706 = t10384;
+    const real t10708 = t10586;
+    const real t10710 = t10513;
+    const real t10717 = t10388;
+    const real t10720 = t10696*t2702+t10698*t3310+t10700*t4263+t8564*t578+t8217*t3317+
+t7615*t7630+t8272*t3286+t10706*t1957+t10708*t4009+t10710*t2289+df[488]*t580+
+t10031*t282+df[1437]*t2644+t10717*t1474+df[1989]*t3548+t7744*t3886+df[2959]*
+t562+t10012;
+    const real t10731 = t10373;
+    const real t10734 = t10395;
+    const real t10737 = t10576;
+    const real t10739 = t10517;
+    const real t10744 = t10292;
+    const real t10746 = t10364;
+    const real t10748 = t10375;
+    const real t10752 = t10460;
+    const real t10754 = t10570;
+    const real t10743 = df[638]*t1157+df[1688]*t2646+t7950*t617+t8171*t4072+t10731*t230+df
+[1170]*t2207+t10734*t3402+t7847*t5948+t10737*t3584+t10739*t2145+t7766*t3255+
+t10236*t2736+t10744*t2871+t10746*t1088+t10748*t1090+df[4023]*t3335+t10752*t4304
++t10754*t2154;
+    const real t10756 = df[746];
+    const real t10758 = t10242;
+    const real t10760 = t10423;
+    const real t10767 = t10469;
+    const real t10770 = t10475;
+    const real t10774 = df[53]*t120;
+    const real t10775 = t10225;
+    const real t10782 = t10578;
+    const real t10785 = t10568;
+    const real t10766 = t10756*t1072+t10758*t2243+t10760*t4589+df[3887]*t4562+df[3266]*
+t1994+t8556*t925+t10767*t2794+df[2326]*t4224+t10770*t3407+t7793*t6571+t10774+
+t10775*t4597+t7776*t6578+df[236]*t284+df[2548]*t4506+t10782*t2152+t7667*t3357+
+t10785*t3440;
+    const real t10787 = t10272;
+    const real t10793 = t10452;
+    const real t10796 = t10465;
+    const real t10800 = t10321;
+    const real t10802 = t10458;
+    const real t10805 = t10302;
+    const real t10808 = df[1118];
+    const real t10810 = t10277;
+    const real t10817 = t10502;
+    const real t10789 = t10787*t1954+t8157*t4186+t8555*t923+t8557*t908+t10793*t4259+t7820*
+t1516+t10796*t4257+df[3029]*t1859+t9952+t10800*t2287+t10802*t4591+t7856*t1996+
+t10805*t2919+df[1720]*t2695+t10808*t2106+t10810*t3447+t10158*t2665+df[3849]*
+t4353+t10817*t2738;
+    const real t10812 = t7493*t6794+t155*t807+t275*t1372+t179*t946+t145*t5415+t3116*t6077+
+t2341*t2414+t240*t5508+t215*t1122+t254*t4899+t4135*t4880+t212*t6394+t146*t5438+
+t309*t640+t2404*t5217+t143*t6020+t3120*t6008+t475*t98+t4998;
+    const real t10813 = t5059+t9957+t9992+t10019+t10041+t10095+t10103+t10105+t10125+t10153
++t10154+t10235+t10243+t10246+t10248+t10254+t10255+t10260+t10269;
+    const real t10815 = t10283+t10306+t10308+t10318+t10319+t10320+t10339+t10341+t10344+
+t10345+t10355+t10359+t10368+t10377+t10385+t10400+t10402+t10403+t10406;
+    const real t10821 = t10409+t10410+t10411+t10415+t10422+t10434+t10453+t10455+t10464+
+t10474+t10476+t10479+t10484+t10487+t10488+t10491+t10495+t10353+t10796*t4259+
+t10546*t1963;
+    const real t10851 = t10691*t3584+t10601*t2578+t8305*t2851+t10494*t1474+t7806*t3259+df
+[810]*t1479+t10630*t1481+df[3805]*t4387+t7641*t7550+t10610*t2418+df[843]*t1557+
+df[1988]*t3548+t8217*t3312+t7669*t3357+df[4082]*t3483+df[3848]*t4353+t10817*
+t2736+t10503*t3209+t9985*t4040;
+    const real t10881 = t8272*t3284+t8558*t908+t10731*t228+t10471*t4009+t10679*t3500+df
+[2199]*t3958+t7952*t5343+df[2950]*t599+t10662*t2702+df[1169]*t2207+t8156*t4186+
+t10483*t3226+t10706*t1954+t7835*t1533+df[3637]*t3746+t7805*t3261+df[1324]*t2452
++df[1974]*t3447+df[761]*t1187+t10516*t2493;
+    const real t10911 = df[770]*t1281+t10642*t1920+t8555*t925+df[2957]*t580+t7661*t7326+
+t7675*t3333+t8171*t4070+t8556*t923+t8169*t4084+df[189]*t341+t10505+t8117*t4496+
+t8086*t4653+t10754*t2152+df[479]*t562+t10717*t1472+df[167]*t272+t10499*t4224+
+t10194*t2642;
+    const real t10947 = df[487]*t578+t10808*t2104+df[1096]*t2071+t8097*t4508+df[1771]*
+t3139+t10525*t4313+t10533*t3228+t10541*t3207+t10644*t2587+t8282*t3058+t10414*
+t3335+t10782*t2154+t10506*t2919+t10563*t3407+t10675*t1215+t10559*t4304+df[2370]
+*t4311+t10310*t1859+t7857*t1996+t10800*t2289;
+    const real t10981 = t10521*t2002+t7753*t3880+t7739*t6986+t7852*t1992+t7911*t1892+
+t10549*t2871+t10438*t1157+df[1563]*t2646+t10097*t4213+df[1242]*t2326+t10708*
+t4033+t10660*t2280+df[1588]*t2695+t10744*t2873+t10758*t2245+t10787*t1957+t10587
+*t2145+t7820*t1520+t10640*t1585;
+    const real t11012 = t10574*t431+t10553*t425+t10204*t284+df[4040]*t3355+t8520*t1155+df
+[3001]*t274+t7816*t6239+t10561*t236+df[630]*t1143+t10637*t422+t7744*t3884+t7743
+*t3886+df[3393]*t1587+df[3712]*t3820+t8524*t1120+t8271*t3286+t10492*t3402+t7809
+*t6347+t10710*t2287+t8157*t4184;
+    const real t11047 = t7834*t1531+t7821*t1516+t10684*t344+t10646*t429+t7754*t3882+t10746
+*t1090+t10613*t3490+df[1635]*t2667+t8018*t617+t7673*t3613+t10473*t3440+df[1303]
+*t1922+t10748*t1088+t10756*t1076+t10556*t4219+df[3837]*t4263+t10634*t1213+df
+[744]*t1072+t10810*t3445;
+    const real t11008 = t10632;
+    const real t11075 = t8370*t2251+t8519*t1169+t8523*t1145+t7910*t1857+t10489*t2865+
+t10693*t1918+t10775*t4595+t7844*t1456+t8469*t1636+t11008+t7847*t5942+df[1383]*
+t2553+t10671*t2867+t10739*t2147+t8110*t4542+t7615*t7653+t10658*t2581+t8461*
+t1638+df[1717]*t2669+t7853*t2372;
+    const real t11109 = t10354*t4506+t10603*t1594+t10343*t2665+df[2077]*t3699+t7858*t2376+
+t10566*t204+t8160*t4144+t8168*t4074+t10767*t2796+t10698*t3314+df[1205]*t2014+
+t10266*t319+df[1858]*t3310+t10289*t282+t10538*t2243+df[1200]*t2106+t8170*t4072+
+t8066*t4849+t10365*t2644;
+    const real t11138 = df[3379]*t1656+t10664*t4038+t8557*t912+df[1739]*t2794+t10669*t230+
+t10251+df[3262]*t2374+t7794*t6571+t7793*t6575+df[2063]*t3670+t10650*t2000+t7766
+*t3257+t8462*t1640+t8442*t1729+t10696*t2704+t10648*t4201+t7705*t7163+df[3538]*
+t6493+t10700*t4261+df[2476]*t4494;
+    const real t11171 = t10369*t1994+t10752*t4306+t8470*t1634+t10760*t4591+t7976*t5178+
+t9297*t2738+t10686*t1961+t8098*t4615+t8095*t4544+df[3312]*t1454+t10785*t3438+
+t10579*t234+t7843*t1436+t10592*t2476+t10329+df[1790]*t3184+t10617*t4597+t7967*
+t5278+t10510*t202;
+    const real t11203 = t7790*t6612+t7789*t6610+df[41]*t65+t10774+t10193+t10584*t2282+df
+[3886]*t4562+t9111*t2483+t10737*t3586+t10770*t3409+df[866]*t1592+t10793*t4257+
+t10802*t4589+t7767*t3255+t10805*t2921+t7699*t3337+t7776*t6573+t10477*t2585+
+t10623*t6441+t10734*t3400;
+    const real t11115 = df[1517]*t2771;
+    const real t11219 = t2404*t5252+t2341*t1896+t7493*t6756+t179*t934+t4135*t3263+t254*
+t4897+t275*t1365+t489+t621+t10019+t10153+t8200*t5801+t7878*t2106+t11115+t8499*
+t1120;
+    const real t11224 = t8401*t2201;
+    const real t11233 = t8419*t2065;
+    const real t11118 = df[3205]*t2207;
+    const real t11121 = df[3984]*t3670;
+    const real t11123 = df[3967]*t3548;
+    const real t11124 = t9574;
+    const real t11240 = t11118+t9703*t3492+t11121+t11224+t11123+t11124*t422+df[4015]*t3699
++df[387]*t429+t9715*t2738+t9751*t3447+t11233+t9646*t2002+df[2921]*t2280+t7952*
+t5340+df[381]*t228+df[376]*t202;
+    const real t11244 = t8489*t1192;
+    const real t11253 = t7718*t4395;
+    const real t11137 = df[4044];
+    const real t11142 = t8755*t137;
+    const real t11146 = t9643;
+    const real t11150 = df[3368]*t1557;
+    const real t11261 = df[4032]*t3407+df[1573]*t2867+t11244+t11137*t3445+t9573*t341+t9664
+*t2282+t11142+t8236*t3357+df[2550]*t4589+t11253+df[1531]*t2794+t11146*t234+
+t9583*t2014+t11150+t7725*t4542+df[671]*t1215;
+    const real t11274 = t8280*t3133;
+    const real t11155 = df[2864];
+    const real t11165 = df[2396]*t4353;
+    const real t11166 = df[1144];
+    const real t11169 = df[2763]*t1912;
+    const real t11278 = t7891*t1922+t8220*t5739+t11155*t1954+df[100]*t204+t8193*t3886+df
+[3814]*t4311+df[657]*t1187+t8434*t1436+df[538]*t940+df[2776]*t2695+t11165+
+t11166*t2147+t11274+t11169+t8316*t2646+t8526*t5092;
+    const real t11290 = t8247*t3544;
+    const real t11297 = t8178*t3952;
+    const real t11176 = df[368]*t91;
+    const real t11178 = df[2909]*t2098;
+    const real t11179 = df[2903];
+    const real t11190 = t9535*t4009;
+    const real t11334 = df[3173];
+    const real t11298 = df[2769]*t2919+df[3299]*t1481+t11176+t11178+t11179*t2145+t11334*
+t2287+df[2516]*t4562+df[2530]*t4591+t8370*t2378+t11290+df[3926]*t3409+t7958*
+t7303+t7703*t3310+t8380*t2376+t11190+t11297;
+    const real t11300 = t8385*t2320;
+    const real t11301 = t8177*t3981;
+    const real t11302 = t8158*t4169;
+    const real t11306 = t7711*t4567;
+    const real t11307 = t8179*t3954;
+    const real t11308 = t7826*t1662;
+    const real t11310 = t8386*t2322;
+    const real t11311 = t7827*t1664;
+    const real t11195 = df[2501]*t4537;
+    const real t11199 = df[1015]*t1914;
+    const real t11316 = t8160*t3888+t11300+t11301+t11302+t9576*t1479+t8379*t1996+t11306+
+t11307+t11308+t11195+t11310+t11311+t7829*t1640+df[118]*t230+t11199+t8435*t1456;
+    const real t11324 = t7719*t4359;
+    const real t11325 = t8512*t1250;
+    const real t11206 = df[3865];
+    const real t11211 = df[3397];
+    const real t11217 = df[3658]*t3184;
+    const real t11337 = t7816*t6166+t9735*t2697+t8646*t65+t8614*t617+t11206*t4595+t11324+
+t11325+df[682]*t1213+t8757*t636+t9636*t1472+t11211*t1594+t9770*t3226+df[3291]*
+t2006+t8442*t1537+t11217+t8534*t5052;
+    const real t11342 = t7770*t3754;
+    const real t11349 = t8224*t3695;
+    const real t11350 = t7771*t3752;
+    const real t11356 = t8365*t2446;
+    const real t11231 = df[707]*t1281;
+    const real t11357 = t9654*t2476+t8559*t908+t7773*t3286+t11342+t9699*t4306+df[1841]*
+t3279+t8217*t3617+df[264]*t431+t8274*t3261+t11349+t11350+t7705*t7160+t11231+df
+[3143]*t2478+t9565*t1592+t11356;
+    const real t11372 = t7730*t4393;
+    const real t11375 = t8463*t1713;
+    const real t11239 = df[2473]*t4489;
+    const real t11242 = df[2153]*t3820;
+    const real t11246 = df[627]*t1138;
+    const real t11247 = t9506;
+    const real t11251 = t9527;
+    const real t11255 = df[1433]*t2638;
+    const real t11257 = df[3084]*t3139;
+    const real t11408 = t9747*t3483;
+    const real t11381 = t11408+t9745*t3440+t8343*t2669+t11239+t11242+t8699*t2671+t11246+
+t11247*t2578+df[2833]*t2585+t11372+t11008+t11375+t9720*t4213+t11251*t4304+
+t11255+t11257;
+    const real t11386 = t8352*t2547;
+    const real t11387 = t7752*t3828;
+    const real t11392 = t8351*t2549;
+    const real t11393 = t8474*t1551;
+    const real t11395 = t7799*t6499;
+    const real t11397 = t8278*t3180;
+    const real t11260 = df[3074]*t2553;
+    const real t11263 = df[614]*t1115;
+    const real t11266 = df[1855]*t3306;
+    const real t11269 = df[3703]*t3958;
+    const real t11271 = df[2108]*t3746;
+    const real t11272 = t9667;
+    const real t11275 = df[3613];
+    const real t11432 = t11275*t3228;
+    const real t11398 = df[2825]*t2865+t11260+t11263+t8727*t1099+t11386+t11387+t11266+df
+[3691]*t4038+t11269+t11271+t11392+t11393+t11272*t425+t11395+t11432+t11397;
+    const real t11405 = t8464*t1708;
+    const real t11409 = t8281*t3135;
+    const real t11412 = t8669*t131;
+    const real t11282 = df[1115]*t2100;
+    const real t11284 = df[2332];
+    const real t11286 = t9433;
+    const real t11292 = df[1906];
+    const real t11296 = df[2813]*t2636;
+    const real t11419 = t8152*t4263+t8612*t4265+df[3282]*t2154+t11282+t9389*t3207+t11405+
+t11284*t4219+t11286*t236+t11409+t9611*t4201+t11412+t8527*t1072+t9603*t2483+
+t11292*t3402+t7740*t4074+t11296;
+    const real t11422 = t8402*t2203;
+    const real t11433 = t7751*t3826;
+    const real t11435 = t8176*t3986;
+    const real t11299 = df[2820];
+    const real t11305 = t9795;
+    const real t11313 = df[38]*t93;
+    const real t11320 = df[2413]*t4387;
+    const real t11459 = df[947];
+    const real t11326 = t11459*t1585;
+    const real t11461 = t11299*t2736;
+    const real t11441 = t11461+t11422+t9705*t3209+t11305*t2581+t11313+t9606*t2796+df[3061]
+*t1961+t9659*t2702+df[3042]*t2452+t11433+t11320+t11435+t9737*t4040+df[3051]*
+t1963+t11326+t7739*t7032;
+    const real t11445 = t8062*t1256;
+    const real t11447 = t8475*t1553;
+    const real t11452 = t8223*t3693;
+    const real t11457 = t8248*t3542;
+    const real t11458 = t8225*t3664;
+    const real t11332 = t9742*t6493;
+    const real t11338 = t9726;
+    const real t11340 = df[2634];
+    const real t11343 = t9609;
+    const real t11476 = df[4124];
+    const real t11460 = df[2647]*t3438+t11445+t8066*t4839+t11447+t8235*t3337+t11332+t8477*
+t1516+t11476*t4224+t11452+t7724*t4496+df[1661]*t2587+t11338*t2871+t11340*t3400+
+t11457+t11458+t11343*t2873;
+    const real t11480 = t8418*t2067;
+    const real t11354 = df[902]*t1656;
+    const real t11481 = t9581*t2289+t9641*t4313+df[483]*t787+df[492]*t776+t7776*t6616+df
+[1357]*t2493+t11354+t9633*t6464+t7615*t7657+t7792*t6571+df[3272]*t2152+df[3559]
+*t6566+df[3247]*t2326+t9569*t1587+df[886]*t1629+t11480;
+    const real t11483 = t8061*t1289;
+    const real t11486 = t7800*t6501;
+    const real t11487 = t8488*t1194;
+    const real t11488 = t8226*t3666;
+    const real t11490 = t8159*t4164;
+    const real t11499 = t7710*t4569;
+    const real t11374 = df[4100];
+    const real t11522 = df[1061];
+    const real t11501 = t11483+t9597*t120+t11486+t11487+t11488+t8498*t1145+t11490+df[1597]
+*t2704+df[197]*t344+df[470]*t772+t8741*t798+df[475]*t789+t11374*t4597+t11522*
+t2000+t11499+df[1613]*t2921;
+    const real t11502 = t8277*t3178;
+    const real t11505 = t7720*t4361;
+    const real t11514 = t8366*t2448;
+    const real t11520 = t8487*t1287;
+    const real t11380 = df[2618]*t3304;
+    const real t11384 = df[3195]*t2071;
+    const real t11391 = df[1040];
+    const real t11402 = df[164]*t302;
+    const real t11521 = t11502+t11380+t9670*t6441+t11505+t11384+t9563*t1474+t9690*t4033+
+t8647*t274+t8769*t323+t11391*t1957+t11514+t9694*t3490+t9619*t3500+df[2249]*
+t4065+t11402+t11520;
+    const real t11534 = t2341*t1862+t136*t601+t4135*t4725+t7493*t7293+t2404*t5082+t254*
+t4893+t179*t928+t275*t1357+t4970+t5021+t10019+t10153+t11301+t11302+t11325+
+t11375+t11405;
+    const real t11417 = t8755*t131;
+    const real t11428 = df[626]*t1138;
+    const real t11430 = df[613]*t1115;
+    const real t11562 = df[1661];
+    const real t11551 = t11435+t11445+t11490+df[3236]*t2287+df[3246]*t2326+t11417+t7773*
+t3284+t8769*t287+t8268*t3337+t8757*t631+t8151*t4263+t11320+t7739*t7026+t11562*
+t2585+t11428+t11430+t8220*t5733;
+    const real t11559 = t8365*t2448;
+    const real t11560 = t8401*t2203;
+    const real t11568 = t7710*t4567;
+    const real t11570 = t7720*t4359;
+    const real t11450 = t11522;
+    const real t11454 = t9442*t2014;
+    const real t11455 = df[2033];
+    const real t11567 = df[2249]*t4065;
+    const real t11577 = df[100];
+    const real t11573 = t7892*t1922+t11567+df[3128]*t1481+t7891*t2418+t8193*t3884+t11559+
+t11560+df[3587]*t6441+df[4106]*t4311+t8424*t1996+t11577*t202+df[3298]*t1479+
+t11568+t11450*t2002+t11570+t11454+t11455*t3355;
+    const real t11596 = t7826*t1664;
+    const real t11468 = df[163]*t93;
+    const real t11587 = df[3282];
+    const real t11593 = df[1613];
+    const real t11597 = t11391*t1954+t8648*t274+t8152*t4261+t11587*t2152+t11374*t4595+df
+[410]*t344+t11468+t11269+t11593*t2919+t8693*t2940+t7615*t7672+t8500*t1120+t7726
+*t4542+t9472*t2476+t8066*t4853+df[3690]*t4040+df[3093]*t2478+t11596;
+    const real t11616 = t8352*t2549;
+    const real t11618 = t8488*t1192;
+    const real t11619 = t8061*t1287;
+    const real t11500 = df[1114]*t2098;
+    const real t11623 = t8237*t3357+df[2366]*t4304+t7829*t1638+t11242+df[3672]*t3228+t8315
+*t2646+t11165+t8727*t1093+df[2262]*t4009+t7740*t4084+t7741*t4074+t11616+t11500+
+t11618+t11619+t8528*t1072+t11211*t1592;
+    const real t11626 = t7751*t3828;
+    const real t11631 = t7752*t3826;
+    const real t11635 = t7718*t4393;
+    const real t11637 = t8281*t3133;
+    const real t11645 = t8278*t3178;
+    const real t11638 = df[3926];
+    const real t11646 = t11343*t2871+t11626+df[3726]*t4038+df[464]*t772+t11631+t8741*t792+
+df[2856]*t1474+t11635+t8527*t1076+t11637+t7772*t3286+t7703*t3314+t7878*t2104+
+t11638*t3407+df[3173]*t2289+df[806]*t1472+t11645;
+    const real t11656 = t8475*t1551;
+    const real t11664 = t7800*t6499;
+    const real t11669 = t7827*t1662;
+    const real t11670 = t8224*t3693;
+    const real t11536 = df[37]*t91;
+    const real t11541 = df[1854]*t3304;
+    const real t11674 = df[1470]*t2695+t11155*t1957+t11124*t425+t11146*t236+t11656+t9670*
+t6464+t8192*t3886+df[1222]*t2280+t11536+t11332+t11664+df[1804]*t3209+df[862]*
+t1585+t11669+t11670+t11541+df[208]*t120;
+    const real t11684 = t8226*t3664;
+    const real t11691 = t8419*t2067;
+    const real t11694 = t8489*t1194;
+    const real t11558 = df[175];
+    const real t11661 = df[3051];
+    const real t11671 = df[886]*t1629;
+    const real t11672 = df[197];
+    const real t11698 = df[2920]*t2282+t11661*t1961+df[3041]*t2452+t11299*t2738+df[2805]*
+t2794+t11671+t11672*t341+df[2515]*t4562+t11684+df[2930]*t2000+t9529*t4213+df
+[537]*t940+t11558*t272+t11691+df[3992]*t3490+t11694+t8027*t617+t11150;
+    const real t11702 = t8386*t2320;
+    const real t11703 = t8366*t2446;
+    const real t11708 = t8223*t3695;
+    const real t11716 = t7770*t3752;
+    const real t11724 = t7771*t3754;
+    const real t11726 = t8225*t3666;
+    const real t11690 = df[3061];
+    const real t11727 = t11702+t11703+t11275*t3226+t11257+t11708+t11271+t11260+df[3222]*
+t2006+df[1596]*t2702+t11716+df[2646]*t3440+t11217+t11123+t11121+t11724+t11690*
+t1963+t11726;
+    const real t11731 = t8248*t3544;
+    const real t11735 = t8669*t137;
+    const real t11740 = t8385*t2322;
+    const real t11579 = df[1516]*t2638;
+    const real t11589 = df[2500]*t4537;
+    const real t11701 = df[2550];
+    const real t11750 = t7952*t5320+t11340*t3402+t11731+df[1495]*t2736+t11579+t11735+
+t11701*t4591+t7776*t6695+df[3947]*t3445+t11740+t11118+t8381*t2376+t11179*t2147+
+t7792*t6575+df[3558]*t6566+t11589+t9408*t2796;
+    const real t11766 = t8487*t1289;
+    const real t11771 = t7730*t4395;
+    const real t11772 = t8179*t3952;
+    const real t11773 = t8351*t2547;
+    const real t11592 = df[2908]*t2100;
+    const real t11719 = df[1841]*t3279;
+    const real t11732 = df[682];
+    const real t11775 = t11592+t11719+df[2123]*t3207+df[77]*t169+t11286*t234+t8274*t3259+
+t8200*t5795+df[469]*t776+t11305*t2578+t11766+t11732*t1215+df[474]*t789+t11247*
+t2581+t11771+t11772+t11773+df[3142]*t2483;
+    const real t11782 = t8418*t2065;
+    const real t11629 = df[2762]*t1914;
+    const real t11632 = df[2472]*t4489;
+    const real t11634 = df[2231]*t4033;
+    const real t11749 = df[671];
+    const real t11757 = df[264];
+    const real t11801 = df[482]*t787+df[3786]*t4224+t7734*t4496+t7828*t1640+t7816*t6279+
+t11782+df[3414]*t1594+t11749*t1213+t11272*t422+t8526*t5115+t11338*t2873+t11251*
+t4306+t11629+t11632+t11634+t11757*t429+t8477*t1520+t11384;
+    const real t11810 = t7719*t4361;
+    const real t11813 = t8402*t2201;
+    const real t11818 = t8178*t3954;
+    const real t11821 = t7711*t4569;
+    const real t11823 = t7799*t6501;
+    const real t11642 = df[2801]*t2771;
+    const real t11648 = df[1432]*t2636;
+    const real t11651 = df[737];
+    const real t11770 = df[2825];
+    const real t11824 = df[2794]*t2704+t11354+t11642+t8501*t1145+t11810+t11206*t4597+
+t11813+t11648+t8370*t1998+t11770*t2867+t11651*t1143+t11818+t8314*t2669+df[656]*
+t1187+t11821+t8611*t4433+t11823;
+    const real t11827 = t8474*t1553;
+    const real t11832 = t8280*t3135;
+    const real t11666 = df[3834];
+    const real t11790 = df[118];
+    const real t11796 = df[2769];
+    const real t11800 = df[2833];
+    const real t11847 = t7791*t6571+t11459*t1587+t11827+t11166*t2145+df[2751]*t2493+t11832
++t8436*t1456+t7705*t7080+t11790*t228+t11666*t4494+df[348]*t599+df[4014]*t3699+
+t11231+t11796*t2921+df[2775]*t2697+t11800*t2587+t8534*t5050+df[3815]*t4313;
+    const real t11856 = t8277*t3180;
+    const real t11685 = df[1014]*t1912;
+    const real t11687 = df[2617]*t3306;
+    const real t11689 = df[371]*t302;
+    const real t11700 = df[1003];
+    const real t11706 = t9599;
+    const real t11822 = df[1573];
+    const real t11826 = df[376];
+    const real t11831 = df[3272];
+    const real t11835 = df[381];
+    const real t11868 = t7879*t2106+df[2442]*t4219+t11284*t4201+t11685+t11687+t11689+
+t11856+t8217*t3339+df[2623]*t3483+t11822*t2865+t11826*t204+t8273*t3261+t11831*
+t2154+t11700*t1454+t11835*t230+t8441*t1436+t11706*t3492;
+    const real t11869 = t8247*t3542;
+    const real t11709 = df[1448];
+    const real t11714 = df[1275];
+    const real t11840 = df[387];
+    const real t11843 = df[2530];
+    const real t11849 = df[4032];
+    const real t11854 = t11137*t3447;
+    const real t11891 = t11869+t11709*t2667+t11840*t431+df[1961]*t3500+t11843*t4589+t11714
+*t2374+t11292*t3400+t11849*t3409+t7671*t7452+t7702*t3310+t11854+t8160*t4115+
+t8654*t65+t8559*t912+t8560*t908+df[1927]*t3438+t8442*t1792+t8476*t1516;
+    const real t11905 = t4986+t2404*t5220+t275*t1350+t2341*t1458+t4135*t4757+t132*t5016+
+t136*t582+t254*t4889+t179*t915+t7493*t6823+t10019+t10153+t11224+t11233+t11244+
+t11253+t11274+t11290+t11297;
+    const real t11906 = t11300+t11301+t11302+t11306+t11307+t11308+t11310+t11311+t11324+
+t11325+t11342+t11349+t11350+t11356+t11372+t11375+t11386+t11387+t11392;
+    const real t11908 = t11393+t11395+t11397+t11405+t11409+t11412+t11422+t11433+t11435+
+t11445+t11447+t11452+t11457+t11458+t11480+t11483+t11486+t11487+t11488;
+    const real t11745 = df[1469];
+    const real t11754 = t11757;
+    const real t11759 = df[3406];
+    const real t11762 = df[3413];
+    const real t11925 = t11490+t11499+t11502+t11505+t11514+t11520+t11745*t2697+t7881*t2106
++t8499*t1155+df[733]*t1157+t7615*t7617+t11282+t9512*t3438+t11754*t431+t8235*
+t3333+df[1903]*t3402+t11759*t1594+t8228*t3337+t11762*t1592;
+    const real t11764 = df[4105];
+    const real t11781 = t11790;
+    const real t11785 = t11840;
+    const real t11787 = t11835;
+    const real t11953 = t11263+t11764*t4313+t8442*t1523+t11246+t11402+df[151]*t284+t8769*
+t276+t7893*t1922+t8220*t5777+t8200*t5788+t8657*t274+df[399]*t234+t11781*t230+
+t8699*t2681+t11785*t429+t11787*t228+df[393]*t422+t7816*t6270+t7828*t1634;
+    const real t11797 = df[1926];
+    const real t11803 = t11732;
+    const real t11806 = df[805];
+    const real t11808 = df[3235];
+    const real t11814 = t11577;
+    const real t11977 = t8340*t2669+t8343*t2665+t11195+t8434*t1857+t7830*t1640+t11797*
+t3440+df[1141]*t2147+t8484*t1456+t11803*t1213+t8376*t2376+t11806*t1474+t11190+
+t11808*t2289+t11239+df[2632]*t3400+t11814*t204+t7735*t4542+df[2852]*t1472+t8483
+*t1436;
+    const real t11820 = df[2622];
+    const real t11828 = df[2453];
+    const real t11846 = df[409];
+    const real t12005 = t11820*t3500+t7739*t6990+t7740*t4070+t11828*t4304+t8585*t4459+
+t8236*t3613+df[1401]*t2581+t11706*t3490+t9692*t3445+t7891*t1918+df[1871]*t3335+
+t8124*t4263+df[1059]*t1994+df[1038]*t1957+t7892*t1920+t11846*t341+t11142+t7704*
+t4496+df[4098]*t4597;
+    const real t11853 = df[3127];
+    const real t11863 = t11719;
+    const real t11876 = df[3221];
+    const real t11880 = df[3586];
+    const real t12035 = t11450*t2000+t11255+t11853*t1479+t9571*t2478+df[899]*t1656+t8266*
+t3357+df[2861]*t1954+t11863+t7725*t4615+df[2722]*t562+df[3529]*t6493+t11432+
+t7776*t6717+t8040*t617+df[3202]*t2207+t11876*t2014+t7778*t6571+t7791*t6610+
+t11880*t6464+df[247]*t425;
+    const real t11897 = df[2261];
+    const real t11900 = t11567;
+    const real t11902 = df[2750];
+    const real t11912 = df[1494];
+    const real t12065 = df[3193]*t2071+t7792*t6612+df[3557]*t6566+t9406*t2280+t8741*t779+
+df[468]*t787+df[463]*t789+df[453]*t772+t11897*t4033+t11900+t9408*t2794+t11902*
+t2476+df[340]*t580+t11178+df[219]*t236+df[205]*t120+t11912*t2738+t7879*t2245+
+t11408;
+    const real t11916 = t11334;
+    const real t11919 = t11672;
+    const real t11926 = t11843;
+    const real t11934 = t11749;
+    const real t11938 = df[2929];
+    const real t12091 = t11916*t2287+t7878*t2243+t11919*t344+t9467*t4311+t9423*t6441+df
+[2901]*t2145+t11326+t11926*t4591+t8375*t1996+t8476*t1531+df[655]*t1187+t8647*
+t319+df[3779]*t4506+t11934*t1215+df[2514]*t4562+t8316*t2642+t11115+t11938*t2002
++df[3862]*t4595;
+    const real t11950 = t11701;
+    const real t11952 = t11562;
+    const real t11962 = t9487;
+    const real t11966 = df[3946];
+    const real t12117 = t8502*t1145+t8380*t2372+t8066*t4818+df[984]*t1859+df[3366]*t1557+
+df[3245]*t2326+t11950*t4589+t11952*t2587+t8534*t5046+t8370*t2397+t7952*t5310+
+t7705*t7071+df[1642]*t2873+t8379*t1992+t11169+t11962*t2695+t8152*t4259+t9499*
+t4219+t11966*t3447;
+    const real t11968 = t11796;
+    const real t11975 = t9445;
+    const real t11980 = t11638;
+    const real t11984 = t11661;
+    const real t11991 = df[3785];
+    const real t12141 = t11968*t2919+t8479*t1516+t8160*t4132+t8615*t578+t8757*t627+t8656*
+t65+t11975*t1481+df[3290]*t2006+t8217*t3359+t11980*t3409+t7703*t3584+t7772*
+t4186+t11984*t1963+df[3040]*t2452+t8192*t3880+t8163*t3886+df[2787]*t2871+t11991
+*t4213+t8435*t1892+t11296;
+    const real t11994 = df[2804];
+    const real t11999 = df[2365];
+    const real t12001 = df[2122];
+    const real t12009 = t11690;
+    const real t12011 = df[2793];
+    const real t12017 = t11822;
+    const real t12021 = t11593;
+    const real t12084 = df[492];
+    const real t12101 = df[1344];
+    const real t12168 = t11994*t2796+t11380+t8084*t3261+t8560*t925+t12084*t776+t11999*
+t4306+t12001*t3209+df[2105]*t3746+df[1598]*t2704+df[3964]*t3548+t12009*t1961+
+t12011*t2702+t8477*t1533+df[3072]*t2553+t12101*t2493+t12017*t2867+t8526*t5118+
+t8310*t2646+t12021*t2921;
+    const real t12023 = df[2441];
+    const real t12039 = df[3991];
+    const real t12046 = t11587;
+    const real t12194 = t12023*t4201+t8498*t1169+t11313+df[2150]*t3820+t7741*t4072+t7769*
+t3286+df[2410]*t4387+t11199+df[3701]*t3958+df[3689]*t4038+df[3656]*t3184+t7749*
+t4074+t12039*t3492+t8274*t3257+t7684*t3310+t7958*t7420+t7702*t3586+df[4013]*
+t3699+t12046*t2154;
+    const real t12048 = t11831;
+    const real t12050 = t11476;
+    const real t12052 = df[3671];
+    const real t12064 = t11849;
+    const real t12070 = t11671;
+    const real t12219 = t12048*t2152+t12050*t4224+t12052*t3226+t8273*t3255+t7724*t4508+
+t11266+df[2839]*t2578+t8727*t1079+t8530*t1072+t8527*t1088+t8528*t1090+df[74]*
+t169+t7773*t4184+t12064*t3407+df[1627]*t2644+t12070+t7829*t1636+t8151*t4257+
+t8193*t3882;
+    const real t12083 = t11826;
+    const real t12086 = df[3725];
+    const real t12089 = df[1221];
+    const real t12093 = t11770;
+    const real t12096 = df[861];
+    const real t12098 = t11800;
+    const real t12102 = df[3092];
+    const real t12244 = df[704]*t1281+t8503*t1120+df[536]*t940+t8559*t923+df[3081]*t3139+
+df[3982]*t3670+t12083*t202+t8562*t908+t12086*t4040+df[1802]*t3207+t12089*t2282+
+t11176+t8646*t282+t12093*t2865+t11461+t12096*t1587+t12098*t2585+df[2394]*t4353+
+t12102*t2483+t4887;
+    const real t12275 = t471+t4961+t126*t4885+t254*(2.0*t4843+t1150+t1102+t1103+t1151+
+t1107+t1344+t1345+t1346+t1347)+t7493*(2.0*t6594+t4179+t3266+t3267+t4180+t3271+
+t6748+t6749+t6781+t6782)+t275*(2.0*t1301+t1163+t1124+t1126+t1164+t1130+t1337+
+t1338+t1339+t1340)+t179*(2.0*t931+t895+t897+t898+t899+t900+t902+t903+t905+t907)
++t4135*(2.0*t4754+t4727+t3241+t4728+t4729+t4730+t3249+t3250+t4731+t4732)+t136*
+t470+t2404*(2.0*t5142+t1441+t1443+t1444+t1445+t1446+t1448+t1449+t1451+t1453)+
+t132*t4964+t2341*(2.0*t2109+t1423+t1424+t1426+t1427+t1428+t1430+t1431+t1433+
+t1435)+t7569+t4966+t215*t1250*t212+t10019+t10153+t4944+t4946;
+    const real t12276 = t11301+t11302+t11375+t11405+t11435+t11445+t11490+t11559+t11560+
+t11568+t11570+t11596+t11616+t11618+t11619+t11626+t11631+t11635+t11637;
+    const real t12278 = t11645+t11656+t11664+t11669+t11670+t11684+t11691+t11694+t11702+
+t11703+t11708+t11716+t11724+t11726+t11731+t11735+t11740+t11766+t11771;
+    const real t12287 = t11772+t11773+t11782+t11810+t11813+t11818+t11821+t11823+t11827+
+t11832+t11856+t11869+t4949+t4953+t4957+t8585*(2.0*t4187+t4436+t4437+t4245+t4438
++t4439+t4251+t4252+t4440+t4441)+t8151*t4259+df[2407]*t4387+df[2391]*t4353+
+t11999*t4304;
+    const real t12320 = t8152*t4257+t9499*t4201+t8160*(2.0*t3909+t4124+t3870+t4125+t4126+
+t4127+t3874+t3875+t4128+t4129)+t11900+t11634+df[3199]*t2207+df[3190]*t2071+
+t8193*t3880+t11541+t11863+t8274*t3255+df[1801]*t3209+t11592+t8381*t2372+df
+[3813]*t4313+t11952*t2585+df[1642]*t2871+t8693*(2.0*t2531+t2622+t2844+t2625+
+t2627+t2847+t2933+t2934+t2942+t2943)+t8315*t2642;
+    const real t12358 = t12021*t2919+df[2704]*t599+df[2147]*t3820+df[3862]*t4597+t12001*
+t3207+df[2102]*t3746+t8217*(2.0*t3360+t3634+t3319+t3635+t3636+t3637+t3327+t3328
++t3638+t3639)+t11455*t3335+t7829*t1634+t9503*t3500+t11797*t3438+t11666*t4506+df
+[1881]*t3355+t8268*t3333+df[1903]*t3400+t8163*t3884+df[2901]*t2147+t9718*t2702+
+(2.0*t7566+t607+t831+t4979+t832+t4980+t611+t612+t4981+t4982)*t77+t12017*t2865;
+    const real t12392 = t11916*t2289+t7878*t2245+t7879*t2243+t7881*t2104+t8200*(2.0*t5532+
+t2085+t2086+t2238+t2239+t2090+t5779+t5780+t5781+t5782)+df[1535]*t2796+t11579+
+t11912*t2736+t11745*t2695+t12098*t2587+t7769*t3284+t12052*t3228+t11975*t1479+
+t11454+df[4051]*t3492+t7958*(2.0*t6994+t3292+t3291+t3579+t3580+t3296+t7295+
+t7296+t7413+t7414)+df[4012]*t3699+t7684*t3314+t7702*t3584;
+    const real t12425 = t11994*t2794+t11642+t12011*t2704+t11854+t12064*t3409+t7773*t4186+
+t12039*t3490+t11938*t2000+df[3979]*t3670+t8192*t3882+t11897*t4009+df[3363]*
+t1557+t11880*t6441+t11651*t1157+t8501*t1169+df[729]*t1143+t11803*t1215+df[701]*
+t1281+df[654]*t1187+df[3508]*t6464;
+    const real t12464 = t12093*t2867+df[2822]*t2738+df[2787]*t2873+t8314*t2665+t12046*
+t2152+t12048*t2154+t11962*t2697+t9507*t3226+t8526*(2.0*t5014+t2654+t2673+t2674+
+t2675+t2676+t2658+t2659+t2677+t2678)+t11629+t8436*t1892+t7778*t6575+t7776*(2.0*
+t6440+t6552+t6554+t6621+t6622+t6558+t6606+t6607+t6710+t6711)+t9406*t2282+t11968
+*t2921+t11902*t2493+t7952*(2.0*t5308+t2389+t2390+t2359+t2391+t2392+t2365+t2366+
+t2393+t2394)+t11428+t11430;
+    const real t12325 = df[536];
+    const real t12498 = t8527*t1090+t8528*t1088+t7705*(2.0*t6939+t4476+t4477+t4501+t4502+
+t4481+t7073+t7074+t7263+t7264)+t8530*t1076+t8727*(2.0*t978+t1059+t1061+t1062+
+t1063+t1064+t1066+t1067+t1069+t1071)+t12325*t940+t7740*t4072+t11934*t1213+
+t11468+t8654*t282+t11558*t284+df[3069]*t2553+df[3039]*t2452+df[144]*t272+t11984
+*t1961+t8769*(2.0*t10+t51+t53+t55+t56+t57+t59+t60+t62+t64)+t11536+t11781*t228+
+t11814*t202;
+    const real t12528 = df[73]*t169+df[3698]*t3958+t9730*t4040+t12086*t4038+t8237*t3613+df
+[3653]*t3184+t11846*t344+t7741*t4070+t7749*t4084+t7739*(2.0*t6702+t4054+t4051+
+t4078+t4056+t4081+t6933+t6934+t6935+t6936)+t8559*t925+t8560*t923+t8562*t912+df
+[467]*t789+df[462]*t787+df[452]*t776+t8741*t692+df[450]*t772+t12102*t2478;
+    const real t12565 = df[3078]*t3139+df[204]*t120+t11919*t341+df[4098]*t4595+df[219]*
+t234+t11417+df[393]*t425+t11785*t431+t11787*t230+df[2839]*t2581+t11754*t429+df
+[247]*t422+df[330]*t562+df[339]*t578+t8648*t319+t8757*(2.0*t493+t259+t261+t262+
+t263+t264+t266+t267+t269+t271)+df[2853]*t1474+t11759*t1592+t7816*(2.0*t5932+
+t1617+t1618+t1722+t1620+t1725+t6153+t6154+t6155+t6156)+t11950*t4591;
+    const real t12601 = df[399]*t236+df[3526]*t6493+t11926*t4589+t7615*(2.0*t7269+t4523+
+t4610+t4525+t4611+t4529+t7065+t7066+t7067+t7068)+t11764*t4311+t11980*t3407+df
+[2513]*t4562+t11589+t11876*t2006+t11632+t11828*t4306+t8124*t4261+t7703*t3586+
+t7772*t4184+t12023*t4219+t12009*t1963+t8500*t1155+df[1458]*t2667+t11709*t2644;
+    const real t12424 = df[3557];
+    const real t12637 = t11648+t11991*t4224+df[1401]*t2578+t12101*t2476+t7792*t6610+t12424
+*t6566+t8370*(2.0*t2051+t2335+t2336+t1982+t2337+t2338+t1986+t1987+t2339+t2340)+
+df[1290]*t2374+t11714*t1994+t7893*t2418+t7734*t4508+df[3773]*t4494+df[1141]*
+t2145+t11500+df[1061]*t2002+t7830*t1638+df[2721]*t580+t8534*t4995+t9512*t3440+
+t8066*(2.0*t4665+t3342+t3344+t3345+t3346+t3347+t3349+t3350+t3352+t3354);
+    const real t12668 = df[2632]*t3402+t11820*t3483+t7828*t1636+t11762*t1594+t7726*t4615+
+t12050*t4213+t11687+t8084*t3259+t8273*t3257+df[3961]*t3548+t11966*t3445+t7791*
+t6612+df[3244]*t2326+t11808*t2287+t12083*t204+t11689+df[795]*t1454+t8424*t1992+
+t11685;
+    const real t12700 = t11700*t1859+t8441*t1857+t9571*t2483+t11853*t1481+t8476*t1533+df
+[947]*t1587+t8442*(2.0*t1457+t1503+t1504+t1506+t1507+t1508+t1510+t1511+t1513+
+t1515)+df[896]*t1656+t12070+df[2861]*t1957+t7891*t1920+t7892*t1918+t8220*(2.0*
+t5502+t1900+t1901+t2407+t1903+t2410+t5721+t5722+t5723+t5724)+t12096*t1585+t8477
+*t1531+t8479*t1520+t11806*t1472+df[1038]*t1954+t12089*t2280+t4971;
+    const real t12715 = t215*t1247*t212;
+    const real t12718 = t6+t4135*(2.0*t3990+t3719+t3720+t3722+t3723+t3724+t3726+t3727+
+t3989)+t179*(2.0*t927+t875+t864+t867+t869+t878+t885+t886+t926)+t7493*(2.0*t6601
++t3778+t3153+t3155+t3779+t3159+t3726+t3727+t6600)+t7516+t7531+t7535+t7540+t7545
++t7551+t7563+t12715+t126*t594*t77+t1;
+    const real t12452 = df[3708]*t3873;
+    const real t12461 = df[3211]*t1985;
+    const real t12466 = df[1456];
+    const real t12540 = df[3218];
+    const real t12735 = df[72]*t164+df[48]*t115+df[3711]*t3814+t12452+df[260]*t416+df
+[3268]*t2139+t8694*(2.0*t2464+t2605+t2613+t2602+t2607+t2616+t2761+t2762+t2460)+
+t12540*t2010+df[1539]*t2790+t12461+df[895]*t1653+df[3189]*t2059+df[3198]*t2195+
+t12466*t2660;
+    const real t12742 = t8463*t1702;
+    const real t12747 = t8062*t1244;
+    const real t12468 = df[1446];
+    const real t12470 = df[3117];
+    const real t12472 = df[3114];
+    const real t12475 = df[24];
+    const real t12478 = df[884]*t1626;
+    const real t12481 = df[35]*t58;
+    const real t12482 = df[2606];
+    const real t12485 = df[3027]*t1447;
+    const real t12486 = df[523];
+    const real t12751 = t12468*t2662+t12470*t1907+t12472*t1905+df[2526]*t4586+t12475*t63+
+t12742+t12478+t8534*t4994+t12481+t12482*t3251+t12747+t12485+t12486*t906+df
+[1168]*t2198;
+    const real t12492 = df[2031];
+    const real t12494 = df[2050];
+    const real t12497 = df[1830];
+    const real t12503 = df[2247]*t4062;
+    const real t12509 = df[611]*t1112;
+    const real t12510 = df[599];
+    const real t12512 = df[2362];
+    const real t12592 = t12512*t4301;
+    const real t12769 = t8585*(2.0*t4242+t4416+t4514+t4515+t4516+t4517+t4424+t4425+t4241)+
+t12492*t3351+t12494*t3329+df[3362]*t1545+t12497*t3253+df[857]*t1582+df[1922]*
+t3435+t12503+df[653]*t1184+df[2101]*t3743+df[1323]*t2443+df[243]*t419+t12509+
+t12510*t1068+t12592;
+    const real t12786 = t8159*t4161;
+    const real t12515 = df[624]*t1135;
+    const real t12519 = df[1288];
+    const real t12523 = df[1273];
+    const real t12526 = df[3033]*t1429;
+    const real t12529 = df[1514]*t2657;
+    const real t12533 = df[2707];
+    const real t12788 = t12515+df[2076]*t3690+df[2062]*t3661+df[203]*t112+t12519*t2367+df
+[842]*t1548+df[215]*t222+t12523*t2369+t12526+t12529+t8545*(2.0*t4878+t524+t4967
++t736+t737+t4968+t528+t529+t545)+t12533*t613+t12786+df[1899]*t3397;
+    const real t12806 = t9878*t6586;
+    const real t12544 = df[3633];
+    const real t12552 = t12424*t6563;
+    const real t12554 = df[3570];
+    const real t12557 = df[742]*t1065;
+    const real t12558 = df[735];
+    const real t12560 = df[3609];
+    const real t12563 = df[3495]*t3248;
+    const real t12811 = t8681*(2.0*t3045+t3361+t3363+t3365+t3366+t3367+t3369+t3370+t3044)+
+df[2512]*t4559+df[1609]*t2914+t7776*(2.0*t6409+t6531+t6532+t6642+t6643+t6536+
+t6633+t6634+t6408)+t12544*t3272+df[3621]*t3220+t8220*(2.0*t5468+t1931+t2995+
+t1934+t1936+t2998+t1872+t1873+t5466)+t12552+df[3537]*t6487+t12554*t6559+t12806+
+t12557+t12558*t1108+t12560*t6561+t12563;
+    const real t12818 = t9805*t971;
+    const real t12567 = df[1255];
+    const real t12572 = df[589];
+    const real t12577 = df[835];
+    const real t12579 = df[828];
+    const real t12581 = df[1869];
+    const real t12585 = df[1430]*t2633;
+    const real t12829 = df[1987]*t3539+df[3525]*t6490+t12567*t1988+df[1241]*t2317+df[2198]
+*t3949+t12818+df[3038]*t2440+t12572*t1070+t8727*(2.0*t975+t1049+t1050+t1039+
+t1051+t1052+t1043+t1044+t974)+t12577*t1512+t12579*t1514+t12581*t3331+df[3047]*
+t1948+t12585;
+    const real t12841 = t8464*t1705;
+    const real t12586 = df[1879];
+    const real t12589 = t12325*t901;
+    const real t12591 = df[2498]*t4534;
+    const real t12603 = df[3375];
+    const real t12605 = df[3373];
+    const real t12608 = df[1585];
+    const real t12683 = df[3401];
+    const real t12850 = t12586*t3353+t12589+t12591+df[3652]*t3172+df[1491]*t2731+df[1569]*
+t2862+df[3514]*t6450+t7816*(2.0*t6036+t1746+t1803+t1747+t1749+t1806+t1688+t1689
++t6034)+t12841+t8442*(2.0*t1534+t1681+t1682+t1684+t1685+t1686+t1688+t1689+t1532
+)+t12603*t1624+t12605*t1622+df[3378]*t1650+t12608*t2689+t12683*t1579;
+    const real t12611 = df[3170];
+    const real t12615 = df[3257]*t2364;
+    const real t12619 = df[1960];
+    const real t12622 = df[142];
+    const real t12626 = df[161]*t265;
+    const real t12627 = df[149];
+    const real t12630 = df[1852]*t3301;
+    const real t12632 = df[1839]*t3276;
+    const real t12870 = t12611*t2274+df[3243]*t2314+t12615+t8708*(2.0*t5605+t2181+t2228+
+t2180+t2183+t2231+t2118+t2119+t5599)+t12619*t3496+df[1812]*t3223+t12622*t270+df
+[700]*t1278+t12626+t12627*t61+t12630+t12632+df[2390]*t4350+df[1465]*t2692;
+    const real t12885 = t8176*t3975;
+    const real t12636 = df[1112]*t2095;
+    const real t12643 = df[3771];
+    const real t12646 = df[3764]*t4250;
+    const real t12649 = df[982];
+    const real t12651 = df[3722];
+    const real t12653 = df[3646];
+    const real t12887 = t12636+(2.0*t7560+t40+t39+t5004+t5005+t44+t5545+t5554+t5558)*t73+
+df[769]*t1275+df[760]*t1181+t12643*t4532+t12646+df[3679]*t4029+df[3697]*t3946+
+t12649*t1432+t12651*t4058+t12653*t3274+df[3636]*t3740+t12885+df[1770]*t3130;
+    const real t12897 = t8177*t3978;
+    const real t12659 = df[356];
+    const real t12664 = df[3160];
+    const real t12676 = df[2171];
+    const real t12678 = df[1625];
+    const real t12753 = df[3820];
+    const real t12909 = df[3077]*t3127+df[1350]*t2485+t12659*t615+df[2223]*t4023+df[3088]*
+t2487+t12664*t2091+t12897+t8709*(2.0*t1802+t2110+t2112+t2114+t2115+t2116+t2118+
+t2119+t1801)+df[1789]*t3175+df[3068]*t2541+df[3800]*(2.0*t6841+t4332+t4275+
+t4272+t4277+t4335+t4424+t4425+t6840)+t12753*t4298+t12676*t3878+t12678*t2631;
+    const real t12680 = df[3832];
+    const real t12685 = df[3752];
+    const real t12688 = df[785];
+    const real t12702 = df[1001];
+    const real t12707 = df[1012]*t1909;
+    const real t12933 = t12680*t4530+t7739*(2.0*t6712+t3931+t3857+t3858+t3860+t3934+t3898+
+t3899+t6709)+t12685*t4060+df[667]*t1208+t12688*t1434+t8160*(2.0*t3708+t3891+
+t3893+t3894+t3895+t3896+t3898+t3899+t3707)+t7671*(2.0*t7039+t3379+t3380+t3619+
+t3382+t3622+t3369+t3370+t7037)+df[2406]*t4384+df[326]*t559+t8760*(2.0*t435+t534
++t536+t538+t539+t540+t542+t543+t545)+t12702*t1450+df[335]*t575+df[96]*t197+
+t12707+t8615*t596;
+    const real t12711 = df[2438];
+    const real t12714 = df[3973]*t3348;
+    const real t12722 = df[4005];
+    const real t12725 = df[1630];
+    const real t12728 = df[3910];
+    const real t12950 = df[1657]*t2572+df[3942]*t3432+t12711*t4253+t12714+df[3960]*t3536+
+df[3847]*t4347+df[3987]*t3498+df[3978]*t3658+df[4011]*t3687+t12722*t3299+df
+[1638]*t2859+t12725*t2629+df[3858]*t4583+t12728*t4484;
+    const real t12953 = t8158*t4158;
+    const real t12731 = df[3918];
+    const real t12734 = df[3939]*t3326;
+    const real t12737 = df[3777];
+    const real t12746 = df[3358]*t1509;
+    const real t12748 = df[3155];
+    const real t12752 = df[460];
+    const real t12754 = df[448];
+    const real t12967 = df[3885]*t4556+t12731*t3297+t12953+t12734+df[3922]*t3394+t12737*
+t4482+df[3783]*t4197+df[3804]*t4381+df[481]*t572+df[473]*t556+t12746+t12748*
+t2093+t8741*t691+t12752*t768+t12754*t766;
+    const real t12764 = df[2287];
+    const real t12766 = df[2344];
+    const real t12770 = df[793];
+    const real t12773 = df[2470]*t4486;
+    const real t12775 = df[1057];
+    const real t12778 = df[437];
+    const real t12987 = t8691*(2.0*t2234+t1864+t2526+t2527+t2528+t2529+t1872+t1873+t2233)+
+df[1397]*t2575+df[1382]*t2544+df[2322]*t4217+df[1095]*t2062+t12764*t3876+t12766
+*t4255+df[802]*t1469+t12770*t1452+t12773+df[114]*t225+t12775*t1990+df[1034]*
+t1951+t12778*t507;
+    const real t12782 = df[530];
+    const real t12790 = df[3125]*t1466;
+    const real t12794 = df[731];
+    const real t12796 = df[727];
+    const real t12802 = df[173];
+    const real t12805 = t12084*t591;
+    const real t12809 = df[502]*t610;
+    const real t12810 = df[723];
+    const real t13009 = df[1068]*t2008+t12782*t904+df[1219]*t2277+df[2146]*t3817+t12790+df
+[717]*(2.0*t1257+t1015+t1026+t1018+t1020+t1029+t1043+t1044+t1255)+t12794*t1131+
+t12796*t1110+t8770*(2.0*t190+t150+t248+t149+t152+t251+t290+t291+t189)+df[185]*
+t336+t12802*t268+t12805+df[1137]*t2142+t12809+t12810*t1133;
+    const real t12820 = t7776*t6537;
+    const real t13040 = t8694*t2617*t73+t7671*t3623*t73+t126*t596*t77+t12820*t73+t8220*
+t2999*t73+t7493*(2.0*t6597+t3156+t3777+t3153+t3158+t3780+t3726+t3727+t3160*t73)
++t179*(2.0*t914+t876+t864+t866+t877+t870+t885+t886+t879*t73)+t4135*(t3728*t73+
+2.0*t3998+t3770+t3771+t3720+t3772+t3773+t3726+t3727)+t4991+t7576+t7579+t7582+
+t7587+t8442*t1690*t73+t7816*t1807*t73;
+    const real t13047 = t8681*t3371*t73+t7592+t7595+t12715+t8709*t2120*t73+t1+t12742+
+t12747+t12786+t12806+t12818+t12841+t12885+t12897+t12953+t12603*t1622;
+    const real t12906 = df[769];
+    const real t12908 = df[760];
+    const real t12911 = df[3960];
+    const real t12913 = df[473];
+    const real t12916 = df[1217];
+    const real t12918 = df[1899];
+    const real t12921 = df[3987];
+    const real t12925 = df[1168];
+    const real t13071 = t12605*t1624+t12906*t1275+t12908*t1181+t12911*t3536+t12913*t556+
+t12766*t4253+t12714+t12916*t2277+t12918*t3397+t12722*t3297+t12921*t3498+t12746+
+t12754*t768+t12752*t766+t12925*t2198;
+    const real t12876 = df[1602];
+    const real t12928 = df[481];
+    const real t12930 = df[1465];
+    const real t12932 = df[1137];
+    const real t12935 = df[1488];
+    const real t12943 = df[2526];
+    const real t12945 = df[3978];
+    const real t13098 = t12928*t572+t12930*t2692+t12932*t2142+t12630+t12935*t2731+t12586*
+t3351+t12581*t3329+df[435]*t507+t12622*t268+t12778*t512+t12943*t4586+t12945*
+t3658+t12796*t1108+t12810*t1131+t12563+t12876*t2689;
+    const real t12879 = df[3500];
+    const real t12898 = t12540;
+    const real t12951 = df[653];
+    const real t12963 = df[1569];
+    const real t12972 = df[335];
+    const real t12974 = df[326];
+    const real t13127 = t12951*t1184+t12879*t6450+t12494*t3331+t12627*t63+t12626+t8770*(
+2.0*t156+t148+t249+t149+t250+t153+t290+t291)+t8442*(2.0*t1716+t1812+t1682+t1813
++t1814+t1815+t1688+t1689)+t12963*t2862+df[3024]*t34+t12509+t12510*t1070+df[320]
+*t544+t12898*t2010+t12972*t575+t12974*t559;
+    const real t12904 = t12753;
+    const real t12976 = df[2512];
+    const real t12980 = df[857];
+    const real t12985 = df[3189];
+    const real t12988 = df[3198];
+    const real t12993 = df[1034];
+    const real t13156 = t12976*t4559+t12591+t12680*t4532+t12904*t4298+t12461+t12980*t1582+
+t12558*t1110+t12794*t1133+df[3177]*t2274+t12985*t2059+t12988*t2195+t7776*(2.0*
+t6365+t6630+t6533+t6532+t6535+t6631+t6633+t6634)+t12993*t1951+t12707+df[716]*(
+2.0*t1253+t1015+t1017+t1027+t1028+t1021+t1043+t1044)+t12523*t2367;
+    const real t12927 = df[3781];
+    const real t12999 = df[1382];
+    const real t13003 = df[3679];
+    const real t13010 = df[2390];
+    const real t13012 = df[1323];
+    const real t13185 = t12515+t12999*t2544+t12519*t2369+t12492*t3353+t13003*t4029+t12725*
+t2631+t12927*t4197+t12737*t4484+t13010*t4350+t13012*t2443+t12649*t1434+t8160*(
+t3900*t73+2.0*t3753+t3924+t3894+t3925+t3926+t3927+t3898+t3899)+t8691*(2.0*t1777
++t1864+t1866+t1868+t1869+t1870+t1872+t1873)+df[666]*t1208+t12702*t1452;
+    const real t13026 = df[2062];
+    const real t13029 = df[48];
+    const real t13046 = df[203];
+    const real t13214 = t12678*t2629+df[1608]*t2914+t13026*t3661+df[71]*t164+t13029*t115+
+t8681*(2.0*t3078+t3466+t3361+t3467+t3468+t3469+t3369+t3370)+t12486*t904+t8220*(
+2.0*t5462+t1931+t1933+t2996+t2997+t1937+t1872+t1873)+t12782*t906+df[1538]*t2790
++t12481+t12475*t61+t7549*t73+(2.0*t7593+t40+t41+t5003+t43+t5006+t5545+t5554)*
+t72+t13046*t112+t12552;
+    const real t13049 = df[2198];
+    const real t13054 = df[3047];
+    const real t13056 = df[3038];
+    const real t13061 = df[3537];
+    const real t13063 = df[3525];
+    const real t13067 = df[2101];
+    const real t13241 = t13049*t3949+t12554*t6561+df[184]*t336+t12526+t12485+t13054*t1948+
+t13056*t2440+t12470*t1905+t12472*t1907+t12802*t270+t12790+t13061*t6487+t13063*
+t6490+t12688*t1432+t13067*t3743;
+    const real t13069 = df[801];
+    const real t13073 = df[3697];
+    const real t13075 = df[2076];
+    const real t13078 = df[842];
+    const real t13085 = df[3068];
+    const real t13088 = df[1638];
+    const real t13090 = df[3077];
+    const real t13093 = df[1657];
+    const real t13267 = t13069*t1469+t12770*t1450+t12452+t13073*t3946+t13075*t3690+t12579*
+t1512+t12503+t13078*t1548+t12577*t1514+t8611*(2.0*t4162+t4416+t4418+t4420+t4421
++t4422+t4424+t4425)+t13085*t2541+t12711*t4255+t13088*t2859+t13090*t3127+df
+[2229]*t4023+t13093*t2572;
+    const real t13007 = t12683;
+    const real t13095 = df[243];
+    const real t13097 = df[260];
+    const real t13100 = df[3804];
+    const real t13107 = df[3088];
+    const real t13109 = df[3378];
+    const real t13111 = df[4011];
+    const real t13297 = t13095*t419+t13097*t416+t13100*t4381+df[3799]*(2.0*t6838+t4274+
+t4272+t4333+t4334+t4278+t4424+t4425)+t12664*t2093+t12748*t2091+t13107*t2487+
+t13109*t1650+t13111*t3687+t13007*t1579+t7816*(2.0*t5902+t1804+t1745+t1746+t1805
++t1750+t1688+t1689)+t12809+t12805+t7958*(2.0*t6999+t3620+t3378+t3379+t3621+
+t3383+t3369+t3370)+t8331*(2.0*t2356+t2602+t2604+t2614+t2615+t2608+t2761+t2762);
+    const real t13123 = df[3362];
+    const real t13125 = df[1397];
+    const real t13128 = df[215];
+    const real t13131 = df[1987];
+    const real t13155 = df[2406];
+    const real t13326 = t13123*t1545+t12529+t13125*t2575+t13128*t222+t12585+t13131*t3539+
+t12533*t615+t8534*t4990+t12572*t1068+t12592+t8727*(2.0*t972+t1036+t1038+t1039+
+t1040+t1041+t1043+t1044)+t12685*t4058+t7739*(2.0*t6787+t3932+t3857+t3856+t3933+
+t3861+t3898+t3899)+t12676*t3876+t12646+t13155*t4384;
+    const real t13051 = df[1349];
+    const real t13166 = df[2312];
+    const real t13169 = df[3922];
+    const real t13172 = df[3268];
+    const real t13182 = df[1789];
+    const real t13187 = df[114];
+    const real t13354 = t12643*t4530+t8709*(2.0*t1809+t2126+t2110+t2127+t2128+t2129+t2118+
+t2119)+t12728*t4482+t13166*t4217+t13169*t3394+t12731*t3299+t13172*t2139+t12615+
+t12497*t3251+t12636+t12659*t613+t8615*t594+t13182*t3175+t13051*t2485+t13187*
+t225;
+    const real t13066 = df[1959];
+    const real t13190 = df[1095];
+    const real t13194 = df[1812];
+    const real t13198 = df[3885];
+    const real t13201 = df[3619];
+    const real t13206 = df[1922];
+    const real t13209 = df[3652];
+    const real t13213 = df[1241];
+    const real t13223 = df[700];
+    const real t13381 = t13190*t2062+t13194*t3223+t13198*t4556+t12560*t6559+t13201*t3220+
+t8545*(2.0*t4874+t741+t534+t4962+t742+t4963+t542+t543)+t12589+t13206*t3435+
+t13209*t3172+t13213*t2317+t12567*t1990+t13066*t3496+t8760*(2.0*t409+t521+t523+
+t524+t525+t526+t528+t529)+t13223*t1278+t12773+t12466*t2662;
+    const real t13081 = df[1066];
+    const real t13236 = df[3942];
+    const real t13243 = df[3636];
+    const real t13246 = df[2146];
+    const real t13252 = df[895];
+    const real t13256 = df[3858];
+    const real t13258 = df[3847];
+    const real t13261 = df[3243];
+    const real t13407 = t8741*t689+t12482*t3253+t12632+t12734+t12557+t12544*t3274+t13236*
+t3432+t12653*t3272+t13243*t3740+t13246*t3817+t13081*t2008+t13252*t1653+t12478+
+t13256*t4583+t13258*t4347+t13261*t2314;
+    const real t13265 = df[1770];
+    const real t13281 = df[3711];
+    const real t13289 = t8770*t252;
+    const real t13438 = t13265*t3130+t8708*(2.0*t5595+t2229+t2179+t2180+t2230+t2184+t2118+
+t2119)+df[95]*t197+t12775*t1988+t12651*t4060+t13281*t3814+t12764*t3878+t12468*
+t2660+t8708*t2232*t73+t13289*t73+t8727*t1053*t73+df[717]*t1030*t73+t8585*t4518*
+t73+df[3800]*t4336*t73+t7739*t3935*t73+t8691*t2530*t73;
+    const real t13453 = t215*t1244*t212;
+    const real t13338 = t12927*t4217;
+    const real t13459 = t6+t179*(2.0*t910+t875+t864+t876+t877+t878+t909)+t7493*(2.0*t7433+
+t3719+t3720+t3771+t3772+t3724+t7423)+t4135*(2.0*t3976+t3153+t3155+t3156+t3158+
+t3159+t3968)+t4900+t4906+t13453+t1+t12806+t12818+t4890+t4892+t4896+t8442*(2.0*
+t1712+t1746+t1803+t1804+t1805+t1806+t1711)+t13338;
+    const real t13130 = df[3775]*t4486;
+    const real t13132 = t13012*t2440;
+    const real t13135 = t12932*t2139;
+    const real t13137 = df[1125]*t2117;
+    const real t13139 = df[3769]*t4534;
+    const real t13140 = df[636];
+    const real t13144 = df[644];
+    const real t13146 = df[3031];
+    const real t13148 = df[3025];
+    const real t13151 = t13054*t1951;
+    const real t13153 = t13056*t2443;
+    const real t13154 = df[2245];
+    const real t13158 = df[2228]*t4029;
+    const real t13348 = t13051*t2487;
+    const real t13476 = t13130+t13132+t13348+t13135+t13137+t13139+t13140*t1108+df[3023]*
+t5544+t13144*t1131+t13146*t1432+t13148*t1450+t13151+t13153+t13154*t4060+t13158;
+    const real t13159 = df[3734];
+    const real t13162 = df[990]*t1871;
+    const real t13167 = df[3209];
+    const real t13173 = df[521]*t901;
+    const real t13174 = df[924];
+    const real t13177 = df[515]*t884;
+    const real t13178 = df[500];
+    const real t13180 = df[2482];
+    const real t13184 = t12974*t556;
+    const real t13498 = t13159*t3876+t13162+df[312]*t527+t8760*t402+t12898*t2008+t13167*
+t1990+t8395*(2.0*t1861+t2228+t2180+t2229+t2230+t2231+t1858)+t13173+t13174*t1622
++t13177+t13178*t615+t13180*t4482+t8564*t596+t13184+df[319]*t541;
+    const real t13502 = t8464*t1702;
+    const real t13189 = df[3631]*t3276;
+    const real t13191 = t13201*t3223;
+    const real t13193 = t13265*t3127;
+    const real t13195 = t13190*t2059;
+    const real t13197 = t13111*t3690;
+    const real t13207 = df[3410];
+    const real t13211 = t13088*t2862;
+    const real t13212 = df[4021];
+    const real t13220 = t13010*t4347;
+    const real t13523 = t13189+t13191+t13193+t13502+t13195+t13197+t8160*(2.0*t3758+t3931+
+t3857+t3932+t3933+t3934+t3757)+df[4028]*(2.0*t7051+t3361+t3363+t3467+t3468+
+t3367+t7050)+t7816*(2.0*t5922+t1681+t1682+t1813+t1814+t1686+t5913)+t13207*t1514
++t13007*t1582+t13211+t13212*t3331+t8612*(2.0*t4131+t4332+t4272+t4333+t4334+
+t4335+t4130)+df[1607]*t2914+t13220;
+    const real t13221 = df[1633];
+    const real t13224 = df[1623]*t2633;
+    const real t13225 = df[301];
+    const real t13227 = df[2546];
+    const real t13230 = t12925*t2195;
+    const real t13232 = t13194*t3220;
+    const real t13234 = t13182*t3172;
+    const real t13235 = df[3307];
+    const real t13238 = t12928*t575;
+    const real t13240 = df[912]*t1687;
+    const real t13242 = df[3310];
+    const real t13245 = df[2428]*t4423;
+    const real t13247 = t13155*t4381;
+    const real t13248 = df[3575];
+    const real t13251 = df[3568]*t6563;
+    const real t13541 = t13221*t2660+t13224+t13225*t507+t13227*t4530+t13230+t13232+t13234+
+t13235*t1452+t13238+t13240+t13242*t1434+t13245+t13247+t13248*t6559+t13251;
+    const real t13253 = df[3580]*t6632;
+    const real t13255 = t12918*t3394;
+    const real t13259 = df[882];
+    const real t13262 = t13206*t3432;
+    const real t13263 = df[2468];
+    const real t13266 = t13252*t1650;
+    const real t13269 = t13187*t222;
+    const real t13271 = df[2496];
+    const real t13274 = t12913*t559;
+    const real t13275 = df[446];
+    const real t13278 = t13093*t2575;
+    const real t13280 = t13061*t6490;
+    const real t13561 = t13253+t13255+t7776*(2.0*t6343+t6531+t6532+t6533+t6535+t6536+t6342
+)+t13259*t1624+t13262+t13263*t4484+t13266+t13269+df[94]*t197+t13271*t4532+
+t13274+t13275*t768+t13278+t13280+t8691*(2.0*t2610+t1931+t2995+t2996+t2997+t2998
++t2601);
+    const real t13577 = t8176*t3978;
+    const real t13285 = t12980*t1579;
+    const real t13287 = t13078*t1545;
+    const real t13290 = df[1055]*t1985;
+    const real t13293 = t13029*t112;
+    const real t13294 = df[3264];
+    const real t13296 = df[3260];
+    const real t13299 = df[3555];
+    const real t13302 = t13172*t2142;
+    const real t13303 = df[3255];
+    const real t13306 = t13261*t2317;
+    const real t13307 = df[4038];
+    const real t13310 = t13213*t2314;
+    const real t13466 = t13081*t2010;
+    const real t13578 = t13285+t13287+t13466+t13290+df[70]*t164+t13293+t13294*t2369+t13296
+*t1988+t13299*t6561+t13302+t13303*t2367+t13306+t13307*t3353+t13310+t13577;
+    const real t13589 = t8463*t1705;
+    const real t13591 = t8062*t1247;
+    const real t13312 = df[575]*t1042;
+    const real t13317 = t13281*t3817;
+    const real t13319 = df[587]*t1065;
+    const real t13323 = t13246*t3814;
+    const real t13324 = df[3356];
+    const real t13328 = df[544];
+    const real t13330 = df[534];
+    const real t13332 = df[3706];
+    const real t13335 = t13073*t3949;
+    const real t13598 = t13312+t8727*(2.0*t969+t1015+t1026+t1027+t1028+t1029+t968)+t13317+
+t13319+t12619*t3498+df[182]*t336+t13323+t13589+t13324*t1512+t13591+t7951*t594+
+t13328*t904+t13330*t906+t13332*t3878+t13335+t8545*t4873;
+    const real t13608 = t8177*t3975;
+    const real t13337 = df[3762];
+    const real t13339 = df[622];
+    const real t13341 = df[609];
+    const real t13343 = df[3493];
+    const real t13346 = t13049*t3946;
+    const real t13347 = df[1301];
+    const real t13350 = df[2178]*t3897;
+    const real t13352 = df[2169]*t3873;
+    const real t13353 = df[233];
+    const real t13357 = t13128*t225;
+    const real t13359 = t13123*t1548;
+    const real t13361 = df[1271]*t2364;
+    const real t13363 = t13109*t1653;
+    const real t13365 = df[3371]*t1626;
+    const real t13617 = t13337*t4253+t13339*t1133+t13341*t1110+t13343*t3251+t13346+t13347*
+t1905+t13608+t13350+t13352+t13353*t61+t13357+t13359+t13361+t13363+t13365;
+    const real t13367 = t13046*t115;
+    const real t13372 = df[3720]*t4062;
+    const real t13374 = t13097*t419;
+    const real t13376 = df[3153]*t2095;
+    const real t13377 = df[33];
+    const real t13384 = t12908*t1184;
+    const real t13385 = df[274];
+    const real t13388 = df[783]*t1429;
+    const real t13390 = t12906*t1278;
+    const real t13393 = df[791]*t1447;
+    const real t13395 = t12988*t2198;
+    const real t13397 = t12985*t2062;
+    const real t13539 = t12611*t2277;
+    const real t13638 = t13367+t7739*(2.0*t6696+t3893+t3894+t3925+t3926+t3896+t6694)+
+t13372+t13374+t13376+t13377*t63+t8410*(2.0*t5562+t2114+t2110+t2127+t2128+t2116+
+t5561)+t13384+t13385*t268+t13388+t13390+t13539+t13393+t13395+t13397;
+    const real t13399 = df[826]*t1509;
+    const real t13401 = t13069*t1466;
+    const real t13403 = t13236*t3435;
+    const real t13405 = df[3971];
+    const real t13409 = t12911*t3539;
+    const real t13411 = df[2095]*t3725;
+    const real t13413 = t13075*t3687;
+    const real t13415 = t13003*t4023;
+    const real t13417 = t13067*t3740;
+    const real t13419 = t13026*t3658;
+    const real t13421 = t12916*t2274;
+    const real t13422 = df[1194];
+    const real t13428 = t12921*t3496;
+    const real t13658 = t13399+t13401+t13403+t12608*t2692+t13405*t3351+t13409+t13411+
+t13413+t13415+t13417+t13419+t13421+t13422*t2091+t8741*(2.0*t687+t534+t536+t741+
+t742+t540+t743)+t13428;
+    const real t13430 = t12945*t3661;
+    const real t13432 = t13095*t416;
+    const real t13439 = df[22]*t58;
+    const real t13440 = df[3937];
+    const real t13442 = df[1512];
+    const real t13445 = df[3112]*t1909;
+    const real t13451 = df[3123]*t1469;
+    const real t13452 = df[2746];
+    const real t13455 = df[2735];
+    const real t13458 = t12963*t2859;
+    const real t13460 = df[1561];
+    const real t13462 = df[749];
+    const real t13580 = df[1538];
+    const real t13679 = t13430+t13432+(t5536+t7541+t5549+t5550+t7542+t5553+t5554+t5552*t72
+)*t73+t7591*t72+t13439+t13440*t3329+t13442*t2662+t13445+t8220*(2.0*t5451+t2527+
+t1864+t1866+t1869+t2529+t5447)+t13580*t2790+t13451+t13452*t613+t13455*t766+
+t13458+t13460*t2629+t13462*t1068;
+    const real t13685 = t8158*t4161;
+    const real t13464 = df[740];
+    const real t13467 = df[1509]*t2760;
+    const real t13468 = t12935;
+    const real t13470 = df[2010];
+    const real t13473 = t13169*t3397;
+    const real t13475 = df[1867]*t3326;
+    const real t13478 = t13198*t4559;
+    const real t13480 = df[1887]*t3368;
+    const real t13482 = t12976*t4556;
+    const real t13484 = t12943*t4583;
+    const real t13485 = df[1428];
+    const real t13491 = t13131*t3536;
+    const real t13493 = t13223*t1275;
+    const real t13699 = t13464*t1070+t13467+t13468*t2731+t13685+t13470*t3297+t13473+t13475
++t13478+t13480+t13482+t13484+t13485*t2631+t8700*(2.0*t2324+t2602+t2613+t2614+
+t2615+t2616+t2323)+t13491+t13493;
+    const real t13704 = t8159*t4158;
+    const real t13495 = t13258*t4350;
+    const real t13496 = df[2258];
+    const real t13499 = df[3874];
+    const real t13503 = t13256*t4586;
+    const real t13504 = df[2307];
+    const real t13514 = df[3916]*t3301;
+    const real t13519 = t12993*t1948;
+    const real t13520 = df[1010];
+    const real t13524 = t13063*t6487;
+    const real t13724 = t13495+t13496*t4058+t13499*t4255+t13503+t13704+t13504*t3272+t12904
+*t4301+(2.0*t4902+t39+t40+t41+t43+t44+t35)*t67+df[715]*(2.0*t1251+t1039+t1049+
+t1036+t1040+t1052+t1249)+t13514+t8107*(2.0*t6908+t4416+t4515+t4418+t4421+t4517+
+t6903)+t13519+t13520*t1907+t13524+df[3513]*t6450+t12512*t4298;
+    const real t13528 = df[2342]*t4250;
+    const real t13530 = df[725]*t1112;
+    const real t13532 = df[721]*t1135;
+    const real t13534 = t13166*t4197;
+    const real t13536 = t12930*t2689;
+    const real t13538 = df[1444]*t2657;
+    const real t13540 = df[1877]*t3348;
+    const real t13546 = df[354]*t610;
+    const real t13548 = df[346]*t591;
+    const real t13550 = t12999*t2541;
+    const real t13552 = t13100*t4384;
+    const real t13554 = t13085*t2544;
+    const real t13556 = t13125*t2572;
+    const real t13558 = t13107*t2485;
+    const real t13744 = t13528+t13530+t13532+t13534+t13536+t13538+t13540+t8534*(2.0*t4987+
+t524+t4967+t521+t525+t4968+t743)+t13546+t13548+t13550+t13552+t13554+t13556+
+t13558;
+    const real t13560 = t13090*t3130;
+    const real t13564 = t12951*t1181;
+    const real t13566 = t13209*t3175;
+    const real t13567 = df[159];
+    const real t13570 = t12972*t572;
+    const real t13571 = df[3649];
+    const real t13574 = t13243*t3743;
+    const real t13576 = df[140]*t265;
+    const real t13582 = df[1850];
+    const real t13584 = df[1110];
+    const real t13586 = df[1837];
+    const real t13590 = df[1828]*t3248;
+    const real t13596 = df[154]*t289;
+    const real t13765 = t13560+df[665]*t1208+t13564+t13566+t13567*t270+t13570+t13571*t3253
++t13574+t13576+t8770*(2.0*t104+t149+t248+t249+t250+t251+t103)+t13582*t3299+
+t13584*t2093+t13586*t3274+t13590+t8673*(2.0*t3192+t3619+t3379+t3620+t3621+t3622
++t3189)+t13596;
+    const real t13783 = t7447+t7450+t7455+t7459+t4135*(t3160*t67+2.0*t4002+t3153+t3777+
+t3778+t3779+t3780)+t7493*(2.0*t7364+t3770+t3720+t3722+t3723+t3773+t3728*t67)+
+t179*(2.0*t891+t864+t866+t867+t869+t870+t879*t67)+t4991+t13453+t4898*t67+t1+
+t12806+t12818+t13502+t13577+t13589;
+    const real t13625 = df[3512];
+    const real t13809 = t13591+t13608+t13685+t13704+t8107*t4518*t67+t13289*t67+t8727*t1030
+*t67+t8395*t2232*t67+t8700*t2617*t67+t8691*t2999*t67+t13401+t13393+t13524+
+t13625*t6450+t13348+t13132+t13388;
+    const real t13842 = t8545*t4871+t13439+t13570+t13491+t13485*t2629+t8700*(2.0*t2307+
+t2602+t2604+t2605+t2607+t2608)+t13514+t13473+df[714]*(2.0*t1246+t1038+t1039+
+t1050+t1051+t1041)+t13530+t13532+t13493+t7951*t596+t13225*t512+t8760*t401+
+t13207*t1512;
+    const real t13877 = t13520*t1905+t13162+df[298]*t507+t13385*t270+t13460*t2631+t13184+
+t8673*t3623*t67+t7739*t3900*t67+t7816*t1690*t67+t8612*t4336*t67+t8410*t2120*t67
++t8220*t2530*t67+df[4028]*t3371*t67+t12820*t67+t13495+t13377*t61+t13372;
+    const real t13913 = t12876*t2692+t13307*t3351+t13290+t13519+t8691*(2.0*t1785+t1931+
+t1933+t1934+t1936+t1937)+t7816*(2.0*t6057+t1812+t1682+t1684+t1685+t1815)+t13538
++df[318]*t541+df[311]*t527+t13293+df[3820]*t4301+t13317+t13332*t3876+t8442*(2.0
+*t1691+t1745+t1746+t1747+t1749+t1750+t1807*t67)+t13066*t3498+t13335;
+    const real t13948 = t13415+df[2361]*t4298+t8612*(2.0*t4112+t4272+t4274+t4275+t4277+
+t4278)+t13552+t13193+t13482+t13271*t4530+df[13]*t34+t13376+t13539+t8410*(2.0*
+t5559+t2126+t2110+t2112+t2115+t2129)+t13405*t3353+t13458+t13528+t13428+t13430+
+t13534;
+    const real t13981 = t13361+df[1606]*t2914+t13245+t13323+t13337*t4255+t13462*t1070+
+t13464*t1068+t13390+t13384+t13417+t13411+t13220+df[715]*t1053*t67+df[3019]*
+t5544+t13148*t1452+t13247;
+    const real t14015 = df[3022]*t5552+t13546+t7739*(2.0*t6795+t3894+t3924+t3891+t3895+
+t3927)+t13413+t13466+t13548+t13470*t3299+t13195+t13419+t13159*t3878+(2.0*t7456+
+t40+t5003+t5004+t5005+t5006)*t50+t13584*t2091+t7539*t73+t7585*t72+t13442*t2660+
+t13467+t13234;
+    const real t13770 = df[1525];
+    const real t14050 = t13770*t2790+t13232+df[93]*t197+df[69]*t164+t8770*(2.0*t83+t148+
+t149+t150+t152+t153)+t13403+t13278+t13154*t4058+t13496*t4060+t13139+t8741*(2.0*
+t678+t523+t524+t736+t737+t526)+t13352+t13302+t13341*t1108+t13350+t13140*t1110;
+    const real t14085 = t13339*t1131+t13296*t1990+t13303*t2369+t13338+t13130+t13294*t2367+
+t13135+t13137+t13151+t13153+t13221*t2662+t13224+t13146*t1434+t13211+t13312+
+t13230+t13440*t3331;
+    const real t14122 = t13275*t766+t13422*t2093+t13238+t13144*t1133+t13421+t13558+t13560+
+t8709*(2.0*t1821+t2179+t2180+t2181+t2183+t2184)+t8103*(2.0*t6835+t4416+t4420+
+t4514+t4516+t4422)+t13158+t13263*t4482+t8160*(2.0*t3696+t3856+t3857+t3858+t3860
++t3861+t3935*t67)+t13346+t13536+df[1486]*t2731+df[431]*t544;
+    const real t14158 = t13397+t13197+t13324*t1514+t13299*t6559+t13280+t13269+t13582*t3297
++t13586*t3272+t13590+t13287+t13484+t13167*t1988+t13399+t13455*t768+t13395+t8534
+*(2.0*t4983+t534+t4962+t538+t539+t4963)+t13180*t4484;
+    const real t14194 = t13347*t1907+t13359+t8727*(2.0*t966+t1015+t1017+t1018+t1020+t1021)
++df[181]*t336+t13319+t13363+df[3399]*t1582+t13365+t13567*t268+t13596+t13576+
+t13452*t615+t13227*t4532+df[4027]*(2.0*t7048+t3466+t3361+t3365+t3366+t3469)+
+t13266+t13478;
+    const real t14229 = t13212*t3329+t13499*t4253+t13503+t13259*t1622+t13285+t13251+t13480
++t13328*t906+t13504*t3274+t13451+t13445+t13310+t8220*(2.0*t5443+t1864+t1868+
+t2526+t2528+t1870)+t13235*t1450+t13242*t1432+df[664]*t1208+t13178*t613;
+    const real t14263 = t8564*t594+t13173+t13177+t13274+t13564+t13554+t13343*t3253+t13409+
+t13374+t13432+t13330*t904+t13475+t7776*(2.0*t6426+t6532+t6630+t6642+t6643+t6631
+)+t13262+t13353*t63+t13556;
+    const real t14299 = t13240+t13174*t1624+t13550+t13255+t8681*(2.0*t3056+t3378+t3379+
+t3380+t3382+t3383)+t13566+t13571*t3251+t13357+t13367+t13306+df[3217]*t2008+
+t13574+t13189+t13191+t13253+t13540+t13248*t6561;
+    const real t13818 = df[171];
+    const real t13820 = df[987];
+    const real t13822 = df[978];
+    const real t13825 = df[970];
+    const real t13827 = df[958];
+    const real t13832 = df[3578];
+    const real t13834 = df[933];
+    const real t13836 = df[3551];
+    const real t13838 = df[3546];
+    const real t13840 = df[878];
+    const real t14320 = df[2688]*t473+t13818*t258+t13820*t1865+t13822*t1422+t8442*t1735+
+t13825*t1569+t13827*t1744+t7776*(2.0*t6480+t6543+t6454+t6456+t6479)+t13832*
+t6530+t13834*t1748+t13836*t6556+t13838*t6534+t13840*t1619;
+    const real t14321 = t9878*t6581;
+    const real t13843 = df[908];
+    const real t13846 = df[997];
+    const real t13848 = df[962];
+    const real t13852 = df[920];
+    const real t13855 = df[3566];
+    const real t13859 = df[823];
+    const real t14335 = t14321+t13843*t1683+df[891]*t1645+t13846*t1440+t13848*t1680+t713+
+t7493*t7360+t4135*t4764+t13852*t1615+df[914]*t1696+t13855*t6553+df[855]*t1574+
+t13859*t1502+df[797]*t1461;
+    const real t13863 = df[831];
+    const real t13865 = df[130];
+    const real t13868 = df[147];
+    const real t13870 = df[136];
+    const real t13872 = df[787];
+    const real t13874 = df[779];
+    const real t13881 = df[596];
+    const real t14350 = df[838]*t1540+t13863*t1505+t13865*t147+t8739*t1245+t13868*t52+
+t13870*t260+t13872*t1442+t13874*t1425+df[3521]*t6481+df[3512]*t6448+df[696]*
+t1270+df[689]*t1238+t13881*t1060;
+    const real t13883 = df[456];
+    const real t13888 = df[572];
+    const real t13890 = df[584];
+    const real t13892 = df[578];
+    const real t13894 = df[561];
+    const real t13898 = df[1215]*t2269;
+    const real t13899 = df[1251];
+    const real t14363 = t13883*t760+t179*(2.0*t888+t882+t883+t843+t887)+t7492+t7508+t7481+
+t7504+t13888*t1035+t13890*t1058+t13892*t1037+t13894*t1019+t8691*t2226+t13898+
+t13899*t1978+df[1237]*t2309;
+    const real t13903 = df[1190];
+    const real t13905 = df[1185];
+    const real t13909 = df[1122];
+    const real t13911 = df[566];
+    const real t13914 = df[1159];
+    const real t13916 = df[1128];
+    const real t13918 = df[1156];
+    const real t13920 = df[1106];
+    const real t14379 = df[239]*t411+t13903*t2084+t13905*t2178+df[1164]*t2190+t8709*t1818+
+t13909*t2111+t13911*t1016+t13914*t2182+t13916*t2113+t13918*t2049+t13920*t2088+
+df[1091]*t2053+df[1030]*t1943;
+    const real t13924 = df[1025];
+    const real t13927 = df[1079]*t2026;
+    const real t13928 = df[1051];
+    const real t13930 = df[1006];
+    const real t13932 = df[2613];
+    const real t13934 = df[2602];
+    const real t13938 = df[2492];
+    const real t13940 = df[2488];
+    const real t13942 = df[2478];
+    const real t13944 = df[2464];
+    const real t13947 = df[63];
+    const real t14394 = t13924*t1935+t13927+t13928*t1980+t13930*t1902+t13932*t4193+t13934*
+t3244+df[2522]*t4577+df[2508]*t4550+t13938*t4527+t13940*t4419+t13942*t4475+
+t13944*t4479+df[68]*t158+t13947*t151;
+    const real t13951 = df[2542];
+    const real t13956 = df[2434];
+    const real t13958 = df[2425];
+    const real t13960 = df[2381];
+    const real t13964 = df[2349];
+    const real t13966 = df[2338];
+    const real t13969 = df[2354];
+    const real t14410 = df[1133]*t2133+t13951*t4524+df[44]*t106+df[2402]*t4376+df[2386]*
+t4341+t13956*t4243+t13958*t4417+t13960*t4273+df[2359]*t4293+t13964*t4276+t13966
+*t4246+t8612*t4122+t13969*t4268;
+    const real t13975 = df[640];
+    const real t13977 = df[632];
+    const real t13979 = df[618];
+    const real t13982 = df[605];
+    const real t13985 = df[444]*t763;
+    const real t13988 = df[558];
+    const real t13992 = df[350];
+    const real t14426 = t9899*t4199+df[663]*t1203+df[649]*t1175+t13975*t1125+t13977*t1101+
+t13979*t1128+t13982*t1105+t13985+t8741*t677+t8727*t964+t13988*t993+t8103*t6831+
+df[1785]*t3167+t13992*t605;
+    const real t13994 = df[1825];
+    const real t13997 = df[1810]*t3213;
+    const real t13999 = df[1781];
+    const real t14001 = df[343];
+    const real t14007 = df[1672];
+    const real t14010 = df[1557];
+    const real t14446 = t13994*t3242+t13997+df[322]*t550+t13999*t3157+t14001*t585+df[331]*
+t567+df[1766]*t3122+df[8]*t17+t14007*t1932+t7739*t6691+t14010*t2623+t8331*(2.0*
+t2396+t2385+t2823+t2386+t2387)+df[1605]*t2908;
+    const real t14018 = df[314];
+    const real t14020 = df[308];
+    const real t14024 = df[1452];
+    const real t14026 = df[1440];
+    const real t14028 = df[302];
+    const real t14030 = df[294];
+    const real t14035 = df[1419];
+    const real t14038 = df[1414];
+    const real t14087 = df[1486]*t2726;
+    const real t14463 = t14087+t14018*t537+t14020*t520+df[1463]*t2684+t14024*t2650+t14026*
+t2652+t14028*t501+t14030*t503+t8760*t380+df[1393]*t2566+df[1378]*t2536+t14035*
+t2603+df[1565]*t2853+t14038*t2606;
+    const real t14040 = df[1424];
+    const real t14042 = df[1285];
+    const real t14044 = df[1268];
+    const real t14047 = df[1297];
+    const real t14049 = df[1370];
+    const real t14053 = df[1374];
+    const real t14056 = t13580*t2782;
+    const real t14060 = df[2303];
+    const real t14062 = df[2254];
+    const real t14118 = df[1364]*t2508;
+    const real t14479 = t14040*t2626+t14042*t2360+t14044*t2357+df[1319]*t2434+t14047*t1898
++t14049*t1847+t14118+t14053*t1867+t14056+df[292]*t480+t4895*t67+t14060*t3265+
+t14062*t4052;
+    const real t14064 = df[2241];
+    const real t14067 = df[2284];
+    const real t14070 = df[2118];
+    const real t14072 = df[2161];
+    const real t14074 = df[2159];
+    const real t14076 = df[2175];
+    const real t14078 = df[2165];
+    const real t14080 = df[2190];
+    const real t14082 = df[2186];
+    const real t14495 = t14064*t4055+df[2297]*t4152+t14067*t3866+df[2142]*t3808+t14070*
+t3154+t14072*t3859+t14074*t3851+t14076*t3890+t14078*t3868+t14080*t3855+t14082*
+t3892+df[2208]*t3969+df[2194]*t3940+df[2225]*t4014;
+    const real t14090 = df[2091];
+    const real t14093 = df[1967]*t3503;
+    const real t14094 = df[1942];
+    const real t14097 = df[1883];
+    const real t14099 = df[1874];
+    const real t14102 = df[1890];
+    const real t14104 = df[1863];
+    const real t14106 = df[1846];
+    const real t14108 = df[1833];
+    const real t14160 = df[1918]*t3426;
+    const real t14511 = t8160*t3680+t14090*t3721+t14093+t14094*t3362+t14160+t14097*t3364+
+t14099*t3341+df[1895]*t3388+t14102*t3381+t14104*t3322+t14106*t3294+t14108*t3269
++t7454*t50;
+    const real t14115 = df[2114];
+    const real t14119 = df[2047];
+    const real t14121 = df[2036];
+    const real t14124 = df[2028];
+    const real t14126 = df[2003];
+    const real t14129 = df[2006];
+    const real t14132 = df[18];
+    const real t14134 = df[14];
+    const real t14528 = (2.0*t7505+t5425+t5422+t719+t5429)*t37+df[2072]*t3681+t14115*t3718
++df[2097]*t3735+df[2058]*t3652+t14119*t3320+t14121*t3377+t14124*t3343+t14126*
+t3567+df[1983]*t3531+t14129*t3290+t8675*t3179+t14132*t54+t14134*t42;
+    const real t14141 = df[3017]*t5541;
+    const real t14144 = df[507];
+    const real t14148 = df[2717];
+    const real t14152 = df[2705];
+    const real t14154 = df[2702];
+    const real t14156 = df[2699];
+    const real t14159 = df[2690];
+    const real t14548 = t8770*(2.0*t49+t70+t46+t47+t48)+df[9]*t28+t14141+df[110]*t216+df
+[92]*t192+t14144*t868+t8410*t5566+t8534*t4978+t14148*t38+df[2716]*t3+t14152*
+t603+t14154*t587+t14156*t522+t14159*t505;
+    const real t14554 = t5539*t67;
+    const real t14557 = t5537*t50;
+    const real t14561 = t9805*t965;
+    const real t14162 = df[2696];
+    const real t14164 = df[2693];
+    const real t14171 = df[517];
+    const real t14173 = df[527];
+    const real t14176 = df[511];
+    const real t14179 = df[2733];
+    const real t14568 = t8545*t4870+t14162*t535+t14164*t498+df[180]*t329+(t12+t23+t7532+
+t5533+t25+t14554)*t73+(t5533+t2+t7580+t23+t5000+t14557)*t72+t14171*t896+t14561+
+t14173*t894+t7816*t5880+t14176*t865+t7671*t7046+t14179*t758+t8220*t5442;
+    const real t14183 = df[1160];
+    const real t14185 = df[526];
+    const real t14187 = df[518];
+    const real t14195 = df[3020]*t5541;
+    const real t14196 = df[1129];
+    const real t14198 = df[1121];
+    const real t14200 = df[921];
+    const real t14203 = df[909];
+    const real t14251 = df[1164]*t2190;
+    const real t14262 = df[1133]*t2133;
+    const real t14267 = df[2208]*t3969;
+    const real t14275 = df[914]*t1696;
+    const real t14587 = t14321+t14251+t14183*t2182+t14185*t896+t14187*t894+df[3016]*t15+
+t14262+t14267+t14195+t14196*t2111+t14198*t2113+t14200*t1615+t14275+t14203*t1680
+;
+    const real t14593 = t4717*t37;
+    const real t14596 = t4749*t37;
+    const real t14600 = t848*t37;
+    const real t14206 = df[879];
+    const real t14208 = df[2465];
+    const real t14219 = df[2184];
+    const real t14221 = df[2174];
+    const real t14223 = df[2191];
+    const real t14278 = df[891]*t1645;
+    const real t14287 = df[2194]*t3940;
+    const real t14606 = t14278+t14206*t1619+t14208*t4479+df[4029]*t7055+t14287+t713+t718+
+t7493*(t4192+t4875+t4716+t4719+t14593)+t4135*(t4192+t4716+t4718+t4719+t14596)+
+t179*(2.0*t874+t849+t873+t843+t14600)+t4927+t4930+t14219*t3851+t14221*t3892+
+t14223*t3855;
+    const real t14225 = df[2187];
+    const real t14227 = df[64];
+    const real t14230 = df[433];
+    const real t14232 = df[429];
+    const real t14234 = df[442];
+    const real t14236 = df[438];
+    const real t14238 = df[2092];
+    const real t14241 = df[457]*t763;
+    const real t14245 = df[19];
+    const real t14247 = df[15];
+    const real t14250 = df[854]*t1574;
+    const real t14322 = df[9]*t28;
+    const real t14625 = t14225*t3890+t14227*t151+t14093+t14230*t501+t14232*t537+t14234*
+t760+t14236*t503+t14238*t3718+t14241+t14322+df[5]*t17+t14245*t52+t14247*t42+
+t14250;
+    const real t14253 = df[426];
+    const real t14255 = df[832];
+    const real t14257 = df[822];
+    const real t14259 = df[1673];
+    const real t14264 = df[1884];
+    const real t14266 = df[2382];
+    const real t14269 = df[1891];
+    const real t14272 = df[2358]*t4293;
+    const real t14273 = df[2350];
+    const real t14333 = df[838]*t1540;
+    const real t14336 = df[2386]*t4341;
+    const real t14351 = df[1895]*t3388;
+    const real t14643 = t14333+t14336+t14253*t520+t14255*t1502+t14257*t1505+t14259*t1932+
+df[1919]*t3426+t14264*t3362+t14266*t4273+t14351+t14269*t3381+t14272+t14273*
+t4276+t8741*t669+df[422]*t480;
+    const real t14279 = df[641];
+    const real t14281 = df[2740];
+    const real t14284 = df[633];
+    const real t14286 = df[619];
+    const real t14288 = df[351];
+    const real t14290 = df[342];
+    const real t14292 = df[1052];
+    const real t14296 = df[315];
+    const real t14301 = df[2327]*t4199;
+    const real t14366 = df[649]*t1175;
+    const real t14384 = df[1030]*t1943;
+    const real t14388 = df[322]*t550;
+    const real t14395 = df[331]*t567;
+    const real t14660 = t14366+t14279*t1125+t14281*t758+t8534*t4975+t14284*t1101+t14286*
+t1128+t14288*t603+t14290*t587+t14292*t1978+t14384+t14388+t14296*t535+t14395+
+t14301;
+    const real t14668 = t3846*t37;
+    const real t14302 = df[1873];
+    const real t14304 = df[307];
+    const real t14306 = df[2339];
+    const real t14308 = df[1864];
+    const real t14310 = df[1847];
+    const real t14319 = df[1373];
+    const real t14324 = t14118;
+    const real t14325 = df[1782];
+    const real t14327 = df[2543];
+    const real t14417 = df[2522]*t4577;
+    const real t14683 = t14302*t3343+t14304*t522+t14306*t4243+t14308*t3320+t14310*t3294+df
+[2224]*t4014+t8160*(t14668+t3919+t3850+t3920+t3921)+t8694*(2.0*t2513+t2475+
+t2832+t2823)+t14056+t14319*t1865+t14324+t13997+t14325*t3157+t14327*t4524+t14417
+;
+    const real t14331 = df[1026];
+    const real t14337 = df[1298];
+    const real t14340 = df[788];
+    const real t14342 = df[780];
+    const real t14344 = df[157];
+    const real t14346 = df[3583];
+    const real t14352 = df[3552];
+    const real t14354 = df[3573];
+    const real t14356 = df[583];
+    const real t14419 = df[1319]*t2434;
+    const real t14422 = df[1237]*t2309;
+    const real t14424 = df[1378]*t2536;
+    const real t14427 = df[1785]*t3167;
+    const real t14702 = t14419+t14331*t1935+t14422+t14424+t14427+t14337*t1898+t8107*t6898+
+t14340*t1440+t14342*t1422+t14344*t260+t14346*t6530+t7776*(2.0*t6351+t6543+t6545
++t6348)+t14352*t6556+t14354*t6553+t14356*t1060;
+    const real t14359 = df[2000];
+    const real t14362 = df[579];
+    const real t14365 = df[571];
+    const real t14367 = df[567];
+    const real t14369 = df[562];
+    const real t14372 = df[555];
+    const real t14374 = df[137];
+    const real t14376 = df[2007];
+    const real t14381 = df[2493];
+    const real t14383 = df[2487];
+    const real t14452 = df[1983]*t3531;
+    const real t14469 = df[110]*t216;
+    const real t14472 = df[2508]*t4550;
+    const real t14718 = t8675*t3163+t14359*t3567+t14452+t14362*t1035+t14365*t1037+t14367*
+t1016+t14369*t1019+t8727*t960+t14372*t993+t14374*t258+t14376*t3290+t14469+
+t14472+t14381*t4527+t14383*t4417;
+    const real t14385 = df[2479];
+    const real t14387 = df[508];
+    const real t14389 = df[1107];
+    const real t14391 = df[498];
+    const real t14393 = df[490];
+    const real t14396 = df[2435];
+    const real t14398 = df[2424];
+    const real t14401 = df[2420];
+    const real t14409 = df[1088];
+    const real t14490 = df[2402]*t4376;
+    const real t14501 = df[1091]*t2053;
+    const real t14738 = t14385*t4475+t14387*t868+t14389*t2088+t14391*t605+t14393*t585+
+t14396*t4246+t14398*t4419+t8612*t4160+t14401*t4268+t14490+t7816*(t1739*t37+
+t1732+t1568+t1738+t1741)+t14501+t8709*t1793+t14409*t2049;
+    const real t14751 = t21*t37;
+    const real t14414 = df[131];
+    const real t14429 = df[2718];
+    const real t14433 = df[1191];
+    const real t14435 = df[1186];
+    const real t14505 = df[2097]*t3735;
+    const real t14508 = df[689]*t1238;
+    const real t14522 = df[663]*t1203;
+    const real t14764 = t14505+t13927+t14508+t14414*t147+t7776*t6544*t37+t7671*t3562*t37+
+t8103*t4285*t37+t14522+(t12+t14+t16+t18+t14751)*t67+(2.0*t4928+t719+t1307+t716)
+*t26+t14429*t38+df[2715]*t3+t13898+t14433*t2084+t14435*t2178;
+    const real t14437 = df[1415];
+    const real t14440 = df[1420];
+    const real t14442 = df[606];
+    const real t14444 = df[595];
+    const real t14447 = df[1007];
+    const real t14454 = df[295];
+    const real t14457 = df[993];
+    const real t14459 = df[986];
+    const real t14461 = df[979];
+    const real t14540 = df[1393]*t2566;
+    const real t14559 = df[1605]*t2908;
+    const real t14782 = t14437*t2606+t14540+t14440*t2603+t14442*t1105+t14444*t1058+t14447*
+t1902+t8545*t4868+t8200*t5557+df[291]*t477+t14559+t14454*t505+t8691*t1779+
+t14457*t1847+t14459*t1867+t14461*t1425;
+    const real t14783 = t1731*t37;
+    const real t14466 = df[2304];
+    const real t14468 = df[998];
+    const real t14470 = df[300];
+    const real t14473 = df[2283];
+    const real t14476 = df[2255];
+    const real t14478 = df[2603];
+    const real t14489 = df[1834];
+    const real t14579 = df[2297]*t4152;
+    const real t14582 = df[797]*t1461;
+    const real t14589 = df[2072]*t3681;
+    const real t14803 = t8442*(t1738+t1740+t1568+t1741+t14783)+t14466*t3265+t14468*t1442+
+t14470*t498+t14579+t14473*t3868+t14582+t14476*t4052+t14478*t3242+df[288]*t473+
+t14589+t7501*t37+(t8+t2+t14+t4996+t14557)*t73+(t14+t12+t4992+t18+t14554)*t72+
+t14489*t3269;
+    const real t14813 = t7*t37;
+    const real t14491 = df[1824];
+    const real t14493 = df[963];
+    const real t14496 = df[959];
+    const real t14498 = df[934];
+    const real t14500 = df[930];
+    const real t14506 = df[2027];
+    const real t14509 = df[2046];
+    const real t14512 = df[2037];
+    const real t14605 = df[2058]*t3652;
+    const real t14612 = df[239]*t411;
+    const real t14617 = df[180]*t329;
+    const real t14822 = t14491*t3244+t14493*t1683+t14496*t1744+t14498*t1748+t14500*t1569+
+t14605+t8760*t377+(t14+t2+t16+t4996+t14813)*t50+t14506*t3341+t14612+t14509*
+t3322+t14512*t3377+t8220*t5529+t14617;
+    const real t14517 = df[1558];
+    const real t14519 = df[2242];
+    const real t14523 = df[3547];
+    const real t14534 = df[2598];
+    const real t14619 = df[1565]*t2853;
+    const real t14626 = df[92]*t192;
+    const real t14628 = df[68]*t158;
+    const real t14636 = df[1766]*t3122;
+    const real t14638 = df[3521]*t6481;
+    const real t14639 = t13625*t6448;
+    const real t14642 = df[44]*t106;
+    const real t14647 = df[696]*t1270;
+    const real t14840 = t14619+t14517*t2623+t14519*t4055+t14626+t14628+t14523*t6534+t13468
+*t2726+t8739*t1223+df[2956]*t715+t14636+t14638+t14639+t14642+t14534*t4193+
+t14647;
+    const real t14854 = t3844*t37;
+    const real t14537 = df[31];
+    const real t14539 = df[512];
+    const real t14541 = df[1943];
+    const real t14546 = df[2119];
+    const real t14549 = df[2115];
+    const real t14551 = df[2162];
+    const real t14555 = df[2166];
+    const real t14558 = df[1441];
+    const real t14564 = df[1461]*t2684;
+    const real t14565 = df[1453];
+    const real t14567 = df[1267];
+    const real t14570 = df[1252];
+    const real t14661 = df[2142]*t3808;
+    const real t14861 = t14537*t54+t14539*t865+t14541*t3364+t8770*(2.0*t36+t27+t70+t76)+
+t14546*t3154+t14549*t3721+t14551*t3859+t14661+t14555*t3866+t14558*t2650+t7739*(
+t3915+t3850+t3920+t3921+t14854)+t14564+t14565*t2652+t14567*t2360+t14570*t1980;
+    const real t14875 = t8331*t2821*t37;
+    const real t14887 = t8770*t75*t37;
+    const real t14574 = df[1425];
+    const real t14576 = df[1284];
+    const real t14888 = t14574*t2626+t14576*t2357+t8741*t492*t37+t8727*t997*t37+t8739*
+t1002*t37+t8709*t2173*t37+t8691*t1926*t37+t14875+t8534*t486*t37+t8675*t3571*t37
++t8612*t4283*t37+t8220*t1880*t37+t8410*t2045*t37+t14887+t14561;
+    const real t14620 = t14278;
+    const real t14624 = t14351;
+    const real t14915 = t14321+t713+t718+t4917+t4135*(t14593+t4875+t4192+t4876)+t179*(2.0*
+t862+t849+t843+t853*t26+t14600)+t7493*(t14596+t4192+t4718+t4876)+t8709*t2045*
+t37+t8691*t1880*t37+t8694*t2824*t26+t8675*t3562*t37+t14620+t14206*t1615+t14555*
+t3868+t14624;
+    const real t14629 = t14661;
+    const real t14641 = t14336;
+    const real t14645 = t14333;
+    const real t14943 = t14281*t760+t14551*t3855+t14629+t8534*t4974+t14269*t3377+t14264*
+t3364+df[420]*t473+t14302*t3341+df[424]*t477+t8741*t662+t14198*t2111+t14641+
+t14266*t4276+t14250+t14645+t14255*t1505;
+    const real t14657 = t14417;
+    const real t14659 = t14472;
+    const real t14667 = df[1963]*t3503;
+    const real t14671 = t14160;
+    const real t14753 = df[1077]*t2026;
+    const real t14970 = t7739*(t3850+t3919+t3916+t14668)+t8220*t5528+t14196*t2113+t8103*
+t6822+t8323*(2.0*t2451+t2832+t2823)+t14227*t147+t14657+t14659+t14409*t2047+
+t14753+t14292*t1980+df[2506]*t4268+t14667+t8585*t4262+t14671;
+    const real t14675 = t14522;
+    const real t14680 = t14638;
+    const real t14691 = t14419;
+    const real t15000 = t14286*t1125+t14541*t3362+t14675+t14444*t1060+t14356*t1058+t14442*
+t1101+t14680+t14362*t1037+t14365*t1035+t14367*t1019+t14327*t4527+t14381*t4524+
+t14383*t4419+t14385*t4479+t14208*t4475+t14691;
+    const real t14698 = t14636;
+    const real t14700 = t14642;
+    const real t14705 = t14384;
+    const real t15028 = t14372*t1004+t8727*t959+df[552]*t993+t14537*t52+t14698+t14700+
+t14247*t38+t14245*t54+t14705+t14331*t1932+t8691*t1784+df[1023]*t1847+t14447*
+t1898+t14468*t1440+t14565*t2650;
+    const real t14719 = t7776*t6546;
+    const real t14812 = t8770*t80;
+    const real t15061 = t14369*t1016+t8612*t4285*t37+t8220*t1926*t37+t14719*t26+t8103*
+t4283*t37+t7671*t3571*t37+t8410*t2173*t37+t14812*t26+t8760*t492*t37+t8727*t1002
+*t37+t8739*t997*t37+t8442*t1739*t37+t8545*t486*t37+t14564+t14457*t1878+t14558*
+t2652;
+    const real t14749 = t14505;
+    const real t15090 = t14574*t2623+t14440*t2606+t14567*t2357+t14259*t1935+t14546*t3157+
+t14549*t3718+t14749+t14238*t3721+t8673*t3313+df[2088]*t3567+t14429*t42+df[2714]
+*t17+t4888*t67+(2.0*t4915+t719+t716)*t20+t4924*t26;
+    const real t14767 = t14617;
+    const real t14770 = t14395;
+    const real t14774 = t14501;
+    const real t14778 = t14582;
+    const real t15118 = df[2955]*t715+t14767+t14344*t258+t14770+t14288*t605+t14389*t2084+
+t14774+t14570*t1978+t14257*t1502+t14778+t14340*t1442+t14308*t3322+t14310*t3290+
+t8708*t5609+t14272+t14489*t3265;
+    const real t14789 = t14422;
+    const real t14797 = t14589;
+    const real t14800 = t14469;
+    const real t14802 = t14626;
+    const real t14805 = t14628;
+    const real t14807 = df[1213]*t2269;
+    const real t15145 = t14273*t4273+t14306*t4246+t14301+t14789+t14374*t260+t14414*t151+df
+[2669]*t4193+t14290*t585+t8545*t4867+t14797+t14342*t1425+t14800+t14802+t14805+
+t14807;
+    const real t14811 = t14647;
+    const real t14814 = t14508;
+    const real t14820 = t14579;
+    const real t14826 = df[1807]*t3213;
+    const real t14828 = t14427;
+    const real t14830 = t14605;
+    const real t14833 = t14559;
+    const real t15170 = t14433*t2088+t14435*t2182+t14811+t14814+t8739*t1201+df[713]*t1306+
+t14466*t3269+t14820+t14473*t3866+t14437*t2603+t14491*t3242+t14826+t14828+t14830
++t14509*t3320+t14833;
+    const real t14842 = t14540;
+    const real t14845 = t14322;
+    const real t14905 = df[2220]*t4014;
+    const real t15200 = t14325*t3154+t14476*t4055+t14478*t3244+t14534*t4715+t14519*t4052+
+t14905+t14842+t14461*t1422+t14845+df[7]*t15+df[3]*t13+df[2]*t3+t12879*t6448+
+t14493*t1680+t14496*t1748;
+    const real t14862 = t14366;
+    const real t14871 = t14275;
+    const real t15228 = t14279*t1128+t14284*t1105+df[284]*t480+t14862+t8760*t376+t14539*
+t868+t14387*t865+t8442*t1554+df[928]*t1569+t14200*t1619+t14871+t8218*t7033+
+t14219*t3848+df[2182]*t3851+t14187*t896+t14391*t603;
+    const real t14881 = t14251;
+    const real t14884 = t14262;
+    const real t14886 = t14612;
+    const real t14892 = t14087;
+    const real t15257 = t14393*t587+t14881+t14183*t2178+t14884+t14886+t14498*t1744+t14221*
+t3890+t14195+t14892+t14241+df[286]*t484+t14185*t894+t14203*t1683+t14500*t1737+
+t14234*t758;
+    const real t15281 = t5539*t50;
+    const real t15284 = t5537*t67;
+    const real t14907 = t14490;
+    const real t14923 = t13770*t2782;
+    const real t15290 = t14236*t498+t14253*t522+t14396*t4243+t14230*t505+t14232*t535+
+t14398*t4417+t14401*t4287+t14907+t8770*(2.0*t22+t70+t76)+t14459*t1865+t7446*t50
++(t714+t1305+t5425+t1304*t26)*t37+(t12+t16+t4993+t14751+t15281)*t73+(t2+t16+t9+
+t14813+t15284)*t72+t14923+t8160*(t14854+t3850+t3915+t3916);
+    const real t14929 = t14267;
+    const real t14931 = t14287;
+    const real t14947 = t14424;
+    const real t15322 = t14223*t3859+t14225*t3892+t14929+t14931+t14337*t1902+t8372*t1976+
+df[1293]*t2049+t14576*t2360+t7776*(2.0*t6404+t6545+t6543+t6544*t37)+t14506*
+t3343+t14376*t3294+t14512*t3381+t14359*t3565+t14947+t14319*t1867+t7816*(t14783+
+t1740+t1568+t1733);
+    const real t14953 = t14452;
+    const real t14955 = t14619;
+    const real t14959 = t14388;
+    const real t15346 = t14324+t14354*t6556+t14953+t14955+t14523*t6530+t14517*t2626+t14959
++t14296*t537+t14470*t503+t14454*t501+t14346*t6534+t14304*t520+t14352*t6553+
+t14875+t14887+t14561;
+    const real t15377 = t14321+t713+t179*(2.0*t859+t843+t853*t37)+t4943+t14767+t13818*t260
++t13868*t54+t13870*t258+t13846*t1442+df[994]*t1880+t13820*t1867+df[977]*(2.0*
+t1754+t1846)+t14812*t37+t8331*t2824*t37;
+    const real t15407 = t14719*t37+t13822*t1425+t14171*t894+t13825*t1737+t14176*t868+
+t14144*t865+df[506]*t848+t13883*t758+t14007*t1935+t13956*t4246+t14667+t14094*
+t3364+t13958*t4419+df[2421]*t4285+t14671;
+    const real t15441 = t13865*t151+t14800+t14802+t14749+t14090*t3718+df[2087]*t3571+df
+[2684]*(2.0*t4865+t479)+t14955+t14010*t2626+df[1553]*t2821+t14624+t14102*t3377+
+t14097*t3362+t14099*t3343+t14884;
+    const real t15474 = t13916*t2111+df[712]*t1304+t14811+t13975*t1128+t13977*t1105+df
+[2348]*(2.0*t4109+t4267)+t13969*t4287+t13964*t4273+df[2668]*t4749+t13966*t4243+
+df[2330]*t4199+t13947*t147+t14700+df[28]*t75+t14789;
+    const real t15505 = t13899*t1980+t13924*t1932+df[4]*t15+df[1]*t7+t14828+t13999*t3154+
+t14698+df[1022]*t1926+t13944*t4475+t14645+t13940*t4417+t13942*t4479+t13930*
+t1898+t13938*t4524;
+    const real t15538 = t14126*t3565+t14129*t3294+df[1999]*t3562+t14953+t13903*t2088+
+t13905*t2182+t13918*t2047+t14691+t14881+t13914*t2178+t7913*(2.0*t4+t2)+df[2183]
+*t3844+t14082*t3890+df[2181]*t3846+t14076*t3892;
+    const real t15572 = t14078*t3866+t14072*t3855+t14074*t3848+t13863*t1502+t13859*t1505+
+t14629+t14047*t1902+df[1292]*t2173+t14042*t2357+df[1283]*(2.0*t1940+t2044)+
+t14044*t2360+t14778+t13872*t1440+df[554]*t1002+df[551]*t997;
+    const real t15608 = df[550]*(2.0*t956+t992)+df[2086]*(2.0*t3287+t3564)+t14797+t8694*(
+2.0*t2533+t2823)+t13874*t1422+t13988*t1004+df[2599]*t4717+t13932*t4715+t13934*
+t3242+t14830+t14119*t3322+t14121*t3381+t14124*t3341+t14833+t14179*t760;
+    const real t15642 = t14148*t42+df[2713]*t21+t7921*(2.0*t4952+t12)+(2.0*t4941+t719)*t5+
+t14152*t605+t14154*t585+df[418]*t715+t14907+t13985+t8506*t655+t14641+t14805+
+t13960*t4276+df[2357]*t4293;
+    const real t15668 = t7479*t37+t14156*t520+t14162*t537+t14164*t503+t14159*t501+df[2686]
+*t492+t14070*t3157+t14173*t896+t14040*t2623+t14141+t15284*t73+t15281*t72+t13979
+*t1125+t13982*t1101+t13892*t1035;
+    const real t15702 = t13855*t6556+t13881*t1058+t13890*t1060+df[3550]*t6544+t13836*t6553
++df[2954]*t1306+t14753+t14035*t2606+t14038*t2603+t14842+t14947+t14053*t1865+df
+[287]*t486+df[283]*t477+df[282]*(2.0*t372+t472);
+    const real t15734 = t13840*t1615+t14657+t14115*t3721+t13838*t6530+t14659+df[2505]*
+t4283+df[852]*(2.0*t1343+t1568)+t14639+df[853]*t1574+t13888*t1037+t13928*t1978+
+t13911*t1019+t13894*t1016+t14132*t52+t14134*t38;
+    const real t15765 = t14845+df[6]*t13+t14862+t14886+t14814+t14675+t14905+t14680+t14049*
+t1878+t14931+t14080*t3859+df[1363]*t2508+t14929+t14705;
+    const real t15803 = t8770*(2.0*t19+t70)+t14923+t14104*t3320+t7776*(2.0*t6361+t6543)+
+t13832*t6534+t13909*t2113+t13920*t2084+t14774+df[1087]*t2045+df[2311]*(2.0*
+t4085+t4192)+t14108*t3265+t14106*t3290+t13994*t3244+df[2295]*(2.0*t3864+t3850)+
+t14060*t3269;
+    const real t15835 = t14820+t13848*t1683+t13951*t4527+t13827*t1748+t13834*t1744+df[931]
+*t1739+df[927]*t1731+t14062*t4055+t14064*t4052+t13852*t1619+t14067*t3868+t13992
+*t603+t14001*t587+t14770+t14959;
+    const real t15863 = t14028*t505+t14030*t498+t14018*t535+t14024*t2652+t14020*t522+df
+[290]*t484+t14892+t14826+t14871+t14564+t13843*t1680+t14026*t2650+t14620+t14807+
+t14561;
+    const real t15280 = t8881+t7705*t6859+t7874*t2351+df[2611]*t3199+t633+t8805+df[1207]*
+t2033+df[1265]*t2303+t8370*t2069+df[1346]*t2480+df[1527]*t2785+t8914;
+    const real t15297 = t8943+df[1981]*t3461+t8217*t3151+df[1736]*t2787+t7847*t5646+t7846*
+t1495+t8284*t2755+t8282*t2816+t8275*t3201+t8446*t1757+df[1084]*t2037+t8971;
+    const real t15326 = t9000+t9036+t9075+t9107+df[1953]*t3486+df[1980]*t3524+df[819]*
+t1495+df[2325]*t4222+df[1082]*t2033+df[3593]*t6444+df[2629]*t3481+df[2654]*
+t3600+df[2582]*t4226+df[2592]*t4215+df[407]*t141+df[1697]*t2720+df[2274]*t4007;
+    const real t15351 = df[2280]*t4018+df[2291]*t4005+df[2936]*t2256+df[2945]*t2039+df
+[939]*t1757+t8066*t4668+t8086*t4545+t7816*t6051+t7615*t7287+t7661*t7017+t7809*
+t6110+t8823*t1761+t7952*t5305+t8826*t4012+t8160*t3901+df[973]*t1610+t8217*t3138
+;
+    const real t15358 = t9954+t9970+t9987+t10004+t10021+t10038+t10055+t10072+t10091+t10107
++t10124+t10143+t10161+t10177+t10195+t10210;
+    const real t15359 = t10231+t10239+t10257+t10276+t10296+t10313+t10331+t10350+t10370+
+t10387+t10407+t10425+t10445+t10462+t10480+t10497;
+    const real t15360 = t10519+t10520+t10522+t10523+t10544+t10564+t10588+t10608+t10631+
+t10652+t10673+t10695+t10720+t10743+t10766+t10789;
+    const real t15361 = t10812+t10813+t10815+t10821+t10851+t10881+t10911+t10947+t10981+
+t11012+t11047+t11075+t11109+t11138+t11171+t11203;
+    const real t15362 = t11219+t11240+t11261+t11278+t11298+t11316+t11337+t11357+t11381+
+t11398+t11419+t11441+t11460+t11481+t11501+t11521;
+    const real t15363 = t11534+t11551+t11573+t11597+t11623+t11646+t11674+t11698+t11727+
+t11750+t11775+t11801+t11824+t11847+t11868+t11891;
+    const real t15364 = t11905+t11906+t11908+t11925+t11953+t11977+t12005+t12035+t12065+
+t12091+t12117+t12141+t12168+t12194+t12219+t12244;
+    const real t15365 = t12275+t12276+t12278+t12287+t12320+t12358+t12392+t12425+t12464+
+t12498+t12528+t12565+t12601+t12637+t12668+t12700;
+    const real t15366 = t12718+t12735+t12751+t12769+t12788+t12811+t12829+t12850+t12870+
+t12887+t12909+t12933+t12950+t12967+t12987+t13009;
+    const real t15367 = t13040+t13047+t13071+t13098+t13127+t13156+t13185+t13214+t13241+
+t13267+t13297+t13326+t13354+t13381+t13407+t13438;
+    const real t15368 = t13459+t13476+t13498+t13523+t13541+t13561+t13578+t13598+t13617+
+t13638+t13658+t13679+t13699+t13724+t13744+t13765;
+    const real t15369 = t13783+t13809+t13842+t13877+t13913+t13948+t13981+t14015+t14050+
+t14085+t14122+t14158+t14194+t14229+t14263+t14299;
+    const real t15370 = t14320+t14335+t14350+t14363+t14379+t14394+t14410+t14426+t14446+
+t14463+t14479+t14495+t14511+t14528+t14548+t14568;
+    const real t15371 = t14587+t14606+t14625+t14643+t14660+t14683+t14702+t14718+t14738+
+t14764+t14782+t14803+t14822+t14840+t14861+t14888;
+    const real t15372 = t14915+t14943+t14970+t15000+t15028+t15061+t15090+t15118+t15145+
+t15170+t15200+t15228+t15257+t15290+t15322+t15346;
+    const real t15373 = t15377+t15407+t15441+t15474+t15505+t15538+t15572+t15608+t15642+
+t15668+t15702+t15734+t15765+t15803+t15835+t15863;
+
+    g[0] = t6837+t7679+t7387;
+    g[1] = t7493*t6585+t4191+t4882+t4073;
+    g[2] = t7493*t7442+t2406+t3150+t4135*t4774+t2202;
+    g[3] = t5234+t5409+t7493*t7411+t5339+t4135*t3987+t2341*t2158;
+    g[4] = t6079+t6389+t7493*t7436+t6181+t2404*t5321+t4135*t4739+t2341*
+t2929;
+    g[5] = t5720+t6016+t7493*t7419+t3116*t6167+t5702+t2404*t5127+t4135*
+t4746+t2341*t2944;
+    g[6] = t8718+t8733+t8751+t8765;
+    g[7] = t8786+t8806+t8831+t8856;
+    g[8] = t15280+t15297;
+    g[9] = t15326+t15351;
+    g[10] = t9124+t9140+t9157+t9175+t9194+t9210+t9228+t9242;
+    g[11] = t9259+t9279+t9301+t9324+t9348+t9370+t9395+t9409;
+    g[12] = t9431+t9455+t9477+t9498+t9520+t9539+t9561+t9579;
+    g[13] = t9602+t9627+t9655+t9679+t9707+t9734+t9762+t9786;
+    g[14] = t9801+t9815+t9832+t9852+t9875+t9896+t9916+t9936;
+    g[15] = t15358;
+    g[16] = t15359;
+    g[17] = t15360;
+    g[18] = t15361;
+    g[19] = t15362;
+    g[20] = t15363;
+    g[21] = t15364;
+    g[22] = t15365;
+    g[23] = t15366;
+    g[24] = t15367;
+    g[25] = t15368;
+    g[26] = t15369;
+    g[27] = t15370;
+    g[28] = t15371;
+    g[29] = t15372;
+    g[30] = t15373;
+
+    return t4988+t7682;
+}
+
+//
+// poly_2b_v6x_eval_batch in chunks of lanes::width dimers
+//
+
+template <typename lanes>
+void poly_2b_v6x_eval_lanes(const double a[1153],
+                            const double x[31][poly_2b_v6x_batch],
+                                  double g[31][poly_2b_v6x_batch],
+                                  double e[poly_2b_v6x_batch],
+                                  double scratch[poly_2b_v6x_scratch_size])
+{
+    lanes* df = mbpol_simd::aligned_lanes<lanes>(scratch);
+    for (unsigned k = 0; k < poly_2b_v6x_batch; k += lanes::width) {
+        lanes xl[31], gl[31];
+        for (unsigned i = 0; i < 31; ++i)
+            xl[i] = lanes::load(x[i] + k);
+
+        const lanes el = poly_2b_v6x_eval_t<lanes>(a, xl, gl, df);
+
+        for (unsigned i = 0; i < 31; ++i)
+            gl[i].store(g[i] + k);
+        el.store(e + k);
+    }
+}
+
+template <typename lanes>
+void poly_2b_v6x_eval_lanes(const double a[1153],
+                            const double x[31][poly_2b_v6x_batch],
+                                  double e[poly_2b_v6x_batch],
+                                  double scratch[poly_2b_v6x_scratch_size])
+{
+    lanes* df = mbpol_simd::aligned_lanes<lanes>(scratch);
+    for (unsigned k = 0; k < poly_2b_v6x_batch; k += lanes::width) {
+        lanes xl[31];
+        for (unsigned i = 0; i < 31; ++i)
+            xl[i] = lanes::load(x[i] + k);
+
+        poly_2b_v6x_eval_t<lanes>(a, xl, mbpol_simd::no_gradients(), df).store(e + k);
+    }
+}
+
+void poly_2b_v6x_eval_avx2(const double a[1153],
+                           const double x[31][poly_2b_v6x_batch],
+                                 double g[31][poly_2b_v6x_batch],
+                                 double e[poly_2b_v6x_batch],
+                                 double scratch[poly_2b_v6x_scratch_size]);
+
+void poly_2b_v6x_eval_avx2(const double a[1153],
+                           const double x[31][poly_2b_v6x_batch],
+                                 double e[poly_2b_v6x_batch],
+                                 double scratch[poly_2b_v6x_scratch_size]);
+
+void poly_2b_v6x_eval_avx512(const double a[1153],
+                             const double x[31][poly_2b_v6x_batch],
+                                   double g[31][poly_2b_v6x_batch],
+                                   double e[poly_2b_v6x_batch],
+                                   double scratch[poly_2b_v6x_scratch_size]);
+
+void poly_2b_v6x_eval_avx512(const double a[1153],
+                             const double x[31][poly_2b_v6x_batch],
+                                   double e[poly_2b_v6x_batch],
+                                   double scratch[poly_2b_v6x_scratch_size]);
+
+#endif // POLY_2B_V6X_IMPL_H
@@ -6,8 +6,38 @@
 // this is the polynomial used by x2b_v6<4> (including gradients)
 //
 
+double poly_2b_v6x_eval(const double a[1153],
+                         const double x[31]);
+
 double poly_2b_v6x_eval(const double a[1153],
                          const double x[31],
                                double g[31]);
 
+//
+// batched evaluation of poly_2b_v6x_batch dimers; variables and gradients
+// are stored structure-of-arrays (x[variable][dimer]) and the energy of each
+// dimer is returned in e[dimer]; the overload without g computes the
+// energies only. Uses AVX-512 or AVX2 lanes when the CPU supports them and
+// falls back to poly_2b_v6x_eval otherwise.
+//
+// The derivatives of the intermediate terms, 4138 values per lane, are kept
+// in scratch rather than on the stack: poly_2b_v6x_scratch_size doubles
+// owned by the caller, which can be reused from one call to the next but
+// not shared between threads.
+//
+
+const unsigned poly_2b_v6x_batch = 8;
+const unsigned poly_2b_v6x_scratch_size = (4138 + 1)*poly_2b_v6x_batch;
+
+void poly_2b_v6x_eval_batch(const double a[1153],
+                            const double x[31][poly_2b_v6x_batch],
+                                  double g[31][poly_2b_v6x_batch],
+                                  double e[poly_2b_v6x_batch],
+                                  double scratch[poly_2b_v6x_scratch_size]);
+
+void poly_2b_v6x_eval_batch(const double a[1153],
+                            const double x[31][poly_2b_v6x_batch],
+                                  double e[poly_2b_v6x_batch],
+                                  double scratch[poly_2b_v6x_scratch_size]);
+
 #endif // POLY_2B_V6X_H
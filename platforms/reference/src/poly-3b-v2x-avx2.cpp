@@ -0,0 +1,25 @@
+//
+// poly_3b_v2x::eval_batch with AVX2 lanes, compiled with -mavx2 -mfma
+//
+
+#include "poly-3b-v2x-impl.h"
+#include "mbpol_simd.h"
+
+#if defined(__AVX2__)
+
+void poly_3b_v2x_eval_avx2(const double a[1163],
+                           const double x[36][poly_3b_v2x::batch],
+                                 double g[36][poly_3b_v2x::batch],
+                                 double e[poly_3b_v2x::batch])
+{
+    poly_3b_v2x_eval_lanes<mbpol_simd::lanes4>(a, x, g, e);
+}
+
+void poly_3b_v2x_eval_avx2(const double a[1163],
+                           const double x[36][poly_3b_v2x::batch],
+                                 double e[poly_3b_v2x::batch])
+{
+    poly_3b_v2x_eval_lanes<mbpol_simd::lanes4>(a, x, e);
+}
+
+#endif // __AVX2__
@@ -15,6 +15,25 @@ struct poly_3b_v2x {
     static double eval(const double a[1163],
                        const double x[36],
                              double g[36]);
+
+    //
+    // batched evaluation of 'batch' trimers; variables and gradients are
+    // stored structure-of-arrays (x[variable][trimer]) and the energy of
+    // each trimer is returned in e[trimer]; the overload without g computes
+    // the energies only. Uses AVX-512 or AVX2 lanes when the CPU supports
+    // them and falls back to eval() otherwise.
+    //
+
+    static const unsigned batch = 8;
+
+    static void eval_batch(const double a[1163],
+                           const double x[36][batch],
+                                 double g[36][batch],
+                                 double e[batch]);
+
+    static void eval_batch(const double a[1163],
+                           const double x[36][batch],
+                                 double e[batch]);
 };
 
 #endif // POLY_3B_V2X_H
@@ -0,0 +1,75 @@
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMMMBPol                             *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2008-2012 Stanford University and the Authors.      *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+#ifndef __MBPolReferenceTestWaters_H__
+#define __MBPolReferenceTestWaters_H__
+
+/**
+ * Water configurations shared by the reference platform tests.
+ */
+
+#include "openmm/reference/RealVec.h"
+#include <vector>
+#include <stdlib.h>
+
+using OpenMM::RealVec;
+
+// waters on a jittered gridSize x gridSize x gridSize grid filling a box of edge boxSize, the
+// jitter drawn after srand( seed ); if shift is set, some atoms are moved by a box vector
+
+static void setupWaters( int gridSize, double boxSize, unsigned int seed, bool shift, std::vector<RealVec>& positions,
+                         std::vector<std::vector<int> >& allParticleIndices ){
+
+    const double spacing = boxSize/gridSize;
+    srand( seed );
+    for( int ii = 0; ii < gridSize*gridSize*gridSize; ii++ ){
+        RealVec oxygen( spacing*(ii % gridSize), spacing*((ii/gridSize) % gridSize), spacing*(ii/(gridSize*gridSize)) );
+        std::vector<int> particleIndices;
+        for( int jj = 0; jj < 3; jj++ ){
+            RealVec position = oxygen;
+            if( jj > 0 ){
+                position[0] += (jj == 1 ? 0.0757 : -0.0757);
+                position[1] += 0.0586;
+            }
+            for( int kk = 0; kk < 3; kk++ ){
+                position[kk] += 0.02*(rand()/(RAND_MAX + 1.0) - 0.5);
+            }
+            if( shift && (ii + jj) % 3 == 0 ){
+                position[ii % 3] += ((ii + jj) % 2 ? boxSize : -boxSize);
+            }
+            particleIndices.push_back( positions.size() );
+            positions.push_back( position );
+        }
+        allParticleIndices.push_back( particleIndices );
+    }
+}
+
+#endif // __MBPolReferenceTestWaters_H__
@@ -0,0 +1,173 @@
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMMMBPol                             *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2008-2012 Stanford University and the Authors.      *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+/**
+ * This tests that the 1-body, 2-body and 3-body force loops do not allocate memory
+ * on the heap once their buffers are set up: global operator new is replaced by one
+ * that counts the allocations.
+ */
+
+#include "openmm/internal/AssertionUtilities.h"
+#include "MBPolReferenceOneBodyForce.h"
+#include "MBPolReferenceTwoBodyForce.h"
+#include "MBPolReferenceThreeBodyForce.h"
+#include "ReferenceThreeNeighborList.h"
+#include "MBPolReferenceTestWaters.h"
+#include "poly-2b-v6x.h"
+#include <iostream>
+#include <new>
+#include <vector>
+#include <stdlib.h>
+#include <stdio.h>
+
+using namespace  OpenMM;
+using namespace MBPolPlugin;
+
+static unsigned long numAllocations = 0;
+
+#if __cplusplus >= 201103L
+#define THROW_BAD_ALLOC
+#define NO_THROW noexcept
+#else
+#define THROW_BAD_ALLOC throw(std::bad_alloc)
+#define NO_THROW throw()
+#endif
+
+void* operator new( size_t size ) THROW_BAD_ALLOC {
+    numAllocations++;
+    void* p = malloc( size > 0 ? size : 1 );
+    if( p == NULL )
+        throw std::bad_alloc();
+    return p;
+}
+
+void operator delete( void* p ) NO_THROW {
+    free( p );
+}
+
+void testAllocations( void ){
+
+    const double boxSize = 1.25;
+    RealVec box( boxSize, boxSize, boxSize );
+
+    std::vector<RealVec> positions;
+    std::vector<std::vector<int> > allParticleIndices;
+    setupWaters( 4, boxSize, 4321, true, positions, allParticleIndices );
+    int numMolecules = allParticleIndices.size();
+
+    std::vector<RealVec> oxygenPositions( numMolecules );
+    for( int ii = 0; ii < numMolecules; ii++ ){
+        oxygenPositions[ii] = positions[allParticleIndices[ii][0]];
+    }
+
+    // 1-body
+
+    MBPolReferenceOneBodyForce oneBodyForce;
+    oneBodyForce.setNonbondedMethod( MBPolReferenceOneBodyForce::Periodic );
+    oneBodyForce.setPeriodicBox( box );
+    std::vector<RealVec> forces( positions.size() );
+
+    numAllocations = 0;
+    oneBodyForce.calculateForceAndEnergy( numMolecules, positions, allParticleIndices, forces );
+    ASSERT_EQUAL( 0UL, numAllocations );
+
+    // 2-body, with and without the monomer data computed beforehand
+
+    NeighborList pairs;
+    for( int ii = 0; ii < numMolecules; ii++ ){
+        for( int jj = ii + 1; jj < numMolecules; jj++ ){
+            pairs.push_back( AtomPair( ii, jj ) );
+        }
+    }
+    MBPolReferenceTwoBodyForce twoBodyForce;
+    std::vector<double> polynomialScratch( poly_2b_v6x_scratch_size );
+    twoBodyForce.setCutoff( 0.6 );
+    twoBodyForce.setNonbondedMethod( MBPolReferenceTwoBodyForce::CutoffPeriodic );
+    twoBodyForce.setPeriodicBox( box );
+
+    numAllocations = 0;
+    twoBodyForce.calculateForceAndEnergy( numMolecules, positions, allParticleIndices, pairs, polynomialScratch, forces );
+    ASSERT_EQUAL( 0UL, numAllocations );
+
+    MBPolReferenceTwoBodyMonomers monomers;
+    monomers.compute( positions, allParticleIndices, box, true );
+    twoBodyForce.setMonomers( &monomers );
+    std::vector<RealVec> monomerForces( monomers.getNumForces() );
+
+    numAllocations = 0;
+    monomers.compute( positions, allParticleIndices, box, true );
+    twoBodyForce.calculateForceAndEnergy( numMolecules, positions, allParticleIndices, pairs, polynomialScratch, monomerForces );
+    monomers.distributeForces( allParticleIndices, monomerForces, forces );
+    ASSERT_EQUAL( 0UL, numAllocations );
+
+    // 3-body, with and without the variables computed beforehand
+
+    const double cutoff = 0.45;
+    ThreeNeighborPairList pairList;
+    pairList.build( numMolecules, oxygenPositions, box, true, cutoff );
+    ThreeNeighborList triplets;
+    computeThreeNeighborListVoxelHash( triplets, numMolecules, oxygenPositions, box, true, cutoff );
+    ASSERT( triplets.size() > 0 );
+
+    MBPolReferenceThreeBodyForce threeBodyForce;
+    threeBodyForce.setCutoff( cutoff );
+    threeBodyForce.setNonbondedMethod( MBPolReferenceThreeBodyForce::CutoffPeriodic );
+    threeBodyForce.setPeriodicBox( box );
+
+    numAllocations = 0;
+    threeBodyForce.calculateForceAndEnergy( numMolecules, positions, allParticleIndices, triplets, forces );
+    ASSERT_EQUAL( 0UL, numAllocations );
+
+    MBPolReferenceThreeBodyVariables variables;
+    variables.compute( positions, allParticleIndices, pairList, box, true );
+    threeBodyForce.setVariables( &variables );
+
+    numAllocations = 0;
+    variables.compute( positions, allParticleIndices, pairList, box, true );
+    threeBodyForce.calculateForceAndEnergy( numMolecules, positions, allParticleIndices, triplets, forces );
+    ASSERT_EQUAL( 0UL, numAllocations );
+
+    std::cout << "Test Successful: testAllocations" << std::endl;
+}
+
+int main( int numberOfArguments, char* argv[] ) {
+
+    try {
+        std::cout << "TestReferenceMBPolAllocations running test..." << std::endl;
+        testAllocations();
+    } catch(const std::exception& e) {
+        std::cout << "exception: " << e.what() << std::endl;
+        std::cout << "FAIL - ERROR.  Test failed." << std::endl;
+        return 1;
+    }
+    std::cout << "Done" << std::endl;
+    return 0;
+}
@@ -1637,6 +1637,108 @@ static void testWater3VirtualSitePMESmallBox() {
     return;
 }
 
+// energy of the waters of testWater3VirtualSitePMESmallBox with automatic PME parameters, tuned or not,
+// and the parameters the context used
+
+static double computeWater3VirtualSitePMESmallBox( bool usePmeTuning, const std::string& cacheFile, double& alpha,
+                                                   double& cutoff, std::vector<int>& grid, int& order ) {
+
+    int numberOfParticles = 4*3;
+    double boxDimension   = 1.8;
+
+    System system;
+    system.setDefaultPeriodicBoxVectors( Vec3( boxDimension, 0.0, 0.0 ), Vec3( 0.0, boxDimension, 0.0 ), Vec3( 0.0, 0.0, boxDimension ) );
+
+    MBPolElectrostaticsForce* mbpolElectrostaticsForce = new MBPolElectrostaticsForce();
+    mbpolElectrostaticsForce->setNonbondedMethod( MBPolElectrostaticsForce::PME );
+    mbpolElectrostaticsForce->setCutoffDistance( 0.9 );
+    mbpolElectrostaticsForce->setMutualInducedTargetEpsilon( 1.0e-12 );
+    mbpolElectrostaticsForce->setAEwald( 0. );
+    mbpolElectrostaticsForce->setEwaldErrorTolerance( 1.0e-03 );
+    mbpolElectrostaticsForce->setUsePmeTuning( usePmeTuning );
+    mbpolElectrostaticsForce->setPmeTuningCacheFile( cacheFile );
+
+    double virtualSiteWeightO = 0.573293118;
+    double virtualSiteWeightH = 0.213353441;
+    for( int jj = 0; jj < numberOfParticles; jj += 4 ){
+        system.addParticle( 1.5999000e+01 );
+        system.addParticle( 1.0080000e+00 );
+        system.addParticle( 1.0080000e+00 );
+        system.addParticle( 0. ); // Virtual Site
+        system.setVirtualSite(jj+3, new ThreeParticleAverageSite(jj, jj+1, jj+2,
+                                                           virtualSiteWeightO, virtualSiteWeightH,virtualSiteWeightH));
+        mbpolElectrostaticsForce->addElectrostatics( -5.1966000e-01, jj/4, 0, 0.001310, 0.001310 );
+        mbpolElectrostaticsForce->addElectrostatics(  2.5983000e-01, jj/4, 1, 0.000294, 0.000294 );
+        mbpolElectrostaticsForce->addElectrostatics(  2.5983000e-01, jj/4, 1, 0.000294, 0.000294 );
+        mbpolElectrostaticsForce->addElectrostatics(  0.,            jj/4, 2, 0.001310, 0. );
+    }
+    system.addForce(mbpolElectrostaticsForce);
+
+    std::vector<Vec3> positions(numberOfParticles);
+    positions[0]             = Vec3( -1.516074336e+00, -2.023167650e-01,  1.454672917e+00  );
+    positions[1]             = Vec3( -6.218989773e-01, -6.009430735e-01,  1.572437625e+00  );
+    positions[2]             = Vec3( -2.017613812e+00, -4.190350349e-01,  2.239642849e+00  );
+    positions[4]             = Vec3( -1.763651687e+00, -3.816594649e-01, -1.300353949e+00  );
+    positions[5]             = Vec3( -1.903851736e+00, -4.935677617e-01, -3.457810126e-01  );
+    positions[6]             = Vec3( -2.527904158e+00, -7.613550077e-01, -1.733803676e+00  );
+    positions[8]             = Vec3( -5.588472140e-01,  2.006699172e+00, -1.392786582e-01  );
+    positions[9]             = Vec3( -9.411558180e-01,  1.541226676e+00,  6.163293071e-01  );
+    positions[10]            = Vec3( -9.858551734e-01,  1.567124294e+00, -8.830970941e-01  );
+    for (int i=0; i<numberOfParticles; i++) {
+        positions[i] *= 1e-1;
+    }
+
+    LangevinIntegrator integrator(0.0, 0.1, 0.01);
+    Context context(system, integrator, Platform::getPlatformByName( "Reference" ) );
+    context.setPositions(positions);
+    context.applyConstraints(1e-7); // update position of virtual site
+
+    State state = context.getState(State::Energy);
+    grid.resize(3);
+    mbpolElectrostaticsForce->getPmeParametersInContext( context, alpha, cutoff, grid[0], grid[1], grid[2], order );
+    return state.getPotentialEnergy();
+}
+
+static void testWater3VirtualSitePMESmallBoxTuned() {
+
+    std::string testName      = "testWater3VirtualSitePMESmallBoxTuned";
+    std::cout << "Test START: " << testName << std::endl;
+
+    std::string cacheFile = testName + ".cache";
+    remove( cacheFile.c_str() );
+
+    double alpha, cutoff;
+    std::vector<int> grid;
+    int order;
+    double expectedEnergy = computeWater3VirtualSitePMESmallBox( false, "", alpha, cutoff, grid, order );
+    ASSERT_EQUAL_TOL( 0.9, cutoff, 1.0e-10 );
+    ASSERT_EQUAL( 5, order );
+
+    // a longer cutoff than requested would not fit in the box, and alpha keeps erfc(alpha*cutoff) at the tolerance
+
+    double energy = computeWater3VirtualSitePMESmallBox( true, cacheFile, alpha, cutoff, grid, order );
+    ASSERT_EQUAL_TOL( 0.9, cutoff, 1.0e-10 );
+    ASSERT( order >= 4 && order <= 6 );
+    ASSERT_EQUAL_TOL( sqrt(-log(2.0e-03)), alpha*cutoff, 1.0e-10 );
+    ASSERT_EQUAL_TOL_MOD( expectedEnergy, energy, 1.0e-02, testName );
+
+    // the second context finds the choice in the cache
+
+    double cachedAlpha, cachedCutoff;
+    std::vector<int> cachedGrid;
+    int cachedOrder;
+    double cachedEnergy = computeWater3VirtualSitePMESmallBox( true, cacheFile, cachedAlpha, cachedCutoff, cachedGrid, cachedOrder );
+    ASSERT_EQUAL_TOL( alpha, cachedAlpha, 1.0e-10 );
+    ASSERT_EQUAL_TOL( cutoff, cachedCutoff, 1.0e-10 );
+    ASSERT( grid == cachedGrid );
+    ASSERT_EQUAL( order, cachedOrder );
+    ASSERT_EQUAL_TOL( energy, cachedEnergy, 1.0e-10 );
+
+    remove( cacheFile.c_str() );
+
+    std::cout << "Test Successful: " << testName << std::endl << std::endl;
+}
+
 class WrappedMBPolReferencePmeElectrostaticsForceForcalculatePmeDirectElectrostaticPairIxn : public MBPolReferencePmeElectrostaticsForce {
     public:
 
@@ -1770,6 +1872,8 @@ int main( int numberOfArguments, char* argv[] ) {
 
         testWater3VirtualSitePMESmallBox();
 
+        testWater3VirtualSitePMESmallBoxTuned();
+
     } catch(const std::exception& e) {
         std::cout << "exception: " << e.what() << std::endl;
         std::cout << "FAIL - ERROR.  Test failed." << std::endl;
@@ -0,0 +1,222 @@
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMMMBPol                             *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2008-2012 Stanford University and the Authors.      *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+/**
+ * This tests that the energy-only evaluation (setIncludeForces( false )) of the 1-body,
+ * 2-body, 3-body and electrostatics forces gives the energy of the full evaluation and
+ * leaves the forces alone.
+ */
+
+#include "openmm/internal/AssertionUtilities.h"
+#include "MBPolReferenceOneBodyForce.h"
+#include "MBPolReferenceTwoBodyForce.h"
+#include "MBPolReferenceThreeBodyForce.h"
+#include "MBPolReferenceElectrostaticsForce.h"
+#include "ReferenceThreeNeighborList.h"
+#include "MBPolReferenceTestWaters.h"
+#include <iostream>
+#include <vector>
+#include <stdlib.h>
+#include <stdio.h>
+
+using namespace  OpenMM;
+using namespace MBPolPlugin;
+
+const double TOL = 1e-10;
+
+static void assertZeroForces( const std::vector<RealVec>& forces ){
+    for( unsigned int ii = 0; ii < forces.size(); ii++ ){
+        ASSERT_EQUAL_VEC( RealVec( 0.0, 0.0, 0.0 ), forces[ii], 0.0 );
+    }
+}
+
+void testOneTwoThreeBody( void ){
+
+    const double boxSize = 0.95;
+    RealVec box( boxSize, boxSize, boxSize );
+
+    std::vector<RealVec> positions;
+    std::vector<std::vector<int> > allParticleIndices;
+    setupWaters( 3, boxSize, 1234, false, positions, allParticleIndices );
+    int numMolecules = allParticleIndices.size();
+
+    std::vector<RealVec> oxygenPositions( numMolecules );
+    for( int ii = 0; ii < numMolecules; ii++ ){
+        oxygenPositions[ii] = positions[allParticleIndices[ii][0]];
+    }
+    std::vector<RealVec> forces( positions.size() );
+    std::vector<RealVec> noForces( positions.size() );
+
+    // 1-body
+
+    MBPolReferenceOneBodyForce oneBodyForce;
+    oneBodyForce.setNonbondedMethod( MBPolReferenceOneBodyForce::Periodic );
+    oneBodyForce.setPeriodicBox( box );
+    double energy = oneBodyForce.calculateForceAndEnergy( numMolecules, positions, allParticleIndices, forces );
+    oneBodyForce.setIncludeForces( false );
+    double energyOnly = oneBodyForce.calculateForceAndEnergy( numMolecules, positions, allParticleIndices, noForces );
+    ASSERT_EQUAL_TOL( energy, energyOnly, TOL );
+    assertZeroForces( noForces );
+
+    // 2-body, enough pairs for full batches and leftovers
+
+    NeighborList pairs;
+    for( int ii = 0; ii < numMolecules; ii++ ){
+        for( int jj = ii + 1; jj < numMolecules; jj++ ){
+            pairs.push_back( AtomPair( ii, jj ) );
+        }
+    }
+    MBPolReferenceTwoBodyForce twoBodyForce;
+    std::vector<double> polynomialScratch;
+    twoBodyForce.setCutoff( 0.45 );
+    twoBodyForce.setNonbondedMethod( MBPolReferenceTwoBodyForce::CutoffPeriodic );
+    twoBodyForce.setPeriodicBox( box );
+    energy = twoBodyForce.calculateForceAndEnergy( numMolecules, positions, allParticleIndices, pairs, polynomialScratch, forces );
+    twoBodyForce.setIncludeForces( false );
+    energyOnly = twoBodyForce.calculateForceAndEnergy( numMolecules, positions, allParticleIndices, pairs, polynomialScratch, noForces );
+    ASSERT( energy != 0.0 );
+    ASSERT_EQUAL_TOL( energy, energyOnly, TOL );
+    assertZeroForces( noForces );
+
+    // 3-body
+
+    const double cutoff = 0.45;
+    ThreeNeighborList triplets;
+    computeThreeNeighborListVoxelHash( triplets, numMolecules, oxygenPositions, box, true, cutoff );
+    ASSERT( triplets.size() > 0 );
+
+    MBPolReferenceThreeBodyForce threeBodyForce;
+    threeBodyForce.setCutoff( cutoff );
+    threeBodyForce.setNonbondedMethod( MBPolReferenceThreeBodyForce::CutoffPeriodic );
+    threeBodyForce.setPeriodicBox( box );
+    energy = threeBodyForce.calculateForceAndEnergy( numMolecules, positions, allParticleIndices, triplets, forces );
+    threeBodyForce.setIncludeForces( false );
+    energyOnly = threeBodyForce.calculateForceAndEnergy( numMolecules, positions, allParticleIndices, triplets, noForces );
+    ASSERT( energy != 0.0 );
+    ASSERT_EQUAL_TOL( energy, energyOnly, TOL );
+    assertZeroForces( noForces );
+
+    std::cout << "Test Successful: testOneTwoThreeBody" << std::endl;
+}
+
+static RealOpenMM computeElectrostatics( bool usePme, bool includeForces, double boxSize,
+                                         const std::vector<RealVec>& positions, std::vector<RealVec>& forces ){
+
+    // O, H, H and M site of every water
+
+    std::vector<RealOpenMM> charges, dampingFactors, polarity, tholes( 5 );
+    std::vector<int> moleculeIndices, atomTypes;
+    for( unsigned int ii = 0; ii < positions.size(); ii += 4 ){
+        const double siteCharges[4]  = { -5.1966000e-01, 2.5983000e-01, 2.5983000e-01, 0.0 };
+        const double siteDamping[4]  = { 0.001310, 0.000294, 0.000294, 0.001310 };
+        const double sitePolarity[4] = { 0.001310, 0.000294, 0.000294, 0.0 };
+        const int siteTypes[4]       = { 0, 1, 1, 2 };
+        for( int jj = 0; jj < 4; jj++ ){
+            charges.push_back( siteCharges[jj] );
+            dampingFactors.push_back( siteDamping[jj] );
+            polarity.push_back( sitePolarity[jj] );
+            atomTypes.push_back( siteTypes[jj] );
+            moleculeIndices.push_back( ii/4 );
+        }
+    }
+    tholes[TCC]   = 0.4;
+    tholes[TCD]   = 0.4;
+    tholes[TDD]   = 0.055;
+    tholes[TDDOH] = 0.626;
+    tholes[TDDHH] = 0.055;
+
+    MBPolReferenceElectrostaticsForce* electrostaticsForce;
+    if( usePme ){
+        MBPolReferencePmeElectrostaticsForce* pmeForce = new MBPolReferencePmeElectrostaticsForce();
+        std::vector<int> pmeGridDimensions( 3, 12 );
+        RealVec box( boxSize, boxSize, boxSize );
+        pmeForce->setAlphaEwald( 3.5 );
+        pmeForce->setCutoffDistance( 0.45 );
+        pmeForce->setPmeGridDimensions( pmeGridDimensions );
+        pmeForce->setPeriodicBoxSize( box );
+        electrostaticsForce = pmeForce;
+    } else {
+        electrostaticsForce = new MBPolReferenceElectrostaticsForce( MBPolReferenceElectrostaticsForce::NoCutoff );
+    }
+    electrostaticsForce->setMutualInducedDipoleTargetEpsilon( 1.0e-08 );
+    electrostaticsForce->setMaximumMutualInducedDipoleIterations( 200 );
+    electrostaticsForce->setTholeParameters( tholes );
+    electrostaticsForce->setIncludeForces( includeForces );
+    RealOpenMM energy = electrostaticsForce->calculateForceAndEnergy( positions, charges, moleculeIndices, atomTypes,
+                                                                      tholes, dampingFactors, polarity, forces );
+    delete electrostaticsForce;
+    return energy;
+}
+
+void testElectrostatics( bool usePme ){
+
+    const double boxSize = 0.95;
+
+    std::vector<RealVec> waterPositions;
+    std::vector<std::vector<int> > allParticleIndices;
+    setupWaters( 3, boxSize, 1234, false, waterPositions, allParticleIndices );
+
+    std::vector<RealVec> positions;
+    for( unsigned int ii = 0; ii < allParticleIndices.size(); ii++ ){
+        const RealVec& oxygen = waterPositions[allParticleIndices[ii][0]];
+        const RealVec& hydrogen1 = waterPositions[allParticleIndices[ii][1]];
+        const RealVec& hydrogen2 = waterPositions[allParticleIndices[ii][2]];
+        positions.push_back( oxygen );
+        positions.push_back( hydrogen1 );
+        positions.push_back( hydrogen2 );
+        positions.push_back( oxygen*0.573293118 + hydrogen1*0.213353441 + hydrogen2*0.213353441 );
+    }
+
+    std::vector<RealVec> forces( positions.size() );
+    std::vector<RealVec> noForces( positions.size() );
+    RealOpenMM energy     = computeElectrostatics( usePme, true, boxSize, positions, forces );
+    RealOpenMM energyOnly = computeElectrostatics( usePme, false, boxSize, positions, noForces );
+    ASSERT_EQUAL_TOL( energy, energyOnly, TOL );
+    assertZeroForces( noForces );
+
+    std::cout << "Test Successful: testElectrostatics" << (usePme ? "Pme" : "") << std::endl;
+}
+
+int main( int numberOfArguments, char* argv[] ) {
+
+    try {
+        std::cout << "TestReferenceMBPolEnergyOnly running test..." << std::endl;
+        testOneTwoThreeBody();
+        testElectrostatics( false );
+        testElectrostatics( true );
+    } catch(const std::exception& e) {
+        std::cout << "exception: " << e.what() << std::endl;
+        std::cout << "FAIL - ERROR.  Test failed." << std::endl;
+        return 1;
+    }
+    std::cout << "Done" << std::endl;
+    return 0;
+}
@@ -0,0 +1,636 @@
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMMMBPol                             *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2008-2012 Stanford University and the Authors.      *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+
+/**
+ * This tests that the ways of computing the induced dipoles of the reference electrostatics
+ * give the energy and forces of the pairwise SOR iteration, with and without PME.
+ */
+
+#include "openmm/internal/AssertionUtilities.h"
+#include "MBPolReferenceElectrostaticsForce.h"
+#include "MBPolReferenceInducedDipolePredictor.h"
+#include "MBPolReferenceExtendedLagrangianDipoles.h"
+#include "openmm/internal/ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+#include <stdlib.h>
+#include <stdio.h>
+
+using namespace  OpenMM;
+using namespace MBPolPlugin;
+
+const double TOL = 1e-6;
+
+const double BOX_SIZE = 1.25;
+
+// O, H, H and M site of waters on a jittered 4x4x4 grid filling the box
+
+static void setupWaters( std::vector<RealVec>& positions ){
+
+    const int gridSize = 4;
+    const double spacing = BOX_SIZE/gridSize;
+    srand( 4321 );
+    for( int ii = 0; ii < gridSize*gridSize*gridSize; ii++ ){
+        RealVec oxygen( spacing*(ii % gridSize), spacing*((ii/gridSize) % gridSize), spacing*(ii/(gridSize*gridSize)) );
+        RealVec sites[3] = { oxygen, oxygen + RealVec( 0.0757, 0.0586, 0.0 ), oxygen + RealVec( -0.0757, 0.0586, 0.0 ) };
+        for( int jj = 0; jj < 3; jj++ ){
+            for( int kk = 0; kk < 3; kk++ ){
+                sites[jj][kk] += 0.02*(rand()/(RAND_MAX + 1.0) - 0.5);
+            }
+            positions.push_back( sites[jj] );
+        }
+        positions.push_back( sites[0]*0.573293118 + sites[1]*0.213353441 + sites[2]*0.213353441 );
+    }
+}
+
+struct Solver {
+    Solver() : useDipoleFieldTensor( false ), numThreads( 1 ), polarizationSolver( MBPolReferenceElectrostaticsForce::SOR ),
+               denseSolverThreshold( -1 ), targetEpsilon( 1.0e-08 ), predictor( NULL ), extendedLagrangian( NULL ), extendedLagrangianIterations( 1 ),
+               pmeBSplineOrder( 5 ), pmeGridSize( 12 ) {}
+    bool useDipoleFieldTensor;
+    int numThreads;
+    MBPolReferenceElectrostaticsForce::PolarizationSolver polarizationSolver;
+    int denseSolverThreshold;
+    double targetEpsilon;
+    MBPolReferenceInducedDipolePredictor* predictor;
+    MBPolReferenceExtendedLagrangianDipoles* extendedLagrangian;
+    int extendedLagrangianIterations;
+    std::vector<RealOpenMM> extrapolationCoefficients;
+    int pmeBSplineOrder;
+    int pmeGridSize;
+};
+
+static MBPolReferenceElectrostaticsForce* createElectrostaticsForce( bool usePme, const Solver& solver, const std::vector<RealVec>& positions,
+                                                                     std::vector<RealOpenMM>& charges, std::vector<int>& moleculeIndices,
+                                                                     std::vector<int>& atomTypes, std::vector<RealOpenMM>& tholes,
+                                                                     std::vector<RealOpenMM>& dampingFactors, std::vector<RealOpenMM>& polarity ){
+
+    charges.clear();
+    dampingFactors.clear();
+    polarity.clear();
+    atomTypes.clear();
+    moleculeIndices.clear();
+    tholes.resize( 5 );
+    for( unsigned int ii = 0; ii < positions.size(); ii += 4 ){
+        const double siteCharges[4]  = { -5.1966000e-01, 2.5983000e-01, 2.5983000e-01, 0.0 };
+        const double siteDamping[4]  = { 0.001310, 0.000294, 0.000294, 0.001310 };
+        const double sitePolarity[4] = { 0.001310, 0.000294, 0.000294, 0.0 };
+        const int siteTypes[4]       = { 0, 1, 1, 2 };
+        for( int jj = 0; jj < 4; jj++ ){
+            charges.push_back( siteCharges[jj] );
+            dampingFactors.push_back( siteDamping[jj] );
+            polarity.push_back( sitePolarity[jj] );
+            atomTypes.push_back( siteTypes[jj] );
+            moleculeIndices.push_back( ii/4 );
+        }
+    }
+    tholes[TCC]   = 0.4;
+    tholes[TCD]   = 0.4;
+    tholes[TDD]   = 0.055;
+    tholes[TDDOH] = 0.626;
+    tholes[TDDHH] = 0.055;
+
+    MBPolReferenceElectrostaticsForce* electrostaticsForce;
+    if( usePme ){
+        MBPolReferencePmeElectrostaticsForce* pmeForce = new MBPolReferencePmeElectrostaticsForce();
+        std::vector<int> pmeGridDimensions( 3, solver.pmeGridSize );
+        RealVec box( BOX_SIZE, BOX_SIZE, BOX_SIZE );
+        pmeForce->setAlphaEwald( 3.5 );
+        pmeForce->setCutoffDistance( 0.6 );
+        pmeForce->setPmeGridDimensions( pmeGridDimensions );
+        pmeForce->setPmeBSplineOrder( solver.pmeBSplineOrder );
+        pmeForce->setPeriodicBoxSize( box );
+        electrostaticsForce = pmeForce;
+    } else {
+        electrostaticsForce = new MBPolReferenceElectrostaticsForce( MBPolReferenceElectrostaticsForce::NoCutoff );
+    }
+    electrostaticsForce->setMutualInducedDipoleTargetEpsilon( solver.targetEpsilon );
+    electrostaticsForce->setMaximumMutualInducedDipoleIterations( 500 );
+    electrostaticsForce->setTholeParameters( tholes );
+    electrostaticsForce->setUseDipoleFieldTensor( solver.useDipoleFieldTensor );
+    electrostaticsForce->setPolarizationSolver( solver.polarizationSolver );
+    electrostaticsForce->setDenseSolverThreshold( solver.denseSolverThreshold );
+    electrostaticsForce->setExtrapolationCoefficients( solver.extrapolationCoefficients );
+    return electrostaticsForce;
+}
+
+static RealOpenMM computeElectrostatics( bool usePme, const Solver& solver, const std::vector<RealVec>& positions,
+                                         std::vector<RealVec>& forces, int& iterations ){
+
+    std::vector<RealOpenMM> charges, dampingFactors, polarity, tholes;
+    std::vector<int> moleculeIndices, atomTypes;
+    MBPolReferenceElectrostaticsForce* electrostaticsForce = createElectrostaticsForce( usePme, solver, positions, charges, moleculeIndices,
+                                                                                       atomTypes, tholes, dampingFactors, polarity );
+    ThreadPool threads( solver.numThreads );
+    if( solver.numThreads > 1 ){
+        electrostaticsForce->setThreadPool( &threads );
+    }
+
+    std::vector<RealVec> inducedDipole, inducedDipolePolar;
+    RealVec box = usePme ? RealVec( BOX_SIZE, BOX_SIZE, BOX_SIZE ) : RealVec( 0.0, 0.0, 0.0 );
+    if( solver.predictor != NULL && solver.predictor->predict( positions, box, inducedDipole, inducedDipolePolar ) ){
+        electrostaticsForce->setInitialInducedDipoles( inducedDipole, inducedDipolePolar );
+    }
+    if( solver.extendedLagrangian != NULL && solver.extendedLagrangian->propagate( positions, box, inducedDipole, inducedDipolePolar ) ){
+        electrostaticsForce->setInitialInducedDipoles( inducedDipole, inducedDipolePolar );
+        electrostaticsForce->setFixedInducedDipoleIterations( solver.extendedLagrangianIterations );
+    }
+
+    forces.assign( positions.size(), RealVec( 0.0, 0.0, 0.0 ) );
+    RealOpenMM energy = electrostaticsForce->calculateForceAndEnergy( positions, charges, moleculeIndices, atomTypes,
+                                                                      tholes, dampingFactors, polarity, forces );
+    if( solver.predictor != NULL ){
+        electrostaticsForce->getInducedDipoles( inducedDipole, inducedDipolePolar );
+        solver.predictor->record( inducedDipole, inducedDipolePolar );
+    }
+    if( solver.extendedLagrangian != NULL ){
+        electrostaticsForce->getInducedDipoles( inducedDipole, inducedDipolePolar );
+        solver.extendedLagrangian->record( inducedDipole, inducedDipolePolar );
+    }
+    iterations = electrostaticsForce->getMutualInducedDipoleIterations();
+    delete electrostaticsForce;
+    return energy;
+}
+
+static void compareSolver( bool usePme, const Solver& solver, const std::string& testName ){
+
+    std::vector<RealVec> positions;
+    setupWaters( positions );
+
+    Solver pairwise;
+    pairwise.targetEpsilon = solver.targetEpsilon;
+
+    std::vector<RealVec> expectedForces, forces;
+    int expectedIterations, iterations;
+    RealOpenMM expectedEnergy = computeElectrostatics( usePme, pairwise, positions, expectedForces, expectedIterations );
+    RealOpenMM energy         = computeElectrostatics( usePme, solver, positions, forces, iterations );
+
+    ASSERT_EQUAL_TOL( expectedEnergy, energy, TOL );
+    for( unsigned int ii = 0; ii < positions.size(); ii++ ){
+        ASSERT_EQUAL_VEC( expectedForces[ii], forces[ii], TOL );
+    }
+    std::cout << "Test Successful: " << testName << (usePme ? "Pme" : "") << " (" << iterations << " iterations, "
+              << expectedIterations << " pairwise)" << std::endl;
+}
+
+static void testDipoleFieldTensor( bool usePme ){
+    Solver solver;
+    solver.useDipoleFieldTensor = true;
+    compareSolver( usePme, solver, "testDipoleFieldTensor" );
+    solver.numThreads = 3;
+    compareSolver( usePme, solver, "testDipoleFieldTensorThreads" );
+}
+
+// conjugate gradient stops at a different point than SOR, so both are converged further
+
+static void testConjugateGradient( bool usePme ){
+    Solver solver;
+    solver.polarizationSolver = MBPolReferenceElectrostaticsForce::ConjugateGradient;
+    solver.targetEpsilon = 1.0e-10;
+    compareSolver( usePme, solver, "testConjugateGradient" );
+    solver.useDipoleFieldTensor = true;
+    solver.numThreads = 3;
+    compareSolver( usePme, solver, "testConjugateGradientThreads" );
+}
+
+static void testDIIS( bool usePme ){
+    Solver solver;
+    solver.polarizationSolver = MBPolReferenceElectrostaticsForce::DIIS;
+    solver.targetEpsilon = 1.0e-10;
+    compareSolver( usePme, solver, "testDIIS" );
+    solver.useDipoleFieldTensor = true;
+    solver.numThreads = 3;
+    compareSolver( usePme, solver, "testDIISThreads" );
+}
+
+// the PME grid is spread in slabs of x planes, here of unequal size
+
+static void testThreadedSpreading( void ){
+    Solver solver;
+    solver.numThreads = 5;
+    compareSolver( true, solver, "testThreadedSpreading" );
+}
+
+// on the same grid every B-spline order approaches the Ewald sum, the more closely the
+// higher the order; order 8 is the reference
+
+static void testPmeBSplineOrder( void ){
+
+    std::vector<RealVec> positions;
+    setupWaters( positions );
+
+    Solver solver;
+    solver.pmeGridSize     = 24;
+    solver.pmeBSplineOrder = 8;
+    std::vector<RealVec> expectedForces, forces;
+    int iterations;
+    RealOpenMM expectedEnergy = computeElectrostatics( true, solver, positions, expectedForces, iterations );
+
+    double lastError = 0.0;
+    for( int order = 4; order <= 6; order++ ){
+        solver.pmeBSplineOrder = order;
+        RealOpenMM energy = computeElectrostatics( true, solver, positions, forces, iterations );
+        ASSERT_EQUAL_TOL( expectedEnergy, energy, 1.0e-4 );
+        double error = 0.0;
+        for( unsigned int ii = 0; ii < positions.size(); ii++ ){
+            ASSERT_EQUAL_VEC( expectedForces[ii], forces[ii], 5.0e-2 );
+            error = std::max( error, sqrt( (forces[ii] - expectedForces[ii]).dot( forces[ii] - expectedForces[ii] ) ) );
+        }
+        ASSERT( order == 4 || error < lastError );
+        lastError = error;
+    }
+    std::cout << "Test Successful: testPmeBSplineOrder (largest force error at order 6 " << lastError << " kJ/mol/nm)" << std::endl;
+}
+
+// the dense solve is exact in one step, whether chosen or below the threshold
+
+static void testDenseSolve( void ){
+    Solver solver;
+    solver.polarizationSolver = MBPolReferenceElectrostaticsForce::Dense;
+    solver.targetEpsilon = 1.0e-10;
+    compareSolver( false, solver, "testDenseSolve" );
+    solver.polarizationSolver = MBPolReferenceElectrostaticsForce::SOR;
+    solver.useDipoleFieldTensor = true;
+    solver.denseSolverThreshold = 192;
+    compareSolver( false, solver, "testDenseSolveThreshold" );
+
+    std::vector<RealVec> positions, forces;
+    setupWaters( positions );
+    int iterations;
+    computeElectrostatics( false, solver, positions, forces, iterations );
+    ASSERT_EQUAL( 1, iterations );
+    solver.denseSolverThreshold = 191;
+    computeElectrostatics( false, solver, positions, forces, iterations );
+    ASSERT( iterations > 1 );
+
+    // the Dense solver is rejected with PME
+
+    solver.polarizationSolver = MBPolReferenceElectrostaticsForce::Dense;
+    bool threw = false;
+    try {
+        computeElectrostatics( true, solver, positions, forces, iterations );
+    } catch( const OpenMMException& ){
+        threw = true;
+    }
+    ASSERT( threw );
+}
+
+// the polarizability from the probe fields solved along with the fixed field is the same for all
+// solvers and symmetric, and the dipoles of the fixed field are those of the usual calculation
+
+static void testSystemPolarizability( bool usePme ){
+
+    std::vector<RealVec> positions;
+    setupWaters( positions );
+
+    std::vector<RealOpenMM> charges, dampingFactors, polarity, tholes;
+    std::vector<int> moleculeIndices, atomTypes;
+    std::vector<RealOpenMM> expectedPolarizability;
+
+    MBPolReferenceElectrostaticsForce::PolarizationSolver solvers[4] = { MBPolReferenceElectrostaticsForce::SOR,
+                                                                         MBPolReferenceElectrostaticsForce::ConjugateGradient,
+                                                                         MBPolReferenceElectrostaticsForce::DIIS,
+                                                                         MBPolReferenceElectrostaticsForce::Dense };
+    for( int ss = 0; ss < (usePme ? 3 : 4); ss++ ){
+        Solver solver;
+        solver.polarizationSolver = solvers[ss];
+        solver.targetEpsilon      = 1.0e-10;
+        MBPolReferenceElectrostaticsForce* electrostaticsForce = createElectrostaticsForce( usePme, solver, positions, charges, moleculeIndices,
+                                                                                           atomTypes, tholes, dampingFactors, polarity );
+        std::vector<RealOpenMM> polarizability;
+        electrostaticsForce->calculateSystemPolarizability( positions, charges, moleculeIndices, atomTypes,
+                                                            tholes, dampingFactors, polarity, polarizability );
+        std::vector<RealVec> inducedDipole, inducedDipolePolar, expectedInducedDipole, expectedInducedDipolePolar;
+        electrostaticsForce->getInducedDipoles( inducedDipole, inducedDipolePolar );
+
+        std::vector<RealVec> forces( positions.size() );
+        electrostaticsForce->calculateForceAndEnergy( positions, charges, moleculeIndices, atomTypes,
+                                                      tholes, dampingFactors, polarity, forces );
+        electrostaticsForce->getInducedDipoles( expectedInducedDipole, expectedInducedDipolePolar );
+        for( unsigned int ii = 0; ii < positions.size(); ii++ ){
+            ASSERT_EQUAL_VEC( expectedInducedDipole[ii], inducedDipole[ii], TOL );
+        }
+        delete electrostaticsForce;
+
+        if( ss == 0 ){
+            expectedPolarizability = polarizability;
+        }
+        for( int aa = 0; aa < 3; aa++ ){
+            for( int bb = 0; bb < 3; bb++ ){
+                ASSERT_EQUAL_TOL( expectedPolarizability[3*aa+bb], polarizability[3*aa+bb], TOL );
+                ASSERT_EQUAL_TOL( polarizability[3*bb+aa], polarizability[3*aa+bb], TOL );
+            }
+        }
+    }
+
+    // a single water is less polarizable than its sites apart, about 1.4 A^3
+
+    positions.resize( 4 );
+    Solver solver;
+    MBPolReferenceElectrostaticsForce* electrostaticsForce = createElectrostaticsForce( false, solver, positions, charges, moleculeIndices,
+                                                                                       atomTypes, tholes, dampingFactors, polarity );
+    std::vector<RealOpenMM> polarizability;
+    electrostaticsForce->calculateSystemPolarizability( positions, charges, moleculeIndices, atomTypes,
+                                                        tholes, dampingFactors, polarity, polarizability );
+    delete electrostaticsForce;
+    double isotropic = (polarizability[0] + polarizability[4] + polarizability[8])/3.0;
+    ASSERT( isotropic > 1.0e-03 && isotropic < polarity[0] + polarity[1] + polarity[2] );
+
+    std::cout << "Test Successful: testSystemPolarizability" << (usePme ? "Pme" : "") << " (" << expectedPolarizability[0] << " "
+              << expectedPolarizability[4] << " " << expectedPolarizability[8] << " nm^3, one water " << isotropic << " nm^3)" << std::endl;
+}
+
+// with identical fixed fields only the direct dipoles are iterated; starting the polar set from other
+// dipoles makes both be iterated, to the same converged energy and forces
+
+static void testSingleDipoleSet( bool usePme ){
+
+    std::vector<RealVec> positions;
+    setupWaters( positions );
+
+    std::vector<RealOpenMM> charges, dampingFactors, polarity, tholes;
+    std::vector<int> moleculeIndices, atomTypes;
+    Solver solver;
+    solver.targetEpsilon = 1.0e-10;
+
+    std::vector<RealVec> forces[2];
+    RealOpenMM energy[2];
+    for( int ss = 0; ss < 2; ss++ ){
+        MBPolReferenceElectrostaticsForce* electrostaticsForce = createElectrostaticsForce( usePme, solver, positions, charges, moleculeIndices,
+                                                                                           atomTypes, tholes, dampingFactors, polarity );
+        if( ss == 1 ){
+            std::vector<RealVec> inducedDipole( positions.size() ), inducedDipolePolar( positions.size() );
+            inducedDipolePolar[0] = RealVec( 1.0e-04, 0.0, 0.0 );
+            electrostaticsForce->setInitialInducedDipoles( inducedDipole, inducedDipolePolar );
+        }
+        forces[ss].assign( positions.size(), RealVec( 0.0, 0.0, 0.0 ) );
+        energy[ss] = electrostaticsForce->calculateForceAndEnergy( positions, charges, moleculeIndices, atomTypes,
+                                                                   tholes, dampingFactors, polarity, forces[ss] );
+        ASSERT( electrostaticsForce->getSingleDipoleSet() == (ss == 0) );
+        delete electrostaticsForce;
+    }
+
+    ASSERT_EQUAL_TOL( energy[1], energy[0], TOL );
+    for( unsigned int ii = 0; ii < positions.size(); ii++ ){
+        ASSERT_EQUAL_VEC( forces[1][ii], forces[0][ii], TOL );
+    }
+    std::cout << "Test Successful: testSingleDipoleSet" << (usePme ? "Pme" : "") << std::endl;
+}
+
+// a smooth trajectory: every water drifts and rotates about z
+
+static void moveWaters( const std::vector<RealVec>& initialPositions, int step, std::vector<RealVec>& positions ){
+    positions = initialPositions;
+    for( unsigned int ii = 0; ii < positions.size(); ii += 4 ){
+        double angle = 0.01*step*(1.0 + 0.1*(ii % 7));
+        for( unsigned int jj = ii; jj < ii + 4; jj++ ){
+            RealVec arm  = initialPositions[jj] - initialPositions[ii];
+            positions[jj] = initialPositions[ii] + RealVec( 0.002*step, 0.001*step, 0.0 )
+                            + RealVec( cos( angle )*arm[0] - sin( angle )*arm[1], sin( angle )*arm[0] + cos( angle )*arm[1], arm[2] );
+        }
+    }
+}
+
+// one force kept across steps, as the kernels keep it, gives the results of a new force every step,
+// also after the box and the PME grid change
+
+static void testReusedForce( bool usePme ){
+
+    std::vector<RealVec> initialPositions, positions;
+    setupWaters( initialPositions );
+
+    std::vector<RealOpenMM> charges, dampingFactors, polarity, tholes;
+    std::vector<int> moleculeIndices, atomTypes;
+    Solver solver;
+    solver.targetEpsilon = 1.0e-10;
+    MBPolReferenceElectrostaticsForce* reusedForce = createElectrostaticsForce( usePme, solver, initialPositions, charges, moleculeIndices,
+                                                                               atomTypes, tholes, dampingFactors, polarity );
+
+    const int numSteps = 4;
+    for( int step = 0; step < numSteps; step++ ){
+        moveWaters( initialPositions, step, positions );
+        MBPolReferenceElectrostaticsForce* newForce = createElectrostaticsForce( usePme, solver, positions, charges, moleculeIndices,
+                                                                                atomTypes, tholes, dampingFactors, polarity );
+        if( usePme ){
+            RealVec box( BOX_SIZE*(1.0 + 0.01*(step/2)), BOX_SIZE, BOX_SIZE );
+            std::vector<int> pmeGridDimensions( 3, step < 3 ? 12 : 15 );
+            MBPolReferencePmeElectrostaticsForce* forces[2] = { dynamic_cast<MBPolReferencePmeElectrostaticsForce*>(reusedForce),
+                                                                dynamic_cast<MBPolReferencePmeElectrostaticsForce*>(newForce) };
+            for( int ff = 0; ff < 2; ff++ ){
+                forces[ff]->setPeriodicBoxSize( box );
+                forces[ff]->setPmeGridDimensions( pmeGridDimensions );
+            }
+        }
+        std::vector<RealVec> expectedForces( positions.size() ), reusedForces( positions.size() );
+        RealOpenMM expectedEnergy = newForce->calculateForceAndEnergy( positions, charges, moleculeIndices, atomTypes,
+                                                                       tholes, dampingFactors, polarity, expectedForces );
+        RealOpenMM energy         = reusedForce->calculateForceAndEnergy( positions, charges, moleculeIndices, atomTypes,
+                                                                          tholes, dampingFactors, polarity, reusedForces );
+        delete newForce;
+        ASSERT_EQUAL_TOL( expectedEnergy, energy, TOL );
+        for( unsigned int ii = 0; ii < positions.size(); ii++ ){
+            ASSERT_EQUAL_VEC( expectedForces[ii], reusedForces[ii], TOL );
+        }
+    }
+    delete reusedForce;
+    std::cout << "Test Successful: testReusedForce" << (usePme ? "Pme" : "") << std::endl;
+}
+
+// the predicted dipoles must converge to the same energy in fewer iterations, and a jump must drop the history
+
+static void testInducedDipolePredictor( bool usePme ){
+
+    std::vector<RealVec> initialPositions, positions;
+    setupWaters( initialPositions );
+
+    MBPolReferenceInducedDipolePredictor predictor;
+    Solver fromFixedField, predicted;
+    fromFixedField.targetEpsilon = 1.0e-10;
+    predicted.targetEpsilon      = 1.0e-10;
+    predicted.predictor          = &predictor;
+
+    int totalIterations = 0, totalPredictedIterations = 0;
+    const int numSteps = 10;
+    for( int step = 0; step < numSteps; step++ ){
+        moveWaters( initialPositions, step, positions );
+        std::vector<RealVec> expectedForces, forces;
+        int expectedIterations, iterations;
+        RealOpenMM expectedEnergy = computeElectrostatics( usePme, fromFixedField, positions, expectedForces, expectedIterations );
+        RealOpenMM energy         = computeElectrostatics( usePme, predicted, positions, forces, iterations );
+        ASSERT_EQUAL_TOL( expectedEnergy, energy, TOL );
+        for( unsigned int ii = 0; ii < positions.size(); ii++ ){
+            ASSERT_EQUAL_VEC( expectedForces[ii], forces[ii], TOL );
+        }
+        totalIterations          += expectedIterations;
+        totalPredictedIterations += iterations;
+    }
+    ASSERT( totalPredictedIterations < totalIterations );
+
+    // the same positions reuse the last dipoles without extending the history
+
+    std::vector<RealVec> forces;
+    int iterations;
+    unsigned int historySize = predictor.getHistorySize();
+    computeElectrostatics( usePme, predicted, positions, forces, iterations );
+    ASSERT_EQUAL( historySize, predictor.getHistorySize() );
+
+    // a jump drops the history
+
+    positions[0][0] += 0.1;
+    std::vector<RealVec> inducedDipole, inducedDipolePolar;
+    RealVec box = usePme ? RealVec( BOX_SIZE, BOX_SIZE, BOX_SIZE ) : RealVec( 0.0, 0.0, 0.0 );
+    ASSERT( !predictor.predict( positions, box, inducedDipole, inducedDipolePolar ) );
+    ASSERT_EQUAL( 0u, predictor.getHistorySize() );
+
+    std::cout << "Test Successful: testInducedDipolePredictor" << (usePme ? "Pme" : "") << " (" << totalPredictedIterations
+              << " iterations, " << totalIterations << " from the fixed field)" << std::endl;
+}
+
+// along the same trajectory the extended Lagrangian converges only the first step and then
+// iterates a fixed number of times from the propagated auxiliary dipoles; a jump must drop the history
+
+static void testExtendedLagrangian( bool usePme ){
+
+    std::vector<RealVec> initialPositions, positions;
+    setupWaters( initialPositions );
+
+    MBPolReferenceExtendedLagrangianDipoles extendedLagrangian;
+    Solver converged, propagated;
+    converged.targetEpsilon          = 1.0e-10;
+    propagated.targetEpsilon         = 1.0e-10;
+    propagated.extendedLagrangian    = &extendedLagrangian;
+
+    // the steps are much larger than MD steps, the energy stays within 1 kJ/mol of the converged one
+
+    double maxError = 0.0;
+    const int numSteps = 20;
+    for( int step = 0; step < numSteps; step++ ){
+        moveWaters( initialPositions, step, positions );
+        std::vector<RealVec> expectedForces, forces;
+        int expectedIterations, iterations;
+        RealOpenMM expectedEnergy = computeElectrostatics( usePme, converged, positions, expectedForces, expectedIterations );
+        RealOpenMM energy         = computeElectrostatics( usePme, propagated, positions, forces, iterations );
+        if( step > 0 ){
+            ASSERT_EQUAL( propagated.extendedLagrangianIterations, iterations );
+        }
+        maxError = std::max( maxError, std::fabs( energy - expectedEnergy ) );
+    }
+
+    // a jump drops the history, the next step is converged again
+
+    positions[0][0] += 0.1;
+    std::vector<RealVec> inducedDipole, inducedDipolePolar;
+    RealVec box = usePme ? RealVec( BOX_SIZE, BOX_SIZE, BOX_SIZE ) : RealVec( 0.0, 0.0, 0.0 );
+    ASSERT( maxError < 1.0 );
+    ASSERT( !extendedLagrangian.propagate( positions, box, inducedDipole, inducedDipolePolar ) );
+
+    std::cout << "Test Successful: testExtendedLagrangian" << (usePme ? "Pme" : "") << " (largest energy error "
+              << maxError << " kJ/mol)" << std::endl;
+}
+
+// the extrapolated (OPT3) dipoles cost a fixed number of field calculations, their energy is close
+// to the converged one and their forces are the derivatives of that energy (five point finite differences)
+
+static void testExtrapolated( bool usePme ){
+
+    std::vector<RealVec> positions;
+    setupWaters( positions );
+
+    Solver converged, extrapolated;
+    converged.targetEpsilon = 1.0e-10;
+    const RealOpenMM opt3[4] = { -0.154, 0.017, 0.658, 0.474 };
+    extrapolated.extrapolationCoefficients.assign( opt3, opt3 + 4 );
+
+    std::vector<RealVec> expectedForces, forces, finiteDifferenceForces;
+    int expectedIterations, iterations;
+    RealOpenMM expectedEnergy = computeElectrostatics( usePme, converged, positions, expectedForces, expectedIterations );
+    RealOpenMM energy         = computeElectrostatics( usePme, extrapolated, positions, forces, iterations );
+    ASSERT_EQUAL( 3, iterations );
+    ASSERT_EQUAL_TOL( expectedEnergy, energy, 2.0e-2 );
+
+    const double eps = 1.0e-5;
+    const unsigned int testedParticles[4] = { 0, 1, 2, 21 };
+    for( unsigned int tt = 0; tt < 4; tt++ ){
+        unsigned int ii = testedParticles[tt];
+        RealVec finiteDifferenceForce;
+        for( int xyz = 0; xyz < 3; xyz++ ){
+            double energies[4];
+            const double steps[4] = { eps, -eps, 2.0*eps, -2.0*eps };
+            for( int ss = 0; ss < 4; ss++ ){
+                std::vector<RealVec> displaced( positions );
+                displaced[ii][xyz] += steps[ss];
+                energies[ss] = computeElectrostatics( usePme, extrapolated, displaced, finiteDifferenceForces, iterations );
+            }
+            finiteDifferenceForce[xyz] = -(8.0*(energies[0] - energies[1]) - (energies[2] - energies[3]))/(12.0*eps);
+        }
+        ASSERT_EQUAL_VEC( finiteDifferenceForce, forces[ii], 1.0e-4 );
+    }
+
+    std::cout << "Test Successful: testExtrapolated" << (usePme ? "Pme" : "") << " (energy " << energy << ", converged "
+              << expectedEnergy << ")" << std::endl;
+}
+
+int main( int numberOfArguments, char* argv[] ) {
+
+    try {
+        std::cout << "TestReferenceMBPolInducedDipoles running test..." << std::endl;
+        testDipoleFieldTensor( false );
+        testDipoleFieldTensor( true );
+        testConjugateGradient( false );
+        testConjugateGradient( true );
+        testDIIS( false );
+        testDIIS( true );
+        testThreadedSpreading();
+        testPmeBSplineOrder();
+        testDenseSolve();
+        testSystemPolarizability( false );
+        testSystemPolarizability( true );
+        testSingleDipoleSet( false );
+        testSingleDipoleSet( true );
+        testReusedForce( false );
+        testReusedForce( true );
+        testInducedDipolePredictor( false );
+        testInducedDipolePredictor( true );
+        testExtendedLagrangian( false );
+        testExtendedLagrangian( true );
+        testExtrapolated( false );
+        testExtrapolated( true );
+    } catch(const std::exception& e) {
+        std::cout << "exception: " << e.what() << std::endl;
+        std::cout << "FAIL - ERROR.  Test failed." << std::endl;
+        return 1;
+    }
+    std::cout << "Done" << std::endl;
+    return 0;
+}
@@ -0,0 +1,190 @@
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMMMBPol                             *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2008-2012 Stanford University and the Authors.      *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+/**
+ * This tests that the 2-body and 3-body forces of the Reference platform computed with the
+ * persistent neighbor lists (nonzero skin) match the ones computed with lists rebuilt on every
+ * evaluation (zero skin).
+ */
+
+#include "openmm/internal/AssertionUtilities.h"
+#include "openmm/Context.h"
+#include "OpenMMMBPol.h"
+#include "openmm/System.h"
+#include "openmm/LangevinIntegrator.h"
+#include <cmath>
+#include <iostream>
+#include <vector>
+#include <stdlib.h>
+#include <stdio.h>
+
+using namespace  OpenMM;
+using namespace MBPolPlugin;
+
+const double TOL = 1e-6;
+
+// 27 waters (O, H, H) on a slightly distorted cubic lattice with 3 Angstrom spacing,
+// the 2-body force in force group 0 and the 3-body force in force group 1
+
+static void buildWaters( System& system, std::vector<Vec3>& positions, double boxDimension, double skin ){
+
+    MBPolTwoBodyForce* mbpolTwoBodyForce     = new MBPolTwoBodyForce();
+    MBPolThreeBodyForce* mbpolThreeBodyForce = new MBPolThreeBodyForce();
+    mbpolTwoBodyForce->setCutoff( 0.65 );
+    mbpolThreeBodyForce->setCutoff( 0.45 );
+    mbpolTwoBodyForce->setNeighborListSkin( skin );
+    mbpolThreeBodyForce->setNeighborListSkin( skin );
+
+    if( boxDimension > 0.0 ){
+        Vec3 a( boxDimension, 0.0, 0.0 );
+        Vec3 b( 0.0, boxDimension, 0.0 );
+        Vec3 c( 0.0, 0.0, boxDimension );
+        system.setDefaultPeriodicBoxVectors( a, b, c );
+        mbpolTwoBodyForce->setNonbondedMethod(MBPolTwoBodyForce::CutoffPeriodic);
+        mbpolThreeBodyForce->setNonbondedMethod(MBPolThreeBodyForce::CutoffPeriodic);
+    } else {
+        mbpolTwoBodyForce->setNonbondedMethod(MBPolTwoBodyForce::CutoffNonPeriodic);
+        mbpolThreeBodyForce->setNonbondedMethod(MBPolThreeBodyForce::CutoffNonPeriodic);
+    }
+
+    // monomer geometry in Angstrom, centered on the oxygen
+
+    std::vector<Vec3> monomer(3);
+    monomer[0] = Vec3(  0.000000000e+00,  0.000000000e+00,  0.000000000e+00 );
+    monomer[1] = Vec3(  8.941753587e-01, -3.986263085e-01,  1.177647080e-01 );
+    monomer[2] = Vec3( -5.015394760e-01, -2.167182699e-01,  7.849699320e-01 );
+
+    double spacing = 3.0;
+    positions.resize(0);
+    std::vector<int> particleIndices(3);
+    for( int ix = 0; ix < 3; ix++ ){
+        for( int iy = 0; iy < 3; iy++ ){
+            for( int iz = 0; iz < 3; iz++ ){
+                int jj = system.getNumParticles();
+                system.addParticle( 1.5999000e+01 );
+                system.addParticle( 1.0080000e+00 );
+                system.addParticle( 1.0080000e+00 );
+                particleIndices[0] = jj;
+                particleIndices[1] = jj+1;
+                particleIndices[2] = jj+2;
+                mbpolTwoBodyForce->addParticle( particleIndices );
+                mbpolThreeBodyForce->addParticle( particleIndices );
+
+                Vec3 origin( spacing*ix + 0.1*((iy+2*iz) % 3), spacing*iy + 0.1*((iz+2*ix) % 3), spacing*iz + 0.1*((ix+2*iy) % 3) );
+                for( unsigned int kk = 0; kk < 3; kk++ ){
+                    positions.push_back( (origin + monomer[kk])*0.1 );
+                }
+            }
+        }
+    }
+
+    mbpolTwoBodyForce->setForceGroup(0);
+    mbpolThreeBodyForce->setForceGroup(1);
+    system.addForce(mbpolTwoBodyForce);
+    system.addForce(mbpolThreeBodyForce);
+}
+
+static void compareStates( Context& skinContext, Context& noSkinContext ){
+    for( int group = 0; group < 2; group++ ){
+        State skinState   = skinContext.getState(State::Forces | State::Energy, false, 1<<group);
+        State noSkinState = noSkinContext.getState(State::Forces | State::Energy, false, 1<<group);
+
+        ASSERT_EQUAL_TOL( noSkinState.getPotentialEnergy(), skinState.getPotentialEnergy(), TOL );
+
+        const std::vector<Vec3>& skinForces   = skinState.getForces();
+        const std::vector<Vec3>& noSkinForces = noSkinState.getForces();
+        for( unsigned int ii = 0; ii < noSkinForces.size(); ii++ ){
+            ASSERT_EQUAL_VEC( noSkinForces[ii], skinForces[ii], TOL );
+        }
+    }
+}
+
+// small steps reuse the list for a few steps before it is rebuilt; then one molecule jumps by more
+// than half the skin, so that pairs the list was not built for come within the cutoffs
+
+static void testNeighborListSkin( double boxDimension ){
+
+    std::string testName = boxDimension > 0.0 ? "testNeighborListSkinPeriodic" : "testNeighborListSkin";
+
+    const double skin = 0.05;
+
+    System skinSystem;
+    System noSkinSystem;
+    std::vector<Vec3> positions;
+    buildWaters( skinSystem, positions, boxDimension, skin );
+    buildWaters( noSkinSystem, positions, boxDimension, 0.0 );
+
+    LangevinIntegrator skinIntegrator(0.0, 0.1, 0.01);
+    LangevinIntegrator noSkinIntegrator(0.0, 0.1, 0.01);
+    Context skinContext(skinSystem, skinIntegrator, Platform::getPlatformByName("Reference"));
+    Context noSkinContext(noSkinSystem, noSkinIntegrator, Platform::getPlatformByName("Reference"));
+
+    for( int step = 0; step < 12; step++ ){
+        for( unsigned int ii = 0; ii < positions.size(); ii += 3 ){
+            Vec3 delta( 0.004*((ii+step) % 3), -0.003*((ii+2*step) % 4), 0.002*((2*ii+step) % 5) );
+            for( unsigned int kk = 0; kk < 3; kk++ ){
+                positions[ii+kk] += delta;
+            }
+        }
+        skinContext.setPositions(positions);
+        noSkinContext.setPositions(positions);
+        compareStates( skinContext, noSkinContext );
+    }
+
+    // the corner molecule 0 jumps by twice the skin toward the central molecule 13, which brings
+    // the pair 0-13 within the 3-body cutoff and the pair 0-19 within the 2-body cutoff
+
+    Vec3 jump = positions[3*13] - positions[0];
+    jump     *= 2.0*skin/std::sqrt( jump.dot( jump ) );
+    for( unsigned int kk = 0; kk < 3; kk++ ){
+        positions[kk] += jump;
+    }
+    skinContext.setPositions(positions);
+    noSkinContext.setPositions(positions);
+    compareStates( skinContext, noSkinContext );
+
+    std::cout << "Test Successful: " << testName << std::endl;
+}
+
+int main( int numberOfArguments, char* argv[] ) {
+
+    try {
+        std::cout << "TestReferenceMBPolNeighborListSkin running test..." << std::endl;
+        testNeighborListSkin( 0.0 );
+        testNeighborListSkin( 2.0 );
+    } catch(const std::exception& e) {
+        std::cout << "exception: " << e.what() << std::endl;
+        std::cout << "FAIL - ERROR.  Test failed." << std::endl;
+        return 1;
+    }
+    std::cout << "Done" << std::endl;
+    return 0;
+}
@@ -0,0 +1,102 @@
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMMMBPol                             *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2008-2012 Stanford University and the Authors.      *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+
+/**
+ * This tests the real-to-complex transforms of the reference PME FFT against the
+ * complex transform of the same grid.
+ */
+
+#include "openmm/internal/AssertionUtilities.h"
+#include "MBPolReferencePmeFFT.h"
+#include <iostream>
+#include <vector>
+#include <stdlib.h>
+
+using namespace  OpenMM;
+
+const double TOL = 1e-10;
+
+static void testRealToComplex( int xsize, int ysize, int zsize ){
+
+    int numPoints    = xsize*ysize*zsize;
+    int complexSizeZ = zsize/2 + 1;
+
+    std::vector<RealOpenMM> realGrid( numPoints );
+    std::vector<t_complex> grid( numPoints );
+    srand( 1234 );
+    for( int ii = 0; ii < numPoints; ii++ ){
+        realGrid[ii] = rand()/(RAND_MAX + 1.0) - 0.5;
+        grid[ii].re  = realGrid[ii];
+        grid[ii].im  = 0.0;
+    }
+
+    MBPolReferencePmeFFT fft( xsize, ysize, zsize );
+    ASSERT_EQUAL( complexSizeZ, fft.getComplexSizeZ() );
+
+    std::vector<t_complex> halfSpectrum( xsize*ysize*complexSizeZ );
+    fft.transformRealToComplex( &realGrid[0], &halfSpectrum[0] );
+    fft.transformComplex( &grid[0], true );
+    for( int line = 0; line < xsize*ysize; line++ ){
+        for( int kk = 0; kk < complexSizeZ; kk++ ){
+            ASSERT_EQUAL_TOL( grid[line*zsize+kk].re, halfSpectrum[line*complexSizeZ+kk].re, TOL );
+            ASSERT_EQUAL_TOL( grid[line*zsize+kk].im, halfSpectrum[line*complexSizeZ+kk].im, TOL );
+        }
+    }
+
+    // back to the grid scaled by the number of points, as the complex transform
+
+    std::vector<RealOpenMM> backward( numPoints );
+    fft.transformComplexToReal( &halfSpectrum[0], &backward[0] );
+    fft.transformComplex( &grid[0], false );
+    for( int ii = 0; ii < numPoints; ii++ ){
+        ASSERT_EQUAL_TOL( grid[ii].re, backward[ii], TOL );
+        ASSERT_EQUAL_TOL( numPoints*realGrid[ii], backward[ii], TOL );
+    }
+    std::cout << "Test Successful: testRealToComplex " << xsize << "x" << ysize << "x" << zsize
+              << " (" << MBPolReferencePmeFFT::getBackendName() << ")" << std::endl;
+}
+
+int main( int numberOfArguments, char* argv[] ) {
+
+    try {
+        std::cout << "TestReferenceMBPolPmeFFT running test..." << std::endl;
+        testRealToComplex( 12, 10, 8 );
+        testRealToComplex( 6, 5, 9 );
+        testRealToComplex( 5, 7, 2 );
+    } catch(const std::exception& e) {
+        std::cout << "exception: " << e.what() << std::endl;
+        std::cout << "FAIL - ERROR.  Test failed." << std::endl;
+        return 1;
+    }
+    std::cout << "Done" << std::endl;
+    return 0;
+}
@@ -0,0 +1,169 @@
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMMMBPol                             *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2008-2012 Stanford University and the Authors.      *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+/**
+ * This tests that the batched (SIMD) evaluation of the 2-body and 3-body polynomials,
+ * with and without gradients, agrees with the scalar evaluation, for the variant
+ * selected at run time and for every variant supported by the CPU.
+ */
+
+#include "openmm/internal/AssertionUtilities.h"
+#include "poly-2b-v6x-impl.h"
+#include "poly-3b-v2x-impl.h"
+#include "mbpol_simd.h"
+#include <iostream>
+#include <vector>
+#include <stdlib.h>
+#include <stdio.h>
+
+using namespace  OpenMM;
+
+const double TOL = 1e-12;
+
+// deterministic values in [lower, upper)
+
+static void fillValues( std::vector<double>& values, double lower, double upper, unsigned int seed ){
+    srand( seed );
+    for( unsigned int ii = 0; ii < values.size(); ii++ ){
+        values[ii] = lower + (upper - lower)*(rand()/(RAND_MAX + 1.0));
+    }
+}
+
+typedef void (*Batch2B)( const double a[1153], const double x[31][poly_2b_v6x_batch],
+                         double g[31][poly_2b_v6x_batch], double e[poly_2b_v6x_batch],
+                         double scratch[poly_2b_v6x_scratch_size] );
+
+typedef void (*Batch3B)( const double a[1163], const double x[36][poly_3b_v2x::batch],
+                         double g[36][poly_3b_v2x::batch], double e[poly_3b_v2x::batch] );
+
+typedef void (*Energies2B)( const double a[1153], const double x[31][poly_2b_v6x_batch],
+                            double e[poly_2b_v6x_batch], double scratch[poly_2b_v6x_scratch_size] );
+
+typedef void (*Energies3B)( const double a[1163], const double x[36][poly_3b_v2x::batch],
+                            double e[poly_3b_v2x::batch] );
+
+static void testPoly2B( Batch2B evalBatch, Energies2B evalEnergies, const std::string& testName ){
+
+    std::vector<double> a(1153), values(31*poly_2b_v6x_batch);
+    fillValues( a, -5.0, 5.0, 11 );
+    fillValues( values, 0.05, 1.0, 13 );
+
+    double x[31][poly_2b_v6x_batch], g[31][poly_2b_v6x_batch], e[poly_2b_v6x_batch], energies[poly_2b_v6x_batch];
+    for( unsigned int ii = 0; ii < 31; ii++ ){
+        for( unsigned int kk = 0; kk < poly_2b_v6x_batch; kk++ ){
+            x[ii][kk] = values[ii*poly_2b_v6x_batch + kk];
+        }
+    }
+
+    // scratch that is not aligned for any of the lane types
+
+    std::vector<double> scratch( poly_2b_v6x_scratch_size + 1 );
+    evalBatch( &a[0], x, g, e, &scratch[1] );
+    evalEnergies( &a[0], x, energies, &scratch[1] );
+
+    for( unsigned int kk = 0; kk < poly_2b_v6x_batch; kk++ ){
+        double xk[31], gk[31];
+        for( unsigned int ii = 0; ii < 31; ii++ ){
+            xk[ii] = x[ii][kk];
+        }
+        double energy = poly_2b_v6x_eval( &a[0], xk, gk );
+        ASSERT_EQUAL_TOL( energy, e[kk], TOL );
+        ASSERT_EQUAL_TOL( energy, poly_2b_v6x_eval( &a[0], xk ), TOL );
+        ASSERT_EQUAL_TOL( energy, energies[kk], TOL );
+        for( unsigned int ii = 0; ii < 31; ii++ ){
+            ASSERT_EQUAL_TOL( gk[ii], g[ii][kk], TOL );
+        }
+    }
+    std::cout << "Test Successful: " << testName << std::endl;
+}
+
+static void testPoly3B( Batch3B evalBatch, Energies3B evalEnergies, const std::string& testName ){
+
+    std::vector<double> a(1163), values(36*poly_3b_v2x::batch);
+    fillValues( a, -5.0, 5.0, 17 );
+    fillValues( values, 0.05, 1.0, 19 );
+
+    double x[36][poly_3b_v2x::batch], g[36][poly_3b_v2x::batch], e[poly_3b_v2x::batch], energies[poly_3b_v2x::batch];
+    for( unsigned int ii = 0; ii < 36; ii++ ){
+        for( unsigned int kk = 0; kk < poly_3b_v2x::batch; kk++ ){
+            x[ii][kk] = values[ii*poly_3b_v2x::batch + kk];
+        }
+    }
+
+    evalBatch( &a[0], x, g, e );
+    evalEnergies( &a[0], x, energies );
+
+    for( unsigned int kk = 0; kk < poly_3b_v2x::batch; kk++ ){
+        double xk[36], gk[36];
+        for( unsigned int ii = 0; ii < 36; ii++ ){
+            xk[ii] = x[ii][kk];
+        }
+        double energy = poly_3b_v2x::eval( &a[0], xk, gk );
+        ASSERT_EQUAL_TOL( energy, e[kk], TOL );
+        ASSERT_EQUAL_TOL( energy, poly_3b_v2x::eval( &a[0], xk ), TOL );
+        ASSERT_EQUAL_TOL( energy, energies[kk], TOL );
+        for( unsigned int ii = 0; ii < 36; ii++ ){
+            ASSERT_EQUAL_TOL( gk[ii], g[ii][kk], TOL );
+        }
+    }
+    std::cout << "Test Successful: " << testName << std::endl;
+}
+
+int main( int numberOfArguments, char* argv[] ) {
+
+    try {
+        std::cout << "TestReferenceMBPolPolynomialBatch running test..." << std::endl;
+
+        testPoly2B( poly_2b_v6x_eval_batch, poly_2b_v6x_eval_batch, "poly_2b_v6x_eval_batch" );
+        testPoly3B( poly_3b_v2x::eval_batch, poly_3b_v2x::eval_batch, "poly_3b_v2x::eval_batch" );
+
+#if defined(MBPOL_SIMD_AVX2)
+        if( mbpol_simd::cpu_has_avx2() ){
+            testPoly2B( poly_2b_v6x_eval_avx2, poly_2b_v6x_eval_avx2, "poly_2b_v6x_eval_avx2" );
+            testPoly3B( poly_3b_v2x_eval_avx2, poly_3b_v2x_eval_avx2, "poly_3b_v2x_eval_avx2" );
+        }
+#endif
+
+#if defined(MBPOL_SIMD_AVX512)
+        if( mbpol_simd::cpu_has_avx512() ){
+            testPoly2B( poly_2b_v6x_eval_avx512, poly_2b_v6x_eval_avx512, "poly_2b_v6x_eval_avx512" );
+            testPoly3B( poly_3b_v2x_eval_avx512, poly_3b_v2x_eval_avx512, "poly_3b_v2x_eval_avx512" );
+        }
+#endif
+
+    } catch(const std::exception& e) {
+        std::cout << "exception: " << e.what() << std::endl;
+        std::cout << "FAIL - ERROR.  Test failed." << std::endl;
+        return 1;
+    }
+    std::cout << "Done" << std::endl;
+    return 0;
+}
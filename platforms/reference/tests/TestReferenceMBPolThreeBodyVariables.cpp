@@ -0,0 +1,113 @@
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMMMBPol                             *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2008-2012 Stanford University and the Authors.      *
+ * Authors:                                                                   *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+/**
+ * This tests that the 3-body force computed with the variables cached per molecule and
+ * per pair of the neighbor list agrees with the force computed without the cache.
+ */
+
+#include "openmm/internal/AssertionUtilities.h"
+#include "MBPolReferenceThreeBodyForce.h"
+#include "ReferenceThreeNeighborList.h"
+#include "MBPolReferenceTestWaters.h"
+#include <iostream>
+#include <vector>
+#include <stdlib.h>
+#include <stdio.h>
+
+using namespace  OpenMM;
+using namespace MBPolPlugin;
+
+const double TOL = 1e-10;
+
+static void testThreeBodyVariables( bool usePeriodic, bool shift, const std::string& testName ){
+
+    const double boxSize = 1.25;
+    const double cutoff = 0.45;
+    RealVec box( boxSize, boxSize, boxSize );
+
+    std::vector<RealVec> positions;
+    std::vector<std::vector<int> > allParticleIndices;
+    setupWaters( 4, boxSize, 4321, shift, positions, allParticleIndices );
+    int numMolecules = allParticleIndices.size();
+
+    std::vector<RealVec> oxygenPositions( numMolecules );
+    for( int ii = 0; ii < numMolecules; ii++ ){
+        oxygenPositions[ii] = positions[allParticleIndices[ii][0]];
+    }
+
+    // the pair list is built for a longer distance than the triplets, as with a skin
+
+    ThreeNeighborPairList pairList;
+    pairList.build( numMolecules, oxygenPositions, box, usePeriodic, cutoff + 0.05 );
+    ThreeNeighborList triplets;
+    computeThreeNeighborListVoxelHash( triplets, numMolecules, oxygenPositions, box, usePeriodic, cutoff );
+    ASSERT( triplets.size() > 0 );
+
+    MBPolReferenceThreeBodyForce force;
+    force.setCutoff( cutoff );
+    force.setNonbondedMethod( usePeriodic ? MBPolReferenceThreeBodyForce::CutoffPeriodic : MBPolReferenceThreeBodyForce::CutoffNonPeriodic );
+    force.setPeriodicBox( box );
+
+    std::vector<RealVec> expectedForces( positions.size() );
+    double expectedEnergy = force.calculateForceAndEnergy( numMolecules, positions, allParticleIndices, triplets, expectedForces );
+
+    MBPolReferenceThreeBodyVariables variables;
+    variables.compute( positions, allParticleIndices, pairList, box, usePeriodic );
+    force.setVariables( &variables );
+
+    std::vector<RealVec> forces( positions.size() );
+    double energy = force.calculateForceAndEnergy( numMolecules, positions, allParticleIndices, triplets, forces );
+
+    ASSERT_EQUAL_TOL( expectedEnergy, energy, TOL );
+    for( unsigned int ii = 0; ii < positions.size(); ii++ ){
+        ASSERT_EQUAL_VEC( expectedForces[ii], forces[ii], TOL );
+    }
+    std::cout << "Test Successful: " << testName << std::endl;
+}
+
+int main( int numberOfArguments, char* argv[] ) {
+
+    try {
+        std::cout << "TestReferenceMBPolThreeBodyVariables running test..." << std::endl;
+
+        testThreeBodyVariables( false, false, "testThreeBodyVariablesNonPeriodic" );
+        testThreeBodyVariables( true, false, "testThreeBodyVariablesPeriodic" );
+        testThreeBodyVariables( true, true, "testThreeBodyVariablesPeriodicShifted" );
+
+    } catch(const std::exception& e) {
+        std::cout << "exception: " << e.what() << std::endl;
+        std::cout << "FAIL - ERROR.  Test failed." << std::endl;
+        return 1;
+    }
+    std::cout << "Done" << std::endl;
+    return 0;
+}
@@ -34,6 +34,9 @@
 #include <cassert>
 #include <iostream>
 #include <vector>
+#include <cstdlib>
+#include <algorithm>
+#include <map>
 
 using namespace std;
 using namespace  OpenMM;
@@ -53,7 +56,13 @@ void testNeighborList()
     computeThreeNeighborListVoxelHash(neighborList, particleList.size(), particleList, boxSize, false, 13.7, 0.01);
     assert(neighborList.size() == 1);
     
+    // 0-1 is out of range, 1-2 and 0-2 are within range
+
     computeThreeNeighborListVoxelHash(neighborList, particleList.size(), particleList, boxSize, false, 13.5, 0.01);
+    assert(neighborList.size() == 1);
+    assert(neighborList[0].first == 2);
+
+    computeThreeNeighborListVoxelHash(neighborList, particleList.size(), particleList, boxSize, false, 11.5, 0.01);
     assert(neighborList.size() == 0);
 }
 
@@ -115,6 +124,75 @@ void verifyNeighborList(ThreeNeighborList& list, int numParticles, vector<RealVe
 
 }
 
+static bool inRange(RealVec& pos1, RealVec& pos2, const RealVec& periodicBoxSize, double cutoff) {
+    return distance2(pos1, pos2, periodicBoxSize) <= cutoff*cutoff;
+}
+
+// the list holds each triplet with at least two of its three pairs within cutoff once;
+// compare with all such triplets for random positions, with and without periodic boundaries,
+// and check that the generator gives the same triplets in blocks of bounded size
+
+void testNeighborListBruteForce(bool usePeriodic)
+{
+    const int numParticles = 300;
+    const double cutoff = 0.45;
+    RealVec periodicBoxSize(1.9, 2.3, 1.1);
+
+    vector<RealVec> positions(numParticles);
+    srand(1234);
+    for (int i = 0; i < numParticles; i++)
+        for (int d = 0; d < 3; d++)
+            positions[i][d] = periodicBoxSize[d]*(1.5*rand()/(double) RAND_MAX - 0.25);
+
+    RealVec distanceBox = usePeriodic ? periodicBoxSize : RealVec(1.0e+10, 1.0e+10, 1.0e+10);
+    map<int, int> count;
+    int expected = 0;
+    for (int i = 0; i < numParticles; i++)
+        for (int j = 0; j < i; j++)
+            for (int q = 0; q < j; q++)
+                if (inRange(positions[i], positions[j], distanceBox, cutoff) +
+                    inRange(positions[i], positions[q], distanceBox, cutoff) +
+                    inRange(positions[j], positions[q], distanceBox, cutoff) >= 2) {
+                    count[(i*numParticles+j)*numParticles+q] = 1;
+                    expected++;
+                }
+
+    ThreeNeighborList list;
+    computeThreeNeighborListVoxelHash(list, numParticles, positions, periodicBoxSize, usePeriodic, cutoff, 0.0);
+    ASSERT(expected == (int) list.size());
+
+    for (int i = 0; i < (int) list.size(); i++) {
+        int sites[3] = {(int) list[i].first, (int) list[i].second, (int) list[i].third};
+        ASSERT(inRange(positions[sites[0]], positions[sites[1]], distanceBox, cutoff));
+        ASSERT(inRange(positions[sites[0]], positions[sites[2]], distanceBox, cutoff));
+        sort(sites, sites+3);
+        ASSERT(count.find((sites[2]*numParticles+sites[1])*numParticles+sites[0]) != count.end());
+        int& seen = count[(sites[2]*numParticles+sites[1])*numParticles+sites[0]];
+        ASSERT(seen == 1);
+        seen = 2;
+    }
+
+    // the pairs are built for a larger distance, as for a list with a skin
+
+    ThreeNeighborPairList pairList;
+    pairList.build(numParticles, positions, periodicBoxSize, usePeriodic, cutoff+0.1);
+    ThreeNeighborTripletGenerator triplets(pairList, positions, periodicBoxSize, usePeriodic, cutoff, 0.0, 0, numParticles);
+    ThreeNeighborList block;
+    int numTriplets = 0;
+    while (triplets.next(block, 7)) {
+        ASSERT(block.size() > 0 && block.size() <= 7);
+        for (int i = 0; i < (int) block.size(); i++) {
+            int sites[3] = {(int) block[i].first, (int) block[i].second, (int) block[i].third};
+            sort(sites, sites+3);
+            int& seen = count[(sites[2]*numParticles+sites[1])*numParticles+sites[0]];
+            ASSERT(seen == 2);
+            seen = 3;
+        }
+        numTriplets += block.size();
+    }
+    ASSERT(numTriplets == expected);
+}
+
 int main() 
 {
 try {
@@ -122,6 +200,10 @@ try {
 
     testNeighborListFourAtoms();
 
+    testNeighborListBruteForce(false);
+
+    testNeighborListBruteForce(true);
+
     cout << "Test Passed" << endl;
     return 0;
 }
@@ -47,6 +47,10 @@ public:
 
     enum NonbondedMethod { NoCutoff, PME };
 
+    enum PolarizationSolver { SOR, ConjugateGradient, DIIS, Dense };
+
+    enum PolarizationType { Mutual, ExtendedLagrangian, Extrapolated };
+
     void setNonbondedMethod(NonbondedMethod method);
 
     double getCutoffDistance(void) const;
@@ -61,12 +65,27 @@ public:
 
     // void setAEwald(double aewald);
 
-    // int getPmeBSplineOrder() const;
+    int getPmeBSplineOrder() const;
+
+    void setPmeBSplineOrder(int order);
 
     // void getPmeGridDimensions(std::vector<int>& gridDimension) const;
 
     // void setPmeGridDimensions(const std::vector<int>& gridDimension);
 
+    void setUsePmeTuning(bool useTuning);
+
+    bool getUsePmeTuning(void) const;
+
+    void setPmeTuningCacheFile(const std::string& fileName);
+
+    const std::string& getPmeTuningCacheFile(void) const;
+
+    %apply double& OUTPUT { double& alpha, double& cutoff };
+    %apply int& OUTPUT { int& nx, int& ny, int& nz, int& order };
+    void getPmeParametersInContext(Context& context, double& alpha, double& cutoff, int& nx, int& ny, int& nz, int& order);
+    %clear double& alpha, double& cutoff, int& nx, int& ny, int& nz, int& order;
+
     int addElectrostatics(double charge,
                      int moleculeIndex, int atomType, double dampingFactor, double polarity);
 
@@ -88,9 +107,37 @@ public:
 
     // void setEwaldErrorTolerance(double tol);
 
+    void setUseDipoleFieldTensor(bool useTensor);
+
+    bool getUseDipoleFieldTensor(void) const;
+
+    void setUseInducedDipolePredictor(bool usePredictor);
+
+    bool getUseInducedDipolePredictor(void) const;
+
+    void setPolarizationSolver(PolarizationSolver solver);
+
+    PolarizationSolver getPolarizationSolver(void) const;
+
+    void setDenseSolverThreshold(int sites);
+
+    int getDenseSolverThreshold(void) const;
+
+    void setPolarizationType(PolarizationType type);
+
+    PolarizationType getPolarizationType(void) const;
+
+    void setExtendedLagrangianParameters(double coupling, double dissipation, int iterations);
+
+    void setExtrapolationCoefficients(const std::vector<double>& coefficients);
+
+    const std::vector<double>& getExtrapolationCoefficients(void) const;
+
     void getElectrostaticPotential(const std::vector< Vec3 >& inputGrid,
                                      Context& context, std::vector< double >& outputElectrostaticPotential);
 
+    void getSystemPolarizability(Context& context, std::vector< double >& outputPolarizability);
+
     void updateParametersInContext(Context& context);
 
     void setTholeParameters( std::vector< double > tholeP);
@@ -134,6 +181,10 @@ public:
 
     double getCutoff(void) const;
 
+    void setNeighborListSkin(double skin);
+
+    double getNeighborListSkin(void) const;
+
 
     enum NonbondedMethod { NoCutoff, CutoffPeriodic, CutoffNonPeriodic };
 
@@ -161,6 +212,10 @@ public:
 
     double getCutoff(void) const;
 
+    void setNeighborListSkin(double skin);
+
+    double getNeighborListSkin(void) const;
+
     enum NonbondedMethod { NoCutoff, CutoffPeriodic, CutoffNonPeriodic };
 
 
@@ -0,0 +1,81 @@
+from __future__ import print_function
+from simtk.openmm import app
+import simtk.openmm as mm
+from simtk import unit
+import datetime
+import mbpol
+import mbpolplugin
+
+# NVE energy drift of the extended Lagrangian induced dipoles against the
+# induced dipoles converged every step, on the 256 water box;
+# run from the python folder: python utils/run_energy_drift.py
+
+polarizations = [("converged", mbpolplugin.MBPolElectrostaticsForce.Mutual),
+                 ("extended Lagrangian", mbpolplugin.MBPolElectrostaticsForce.ExtendedLagrangian)]
+
+extendedLagrangianCoupling = 1.82
+extendedLagrangianDissipation = 0.018
+extendedLagrangianIterations = 1
+
+pdb = app.PDBFile('water256_bulk.pdb')
+boxDim = 19.3996888399961804/10.
+boxSize = (boxDim, boxDim, boxDim) * unit.nanometer
+pdb.topology.setUnitCellDimensions(boxSize)
+forcefield = app.ForceField(mbpol.__file__.replace('mbpol.py', 'mbpol.xml'))
+
+timestep = 0.5*unit.femtoseconds
+temperature = 300*unit.kelvin
+equilibration_steps = 100
+production_steps = 2000
+report_interval = 100
+
+platform = mm.Platform.getPlatformByName('Reference')
+
+# the same equilibrated starting point for every run
+
+system = forcefield.createSystem(pdb.topology, nonbondedMethod=app.PME,
+    nonbondedCutoff=0.9*unit.nanometers, constraints=None, rigidWater=True)
+system.addForce(mm.AndersenThermostat(temperature, 1./unit.picoseconds))
+simulation = app.Simulation(pdb.topology, system, mm.VerletIntegrator(timestep), platform)
+simulation.context.setPositions(pdb.positions)
+simulation.context.computeVirtualSites()
+simulation.context.setVelocitiesToTemperature(temperature)
+simulation.step(equilibration_steps)
+state = simulation.context.getState(getPositions=True, getVelocities=True)
+positions = state.getPositions()
+velocities = state.getVelocities()
+
+for name, polarizationType in polarizations:
+
+    system = forcefield.createSystem(pdb.topology, nonbondedMethod=app.PME,
+        nonbondedCutoff=0.9*unit.nanometers, constraints=None, rigidWater=True)
+    for force in system.getForces():
+        if type(force) == mbpolplugin.MBPolElectrostaticsForce:
+            force.setPolarizationType(polarizationType)
+            force.setExtendedLagrangianParameters(extendedLagrangianCoupling, extendedLagrangianDissipation,
+                                                  extendedLagrangianIterations)
+
+    simulation = app.Simulation(pdb.topology, system, mm.VerletIntegrator(timestep), platform)
+    simulation.context.setPositions(positions)
+    simulation.context.computeVirtualSites()
+    simulation.context.setVelocities(velocities)
+
+    energies = []
+    start = datetime.datetime.now()
+    for step in range(0, production_steps + 1, report_interval):
+        if step > 0:
+            simulation.step(report_interval)
+        state = simulation.context.getState(getEnergy=True)
+        energy = state.getPotentialEnergy() + state.getKineticEnergy()
+        energies.append(energy.value_in_unit(unit.kilojoule_per_mole))
+    end = datetime.datetime.now()
+
+    # drift per picosecond and per degree of freedom from a least squares line
+
+    times = [i*report_interval*timestep.value_in_unit(unit.picoseconds) for i in range(len(energies))]
+    meanTime = sum(times)/len(times)
+    meanEnergy = sum(energies)/len(energies)
+    slope = sum((t - meanTime)*(e - meanEnergy) for t, e in zip(times, energies))/sum((t - meanTime)**2 for t in times)
+    degreesOfFreedom = 6*pdb.topology.getNumResidues()
+    print("%s: drift %.3e kJ/mol/ps/dof, largest deviation %.3f kJ/mol, %.0f s" % (name,
+          slope/degreesOfFreedom, max(abs(e - energies[0]) for e in energies), (end-start).total_seconds()))